@@ -0,0 +1,182 @@
+/**
+ * @file bench_atlas_contention.c
+ * @brief Atlas optimistic transaction contention benchmark
+ *
+ * Each worker runs short transactions that read one key and update another,
+ * then commit. Keys are one per page. A transaction draws its keys from a
+ * small shared hot set with probability "overlap" and from the worker's
+ * private pages otherwise, so overlap 0% never conflicts and overlap 100%
+ * conflicts as often as the hot set allows.
+ *
+ * Reports commits/sec and abort rate for every thread count and overlap.
+ *
+ * Usage: bench_atlas_contention [milliseconds-per-run] [atlas-path] [group-commit-us]
+ */
+
+#include "seraph/atlas.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <threads.h>
+#include <time.h>
+
+#define BENCH_MAX_THREADS   8
+#define BENCH_PRIVATE_KEYS  32
+#define BENCH_HOT_KEYS      8
+#define BENCH_ATLAS_SIZE    (4u * 1024 * 1024)
+
+typedef struct {
+    Seraph_Atlas*  atlas;
+    uint8_t*       keys;            /* Page-aligned key pages */
+    uint32_t       worker;
+    uint32_t       overlap_pct;
+    atomic_bool*   stop;
+    uint64_t       commits;
+    uint64_t       aborts;
+} Bench_Worker;
+
+static uint64_t bench_now_ns(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static uint32_t bench_rand(uint64_t* state) {
+    /* xorshift64* */
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return (uint32_t)((*state * 0x2545F4914F6CDD1Dull) >> 32);
+}
+
+static uint64_t* bench_key(Bench_Worker* w, uint64_t* rng) {
+    uint32_t page;
+    if (bench_rand(rng) % 100 < w->overlap_pct) {
+        page = bench_rand(rng) % BENCH_HOT_KEYS;
+    } else {
+        page = BENCH_HOT_KEYS + w->worker * BENCH_PRIVATE_KEYS +
+               bench_rand(rng) % BENCH_PRIVATE_KEYS;
+    }
+    return (uint64_t*)(w->keys + (size_t)page * SERAPH_PAGE_SIZE);
+}
+
+static int bench_worker_main(void* arg) {
+    Bench_Worker* w = (Bench_Worker*)arg;
+    uint64_t rng = 0x9E3779B97F4A7C15ull * (w->worker + 1);
+
+    while (!atomic_load_explicit(w->stop, memory_order_relaxed)) {
+        Seraph_Atlas_Transaction* tx = seraph_atlas_begin(w->atlas);
+        if (tx == NULL) {
+            continue;
+        }
+
+        uint64_t* src = bench_key(w, &rng);
+        uint64_t* dst = bench_key(w, &rng);
+        seraph_atlas_tx_mark_read(tx, src, sizeof(*src));
+        seraph_atlas_tx_mark_dirty(tx, dst, sizeof(*dst));
+        uint64_t value = __atomic_load_n(src, __ATOMIC_RELAXED);
+        __atomic_fetch_add(dst, value + 1, __ATOMIC_RELAXED);
+
+        if (seraph_vbit_is_true(seraph_atlas_commit(w->atlas, tx))) {
+            w->commits++;
+        } else {
+            w->aborts++;
+        }
+    }
+    return 0;
+}
+
+static void bench_run(Seraph_Atlas* atlas, uint8_t* keys, uint32_t threads,
+                      uint32_t overlap_pct, uint32_t duration_ms) {
+    Seraph_Atlas_Stats before = seraph_atlas_get_stats(atlas);
+    atomic_bool stop;
+    atomic_init(&stop, false);
+
+    thrd_t handles[BENCH_MAX_THREADS];
+    Bench_Worker workers[BENCH_MAX_THREADS];
+    for (uint32_t i = 0; i < threads; i++) {
+        workers[i] = (Bench_Worker){
+            .atlas = atlas, .keys = keys, .worker = i,
+            .overlap_pct = overlap_pct, .stop = &stop,
+        };
+    }
+
+    uint64_t start = bench_now_ns();
+    uint32_t started = 0;
+    for (uint32_t i = 0; i < threads; i++) {
+        if (thrd_create(&handles[i], bench_worker_main, &workers[i]) != thrd_success) {
+            break;
+        }
+        started++;
+    }
+
+    struct timespec pause = {
+        .tv_sec = duration_ms / 1000,
+        .tv_nsec = (long)(duration_ms % 1000) * 1000000L,
+    };
+    thrd_sleep(&pause, NULL);
+    atomic_store(&stop, true);
+
+    uint64_t commits = 0;
+    uint64_t aborts = 0;
+    for (uint32_t i = 0; i < started; i++) {
+        thrd_join(handles[i], NULL);
+        commits += workers[i].commits;
+        aborts += workers[i].aborts;
+    }
+    double seconds = (double)(bench_now_ns() - start) / 1e9;
+    uint64_t attempts = commits + aborts;
+    uint64_t flushes = seraph_atlas_get_stats(atlas).log_flushes - before.log_flushes;
+
+    printf("%7u %7u%% %14.0f %9.2f%% %12.2f\n", started, overlap_pct,
+           (double)commits / seconds,
+           attempts ? 100.0 * (double)aborts / (double)attempts : 0.0,
+           flushes ? (double)commits / (double)flushes : 0.0);
+}
+
+int main(int argc, char** argv) {
+    uint32_t duration_ms = argc > 1 ? (uint32_t)strtoul(argv[1], NULL, 10) : 500;
+    const char* path = argc > 2 ? argv[2] : "bench_atlas_contention.dat";
+    uint32_t group_us = argc > 3 ? (uint32_t)strtoul(argv[3], NULL, 10) : 0;
+    if (duration_ms == 0) {
+        duration_ms = 500;
+    }
+
+    remove(path);
+    Seraph_Atlas atlas;
+    if (!seraph_vbit_is_true(seraph_atlas_init(&atlas, path, BENCH_ATLAS_SIZE))) {
+        fprintf(stderr, "bench_atlas_contention: cannot create Atlas at '%s'\n", path);
+        return 1;
+    }
+
+    size_t key_pages = BENCH_HOT_KEYS + BENCH_MAX_THREADS * BENCH_PRIVATE_KEYS;
+    uint8_t* keys = (uint8_t*)seraph_atlas_calloc(&atlas, (key_pages + 1) * SERAPH_PAGE_SIZE);
+    if (keys == NULL) {
+        fprintf(stderr, "bench_atlas_contention: Atlas too small for key pages\n");
+        seraph_atlas_destroy(&atlas);
+        remove(path);
+        return 1;
+    }
+    seraph_atlas_set_group_commit(&atlas, group_us);
+
+    /* Keep each key on its own page; the spare page absorbs alignment */
+    keys = (uint8_t*)(((uintptr_t)keys + SERAPH_PAGE_SIZE - 1) &
+                      ~(uintptr_t)(SERAPH_PAGE_SIZE - 1));
+
+    static const uint32_t thread_counts[] = { 1, 2, 4, 8 };
+    static const uint32_t overlaps[] = { 0, 10, 50, 100 };
+
+    printf("Atlas transaction contention (%u ms per run, %u hot keys, "
+           "%u us group commit window)\n", duration_ms, BENCH_HOT_KEYS, group_us);
+    printf("%7s %8s %14s %10s %12s\n", "threads", "overlap", "commits/sec", "aborts",
+           "commits/sync");
+    for (size_t t = 0; t < sizeof(thread_counts) / sizeof(thread_counts[0]); t++) {
+        for (size_t o = 0; o < sizeof(overlaps) / sizeof(overlaps[0]); o++) {
+            bench_run(&atlas, keys, thread_counts[t], overlaps[o], duration_ms);
+        }
+    }
+
+    seraph_atlas_destroy(&atlas);
+    remove(path);
+    return 0;
+}
@@ -0,0 +1,149 @@
+/**
+ * @file bench_atlas_validate.c
+ * @brief Atlas checkpoint validation and recovery benchmark
+ *
+ * Builds linked lists of nodes (every node registered in the checkpoint,
+ * each checked for NO_CYCLE and a value RANGE) interleaved with refcounted
+ * blobs, then times seraph_atlas_checkpoint_validate() and, after damaging
+ * one object in a thousand, seraph_atlas_checkpoint_recover().
+ *
+ * Reports milliseconds and nanoseconds per object for each object count
+ * and thread count, which shows how startup validation scales with the
+ * size of the store.
+ *
+ * Usage: bench_atlas_validate [max-objects] [list-length] [atlas-path]
+ */
+
+#include "seraph/atlas.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <time.h>
+
+typedef struct Bench_Node {
+    struct Bench_Node* next;
+    int64_t value;
+} Bench_Node;
+
+typedef struct {
+    int64_t refcount;
+} Bench_Blob;
+
+static uint32_t bench_node_type;
+static uint32_t bench_blob_type;
+
+static uint64_t bench_now_ns(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static int bench_register_types(void) {
+    bench_node_type = seraph_atlas_checkpoint_register_type("bench_node", sizeof(Bench_Node));
+    bench_blob_type = seraph_atlas_checkpoint_register_type("bench_blob", sizeof(Bench_Blob));
+    if (bench_node_type == SERAPH_VOID_U32 || bench_blob_type == SERAPH_VOID_U32) {
+        return 0;
+    }
+
+    Seraph_Atlas_Invariant acyclic =
+        seraph_atlas_invariant_no_cycle(offsetof(Bench_Node, next), "acyclic");
+    Seraph_Atlas_Invariant range =
+        seraph_atlas_invariant_range(offsetof(Bench_Node, value), 8, 0, 1000, "value");
+    Seraph_Atlas_Invariant refs =
+        seraph_atlas_invariant_refcount(offsetof(Bench_Blob, refcount), 1, false, "refs");
+    return seraph_atlas_checkpoint_add_invariant(bench_node_type, &acyclic) &&
+           seraph_atlas_checkpoint_add_invariant(bench_node_type, &range) &&
+           seraph_atlas_checkpoint_add_invariant(bench_blob_type, &refs);
+}
+
+/* One node in eight is followed by a blob */
+static void bench_run(const char* path, uint32_t objects, uint32_t list_len,
+                      uint32_t threads) {
+    uint32_t node_count = objects - objects / 9;
+    uint32_t blob_count = objects - node_count;
+    size_t size = (size_t)objects * (sizeof(Seraph_Atlas_Checkpoint_Entry) + 32) +
+                  16u * 1024 * 1024;
+
+    remove(path);
+    Seraph_Atlas atlas;
+    if (!seraph_vbit_is_true(seraph_atlas_init(&atlas, path, size))) {
+        fprintf(stderr, "bench_atlas_validate: cannot create Atlas at '%s'\n", path);
+        return;
+    }
+    seraph_atlas_set_validate_threads(&atlas, threads);
+
+    Bench_Node* nodes = (Bench_Node*)seraph_atlas_calloc(&atlas, node_count * sizeof(Bench_Node));
+    Bench_Blob* blobs = (Bench_Blob*)seraph_atlas_calloc(&atlas, blob_count * sizeof(Bench_Blob));
+    Seraph_Atlas_Checkpoint* ckpt =
+        seraph_atlas_checkpoint_create(&atlas, "bench", objects, 0);
+    if (nodes == NULL || blobs == NULL || ckpt == NULL) {
+        fprintf(stderr, "bench_atlas_validate: Atlas too small for %u objects\n", objects);
+        seraph_atlas_destroy(&atlas);
+        remove(path);
+        return;
+    }
+
+    for (uint32_t i = 0; i < node_count; i++) {
+        bool tail = (i + 1) % list_len == 0 || i + 1 == node_count;
+        nodes[i].next = tail ? NULL : &nodes[i + 1];
+        nodes[i].value = i % 1000;
+    }
+    uint32_t b = 0;
+    for (uint32_t i = 0; i < node_count; i++) {
+        seraph_atlas_checkpoint_add_entry(&atlas, ckpt, &nodes[i], bench_node_type, 0, 0);
+        if (i % 8 == 7 && b < blob_count) {
+            blobs[b].refcount = 1;
+            seraph_atlas_checkpoint_add_entry(&atlas, ckpt, &blobs[b++], bench_blob_type, 0, 0);
+        }
+    }
+
+    Seraph_Atlas_Validation_Report report;
+    uint64_t start = bench_now_ns();
+    seraph_atlas_checkpoint_validate(&atlas, ckpt, &report);
+    uint64_t validate_ns = bench_now_ns() - start;
+
+    /* Damage one object in a thousand, then let recovery repair it */
+    for (uint32_t i = 500; i < node_count; i += 1000) {
+        nodes[i].value = -1;
+    }
+    start = bench_now_ns();
+    seraph_atlas_checkpoint_recover(&atlas, ckpt, &report);
+    uint64_t recover_ns = bench_now_ns() - start;
+
+    printf("%10u %7u %12.2f %10.1f %12.2f %10.1f %9u\n", ckpt->entry_count, threads,
+           (double)validate_ns / 1e6, (double)validate_ns / ckpt->entry_count,
+           (double)recover_ns / 1e6, (double)recover_ns / ckpt->entry_count,
+           report.recoveries_succeeded);
+
+    seraph_atlas_destroy(&atlas);
+    remove(path);
+}
+
+int main(int argc, char** argv) {
+    uint32_t max_objects = argc > 1 ? (uint32_t)strtoul(argv[1], NULL, 10) : 1000000;
+    uint32_t list_len = argc > 2 ? (uint32_t)strtoul(argv[2], NULL, 10) : 10000;
+    const char* path = argc > 3 ? argv[3] : "bench_atlas_validate.dat";
+    if (max_objects < 1000) {
+        max_objects = 1000;
+    }
+    if (list_len == 0) {
+        list_len = 10000;
+    }
+
+    if (!bench_register_types()) {
+        fprintf(stderr, "bench_atlas_validate: cannot register types\n");
+        return 1;
+    }
+
+    static const uint32_t thread_counts[] = { 1, 2, 4, 8 };
+
+    printf("Atlas checkpoint validation (lists of %u nodes)\n", list_len);
+    printf("%10s %7s %12s %10s %12s %10s %9s\n", "objects", "threads", "validate ms",
+           "ns/object", "recover ms", "ns/object", "repaired");
+    for (uint32_t objects = 1000; objects <= max_objects; objects *= 10) {
+        for (size_t t = 0; t < sizeof(thread_counts) / sizeof(thread_counts[0]); t++) {
+            bench_run(path, objects, list_len, thread_counts[t]);
+        }
+    }
+    return 0;
+}
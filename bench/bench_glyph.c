@@ -0,0 +1,112 @@
+/**
+ * @file bench_glyph.c
+ * @brief Glyph rendering: analytic SDF per pixel against the distance cache
+ *
+ * Renders one composed icon (rounded box minus a ring, plus a dot and a
+ * stroke) as a coverage mask at several pixel sizes, either by running the
+ * shape program and seraph_glyph_coverage at every pixel or by rasterizing
+ * its baked texture. Also times the bake itself (a cache miss) and reports
+ * how far cached coverage strays from the analytic one.
+ *
+ * Usage: bench_glyph [repeats]
+ */
+
+#include "seraph/glyph.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static uint64_t bench_now_ns(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static const Seraph_SDF_Node* bench_shape(uint32_t* count) {
+    static Seraph_SDF_Node nodes[7];
+    nodes[0] = (Seraph_SDF_Node){ SERAPH_SDF_OP_ROUNDED_BOX, {
+        seraph_q128_from_i64(6), seraph_q128_from_i64(4), seraph_q128_from_i64(1) } };
+    nodes[1] = (Seraph_SDF_Node){ SERAPH_SDF_OP_RING, {
+        seraph_q128_from_i64(2), SERAPH_Q128_ZERO, seraph_q128_from_i64(2), SERAPH_Q128_ONE } };
+    nodes[2] = (Seraph_SDF_Node){ SERAPH_SDF_OP_SUBTRACT, { SERAPH_Q128_ZERO } };
+    nodes[3] = (Seraph_SDF_Node){ SERAPH_SDF_OP_CIRCLE, {
+        seraph_q128_from_i64(-6), seraph_q128_from_i64(6), SERAPH_Q128_ONE } };
+    nodes[4] = (Seraph_SDF_Node){ SERAPH_SDF_OP_UNION, { SERAPH_Q128_ZERO } };
+    nodes[5] = (Seraph_SDF_Node){ SERAPH_SDF_OP_LINE, {
+        seraph_q128_from_i64(-7), seraph_q128_from_i64(-7), seraph_q128_from_i64(7),
+        seraph_q128_from_i64(-6), SERAPH_Q128_ONE } };
+    nodes[6] = (Seraph_SDF_Node){ SERAPH_SDF_OP_UNION, { SERAPH_Q128_ZERO } };
+    *count = 7;
+    return nodes;
+}
+
+/* The frame is [-8, 8)^2 */
+static void bench_analytic(const Seraph_SDF_Node* nodes, uint32_t count, uint8_t* out, uint32_t n) {
+    double px_size = 16.0 / n;
+    for (uint32_t y = 0; y < n; y++) {
+        for (uint32_t x = 0; x < n; x++) {
+            Seraph_Glyph_Point p = seraph_glyph_point_create(
+                seraph_q128_from_double(-8.0 + (x + 0.5) * px_size),
+                seraph_q128_from_double(-8.0 + (y + 0.5) * px_size));
+            double a = seraph_glyph_alpha(seraph_sdf_shape_eval(nodes, count, p), px_size);
+            out[y * n + x] = (uint8_t)(a * 255.0 + 0.5);
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    size_t repeats = argc > 1 ? (size_t)strtoul(argv[1], NULL, 10) : 20;
+    if (repeats == 0) repeats = 20;
+
+    uint32_t count;
+    const Seraph_SDF_Node* nodes = bench_shape(&count);
+    Seraph_Q128 lo = seraph_q128_from_i64(-8), size = seraph_q128_from_i64(16);
+    static Seraph_Glyph_Cache cache;
+    static uint8_t analytic[128 * 128], cached[128 * 128];
+
+    /* Bake cost: every lookup of a fresh frame misses */
+    seraph_glyph_cache_init(&cache);
+    uint64_t start = bench_now_ns();
+    for (size_t r = 0; r < repeats; r++) {
+        Seraph_Q128 shifted = seraph_q128_add(lo, seraph_q128_from_i64((int64_t)r + 1));
+        seraph_glyph_cache_lookup(&cache, nodes, count, shifted, lo, size);
+    }
+    double bake_us = (double)(bench_now_ns() - start) / (double)repeats / 1e3;
+
+    printf("Glyph coverage mask, %u-node shape, %dx%d texture (bake %.1f us), us/glyph\n",
+           count, SERAPH_GLYPH_CACHE_RES, SERAPH_GLYPH_CACHE_RES, bake_us);
+    printf("%8s %12s %12s %9s %9s %10s\n", "pixels", "analytic", "cached", "speedup",
+           "max diff", "diff > 16");
+
+    seraph_glyph_cache_lookup(&cache, nodes, count, lo, lo, size);
+    static const uint32_t sizes[] = { 16, 32, 64, 128 };
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        uint32_t n = sizes[s];
+
+        start = bench_now_ns();
+        for (size_t r = 0; r < repeats; r++) {
+            bench_analytic(nodes, count, analytic, n);
+        }
+        double t_analytic = (double)(bench_now_ns() - start) / (double)repeats / 1e3;
+
+        /* Steady state: the lookup hits and only the rasterizer runs */
+        start = bench_now_ns();
+        for (size_t r = 0; r < repeats; r++) {
+            const Seraph_Glyph_Cache_Entry* e =
+                seraph_glyph_cache_lookup(&cache, nodes, count, lo, lo, size);
+            seraph_glyph_cache_rasterize(e, cached, n, n);
+        }
+        double t_cached = (double)(bench_now_ns() - start) / (double)repeats / 1e3;
+
+        int worst = 0, off = 0;
+        for (uint32_t i = 0; i < n * n; i++) {
+            int d = abs((int)analytic[i] - (int)cached[i]);
+            if (d > worst) worst = d;
+            if (d > 16) off++;
+        }
+        printf("%5ux%-3u %12.2f %12.2f %8.1fx %9d %9.2f%%\n", n, n, t_analytic, t_cached,
+               t_analytic / t_cached, worst, 100.0 * off / (n * n));
+    }
+    return 0;
+}
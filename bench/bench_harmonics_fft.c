@@ -0,0 +1,127 @@
+/**
+ * @file bench_harmonics_fft.c
+ * @brief Fixed-point FFT against the bin-by-bin DFT
+ *
+ * The baseline computes a power spectrum the way signal monitoring did,
+ * one seraph_harmonic16_power_at call (O(N)) per bin. The other rows run
+ * the Q16 real-input, complex and batched transforms and the Q32.32
+ * complex transform on the same signal. Reported in µs per spectrum.
+ *
+ * Usage: bench_harmonics_fft [points] [repeats] [channels]
+ */
+
+#include "seraph/harmonics.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static uint64_t bench_now_ns(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+int main(int argc, char** argv) {
+    int n = argc > 1 ? atoi(argv[1]) : 4096;
+    int repeats = argc > 2 ? atoi(argv[2]) : 200;
+    int channels = argc > 3 ? atoi(argv[3]) : 8;
+    if (repeats <= 0) repeats = 200;
+    if (channels <= 0) channels = 8;
+
+    size_t bins = (size_t)n / 2 + 1;
+    Q16* cos_tw = malloc((size_t)n / 2 * sizeof(Q16));
+    Q16* sin_tw = malloc((size_t)n / 2 * sizeof(Q16));
+    int64_t* cos32 = malloc((size_t)n / 2 * sizeof(int64_t));
+    int64_t* sin32 = malloc((size_t)n / 2 * sizeof(int64_t));
+    Q16* x = malloc((size_t)n * channels * sizeof(Q16));
+    Q16* re = malloc((size_t)n * channels * sizeof(Q16));
+    Q16* im = malloc((size_t)n * channels * sizeof(Q16));
+    int64_t* re32 = malloc((size_t)n * sizeof(int64_t));
+    int64_t* im32 = malloc((size_t)n * sizeof(int64_t));
+    int* exps = malloc((size_t)channels * sizeof(int));
+    if (!cos_tw || !sin_tw || !cos32 || !sin32 || !x || !re || !im || !re32 || !im32 || !exps) {
+        fprintf(stderr, "bench_harmonics_fft: out of memory\n");
+        return 1;
+    }
+
+    Seraph_FFT16 fft;
+    Seraph_FFT32 fft32;
+    if (!seraph_fft16_init(&fft, n, cos_tw, sin_tw) ||
+        !seraph_fft32_init(&fft32, n, cos32, sin32) || n < 4) {
+        fprintf(stderr, "bench_harmonics_fft: points must be a power of two >= 4\n");
+        return 1;
+    }
+
+    /* Two tones plus noise, about half scale */
+    uint32_t rng = 0x9E3779B9u;
+    for (size_t i = 0; i < (size_t)n * channels; i++) {
+        int j = (int)(i % (size_t)n);
+        int k1 = (37 * j) % n, k2 = (401 * j) % n;
+        Q16 t1 = k1 < n / 2 ? cos_tw[k1] : -cos_tw[k1 - n / 2];
+        Q16 t2 = k2 < n / 2 ? sin_tw[k2] : -sin_tw[k2 - n / 2];
+        rng ^= rng << 13;
+        rng ^= rng >> 17;
+        rng ^= rng << 5;
+        x[i] = t1 / 4 + t2 / 8 + (Q16)(rng & 0x1FFF) - 0x1000;
+    }
+
+    volatile int64_t sink = 0;
+    uint64_t start = bench_now_ns();
+    int dft_repeats = repeats / 50 > 0 ? repeats / 50 : 1;
+    for (int r = 0; r < dft_repeats; r++) {
+        for (size_t k = 0; k < bins; k++) {
+            sink += seraph_harmonic16_power_at(x, (size_t)n, (int)k);
+        }
+    }
+    double dft_us = (double)(bench_now_ns() - start) / 1000.0 / dft_repeats;
+
+    start = bench_now_ns();
+    for (int r = 0; r < repeats; r++) {
+        int e;
+        seraph_fft16_real(&fft, x, re, im, &e);
+        sink += re[1] + e;
+    }
+    double real_us = (double)(bench_now_ns() - start) / 1000.0 / repeats;
+
+    start = bench_now_ns();
+    for (int r = 0; r < repeats; r++) {
+        int e;
+        memcpy(re, x, (size_t)n * sizeof(Q16));
+        memset(im, 0, (size_t)n * sizeof(Q16));
+        seraph_fft16_forward(&fft, re, im, &e);
+        sink += re[1] + e;
+    }
+    double complex_us = (double)(bench_now_ns() - start) / 1000.0 / repeats;
+
+    start = bench_now_ns();
+    for (int r = 0; r < repeats; r++) {
+        seraph_fft16_real_batch(&fft, x, re, im, (size_t)channels, exps);
+        sink += re[1] + exps[0];
+    }
+    double batch_us = (double)(bench_now_ns() - start) / 1000.0 / repeats / channels;
+
+    start = bench_now_ns();
+    for (int r = 0; r < repeats; r++) {
+        int e;
+        for (int i = 0; i < n; i++) {
+            re32[i] = (int64_t)x[i] << 16;
+            im32[i] = 0;
+        }
+        seraph_fft32_forward(&fft32, re32, im32, &e);
+        sink += re32[1] + e;
+    }
+    double q32_us = (double)(bench_now_ns() - start) / 1000.0 / repeats;
+    (void)sink;
+
+    printf("Power spectrum of %d real samples, us/spectrum\n", n);
+    printf("%-28s %12.2f %10s\n", "power_at per bin (O(N^2))", dft_us, "1.0x");
+    printf("%-28s %12.2f %9.1fx\n", "fft16_real", real_us, dft_us / real_us);
+    printf("%-28s %12.2f %9.1fx\n", "fft16_forward (complex)", complex_us, dft_us / complex_us);
+    printf("%-28s %12.2f %9.1fx\n", "fft16_real_batch/channel", batch_us, dft_us / batch_us);
+    printf("%-28s %12.2f %9.1fx\n", "fft32_forward (complex)", q32_us, dft_us / q32_us);
+
+    free(cos_tw); free(sin_tw); free(cos32); free(sin32); free(x);
+    free(re); free(im); free(re32); free(im32); free(exps);
+    return 0;
+}
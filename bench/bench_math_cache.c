@@ -0,0 +1,126 @@
+/**
+ * @file bench_math_cache.c
+ * @brief Direct-mapped branchless trig cache against the set-associative memo cache
+ *
+ * Replays a stream drawn from a working set of Q16 angles slightly smaller
+ * than the cache, the case where direct-mapped conflicts evict live
+ * entries. Reports ns per sin/cos lookup and the hit rate for the
+ * branchless table, memo caches of 1, 2 and 4 ways at the same capacity,
+ * and the batched seraph_q16_sincos_cached_n path.
+ *
+ * Usage: bench_math_cache [working_set] [lookups]
+ */
+
+#include "seraph/math_cache.h"
+#include "seraph/q16_trig.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static uint64_t bench_now_ns(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static void sincos_cb(int32_t angle, int32_t* s, int32_t* c) {
+    q16_sincos(angle, s, c);
+}
+
+static uint64_t sincos_packed(uint64_t key) {
+    Q16 s, c;
+    q16_sincos((Q16)(uint32_t)key, &s, &c);
+    return ((uint64_t)(uint32_t)s << 32) | (uint32_t)c;
+}
+
+int main(int argc, char** argv) {
+    size_t working = argc > 1 ? (size_t)atoi(argv[1]) : SERAPH_MATH_CACHE_SIZE * 3 / 4;
+    size_t lookups = argc > 2 ? (size_t)atoi(argv[2]) : 4000000;
+    if (working == 0) working = SERAPH_MATH_CACHE_SIZE * 3 / 4;
+    if (lookups == 0) lookups = 4000000;
+
+    Q16* set = malloc(working * sizeof(Q16));
+    Q16* stream = malloc(lookups * sizeof(Q16));
+    Q16* s_out = malloc(lookups * sizeof(Q16));
+    Q16* c_out = malloc(lookups * sizeof(Q16));
+    if (!set || !stream || !s_out || !c_out) {
+        fprintf(stderr, "bench_math_cache: out of memory\n");
+        return 1;
+    }
+
+    uint32_t rng = 0x2545F491u;
+    for (size_t i = 0; i < working; i++) {
+        rng ^= rng << 13; rng ^= rng >> 17; rng ^= rng << 5;
+        set[i] = (Q16)(rng % (uint32_t)(2 * Q16_2PI)) - Q16_2PI;
+    }
+    for (size_t i = 0; i < lookups; i++) {
+        rng ^= rng << 13; rng ^= rng >> 17; rng ^= rng << 5;
+        stream[i] = set[rng % working];
+    }
+
+    volatile int64_t sink = 0;
+    printf("%zu lookups over %zu distinct angles, capacity %d\n",
+           lookups, working, SERAPH_MATH_CACHE_SIZE);
+    printf("%-26s %10s %10s\n", "", "ns/lookup", "hit rate");
+
+    uint64_t start = bench_now_ns();
+    for (size_t i = 0; i < lookups; i++) {
+        Q16 s, c;
+        q16_sincos(stream[i], &s, &c);
+        sink += s + c;
+    }
+    printf("%-26s %10.2f %10s\n", "q16_sincos (uncached)",
+           (double)(bench_now_ns() - start) / (double)lookups, "-");
+
+    Seraph_Q16_Trig_Cache* direct = malloc(sizeof(Seraph_Q16_Trig_Cache));
+    if (!direct) return 1;
+    seraph_q16_trig_cache_init(direct);
+    start = bench_now_ns();
+    for (size_t i = 0; i < lookups; i++) {
+        int32_t s, c;
+        seraph_q16_trig_cache_lookup(direct, stream[i], &s, &c, sincos_cb);
+        sink += s + c;
+    }
+    printf("%-26s %10.2f %9.1f%%\n", "branchless direct-mapped",
+           (double)(bench_now_ns() - start) / (double)lookups,
+           100.0 * seraph_q16_cache_hit_rate(direct));
+    free(direct);
+
+    Seraph_Arena arena;
+    if (seraph_arena_create(&arena, 1 << 20, 0, SERAPH_ARENA_FLAG_NONE) != SERAPH_VBIT_TRUE) {
+        fprintf(stderr, "bench_math_cache: arena creation failed\n");
+        return 1;
+    }
+    const uint32_t ways[] = { 1, 2, 4 };
+    for (size_t w = 0; w < sizeof(ways) / sizeof(ways[0]); w++) {
+        Seraph_Memo_Cache* memo = seraph_memo_cache_create(&arena, SERAPH_MATH_CACHE_SIZE,
+                                                           ways[w], SERAPH_MEMO_TAG_USER);
+        if (!memo) return 1;
+        start = bench_now_ns();
+        for (size_t i = 0; i < lookups; i++) {
+            sink += (int64_t)seraph_memo_cache_lookup(memo, (uint32_t)stream[i], sincos_packed);
+        }
+        double ns = (double)(bench_now_ns() - start) / (double)lookups;
+        Seraph_Memo_Stats stats;
+        seraph_memo_cache_stats(memo, &stats);
+        char name[32];
+        snprintf(name, sizeof(name), "memo %u-way", ways[w]);
+        printf("%-26s %10.2f %9.1f%%\n", name, ns,
+               100.0 * (double)stats.hits / (double)(stats.hits + stats.misses));
+    }
+    seraph_arena_destroy(&arena);
+
+    Seraph_Memo_Cache* tls = seraph_math_memo_get();
+    seraph_memo_cache_clear(tls);
+    seraph_memo_cache_reset_stats(tls);
+    start = bench_now_ns();
+    size_t hits = seraph_q16_sincos_cached_n(stream, s_out, c_out, lookups);
+    printf("%-26s %10.2f %9.1f%%\n", "sincos_cached_n (4x size)",
+           (double)(bench_now_ns() - start) / (double)lookups,
+           100.0 * (double)hits / (double)lookups);
+    sink += s_out[lookups - 1];
+    (void)sink;
+
+    free(set); free(stream); free(s_out); free(c_out);
+    return 0;
+}
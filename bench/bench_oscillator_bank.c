@@ -0,0 +1,104 @@
+/**
+ * @file bench_oscillator_bank.c
+ * @brief SoA oscillator bank against stepping Seraph_Oscillator16 one at a time
+ *
+ * The baseline mixes an array of Seraph_Oscillator16 sample by sample, as
+ * the synthesized-signal rigs did. The bank rows mix the same oscillators
+ * with the scalar and AVX2 kernels. The last rows rotate a point buffer
+ * with seraph_rotation16_apply_batch. Reported in ns per oscillator-sample
+ * (per point for the rotation rows).
+ *
+ * Usage: bench_oscillator_bank [oscillators] [frames]
+ */
+
+#include "seraph/rotation.h"
+#include "seraph/vbit.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static uint64_t bench_now_ns(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+int main(int argc, char** argv) {
+    size_t count = argc > 1 ? (size_t)atoi(argv[1]) : 4096;
+    size_t frames = argc > 2 ? (size_t)atoi(argv[2]) : 4800;
+    if (count == 0) count = 4096;
+    if (frames == 0) frames = 4800;
+
+    const uint32_t rate = 48000;
+    uint32_t* freqs = malloc(count * sizeof(uint32_t));
+    Seraph_Oscillator16* oscs = malloc(count * sizeof(Seraph_Oscillator16));
+    Q16* storage = malloc(SERAPH_OSC_BANK_STORAGE(count) * sizeof(Q16));
+    Q16* out = malloc(frames * sizeof(Q16));
+    Q16* points = malloc(2 * count * sizeof(Q16));
+    if (!freqs || !oscs || !storage || !out || !points) {
+        fprintf(stderr, "bench_oscillator_bank: out of memory\n");
+        return 1;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        freqs[i] = 20 + (uint32_t)(i * 7919) % 20000;
+        seraph_oscillator16_init(&oscs[i], freqs[i], rate, Q16_ONE / 64);
+        points[2 * i] = (Q16)(i * 131) & 0xFFFF;
+        points[2 * i + 1] = (Q16)(i * 257) & 0xFFFF;
+    }
+
+    volatile int64_t sink = 0;
+    uint64_t start = bench_now_ns();
+    for (size_t f = 0; f < frames; f++) {
+        int64_t sum = 0;
+        for (size_t i = 0; i < count; i++) {
+            sum += seraph_oscillator16_sample(&oscs[i]);
+        }
+        out[f] = (Q16)sum;
+    }
+    sink += out[frames - 1];
+    double base_ns = (double)(bench_now_ns() - start) / (double)(frames * count);
+
+    printf("Mixing %zu oscillators for %zu frames, ns/oscillator-sample\n", count, frames);
+    printf("%-28s %10.3f %9s\n", "Oscillator16 array", base_ns, "1.0x");
+
+    const struct { Seraph_Vbit_Impl impl; const char* name; } impls[] = {
+        { SERAPH_VBIT_IMPL_SCALAR, "bank16_mix scalar" },
+        { SERAPH_VBIT_IMPL_AVX2,   "bank16_mix avx2" },
+    };
+    for (size_t k = 0; k < sizeof(impls) / sizeof(impls[0]); k++) {
+        if (!seraph_vbit_set_impl(impls[k].impl)) continue;
+        Seraph_Oscillator_Bank16 bank;
+        seraph_oscillator_bank16_init(&bank, storage, count, freqs, rate, Q16_ONE / 64);
+        start = bench_now_ns();
+        seraph_oscillator_bank16_mix(&bank, out, frames);
+        double ns = (double)(bench_now_ns() - start) / (double)(frames * count);
+        sink += out[frames - 1];
+        printf("%-28s %10.3f %8.1fx\n", impls[k].name, ns, base_ns / ns);
+    }
+
+    const struct { Seraph_Vbit_Impl impl; const char* name; } rot_impls[] = {
+        { SERAPH_VBIT_IMPL_SCALAR, "apply_batch scalar" },
+        { SERAPH_VBIT_IMPL_AVX2,   "apply_batch avx2" },
+    };
+    Seraph_Rotation16 rot;
+    seraph_rotation16_init(&rot, Q16_PI / 1000, 0);
+    double rot_base = 0;
+    printf("\nRotating %zu points, ns/point\n", count);
+    for (size_t k = 0; k < sizeof(rot_impls) / sizeof(rot_impls[0]); k++) {
+        if (!seraph_vbit_set_impl(rot_impls[k].impl)) continue;
+        start = bench_now_ns();
+        for (size_t r = 0; r < 1000; r++) {
+            seraph_rotation16_apply_batch(&rot, points, count);
+        }
+        double ns = (double)(bench_now_ns() - start) / (double)(1000 * count);
+        if (rot_base == 0) rot_base = ns;
+        sink += points[0];
+        printf("%-28s %10.3f %8.1fx\n", rot_impls[k].name, ns, rot_base / ns);
+    }
+    seraph_vbit_set_impl(SERAPH_VBIT_IMPL_AUTO);
+    (void)sink;
+
+    free(freqs); free(oscs); free(storage); free(out); free(points);
+    return 0;
+}
@@ -0,0 +1,108 @@
+/**
+ * @file bench_q128.c
+ * @brief Q128 multiply and divide latency
+ *
+ * Times seraph_q128_mul under each multiply kernel this CPU supports, and
+ * seraph_q128_div against the reciprocal-estimate division it replaced
+ * (a double seed refined by four Newton steps, rebuilt here from the
+ * public API). Operands are random signed values of mixed magnitude.
+ *
+ * Usage: bench_q128 [operands] [repeats]
+ */
+
+#include "seraph/q128.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static uint64_t bench_now_ns(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+/* The former seraph_q128_div: 1/b from a double, refined with Newton */
+static Seraph_Q128 bench_div_newton(Seraph_Q128 a, Seraph_Q128 b) {
+    if (seraph_q128_is_void(a) || seraph_q128_is_void(b) || seraph_q128_is_zero(b)) {
+        return SERAPH_Q128_VOID;
+    }
+    bool negative = seraph_q128_is_negative(a) != seraph_q128_is_negative(b);
+    Seraph_Q128 abs_b = seraph_q128_abs(b);
+
+    Seraph_Q128 x = seraph_q128_from_double(1.0 / seraph_q128_to_double(abs_b));
+    Seraph_Q128 two = seraph_q128_from_i64(2);
+    for (int i = 0; i < 4; i++) {
+        x = seraph_q128_mul(x, seraph_q128_sub(two, seraph_q128_mul(abs_b, x)));
+    }
+
+    Seraph_Q128 result = seraph_q128_mul(seraph_q128_abs(a), x);
+    return negative ? seraph_q128_neg(result) : result;
+}
+
+typedef Seraph_Q128 (*Bench_Op)(Seraph_Q128, Seraph_Q128);
+
+static double bench_run(Bench_Op op, const Seraph_Q128* a, const Seraph_Q128* b,
+                        size_t n, size_t repeats) {
+    volatile uint64_t sink = 0;
+    uint64_t start = bench_now_ns();
+    for (size_t r = 0; r < repeats; r++) {
+        for (size_t i = 0; i < n; i++) {
+            sink += op(a[i], b[i]).lo;
+        }
+    }
+    uint64_t ns = bench_now_ns() - start;
+    (void)sink;
+    return (double)ns / (double)(n * repeats);
+}
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? (size_t)strtoul(argv[1], NULL, 10) : 4096;
+    size_t repeats = argc > 2 ? (size_t)strtoul(argv[2], NULL, 10) : 500;
+    if (n == 0) n = 4096;
+    if (repeats == 0) repeats = 500;
+
+    Seraph_Q128* a = malloc(n * sizeof(Seraph_Q128));
+    Seraph_Q128* b = malloc(n * sizeof(Seraph_Q128));
+    if (!a || !b) {
+        fprintf(stderr, "bench_q128: out of memory\n");
+        return 1;
+    }
+
+    /* |a| below 2^40 and |b| at least 2^-20, so every quotient fits */
+    uint64_t rng = 0x9E3779B97F4A7C15ull;
+    for (size_t i = 0; i < n; i++) {
+        rng ^= rng << 13;
+        rng ^= rng >> 7;
+        rng ^= rng << 17;
+        a[i] = (Seraph_Q128){ (int64_t)(rng >> (24 + rng % 24)), rng * 0x2545F4914F6CDD1Dull };
+        b[i] = (Seraph_Q128){ (int64_t)(rng >> (40 + rng % 20)), rng ^ (rng >> 29) };
+        if (b[i].hi == 0 && b[i].lo < (1ull << 44)) b[i].lo |= 1ull << 44;
+        if (rng & 0x100) a[i] = seraph_q128_neg(a[i]);
+        if (rng & 0x200) b[i] = seraph_q128_neg(b[i]);
+    }
+
+    static const Seraph_Q128_Impl impls[] = { SERAPH_Q128_IMPL_PORTABLE, SERAPH_Q128_IMPL_BMI2 };
+
+    seraph_q128_set_impl(SERAPH_Q128_IMPL_AUTO);
+    printf("Q128 arithmetic (%zu operands x %zu, auto selects %s), ns/op\n",
+           n, repeats, seraph_q128_impl_name(seraph_q128_get_impl()));
+
+    for (size_t v = 0; v < sizeof(impls) / sizeof(impls[0]); v++) {
+        printf("%-16s %-14s", "seraph_q128_mul", seraph_q128_impl_name(impls[v]));
+        if (!seraph_q128_set_impl(impls[v])) {
+            printf(" %8s\n", "-");
+            continue;
+        }
+        printf(" %8.2f\n", bench_run(seraph_q128_mul, a, b, n, repeats));
+    }
+
+    seraph_q128_set_impl(SERAPH_Q128_IMPL_AUTO);
+    printf("%-16s %-14s %8.2f\n", "seraph_q128_div", "integer",
+           bench_run(seraph_q128_div, a, b, n, repeats));
+    printf("%-16s %-14s %8.2f\n", "baseline div", "double+newton",
+           bench_run(bench_div_newton, a, b, n, repeats));
+
+    free(a);
+    free(b);
+    return 0;
+}
@@ -0,0 +1,176 @@
+/**
+ * @file bench_q128_batch.c
+ * @brief Q128 and Galactic SoA batch kernels against the scalar loop
+ *
+ * The scalar column calls the per-value function over an array of
+ * structures; the other columns run the *_n kernel over the same data in
+ * lanes with each VBIT variant this CPU supports (the batch kernels take
+ * their vector width from it). Reported in ns per element.
+ *
+ * Usage: bench_q128_batch [elements] [repeats]
+ */
+
+#include "seraph/galactic.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static uint64_t bench_now_ns(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+typedef struct {
+    size_t                n;
+    Seraph_Q128*          qa;
+    Seraph_Q128*          qb;
+    Seraph_Q128*          qdst;
+    Seraph_Galactic*      ga;
+    Seraph_Galactic*      gb;
+    Seraph_Galactic*      gdst;
+    Seraph_Q128_Lanes     la;
+    Seraph_Q128_Lanes     lb;
+    Seraph_Q128_Lanes     ldst;
+    Seraph_Galactic_Lanes gla;
+    Seraph_Galactic_Lanes glb;
+    Seraph_Galactic_Lanes gldst;
+} Bench_Data;
+
+typedef enum {
+    BENCH_Q128_ADD, BENCH_Q128_SUB, BENCH_Q128_MUL, BENCH_Q128_LT,
+    BENCH_GALACTIC_ADD, BENCH_GALACTIC_MUL, BENCH_KERNELS
+} Bench_Kernel;
+
+static const char* const bench_names[BENCH_KERNELS] = {
+    "q128 add", "q128 sub", "q128 mul", "q128 lt", "galactic add", "galactic mul"
+};
+
+static void bench_scalar(Bench_Kernel k, Bench_Data* d, Seraph_Vbit* flags) {
+    for (size_t i = 0; i < d->n; i++) {
+        switch (k) {
+            case BENCH_Q128_ADD:     d->qdst[i] = seraph_q128_add(d->qa[i], d->qb[i]); break;
+            case BENCH_Q128_SUB:     d->qdst[i] = seraph_q128_sub(d->qa[i], d->qb[i]); break;
+            case BENCH_Q128_MUL:     d->qdst[i] = seraph_q128_mul(d->qa[i], d->qb[i]); break;
+            case BENCH_Q128_LT:      flags[i] = seraph_q128_lt(d->qa[i], d->qb[i]); break;
+            case BENCH_GALACTIC_ADD: d->gdst[i] = seraph_galactic_add(d->ga[i], d->gb[i]); break;
+            case BENCH_GALACTIC_MUL: d->gdst[i] = seraph_galactic_mul(d->ga[i], d->gb[i]); break;
+            default: break;
+        }
+    }
+}
+
+static void bench_batch(Bench_Kernel k, Bench_Data* d, Seraph_Vbit* flags) {
+    switch (k) {
+        case BENCH_Q128_ADD:     seraph_q128_add_n(d->ldst, d->la, d->lb, d->n); break;
+        case BENCH_Q128_SUB:     seraph_q128_sub_n(d->ldst, d->la, d->lb, d->n); break;
+        case BENCH_Q128_MUL:     seraph_q128_mul_n(d->ldst, d->la, d->lb, d->n); break;
+        case BENCH_Q128_LT:      seraph_q128_lt_n(d->la, d->lb, flags, d->n); break;
+        case BENCH_GALACTIC_ADD: seraph_galactic_add_n(d->gldst, d->gla, d->glb, d->n); break;
+        case BENCH_GALACTIC_MUL: seraph_galactic_mul_n(d->gldst, d->gla, d->glb, d->n); break;
+        default: break;
+    }
+}
+
+static double bench_run(Bench_Kernel k, Bench_Data* d, Seraph_Vbit* flags,
+                        size_t repeats, bool batch) {
+    uint64_t start = bench_now_ns();
+    for (size_t r = 0; r < repeats; r++) {
+        if (batch) {
+            bench_batch(k, d, flags);
+        } else {
+            bench_scalar(k, d, flags);
+        }
+    }
+    uint64_t ns = bench_now_ns() - start;
+    return (double)ns / (double)(d->n * repeats);
+}
+
+static Seraph_Q128_Lanes bench_lanes(size_t n) {
+    return (Seraph_Q128_Lanes){ malloc(n * sizeof(int64_t)), malloc(n * sizeof(uint64_t)) };
+}
+
+static void bench_free_lanes(Seraph_Q128_Lanes x) {
+    free(x.hi);
+    free(x.lo);
+}
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? (size_t)strtoul(argv[1], NULL, 10) : 1000000;
+    size_t repeats = argc > 2 ? (size_t)strtoul(argv[2], NULL, 10) : 10;
+    if (n == 0) n = 1000000;
+    if (repeats == 0) repeats = 10;
+
+    Bench_Data d = {
+        .n = n,
+        .qa = malloc(n * sizeof(Seraph_Q128)), .qb = malloc(n * sizeof(Seraph_Q128)),
+        .qdst = malloc(n * sizeof(Seraph_Q128)),
+        .ga = malloc(n * sizeof(Seraph_Galactic)), .gb = malloc(n * sizeof(Seraph_Galactic)),
+        .gdst = malloc(n * sizeof(Seraph_Galactic)),
+        .la = bench_lanes(n), .lb = bench_lanes(n), .ldst = bench_lanes(n),
+        .gla = { bench_lanes(n), bench_lanes(n) },
+        .glb = { bench_lanes(n), bench_lanes(n) },
+        .gldst = { bench_lanes(n), bench_lanes(n) },
+    };
+    Seraph_Vbit* flags = malloc(n);
+    if (!d.qa || !d.qb || !d.qdst || !d.ga || !d.gb || !d.gdst || !flags ||
+        !d.la.lo || !d.lb.lo || !d.ldst.lo || !d.gla.tangent.lo || !d.glb.tangent.lo ||
+        !d.gldst.tangent.lo) {
+        fprintf(stderr, "bench_q128_batch: out of memory\n");
+        return 1;
+    }
+
+    /* Magnitudes below 2^30 keep products and sums in range */
+    uint64_t rng = 0x9E3779B97F4A7C15ull;
+    for (size_t i = 0; i < n; i++) {
+        Seraph_Q128 v[4];
+        for (int j = 0; j < 4; j++) {
+            rng ^= rng << 13;
+            rng ^= rng >> 7;
+            rng ^= rng << 17;
+            v[j] = (Seraph_Q128){ (int64_t)(rng >> 34), rng * 0x2545F4914F6CDD1Dull };
+            if (rng & 0x100) v[j] = seraph_q128_neg(v[j]);
+        }
+        d.qa[i] = v[0];
+        d.qb[i] = v[1];
+        d.ga[i] = seraph_galactic_create(v[0], v[2]);
+        d.gb[i] = seraph_galactic_create(v[1], v[3]);
+    }
+    seraph_q128_lanes_scatter(d.la, d.qa, n);
+    seraph_q128_lanes_scatter(d.lb, d.qb, n);
+    seraph_galactic_lanes_scatter(d.gla, d.ga, n);
+    seraph_galactic_lanes_scatter(d.glb, d.gb, n);
+
+    static const Seraph_Vbit_Impl impls[] = { SERAPH_VBIT_IMPL_SCALAR, SERAPH_VBIT_IMPL_AVX2 };
+    size_t impl_count = sizeof(impls) / sizeof(impls[0]);
+
+    seraph_q128_set_impl(SERAPH_Q128_IMPL_AUTO);
+    printf("Q128/Galactic batches (%zu elements x %zu, multiply %s), ns/element\n",
+           n, repeats, seraph_q128_impl_name(seraph_q128_get_impl()));
+    printf("%14s %10s", "kernel", "per-call");
+    for (size_t v = 0; v < impl_count; v++) {
+        printf("   _n %-5s", seraph_vbit_impl_name(impls[v]));
+    }
+    printf("\n");
+
+    for (int k = 0; k < BENCH_KERNELS; k++) {
+        seraph_vbit_set_impl(SERAPH_VBIT_IMPL_AUTO);
+        printf("%14s %10.2f", bench_names[k], bench_run((Bench_Kernel)k, &d, flags, repeats, false));
+        for (size_t v = 0; v < impl_count; v++) {
+            if (!seraph_vbit_set_impl(impls[v])) {
+                printf(" %10s", "-");
+                continue;
+            }
+            printf(" %10.2f", bench_run((Bench_Kernel)k, &d, flags, repeats, true));
+        }
+        printf("\n");
+    }
+
+    seraph_vbit_set_impl(SERAPH_VBIT_IMPL_AUTO);
+    free(d.qa); free(d.qb); free(d.qdst); free(d.ga); free(d.gb); free(d.gdst); free(flags);
+    bench_free_lanes(d.la); bench_free_lanes(d.lb); bench_free_lanes(d.ldst);
+    bench_free_lanes(d.gla.primal); bench_free_lanes(d.gla.tangent);
+    bench_free_lanes(d.glb.primal); bench_free_lanes(d.glb.tangent);
+    bench_free_lanes(d.gldst.primal); bench_free_lanes(d.gldst.tangent);
+    return 0;
+}
@@ -0,0 +1,76 @@
+/**
+ * @file bench_q64_sincos.c
+ * @brief Batched Q64 sin/cos against the one-angle-at-a-time path
+ *
+ * The baseline calls q64_sincos per angle. The batch row runs
+ * q64_sincos_n over the same angles, which reduces a group of angles
+ * before evaluating any of them. Angles span [-64, 64) radians so every
+ * octant and both signs are hit. Reported in million angles/second.
+ *
+ * Usage: bench_q64_sincos [angles] [repeats]
+ */
+
+#include "seraph/q64_trig.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static uint64_t bench_now_ns(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+int main(int argc, char** argv) {
+    int n = argc > 1 ? atoi(argv[1]) : 4096;
+    int repeats = argc > 2 ? atoi(argv[2]) : 500;
+    if (n <= 0) n = 4096;
+    if (repeats <= 0) repeats = 500;
+
+    Q64* angles = malloc((size_t)n * sizeof(Q64));
+    Q64* s = malloc((size_t)n * sizeof(Q64));
+    Q64* c = malloc((size_t)n * sizeof(Q64));
+    if (!angles || !s || !c) {
+        fprintf(stderr, "bench_q64_sincos: out of memory\n");
+        return 1;
+    }
+
+    uint64_t rng = 0x9E3779B97F4A7C15ull;
+    for (int i = 0; i < n; i++) {
+        rng ^= rng << 13;
+        rng ^= rng >> 7;
+        rng ^= rng << 17;
+        angles[i].hi = (int64_t)(rng >> 57) - 64;
+        angles[i].lo = rng * 0x2545F4914F6CDD1Dull;
+    }
+    q64_trig_init();
+
+    volatile uint64_t sink = 0;
+    uint64_t start = bench_now_ns();
+    for (int r = 0; r < repeats; r++) {
+        for (int i = 0; i < n; i++) {
+            q64_sincos(angles[i], &s[i], &c[i]);
+        }
+        sink += s[r % n].lo ^ c[0].lo;
+    }
+    double scalar_ns = (double)(bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (int r = 0; r < repeats; r++) {
+        q64_sincos_n(angles, s, c, (size_t)n);
+        sink += s[r % n].lo ^ c[0].lo;
+    }
+    double batch_ns = (double)(bench_now_ns() - start);
+    (void)sink;
+
+    double total = (double)n * repeats;
+    double scalar_rate = total / scalar_ns * 1000.0;
+    double batch_rate = total / batch_ns * 1000.0;
+
+    printf("Q64 sin+cos of %d angles, M angles/s\n", n);
+    printf("%-24s %12.2f %10s\n", "q64_sincos per angle", scalar_rate, "1.0x");
+    printf("%-24s %12.2f %9.2fx\n", "q64_sincos_n", batch_rate, batch_rate / scalar_rate);
+
+    free(angles); free(s); free(c);
+    return 0;
+}
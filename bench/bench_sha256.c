@@ -0,0 +1,102 @@
+/**
+ * @file bench_sha256.c
+ * @brief SHA-256 throughput per block kernel
+ *
+ * Hashes the same data with every variant this CPU supports and reports
+ * MB/s for two shapes of work:
+ *   - single: one message at a time through sha256()
+ *   - multi:  batches of independent messages through sha256_multi(),
+ *             the shape of per-frame HMACs and Merkle levels
+ *
+ * Message sizes cover Merkle pairs (64 B), Aether frames (1 KiB) and
+ * SBF content chunks (64 KiB).
+ *
+ * Usage: bench_sha256 [megabytes-per-run]
+ */
+
+#include "seraph/crypto/sha256.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCH_BATCH 64
+
+static uint64_t bench_now_ns(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static double bench_single(const uint8_t* data, size_t msg_size, size_t total) {
+    uint8_t digest[SHA256_DIGEST_SIZE];
+    size_t count = total / msg_size;
+    uint64_t start = bench_now_ns();
+    for (size_t i = 0; i < count; i++) {
+        sha256(data + (i % BENCH_BATCH) * msg_size, msg_size, digest);
+    }
+    uint64_t ns = bench_now_ns() - start;
+    return (double)(count * msg_size) / ((double)ns / 1e9) / 1e6;
+}
+
+static double bench_multi(const uint8_t* data, size_t msg_size, size_t total) {
+    const void* msgs[BENCH_BATCH];
+    size_t lens[BENCH_BATCH];
+    static uint8_t digests[BENCH_BATCH * SHA256_DIGEST_SIZE];
+    for (size_t i = 0; i < BENCH_BATCH; i++) {
+        msgs[i] = data + i * msg_size;
+        lens[i] = msg_size;
+    }
+
+    size_t rounds = total / (msg_size * BENCH_BATCH);
+    if (rounds == 0) rounds = 1;
+    uint64_t start = bench_now_ns();
+    for (size_t r = 0; r < rounds; r++) {
+        sha256_multi(msgs, lens, BENCH_BATCH, digests);
+    }
+    uint64_t ns = bench_now_ns() - start;
+    return (double)(rounds * BENCH_BATCH * msg_size) / ((double)ns / 1e9) / 1e6;
+}
+
+int main(int argc, char** argv) {
+    size_t megabytes = argc > 1 ? (size_t)strtoul(argv[1], NULL, 10) : 64;
+    if (megabytes == 0) {
+        megabytes = 64;
+    }
+    size_t total = megabytes * 1024 * 1024;
+
+    static const size_t sizes[] = { 64, 1024, 65536 };
+    static const SHA256_Impl impls[] = {
+        SHA256_IMPL_SCALAR, SHA256_IMPL_SHA_NI, SHA256_IMPL_AVX2
+    };
+
+    uint8_t* data = (uint8_t*)malloc(BENCH_BATCH * sizes[2]);
+    if (data == NULL) {
+        fprintf(stderr, "bench_sha256: out of memory\n");
+        return 1;
+    }
+    for (size_t i = 0; i < BENCH_BATCH * sizes[2]; i++) {
+        data[i] = (uint8_t)(i * 131 + (i >> 9));
+    }
+
+    sha256_set_impl(SHA256_IMPL_AUTO);
+    printf("SHA-256 throughput (%zu MB per run, auto selects %s)\n", megabytes,
+           sha256_impl_name(sha256_get_impl()));
+    printf("%8s %9s %14s %14s\n", "variant", "msg size", "single MB/s", "multi MB/s");
+    for (size_t v = 0; v < sizeof(impls) / sizeof(impls[0]); v++) {
+        if (!sha256_set_impl(impls[v])) {
+            printf("%8s %9s %14s %14s\n", sha256_impl_name(impls[v]), "-",
+                   "unsupported", "unsupported");
+            continue;
+        }
+        for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+            printf("%8s %9zu %14.1f %14.1f\n", sha256_impl_name(impls[v]), sizes[s],
+                   bench_single(data, sizes[s], total),
+                   bench_multi(data, sizes[s], total));
+        }
+    }
+
+    sha256_set_impl(SHA256_IMPL_AUTO);
+    free(data);
+    return 0;
+}
@@ -0,0 +1,168 @@
+/**
+ * @file bench_surface.c
+ * @brief Surface frame time with a full set of orbs
+ *
+ * Renders 64 orbs (plus the locus) at 1080p and 4K with the tiled Q16
+ * rasterizer and with the per-orb float SDF loop it replaced, rebuilt here
+ * from the public API. Also reports the largest per-channel difference
+ * between the two frames, and the cost of damage-tracked frames into the
+ * same buffer: an idle frame, and a frame where one orb moved by a pixel.
+ * Reported in ms per frame.
+ *
+ * Usage: bench_surface [frames]
+ */
+
+#include "seraph/surface.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static uint64_t bench_now_ns(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+/* The former render_circle_sdf: float distance for every pixel of the 4r box */
+static void bench_circle_float(uint32_t* fb, uint32_t w, uint32_t h, float cx, float cy,
+                               float radius, Seraph_Color fill, Seraph_Color glow, float amount) {
+    int32_t x0 = (int32_t)(cx - 2.0f * radius), y0 = (int32_t)(cy - 2.0f * radius);
+    int32_t x1 = (int32_t)(cx + 2.0f * radius), y1 = (int32_t)(cy + 2.0f * radius);
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 >= (int32_t)w) x1 = (int32_t)w - 1;
+    if (y1 >= (int32_t)h) y1 = (int32_t)h - 1;
+
+    for (int32_t y = y0; y <= y1; y++) {
+        for (int32_t x = x0; x <= x1; x++) {
+            float dx = (float)x + 0.5f - cx, dy = (float)y + 0.5f - cy;
+            float dist = sqrtf(dx * dx + dy * dy) - radius;
+            uint32_t* p = &fb[y * w + x];
+            Seraph_Color bg = { (*p >> 24) & 0xFF, (*p >> 16) & 0xFF, (*p >> 8) & 0xFF, 255 };
+            if (dist < 0.0f) {
+                *p = seraph_color_to_u32(fill);
+            } else if (dist < 1.5f) {
+                float t = dist / 1.5f;
+                *p = seraph_color_to_u32(seraph_color_lerp(bg, fill, 1.0f - t * t * (3.0f - 2.0f * t)));
+            } else if (amount > 0.0f && dist < radius) {
+                float fade = (1.0f - dist / radius) * (1.0f - dist / radius) * amount;
+                if (fade > 0.01f) {
+                    *p = seraph_color_to_u32(seraph_color_lerp(bg, glow, fade));
+                }
+            }
+        }
+    }
+}
+
+static void bench_render_float(Seraph_Surface* s, uint32_t* fb, uint32_t w, uint32_t h) {
+    uint32_t bg = seraph_color_to_u32(SERAPH_THEME_BACKGROUND);
+    for (size_t i = 0; i < (size_t)w * h; i++) {
+        fb[i] = bg;
+    }
+    bench_circle_float(fb, w, h, (float)seraph_q128_to_double(s->locus.position_x.primal),
+                       (float)seraph_q128_to_double(s->locus.position_y.primal), 5.0f,
+                       SERAPH_THEME_LOCUS, SERAPH_THEME_GLOW, 0.3f);
+    for (int i = 0; i < SERAPH_SURFACE_MAX_ORBS; i++) {
+        Seraph_Orb* orb = &s->orbs[i];
+        if (orb->state == SERAPH_ORB_VOID) continue;
+        float brightness = (float)seraph_q128_to_double(orb->brightness.primal);
+        Seraph_Color fill = seraph_vbit_is_true(orb->focused) ? SERAPH_THEME_ORB_HOVER
+                                                               : orb->color_base;
+        fill.r = (uint8_t)(fill.r * brightness);
+        fill.g = (uint8_t)(fill.g * brightness);
+        fill.b = (uint8_t)(fill.b * brightness);
+        bench_circle_float(fb, w, h, (float)seraph_q128_to_double(orb->position_x.primal),
+                           (float)seraph_q128_to_double(orb->position_y.primal),
+                           (float)seraph_q128_to_double(orb->radius.primal), fill,
+                           orb->color_glow, orb->notifications > 0 ? 0.5f : 0.0f);
+    }
+}
+
+typedef enum { BENCH_FULL, BENCH_FLOAT, BENCH_IDLE, BENCH_ONE_ORB } Bench_Frame;
+
+static double bench_frames(Seraph_Surface* s, uint32_t* fb, uint32_t w, uint32_t h,
+                           size_t frames, Bench_Frame kind) {
+    Seraph_Galactic* moving = &s->orbs[0].position_x;
+    seraph_surface_render(s, fb, w, h);
+    uint64_t start = bench_now_ns();
+    for (size_t f = 0; f < frames; f++) {
+        switch (kind) {
+            case BENCH_FULL:
+                seraph_surface_invalidate(s);
+                seraph_surface_render(s, fb, w, h);
+                break;
+            case BENCH_FLOAT:
+                bench_render_float(s, fb, w, h);
+                break;
+            case BENCH_IDLE:
+                seraph_surface_render(s, fb, w, h);
+                break;
+            case BENCH_ONE_ORB:
+                moving->primal = seraph_q128_add(moving->primal,
+                                                 seraph_q128_from_i64((f & 1) ? -1 : 1));
+                seraph_surface_render(s, fb, w, h);
+                break;
+        }
+    }
+    return (double)(bench_now_ns() - start) / (double)frames / 1e6;
+}
+
+static int bench_max_diff(const uint32_t* a, const uint32_t* b, size_t n) {
+    int worst = 0;
+    for (size_t i = 0; i < n; i++) {
+        for (int shift = 8; shift < 32; shift += 8) {
+            int d = abs((int)((a[i] >> shift) & 0xFF) - (int)((b[i] >> shift) & 0xFF));
+            if (d > worst) worst = d;
+        }
+    }
+    return worst;
+}
+
+int main(int argc, char** argv) {
+    size_t frames = argc > 1 ? (size_t)strtoul(argv[1], NULL, 10) : 20;
+    if (frames == 0) frames = 20;
+
+    static const uint32_t sizes[][2] = { { 1920, 1080 }, { 3840, 2160 } };
+    static char caps[SERAPH_SURFACE_MAX_ORBS][32];
+
+    printf("Surface render, %d orbs (%zu frames), ms/frame\n", SERAPH_SURFACE_MAX_ORBS, frames);
+    printf("%12s %10s %10s %8s %9s %10s %10s\n", "frame", "tiled q16", "float", "speedup",
+           "max diff", "idle", "one orb");
+
+    for (size_t v = 0; v < sizeof(sizes) / sizeof(sizes[0]); v++) {
+        uint32_t w = sizes[v][0], h = sizes[v][1];
+        Seraph_Surface surface;
+        seraph_surface_init(&surface, w, h);
+
+        /* Rings of orbs around the locus; every third one has a notification glow */
+        for (int i = 0; i < SERAPH_SURFACE_MAX_ORBS; i++) {
+            Seraph_Capability cap = seraph_cap_create(caps[i], sizeof(caps[i]), 1, SERAPH_CAP_RW);
+            float dist = (float)h * (0.12f + 0.09f * (float)(i % 5));
+            int32_t idx = seraph_surface_create_orb(&surface, cap, dist, (float)i * 0.61f);
+            if (idx >= 0 && i % 3 == 0) surface.orbs[idx].notifications = 1;
+        }
+
+        uint32_t* tiled = malloc((size_t)w * h * sizeof(uint32_t));
+        uint32_t* ref = malloc((size_t)w * h * sizeof(uint32_t));
+        if (!tiled || !ref) {
+            fprintf(stderr, "bench_surface: out of memory\n");
+            return 1;
+        }
+
+        double t_tiled = bench_frames(&surface, tiled, w, h, frames, BENCH_FULL);
+        double t_float = bench_frames(&surface, ref, w, h, frames, BENCH_FLOAT);
+        int diff = bench_max_diff(tiled, ref, (size_t)w * h);
+        double t_idle = bench_frames(&surface, tiled, w, h, frames, BENCH_IDLE);
+        double t_one = bench_frames(&surface, tiled, w, h, frames, BENCH_ONE_ORB);
+        char label[16];
+        snprintf(label, sizeof(label), "%ux%u", w, h);
+        printf("%12s %10.3f %10.3f %7.2fx %9d %10.4f %10.4f\n", label, t_tiled, t_float,
+               t_float / t_tiled, diff, t_idle, t_one);
+
+        free(tiled);
+        free(ref);
+        seraph_surface_destroy(&surface);
+    }
+    return 0;
+}
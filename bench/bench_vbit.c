@@ -0,0 +1,186 @@
+/**
+ * @file bench_vbit.c
+ * @brief VBIT and semantic byte array kernel throughput
+ *
+ * Runs every array operation with each kernel variant this CPU supports
+ * and reports GB/s of input consumed. The arrays are a random mix of
+ * FALSE/TRUE/VOID (and partially VOID semantic bytes); all_true runs over
+ * an all-TRUE array so it cannot stop early.
+ *
+ * The packed rows are independent of the variant: they run Kleene AND on
+ * the two-bit format, counting input as the byte-per-VBIT arrays they
+ * stand for.
+ *
+ * Usage: bench_vbit [elements] [repeats]
+ */
+
+#include "seraph/vbit.h"
+#include "seraph/semantic_byte.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static uint64_t bench_now_ns(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+typedef struct {
+    size_t               n;
+    Seraph_Vbit*         a;
+    Seraph_Vbit*         b;
+    Seraph_Vbit*         all;
+    Seraph_Vbit*         dst;
+    uint8_t*             bitmap;
+    size_t*              indices;
+    Seraph_Vbit_Packed*  pa;
+    Seraph_Vbit_Packed*  pb;
+    Seraph_Vbit_Packed*  pdst;
+    Seraph_SemanticByte* sa;
+    Seraph_SemanticByte* sb;
+    Seraph_SemanticByte* sdst;
+    uint8_t*             bytes;
+} Bench_Data;
+
+typedef enum {
+    BENCH_NOT, BENCH_AND, BENCH_OR, BENCH_XOR, BENCH_COUNT, BENCH_ALL_TRUE,
+    BENCH_FILTER, BENCH_PACK_BITMAP, BENCH_UNPACK_BITMAP, BENCH_PACK, BENCH_UNPACK,
+    BENCH_PACKED_AND, BENCH_SBYTE_AND, BENCH_SBYTE_NOT, BENCH_SBYTE_COUNT,
+    BENCH_SBYTE_EXTRACT, BENCH_KERNELS
+} Bench_Kernel;
+
+static const char* const bench_names[BENCH_KERNELS] = {
+    "vbit not", "vbit and", "vbit or", "vbit xor", "vbit count", "vbit all_true",
+    "vbit filter", "pack_bitmap", "unpack_bitmap", "vbit pack", "vbit unpack",
+    "packed and", "sbyte and", "sbyte not", "sbyte count", "sbyte extract"
+};
+
+/* Input bytes one call consumes */
+static size_t bench_input_bytes(Bench_Kernel k, size_t n) {
+    switch (k) {
+        case BENCH_AND: case BENCH_OR: case BENCH_XOR: case BENCH_PACKED_AND:
+            return 2 * n;
+        case BENCH_UNPACK_BITMAP:
+            return n / 8;
+        case BENCH_UNPACK:
+            return n / 4;
+        case BENCH_SBYTE_AND:
+            return 2 * n * sizeof(Seraph_SemanticByte);
+        case BENCH_SBYTE_NOT: case BENCH_SBYTE_COUNT: case BENCH_SBYTE_EXTRACT:
+            return n * sizeof(Seraph_SemanticByte);
+        default:
+            return n;
+    }
+}
+
+static size_t bench_call(Bench_Kernel k, Bench_Data* d) {
+    size_t n = d->n;
+    switch (k) {
+        case BENCH_NOT:           seraph_vbit_not_array(d->a, d->dst, n); return d->dst[n / 2];
+        case BENCH_AND:           seraph_vbit_and_array(d->a, d->b, d->dst, n); return d->dst[n / 2];
+        case BENCH_OR:            seraph_vbit_or_array(d->a, d->b, d->dst, n); return d->dst[n / 2];
+        case BENCH_XOR:           seraph_vbit_xor_array(d->a, d->b, d->dst, n); return d->dst[n / 2];
+        case BENCH_COUNT:         return seraph_vbit_count_true(d->a, n);
+        case BENCH_ALL_TRUE:      return seraph_vbit_all_true(d->all, n);
+        case BENCH_FILTER:        return seraph_vbit_filter_true(d->a, n, d->indices);
+        case BENCH_PACK_BITMAP:   seraph_vbit_pack_bitmap(d->a, n, d->bitmap); return d->bitmap[0];
+        case BENCH_UNPACK_BITMAP: seraph_vbit_unpack_bitmap(d->bitmap, n, d->dst); return d->dst[1];
+        case BENCH_PACK:          seraph_vbit_pack(d->a, n, d->pa); return (size_t)d->pa[0].t;
+        case BENCH_UNPACK:        seraph_vbit_unpack(d->pa, n, d->dst); return d->dst[1];
+        case BENCH_PACKED_AND:
+            seraph_vbit_packed_and(d->pa, d->pb, d->pdst, seraph_vbit_packed_words(n));
+            return (size_t)d->pdst[0].f;
+        case BENCH_SBYTE_AND:     seraph_sbyte_and_array(d->sa, d->sb, d->sdst, n); return d->sdst[1].value;
+        case BENCH_SBYTE_NOT:     seraph_sbyte_not_array(d->sa, d->sdst, n); return d->sdst[1].value;
+        case BENCH_SBYTE_COUNT:   return seraph_sbyte_count_valid(d->sa, n);
+        case BENCH_SBYTE_EXTRACT: return seraph_sbyte_extract_valid(d->sa, n, d->bytes, n);
+        default:                  return 0;
+    }
+}
+
+static double bench_run(Bench_Kernel k, Bench_Data* d, size_t repeats) {
+    volatile size_t sink = 0;
+    uint64_t start = bench_now_ns();
+    for (size_t r = 0; r < repeats; r++) {
+        sink += bench_call(k, d);
+    }
+    uint64_t ns = bench_now_ns() - start;
+    (void)sink;
+    return (double)(bench_input_bytes(k, d->n) * repeats) / (double)ns;
+}
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? (size_t)strtoul(argv[1], NULL, 10) : 65536;
+    size_t repeats = argc > 2 ? (size_t)strtoul(argv[2], NULL, 10) : 2000;
+    if (n < 64) n = 64;
+    if (repeats == 0) repeats = 2000;
+
+    size_t words = seraph_vbit_packed_words(n);
+    Bench_Data d = {
+        .n = n,
+        .a = malloc(n), .b = malloc(n), .all = malloc(n), .dst = malloc(n),
+        .bitmap = malloc(n / 8 + 1), .indices = malloc(n * sizeof(size_t)),
+        .pa = malloc(words * sizeof(Seraph_Vbit_Packed)),
+        .pb = malloc(words * sizeof(Seraph_Vbit_Packed)),
+        .pdst = malloc(words * sizeof(Seraph_Vbit_Packed)),
+        .sa = malloc(n * sizeof(Seraph_SemanticByte)),
+        .sb = malloc(n * sizeof(Seraph_SemanticByte)),
+        .sdst = malloc(n * sizeof(Seraph_SemanticByte)),
+        .bytes = malloc(n),
+    };
+    if (!d.a || !d.b || !d.all || !d.dst || !d.bitmap || !d.indices || !d.pa || !d.pb ||
+        !d.pdst || !d.sa || !d.sb || !d.sdst || !d.bytes) {
+        fprintf(stderr, "bench_vbit: out of memory\n");
+        return 1;
+    }
+
+    static const Seraph_Vbit vals[3] = { SERAPH_VBIT_FALSE, SERAPH_VBIT_TRUE, SERAPH_VBIT_VOID };
+    static const uint8_t masks[4] = { 0xFF, 0xFF, 0x0F, 0x00 };
+    uint64_t rng = 0x9E3779B97F4A7C15ull;
+    for (size_t i = 0; i < n; i++) {
+        rng ^= rng << 13;
+        rng ^= rng >> 7;
+        rng ^= rng << 17;
+        d.a[i] = vals[rng % 3];
+        d.b[i] = vals[(rng >> 8) % 3];
+        d.sa[i] = seraph_sbyte_create((uint8_t)(rng >> 16), masks[(rng >> 24) & 3]);
+        d.sb[i] = seraph_sbyte_create((uint8_t)(rng >> 32), masks[(rng >> 40) & 3]);
+    }
+    memset(d.all, SERAPH_VBIT_TRUE, n);
+    seraph_vbit_pack_bitmap(d.a, n, d.bitmap);
+    seraph_vbit_pack(d.a, n, d.pa);
+    seraph_vbit_pack(d.b, n, d.pb);
+
+    static const Seraph_Vbit_Impl impls[] = {
+        SERAPH_VBIT_IMPL_SCALAR, SERAPH_VBIT_IMPL_SSE42, SERAPH_VBIT_IMPL_AVX2
+    };
+    size_t impl_count = sizeof(impls) / sizeof(impls[0]);
+
+    seraph_vbit_set_impl(SERAPH_VBIT_IMPL_AUTO);
+    printf("VBIT/semantic byte array kernels (%zu elements x %zu, auto selects %s), GB/s\n",
+           n, repeats, seraph_vbit_impl_name(seraph_vbit_get_impl()));
+    printf("%14s", "kernel");
+    for (size_t v = 0; v < impl_count; v++) {
+        printf(" %10s", seraph_vbit_impl_name(impls[v]));
+    }
+    printf("\n");
+
+    for (int k = 0; k < BENCH_KERNELS; k++) {
+        printf("%14s", bench_names[k]);
+        for (size_t v = 0; v < impl_count; v++) {
+            if (!seraph_vbit_set_impl(impls[v])) {
+                printf(" %10s", "-");
+                continue;
+            }
+            printf(" %10.2f", bench_run((Bench_Kernel)k, &d, repeats));
+        }
+        printf("\n");
+    }
+
+    seraph_vbit_set_impl(SERAPH_VBIT_IMPL_AUTO);
+    free(d.a); free(d.b); free(d.all); free(d.dst); free(d.bitmap); free(d.indices);
+    free(d.pa); free(d.pb); free(d.pdst); free(d.sa); free(d.sb); free(d.sdst); free(d.bytes);
+    return 0;
+}
@@ -0,0 +1,44 @@
+#!/bin/sh
+# Inliner benchmark set: compile each program at -O0 and -O2, check the
+# exit code against the "Expected exit code" header, and report run time.
+#
+# Usage: bench/seraphim/run_bench.sh [path/to/seraphic]
+
+SERAPHIC=${1:-build/seraphic}
+DIR=$(dirname "$0")
+OUT=${TMPDIR:-/tmp}/seraph_bench.$$
+status=0
+
+mkdir -p "$OUT" || exit 1
+
+for src in "$DIR"/*.srph; do
+    name=$(basename "$src" .srph)
+    expected=$(sed -n 's|^// Expected exit code: \([0-9]*\).*|\1|p' "$src")
+
+    for level in 0 2; do
+        bin="$OUT/$name.O$level"
+        if ! "$SERAPHIC" -O$level "$src" -o "$bin" >/dev/null; then
+            echo "$name -O$level: COMPILE FAILED"
+            status=1
+            continue
+        fi
+        chmod +x "$bin"
+
+        start=$(date +%s.%N)
+        "$bin"
+        code=$?
+        end=$(date +%s.%N)
+        secs=$(awk "BEGIN { print $end - $start }")
+
+        if [ "$code" = "$expected" ]; then
+            printf '%-20s -O%s  %6.3fs  ok\n' "$name" "$level" "$secs"
+        else
+            printf '%-20s -O%s  %6.3fs  exit %s, expected %s\n' \
+                "$name" "$level" "$secs" "$code" "$expected"
+            status=1
+        fi
+    done
+done
+
+rm -rf "$OUT"
+exit $status
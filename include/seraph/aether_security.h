@@ -27,6 +27,7 @@
 #include <stdbool.h>
 #include "seraph/vbit.h"
 #include "seraph/aether.h"
+#include "seraph/crypto/sha256.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -69,14 +70,10 @@ extern "C" {
 /**
  * @brief SHA-256 context structure
  *
- * No dynamic allocation, fixed size for kernel safety.
- * Stack usage: 112 bytes
+ * The shared SHA256_Context: no dynamic allocation, fixed size for
+ * kernel safety. Stack usage: 112 bytes
  */
-typedef struct {
-    uint32_t state[8];     /**< Hash state (H0-H7) */
-    uint64_t count;        /**< Total bits processed */
-    uint8_t  buffer[64];   /**< Message block buffer */
-} Aether_SHA256_Context;
+typedef SHA256_Context Aether_SHA256_Context;
 
 /**
  * @brief Initialize SHA-256 context
@@ -106,16 +103,38 @@ void aether_sha256(const void* data, size_t len, uint8_t digest[32]);
  * HMAC-SHA256 Implementation
  *============================================================================*/
 
+/**
+ * @brief Precomputed HMAC-SHA256 key
+ *
+ * SHA-256 chaining values after absorbing the ipad and opad key blocks.
+ * Built once per key and copied for every message, so a MAC no longer
+ * pays the two key-block compressions.
+ */
+typedef struct {
+    uint32_t inner[8];  /**< State after (key ^ ipad) */
+    uint32_t outer[8];  /**< State after (key ^ opad) */
+} Aether_HMAC_Key;
+
 /**
  * @brief HMAC-SHA256 context
  *
  * Uses SHA-256 internally, no additional heap allocation.
  */
 typedef struct {
-    Aether_SHA256_Context sha_ctx;
-    uint8_t key_pad[64];  /**< Padded key for outer hash */
+    Aether_SHA256_Context sha_ctx;  /**< Inner hash */
+    Aether_SHA256_Context outer;    /**< Outer hash, key block absorbed */
 } Aether_HMAC_Context;
 
+/**
+ * @brief Precompute the inner and outer key states
+ *
+ * @param hk Key state to fill
+ * @param key Key data
+ * @param key_len Key length (will be hashed if > 64 bytes)
+ */
+void aether_hmac_key_init(Aether_HMAC_Key* hk,
+                           const uint8_t* key, size_t key_len);
+
 /**
  * @brief Initialize HMAC-SHA256 with key
  *
@@ -126,6 +145,12 @@ typedef struct {
 void aether_hmac_sha256_init(Aether_HMAC_Context* ctx,
                               const uint8_t* key, size_t key_len);
 
+/**
+ * @brief Initialize HMAC-SHA256 from a precomputed key
+ */
+void aether_hmac_sha256_init_key(Aether_HMAC_Context* ctx,
+                                  const Aether_HMAC_Key* hk);
+
 /**
  * @brief Update HMAC with data
  */
@@ -147,6 +172,32 @@ void aether_hmac_sha256(const uint8_t* key, size_t key_len,
                          const void* data, size_t data_len,
                          uint8_t mac[32]);
 
+/**
+ * @brief One-shot HMAC-SHA256 with a precomputed key
+ */
+void aether_hmac_sha256_keyed(const Aether_HMAC_Key* hk,
+                               const void* data, size_t data_len,
+                               uint8_t mac[32]);
+
+/**
+ * @brief HMAC-SHA256 of several messages at once
+ *
+ * Message i is authenticated with keys[i]; keys may repeat. The inner
+ * and outer hashes go through sha256_multi_from(), so the AVX2 variant
+ * hashes eight messages side by side.
+ *
+ * @param keys Precomputed keys (count entries)
+ * @param data Message pointers (count entries)
+ * @param data_len Message lengths (count entries)
+ * @param count Number of messages
+ * @param macs Output, count * 32 bytes
+ */
+void aether_hmac_sha256_multi(const Aether_HMAC_Key* const keys[],
+                               const void* const data[],
+                               const size_t data_len[],
+                               size_t count,
+                               uint8_t* macs);
+
 /**
  * @brief Constant-time HMAC comparison
  *
@@ -298,6 +349,7 @@ typedef struct {
     uint8_t  permissions;        /**< Allowed operations */
     bool     authenticated;      /**< Has valid shared key? */
     uint8_t  key[AETHER_HMAC_KEY_SIZE];  /**< Pre-shared key */
+    Aether_HMAC_Key hmac_key;    /**< key, precomputed for HMAC */
 } Aether_Node_Permission;
 
 /**
@@ -460,6 +512,8 @@ void aether_security_destroy(Aether_Security_State* state);
 /**
  * @brief Set pre-shared key for a node
  *
+ * Also precomputes the node's HMAC key state used for every frame.
+ *
  * @param state Security state
  * @param node_id Remote node ID
  * @param key Pre-shared key (AETHER_HMAC_KEY_SIZE bytes)
@@ -530,6 +584,35 @@ Aether_Validate_Result aether_security_validate_frame(
     uint64_t current_tick,
     uint16_t* src_node_out);
 
+/**
+ * @brief Validate a burst of incoming Aether frames
+ *
+ * Runs the same checks as aether_security_validate_frame() on each frame
+ * in order, but computes the HMACs of up to eight frames together. Rate
+ * buckets are only peeked before the HMACs; tokens are taken in order
+ * once a frame passes, so forged frames never cost a valid one its token.
+ * Frames that pass are accepted into the replay window, so a duplicate
+ * later in the same burst is rejected; calling
+ * aether_security_accept_packet() for them afterwards is harmless.
+ *
+ * @param state Security state
+ * @param frames Raw frame pointers (count entries)
+ * @param frame_lens Frame lengths (count entries)
+ * @param count Number of frames
+ * @param current_tick Current system tick
+ * @param results Output: validation result per frame
+ * @param src_nodes Output: source node ID per passing frame (may be NULL)
+ * @return Number of frames that passed
+ */
+size_t aether_security_validate_frames(
+    Aether_Security_State* state,
+    const void* const frames[],
+    const size_t frame_lens[],
+    size_t count,
+    uint64_t current_tick,
+    Aether_Validate_Result results[],
+    uint16_t src_nodes[]);
+
 /**
  * @brief Accept a validated packet (update replay state)
  *
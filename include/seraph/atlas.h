@@ -39,6 +39,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdatomic.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -86,8 +87,11 @@ extern "C" {
 /** Maximum path length for backing file */
 #define SERAPH_ATLAS_MAX_PATH       256
 
-/** Maximum transactions */
-#define SERAPH_ATLAS_MAX_TRANSACTIONS 16
+/** Transaction slots allocated at init; the table doubles on demand */
+#define SERAPH_ATLAS_INITIAL_TRANSACTIONS 16
+
+/** Upper bound on transaction slots */
+#define SERAPH_ATLAS_MAX_TRANSACTIONS 65536
 
 /** Maximum dirty pages per transaction */
 #define SERAPH_ATLAS_MAX_DIRTY_PAGES  256
@@ -95,6 +99,22 @@ extern "C" {
 /** Generation table size (max allocations tracked) */
 #define SERAPH_ATLAS_GEN_TABLE_SIZE   4096
 
+/** Header size (Genesis + Gen Table + some padding) */
+#define SERAPH_ATLAS_HEADER_SIZE      (SERAPH_PAGE_SIZE * 4)  /* 16KB header */
+
+/*============================================================================
+ * Redo Log Configuration
+ *============================================================================*/
+
+/** Redo log region reserved when formatting a new Atlas (at most size / 8) */
+#define SERAPH_ATLAS_LOG_SIZE         (1024 * 1024)
+
+/** Smallest redo log worth reserving; smaller Atlases run without a log */
+#define SERAPH_ATLAS_LOG_MIN_SIZE     (SERAPH_PAGE_SIZE * 4)
+
+/** Log record magic ("ALRC") */
+#define SERAPH_ATLAS_LOG_MAGIC        0x43524C41U
+
 /*============================================================================
  * Semantic Checkpoint Configuration
  *============================================================================*/
@@ -125,9 +145,6 @@ extern "C" {
 /** Maximum number of concurrent snapshots */
 #define SERAPH_ATLAS_MAX_SNAPSHOTS          8
 
-/** Maximum pages tracked per snapshot for COW */
-#define SERAPH_ATLAS_SNAPSHOT_MAX_PAGES     1024
-
 /** Maximum vector clock dimension (nodes in distributed system) */
 #define SERAPH_ATLAS_VCLOCK_MAX_NODES       64
 
@@ -135,7 +152,13 @@ extern "C" {
 #define SERAPH_ATLAS_SNAPSHOT_MAGIC         0x5345524150534E50ULL
 
 /** Snapshot version for forward compatibility */
-#define SERAPH_ATLAS_SNAPSHOT_VERSION       1
+#define SERAPH_ATLAS_SNAPSHOT_VERSION       2
+
+/** COW index slots allocated on the first copy; the index doubles on demand */
+#define SERAPH_ATLAS_COW_INDEX_INITIAL      64
+
+/** cow_pending bit for pages holding snapshot metadata or copies */
+#define SERAPH_ATLAS_COW_META               0x8000u
 
 /*============================================================================
  * Genesis Structure
@@ -203,8 +226,17 @@ typedef struct __attribute__((aligned(256))) {
     /** Number of aborted transactions */
     uint64_t abort_count;
 
+    /** Offset of the redo log region (0 = no log) */
+    uint64_t log_offset;
+
+    /** Size of the redo log region in bytes */
+    uint64_t log_size;
+
+    /** Log sequence number replay starts from; older records are checkpointed */
+    uint64_t log_checkpoint_lsn;
+
     /** Reserved for future use */
-    uint8_t _reserved[128];
+    uint8_t _reserved[104];
 } Seraph_Atlas_Genesis;
 
 /* Static assertion for genesis size */
@@ -235,6 +267,40 @@ typedef struct {
     uint64_t generations[SERAPH_ATLAS_GEN_TABLE_SIZE];
 } Seraph_Atlas_Gen_Table;
 
+/*============================================================================
+ * Redo Log
+ *============================================================================*/
+
+/**
+ * @brief Header of one committed transaction in the redo log
+ *
+ * The log is a circular region addressed by log sequence number (LSN): the
+ * byte at LSN n lives at log_offset + n % log_size. A record is followed by
+ * an image of Genesis as of the commit and then range_count ranges, each a
+ * Seraph_Atlas_Log_Range and its after-image padded to 8 bytes.
+ *
+ * A record is valid only if its magic, its own LSN and its CRC32 (computed
+ * with checksum = 0) all match, so torn writes and records left over from
+ * an earlier lap around the log both end replay.
+ */
+typedef struct {
+    uint32_t magic;         /**< SERAPH_ATLAS_LOG_MAGIC */
+    uint32_t checksum;      /**< CRC32 over the whole record */
+    uint64_t lsn;           /**< LSN of this header */
+    uint64_t size;          /**< Record size in bytes, 8-byte aligned */
+    uint64_t generation;    /**< Commit generation */
+    uint32_t range_count;   /**< After-image ranges that follow */
+    uint32_t _reserved;
+} Seraph_Atlas_Log_Record;
+
+/**
+ * @brief One after-image range in a redo log record
+ */
+typedef struct {
+    uint64_t offset;        /**< Atlas offset of the range */
+    uint64_t length;        /**< Bytes of after-image that follow */
+} Seraph_Atlas_Log_Range;
+
 /*============================================================================
  * Free List
  *============================================================================*/
@@ -267,6 +333,22 @@ typedef enum {
     SERAPH_ATLAS_TX_ABORTED = 3    /**< Aborted/rolled back */
 } Seraph_Atlas_Tx_State;
 
+/** Access set flags */
+#define SERAPH_ATLAS_ACCESS_READ  0x1  /**< Page was read */
+#define SERAPH_ATLAS_ACCESS_WRITE 0x2  /**< Page was written */
+
+/**
+ * @brief One page in a transaction's read/write set
+ *
+ * Records the page's version stamp when the transaction first touched it.
+ * Commit succeeds only if no other commit has stamped the page since.
+ */
+typedef struct {
+    uint64_t page;      /**< Page index + 1 (0 = empty hash slot) */
+    uint64_t version;   /**< Version stamp observed at first access */
+    uint32_t flags;     /**< SERAPH_ATLAS_ACCESS_* */
+} Seraph_Atlas_Access;
+
 /**
  * @brief Dirty page tracking for transactions
  */
@@ -279,13 +361,20 @@ typedef struct {
 /**
  * @brief Atlas transaction context
  *
- * Atlas provides ACID transactions without a transaction log:
+ * Atlas provides ACID transactions:
  *   - Atomicity: Commit is a single pointer swap
  *   - Consistency: Invariants checked before commit
  *   - Isolation: Copy-on-write provides snapshot isolation
- *   - Durability: Committed data is on NVMe
+ *   - Durability: After-images of dirty ranges are in the redo log on NVMe
+ *
+ * Conflicts are detected per page: the transaction's read and write sets
+ * are validated against the pages' version stamps at commit, so
+ * transactions touching disjoint pages commit concurrently.
  */
-typedef struct {
+typedef struct Seraph_Atlas_Transaction {
+    /** Owning Atlas */
+    struct Seraph_Atlas* atlas;
+
     /** Transaction ID */
     uint64_t tx_id;
 
@@ -306,6 +395,15 @@ typedef struct {
 
     /** Number of dirty pages */
     uint32_t dirty_count;
+
+    /** Read/write set (open-addressed by page, heap allocated) */
+    Seraph_Atlas_Access* access;
+
+    /** Pages in the read/write set */
+    uint32_t access_count;
+
+    /** Hash slots in access (power of two, or 0) */
+    uint32_t access_capacity;
 } Seraph_Atlas_Transaction;
 
 /*============================================================================
@@ -321,7 +419,7 @@ typedef struct Seraph_Atlas_Snapshot Seraph_Atlas_Snapshot;
  * This is the main state structure for the Atlas subsystem.
  * For userspace simulation, we use mmap with file backing.
  */
-typedef struct {
+typedef struct Seraph_Atlas {
     /** Base pointer of the mmap'd region */
     void* base;
 
@@ -348,12 +446,54 @@ typedef struct {
     /** Current epoch (incremented each commit) */
     uint64_t current_epoch;
 
-    /** Active transactions */
-    Seraph_Atlas_Transaction transactions[SERAPH_ATLAS_MAX_TRANSACTIONS];
+    /** Transaction slots (heap allocated, grown on demand) */
+    Seraph_Atlas_Transaction** transactions;
+
+    /** Number of slots in transactions */
+    uint32_t tx_capacity;
 
     /** Next transaction ID */
     uint64_t next_tx_id;
 
+    /** Version stamp per page, bumped by each commit that writes it (volatile) */
+    _Atomic uint64_t* page_versions;
+
+    /** Number of entries in page_versions */
+    size_t page_count;
+
+    /** Serializes transaction slots and commit validation */
+    atomic_flag tx_lock;
+
+    /*--- Redo Log State (volatile) ---*/
+
+    /** LSN just past the last appended record (written under tx_lock) */
+    _Atomic uint64_t log_append_lsn;
+
+    /** LSN up to which the log is known to be on disk */
+    _Atomic uint64_t log_flushed_lsn;
+
+    /** Held by the committer currently flushing the log for its group */
+    atomic_flag log_flushing;
+
+    /** Held while a checkpoint is running */
+    atomic_flag log_checkpointing;
+
+    /** Group commit latency window in microseconds (0 = flush at once) */
+    uint32_t group_commit_us;
+
+    /** Log flushes issued (each may cover many commits) */
+    _Atomic uint64_t log_flushes;
+
+    /** Checkpoints completed */
+    _Atomic uint64_t checkpoints;
+
+    /** Per-page snapshot state: bit i = slot i still needs a copy, plus
+     *  a bit for pages holding snapshot metadata (volatile) */
+    uint16_t* cow_pending;
+
+    /** Serializes COW copies, including those taken from the fault handler */
+    atomic_flag snap_lock;
+
     /*--- Causal Snapshot State ---*/
 
     /** Active/committed snapshots */
@@ -370,6 +510,11 @@ typedef struct {
 
     /** Current vector clock (for causality tracking) */
     Seraph_Chronon current_vclock[SERAPH_ATLAS_VCLOCK_MAX_NODES];
+
+    /*--- Semantic Checkpoint State (volatile) ---*/
+
+    /** Worker threads for checkpoint validation (0 = one per CPU) */
+    uint32_t validate_threads;
 } Seraph_Atlas;
 
 /*============================================================================
@@ -560,7 +705,14 @@ Seraph_Atlas_Transaction* seraph_atlas_begin(Seraph_Atlas* atlas);
 /**
  * @brief Commit a transaction
  *
- * Flushes all dirty pages and atomically updates Genesis.
+ * Validates the read/write set: if any page it touched has been stamped
+ * by another commit since, the transaction aborts. Otherwise the written
+ * pages get a new version stamp and Genesis is updated.
+ *
+ * Durability: with a redo log, the after-images of the ranges passed to
+ * seraph_atlas_tx_mark_dirty() are appended to the log and the call returns
+ * once the log is on disk; concurrent commits share one log flush. Without
+ * a log (Atlases created before the log existed), all data is flushed.
  *
  * @param atlas The Atlas instance
  * @param tx Transaction to commit
@@ -584,9 +736,29 @@ void seraph_atlas_abort(
     Seraph_Atlas_Transaction* tx
 );
 
+/**
+ * @brief Add a region to the transaction's read set
+ *
+ * Call before reading the data: commit fails if another transaction
+ * commits a write to any of these pages in the meantime.
+ *
+ * @param tx The transaction
+ * @param ptr Start of the region (must be within Atlas)
+ * @param size Size of the region
+ * @return TRUE on success, FALSE if out of memory, VOID on bad arguments
+ */
+Seraph_Vbit seraph_atlas_tx_mark_read(
+    Seraph_Atlas_Transaction* tx,
+    const void* ptr,
+    size_t size
+);
+
 /**
  * @brief Mark a region as dirty within a transaction
  *
+ * Regions within Atlas also join the write set: the pages are validated
+ * like reads and get a new version stamp when the transaction commits.
+ *
  * @param tx The transaction
  * @param ptr Pointer to modified data
  * @param size Size of modified region
@@ -626,6 +798,31 @@ Seraph_Vbit seraph_atlas_sync_range(
     size_t size
 );
 
+/**
+ * @brief Write back data pages and release redo log space
+ *
+ * Commits only append to the redo log; data pages reach disk here. Runs
+ * automatically once the log is half full, and may be called from a
+ * background thread at any time. Commits proceed while it runs.
+ *
+ * @param atlas The Atlas instance
+ * @return TRUE on success, FALSE if another checkpoint is running,
+ *         VOID if the Atlas has no log or on error
+ */
+Seraph_Vbit seraph_atlas_checkpoint(Seraph_Atlas* atlas);
+
+/**
+ * @brief Set the group commit latency window
+ *
+ * The committer that flushes the log first waits up to @p window_us so
+ * more concurrent commits share the flush. 0 flushes at once; commits that
+ * arrive during a flush still share the next one.
+ *
+ * @param atlas The Atlas instance
+ * @param window_us Window in microseconds
+ */
+void seraph_atlas_set_group_commit(Seraph_Atlas* atlas, uint32_t window_us);
+
 /*============================================================================
  * Generation Table (Capability Persistence)
  *============================================================================*/
@@ -684,6 +881,10 @@ typedef struct {
     uint64_t free_count;
     uint64_t commit_count;
     uint64_t abort_count;
+    size_t log_size;            /**< Redo log region size (0 = no log) */
+    size_t log_used;            /**< Log bytes not yet checkpointed */
+    uint64_t log_flushes;       /**< Log flushes (group commits) */
+    uint64_t checkpoints;       /**< Checkpoints completed */
     bool initialized;
 } Seraph_Atlas_Stats;
 
@@ -772,7 +973,7 @@ typedef struct {
  * +------------------+
  * | Page Tracking    | - Which pages are included
  * +------------------+
- * | COW Pages        | - Original page data for modified pages
+ * | COW Index        | - Open-addressed table of copied pages (in Atlas)
  * +------------------+
  * | Genesis Copy     | - Snapshot of Genesis at capture time
  * +------------------+
@@ -801,10 +1002,10 @@ struct Seraph_Atlas_Snapshot {
     uint32_t included_page_count;       /**< Number of pages in snapshot */
 
     /*--- Copy-on-Write State ---*/
-    Seraph_Atlas_COW_Page cow_pages[SERAPH_ATLAS_SNAPSHOT_MAX_PAGES];
+    uint64_t cow_index_offset;          /**< Atlas offset of the COW index (0 = none) */
+    uint32_t cow_index_capacity;        /**< Index slots (power of two) */
     uint32_t cow_page_count;            /**< Number of COW pages */
-    uint64_t cow_storage_offset;        /**< Where COW data is stored in Atlas */
-    uint64_t cow_storage_size;          /**< Total size of COW storage used */
+    uint64_t cow_storage_size;          /**< Total size of COW copies */
 
     /*--- Genesis Snapshot ---*/
     Seraph_Atlas_Genesis genesis_copy;  /**< Copy of Genesis at snapshot time */
@@ -852,10 +1053,28 @@ struct Seraph_Atlas_Snapshot {
  *
  * COPY-ON-WRITE:
  *
- *   While a snapshot is ACTIVE, any writes to included pages trigger COW:
- *   the original page data is copied before the write proceeds. This
- *   allows the live Atlas to continue operating while the snapshot
- *   preserves a frozen view.
+ *   Activation write-protects the included pages. The first write to
+ *   each one faults, the original page data is copied, and the write
+ *   proceeds, so application code needs no COW calls and the cost is
+ *   proportional to the pages actually modified. Pages stay protected
+ *   after commit so the snapshot keeps its frozen view until it is
+ *   deleted. The Atlas header (Genesis and the generation table) and the
+ *   redo log are never protected: Genesis is restored from its copy, and
+ *   revocations must not roll back.
+ *
+ *   On the host the fault is taken by a SIGSEGV handler (a vectored
+ *   exception handler on Windows) installed on first activation, which
+ *   chains to any previous handler for faults outside Atlas. In the
+ *   kernel, protection clears the PTE write bit through the VMM given to
+ *   seraph_atlas_attach_vmm(), and the page fault handler calls
+ *   seraph_atlas_snapshot_write_fault().
+ *
+ *   The kernel does not raise SIGSEGV when a system call writes into a
+ *   protected page on the process's behalf: read() or recv() into Atlas
+ *   memory fails with EFAULT and nothing is copied. Write to each
+ *   destination page from user code first, or call
+ *   seraph_atlas_snapshot_cow_page(), before handing it to the kernel. Page copies come from the Atlas
+ *   bump allocator, which is lock-free so the handler can use it.
  *============================================================================*/
 
 /**
@@ -903,7 +1122,7 @@ Seraph_Atlas_Snapshot* seraph_atlas_snapshot_begin(
  * @param snapshot  The snapshot being prepared
  * @param ptr       Start of region to include (must be in Atlas)
  * @param size      Size of region to include
- * @return TRUE on success, FALSE if max pages exceeded, VOID on error
+ * @return TRUE on success, VOID on error
  *
  * @note Snapshot must be in PREPARING state.
  */
@@ -932,9 +1151,10 @@ Seraph_Vbit seraph_atlas_snapshot_include_all(
 /**
  * @brief Activate the snapshot for copy-on-write
  *
- * Transitions the snapshot from PREPARING to ACTIVE state. Once active,
- * any writes to included pages will trigger copy-on-write: the original
- * page data is preserved in the snapshot before the write proceeds.
+ * Transitions the snapshot from PREPARING to ACTIVE state and captures
+ * Genesis. Included pages that hold data are write-protected; from then
+ * on the first write to each one preserves its original data in the
+ * snapshot before the write proceeds.
  *
  * IMPORTANT:
  *   After activation, no more pages can be added via snapshot_include.
@@ -1108,9 +1328,9 @@ Seraph_Vbit seraph_atlas_snapshot_is_valid(
 /**
  * @brief Trigger copy-on-write for a page
  *
- * Internal function called when a write occurs to a page that is
- * included in an active snapshot. Copies the original page data
- * to COW storage before allowing the write to proceed.
+ * Copies the original page data to COW storage ahead of a write. The
+ * write fault path does this automatically; explicit calls are only
+ * needed where pages cannot be write-protected.
  *
  * @param atlas     The Atlas instance
  * @param snapshot  The active snapshot
@@ -1125,6 +1345,30 @@ Seraph_Vbit seraph_atlas_snapshot_cow_page(
     void* page_ptr
 );
 
+/**
+ * @brief Resolve a write fault on a snapshot-protected page
+ *
+ * Copies the page for every snapshot still waiting on it and makes it
+ * writable again. Safe to call from a signal or exception handler.
+ *
+ * @param addr Faulting address
+ * @return TRUE if the fault was an Atlas snapshot write (retry the
+ *         write), FALSE if the address is not ours
+ */
+Seraph_Vbit seraph_atlas_snapshot_write_fault(void* addr);
+
+#ifdef SERAPH_KERNEL
+#include "seraph/vmm.h"
+
+/**
+ * @brief Give Atlas the VMM used to write-protect snapshot pages
+ *
+ * Without it, kernel snapshots fall back to explicit
+ * seraph_atlas_snapshot_cow_page() calls.
+ */
+void seraph_atlas_attach_vmm(Seraph_VMM* vmm);
+#endif
+
 /**
  * @brief Get the original page data from a snapshot
  *
@@ -1143,6 +1387,149 @@ const void* seraph_atlas_snapshot_read_page(
     const void* page_ptr
 );
 
+/*============================================================================
+ * Snapshot Export and Import
+ *
+ * A committed snapshot can be streamed to a file and imported into another
+ * Atlas of the same geometry. A full export carries every allocated page as
+ * the snapshot sees it; a delta export carries only the pages that differ
+ * from an earlier snapshot, each XORed against its old contents so
+ * unchanged bytes compress to nothing.
+ *
+ * FILE LAYOUT:
+ *
+ *   +--------------------+
+ *   | Export Header      | - IDs, vector clock, Genesis, base digest
+ *   +--------------------+
+ *   | Record + page data | - One per exported page, run-length encoded
+ *   | ...                |
+ *   +--------------------+
+ *   | Trailer            | - Record count, SHA-256 of everything above
+ *   +--------------------+
+ *
+ * Import reads the file twice: the first pass checks the digest and decodes
+ * every record, the second applies them, so a damaged file changes nothing.
+ *
+ * Delta exports need a base snapshot created with include_all, since only
+ * then does its COW index list every page modified after it. A delta is
+ * imported on top of the Atlas its base was imported into, and is refused
+ * if that Atlas's Genesis no longer matches the base.
+ *
+ * The header page (Genesis and the generation table) is always exported in
+ * full: revocations recorded since the snapshot are kept, as on restore.
+ *
+ * Not available in the kernel build, which has no file I/O.
+ *============================================================================*/
+
+#ifndef SERAPH_KERNEL
+
+/** Export file magic ("SNAPEXPT") */
+#define SERAPH_ATLAS_EXPORT_MAGIC           0x5450584550414E53ULL
+
+/** Export trailer magic ("SNAPDONE") */
+#define SERAPH_ATLAS_EXPORT_END_MAGIC       0x454E4F4450414E53ULL
+
+/** Export format version */
+#define SERAPH_ATLAS_EXPORT_VERSION         1
+
+/** Header flag: pages are a delta against base_snapshot_id */
+#define SERAPH_ATLAS_EXPORT_DELTA           (1u << 0)
+
+/** Record encodings */
+#define SERAPH_ATLAS_EXPORT_RAW             0   /**< Page bytes as-is */
+#define SERAPH_ATLAS_EXPORT_RLE             1   /**< Run-length encoded */
+
+/** Record flag: decoded bytes are XORed into the current page */
+#define SERAPH_ATLAS_EXPORT_XOR             (1u << 0)
+
+/**
+ * @brief Export file header
+ */
+typedef struct {
+    uint64_t magic;                     /**< SERAPH_ATLAS_EXPORT_MAGIC */
+    uint32_t version;                   /**< SERAPH_ATLAS_EXPORT_VERSION */
+    uint32_t flags;                     /**< SERAPH_ATLAS_EXPORT_* */
+    uint64_t snapshot_id;               /**< Exported snapshot */
+    uint64_t base_snapshot_id;          /**< Delta base (0 for a full export) */
+    uint64_t atlas_size;                /**< Size of the source Atlas */
+    uint32_t page_size;                 /**< SERAPH_PAGE_SIZE of the source */
+    uint32_t vclock_node_count;         /**< Valid vclock entries */
+    Seraph_Chronon vclock[SERAPH_ATLAS_VCLOCK_MAX_NODES];
+    uint8_t base_digest[32];            /**< Genesis digest of the delta base */
+    Seraph_Atlas_Genesis genesis;       /**< Genesis as of the snapshot */
+} Seraph_Atlas_Export_Header;
+
+/**
+ * @brief Header of one exported page
+ */
+typedef struct {
+    uint64_t page_offset;               /**< Offset of the page in Atlas */
+    uint32_t size;                      /**< Encoded bytes that follow */
+    uint16_t encoding;                  /**< SERAPH_ATLAS_EXPORT_RAW / _RLE */
+    uint16_t flags;                     /**< SERAPH_ATLAS_EXPORT_XOR */
+} Seraph_Atlas_Export_Record;
+
+/**
+ * @brief Export file trailer
+ */
+typedef struct {
+    uint64_t magic;                     /**< SERAPH_ATLAS_EXPORT_END_MAGIC */
+    uint64_t record_count;              /**< Records in the file */
+    uint8_t digest[32];                 /**< SHA-256 of header and records */
+} Seraph_Atlas_Export_Trailer;
+
+/**
+ * @brief Export/import statistics
+ */
+typedef struct {
+    uint64_t pages;                     /**< Pages exported or imported */
+    uint64_t page_bytes;                /**< Uncompressed page bytes */
+    uint64_t file_bytes;                /**< Bytes in the export file */
+} Seraph_Atlas_Export_Stats;
+
+/**
+ * @brief Stream a committed snapshot to a file
+ *
+ * @param atlas             Atlas holding the snapshot
+ * @param snapshot          Committed snapshot to export
+ * @param base_snapshot_id  0 for a full export, else a committed snapshot
+ *                          created earlier with include_all
+ * @param path              Output file (replaced)
+ * @param stats             Optional statistics
+ * @return TRUE on success, FALSE if the base is unusable or the file
+ *         cannot be written, VOID on invalid arguments
+ */
+Seraph_Vbit seraph_atlas_snapshot_export(
+    Seraph_Atlas* atlas,
+    const Seraph_Atlas_Snapshot* snapshot,
+    uint64_t base_snapshot_id,
+    const char* path,
+    Seraph_Atlas_Export_Stats* stats
+);
+
+/**
+ * @brief Apply an exported snapshot to an Atlas
+ *
+ * Writes the exported pages and Genesis, keeping the target's redo log,
+ * then checkpoints. Active transactions are aborted. The file is read
+ * into memory once and fully verified before any page is written, so
+ * the pages applied are exactly the bytes that were checked.
+ *
+ * @param atlas Target Atlas (same page size, at least the source's size,
+ *              same log region)
+ * @param path  Export file
+ * @param stats Optional statistics
+ * @return TRUE on success, FALSE if the file is damaged, does not fit, or
+ *         is a delta whose base does not match, VOID on invalid arguments
+ */
+Seraph_Vbit seraph_atlas_snapshot_import(
+    Seraph_Atlas* atlas,
+    const char* path,
+    Seraph_Atlas_Export_Stats* stats
+);
+
+#endif /* !SERAPH_KERNEL */
+
 /*============================================================================
  * Semantic Checkpointing - Invariant Types
  *
@@ -1701,9 +2088,21 @@ bool seraph_atlas_checkpoint_add_entry(
  * Performs semantic validation of all tracked data structures.
  * This checks that all registered invariants hold for each entry.
  *
+ * Entries are grouped by type and cut into batches, and each invariant is
+ * checked across a whole batch before the next one. Batches are shared
+ * among worker threads (see seraph_atlas_set_validate_threads()), so
+ * custom and instance validators must tolerate running concurrently on
+ * different objects. NO_CYCLE walks share a visited set that remembers
+ * how every node seen so far ends, so validating every node of a list
+ * costs one pass over the list rather than one pass per node. Results,
+ * entry flags and the order of report details do not depend on the
+ * number of threads.
+ *
  * @param atlas The Atlas instance
  * @param checkpoint The checkpoint to validate
- * @param report Optional report structure to fill with details (may be NULL)
+ * @param report Optional report structure to fill (may be NULL); if its
+ *        details/max_details are set, up to max_details failures are
+ *        recorded there in entry order
  * @return SERAPH_VBIT_TRUE if all valid, SERAPH_VBIT_FALSE if errors found,
  *         SERAPH_VBIT_VOID on error
  */
@@ -1713,6 +2112,19 @@ Seraph_Vbit seraph_atlas_checkpoint_validate(
     Seraph_Atlas_Validation_Report* report
 );
 
+/**
+ * @brief Set the number of threads used to validate checkpoints
+ *
+ * 0 (the default) uses one thread per CPU for checkpoints large enough to
+ * benefit and validates small ones on the calling thread. 1 always
+ * validates on the calling thread. Kernel builds always validate on the
+ * calling thread.
+ *
+ * @param atlas The Atlas instance
+ * @param threads Worker count, calling thread included
+ */
+void seraph_atlas_set_validate_threads(Seraph_Atlas* atlas, uint32_t threads);
+
 /**
  * @brief Recover/repair checkpoint entries with automatic repair
  *
@@ -341,6 +341,228 @@ Seraph_Vbit seraph_cap_copy(Seraph_Capability dst, uint64_t dst_offset,
                              Seraph_Capability src, uint64_t src_offset,
                              uint64_t length);
 
+/*============================================================================
+ * Bulk Capability Operations
+ *
+ * Validate the whole range once (VOID, permission, bounds, seal), then move
+ * bytes with memcpy/memset/memcmp, which the C library and the kernel build
+ * implement with vector loads and stores. Bytes are raw data here: unlike
+ * the per-element writes, array writes do not reject VOID-valued bytes.
+ *============================================================================*/
+
+/**
+ * @brief Read a byte range through a capability
+ *
+ * @param cap Source capability (must have read permission)
+ * @param offset Offset in source
+ * @param dst Destination buffer of at least length bytes
+ * @param length Bytes to read
+ * @return TRUE if success, FALSE if denied or out of bounds, VOID if cap/dst invalid
+ */
+Seraph_Vbit seraph_cap_read_array(Seraph_Capability cap, uint64_t offset,
+                                   void* dst, uint64_t length);
+
+/**
+ * @brief Write a byte range through a capability
+ *
+ * @param cap Destination capability (must have write permission)
+ * @param offset Offset in destination
+ * @param src Source buffer of at least length bytes
+ * @param length Bytes to write
+ * @return TRUE if success, FALSE if denied or out of bounds, VOID if cap/src invalid
+ */
+Seraph_Vbit seraph_cap_write_array(Seraph_Capability cap, uint64_t offset,
+                                    const void* src, uint64_t length);
+
+/**
+ * @brief Fill a byte range through a capability
+ *
+ * Like seraph_cap_write_u8(), a VOID fill value (0xFF) is rejected.
+ *
+ * @return TRUE if success, FALSE if denied, out of bounds or value is VOID,
+ *         VOID if cap invalid
+ */
+Seraph_Vbit seraph_cap_fill(Seraph_Capability cap, uint64_t offset,
+                             uint8_t value, uint64_t length);
+
+/**
+ * @brief Compare two byte ranges through capabilities
+ *
+ * @return TRUE if the ranges are equal, FALSE if they differ,
+ *         VOID if either range cannot be read
+ */
+Seraph_Vbit seraph_cap_compare(Seraph_Capability a, uint64_t a_offset,
+                                Seraph_Capability b, uint64_t b_offset,
+                                uint64_t length);
+
+/*============================================================================
+ * Checked Spans
+ *
+ * A span is a capability range that has already passed the VOID, permission,
+ * bounds and seal checks. Parsers take one span for the bytes they walk and
+ * then pay a single length compare per element, or iterate data[0..length)
+ * directly. A span does not track generations: it must not outlive the
+ * capability it was taken from.
+ *============================================================================*/
+
+/**
+ * @brief Validated view of [offset, offset + length) of a capability
+ */
+typedef struct {
+    uint8_t* data;          /**< First byte of the range, NULL if VOID */
+    uint64_t length;        /**< Bytes in the range */
+    uint8_t  permissions;   /**< Permissions inherited from the capability */
+} Seraph_CapSpan;
+
+/** VOID span: every access through it fails */
+#define SERAPH_CAP_SPAN_VOID ((Seraph_CapSpan){ NULL, 0, 0 })
+
+/**
+ * @brief Validate a capability range once and return a span over it
+ *
+ * @param cap Capability
+ * @param offset Start of the range
+ * @param length Bytes in the range
+ * @param perms Permissions every access through the span needs
+ * @return Span over the range, or SERAPH_CAP_SPAN_VOID if cap is VOID or
+ *         sealed, lacks perms, or the range is out of bounds
+ */
+Seraph_CapSpan seraph_cap_span(Seraph_Capability cap, uint64_t offset,
+                                uint64_t length, uint8_t perms);
+
+/**
+ * @brief Check if span is VOID
+ */
+static inline bool seraph_span_is_void(Seraph_CapSpan span) {
+    return span.data == NULL;
+}
+
+/**
+ * @brief Check if [index, index + size) lies inside the span
+ */
+static inline bool seraph_span_range_valid(Seraph_CapSpan span,
+                                           uint64_t index, uint64_t size) {
+    return index <= span.length && size <= span.length - index;
+}
+
+/**
+ * @brief Read uint8_t from span
+ */
+static inline uint8_t seraph_span_read_u8(Seraph_CapSpan span, uint64_t index) {
+    if (index >= span.length || !(span.permissions & SERAPH_CAP_READ)) {
+        return SERAPH_VOID_U8;
+    }
+    return span.data[index];
+}
+
+/**
+ * @brief Read uint16_t from span
+ */
+static inline uint16_t seraph_span_read_u16(Seraph_CapSpan span, uint64_t index) {
+    if (!seraph_span_range_valid(span, index, sizeof(uint16_t)) ||
+        !(span.permissions & SERAPH_CAP_READ)) {
+        return SERAPH_VOID_U16;
+    }
+    uint16_t value;
+    __builtin_memcpy(&value, span.data + index, sizeof(value));
+    return value;
+}
+
+/**
+ * @brief Read uint32_t from span
+ */
+static inline uint32_t seraph_span_read_u32(Seraph_CapSpan span, uint64_t index) {
+    if (!seraph_span_range_valid(span, index, sizeof(uint32_t)) ||
+        !(span.permissions & SERAPH_CAP_READ)) {
+        return SERAPH_VOID_U32;
+    }
+    uint32_t value;
+    __builtin_memcpy(&value, span.data + index, sizeof(value));
+    return value;
+}
+
+/**
+ * @brief Read uint64_t from span
+ */
+static inline uint64_t seraph_span_read_u64(Seraph_CapSpan span, uint64_t index) {
+    if (!seraph_span_range_valid(span, index, sizeof(uint64_t)) ||
+        !(span.permissions & SERAPH_CAP_READ)) {
+        return SERAPH_VOID_U64;
+    }
+    uint64_t value;
+    __builtin_memcpy(&value, span.data + index, sizeof(value));
+    return value;
+}
+
+/**
+ * @brief Write uint8_t to span (VOID values are rejected)
+ */
+static inline Seraph_Vbit seraph_span_write_u8(Seraph_CapSpan span, uint64_t index,
+                                               uint8_t value) {
+    if (seraph_span_is_void(span)) return SERAPH_VBIT_VOID;
+    if (index >= span.length || !(span.permissions & SERAPH_CAP_WRITE) ||
+        SERAPH_IS_VOID_U8(value)) {
+        return SERAPH_VBIT_FALSE;
+    }
+    span.data[index] = value;
+    return SERAPH_VBIT_TRUE;
+}
+
+/**
+ * @brief Write uint16_t to span (VOID values are rejected)
+ */
+static inline Seraph_Vbit seraph_span_write_u16(Seraph_CapSpan span, uint64_t index,
+                                                uint16_t value) {
+    if (seraph_span_is_void(span)) return SERAPH_VBIT_VOID;
+    if (!seraph_span_range_valid(span, index, sizeof(uint16_t)) ||
+        !(span.permissions & SERAPH_CAP_WRITE) || SERAPH_IS_VOID_U16(value)) {
+        return SERAPH_VBIT_FALSE;
+    }
+    __builtin_memcpy(span.data + index, &value, sizeof(value));
+    return SERAPH_VBIT_TRUE;
+}
+
+/**
+ * @brief Write uint32_t to span (VOID values are rejected)
+ */
+static inline Seraph_Vbit seraph_span_write_u32(Seraph_CapSpan span, uint64_t index,
+                                                uint32_t value) {
+    if (seraph_span_is_void(span)) return SERAPH_VBIT_VOID;
+    if (!seraph_span_range_valid(span, index, sizeof(uint32_t)) ||
+        !(span.permissions & SERAPH_CAP_WRITE) || SERAPH_IS_VOID_U32(value)) {
+        return SERAPH_VBIT_FALSE;
+    }
+    __builtin_memcpy(span.data + index, &value, sizeof(value));
+    return SERAPH_VBIT_TRUE;
+}
+
+/**
+ * @brief Write uint64_t to span (VOID values are rejected)
+ */
+static inline Seraph_Vbit seraph_span_write_u64(Seraph_CapSpan span, uint64_t index,
+                                                uint64_t value) {
+    if (seraph_span_is_void(span)) return SERAPH_VBIT_VOID;
+    if (!seraph_span_range_valid(span, index, sizeof(uint64_t)) ||
+        !(span.permissions & SERAPH_CAP_WRITE) || SERAPH_IS_VOID_U64(value)) {
+        return SERAPH_VBIT_FALSE;
+    }
+    __builtin_memcpy(span.data + index, &value, sizeof(value));
+    return SERAPH_VBIT_TRUE;
+}
+
+/**
+ * @brief Narrow a span to [index, index + length) without revalidating the capability
+ *
+ * @return Sub-span, or SERAPH_CAP_SPAN_VOID if the range is outside the span
+ */
+static inline Seraph_CapSpan seraph_span_sub(Seraph_CapSpan span,
+                                             uint64_t index, uint64_t length) {
+    if (seraph_span_is_void(span) || !seraph_span_range_valid(span, index, length)) {
+        return SERAPH_CAP_SPAN_VOID;
+    }
+    return (Seraph_CapSpan){ span.data + index, length, span.permissions };
+}
+
 /*============================================================================
  * Capability Descriptor Table (CDT)
  *============================================================================*/
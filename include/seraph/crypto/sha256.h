@@ -8,7 +8,13 @@
  * - Binary identity generation
  *
  * This is a standalone implementation with no external dependencies,
- * suitable for use in kernel space.
+ * suitable for use in kernel space. It is the only SHA-256 in the tree:
+ * Aether frame authentication and proof blob checksums use it too.
+ *
+ * Block compression is dispatched at runtime (x86-64 userspace only):
+ * - SHA-NI: x86 SHA extensions, one message at a time
+ * - AVX2: eight independent messages at once (sha256_multi only)
+ * - Scalar: portable C, always available, the only kernel variant
  *
  * Implementation based on FIPS 180-4 specification.
  */
@@ -33,6 +39,9 @@ extern "C" {
 /** SHA-256 processes data in 512-bit (64-byte) blocks */
 #define SHA256_BLOCK_SIZE       64
 
+/** Messages hashed together by one AVX2 multi-buffer pass */
+#define SHA256_MULTI_LANES      8
+
 /*============================================================================
  * Types
  *============================================================================*/
@@ -53,6 +62,16 @@ typedef struct {
     uint8_t bytes[SHA256_DIGEST_SIZE];
 } SHA256_Hash;
 
+/**
+ * @brief Block compression variants
+ */
+typedef enum {
+    SHA256_IMPL_AUTO    = 0,        /**< Fastest supported variant (default) */
+    SHA256_IMPL_SCALAR  = 1,        /**< Portable C */
+    SHA256_IMPL_SHA_NI  = 2,        /**< x86 SHA extensions */
+    SHA256_IMPL_AVX2    = 3,        /**< 8-lane multi-buffer; single messages use scalar */
+} SHA256_Impl;
+
 /*============================================================================
  * Context API (Incremental Hashing)
  *============================================================================*/
@@ -105,6 +124,70 @@ void sha256(const void* data, size_t len, uint8_t* digest);
  */
 SHA256_Hash sha256_compute(const void* data, size_t len);
 
+/**
+ * @brief Hash several independent messages
+ *
+ * With AVX2 selected, eight messages are compressed side by side, one
+ * per vector lane; messages of different lengths are fine. Otherwise
+ * each message is hashed in turn with the single-message variant.
+ * Digests must not overlap the inputs.
+ *
+ * @param data Message pointers (count entries)
+ * @param len Message lengths in bytes (count entries)
+ * @param count Number of messages
+ * @param digests Output, count * 32 bytes
+ */
+void sha256_multi(const void* const data[], const size_t len[], size_t count,
+                  uint8_t* digests);
+
+/**
+ * @brief Finish several messages, each continuing a saved context
+ *
+ * Equivalent to copying start[i], appending data[i] and finalizing; the
+ * start contexts are left untouched. This is how keyed hashes reuse a
+ * precomputed prefix (e.g. HMAC ipad/opad states). The AVX2 variant is
+ * used when every start context sits on a block boundary.
+ *
+ * @param start Saved contexts (count entries, may repeat)
+ * @param data Message pointers (count entries)
+ * @param len Message lengths in bytes (count entries)
+ * @param count Number of messages
+ * @param digests Output, count * 32 bytes
+ */
+void sha256_multi_from(const SHA256_Context* const start[], const void* const data[],
+                       const size_t len[], size_t count, uint8_t* digests);
+
+/*============================================================================
+ * Implementation Selection
+ *============================================================================*/
+
+/**
+ * @brief Check whether this CPU and build support a variant
+ * @param impl Variant (AUTO and SCALAR are always supported)
+ * @return 1 if supported, 0 otherwise
+ */
+int sha256_impl_supported(SHA256_Impl impl);
+
+/**
+ * @brief Force a variant for all following hashing
+ *
+ * Meant for tests and benchmarks; call it before other threads hash.
+ *
+ * @param impl Variant to use, SHA256_IMPL_AUTO to restore the default
+ * @return 1 on success, 0 if the variant is not supported
+ */
+int sha256_set_impl(SHA256_Impl impl);
+
+/**
+ * @brief Variant used for sha256_multi() after AUTO resolution
+ */
+SHA256_Impl sha256_get_impl(void);
+
+/**
+ * @brief Short name of a variant ("scalar", "sha-ni", "avx2", "auto")
+ */
+const char* sha256_impl_name(SHA256_Impl impl);
+
 /*============================================================================
  * Utility Functions
  *============================================================================*/
@@ -209,6 +292,53 @@ int sha256_merkle_root_alloc(
     uint8_t* root
 );
 
+/**
+ * @brief Number of nodes in a stored Merkle tree with leaf_count leaves
+ *
+ * Counts every level from the leaves up to and including the root,
+ * using the same odd-level rule as sha256_merkle_root().
+ *
+ * @param leaf_count Number of leaves
+ * @return Node count (0 for no leaves)
+ */
+size_t sha256_merkle_tree_nodes(size_t leaf_count);
+
+/**
+ * @brief Build and store every level of a Merkle tree
+ *
+ * The tree is written level by level: the leaf_count leaves first, then
+ * each parent level, ending with the root as the last node. The root
+ * equals the one returned by sha256_merkle_root() for the same leaves.
+ *
+ * @param leaves Array of leaf hashes (each 32 bytes)
+ * @param leaf_count Number of leaves (at least 1)
+ * @param tree Output, sha256_merkle_tree_nodes(leaf_count) * 32 bytes
+ * @return 1 on success, 0 on error
+ */
+int sha256_merkle_tree(const uint8_t* leaves, size_t leaf_count, uint8_t* tree);
+
+/**
+ * @brief Check one leaf against a root using a stored Merkle tree
+ *
+ * Only the sibling hashes on the path from the leaf to the root are read
+ * from the tree, so verifying one leaf costs O(log n) pair hashes.
+ * The leaf itself is taken from the caller, not from the tree.
+ *
+ * @param leaf Leaf hash to check (32 bytes)
+ * @param index Leaf position in [0, leaf_count)
+ * @param leaf_count Number of leaves in the tree
+ * @param tree Stored tree as written by sha256_merkle_tree()
+ * @param root Expected root hash (32 bytes)
+ * @return 1 if the leaf is included under root, 0 otherwise
+ */
+int sha256_merkle_verify_path(
+    const uint8_t* leaf,
+    size_t index,
+    size_t leaf_count,
+    const uint8_t* tree,
+    const uint8_t* root
+);
+
 /*============================================================================
  * HMAC-SHA256
  *============================================================================*/
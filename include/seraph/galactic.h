@@ -398,6 +398,81 @@ static inline Seraph_Vbit seraph_galactic_ge(Seraph_Galactic a, Seraph_Galactic
     return seraph_q128_ge(a.primal, b.primal);
 }
 
+/*============================================================================
+ * Galactic Batch Operations (Structure of Arrays)
+ *
+ * Batch forms of the arithmetic above over Q128 lanes (see q128.h). They
+ * run in fixed-size chunks through the Q128 batch kernels, so the VOID
+ * rule (either component VOID makes both VOID) is applied per chunk with
+ * vector masks instead of per call. Results are bit-identical to the
+ * scalar functions and destination lanes may alias source lanes.
+ *============================================================================*/
+
+/**
+ * @brief Galactic values split into four word arrays
+ */
+typedef struct {
+    Seraph_Q128_Lanes primal;   /**< Values */
+    Seraph_Q128_Lanes tangent;  /**< Derivatives */
+} Seraph_Galactic_Lanes;
+
+/**
+ * @brief View four consecutive fields of an SoA array as Galactic lanes
+ *
+ * Fields are primal.hi, primal.lo, tangent.hi, tangent.lo starting at
+ * first_field, e.g. from SERAPH_FIELD(Seraph_Galactic, primal.hi) and so on.
+ *
+ * @return TRUE on success, VOID if the array or fields are invalid
+ */
+Seraph_Vbit seraph_galactic_lanes_from_soa(const Seraph_SoA_Array* array,
+                                           uint32_t first_field,
+                                           Seraph_Galactic_Lanes* out);
+
+/**
+ * @brief Split count Galactic values into lanes
+ */
+void seraph_galactic_lanes_scatter(Seraph_Galactic_Lanes dst, const Seraph_Galactic* src,
+                                   size_t count);
+
+/**
+ * @brief Join count lane values back into Galactic values
+ */
+void seraph_galactic_lanes_gather(Seraph_Galactic* dst, Seraph_Galactic_Lanes src,
+                                  size_t count);
+
+/**
+ * @brief dst[i] = seraph_galactic_add(a[i], b[i])
+ */
+void seraph_galactic_add_n(Seraph_Galactic_Lanes dst, Seraph_Galactic_Lanes a,
+                           Seraph_Galactic_Lanes b, size_t count);
+
+/**
+ * @brief dst[i] = seraph_galactic_sub(a[i], b[i])
+ */
+void seraph_galactic_sub_n(Seraph_Galactic_Lanes dst, Seraph_Galactic_Lanes a,
+                           Seraph_Galactic_Lanes b, size_t count);
+
+/**
+ * @brief dst[i] = seraph_galactic_mul(a[i], b[i])
+ */
+void seraph_galactic_mul_n(Seraph_Galactic_Lanes dst, Seraph_Galactic_Lanes a,
+                           Seraph_Galactic_Lanes b, size_t count);
+
+/**
+ * @brief dst[i] = seraph_galactic_scale(x[i], c)
+ */
+void seraph_galactic_scale_n(Seraph_Galactic_Lanes dst, Seraph_Galactic_Lanes x,
+                             Seraph_Q128 c, size_t count);
+
+/**
+ * @brief dst[i] = seraph_galactic_sqrt(x[i])
+ *
+ * The square roots and quotients stay scalar; only the masking and the
+ * doubling are batched, so expect little gain over the scalar loop.
+ */
+void seraph_galactic_sqrt_n(Seraph_Galactic_Lanes dst, Seraph_Galactic_Lanes x,
+                            size_t count);
+
 /*============================================================================
  * Galactic Prediction (Physics Integration)
  *============================================================================*/
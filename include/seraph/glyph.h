@@ -567,6 +567,163 @@ static inline Seraph_Q128 seraph_sdf_gradient_magnitude(Seraph_SDF_Result r) {
     return seraph_q128_sqrt(seraph_q128_add(gx2, gy2));
 }
 
+/*============================================================================
+ * Shape Programs
+ *============================================================================
+ *
+ * A composed glyph as data: its shape tree in postfix order. Primitives
+ * push a result, boolean operations pop two and push one, NEGATE and
+ * OFFSET rewrite the top. This is what the distance cache keys and bakes;
+ * seraph_sdf_shape_eval runs it analytically for hit testing.
+ */
+
+/** Deepest operand stack a shape program may use */
+#define SERAPH_SDF_SHAPE_STACK 16
+
+/**
+ * @brief Shape program operations
+ */
+typedef enum {
+    SERAPH_SDF_OP_CIRCLE = 0,           /**< cx, cy, radius */
+    SERAPH_SDF_OP_BOX,                  /**< half_width, half_height */
+    SERAPH_SDF_OP_ROUNDED_BOX,          /**< half_width, half_height, corner_radius */
+    SERAPH_SDF_OP_LINE,                 /**< x1, y1, x2, y2, thickness */
+    SERAPH_SDF_OP_RING,                 /**< cx, cy, radius, thickness */
+    SERAPH_SDF_OP_TRIANGLE,             /**< x1, y1, x2, y2, x3, y3 */
+    SERAPH_SDF_OP_UNION,
+    SERAPH_SDF_OP_INTERSECT,
+    SERAPH_SDF_OP_SUBTRACT,             /**< below minus top */
+    SERAPH_SDF_OP_XOR,
+    SERAPH_SDF_OP_SMOOTH_UNION,         /**< k */
+    SERAPH_SDF_OP_SMOOTH_SUBTRACT,      /**< k */
+    SERAPH_SDF_OP_SMOOTH_INTERSECT,     /**< k */
+    SERAPH_SDF_OP_NEGATE,
+    SERAPH_SDF_OP_OFFSET                /**< amount */
+} Seraph_SDF_Op;
+
+/**
+ * @brief One step of a shape program; unused parameters should be zero
+ */
+typedef struct {
+    Seraph_SDF_Op op;
+    Seraph_Q128 p[6];
+} Seraph_SDF_Node;
+
+/**
+ * @brief Evaluate a shape program at a point
+ * @return The shape's SDF, or SERAPH_SDF_VOID if the program is malformed
+ */
+Seraph_SDF_Result seraph_sdf_shape_eval(
+    const Seraph_SDF_Node* nodes,
+    uint32_t count,
+    Seraph_Glyph_Point p
+);
+
+/**
+ * @brief 64-bit hash of a shape program (operations and parameters)
+ */
+uint64_t seraph_sdf_shape_hash(const Seraph_SDF_Node* nodes, uint32_t count);
+
+/*============================================================================
+ * Glyph Distance Cache
+ *============================================================================
+ *
+ * Evaluating the analytic SDF per pixel costs Q128 divides and square
+ * roots at every sample. The cache bakes a shape program once over a
+ * square frame of shape space into a SERAPH_GLYPH_CACHE_RES^2 texture of
+ * Q16 distances, measured in texels so the texture is scale-free, and
+ * renders from it with bilinear interpolation in fixed point.
+ *
+ * Entries are keyed by the shape hash mixed with the frame and replaced
+ * least-recently-used first. Texels hold distances sampled at their
+ * centers, so detail finer than a texel (sharp inner corners, thin
+ * strokes) is softened; hit testing stays on seraph_sdf_shape_eval.
+ */
+
+/** Texels per side of a baked distance texture */
+#ifndef SERAPH_GLYPH_CACHE_RES
+#define SERAPH_GLYPH_CACHE_RES 32
+#endif
+
+/** Baked textures kept */
+#ifndef SERAPH_GLYPH_CACHE_SLOTS
+#define SERAPH_GLYPH_CACHE_SLOTS 32
+#endif
+
+/**
+ * @brief One baked distance texture
+ */
+typedef struct {
+    uint64_t key;                       /**< Shape + frame hash, 0 if empty */
+    uint64_t last_used;                 /**< Cache tick of the last lookup */
+    Seraph_Q128 min_x;                  /**< Frame corner in shape space */
+    Seraph_Q128 min_y;
+    Seraph_Q128 size;                   /**< Frame side in shape space */
+    int32_t dist[SERAPH_GLYPH_CACHE_RES * SERAPH_GLYPH_CACHE_RES]; /**< Q16 texels, row-major */
+} Seraph_Glyph_Cache_Entry;
+
+/**
+ * @brief Glyph distance cache
+ */
+typedef struct {
+    Seraph_Glyph_Cache_Entry entries[SERAPH_GLYPH_CACHE_SLOTS];
+    uint64_t tick;
+    uint32_t hits;                      /**< Lookups served from a texture */
+    uint32_t misses;                    /**< Lookups that baked */
+    uint32_t evictions;                 /**< Bakes that replaced a live texture */
+} Seraph_Glyph_Cache;
+
+/**
+ * @brief Empty the cache
+ */
+void seraph_glyph_cache_init(Seraph_Glyph_Cache* cache);
+
+/**
+ * @brief Find or bake the texture for a shape over a frame
+ *
+ * The frame is the square [min_x, min_x + size) x [min_y, min_y + size).
+ *
+ * @return The entry (valid until the next lookup that misses), or NULL if
+ *         the arguments are VOID, the size is not positive, or the shape
+ *         program is malformed
+ */
+const Seraph_Glyph_Cache_Entry* seraph_glyph_cache_lookup(
+    Seraph_Glyph_Cache* cache,
+    const Seraph_SDF_Node* nodes,
+    uint32_t count,
+    Seraph_Q128 min_x,
+    Seraph_Q128 min_y,
+    Seraph_Q128 size
+);
+
+/**
+ * @brief Bilinear distance at a point of the texture
+ *
+ * Coordinates are Q16 texels with texel (0, 0)'s center at the origin.
+ * Outside the texture the edge value grows by the distance past it.
+ *
+ * @return Signed distance in Q16 texels
+ */
+int32_t seraph_glyph_cache_sample(
+    const Seraph_Glyph_Cache_Entry* entry,
+    int32_t u,
+    int32_t v
+);
+
+/**
+ * @brief Render a baked glyph as coverage over size x size pixels
+ *
+ * The frame maps onto the whole output; coverage is the same smoothstep
+ * over half a pixel either side of the edge as seraph_glyph_coverage,
+ * as 0..255.
+ */
+void seraph_glyph_cache_rasterize(
+    const Seraph_Glyph_Cache_Entry* entry,
+    uint8_t* coverage,
+    uint32_t size,
+    uint32_t stride
+);
+
 /*============================================================================
  * Utility: Q128 from double (helper for glyph operations)
  *============================================================================*/
@@ -31,6 +31,8 @@
 #ifndef SERAPH_HARMONICS_H
 #define SERAPH_HARMONICS_H
 
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 #include "seraph/q16_trig.h"
 
@@ -256,7 +258,9 @@ Q16 seraph_harmonic16_triangle(Q16 theta, int num_harmonics);
  * Generates W_N^k = exp(-2πik/N) = cos(2πk/N) - i·sin(2πk/N)
  * for k = 0, 1, ..., N/2-1.
  *
- * Uses harmonic generator for efficient computation.
+ * Each factor is evaluated directly at Q32.32 precision on the first
+ * octant and rounded, so the table is exact to half an LSB and has
+ * exact quadrant symmetry (a recurrence would drift with N).
  *
  * @param N FFT size (must be power of 2)
  * @param cos_out Output: cos twiddle factors (size: N/2)
@@ -264,6 +268,147 @@ Q16 seraph_harmonic16_triangle(Q16 theta, int num_harmonics);
  */
 void seraph_harmonic16_fft_twiddles(int N, Q16* cos_out, Q16* sin_out);
 
+/**
+ * @brief Q32.32 twiddle factors, same layout as the Q16 table
+ *
+ * @param N FFT size (must be power of 2)
+ * @param cos_out Output: cos(2πk/N) in Q32.32 (size: N/2)
+ * @param sin_out Output: -sin(2πk/N) in Q32.32 (size: N/2)
+ */
+void seraph_harmonic32_fft_twiddles(int N, int64_t* cos_out, int64_t* sin_out);
+
+/**
+ * @brief Power |F(k)|² of a single DFT bin, O(N)
+ *
+ * For a whole spectrum use seraph_fft16_real, which is O(N log N).
+ *
+ * @param signal Input samples
+ * @param length Number of samples (N)
+ * @param k Bin index
+ * @return Power, scaled down by 2^16 to stay in range
+ */
+Q16 seraph_harmonic16_power_at(const Q16* signal, size_t length, int k);
+
+/*============================================================================
+ * Fixed-Point FFT
+ *
+ * In-place radix-4 decimation-in-time transforms (with one radix-2 pass
+ * when log2(N) is odd) over split real/imaginary arrays. Integer only.
+ *
+ * Block floating point: the data is first normalized to use the full
+ * word, and before every pass the whole block is shifted right just far
+ * enough that the pass cannot overflow. The transforms report the net
+ * shift as an exponent e: the true spectrum is out[k] · 2^e.
+ *============================================================================*/
+
+/** Largest supported transform: 2^SERAPH_FFT_MAX_LOG2 points */
+#define SERAPH_FFT_MAX_LOG2 16
+
+/**
+ * @brief Q16 FFT plan
+ *
+ * The twiddle tables are caller-owned (N/2 entries each) so the plan
+ * needs no allocator; one plan can be shared by any number of channels.
+ */
+typedef struct {
+    int        n;          /**< Transform size (power of 2) */
+    int        log2n;      /**< log2(n) */
+    const Q16* cos_tw;     /**< cos(2πk/n), k < n/2 */
+    const Q16* sin_tw;     /**< -sin(2πk/n), k < n/2 */
+} Seraph_FFT16;
+
+/**
+ * @brief Q32.32 FFT plan (butterflies use seraph_q32_mul)
+ */
+typedef struct {
+    int            n;      /**< Transform size (power of 2) */
+    int            log2n;  /**< log2(n) */
+    const int64_t* cos_tw; /**< cos(2πk/n) in Q32.32, k < n/2 */
+    const int64_t* sin_tw; /**< -sin(2πk/n) in Q32.32, k < n/2 */
+} Seraph_FFT32;
+
+/**
+ * @brief Build a Q16 plan, filling the twiddle tables
+ *
+ * @param fft Plan to initialize
+ * @param n Transform size, a power of 2 from 2 to 2^SERAPH_FFT_MAX_LOG2
+ * @param cos_tw Storage for n/2 cos twiddles
+ * @param sin_tw Storage for n/2 sin twiddles
+ * @return false if n is not a supported size
+ */
+bool seraph_fft16_init(Seraph_FFT16* fft, int n, Q16* cos_tw, Q16* sin_tw);
+
+/**
+ * @brief In-place forward FFT of n complex Q16 samples
+ *
+ * X[k] = Σ x[j]·exp(-2πijk/n) = (re[k] + i·im[k]) · 2^exponent.
+ *
+ * @param fft Plan
+ * @param re Real parts (n entries), replaced by the spectrum
+ * @param im Imaginary parts (n entries), replaced by the spectrum
+ * @param exponent Output: block exponent of the result
+ * @return false on invalid arguments (data untouched)
+ */
+bool seraph_fft16_forward(const Seraph_FFT16* fft, Q16* re, Q16* im, int* exponent);
+
+/**
+ * @brief In-place inverse FFT, including the 1/n factor
+ *
+ * x[j] = (1/n)·Σ X[k]·exp(2πijk/n) = (re[j] + i·im[j]) · 2^exponent.
+ */
+bool seraph_fft16_inverse(const Seraph_FFT16* fft, Q16* re, Q16* im, int* exponent);
+
+/**
+ * @brief Forward FFT of n real samples
+ *
+ * Runs one n/2-point complex transform on the samples packed as
+ * (even, odd) pairs and splits the result, so it costs about half of
+ * seraph_fft16_forward. Only bins 0..n/2 are produced; the rest are
+ * their conjugates. Requires n >= 4.
+ *
+ * @param fft Plan for n points
+ * @param x Input samples (n entries, not modified)
+ * @param re Output: real parts of bins 0..n/2 (n/2 + 1 entries)
+ * @param im Output: imaginary parts of bins 0..n/2 (n/2 + 1 entries)
+ * @param exponent Output: block exponent of the result
+ */
+bool seraph_fft16_real(const Seraph_FFT16* fft, const Q16* x,
+                       Q16* re, Q16* im, int* exponent);
+
+/**
+ * @brief Forward FFT of several channels with one plan
+ *
+ * Channel c occupies re[c·n .. c·n + n - 1] (likewise im) and gets its
+ * own exponent, so a loud channel does not cost a quiet one precision.
+ */
+bool seraph_fft16_forward_batch(const Seraph_FFT16* fft, Q16* re, Q16* im,
+                                size_t channels, int* exponents);
+
+/**
+ * @brief Real-input FFT of several channels with one plan
+ *
+ * Channel c reads x[c·n ..] and writes bins to re/im[c·(n/2 + 1) ..].
+ */
+bool seraph_fft16_real_batch(const Seraph_FFT16* fft, const Q16* x,
+                             Q16* re, Q16* im, size_t channels, int* exponents);
+
+/**
+ * @brief Build a Q32.32 plan, filling the twiddle tables
+ */
+bool seraph_fft32_init(Seraph_FFT32* fft, int n, int64_t* cos_tw, int64_t* sin_tw);
+
+/**
+ * @brief In-place forward FFT of n complex Q32.32 samples
+ */
+bool seraph_fft32_forward(const Seraph_FFT32* fft, int64_t* re, int64_t* im,
+                          int* exponent);
+
+/**
+ * @brief In-place inverse Q32.32 FFT, including the 1/n factor
+ */
+bool seraph_fft32_inverse(const Seraph_FFT32* fft, int64_t* re, int64_t* im,
+                          int* exponent);
+
 /*============================================================================
  * Stability and Accuracy
  *============================================================================*/
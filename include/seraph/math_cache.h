@@ -19,13 +19,20 @@
  *   - Each entry: key + value
  *   - Valid bits stored separately for cache efficiency
  *   - Direct-mapped: index = hash(key) & (size-1)
+ *
+ * The memo cache (Seraph_Memo_Cache) trades the constant-time property for
+ * throughput: it is set-associative, lives in a caller's arena, and skips
+ * the computation on a hit. The cached trig/sqrt entry points use it.
  */
 
 #ifndef SERAPH_MATH_CACHE_H
 #define SERAPH_MATH_CACHE_H
 
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <string.h>
+#include "seraph/arena.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -172,11 +179,9 @@ static inline void seraph_q16_trig_cache_lookup(
     entry->cos_val = *cos_out;
     entry->valid = 1;
 
-    /* Update stats (these can be removed in release builds) */
-#ifdef SERAPH_CACHE_STATS
+    /* Update stats (two adds, always on) */
     cache->hits += hit;
     cache->misses += !hit;
-#endif
 }
 
 /*============================================================================
@@ -213,86 +218,243 @@ static inline void seraph_q64_trig_cache_init(Seraph_Q64_Trig_Cache* cache) {
 }
 
 /*============================================================================
- * Generic Value Cache (LRU)
+ * Set-Associative Memo Cache
+ *
+ * Maps (function tag, uint64_t key) -> uint64_t. A key hashes to one set
+ * of `ways` entries, so keys that collide in a direct-mapped table coexist
+ * until the set overflows; then a fill replaces a pseudo-randomly chosen
+ * way. Several functions can share one cache by using different tags.
+ *
+ * A cache belongs to one strand (no locking); shard by creating one per
+ * strand. Hit, miss and eviction counters are always maintained.
  *============================================================================*/
 
+/** Largest supported associativity */
+#define SERAPH_MEMO_MAX_WAYS 4
+
+/** Function tags of the built-in cached functions (0 marks an empty entry) */
+#define SERAPH_MEMO_TAG_Q16_SINCOS  1u
+#define SERAPH_MEMO_TAG_Q16_SQRT    2u
+#define SERAPH_MEMO_TAG_Q16_REDUCE  3u
+#define SERAPH_MEMO_TAG_USER        0x100u  /**< First tag for caller functions */
+
 /**
- * @brief Generic memoization cache for single-argument functions
- *
- * Maps uint64_t -> uint64_t with direct-mapped caching.
+ * @brief Memo cache entry
  */
 typedef struct {
-    uint64_t keys[SERAPH_MATH_CACHE_SIZE];
-    uint64_t values[SERAPH_MATH_CACHE_SIZE];
-    uint8_t valid[SERAPH_MATH_CACHE_SIZE / 8 + 1];  /* Packed valid bits */
+    uint64_t key;       /**< Input */
+    uint64_t value;     /**< Memoized result */
+} Seraph_Memo_Entry;
+
+/**
+ * @brief Set-associative memo cache (storage from an arena or static)
+ */
+typedef struct {
+    Seraph_Memo_Entry* entries; /**< sets * ways, set-major */
+    uint32_t* tags;             /**< Function tag per entry, 0 if empty */
+    uint32_t  set_mask;         /**< sets - 1 */
+    uint32_t  ways;             /**< 1, 2 or 4 */
+    uint32_t  tag;              /**< Tag used by seraph_memo_cache_lookup */
+    uint64_t  hits;             /**< Lookups answered from the cache */
+    uint64_t  misses;           /**< Lookups that had to compute */
+    uint64_t  evictions;        /**< Fills that displaced a valid entry */
 } Seraph_Memo_Cache;
 
 /**
- * @brief Initialize memo cache
+ * @brief Snapshot of a memo cache's counters
  */
-static inline void seraph_memo_cache_init(Seraph_Memo_Cache* cache) {
-    memset(cache, 0, sizeof(*cache));
+typedef struct {
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t evictions;
+    uint32_t occupied;  /**< Valid entries */
+    uint32_t capacity;  /**< Total entries */
+} Seraph_Memo_Stats;
+
+/**
+ * @brief Compute function for memoization
+ */
+typedef uint64_t (*Seraph_Compute_Fn)(uint64_t key);
+
+/**
+ * @brief Initialize a memo cache over caller storage
+ *
+ * @param cache The cache
+ * @param entries Storage for capacity entries
+ * @param tags Storage for capacity tags
+ * @param capacity Entries; power of 2 and a multiple of ways
+ * @param ways Associativity: 1, 2 or 4
+ * @param tag Default function tag (non-zero)
+ * @return true on success, false if the geometry or tag is invalid
+ */
+bool seraph_memo_cache_init(Seraph_Memo_Cache* cache, Seraph_Memo_Entry* entries,
+                            uint32_t* tags, uint32_t capacity, uint32_t ways,
+                            uint32_t tag);
+
+/**
+ * @brief Create a memo cache in an arena
+ *
+ * @param arena Arena providing the cache and its storage
+ * @param capacity Requested entries, rounded up to a power of 2 >= ways
+ * @param ways Associativity: 1, 2 or 4
+ * @param tag Default function tag (non-zero)
+ * @return The cache, or NULL if the arguments are invalid or the arena is full
+ */
+Seraph_Memo_Cache* seraph_memo_cache_create(Seraph_Arena* arena, uint32_t capacity,
+                                            uint32_t ways, uint32_t tag);
+
+/**
+ * @brief Drop all entries (counters are kept)
+ */
+void seraph_memo_cache_clear(Seraph_Memo_Cache* cache);
+
+/**
+ * @brief First entry index of the set holding (tag, key)
+ */
+static inline uint32_t seraph_memo_cache_set(const Seraph_Memo_Cache* cache,
+                                             uint32_t tag, uint64_t key) {
+    uint64_t h = seraph_cache_hash64(key ^ ((uint64_t)tag << 48));
+    return (uint32_t)(h & cache->set_mask) * cache->ways;
+}
+
+/**
+ * @brief All-ones if entry i of a set holds (tag, key), else zero
+ */
+static inline uint64_t seraph_memo_way_match(const Seraph_Memo_Entry* set,
+                                             const uint32_t* tags, uint32_t i,
+                                             uint32_t tag, uint64_t key) {
+    uint64_t eq = (uint64_t)(tags[i] == tag) & (uint64_t)(set[i].key == key);
+    return (uint64_t)0 - eq;
 }
 
 /**
- * @brief Check if entry is valid (branchless bit extraction)
+ * @brief Find (tag, key) without computing or counting
+ *
+ * Which way matches is random per key, so the ways are combined with
+ * masks rather than searched with branches. All SERAPH_MEMO_MAX_WAYS slots
+ * are checked; narrower sets alias the extra slots onto their own ways.
+ *
+ * @return true and *value if present
  */
-static inline int seraph_memo_cache_valid(const Seraph_Memo_Cache* cache, uint32_t idx) {
-    return (cache->valid[idx / 8] >> (idx % 8)) & 1;
+static inline bool seraph_memo_cache_find(const Seraph_Memo_Cache* cache, uint32_t tag,
+                                          uint64_t key, uint64_t* value) {
+    uint32_t base = seraph_memo_cache_set(cache, tag, key);
+    const Seraph_Memo_Entry* set = &cache->entries[base];
+    const uint32_t* tags = &cache->tags[base];
+    uint32_t wm = cache->ways - 1;
+
+    uint64_t m0 = seraph_memo_way_match(set, tags, 0, tag, key);
+    uint64_t m1 = seraph_memo_way_match(set, tags, 1 & wm, tag, key);
+    uint64_t m2 = seraph_memo_way_match(set, tags, 2 & wm, tag, key);
+    uint64_t m3 = seraph_memo_way_match(set, tags, 3 & wm, tag, key);
+
+    *value = (set[0].value & m0) | (set[1 & wm].value & m1) |
+             (set[2 & wm].value & m2) | (set[3 & wm].value & m3);
+    return (m0 | m1 | m2 | m3) != 0;
 }
 
 /**
- * @brief Set entry valid bit
+ * @brief Look up (tag, key) without computing
+ *
+ * Counts a hit or a miss. A hit writes nothing else back.
+ *
+ * @return true and *value on a hit, false on a miss
  */
-static inline void seraph_memo_cache_set_valid(Seraph_Memo_Cache* cache, uint32_t idx) {
-    cache->valid[idx / 8] |= (1 << (idx % 8));
+static inline bool seraph_memo_cache_probe(Seraph_Memo_Cache* cache, uint32_t tag,
+                                           uint64_t key, uint64_t* value) {
+    bool hit = seraph_memo_cache_find(cache, tag, key, value);
+    cache->hits += hit;
+    cache->misses += !hit;
+    return hit;
 }
 
 /**
- * @brief Lookup or compute (branchless)
+ * @brief Insert (tag, key) -> value
+ *
+ * Takes the first empty way of the set; a full set gives up the way the
+ * miss counter selects, a pseudo-random choice that needs no per-entry
+ * age bits and costs hits nothing. The caller must have just missed on
+ * the same key.
+ */
+static inline void seraph_memo_cache_fill(Seraph_Memo_Cache* cache, uint32_t tag,
+                                          uint64_t key, uint64_t value) {
+    uint32_t base = seraph_memo_cache_set(cache, tag, key);
+    uint32_t* tags = &cache->tags[base];
+    uint32_t victim = (uint32_t)cache->misses & (cache->ways - 1);
+
+    for (uint32_t w = cache->ways; w-- > 0;) {
+        if (tags[w] == 0) victim = w;
+    }
+    cache->evictions += tags[victim] != 0;
+    cache->entries[base + victim].key = key;
+    cache->entries[base + victim].value = value;
+    tags[victim] = tag;
+}
+
+/**
+ * @brief Lookup or compute under an explicit function tag
+ */
+static inline uint64_t seraph_memo_cache_lookup_tagged(Seraph_Memo_Cache* cache,
+                                                       uint32_t tag, uint64_t key,
+                                                       Seraph_Compute_Fn compute) {
+    uint64_t value;
+    if (!seraph_memo_cache_probe(cache, tag, key, &value)) {
+        value = compute(key);
+        seraph_memo_cache_fill(cache, tag, key, value);
+    }
+    return value;
+}
+
+/**
+ * @brief Lookup or compute under the cache's own tag
  *
  * @param cache The cache
  * @param key Input key
  * @param compute Function to compute value if not cached
  * @return Cached or computed value
  */
-typedef uint64_t (*Seraph_Compute_Fn)(uint64_t key);
-
-static inline uint64_t seraph_memo_cache_lookup(
-    Seraph_Memo_Cache* cache,
-    uint64_t key,
-    Seraph_Compute_Fn compute)
-{
-    uint32_t idx = (uint32_t)(seraph_cache_hash64(key) & SERAPH_MATH_CACHE_MASK);
-
-    int valid = seraph_memo_cache_valid(cache, idx);
-    int hit = valid && (cache->keys[idx] == key);
-
-    /* Always compute (branchless) */
-    uint64_t computed = compute(key);
+static inline uint64_t seraph_memo_cache_lookup(Seraph_Memo_Cache* cache,
+                                                uint64_t key,
+                                                Seraph_Compute_Fn compute) {
+    return seraph_memo_cache_lookup_tagged(cache, cache->tag, key, compute);
+}
 
-    /* Select cached or computed */
-    uint64_t result = seraph_select64(hit, cache->values[idx], computed);
+/**
+ * @brief Batched lookup-or-compute under the cache's own tag
+ *
+ * Same results and counters as seraph_memo_cache_lookup per key; a key
+ * repeated later in the batch hits the entry its first copy filled.
+ *
+ * @param cache The cache
+ * @param keys Inputs
+ * @param values Output: one result per key
+ * @param count Number of keys
+ * @param compute Function to compute missing values
+ * @return Number of keys answered from the cache
+ */
+size_t seraph_memo_cache_lookup_n(Seraph_Memo_Cache* cache, const uint64_t* keys,
+                                  uint64_t* values, size_t count,
+                                  Seraph_Compute_Fn compute);
 
-    /* Update cache */
-    cache->keys[idx] = key;
-    cache->values[idx] = result;
-    seraph_memo_cache_set_valid(cache, idx);
+/**
+ * @brief Read the counters and occupancy
+ */
+void seraph_memo_cache_stats(const Seraph_Memo_Cache* cache, Seraph_Memo_Stats* stats);
 
-    return result;
-}
+/**
+ * @brief Zero the hit, miss and eviction counters
+ */
+void seraph_memo_cache_reset_stats(Seraph_Memo_Cache* cache);
 
 /*============================================================================
  * Cache Statistics
  *============================================================================*/
 
-#ifdef SERAPH_CACHE_STATS
-
 /**
  * @brief Get Q16 cache hit rate
  */
 static inline double seraph_q16_cache_hit_rate(const Seraph_Q16_Trig_Cache* cache) {
-    uint64_t total = cache->hits + cache->misses;
+    uint64_t total = (uint64_t)cache->hits + cache->misses;
     if (total == 0) return 0.0;
     return (double)cache->hits / (double)total;
 }
@@ -305,8 +467,6 @@ static inline void seraph_q16_cache_reset_stats(Seraph_Q16_Trig_Cache* cache) {
     cache->misses = 0;
 }
 
-#endif /* SERAPH_CACHE_STATS */
-
 /*============================================================================
  * Thread-Local Caches
  *============================================================================*/
@@ -323,6 +483,62 @@ Seraph_Q16_Trig_Cache* seraph_q16_trig_cache_get(void);
  */
 Seraph_Q64_Trig_Cache* seraph_q64_trig_cache_get(void);
 
+/**
+ * @brief Get the thread-local memo cache behind the *_cached functions
+ *
+ * 4-way, SERAPH_MATH_CACHE_SIZE * 4 entries, shared by sincos, sqrt and
+ * angle reduction under their SERAPH_MEMO_TAG_Q16_* tags.
+ */
+Seraph_Memo_Cache* seraph_math_memo_get(void);
+
+/*============================================================================
+ * Cached Q16 Functions
+ *
+ * Q16 is int32_t; declared with the underlying type so this header does
+ * not pull in q16_trig.h.
+ *============================================================================*/
+
+/**
+ * @brief sin and cos of angle through the thread-local memo cache
+ */
+void seraph_q16_sincos_cached(int32_t angle, int32_t* sin_out, int32_t* cos_out);
+
+/**
+ * @brief Batched seraph_q16_sincos_cached
+ *
+ * Same results and counters as seraph_q16_sincos_cached per angle, with
+ * the thread-local cache resolved once and q16_sincos inlined on misses.
+ *
+ * @param angles Input angles in Q16.16 radians
+ * @param sin_out Output: sin per angle
+ * @param cos_out Output: cos per angle
+ * @param count Number of angles
+ * @return Number of angles answered from the cache
+ */
+size_t seraph_q16_sincos_cached_n(const int32_t* angles, int32_t* sin_out,
+                                  int32_t* cos_out, size_t count);
+
+int32_t seraph_q16_sin_cached(int32_t angle);
+int32_t seraph_q16_cos_cached(int32_t angle);
+int32_t seraph_q16_sqrt_cached(int32_t x);
+int32_t seraph_q16_reduce_cached(int32_t angle, int* quadrant);
+
+/**
+ * @brief Pre-populate the memo cache with 256 evenly spaced angles
+ */
+void seraph_q16_cache_warm(void);
+
+/**
+ * @brief Pre-populate the memo cache with specific angles
+ */
+void seraph_q16_cache_warm_angles(const int32_t* angles, size_t count);
+
+/**
+ * @brief Counters of the thread-local memo cache
+ */
+void seraph_q16_cache_info(uint32_t* hits, uint32_t* misses,
+                           uint32_t* occupied, uint32_t* capacity);
+
 #ifdef __cplusplus
 }
 #endif
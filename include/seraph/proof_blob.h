@@ -10,7 +10,8 @@
  *
  *   1. PROOF BLOB FORMAT: A relocatable binary structure containing:
  *      - Header with magic, version, and offsets
- *      - Hash index for O(1) proof lookup by code location
+ *      - Open-addressed hash index for O(1) proof lookup by code location
+ *      - Bloom filter answering "no proof here" without touching the index
  *      - Packed proof records
  *      - SHA-256 integrity checksum
  *
@@ -27,7 +28,8 @@
  *      - Statistics track how many checks were performed vs skipped
  *
  * PERFORMANCE:
- *   - Proof lookup: ~5 cycles (hash + array access)
+ *   - Proof lookup: ~5 cycles (hash + one cache line)
+ *   - Missing proof: one Bloom filter word, usually no index access
  *   - Proven access: 0 cycles (no check generated)
  *   - Runtime check: ~15-50 cycles (varies by check type)
  *
@@ -62,18 +64,21 @@ extern "C" {
 /** Magic bytes: "SRPHPROF" */
 #define SERAPH_PROOF_BLOB_MAGIC     0x464F525048505253ULL
 
-/** Current version: 1.0.0 */
-#define SERAPH_PROOF_BLOB_VERSION   0x00010000
+/** Current version: 2.0.0 (open-addressed index and Bloom filter) */
+#define SERAPH_PROOF_BLOB_VERSION   0x00020000
 
 /** Maximum proofs in a single blob */
 #define SERAPH_PROOF_BLOB_MAX_PROOFS    65536
 
-/** Minimum bucket count for hash index */
+/** Minimum slot count for hash index (power of two) */
 #define SERAPH_PROOF_BLOB_MIN_BUCKETS   16
 
-/** Empty bucket sentinel */
+/** Empty slot sentinel (proof_index of an unused slot) */
 #define SERAPH_PROOF_BLOB_EMPTY_BUCKET  0xFFFFFFFF
 
+/** Bloom filter bits per proof (~1% false positives at 3 bits/key) */
+#define SERAPH_PROOF_BLOB_BLOOM_BITS_PER_PROOF  16
+
 /** SHA-256 checksum size */
 #define SERAPH_PROOF_BLOB_CHECKSUM_SIZE 32
 
@@ -98,34 +103,41 @@ extern "C" {
  *============================================================================*/
 
 /**
- * @brief Proof blob header (64 bytes, fixed size)
+ * @brief Proof blob header (72 bytes, fixed size)
  *
- * Located at offset 0 of the blob.
+ * Located at offset 0 of the blob. The index region at index_offset
+ * holds bucket_count slots followed by bloom_words 64-bit filter words.
  */
 typedef struct __attribute__((packed)) {
     uint64_t magic;             /**< SERAPH_PROOF_BLOB_MAGIC */
     uint32_t version;           /**< SERAPH_PROOF_BLOB_VERSION */
     uint32_t flags;             /**< Blob flags */
     uint32_t proof_count;       /**< Number of proofs */
-    uint32_t bucket_count;      /**< Hash index bucket count */
+    uint32_t bucket_count;      /**< Index slot count (power of two) */
     uint64_t index_offset;      /**< Offset to hash index */
     uint64_t proofs_offset;     /**< Offset to proof records */
     uint64_t checksum_offset;   /**< Offset to SHA-256 checksum */
     uint64_t module_hash;       /**< Hash of source module */
     uint64_t generation;        /**< Proof generation timestamp */
-    uint8_t  reserved[8];       /**< Reserved for future use */
+    uint32_t bloom_words;       /**< Bloom filter words (power of two) */
+    uint8_t  reserved[4];       /**< Reserved for future use */
 } Seraph_Proof_Blob_Header;
 
 /**
- * @brief Hash index entry (16 bytes)
+ * @brief Hash index slot (16 bytes, four per cache line)
  *
- * Maps code location hash to proof record index.
+ * Open addressing with linear probing from (code_hash & (bucket_count-1)).
+ * Kind and status are stored inline so a query never touches the proof
+ * records. One slot per (code_hash, kind); unused slots have
+ * proof_index == SERAPH_PROOF_BLOB_EMPTY_BUCKET.
  */
 typedef struct __attribute__((packed)) {
     uint64_t code_hash;         /**< Hash of code location */
     uint32_t proof_index;       /**< Index into proofs array */
-    uint32_t next;              /**< Next entry in chain (for collisions) */
-} Seraph_Proof_Blob_Index_Entry;
+    uint8_t  kind;              /**< Seraph_Proof_Kind */
+    uint8_t  status;            /**< Seraph_Proof_Status */
+    uint16_t reserved;
+} Seraph_Proof_Blob_Slot;
 
 /**
  * @brief Packed proof record (40 bytes)
@@ -184,16 +196,24 @@ typedef struct __attribute__((packed)) {
  *
  * This structure wraps a loaded proof blob and provides efficient access.
  * It does NOT own the underlying memory - the blob must remain valid.
+ * Queries never write to it, so one loaded blob can be shared by any
+ * number of threads; query statistics are kept per thread instead.
  */
 typedef struct {
     /** Pointer to blob header */
     const Seraph_Proof_Blob_Header* header;
 
-    /** Pointer to bucket array */
-    const uint32_t* buckets;
+    /** Pointer to index slots */
+    const Seraph_Proof_Blob_Slot* slots;
 
-    /** Pointer to index entries */
-    const Seraph_Proof_Blob_Index_Entry* entries;
+    /** Pointer to Bloom filter words */
+    const uint64_t* bloom;
+
+    /** Slot count - 1 */
+    uint32_t slot_mask;
+
+    /** Bloom word count - 1 */
+    uint32_t bloom_mask;
 
     /** Pointer to proof records */
     const Seraph_Proof_Blob_Record* proofs;
@@ -206,11 +226,6 @@ typedef struct {
 
     /** Is blob verified? */
     bool verified;
-
-    /** Statistics */
-    uint64_t queries;
-    uint64_t hits;
-    uint64_t misses;
 } Seraph_Proof_Blob;
 
 /*============================================================================
@@ -319,7 +334,8 @@ uint64_t seraph_proof_string_hash(const char* str);
  * @param kind          Kind of proof to find
  * @return Proof status, or SKIPPED if not found
  *
- * Cost: ~5 cycles (single hash bucket lookup)
+ * Cost: ~5 cycles (Bloom word, then usually one index cache line).
+ * Counts into the calling thread's query statistics.
  */
 Seraph_Proof_Status seraph_proof_blob_query(
     const Seraph_Proof_Blob* blob,
@@ -530,6 +546,8 @@ size_t seraph_proof_blob_generate(
 
 /**
  * @brief Proof blob statistics
+ *
+ * queries/hits/misses are the calling thread's query counters.
  */
 typedef struct {
     uint64_t total_proofs;
@@ -542,6 +560,16 @@ typedef struct {
     uint64_t misses;
 } Seraph_Proof_Blob_Stats;
 
+/**
+ * @brief Per-thread query counters (all blobs queried by the thread)
+ */
+typedef struct {
+    uint64_t queries;
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t bloom_rejects;     /**< Misses answered by the Bloom filter */
+} Seraph_Proof_Blob_Query_Stats;
+
 /**
  * @brief Get statistics for a proof blob
  *
@@ -553,6 +581,18 @@ void seraph_proof_blob_stats(
     Seraph_Proof_Blob_Stats* stats
 );
 
+/**
+ * @brief Get the calling thread's query counters
+ *
+ * @param stats  Output counters
+ */
+void seraph_proof_blob_query_stats(Seraph_Proof_Blob_Query_Stats* stats);
+
+/**
+ * @brief Reset the calling thread's query counters
+ */
+void seraph_proof_blob_query_stats_reset(void);
+
 /**
  * @brief Print proof blob summary
  *
@@ -14,6 +14,7 @@
 #include "seraph/void.h"
 #include "seraph/vbit.h"
 #include "seraph/integers.h"
+#include "seraph/arena.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -222,10 +223,43 @@ Seraph_Q128 seraph_q128_mul(Seraph_Q128 a, Seraph_Q128 b);
 
 /**
  * @brief Divide two Q128 values
- * @return VOID if b is zero
+ *
+ * Integer-only and exact: the quotient is truncated toward zero.
+ *
+ * @return VOID if b is zero or the quotient does not fit in Q64.64
  */
 Seraph_Q128 seraph_q128_div(Seraph_Q128 a, Seraph_Q128 b);
 
+/**
+ * @brief Multiply kernel variants
+ */
+typedef enum {
+    SERAPH_Q128_IMPL_AUTO     = 0,  /**< BMI2+ADX when the CPU has them */
+    SERAPH_Q128_IMPL_PORTABLE = 1,  /**< 64x64->128 products in C */
+    SERAPH_Q128_IMPL_BMI2     = 2,  /**< MULX with ADCX/ADOX carry chains */
+} Seraph_Q128_Impl;
+
+/**
+ * @brief Check whether this CPU and build support a multiply variant
+ */
+bool seraph_q128_impl_supported(Seraph_Q128_Impl impl);
+
+/**
+ * @brief Force a multiply variant (for tests and benchmarks)
+ * @return true on success, false if the variant is not supported
+ */
+bool seraph_q128_set_impl(Seraph_Q128_Impl impl);
+
+/**
+ * @brief Multiply variant in use after AUTO resolution
+ */
+Seraph_Q128_Impl seraph_q128_get_impl(void);
+
+/**
+ * @brief Short name of a variant ("portable", "bmi2+adx", "auto")
+ */
+const char* seraph_q128_impl_name(Seraph_Q128_Impl impl);
+
 /**
  * @brief Negate Q128 value
  */
@@ -309,6 +343,93 @@ static inline Seraph_Q128 seraph_q128_clamp(Seraph_Q128 x, Seraph_Q128 lo, Serap
     return seraph_q128_min(seraph_q128_max(x, lo), hi);
 }
 
+/*============================================================================
+ * Q128 Batch Operations (Structure of Arrays)
+ *
+ * Batch kernels take the integer and fractional words in separate arrays,
+ * so AVX2 handles four values per register and the VOID checks of a
+ * whole batch run as vector compares. Every kernel gives bit-identical
+ * results to the scalar operation on each element. Destination lanes may
+ * alias source lanes.
+ *============================================================================*/
+
+/**
+ * @brief Q128 values split into hi and lo arrays
+ *
+ * Element i is { hi[i], lo[i] }.
+ */
+typedef struct {
+    int64_t*  hi;   /**< Integer parts */
+    uint64_t* lo;   /**< Fractional parts */
+} Seraph_Q128_Lanes;
+
+/**
+ * @brief Lanes starting at element index
+ */
+static inline Seraph_Q128_Lanes seraph_q128_lanes_at(Seraph_Q128_Lanes x, size_t index) {
+    return (Seraph_Q128_Lanes){ x.hi + index, x.lo + index };
+}
+
+/**
+ * @brief View two consecutive fields of an SoA array as Q128 lanes
+ *
+ * Field first_field holds hi and first_field + 1 holds lo, as produced by
+ * SERAPH_FIELD(T, q.hi), SERAPH_FIELD(T, q.lo) in the schema.
+ *
+ * @return TRUE on success, VOID if the array or fields are invalid
+ */
+Seraph_Vbit seraph_q128_lanes_from_soa(const Seraph_SoA_Array* array,
+                                       uint32_t first_field,
+                                       Seraph_Q128_Lanes* out);
+
+/**
+ * @brief Split count Q128 values into lanes
+ */
+void seraph_q128_lanes_scatter(Seraph_Q128_Lanes dst, const Seraph_Q128* src, size_t count);
+
+/**
+ * @brief Join count lane values back into Q128 values
+ */
+void seraph_q128_lanes_gather(Seraph_Q128* dst, Seraph_Q128_Lanes src, size_t count);
+
+/**
+ * @brief dst[i] = a[i] + b[i] (VOID on overflow)
+ */
+void seraph_q128_add_n(Seraph_Q128_Lanes dst, Seraph_Q128_Lanes a,
+                       Seraph_Q128_Lanes b, size_t count);
+
+/**
+ * @brief dst[i] = a[i] - b[i]
+ */
+void seraph_q128_sub_n(Seraph_Q128_Lanes dst, Seraph_Q128_Lanes a,
+                       Seraph_Q128_Lanes b, size_t count);
+
+/**
+ * @brief dst[i] = a[i] * b[i]
+ *
+ * No vector 64x64 multiply exists, so this is a tight scalar loop with
+ * the multiply variant resolved once per batch.
+ */
+void seraph_q128_mul_n(Seraph_Q128_Lanes dst, Seraph_Q128_Lanes a,
+                       Seraph_Q128_Lanes b, size_t count);
+
+/**
+ * @brief dst[i] = -x[i]
+ */
+void seraph_q128_neg_n(Seraph_Q128_Lanes dst, Seraph_Q128_Lanes x, size_t count);
+
+/**
+ * @brief out[i] = seraph_q128_lt(a[i], b[i])
+ */
+void seraph_q128_lt_n(Seraph_Q128_Lanes a, Seraph_Q128_Lanes b,
+                      Seraph_Vbit* out, size_t count);
+
+/**
+ * @brief out[i] = TRUE if x[i] is VOID, FALSE otherwise
+ * @return Number of VOID elements
+ */
+size_t seraph_q128_void_mask_n(Seraph_Q128_Lanes x, Seraph_Vbit* out, size_t count);
+
 /*============================================================================
  * Q128 Rounding
  *============================================================================*/
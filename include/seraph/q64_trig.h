@@ -5,20 +5,21 @@
  * MC26: SERAPH Performance Revolution - Pillar 2
  *
  * High-precision trigonometry using 256-entry micro-tables with
- * quadratic interpolation. Uses BMI2 for fast fixed-point multiply.
+ * angle-addition refinement. Uses BMI2 for fast fixed-point multiply.
  *
  * Design Philosophy:
  *   - First-octant tables only (2KB sin + 2KB cos)
  *   - Symmetry exploitation for full range
- *   - Quadratic interpolation for sub-index precision
+ *   - Short Taylor series for the offset from the nearest entry below
  *   - BMI2 MULX for 128-bit intermediate products
  *
- * Accuracy: Better than 2^-60 relative error.
+ * Accuracy: sin/cos within 5 · 2^-64 absolute.
  */
 
 #ifndef SERAPH_Q64_TRIG_H
 #define SERAPH_Q64_TRIG_H
 
+#include <stddef.h>
 #include <stdint.h>
 #include "seraph/bmi2_intrin.h"
 
@@ -174,8 +175,7 @@ extern const Q64 Q64_TRIG_STEP;
 /**
  * @brief Sin/cos lookup table entry
  *
- * Each entry stores sin and cos value plus first derivative
- * for quadratic interpolation.
+ * Each entry stores sin and cos value plus first derivative.
  */
 typedef struct {
     Q64 sin_val;        /**< sin(i * step) */
@@ -184,8 +184,8 @@ typedef struct {
     Q64 cos_deriv;      /**< d(cos)/dθ at this point */
 } Q64_Trig_Entry;
 
-/** The micro-table - first octant only (initialized via q64_trig_init) */
-extern Q64_Trig_Entry q64_trig_table[Q64_TRIG_TABLE_SIZE];
+/** The micro-table - first octant, both ends (initialized via q64_trig_init) */
+extern Q64_Trig_Entry q64_trig_table[Q64_TRIG_TABLE_SIZE + 1];
 
 /*============================================================================
  * Angle Reduction
@@ -209,7 +209,7 @@ Q64 q64_reduce_to_octant(Q64 angle, int* octant);
 /**
  * @brief Compute sin(x) in Q64.64 format
  *
- * Uses micro-table lookup with quadratic interpolation.
+ * Uses micro-table lookup with angle-addition refinement.
  * Exploits octant symmetry for full range.
  *
  * @param angle Angle in Q64.64 radians
@@ -236,6 +236,20 @@ Q64 q64_cos(Q64 angle);
  */
 void q64_sincos(Q64 angle, Q64* sin_out, Q64* cos_out);
 
+/**
+ * @brief Compute sin and cos of an array of angles
+ *
+ * Bit-identical to q64_sincos per element. Angles are reduced a batch at
+ * a time so the MULX products of neighbouring angles overlap, and the
+ * octant fix-up is done with masks instead of a switch.
+ *
+ * @param angles Angles in Q64.64 radians (may alias sin_out or cos_out)
+ * @param sin_out Output: sin per angle
+ * @param cos_out Output: cos per angle
+ * @param count Number of angles
+ */
+void q64_sincos_n(const Q64* angles, Q64* sin_out, Q64* cos_out, size_t count);
+
 /**
  * @brief Compute tan(x) = sin(x)/cos(x)
  *
@@ -275,13 +289,13 @@ Q64 q64_hypot(Q64 x, Q64 y);
  *============================================================================*/
 
 /**
- * @brief Quadratic interpolation for table lookup
+ * @brief First-octant sin/cos between table entries
  *
- * Given table index i and fractional offset t ∈ [0, 1]:
- *   f(i + t) ≈ f(i) + t*f'(i) + t²*(f(i+1) - f(i) - f'(i))/2
+ * Evaluates sin and cos of (index + frac) table steps by angle addition
+ * from entry index, the same refinement q64_sincos uses.
  *
- * @param table Pointer to table entries
- * @param index Integer table index
+ * @param table Pointer to table entries (q64_trig_table)
+ * @param index Integer table index, clamped to [0, Q64_TRIG_TABLE_SIZE]
  * @param frac Fractional offset in Q64.64 [0, 1)
  * @param sin_out Output: interpolated sin
  * @param cos_out Output: interpolated cos
@@ -297,7 +311,7 @@ void q64_interpolate(const Q64_Trig_Entry* table, int index,
  * @brief Initialize the trig tables
  *
  * Called once at startup to populate the lookup tables.
- * Uses high-precision CORDIC or polynomial to generate values.
+ * Entries come from Taylor series in 128-bit fractions, correctly rounded.
  */
 void q64_trig_init(void);
 
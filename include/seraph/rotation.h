@@ -30,6 +30,8 @@
 #ifndef SERAPH_ROTATION_H
 #define SERAPH_ROTATION_H
 
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 #include "seraph/q16_trig.h"
 #include "seraph/bmi2_intrin.h"
@@ -263,6 +265,79 @@ void seraph_oscillator16_generate(Seraph_Oscillator16* osc,
 void seraph_oscillator16_set_frequency(Seraph_Oscillator16* osc,
                                         uint32_t frequency);
 
+/*============================================================================
+ * Oscillator Bank (Structure of Arrays)
+ *
+ * Many oscillators stepped together. Each field lives in its own array,
+ * so eight oscillators advance per AVX2 vector (when the VBIT variant is
+ * AVX2). Lane i produces exactly the samples a Seraph_Oscillator16 with
+ * the same frequency would, with seraph_rotation16_normalize applied to
+ * every oscillator after each SERAPH_OSC_BANK_RENORM_INTERVAL steps.
+ *============================================================================*/
+
+/** Steps between renormalizations of the whole bank */
+#define SERAPH_OSC_BANK_RENORM_INTERVAL 256
+
+/** Q16 entries of storage a bank of count oscillators needs */
+#define SERAPH_OSC_BANK_STORAGE(count) (5 * (size_t)(count))
+
+/**
+ * @brief Oscillator bank state (arrays point into caller storage)
+ */
+typedef struct {
+    Q16*     sin_theta;     /**< Current sin(θ) per oscillator */
+    Q16*     cos_theta;     /**< Current cos(θ) per oscillator */
+    Q16*     sin_delta;     /**< sin(Δ) per oscillator */
+    Q16*     cos_delta;     /**< cos(Δ) per oscillator */
+    Q16*     amplitude;     /**< Output amplitude per oscillator */
+    size_t   count;         /**< Number of oscillators */
+    uint32_t sample_rate;   /**< Samples per second */
+    uint32_t since_renorm;  /**< Steps since the last renormalization */
+} Seraph_Oscillator_Bank16;
+
+/**
+ * @brief Initialize a bank, all oscillators starting at phase 0
+ *
+ * @param bank Bank to initialize
+ * @param storage SERAPH_OSC_BANK_STORAGE(count) Q16 entries
+ * @param count Number of oscillators
+ * @param frequencies Frequency in Hz per oscillator
+ * @param sample_rate Sample rate in Hz
+ * @param amplitude Output amplitude for every oscillator (Q16)
+ * @return false on invalid arguments
+ */
+bool seraph_oscillator_bank16_init(Seraph_Oscillator_Bank16* bank, Q16* storage,
+                                   size_t count, const uint32_t* frequencies,
+                                   uint32_t sample_rate, Q16 amplitude);
+
+/**
+ * @brief Change one oscillator's frequency, keeping its phase
+ */
+void seraph_oscillator_bank16_set_frequency(Seraph_Oscillator_Bank16* bank,
+                                            size_t index, uint32_t frequency);
+
+/**
+ * @brief Generate frames of the mixed (summed) bank output
+ *
+ * out[f] is the sum of every oscillator's sample f, saturated to the
+ * Q16 range.
+ */
+void seraph_oscillator_bank16_mix(Seraph_Oscillator_Bank16* bank,
+                                  Q16* out, size_t frames);
+
+/**
+ * @brief Generate frames of every oscillator's own output
+ *
+ * out[f · count + i] is oscillator i's sample f.
+ */
+void seraph_oscillator_bank16_render(Seraph_Oscillator_Bank16* bank,
+                                     Q16* out, size_t frames);
+
+/**
+ * @brief Renormalize every oscillator now (also restarts the interval)
+ */
+void seraph_oscillator_bank16_normalize(Seraph_Oscillator_Bank16* bank);
+
 /*============================================================================
  * Batch Rotation
  *============================================================================*/
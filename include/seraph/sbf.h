@@ -26,6 +26,7 @@
  *   [...]   Cap Table      (8-byte aligned)
  *   [...]   Effect Table   (8-byte aligned)
  *   [...]   String Table   (1-byte aligned)
+ *   [...]   Chunk Table    (8-byte aligned, SBF_FLAG_CHUNKED only)
  *
  * Unlike ELF, SBF:
  * - Has fixed header at the start (not sections at end)
@@ -33,6 +34,14 @@
  * - Has no dynamic linking infrastructure
  * - Has no relocation tables
  * - Integrates manifest directly (not separate file)
+ *
+ * Chunked content hash (format 1.1, SBF_FLAG_CHUNKED):
+ * Everything between the header and the chunk table is cut into fixed
+ * power-of-two chunks. content_hash is the Merkle root of the chunks'
+ * SHA-256 digests, and the chunk table stores the whole tree. A loader
+ * can therefore hash chunks in parallel, or verify only the chunks
+ * behind the sections it actually touches. Files without the flag use
+ * a single SHA-256 over everything after the header.
  */
 
 #ifndef SERAPH_SBF_H
@@ -69,9 +78,12 @@ extern "C" {
 /** SBF string table magic: "SSTR" in little-endian */
 #define SBF_STRING_MAGIC        0x52545353
 
-/** Current SBF format version: 1.0.0 */
+/** SBF chunk table magic: "SCHK" in little-endian */
+#define SBF_CHUNK_MAGIC         0x4B484353
+
+/** Current SBF format version: 1.1.0 */
 #define SBF_VERSION_MAJOR       1
-#define SBF_VERSION_MINOR       0
+#define SBF_VERSION_MINOR       1
 #define SBF_VERSION_PATCH       0
 #define SBF_VERSION             ((SBF_VERSION_MAJOR << 16) | (SBF_VERSION_MINOR << 8) | SBF_VERSION_PATCH)
 
@@ -96,6 +108,13 @@ extern "C" {
 /** Binary ID size (unique identifier) */
 #define SBF_BINARY_ID_SIZE      32
 
+/** Default content chunk size (log2): 64 KiB */
+#define SBF_CHUNK_SHIFT_DEFAULT 16
+
+/** Smallest and largest allowed content chunk sizes (log2) */
+#define SBF_CHUNK_SHIFT_MIN     12
+#define SBF_CHUNK_SHIFT_MAX     30
+
 /*============================================================================
  * SBF Header Flags
  *============================================================================*/
@@ -124,6 +143,9 @@ extern "C" {
 /** Binary uses Galactic numbers (autodiff) */
 #define SBF_FLAG_GALACTIC       (1 << 7)
 
+/** content_hash is a chunk Merkle root (see SBF_Chunk_Table) */
+#define SBF_FLAG_CHUNKED        (1 << 8)
+
 /*============================================================================
  * SBF Target Architecture
  *============================================================================*/
@@ -155,7 +177,8 @@ typedef struct __attribute__((packed)) {
 
     /* Cryptographic integrity (64 bytes) */
     uint8_t  proof_root[SBF_HASH_SIZE]; /**< SHA-256 Merkle root of all proofs */
-    uint8_t  content_hash[SBF_HASH_SIZE]; /**< SHA-256 of everything after header */
+    uint8_t  content_hash[SBF_HASH_SIZE]; /**< SHA-256 of everything after header,
+                                               or chunk Merkle root if CHUNKED */
 
     /* Section offsets and sizes (80 bytes) */
     uint64_t manifest_offset;           /**< Offset to SBF_Manifest */
@@ -190,8 +213,9 @@ typedef struct __attribute__((packed)) {
     uint32_t architecture;              /**< SBF_Architecture */
     uint32_t arch_flags;                /**< Architecture-specific flags */
 
-    /* Reserved for future expansion (16 bytes to pad to 256) */
-    uint64_t reserved[2];
+    /* Content chunk table (16 bytes, zero unless SBF_FLAG_CHUNKED) */
+    uint64_t chunks_offset;             /**< Offset to chunk table (end of hashed content) */
+    uint64_t chunks_size;               /**< Size of chunk table including tree */
 } SBF_Header;
 
 _Static_assert(sizeof(SBF_Header) == SBF_HEADER_SIZE,
@@ -326,6 +350,13 @@ typedef struct __attribute__((packed)) {
 _Static_assert(sizeof(SBF_Proof_Table) == 48,
                "SBF_Proof_Table header must be exactly 48 bytes");
 
+/*
+ * Since format 1.1 the writer may append the full proof Merkle tree
+ * (sha256_merkle_tree layout, leaves first, root last) after the entries,
+ * so a single proof can be checked against proof_root with O(log n) hashes.
+ * proofs_size covers the tree when it is present.
+ */
+
 /*============================================================================
  * SBF Capability Table
  *
@@ -445,6 +476,30 @@ typedef struct __attribute__((packed)) {
 _Static_assert(sizeof(SBF_String_Table) == 8,
                "SBF_String_Table header must be exactly 8 bytes");
 
+/*============================================================================
+ * SBF Chunk Table
+ *
+ * Present when SBF_FLAG_CHUNKED is set, always last in the file. Chunk i
+ * covers file bytes [SBF_HEADER_SIZE + (i << chunk_shift), ...) up to
+ * chunks_offset; the last chunk may be short. The table is followed by
+ * node_count Merkle nodes: chunk digests first, root last. The root
+ * equals the header's content_hash.
+ *============================================================================*/
+
+/** Chunk table header (24 bytes) */
+typedef struct __attribute__((packed)) {
+    uint32_t magic;                     /**< SBF_CHUNK_MAGIC */
+    uint32_t chunk_shift;               /**< log2 of chunk size */
+    uint32_t chunk_count;               /**< Number of content chunks */
+    uint32_t node_count;                /**< Merkle nodes following this header */
+    uint64_t covered_size;              /**< Bytes hashed (chunks_offset - header) */
+    /* 4+4+4+4+8 = 24 bytes */
+    /* Followed by node_count * SBF_HASH_SIZE tree nodes */
+} SBF_Chunk_Table;
+
+_Static_assert(sizeof(SBF_Chunk_Table) == 24,
+               "SBF_Chunk_Table header must be exactly 24 bytes");
+
 /*============================================================================
  * Validation Result
  *============================================================================*/
@@ -399,6 +399,70 @@ static inline Seraph_SemanticByte seraph_sbyte_shr(Seraph_SemanticByte sb, uint8
     };
 }
 
+/*============================================================================
+ * Array Operations
+ *
+ * The bitwise, counting and extraction loops use the SSE4.2/AVX2 kernels
+ * selected by seraph_vbit_set_impl().
+ *============================================================================*/
+
+/**
+ * @brief Merge array of semantic bytes into one (where possible)
+ */
+Seraph_SemanticByte seraph_sbyte_merge_array(const Seraph_SemanticByte* arr, size_t count);
+
+/**
+ * @brief Count fully valid bytes in array
+ */
+size_t seraph_sbyte_count_valid(const Seraph_SemanticByte* arr, size_t count);
+
+/**
+ * @brief Count fully VOID bytes in array
+ */
+size_t seraph_sbyte_count_void(const Seraph_SemanticByte* arr, size_t count);
+
+/**
+ * @brief Extract values of fully valid bytes, in order
+ * @return Number of bytes written to out (at most out_size)
+ */
+size_t seraph_sbyte_extract_valid(const Seraph_SemanticByte* arr, size_t count,
+                                   uint8_t* out, size_t out_size);
+
+/**
+ * @brief Convert byte array to semantic byte array (all valid)
+ */
+void seraph_sbyte_from_bytes(const uint8_t* bytes, Seraph_SemanticByte* out, size_t count);
+
+/**
+ * @brief Convert semantic byte array to bytes, VOID bits from default_val
+ */
+void seraph_sbyte_to_bytes_default(const Seraph_SemanticByte* arr, uint8_t* out,
+                                    size_t count, uint8_t default_val);
+
+/**
+ * @brief Element-wise AND of two arrays
+ */
+void seraph_sbyte_and_array(const Seraph_SemanticByte* a, const Seraph_SemanticByte* b,
+                            Seraph_SemanticByte* out, size_t count);
+
+/**
+ * @brief Element-wise OR of two arrays
+ */
+void seraph_sbyte_or_array(const Seraph_SemanticByte* a, const Seraph_SemanticByte* b,
+                           Seraph_SemanticByte* out, size_t count);
+
+/**
+ * @brief Element-wise XOR of two arrays
+ */
+void seraph_sbyte_xor_array(const Seraph_SemanticByte* a, const Seraph_SemanticByte* b,
+                            Seraph_SemanticByte* out, size_t count);
+
+/**
+ * @brief Element-wise NOT of array
+ */
+void seraph_sbyte_not_array(const Seraph_SemanticByte* arr,
+                            Seraph_SemanticByte* out, size_t count);
+
 #ifdef __cplusplus
 }
 #endif
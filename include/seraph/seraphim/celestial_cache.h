@@ -0,0 +1,136 @@
+/**
+ * @file celestial_cache.h
+ * @brief Seraphim Compiler - Incremental Compilation Cache
+ *
+ * MC29: Native Backends
+ *
+ * A content-addressed on-disk store of per-function machine code. After
+ * optimization a function's generated code depends only on its own IR:
+ * calls and function-pointer loads are emitted as placeholders and patched
+ * once every function has an offset. So the code for an unchanged function
+ * can be reused from a previous build as long as those placeholders are
+ * recorded by callee name.
+ *
+ * Cache keys:
+ * - SHA-256 over a canonical walk of the optimized Celestial IR: blocks,
+ *   instructions, value ids, types, constants and callee names. Source
+ *   positions are left out, so moving a function does not invalidate it.
+ * - The key is taken after inlining and specialization, so a change in a
+ *   callee's body that was inlined into a caller changes the caller's key.
+ * - Each cache is salted with the compiler identity and target, so code
+ *   from another compiler or backend version (SERAPH_X64_CODEGEN_VERSION)
+ *   or another architecture is never reused.
+ *
+ * Entries are files named by the hex key inside the cache directory. They
+ * are written to a temporary name and renamed into place, so concurrent
+ * compilers sharing a directory never observe a partial entry, and a
+ * trailing checksum rejects entries that were damaged on disk.
+ */
+
+#ifndef SERAPH_SERAPHIM_CELESTIAL_CACHE_H
+#define SERAPH_SERAPHIM_CELESTIAL_CACHE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "seraph/vbit.h"
+#include "celestial_ir.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Key size (SHA-256 digest) */
+#define CELESTIAL_CACHE_KEY_SIZE 32
+
+/** Longest cache directory path accepted */
+#define CELESTIAL_CACHE_PATH_MAX 1024
+
+/**
+ * @brief Relocation kinds stored with cached code
+ */
+typedef enum {
+    CELESTIAL_CACHE_RELOC_CALL  = 0,   /**< CALL rel32 to a function */
+    CELESTIAL_CACHE_RELOC_FNPTR = 1,   /**< Address-of load of a function */
+} Celestial_Cache_Reloc_Kind;
+
+/**
+ * @brief A placeholder in cached code, resolved by function name
+ */
+typedef struct {
+    uint32_t    site;       /**< Offset of the 32-bit field from function start */
+    uint8_t     kind;       /**< Celestial_Cache_Reloc_Kind */
+    const char* name;       /**< Target function name (not NUL-terminated) */
+    size_t      name_len;
+} Celestial_Cache_Reloc;
+
+/**
+ * @brief Code of one function plus its relocations
+ *
+ * Entries returned by celestial_cache_load() own their memory and must be
+ * released with celestial_cache_entry_free(). Entries passed to
+ * celestial_cache_store() are only read.
+ */
+typedef struct {
+    uint8_t*               code;
+    size_t                 code_size;
+    Celestial_Cache_Reloc* relocs;
+    size_t                 reloc_count;
+    void*                  storage;   /**< Backing allocation of a loaded entry */
+} Celestial_Cache_Entry;
+
+/**
+ * @brief An open cache directory and its statistics
+ */
+typedef struct {
+    char     dir[CELESTIAL_CACHE_PATH_MAX];
+    uint8_t  salt[CELESTIAL_CACHE_KEY_SIZE];
+    uint32_t lookups;       /**< Functions looked up */
+    uint32_t hits;          /**< Lookups answered from disk */
+    uint32_t stores;        /**< Entries written */
+} Celestial_Cache;
+
+/**
+ * @brief Open (creating if needed) a cache directory
+ *
+ * @param cache Cache to initialize
+ * @param dir Directory path
+ * @param compiler_id Compiler and backend codegen version; part of every key
+ * @param target Target architecture tag; part of every key
+ * @return VBIT_TRUE on success, VBIT_FALSE if the directory is unusable
+ */
+Seraph_Vbit celestial_cache_open(Celestial_Cache* cache, const char* dir,
+                                 const char* compiler_id, uint32_t target);
+
+/**
+ * @brief Compute the cache key of an optimized function
+ */
+void celestial_cache_key(const Celestial_Cache* cache, const Celestial_Function* fn,
+                         uint8_t key[CELESTIAL_CACHE_KEY_SIZE]);
+
+/**
+ * @brief Look up an entry
+ *
+ * @return VBIT_TRUE and a filled @p entry on a hit, VBIT_FALSE on a miss
+ *         or when the stored entry is damaged
+ */
+Seraph_Vbit celestial_cache_load(Celestial_Cache* cache,
+                                 const uint8_t key[CELESTIAL_CACHE_KEY_SIZE],
+                                 Celestial_Cache_Entry* entry);
+
+/**
+ * @brief Store an entry under a key
+ */
+Seraph_Vbit celestial_cache_store(Celestial_Cache* cache,
+                                  const uint8_t key[CELESTIAL_CACHE_KEY_SIZE],
+                                  const Celestial_Cache_Entry* entry);
+
+/**
+ * @brief Release a loaded entry
+ */
+void celestial_cache_entry_free(Celestial_Cache_Entry* entry);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SERAPH_SERAPHIM_CELESTIAL_CACHE_H */
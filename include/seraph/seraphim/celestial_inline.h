@@ -0,0 +1,111 @@
+/**
+ * @file celestial_inline.h
+ * @brief Seraphim Compiler - Celestial IR Inliner and Call-Site Specializer
+ *
+ * MC28: Celestial IR Optimization Passes
+ *
+ * Every CIR_CALL lowers to a real call: argument marshalling, a full
+ * prologue/epilogue in the callee, and parameter spilling. For tiny
+ * helpers (field accessors, Q-format wrappers) that overhead dominates
+ * the work done. This pass removes it at the IR level.
+ *
+ * Strategy:
+ * - Build the call graph from the Celestial_Module and visit functions
+ *   bottom-up, so a callee is already inlined into before it is itself
+ *   considered for inlining into its callers.
+ * - Inline a call site when the callee's cost (live instruction count,
+ *   discounted for each constant argument) is under the threshold and the
+ *   caller stays within its value budget.
+ * - When a call is not inlined but passes constant arguments, optionally
+ *   clone the callee with those parameters bound to the constants
+ *   ("specialization") and redirect the call to the clone.
+ *
+ * Run this BEFORE celestial_fold_constants(): substituted constants then
+ * fold through the inlined or specialized body in a single pass, and
+ * celestial_eliminate_dead_code() removes what folding leaves behind.
+ *
+ * Only callees whose parameters and return value are scalar (integers,
+ * bool, raw pointers) are candidates; struct-returning functions rely on
+ * the backend's return-by-value convention and are left as calls.
+ */
+
+#ifndef SERAPH_SERAPHIM_CELESTIAL_INLINE_H
+#define SERAPH_SERAPHIM_CELESTIAL_INLINE_H
+
+#include <stdint.h>
+#include "celestial_ir.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*============================================================================
+ * Options
+ *============================================================================*/
+
+/**
+ * @brief Inliner cost model parameters
+ */
+typedef struct {
+    uint32_t inline_threshold;      /**< Max callee cost to inline */
+    uint32_t const_arg_bonus;       /**< Cost discount per constant argument */
+    uint32_t single_site_bonus;     /**< Cost discount if callee has one call site */
+    uint32_t max_caller_values;     /**< Value budget per caller (vregs + params) */
+    int      specialize;            /**< Clone callees for constant arguments */
+    uint32_t specialize_threshold;  /**< Max callee cost to specialize */
+    uint32_t max_specializations;   /**< Max clones created per module */
+} Celestial_Inline_Options;
+
+/**
+ * @brief Inliner statistics
+ */
+typedef struct {
+    uint32_t calls_inlined;         /**< Call sites replaced by callee body */
+    uint32_t calls_specialized;     /**< Call sites redirected to a clone */
+    uint32_t specializations;       /**< Specialized clones created */
+    uint32_t instrs_added;          /**< Instructions copied into callers */
+} Celestial_Inline_Stats;
+
+/**
+ * @brief Fill options with defaults for an optimization level
+ *
+ * -O0 disables inlining entirely (threshold 0, no specialization).
+ * Higher levels raise the threshold and enable specialization.
+ *
+ * @param opts Options to fill
+ * @param opt_level Optimization level (0-3)
+ */
+void celestial_inline_default_options(Celestial_Inline_Options* opts,
+                                      int opt_level);
+
+/*============================================================================
+ * Pass Entry Points
+ *============================================================================*/
+
+/**
+ * @brief Compute the inlining cost of a function
+ *
+ * Counts live (non-NOP) instructions. Terminators count, because an
+ * inlined return still becomes a jump or a store.
+ *
+ * @return Cost, or UINT32_MAX if the function is not an inline candidate
+ */
+uint32_t celestial_inline_cost(Celestial_Function* fn);
+
+/**
+ * @brief Run the inliner and call-site specializer over a module
+ *
+ * @param mod Module to optimize
+ * @param opts Cost model (NULL for -O2 defaults)
+ * @param stats Output statistics (may be NULL)
+ * @return Number of call sites inlined or specialized
+ */
+int celestial_inline_module(Celestial_Module* mod,
+                            const Celestial_Inline_Options* opts,
+                            Celestial_Inline_Stats* stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SERAPH_SERAPHIM_CELESTIAL_INLINE_H */
@@ -0,0 +1,142 @@
+/**
+ * @file celestial_jobs.h
+ * @brief Seraphim Compiler - Parallel Per-Function Job Runner
+ *
+ * MC29: Native Backends
+ *
+ * After IR optimization every Celestial_Function is independent: the
+ * backends only read the IR of the function they are lowering, and calls
+ * between functions are resolved by offset fixups once all code exists.
+ * This runner hands out function indices to a fixed set of worker threads
+ * so the x64, ARM64 and RISC-V backends can lower functions concurrently.
+ *
+ * Work distribution:
+ * - Indices are claimed one at a time from a shared atomic counter, so a
+ *   few huge functions do not leave the other workers idle.
+ * - Every call receives its worker number in [0, jobs), which the caller
+ *   uses to pick that worker's private arena, buffers and label tables.
+ * - Nothing here allocates: per-worker state belongs to the caller.
+ *
+ * On builds without C11 threads (kernel builds, toolchains that define
+ * __STDC_NO_THREADS__) the runner executes every index on the calling
+ * thread as worker 0.
+ *
+ * Backends with fixed-width instructions and function-local branch
+ * fixups (ARM64, RISC-V) use celestial_jobs_compile_words(), which also
+ * owns the worker arenas and scratch buffers and the ordered
+ * concatenation.
+ */
+
+#ifndef SERAPH_SERAPHIM_CELESTIAL_JOBS_H
+#define SERAPH_SERAPHIM_CELESTIAL_JOBS_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "celestial_ir.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Upper bound on worker threads for one module */
+#define CELESTIAL_JOBS_MAX 64
+
+/** Per-worker arena size for celestial_jobs_compile_words(); reset per function */
+#define CELESTIAL_JOBS_ARENA_SIZE (32 * 1024 * 1024)
+
+/**
+ * @brief Work callback
+ *
+ * @param shared Caller data passed to celestial_jobs_run()
+ * @param worker Worker number in [0, jobs)
+ * @param index Item index in [0, count)
+ */
+typedef void (*Celestial_Job_Fn)(void* shared, uint32_t worker, size_t index);
+
+/**
+ * @brief Lower one function into 32-bit instruction words
+ *
+ * Branches must be resolved relative to the function's own start, so
+ * the words can be placed anywhere in the module.
+ *
+ * @param backend Caller data passed to celestial_jobs_compile_words()
+ * @param fn Function to lower
+ * @param arena The worker's arena, reset before every call
+ * @param words The worker's scratch buffer
+ * @param capacity Size of @p words in instructions
+ * @return Number of instructions written
+ */
+typedef size_t (*Celestial_Words_Fn)(void* backend, Celestial_Function* fn,
+                                     Seraph_Arena* arena, uint32_t* words,
+                                     size_t capacity);
+
+/**
+ * @brief Number of hardware threads available (at least 1)
+ */
+uint32_t celestial_jobs_hardware_threads(void);
+
+/**
+ * @brief Clamp a requested job count to what the runner will use
+ *
+ * 0 means "one per hardware thread". The result is never larger than
+ * @p count, CELESTIAL_JOBS_MAX, or 1 when threads are unavailable.
+ *
+ * @param requested Requested worker count (0 = auto)
+ * @param count Number of work items
+ * @return Worker count in [1, CELESTIAL_JOBS_MAX]
+ */
+uint32_t celestial_jobs_effective(uint32_t requested, size_t count);
+
+/**
+ * @brief Run fn for every index in [0, count) on up to jobs workers
+ *
+ * Returns once every index has been processed. The caller must size its
+ * per-worker state with celestial_jobs_effective(jobs, count) first and
+ * pass that value back in as @p jobs.
+ *
+ * @return Number of workers that ran
+ */
+uint32_t celestial_jobs_run(size_t count, uint32_t jobs,
+                            Celestial_Job_Fn fn, void* shared);
+
+/**
+ * @brief Collect a module's functions into an array, in module order
+ *
+ * @param mod Module to scan
+ * @param out_count Receives the number of functions
+ * @return malloc'd array (caller frees), or NULL when empty or out of memory
+ */
+Celestial_Function** celestial_jobs_function_list(Celestial_Module* mod,
+                                                  size_t* out_count);
+
+/**
+ * @brief Lower every function of a module on up to jobs workers
+ *
+ * Each worker gets a private arena and a scratch buffer of @p capacity
+ * instructions. The results are concatenated in module order, the same
+ * layout a serial loop over mod->functions produces.
+ *
+ * @param mod Module to lower
+ * @param jobs Requested worker count (0 = auto)
+ * @param capacity Scratch buffer size per worker, in instructions
+ * @param fn Backend callback
+ * @param backend Passed through to @p fn
+ * @param out_words Receives the malloc'd instructions (caller frees)
+ * @param out_count Receives the number of instructions
+ * @param out_starts Receives a malloc'd array holding, for each function
+ *        in module order, the index of its first instruction (caller frees)
+ * @return VBIT_TRUE on success. VBIT_FALSE if fewer than two workers
+ *         would run, a worker could not be set up, or any function
+ *         failed; nothing is returned then and the caller should compile
+ *         serially. VBIT_VOID on bad arguments.
+ */
+Seraph_Vbit celestial_jobs_compile_words(Celestial_Module* mod, uint32_t jobs,
+                                         size_t capacity, Celestial_Words_Fn fn,
+                                         void* backend, uint32_t** out_words,
+                                         size_t* out_count, size_t** out_starts);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SERAPH_SERAPHIM_CELESTIAL_JOBS_H */
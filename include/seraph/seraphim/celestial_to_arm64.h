@@ -154,6 +154,17 @@ void arm64_resolve_fixups(ARM64_Context* ctx);
  */
 void arm64_compile_module(ARM64_Context* ctx);
 
+/**
+ * @brief Compile entire module to ARM64 on several threads
+ *
+ * Functions are lowered concurrently into per-worker buffers and arenas,
+ * then appended to ctx->code in module order, giving the same output as
+ * arm64_compile_module(). jobs = 0 uses one worker per hardware thread;
+ * jobs = 1 (or a single function) falls back to the serial path, as does
+ * any function or worker that fails to set up.
+ */
+void arm64_compile_module_parallel(ARM64_Context* ctx, uint32_t jobs);
+
 /**
  * @brief Compile a single function
  */
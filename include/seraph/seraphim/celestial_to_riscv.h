@@ -92,6 +92,7 @@ void rv_resolve_fixups(RV_Context* ctx);
  *============================================================================*/
 
 void rv_compile_module(RV_Context* ctx);
+void rv_compile_module_parallel(RV_Context* ctx, uint32_t jobs);
 void rv_compile_function(RV_Context* ctx, Celestial_Function* fn);
 void rv_emit_prologue(RV_Context* ctx);
 void rv_emit_epilogue(RV_Context* ctx);
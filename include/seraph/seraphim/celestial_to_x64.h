@@ -46,6 +46,7 @@
 #include "seraph/vbit.h"
 #include "seraph/arena.h"
 #include "seraph/seraphim/celestial_ir.h"
+#include "seraph/seraphim/celestial_cache.h"
 #include "seraph/seraphim/x64_encode.h"
 
 #ifdef __cplusplus
@@ -71,6 +72,13 @@ extern "C" {
 /** Maximum basic blocks per function */
 #define SERAPH_X64_MAX_BLOCKS 4096
 
+/**
+ * Code generation version, part of every celestial_cache key salt.
+ * Bump it with any change that alters the code emitted for some IR, so
+ * cached functions from older backends are not reused.
+ */
+#define SERAPH_X64_CODEGEN_VERSION 1
+
 /*============================================================================
  * SERAPH x64 ABI - Reserved Registers
  *============================================================================*/
@@ -226,6 +234,7 @@ typedef struct {
     X64_FunctionEntry*  functions;
     size_t              function_count;
     size_t              function_capacity;
+    int                 functions_sorted;  /**< Table ordered by fn (binary search) */
 
     /** Call fixup table */
     X64_CallFixup*      call_fixups;
@@ -283,6 +292,18 @@ typedef struct {
     /** Module-wide context for call fixup resolution */
     X64_ModuleContext*  mod_ctx;
 
+    /** Peephole / instruction selection state */
+    Celestial_Block*    next_block;     /**< Block laid out after the current one */
+    uint32_t*           use_counts;     /**< Operand uses per value id */
+    int32_t*            frame_slots;    /**< ALLOCA value id -> RBP offset of its data (0 = unknown) */
+    uint32_t            value_id_limit; /**< Size of use_counts / frame_slots */
+    int32_t             fwd_offset;     /**< RBP slot written by the last spill store */
+    X64_Reg             fwd_reg;        /**< Register that store wrote from */
+    size_t              fwd_end;        /**< Buffer size right after it (SIZE_MAX = none) */
+    X64_Reg             mov_dst;        /**< Last register-to-register move */
+    X64_Reg             mov_src;
+    size_t              mov_end;        /**< Buffer size right after it (SIZE_MAX = none) */
+
     /** Error tracking */
     const char*         error_msg;
     uint32_t            error_line;
@@ -304,6 +325,47 @@ Seraph_Vbit celestial_compile_module(Celestial_Module* mod,
                                       X64_Buffer* output,
                                       Seraph_Arena* arena);
 
+/**
+ * @brief Compile an entire Celestial module to x86-64 on several threads
+ *
+ * Each worker lowers whole functions into its own X64_Buffer, label table
+ * and arena (reset between functions). The per-function code is then
+ * concatenated in module order, so the output is byte-identical to
+ * celestial_compile_module(); call and function-pointer fixups are rebased
+ * to their final offsets and patched through the function table.
+ *
+ * @param mod The Celestial IR module to compile
+ * @param output Buffer to write machine code to
+ * @param arena Arena for the merged fixup tables
+ * @param jobs Worker threads (0 = one per hardware thread, 1 = serial)
+ * @return VBIT_TRUE on success, VBIT_FALSE on error
+ */
+Seraph_Vbit celestial_compile_module_parallel(Celestial_Module* mod,
+                                               X64_Buffer* output,
+                                               Seraph_Arena* arena,
+                                               uint32_t jobs);
+
+/**
+ * @brief Compile a module, reusing per-function code from a cache
+ *
+ * Functions whose key is found in @p cache are taken from disk; the rest
+ * are lowered on up to @p jobs threads and stored back. The output is
+ * byte-identical to celestial_compile_module(). A NULL cache, or a module
+ * whose function names are not unique, compiles without caching.
+ *
+ * @param mod The Celestial IR module to compile
+ * @param output Buffer to write machine code to
+ * @param arena Arena for the merged fixup tables
+ * @param jobs Worker threads (0 = one per hardware thread, 1 = serial)
+ * @param cache Open cache, or NULL
+ * @return VBIT_TRUE on success, VBIT_FALSE on error
+ */
+Seraph_Vbit celestial_compile_module_cached(Celestial_Module* mod,
+                                             X64_Buffer* output,
+                                             Seraph_Arena* arena,
+                                             uint32_t jobs,
+                                             Celestial_Cache* cache);
+
 /**
  * @brief Compile a single function to x86-64
  *
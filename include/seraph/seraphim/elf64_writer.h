@@ -40,6 +40,7 @@
 #include <stddef.h>
 #include "seraph/vbit.h"
 #include "seraph/seraphim/celestial_ir.h"
+#include "seraph/seraphim/celestial_cache.h"
 #include "seraph/seraphim/proofs.h"
 
 #ifdef __cplusplus
@@ -605,16 +606,24 @@ Seraph_Vbit seraph_elf_from_celestial(Celestial_Module* module,
  * 3. Add SERAPH extensions
  * 4. Write output
  *
+ * Functions are lowered on up to @p jobs threads; the output does not
+ * depend on the job count. On x64, functions found in @p cache reuse the
+ * code of an earlier build; the other targets ignore the cache.
+ *
  * @param module Celestial IR module
  * @param proofs Proof table
  * @param target Target architecture
  * @param filename Output filename
+ * @param jobs Code generation threads (0 = all hardware threads, 1 = serial)
+ * @param cache Incremental compilation cache, or NULL
  * @return VBIT_TRUE on success
  */
 Seraph_Vbit seraph_elf_from_celestial_target(Celestial_Module* module,
                                               const Seraph_Proof_Table* proofs,
                                               Seraph_Elf_Target target,
-                                              const char* filename);
+                                              const char* filename,
+                                              uint32_t jobs,
+                                              Celestial_Cache* cache);
 
 #ifdef __cplusplus
 }
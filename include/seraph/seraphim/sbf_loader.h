@@ -11,6 +11,13 @@
  * - Effect table extraction
  * - Memory mapping preparation
  *
+ * Files are mapped read-only (mmap) where the platform allows it and every
+ * section pointer refers into that mapping, so loading copies nothing.
+ * For chunked files (SBF_FLAG_CHUNKED) the content hash is checked per
+ * chunk: in parallel during validation, or, with lazy_verify, only for
+ * the chunks behind the sections a caller actually touches. Individual
+ * proofs can be checked on demand with sbf_loader_verify_proof().
+ *
  * Usage:
  *   SBF_Loader* loader = sbf_loader_create();
  *   sbf_loader_load_file(loader, "program.sbf");
@@ -40,6 +47,7 @@ extern "C" {
 
 typedef struct SBF_Loader SBF_Loader;
 typedef struct SBF_Loader_Config SBF_Loader_Config;
+typedef struct SBF_Chunk_Cache SBF_Chunk_Cache;
 
 /*============================================================================
  * Loader Error Codes
@@ -77,6 +85,8 @@ struct SBF_Loader_Config {
     bool require_signed;                /**< Require signed binaries (default: false) */
     uint32_t min_kernel_version;        /**< Minimum kernel version to accept (0 = any) */
     uint32_t max_kernel_version;        /**< Maximum kernel version to accept (0 = any) */
+    bool lazy_verify;                   /**< Verify chunks on first section access (default: false) */
+    uint32_t verify_threads;            /**< Threads for content hashing (0 = one per CPU) */
 };
 
 /*============================================================================
@@ -101,6 +111,7 @@ struct SBF_Loader {
     uint8_t* data;
     size_t data_size;
     bool owns_data;                     /**< True if loader allocated data */
+    bool mapped;                        /**< True if data is a read-only file mapping */
 
     /* Parsed pointers (point into data) */
     const SBF_Header* header;
@@ -116,6 +127,12 @@ struct SBF_Loader {
     const SBF_Effect_Entry* effects;
     const SBF_String_Table* string_table;
     const char* strings;
+    const SBF_Chunk_Table* chunk_table;
+    const uint8_t* chunk_tree;          /**< Chunk Merkle tree, digests first, root last */
+    const uint8_t* proof_tree;          /**< Proof Merkle tree, NULL if not stored */
+
+    /* Per-chunk verification state (chunked files only) */
+    SBF_Chunk_Cache* chunk_cache;
 
     /* Computed values */
     uint8_t computed_content_hash[SBF_HASH_SIZE];
@@ -165,6 +182,11 @@ const char* sbf_load_error_name(SBF_Load_Error error);
 
 /**
  * @brief Load SBF binary from file
+ *
+ * The file is mapped read-only and private; no section is copied. On
+ * platforms without mmap, or if mapping fails, the file is read into a
+ * heap buffer instead.
+ *
  * @param loader Loader instance
  * @param path File path
  * @return SBF_LOAD_OK or error
@@ -212,7 +234,8 @@ bool sbf_loader_is_loaded(const SBF_Loader* loader);
  *
  * Performs all validation according to configuration:
  * - Magic and version check
- * - Content hash verification (optional)
+ * - Content hash verification (optional; with lazy_verify only the
+ *   manifest and proof table header are hashed here)
  * - Proof Merkle root verification (optional)
  * - Signature verification (optional)
  * - Section bounds check
@@ -231,11 +254,37 @@ SBF_Validation_Result sbf_loader_validate_quick(const SBF_Loader* loader);
 
 /**
  * @brief Verify content hash
+ *
+ * Chunked files hash their chunks on up to verify_threads workers and
+ * compare the resulting Merkle root; older files hash everything after
+ * the header in one pass.
+ *
  * @param loader Loader instance
  * @return true if hash matches
  */
 bool sbf_loader_verify_content_hash(SBF_Loader* loader);
 
+/**
+ * @brief Verify only the content chunks covering a byte range
+ *
+ * Each chunk is hashed at most once and checked against content_hash
+ * through its Merkle path; the result is remembered. Files without a
+ * chunk table fall back to sbf_loader_verify_content_hash().
+ *
+ * @param loader Loader instance
+ * @param offset File offset of the range
+ * @param size Range size in bytes
+ * @return true if every covering chunk matches
+ */
+bool sbf_loader_verify_range(SBF_Loader* loader, uint64_t offset, uint64_t size);
+
+/**
+ * @brief Bytes of content verified so far (chunked files)
+ * @param loader Loader instance
+ * @return Bytes hashed and matched, 0 for files without a chunk table
+ */
+uint64_t sbf_loader_get_verified_bytes(const SBF_Loader* loader);
+
 /**
  * @brief Verify proof Merkle root
  * @param loader Loader instance
@@ -243,6 +292,19 @@ bool sbf_loader_verify_content_hash(SBF_Loader* loader);
  */
 bool sbf_loader_verify_proof_root(SBF_Loader* loader);
 
+/**
+ * @brief Verify a single proof entry against the header's proof root
+ *
+ * Uses the stored proof Merkle tree, so the cost is O(log n) pair hashes
+ * plus the content chunk holding the entry. Without a stored tree the
+ * whole root is recomputed.
+ *
+ * @param loader Loader instance
+ * @param index Proof index
+ * @return true if the proof is included under proof_root
+ */
+bool sbf_loader_verify_proof(SBF_Loader* loader, size_t index);
+
 /**
  * @brief Check if binary has any failed proofs
  * @param loader Loader instance
@@ -298,6 +360,9 @@ uint64_t sbf_loader_get_entry_point(const SBF_Loader* loader);
 
 /*============================================================================
  * Section Access
+ *
+ * With lazy_verify set, section and table getters hash the chunks behind
+ * the section on first use and return NULL if they do not match.
  *============================================================================*/
 
 /**
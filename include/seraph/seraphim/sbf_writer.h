@@ -96,6 +96,9 @@ struct SBF_Writer_Config {
     size_t max_effects;                 /**< Max effect entries (0 = unlimited) */
     size_t max_string_size;             /**< Max string table size (0 = default 64KB) */
 
+    /* Content hashing */
+    uint32_t chunk_shift;               /**< log2 content chunk size (0 = SBF_CHUNK_SHIFT_DEFAULT) */
+
     /* Signing configuration */
     const uint8_t* author_private_key;  /**< Ed25519 private key (64 bytes, NULL = unsigned) */
     const uint8_t* author_public_key;   /**< Ed25519 public key (32 bytes) */
@@ -208,8 +211,8 @@ struct SBF_Writer {
     SBF_Effect_Table effect_table_header;
     SBF_String_Table string_table_header;
 
-    /* Merkle tree for proofs */
-    uint8_t* merkle_nodes;              /**< Array of SHA-256 hashes */
+    /* Merkle tree for proofs (stored after the proof entries) */
+    uint8_t* merkle_nodes;              /**< All tree levels, leaves first, root last */
     size_t merkle_node_count;
 
     /* Final binary */
@@ -524,8 +527,8 @@ size_t sbf_writer_get_string_size(const SBF_Writer* writer);
  *
  * This computes:
  * - All section offsets and alignments
- * - SHA-256 content hash
- * - Merkle tree of proofs
+ * - Chunked SHA-256 content hash and its stored Merkle tree
+ * - Merkle tree of proofs (stored after the proof entries)
  * - Manifest signature (if keys provided)
  *
  * After finalization, the binary cannot be modified.
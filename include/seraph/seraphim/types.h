@@ -197,8 +197,9 @@ typedef struct Seraph_Type_Diag {
  * @brief Symbol table entry
  */
 typedef struct Seraph_Symbol {
-    const char* name;                   /**< Symbol name */
+    const char* name;                   /**< Symbol name (interned) */
     size_t name_len;
+    uint32_t name_hash;                 /**< Hash of the name bytes */
     Seraph_Type* type;                  /**< Symbol's type */
     Seraph_AST_Node* decl;              /**< Declaration node */
     int is_mut;                         /**< Mutable binding? */
@@ -207,12 +208,40 @@ typedef struct Seraph_Symbol {
 
 /**
  * @brief Scope for symbol lookup
+ *
+ * Symbols are kept both on the `symbols` list (newest first) and in an
+ * open-addressed table keyed by interned name, created on the first
+ * define so empty block scopes cost nothing.
  */
 typedef struct Seraph_Scope {
     Seraph_Symbol* symbols;             /**< Symbols in this scope */
+    Seraph_Symbol** slots;              /**< Hash table (NULL = empty slot) */
+    uint32_t slot_count;                /**< Power of two, 0 before first define */
+    uint32_t symbol_count;              /**< Occupied slots */
     struct Seraph_Scope* parent;        /**< Enclosing scope */
 } Seraph_Scope;
 
+/**
+ * @brief Interned identifier
+ */
+typedef struct {
+    const char* str;                    /**< Canonical NUL-terminated copy */
+    size_t len;
+    uint32_t hash;
+} Seraph_Intern_Entry;
+
+/**
+ * @brief Identifier intern table
+ *
+ * Every distinct identifier is stored once in the arena, so symbol
+ * tables compare names by pointer instead of by memcmp.
+ */
+typedef struct {
+    Seraph_Intern_Entry* entries;       /**< Open-addressed (str NULL = empty) */
+    uint32_t capacity;                  /**< Power of two, 0 before first use */
+    uint32_t count;
+} Seraph_Intern_Table;
+
 /**
  * @brief Type checking context
  */
@@ -222,6 +251,7 @@ typedef struct {
     /* Symbol tables */
     Seraph_Scope* scope;                /**< Current scope */
     Seraph_Scope* global;               /**< Global scope */
+    Seraph_Intern_Table interns;        /**< Interned identifiers */
 
     /* Type inference */
     uint32_t next_typevar_id;           /**< Next type variable ID */
@@ -413,6 +443,17 @@ Seraph_Vbit seraph_type_define(Seraph_Type_Context* ctx,
 Seraph_Symbol* seraph_type_lookup(Seraph_Type_Context* ctx,
                                    const char* name, size_t name_len);
 
+/**
+ * @brief Intern an identifier
+ *
+ * Equal names always return the same pointer for the lifetime of the
+ * context's arena.
+ *
+ * @return Canonical NUL-terminated copy, or NULL on allocation failure
+ */
+const char* seraph_type_intern(Seraph_Type_Context* ctx,
+                               const char* name, size_t name_len);
+
 /*============================================================================
  * Type Checking
  *============================================================================*/
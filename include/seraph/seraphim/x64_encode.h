@@ -177,6 +177,7 @@ typedef struct {
     size_t     fixup_capacity;
 
     uint32_t   next_id;      /**< Next label ID to allocate */
+    size_t     last_defined; /**< Offset of the most recent definition */
 } X64_Labels;
 
 /*============================================================================
@@ -259,6 +260,15 @@ Seraph_Vbit x64_labels_init(X64_Labels* labels);
  */
 void x64_labels_free(X64_Labels* labels);
 
+/**
+ * @brief Forget all labels and fixups but keep the allocations
+ *
+ * Used when one table is reused for many independently resolved functions.
+ *
+ * @param labels Label table to reset
+ */
+void x64_labels_reset(X64_Labels* labels);
+
 /**
  * @brief Create a new label (undefined)
  *
@@ -520,11 +530,21 @@ void x64_and_reg_imm(X64_Buffer* buf, X64_Reg dst, int32_t imm, X64_Size size);
  */
 void x64_or_reg_reg(X64_Buffer* buf, X64_Reg dst, X64_Reg src, X64_Size size);
 
+/**
+ * @brief Emit OR reg, imm32
+ */
+void x64_or_reg_imm(X64_Buffer* buf, X64_Reg dst, int32_t imm, X64_Size size);
+
 /**
  * @brief Emit XOR reg, reg
  */
 void x64_xor_reg_reg(X64_Buffer* buf, X64_Reg dst, X64_Reg src, X64_Size size);
 
+/**
+ * @brief Emit XOR reg, imm32
+ */
+void x64_xor_reg_imm(X64_Buffer* buf, X64_Reg dst, int32_t imm, X64_Size size);
+
 /**
  * @brief Emit NOT reg
  */
@@ -340,6 +340,54 @@ typedef struct {
     float proximity;                /**< How close (0.0 = far, 1.0 = touching) */
 } Seraph_Intent_State;
 
+/*============================================================================
+ * Damage Tracking
+ *============================================================================
+ *
+ * seraph_surface_render remembers what it drew for the locus and each orb.
+ * On the next frame, anything whose on-screen appearance changed (position,
+ * radius, color, brightness, glow, paint order) damages both the area it
+ * used to cover and the area it covers now, and only those areas are
+ * redrawn. Idle frames draw nothing. The regions of the last frame are
+ * exposed so a display backend can upload only what changed.
+ */
+
+/** Damage regions kept per frame; past this they collapse into one */
+#define SERAPH_SURFACE_MAX_DAMAGE 32
+
+/**
+ * @brief A pixel rectangle (x, y inclusive; width/height in pixels)
+ */
+typedef struct {
+    uint32_t x;
+    uint32_t y;
+    uint32_t width;
+    uint32_t height;
+} Seraph_Surface_Rect;
+
+/**
+ * @brief Regions of the framebuffer changed by the last render
+ *
+ * Rectangles are disjoint and aligned to the renderer's 32-pixel tiles
+ * (clipped to the framebuffer). A count of zero means the frame was idle.
+ */
+typedef struct {
+    Seraph_Surface_Rect rects[SERAPH_SURFACE_MAX_DAMAGE];
+    uint32_t count;
+} Seraph_Surface_Damage;
+
+/**
+ * @brief What the last render drew for one disc (locus or orb)
+ */
+typedef struct {
+    int64_t cx, cy, radius;             /**< Q16.16 pixels */
+    uint32_t fill, glow;                /**< Packed colors */
+    uint32_t glow_amount;               /**< Q8 */
+    int32_t x0, y0, x1, y1;             /**< Covered pixels, inclusive */
+    uint8_t layer;                      /**< Paint pass */
+    bool drawn;                         /**< Anything of it on screen */
+} Seraph_Surface_Drawn;
+
 /*============================================================================
  * The Surface (Complete UI State)
  *============================================================================*/
@@ -387,6 +435,16 @@ typedef struct {
     Seraph_Atlas* atlas;                        /**< Connected Atlas instance */
     Seraph_Surface_Persistent_State* persistent; /**< Persistent state in Atlas */
 
+    /* Damage tracking: what the last render drew, and what it changed */
+    Seraph_Surface_Drawn drawn[SERAPH_SURFACE_MAX_ORBS + 1]; /**< [0] is the locus */
+    Seraph_Surface_Damage damage;
+    const uint32_t* drawn_framebuffer;  /**< Buffer the last render drew into */
+    uint32_t drawn_width;
+    uint32_t drawn_height;
+    uint32_t drawn_fullscreen_fill;     /**< Its color, if drawn_fullscreen */
+    bool drawn_fullscreen;              /**< Last frame was a fullscreen orb */
+    bool drawn_valid;                   /**< Buffer still holds the last frame */
+
     /* Subsystem initialized flag */
     bool initialized;
 
@@ -596,6 +654,10 @@ bool seraph_surface_is_orb_expanded(
  * @brief Render the Surface to a framebuffer
  *
  * Uses the Glyph SDF system for smooth, resolution-independent rendering.
+ * When the framebuffer is the one the previous call drew into (same
+ * pointer and size) only the damaged regions are redrawn; any other
+ * buffer, or a call after seraph_surface_invalidate, is drawn in full.
+ * Afterwards seraph_surface_get_damage lists what changed.
  */
 void seraph_surface_render(
     Seraph_Surface* surface,
@@ -604,6 +666,20 @@ void seraph_surface_render(
     uint32_t height
 );
 
+/**
+ * @brief Regions changed by the last seraph_surface_render
+ * @return Damage list, or NULL if surface is invalid
+ */
+const Seraph_Surface_Damage* seraph_surface_get_damage(const Seraph_Surface* surface);
+
+/**
+ * @brief Forget the last frame so the next render redraws everything
+ *
+ * For when the framebuffer contents were lost or drawn over by something
+ * else (including seraph_surface_render_orb/render_locus).
+ */
+void seraph_surface_invalidate(Seraph_Surface* surface);
+
 /**
  * @brief Render a single orb
  */
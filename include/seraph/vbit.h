@@ -379,6 +379,149 @@ void seraph_vbit_and_array(const Seraph_Vbit* a, const Seraph_Vbit* b,
 void seraph_vbit_or_array(const Seraph_Vbit* a, const Seraph_Vbit* b,
                           Seraph_Vbit* dst, size_t count);
 
+/**
+ * @brief Apply XOR element-wise to two arrays
+ */
+void seraph_vbit_xor_array(const Seraph_Vbit* a, const Seraph_Vbit* b,
+                           Seraph_Vbit* dst, size_t count);
+
+/**
+ * @brief Collect indices of TRUE elements
+ * @param indices Output array (must hold count elements)
+ * @return Number of TRUE indices found
+ */
+size_t seraph_vbit_filter_true(const Seraph_Vbit* values, size_t count,
+                               size_t* indices);
+
+/**
+ * @brief Pack VBIT array into bitmap (TRUE=1, FALSE/VOID=0)
+ * @param bitmap Output bitmap (must be at least (count+7)/8 bytes)
+ */
+void seraph_vbit_pack_bitmap(const Seraph_Vbit* values, size_t count, uint8_t* bitmap);
+
+/**
+ * @brief Unpack bitmap to VBIT array (1=TRUE, 0=FALSE)
+ */
+void seraph_vbit_unpack_bitmap(const uint8_t* bitmap, size_t count, Seraph_Vbit* values);
+
+/*============================================================================
+ * Packed VBIT Arrays
+ *
+ * Two bits per VBIT, held as two bit planes per 64 elements: bit i of t is
+ * set when element i is TRUE, bit i of f when it is FALSE, and neither when
+ * it is VOID. Kleene logic then reduces to plain word operations:
+ *
+ *   AND: t = ta & tb,  f = fa | fb
+ *   OR:  t = ta | tb,  f = fa & fb
+ *   NOT: swap t and f
+ *
+ * so one 64-bit operation pair evaluates 64 VBITs. Unused bits of the last
+ * word are VOID and stay VOID under every operation.
+ *============================================================================*/
+
+/**
+ * @brief 64 VBITs in packed form
+ */
+typedef struct {
+    uint64_t t;     /**< TRUE plane */
+    uint64_t f;     /**< FALSE plane */
+} Seraph_Vbit_Packed;
+
+/**
+ * @brief Number of packed words needed for count VBITs
+ */
+static inline size_t seraph_vbit_packed_words(size_t count) {
+    return (count + 63) / 64;
+}
+
+/**
+ * @brief Pack a VBIT array (bytes other than FALSE and TRUE pack as VOID)
+ * @param out Output words (must hold seraph_vbit_packed_words(count))
+ */
+void seraph_vbit_pack(const Seraph_Vbit* values, size_t count, Seraph_Vbit_Packed* out);
+
+/**
+ * @brief Unpack count VBITs from packed words
+ */
+void seraph_vbit_unpack(const Seraph_Vbit_Packed* words, size_t count, Seraph_Vbit* values);
+
+/**
+ * @brief Kleene AND of packed arrays (words elements each)
+ */
+void seraph_vbit_packed_and(const Seraph_Vbit_Packed* a, const Seraph_Vbit_Packed* b,
+                            Seraph_Vbit_Packed* dst, size_t words);
+
+/**
+ * @brief Kleene OR of packed arrays
+ */
+void seraph_vbit_packed_or(const Seraph_Vbit_Packed* a, const Seraph_Vbit_Packed* b,
+                           Seraph_Vbit_Packed* dst, size_t words);
+
+/**
+ * @brief Kleene XOR of packed arrays (VOID if either side is VOID)
+ */
+void seraph_vbit_packed_xor(const Seraph_Vbit_Packed* a, const Seraph_Vbit_Packed* b,
+                            Seraph_Vbit_Packed* dst, size_t words);
+
+/**
+ * @brief Kleene NOT of a packed array
+ */
+void seraph_vbit_packed_not(const Seraph_Vbit_Packed* src, Seraph_Vbit_Packed* dst,
+                            size_t words);
+
+/**
+ * @brief Count TRUE elements of a packed array
+ */
+size_t seraph_vbit_packed_count_true(const Seraph_Vbit_Packed* words, size_t count);
+
+/**
+ * @brief Count FALSE elements of a packed array
+ */
+size_t seraph_vbit_packed_count_false(const Seraph_Vbit_Packed* words, size_t count);
+
+/*============================================================================
+ * Array Kernel Selection
+ *
+ * The VBIT and semantic byte array operations pick SSE4.2 or AVX2 kernels
+ * at runtime on x86-64 hosts. The scalar loops stay the reference and
+ * finish every array tail; the kernel build only uses them.
+ *============================================================================*/
+
+/**
+ * @brief Array kernel variants
+ */
+typedef enum {
+    SERAPH_VBIT_IMPL_AUTO   = 0,    /**< Best variant this CPU supports */
+    SERAPH_VBIT_IMPL_SCALAR = 1,    /**< Portable C, one element at a time */
+    SERAPH_VBIT_IMPL_SSE42  = 2,    /**< 16 bytes per instruction */
+    SERAPH_VBIT_IMPL_AVX2   = 3,    /**< 32 bytes per instruction */
+} Seraph_Vbit_Impl;
+
+/**
+ * @brief Check whether this CPU and build support a variant
+ */
+bool seraph_vbit_impl_supported(Seraph_Vbit_Impl impl);
+
+/**
+ * @brief Force a variant for all following array operations
+ *
+ * Meant for tests and benchmarks; call it before other threads use arrays.
+ *
+ * @param impl Variant to use, SERAPH_VBIT_IMPL_AUTO to restore the default
+ * @return true on success, false if the variant is not supported
+ */
+bool seraph_vbit_set_impl(Seraph_Vbit_Impl impl);
+
+/**
+ * @brief Variant in use after AUTO resolution
+ */
+Seraph_Vbit_Impl seraph_vbit_get_impl(void);
+
+/**
+ * @brief Short name of a variant ("scalar", "sse4.2", "avx2", "auto")
+ */
+const char* seraph_vbit_impl_name(Seraph_Vbit_Impl impl);
+
 /*============================================================================
  * VBIT Conditional Selection
  *============================================================================*/
@@ -5,7 +5,7 @@
  * SERAPH: Semantic Extensible Resilient Automatic Persistent Hypervisor
  *
  * Implements security hardening for the Aether DSM protocol:
- *   - SHA-256 hash (NIST FIPS 180-4)
+ *   - SHA-256 hash (NIST FIPS 180-4, via the shared crypto/sha256)
  *   - HMAC-SHA256 authentication (RFC 2104)
  *   - Constant-time comparison
  *   - Token bucket rate limiting
@@ -25,187 +25,24 @@
 #include <string.h>
 
 /*============================================================================
- * SHA-256 Constants (NIST FIPS 180-4)
+ * SHA-256 (shared implementation in src/crypto/sha256.c)
  *============================================================================*/
 
-/** SHA-256 initial hash values */
-static const uint32_t SHA256_H0[8] = {
-    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
-    0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
-};
-
-/** SHA-256 round constants */
-static const uint32_t SHA256_K[64] = {
-    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
-    0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
-    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
-    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
-    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
-    0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
-    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
-    0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
-    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
-    0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
-    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
-    0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
-    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
-    0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
-    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
-    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
-};
-
-/*============================================================================
- * SHA-256 Helper Macros
- *============================================================================*/
-
-#define ROTR32(x, n)  (((x) >> (n)) | ((x) << (32 - (n))))
-#define CH(x, y, z)   (((x) & (y)) ^ (~(x) & (z)))
-#define MAJ(x, y, z)  (((x) & (y)) ^ ((x) & (z)) ^ ((y) & (z)))
-#define EP0(x)        (ROTR32(x, 2) ^ ROTR32(x, 13) ^ ROTR32(x, 22))
-#define EP1(x)        (ROTR32(x, 6) ^ ROTR32(x, 11) ^ ROTR32(x, 25))
-#define SIG0(x)       (ROTR32(x, 7) ^ ROTR32(x, 18) ^ ((x) >> 3))
-#define SIG1(x)       (ROTR32(x, 17) ^ ROTR32(x, 19) ^ ((x) >> 10))
-
-/*============================================================================
- * SHA-256 Implementation
- *============================================================================*/
-
-/**
- * @brief Process a 64-byte block
- */
-static void sha256_transform(Aether_SHA256_Context* ctx, const uint8_t block[64]) {
-    uint32_t W[64];
-    uint32_t a, b, c, d, e, f, g, h;
-    uint32_t t1, t2;
-    int i;
-
-    /* Prepare message schedule */
-    for (i = 0; i < 16; i++) {
-        W[i] = ((uint32_t)block[i*4] << 24) |
-               ((uint32_t)block[i*4+1] << 16) |
-               ((uint32_t)block[i*4+2] << 8) |
-               ((uint32_t)block[i*4+3]);
-    }
-
-    for (i = 16; i < 64; i++) {
-        W[i] = SIG1(W[i-2]) + W[i-7] + SIG0(W[i-15]) + W[i-16];
-    }
-
-    /* Initialize working variables */
-    a = ctx->state[0];
-    b = ctx->state[1];
-    c = ctx->state[2];
-    d = ctx->state[3];
-    e = ctx->state[4];
-    f = ctx->state[5];
-    g = ctx->state[6];
-    h = ctx->state[7];
-
-    /* Main loop */
-    for (i = 0; i < 64; i++) {
-        t1 = h + EP1(e) + CH(e, f, g) + SHA256_K[i] + W[i];
-        t2 = EP0(a) + MAJ(a, b, c);
-        h = g;
-        g = f;
-        f = e;
-        e = d + t1;
-        d = c;
-        c = b;
-        b = a;
-        a = t1 + t2;
-    }
-
-    /* Add to state */
-    ctx->state[0] += a;
-    ctx->state[1] += b;
-    ctx->state[2] += c;
-    ctx->state[3] += d;
-    ctx->state[4] += e;
-    ctx->state[5] += f;
-    ctx->state[6] += g;
-    ctx->state[7] += h;
-}
-
 void aether_sha256_init(Aether_SHA256_Context* ctx) {
-    if (ctx == NULL) return;
-
-    memcpy(ctx->state, SHA256_H0, sizeof(SHA256_H0));
-    ctx->count = 0;
-    memset(ctx->buffer, 0, sizeof(ctx->buffer));
+    sha256_init(ctx);
 }
 
 void aether_sha256_update(Aether_SHA256_Context* ctx,
                           const void* data, size_t len) {
-    if (ctx == NULL || data == NULL || len == 0) return;
-
-    const uint8_t* bytes = (const uint8_t*)data;
-    size_t buf_idx = (size_t)((ctx->count / 8) % 64);
-
-    ctx->count += (uint64_t)len * 8;
-
-    /* Fill buffer and process */
-    while (len > 0) {
-        size_t to_copy = 64 - buf_idx;
-        if (to_copy > len) to_copy = len;
-
-        memcpy(ctx->buffer + buf_idx, bytes, to_copy);
-        buf_idx += to_copy;
-        bytes += to_copy;
-        len -= to_copy;
-
-        if (buf_idx == 64) {
-            sha256_transform(ctx, ctx->buffer);
-            buf_idx = 0;
-        }
-    }
+    sha256_update(ctx, data, len);
 }
 
 void aether_sha256_final(Aether_SHA256_Context* ctx, uint8_t digest[32]) {
-    if (ctx == NULL || digest == NULL) return;
-
-    size_t buf_idx = (size_t)((ctx->count / 8) % 64);
-
-    /* Padding */
-    ctx->buffer[buf_idx++] = 0x80;
-
-    if (buf_idx > 56) {
-        /* Need two blocks */
-        memset(ctx->buffer + buf_idx, 0, 64 - buf_idx);
-        sha256_transform(ctx, ctx->buffer);
-        buf_idx = 0;
-    }
-
-    memset(ctx->buffer + buf_idx, 0, 56 - buf_idx);
-
-    /* Append length (big-endian) */
-    ctx->buffer[56] = (uint8_t)(ctx->count >> 56);
-    ctx->buffer[57] = (uint8_t)(ctx->count >> 48);
-    ctx->buffer[58] = (uint8_t)(ctx->count >> 40);
-    ctx->buffer[59] = (uint8_t)(ctx->count >> 32);
-    ctx->buffer[60] = (uint8_t)(ctx->count >> 24);
-    ctx->buffer[61] = (uint8_t)(ctx->count >> 16);
-    ctx->buffer[62] = (uint8_t)(ctx->count >> 8);
-    ctx->buffer[63] = (uint8_t)(ctx->count);
-
-    sha256_transform(ctx, ctx->buffer);
-
-    /* Output digest (big-endian) */
-    for (int i = 0; i < 8; i++) {
-        digest[i*4]   = (uint8_t)(ctx->state[i] >> 24);
-        digest[i*4+1] = (uint8_t)(ctx->state[i] >> 16);
-        digest[i*4+2] = (uint8_t)(ctx->state[i] >> 8);
-        digest[i*4+3] = (uint8_t)(ctx->state[i]);
-    }
-
-    /* Clear sensitive data */
-    memset(ctx, 0, sizeof(*ctx));
+    sha256_final(ctx, digest);
 }
 
 void aether_sha256(const void* data, size_t len, uint8_t digest[32]) {
-    Aether_SHA256_Context ctx;
-    aether_sha256_init(&ctx);
-    aether_sha256_update(&ctx, data, len);
-    aether_sha256_final(&ctx, digest);
+    sha256(data, len, digest);
 }
 
 /*============================================================================
@@ -216,9 +53,9 @@ void aether_sha256(const void* data, size_t len, uint8_t digest[32]) {
 #define HMAC_IPAD 0x36
 #define HMAC_OPAD 0x5c
 
-void aether_hmac_sha256_init(Aether_HMAC_Context* ctx,
-                              const uint8_t* key, size_t key_len) {
-    if (ctx == NULL || key == NULL) return;
+void aether_hmac_key_init(Aether_HMAC_Key* hk,
+                           const uint8_t* key, size_t key_len) {
+    if (hk == NULL || key == NULL) return;
 
     uint8_t key_block[HMAC_BLOCK_SIZE];
     memset(key_block, 0, sizeof(key_block));
@@ -230,22 +67,51 @@ void aether_hmac_sha256_init(Aether_HMAC_Context* ctx,
         memcpy(key_block, key, key_len);
     }
 
-    /* Prepare opad key (store for final) */
+    /* Absorb (key ^ ipad) and (key ^ opad); each fills exactly one block */
+    uint8_t pad_key[HMAC_BLOCK_SIZE];
     for (int i = 0; i < HMAC_BLOCK_SIZE; i++) {
-        ctx->key_pad[i] = key_block[i] ^ HMAC_OPAD;
+        pad_key[i] = key_block[i] ^ HMAC_IPAD;
     }
+    Aether_SHA256_Context sha_ctx;
+    aether_sha256_init(&sha_ctx);
+    aether_sha256_update(&sha_ctx, pad_key, HMAC_BLOCK_SIZE);
+    memcpy(hk->inner, sha_ctx.state, sizeof(hk->inner));
 
-    /* Initialize inner hash with ipad */
-    aether_sha256_init(&ctx->sha_ctx);
-    uint8_t ipad_key[HMAC_BLOCK_SIZE];
     for (int i = 0; i < HMAC_BLOCK_SIZE; i++) {
-        ipad_key[i] = key_block[i] ^ HMAC_IPAD;
+        pad_key[i] = key_block[i] ^ HMAC_OPAD;
     }
-    aether_sha256_update(&ctx->sha_ctx, ipad_key, HMAC_BLOCK_SIZE);
+    aether_sha256_init(&sha_ctx);
+    aether_sha256_update(&sha_ctx, pad_key, HMAC_BLOCK_SIZE);
+    memcpy(hk->outer, sha_ctx.state, sizeof(hk->outer));
 
     /* Clear sensitive data */
     memset(key_block, 0, sizeof(key_block));
-    memset(ipad_key, 0, sizeof(ipad_key));
+    memset(pad_key, 0, sizeof(pad_key));
+    memset(&sha_ctx, 0, sizeof(sha_ctx));
+}
+
+/* Resume a hash whose first (key pad) block produced state */
+static void aether_hmac_resume(Aether_SHA256_Context* ctx,
+                               const uint32_t state[8]) {
+    memcpy(ctx->state, state, sizeof(ctx->state));
+    ctx->count = HMAC_BLOCK_SIZE * 8;
+}
+
+void aether_hmac_sha256_init_key(Aether_HMAC_Context* ctx,
+                                  const Aether_HMAC_Key* hk) {
+    if (ctx == NULL || hk == NULL) return;
+    aether_hmac_resume(&ctx->sha_ctx, hk->inner);
+    aether_hmac_resume(&ctx->outer, hk->outer);
+}
+
+void aether_hmac_sha256_init(Aether_HMAC_Context* ctx,
+                              const uint8_t* key, size_t key_len) {
+    if (ctx == NULL || key == NULL) return;
+
+    Aether_HMAC_Key hk;
+    aether_hmac_key_init(&hk, key, key_len);
+    aether_hmac_sha256_init_key(ctx, &hk);
+    memset(&hk, 0, sizeof(hk));
 }
 
 void aether_hmac_sha256_update(Aether_HMAC_Context* ctx,
@@ -261,15 +127,12 @@ void aether_hmac_sha256_final(Aether_HMAC_Context* ctx, uint8_t mac[32]) {
     uint8_t inner_hash[32];
     aether_sha256_final(&ctx->sha_ctx, inner_hash);
 
-    /* Outer hash: H(opad || inner_hash) */
-    aether_sha256_init(&ctx->sha_ctx);
-    aether_sha256_update(&ctx->sha_ctx, ctx->key_pad, HMAC_BLOCK_SIZE);
-    aether_sha256_update(&ctx->sha_ctx, inner_hash, 32);
-    aether_sha256_final(&ctx->sha_ctx, mac);
+    /* Outer hash: H(opad || inner_hash), opad block already absorbed */
+    aether_sha256_update(&ctx->outer, inner_hash, 32);
+    aether_sha256_final(&ctx->outer, mac);
 
     /* Clear sensitive data */
     memset(inner_hash, 0, sizeof(inner_hash));
-    memset(ctx->key_pad, 0, sizeof(ctx->key_pad));
 }
 
 void aether_hmac_sha256(const uint8_t* key, size_t key_len,
@@ -281,6 +144,50 @@ void aether_hmac_sha256(const uint8_t* key, size_t key_len,
     aether_hmac_sha256_final(&ctx, mac);
 }
 
+void aether_hmac_sha256_keyed(const Aether_HMAC_Key* hk,
+                               const void* data, size_t data_len,
+                               uint8_t mac[32]) {
+    Aether_HMAC_Context ctx;
+    aether_hmac_sha256_init_key(&ctx, hk);
+    aether_hmac_sha256_update(&ctx, data, data_len);
+    aether_hmac_sha256_final(&ctx, mac);
+}
+
+void aether_hmac_sha256_multi(const Aether_HMAC_Key* const keys[],
+                               const void* const data[],
+                               const size_t data_len[],
+                               size_t count,
+                               uint8_t* macs) {
+    if (keys == NULL || data == NULL || data_len == NULL || macs == NULL) return;
+
+    Aether_SHA256_Context ctx[SHA256_MULTI_LANES];
+    const Aether_SHA256_Context* start[SHA256_MULTI_LANES];
+    const void* inner_ptr[SHA256_MULTI_LANES];
+    size_t inner_len[SHA256_MULTI_LANES];
+    uint8_t inner_hash[SHA256_MULTI_LANES * 32];
+
+    for (size_t i = 0; i < count; i += SHA256_MULTI_LANES) {
+        size_t n = count - i < SHA256_MULTI_LANES ? count - i : SHA256_MULTI_LANES;
+
+        for (size_t j = 0; j < n; j++) {
+            aether_hmac_resume(&ctx[j], keys[i + j]->inner);
+            start[j] = &ctx[j];
+        }
+        sha256_multi_from(start, &data[i], &data_len[i], n, inner_hash);
+
+        for (size_t j = 0; j < n; j++) {
+            aether_hmac_resume(&ctx[j], keys[i + j]->outer);
+            inner_ptr[j] = &inner_hash[j * 32];
+            inner_len[j] = 32;
+        }
+        sha256_multi_from(start, inner_ptr, inner_len, n, &macs[i * 32]);
+    }
+
+    /* Clear sensitive data */
+    memset(inner_hash, 0, sizeof(inner_hash));
+    memset(ctx, 0, sizeof(ctx));
+}
+
 /**
  * @brief Constant-time byte comparison
  *
@@ -457,6 +364,26 @@ void aether_rate_consume(Aether_Rate_State* state) {
     }
 }
 
+/*
+ * Whether aether_rate_check() could pass at current_tick, without changing
+ * the bucket. Within one tick the bucket only drains, so false means the
+ * check will fail.
+ */
+static bool aether_rate_may_pass(const Aether_Rate_State* state,
+                                 const Aether_Rate_Config* config,
+                                 uint64_t current_tick) {
+    uint64_t max_tokens = (uint64_t)config->bucket_size << RATE_FP_SHIFT;
+    if (state->last_refill_tick == 0) return max_tokens > 0;
+
+    uint64_t elapsed = current_tick - state->last_refill_tick;
+    uint64_t tokens = state->tokens;
+    if (elapsed > 0) {
+        tokens += (elapsed * config->tokens_per_second * RATE_FP_ONE) /
+                  config->ticks_per_second;
+    }
+    return tokens > 0;
+}
+
 uint32_t aether_rate_get_dropped(const Aether_Rate_State* state) {
     if (state == NULL) return 0;
     return state->dropped_packets;
@@ -577,6 +504,7 @@ void aether_security_destroy(Aether_Security_State* state) {
     /* Clear sensitive key material */
     for (uint32_t i = 0; i < AETHER_SECURITY_MAX_NODES; i++) {
         memset(state->permissions[i].key, 0, AETHER_HMAC_KEY_SIZE);
+        memset(&state->permissions[i].hmac_key, 0, sizeof(Aether_HMAC_Key));
     }
 
     memset(state, 0, sizeof(*state));
@@ -594,6 +522,7 @@ Seraph_Vbit aether_security_set_node_key(Aether_Security_State* state,
     Aether_Node_Permission* perm = &state->permissions[node_id];
     perm->node_id = node_id;
     memcpy(perm->key, key, AETHER_HMAC_KEY_SIZE);
+    aether_hmac_key_init(&perm->hmac_key, key, AETHER_HMAC_KEY_SIZE);
     perm->permissions = permissions;
     perm->authenticated = true;
 
@@ -660,16 +589,17 @@ typedef struct __attribute__((packed)) {
 /** Maximum valid message type */
 #define AETHER_MSG_TYPE_MAX 0x06
 
-Aether_Validate_Result aether_security_validate_frame(
+/**
+ * @brief Structural checks (step 1)
+ *
+ * On success *mac_offset is where the frame's HMAC trailer starts.
+ */
+static Aether_Validate_Result aether_validate_structure(
     Aether_Security_State* state,
     const void* frame_data,
     size_t frame_len,
     uint64_t current_tick,
-    uint16_t* src_node_out) {
-
-    if (state == NULL || frame_data == NULL || !state->initialized) {
-        return AETHER_VALIDATE_MALFORMED;
-    }
+    size_t* mac_offset) {
 
     /* ========================================
      * STEP 1: Structural Validation (BEFORE any other check)
@@ -748,6 +678,22 @@ Aether_Validate_Result aether_security_validate_frame(
         return AETHER_VALIDATE_MALFORMED;
     }
 
+    *mac_offset = claimed_total;
+    return AETHER_VALIDATE_OK;
+}
+
+/**
+ * @brief Rate limiting (step 2), on a structurally valid frame
+ */
+static Aether_Validate_Result aether_validate_rate(
+    Aether_Security_State* state,
+    const void* frame_data,
+    uint64_t current_tick) {
+
+    const Aether_Frame_Internal* frame =
+        (const Aether_Frame_Internal*)frame_data;
+    uint16_t src_node = frame->aether.src_node;
+
     /* ========================================
      * STEP 2: Rate Limiting (BEFORE crypto to prevent DoS)
      * ======================================== */
@@ -768,6 +714,24 @@ Aether_Validate_Result aether_security_validate_frame(
             return AETHER_VALIDATE_RATE_LIMITED;
         }
     }
+    return AETHER_VALIDATE_OK;
+}
+
+/**
+ * @brief HMAC presence checks (start of step 3)
+ *
+ * @p mac_offset is the trailer start from aether_validate_structure().
+ */
+static Aether_Validate_Result aether_validate_trailer(
+    Aether_Security_State* state,
+    const void* frame_data,
+    size_t frame_len,
+    size_t mac_offset,
+    uint64_t current_tick) {
+
+    const Aether_Frame_Internal* frame =
+        (const Aether_Frame_Internal*)frame_data;
+    uint16_t src_node = frame->aether.src_node;
 
     /* ========================================
      * STEP 3: HMAC Verification (after rate limit)
@@ -786,8 +750,7 @@ Aether_Validate_Result aether_security_validate_frame(
         }
 
         /* HMAC is appended after payload */
-        size_t hmac_offset = claimed_total;
-        if (frame_len < hmac_offset + AETHER_HMAC_DIGEST_SIZE) {
+        if (frame_len < mac_offset + AETHER_HMAC_DIGEST_SIZE) {
             aether_security_log_event(&state->log, current_tick, src_node,
                                        AETHER_SEC_EVENT_HMAC_FAILURE,
                                        frame->aether.seq_num, 0, 1);
@@ -795,24 +758,76 @@ Aether_Validate_Result aether_security_validate_frame(
             state->packets_rejected++;
             return AETHER_VALIDATE_HMAC_FAIL;
         }
+    }
 
-        /* Compute expected HMAC */
-        uint8_t expected_mac[32];
-        aether_hmac_sha256(perm->key, AETHER_HMAC_KEY_SIZE,
-                            frame_data, claimed_total,
-                            expected_mac);
+    return AETHER_VALIDATE_OK;
+}
 
-        /* Constant-time comparison */
-        const uint8_t* received_mac = (const uint8_t*)frame_data + hmac_offset;
-        if (!aether_hmac_verify(expected_mac, received_mac)) {
-            aether_security_log_event(&state->log, current_tick, src_node,
-                                       AETHER_SEC_EVENT_HMAC_FAILURE,
-                                       frame->aether.seq_num, 0, 2);
-            state->hmac_failures++;
-            state->packets_rejected++;
-            return AETHER_VALIDATE_HMAC_FAIL;
-        }
+/**
+ * @brief Checks that run before any crypto (steps 1-2, HMAC presence)
+ *
+ * On success *mac_offset is where the frame's HMAC trailer starts.
+ */
+static Aether_Validate_Result aether_validate_precheck(
+    Aether_Security_State* state,
+    const void* frame_data,
+    size_t frame_len,
+    uint64_t current_tick,
+    size_t* mac_offset) {
+
+    Aether_Validate_Result result = aether_validate_structure(
+        state, frame_data, frame_len, current_tick, mac_offset);
+    if (result == AETHER_VALIDATE_OK) {
+        result = aether_validate_rate(state, frame_data, current_tick);
+    }
+    if (result == AETHER_VALIDATE_OK) {
+        result = aether_validate_trailer(state, frame_data, frame_len,
+                                         *mac_offset, current_tick);
     }
+    return result;
+}
+
+/**
+ * @brief Compare a frame's HMAC trailer with the expected MAC (step 3)
+ */
+static Aether_Validate_Result aether_validate_mac(
+    Aether_Security_State* state,
+    const void* frame_data,
+    size_t mac_offset,
+    const uint8_t expected_mac[32],
+    uint64_t current_tick) {
+
+    const Aether_Frame_Internal* frame =
+        (const Aether_Frame_Internal*)frame_data;
+    uint16_t src_node = frame->aether.src_node;
+
+    /* Constant-time comparison */
+    const uint8_t* received_mac = (const uint8_t*)frame_data + mac_offset;
+    if (!aether_hmac_verify(expected_mac, received_mac)) {
+        aether_security_log_event(&state->log, current_tick, src_node,
+                                   AETHER_SEC_EVENT_HMAC_FAILURE,
+                                   frame->aether.seq_num, 0, 2);
+        state->hmac_failures++;
+        state->packets_rejected++;
+        return AETHER_VALIDATE_HMAC_FAIL;
+    }
+    return AETHER_VALIDATE_OK;
+}
+
+/**
+ * @brief Checks after authentication (steps 4-5) and success accounting
+ *
+ * The rate-limit token is consumed here, once the frame has passed.
+ */
+static Aether_Validate_Result aether_validate_finish(
+    Aether_Security_State* state,
+    const void* frame_data,
+    uint64_t current_tick,
+    uint16_t* src_node_out) {
+
+    const Aether_Frame_Internal* frame =
+        (const Aether_Frame_Internal*)frame_data;
+    uint16_t src_node = frame->aether.src_node;
 
     /* ========================================
      * STEP 4: Replay Detection (after HMAC to ensure authenticity)
@@ -892,6 +907,152 @@ Aether_Validate_Result aether_security_validate_frame(
     return AETHER_VALIDATE_OK;
 }
 
+Aether_Validate_Result aether_security_validate_frame(
+    Aether_Security_State* state,
+    const void* frame_data,
+    size_t frame_len,
+    uint64_t current_tick,
+    uint16_t* src_node_out) {
+
+    if (state == NULL || frame_data == NULL || !state->initialized) {
+        return AETHER_VALIDATE_MALFORMED;
+    }
+
+    size_t mac_offset = 0;
+    Aether_Validate_Result result = aether_validate_precheck(
+        state, frame_data, frame_len, current_tick, &mac_offset);
+    if (result != AETHER_VALIDATE_OK) {
+        return result;
+    }
+
+    if (state->flags & AETHER_SEC_FLAG_REQUIRE_HMAC) {
+        const Aether_Frame_Internal* frame =
+            (const Aether_Frame_Internal*)frame_data;
+
+        /* Compute expected HMAC from the node's precomputed key */
+        uint8_t expected_mac[32];
+        aether_hmac_sha256_keyed(&state->permissions[frame->aether.src_node].hmac_key,
+                                  frame_data, mac_offset, expected_mac);
+
+        result = aether_validate_mac(state, frame_data, mac_offset,
+                                     expected_mac, current_tick);
+        if (result != AETHER_VALIDATE_OK) {
+            return result;
+        }
+    }
+
+    return aether_validate_finish(state, frame_data, current_tick, src_node_out);
+}
+
+size_t aether_security_validate_frames(
+    Aether_Security_State* state,
+    const void* const frames[],
+    const size_t frame_lens[],
+    size_t count,
+    uint64_t current_tick,
+    Aether_Validate_Result results[],
+    uint16_t src_nodes[]) {
+
+    if (results == NULL) return 0;
+    if (state == NULL || frames == NULL || frame_lens == NULL ||
+        !state->initialized) {
+        for (size_t i = 0; i < count; i++) {
+            results[i] = AETHER_VALIDATE_MALFORMED;
+        }
+        return 0;
+    }
+
+    bool rate_limit = (state->flags & AETHER_SEC_FLAG_RATE_LIMIT) != 0;
+    bool require_hmac = (state->flags & AETHER_SEC_FLAG_REQUIRE_HMAC) != 0;
+    size_t passed = 0;
+
+    for (size_t base = 0; base < count; base += SHA256_MULTI_LANES) {
+        size_t n = count - base < SHA256_MULTI_LANES ? count - base : SHA256_MULTI_LANES;
+
+        size_t mac_offset[SHA256_MULTI_LANES];
+        int mac_slot[SHA256_MULTI_LANES];
+        const Aether_HMAC_Key* keys[SHA256_MULTI_LANES];
+        const void* macced[SHA256_MULTI_LANES];
+        size_t macced_len[SHA256_MULTI_LANES];
+        uint8_t expected[SHA256_MULTI_LANES * 32];
+        size_t macs = 0;
+
+        /*
+         * Structural checks, then MACs for the frames that can still get
+         * a rate token. Buckets are only peeked here: tokens are taken in
+         * order below, once a frame has passed, as in the per-frame path.
+         */
+        for (size_t j = 0; j < n; j++) {
+            size_t i = base + j;
+            mac_slot[j] = -1;
+            if (frames[i] == NULL) {
+                results[i] = AETHER_VALIDATE_MALFORMED;
+                continue;
+            }
+            results[i] = aether_validate_structure(state, frames[i], frame_lens[i],
+                                                   current_tick, &mac_offset[j]);
+            if (results[i] != AETHER_VALIDATE_OK || !require_hmac) continue;
+
+            uint16_t src_node = ((const Aether_Frame_Internal*)frames[i])->aether.src_node;
+            if (rate_limit && !aether_rate_may_pass(&state->rate[src_node],
+                                                    &state->rate_config, current_tick)) {
+                continue;
+            }
+            keys[macs] = &state->permissions[src_node].hmac_key;
+            macced[macs] = frames[i];
+            macced_len[macs] = mac_offset[j];
+            mac_slot[j] = (int)macs++;
+        }
+
+        aether_hmac_sha256_multi(keys, macced, macced_len, macs, expected);
+
+        /* Remaining steps in order, exactly as aether_security_validate_frame() */
+        for (size_t j = 0; j < n; j++) {
+            size_t i = base + j;
+            if (results[i] != AETHER_VALIDATE_OK) continue;
+
+            results[i] = aether_validate_rate(state, frames[i], current_tick);
+            if (results[i] == AETHER_VALIDATE_OK) {
+                results[i] = aether_validate_trailer(state, frames[i], frame_lens[i],
+                                                     mac_offset[j], current_tick);
+            }
+            if (results[i] == AETHER_VALIDATE_OK && require_hmac) {
+                uint8_t one[32];
+                const uint8_t* mac = one;
+                if (mac_slot[j] >= 0) {
+                    mac = &expected[(size_t)mac_slot[j] * 32];
+                } else {
+                    /* Only if the peek was wrong; the bucket drains within a tick */
+                    uint16_t src_node =
+                        ((const Aether_Frame_Internal*)frames[i])->aether.src_node;
+                    aether_hmac_sha256_keyed(&state->permissions[src_node].hmac_key,
+                                             frames[i], mac_offset[j], one);
+                }
+                results[i] = aether_validate_mac(state, frames[i], mac_offset[j],
+                                                 mac, current_tick);
+            }
+            if (results[i] != AETHER_VALIDATE_OK) continue;
+
+            uint16_t src_node = 0;
+            results[i] = aether_validate_finish(state, frames[i], current_tick, &src_node);
+            if (results[i] == AETHER_VALIDATE_OK) {
+                if (src_nodes) src_nodes[i] = src_node;
+                if (state->flags & AETHER_SEC_FLAG_ENFORCE_REPLAY) {
+                    const Aether_Frame_Internal* frame =
+                        (const Aether_Frame_Internal*)frames[i];
+                    aether_replay_accept(&state->replay[src_node],
+                                         frame->aether.seq_num);
+                }
+                passed++;
+            }
+        }
+
+        memset(expected, 0, sizeof(expected));
+    }
+
+    return passed;
+}
+
 void aether_security_accept_packet(Aether_Security_State* state,
                                     uint16_t src_node,
                                     uint32_t seq_num) {
@@ -917,9 +1078,7 @@ Seraph_Vbit aether_security_compute_hmac(const Aether_Security_State* state,
         return SERAPH_VBIT_FALSE;
     }
 
-    aether_hmac_sha256(perm->key, AETHER_HMAC_KEY_SIZE,
-                        frame_data, frame_len,
-                        hmac_out);
+    aether_hmac_sha256_keyed(&perm->hmac_key, frame_data, frame_len, hmac_out);
 
     return SERAPH_VBIT_TRUE;
 }
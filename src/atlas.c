@@ -36,6 +36,26 @@
     #include <sys/stat.h>
     #include <fcntl.h>
     #include <unistd.h>
+    #include <sched.h>
+    #include <signal.h>
+    #include <time.h>
+#endif
+
+/* Volatile transaction state lives on the host heap, not in Atlas */
+#ifdef SERAPH_KERNEL
+    #define atlas_heap_calloc(n, size) seraph_kcalloc((n), (size))
+    #define atlas_heap_free(ptr)       seraph_kfree(ptr)
+#else
+    #define atlas_heap_calloc(n, size) calloc((n), (size))
+    #define atlas_heap_free(ptr)       free(ptr)
+#endif
+
+/* Checkpoint validation fans out over C11 threads where the host has them */
+#if !defined(SERAPH_KERNEL) && !defined(__STDC_NO_THREADS__) && defined(__has_include)
+#if __has_include(<threads.h>)
+    #define ATLAS_VALIDATE_THREADS 1
+    #include <threads.h>
+#endif
 #endif
 
 /*============================================================================
@@ -48,9 +68,6 @@
 /** Minimum allocation alignment */
 #define SERAPH_ATLAS_ALIGN 8
 
-/** Header size (Genesis + Gen Table + some padding) */
-#define SERAPH_ATLAS_HEADER_SIZE (SERAPH_PAGE_SIZE * 4)  /* 16KB header */
-
 /*============================================================================
  * Internal State
  *============================================================================*/
@@ -283,6 +300,330 @@ static size_t get_file_size(const char* path) {
 #endif
 }
 
+/**
+ * @brief Align value up to alignment
+ */
+static inline size_t align_up(size_t value, size_t alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+/*============================================================================
+ * Redo Log
+ *
+ * Commits append one record per transaction to a circular log region and
+ * return once the log is on disk; data pages are written back later by a
+ * checkpoint. Committers copy their record in under tx_lock, then one of
+ * them (the flush leader) syncs every appended record in a single flush
+ * while the others wait for log_flushed_lsn to pass their record.
+ *============================================================================*/
+
+static uint32_t crc32_update(uint32_t crc, const void* data, size_t size);
+
+/**
+ * @brief Write a byte range back to disk
+ */
+static bool atlas_flush(Seraph_Atlas* atlas, void* ptr, size_t size) {
+#if defined(SERAPH_KERNEL)
+    (void)ptr;
+    (void)size;
+    seraph_atlas_nvme_sync(atlas);
+    return true;
+#else
+    /* msync needs a page-aligned start */
+    uintptr_t start = (uintptr_t)ptr & ~(uintptr_t)SERAPH_PAGE_MASK;
+    size += (uintptr_t)ptr - start;
+#if defined(_WIN32)
+    return atlas_sync_windows(atlas, (void*)start, size);
+#else
+    return atlas_sync_posix(atlas, (void*)start, size);
+#endif
+#endif
+}
+
+static void atlas_sleep_us(uint32_t us) {
+#if defined(SERAPH_KERNEL)
+    (void)us;
+#elif defined(_WIN32)
+    Sleep((us + 999) / 1000);
+#else
+    struct timespec ts = { .tv_sec = us / 1000000, .tv_nsec = (long)(us % 1000000) * 1000 };
+    nanosleep(&ts, NULL);
+#endif
+}
+
+static void atlas_yield(void) {
+#if defined(SERAPH_KERNEL)
+    __asm__ volatile("pause");
+#elif defined(_WIN32)
+    SwitchToThread();
+#else
+    sched_yield();
+#endif
+}
+
+static inline bool atlas_has_log(const Seraph_Atlas* atlas) {
+    const Seraph_Atlas_Genesis* genesis = (const Seraph_Atlas_Genesis*)atlas->base;
+    return genesis->log_size != 0;
+}
+
+/**
+ * @brief Copy bytes into the log at an LSN, wrapping at the region end
+ */
+static void atlas_log_write(Seraph_Atlas* atlas, uint64_t lsn, const void* src, size_t len) {
+    const Seraph_Atlas_Genesis* genesis = (const Seraph_Atlas_Genesis*)atlas->base;
+    uint8_t* log = (uint8_t*)atlas->base + genesis->log_offset;
+    size_t pos = (size_t)(lsn % genesis->log_size);
+    size_t first = genesis->log_size - pos < len ? (size_t)(genesis->log_size - pos) : len;
+    memcpy(log + pos, src, first);
+    memcpy(log, (const uint8_t*)src + first, len - first);
+}
+
+static void atlas_log_read(const Seraph_Atlas* atlas, uint64_t lsn, void* dst, size_t len) {
+    const Seraph_Atlas_Genesis* genesis = (const Seraph_Atlas_Genesis*)atlas->base;
+    const uint8_t* log = (const uint8_t*)atlas->base + genesis->log_offset;
+    size_t pos = (size_t)(lsn % genesis->log_size);
+    size_t first = genesis->log_size - pos < len ? (size_t)(genesis->log_size - pos) : len;
+    memcpy(dst, log + pos, first);
+    memcpy((uint8_t*)dst + first, log, len - first);
+}
+
+static uint32_t atlas_log_crc(const Seraph_Atlas* atlas, uint32_t crc, uint64_t lsn, size_t len) {
+    const Seraph_Atlas_Genesis* genesis = (const Seraph_Atlas_Genesis*)atlas->base;
+    const uint8_t* log = (const uint8_t*)atlas->base + genesis->log_offset;
+    size_t pos = (size_t)(lsn % genesis->log_size);
+    size_t first = genesis->log_size - pos < len ? (size_t)(genesis->log_size - pos) : len;
+    crc = crc32_update(crc, log + pos, first);
+    return crc32_update(crc, log, len - first);
+}
+
+/**
+ * @brief Sync the log bytes in [from, to) to disk
+ */
+static bool atlas_log_flush_range(Seraph_Atlas* atlas, uint64_t from, uint64_t to) {
+    const Seraph_Atlas_Genesis* genesis = (const Seraph_Atlas_Genesis*)atlas->base;
+    uint8_t* log = (uint8_t*)atlas->base + genesis->log_offset;
+    if (to <= from) {
+        return true;
+    }
+    if (to - from >= genesis->log_size) {
+        return atlas_flush(atlas, log, genesis->log_size);
+    }
+    size_t pos = (size_t)(from % genesis->log_size);
+    size_t len = (size_t)(to - from);
+    size_t first = genesis->log_size - pos < len ? (size_t)(genesis->log_size - pos) : len;
+    bool ok = atlas_flush(atlas, log + pos, first);
+    if (len > first) {
+        ok = atlas_flush(atlas, log, len - first) && ok;
+    }
+    return ok;
+}
+
+static void atlas_log_advance_flushed(Seraph_Atlas* atlas, uint64_t lsn) {
+    uint64_t seen = atomic_load_explicit(&atlas->log_flushed_lsn, memory_order_relaxed);
+    while (seen < lsn &&
+           !atomic_compare_exchange_weak_explicit(&atlas->log_flushed_lsn, &seen, lsn,
+                                                  memory_order_release,
+                                                  memory_order_relaxed)) {
+    }
+}
+
+/**
+ * @brief Wait until the log is durable up to @p lsn, flushing as leader
+ */
+static bool atlas_log_wait_durable(Seraph_Atlas* atlas, uint64_t lsn) {
+    bool ok = true;
+    while (atomic_load_explicit(&atlas->log_flushed_lsn, memory_order_acquire) < lsn) {
+        if (atomic_flag_test_and_set_explicit(&atlas->log_flushing, memory_order_acquire)) {
+            atlas_yield();
+            continue;
+        }
+
+        uint64_t from = atomic_load_explicit(&atlas->log_flushed_lsn, memory_order_acquire);
+        if (from < lsn) {
+            /* Let more committers append before the flush they will share */
+            if (atlas->group_commit_us != 0) {
+                atlas_sleep_us(atlas->group_commit_us);
+            }
+            uint64_t to = atomic_load_explicit(&atlas->log_append_lsn, memory_order_acquire);
+            ok = atlas_log_flush_range(atlas, from, to);
+            atlas_log_advance_flushed(atlas, to);
+            atomic_fetch_add_explicit(&atlas->log_flushes, 1, memory_order_relaxed);
+        }
+
+        atomic_flag_clear_explicit(&atlas->log_flushing, memory_order_release);
+    }
+    return ok;
+}
+
+/**
+ * @brief Checkpoint synchronously when the log is full (caller holds tx_lock)
+ */
+static void atlas_log_checkpoint_locked(Seraph_Atlas* atlas) {
+    Seraph_Atlas_Genesis* genesis = (Seraph_Atlas_Genesis*)atlas->base;
+    uint64_t lsn = atomic_load_explicit(&atlas->log_append_lsn, memory_order_relaxed);
+
+    atlas_flush(atlas, atlas->base, atlas->size);
+    genesis->log_checkpoint_lsn = lsn;
+    atlas_flush(atlas, genesis, sizeof(*genesis));
+    atlas_log_advance_flushed(atlas, lsn);
+    atomic_fetch_add_explicit(&atlas->checkpoints, 1, memory_order_relaxed);
+}
+
+/**
+ * @brief Size of the log record for a transaction's in-Atlas dirty ranges
+ */
+static size_t atlas_log_record_size(const Seraph_Atlas* atlas, const Seraph_Atlas_Transaction* tx) {
+    size_t size = sizeof(Seraph_Atlas_Log_Record) + sizeof(Seraph_Atlas_Genesis);
+    for (uint32_t i = 0; i < tx->dirty_count; i++) {
+        const void* ptr = (const void*)(uintptr_t)tx->dirty_pages[i].offset;
+        if (!seraph_atlas_contains(atlas, ptr)) continue;
+        uint64_t offset = seraph_atlas_ptr_to_offset(atlas, ptr);
+        uint64_t length = tx->dirty_pages[i].size;
+        if (length > atlas->size - offset) length = atlas->size - offset;
+        size += sizeof(Seraph_Atlas_Log_Range) + align_up((size_t)length, 8);
+    }
+    return size;
+}
+
+/**
+ * @brief Append a transaction's redo record (caller holds tx_lock)
+ *
+ * @return LSN just past the record
+ */
+static uint64_t atlas_log_append(Seraph_Atlas* atlas, const Seraph_Atlas_Transaction* tx,
+                                 size_t size) {
+    Seraph_Atlas_Genesis* genesis = (Seraph_Atlas_Genesis*)atlas->base;
+    uint64_t lsn = atomic_load_explicit(&atlas->log_append_lsn, memory_order_relaxed);
+
+    if (lsn + size - genesis->log_checkpoint_lsn > genesis->log_size) {
+        atlas_log_checkpoint_locked(atlas);
+    }
+
+    Seraph_Atlas_Log_Record record = {
+        .magic = SERAPH_ATLAS_LOG_MAGIC,
+        .checksum = 0,
+        .lsn = lsn,
+        .size = size,
+        .generation = genesis->generation,
+        .range_count = 0,
+    };
+
+    /* Payload first, header (with its checksum) last */
+    uint64_t at = lsn + sizeof(record);
+    atlas_log_write(atlas, at, genesis, sizeof(*genesis));
+    at += sizeof(*genesis);
+
+    static const uint8_t zero_pad[8] = {0};
+    for (uint32_t i = 0; i < tx->dirty_count; i++) {
+        const void* ptr = (const void*)(uintptr_t)tx->dirty_pages[i].offset;
+        if (!seraph_atlas_contains(atlas, ptr)) continue;
+        Seraph_Atlas_Log_Range range = {
+            .offset = seraph_atlas_ptr_to_offset(atlas, ptr),
+            .length = tx->dirty_pages[i].size,
+        };
+        if (range.length > atlas->size - range.offset) {
+            range.length = atlas->size - range.offset;
+        }
+        atlas_log_write(atlas, at, &range, sizeof(range));
+        at += sizeof(range);
+        atlas_log_write(atlas, at, ptr, (size_t)range.length);
+        at += range.length;
+        size_t pad = align_up((size_t)range.length, 8) - (size_t)range.length;
+        atlas_log_write(atlas, at, zero_pad, pad);
+        at += pad;
+        record.range_count++;
+    }
+
+    uint32_t crc = crc32_update(0xFFFFFFFF, &record, sizeof(record));
+    crc = atlas_log_crc(atlas, crc, lsn + sizeof(record), size - sizeof(record));
+    record.checksum = crc ^ 0xFFFFFFFF;
+    atlas_log_write(atlas, lsn, &record, sizeof(record));
+
+    atomic_store_explicit(&atlas->log_append_lsn, lsn + size, memory_order_release);
+    return lsn + size;
+}
+
+/**
+ * @brief Replay committed records after the last checkpoint
+ *
+ * Stops at the first record that fails validation: that is where the
+ * log ended when the Atlas was last open.
+ */
+static void atlas_log_replay(Seraph_Atlas* atlas) {
+    Seraph_Atlas_Genesis* genesis = (Seraph_Atlas_Genesis*)atlas->base;
+    uint64_t lsn = genesis->log_checkpoint_lsn;
+    uint64_t log_end = genesis->log_offset + genesis->log_size;
+    uint32_t replayed = 0;
+
+    for (;;) {
+        Seraph_Atlas_Log_Record record;
+        atlas_log_read(atlas, lsn, &record, sizeof(record));
+        if (record.magic != SERAPH_ATLAS_LOG_MAGIC || record.lsn != lsn ||
+            record.size < sizeof(record) + sizeof(Seraph_Atlas_Genesis) ||
+            record.size > genesis->log_size || (record.size & 7) != 0) {
+            break;
+        }
+        uint32_t stored = record.checksum;
+        record.checksum = 0;
+        uint32_t crc = crc32_update(0xFFFFFFFF, &record, sizeof(record));
+        crc = atlas_log_crc(atlas, crc, lsn + sizeof(record), (size_t)record.size - sizeof(record));
+        if ((crc ^ 0xFFFFFFFF) != stored) {
+            break;
+        }
+
+        /* Walk the ranges once to check bounds before touching any data */
+        uint64_t at = lsn + sizeof(record) + sizeof(Seraph_Atlas_Genesis);
+        uint64_t end = lsn + record.size;
+        bool sane = true;
+        for (uint32_t i = 0; i < record.range_count && sane; i++) {
+            Seraph_Atlas_Log_Range range;
+            if (at + sizeof(range) > end) { sane = false; break; }
+            atlas_log_read(atlas, at, &range, sizeof(range));
+            at += sizeof(range) + align_up((size_t)range.length, 8);
+            sane = at <= end && range.offset >= sizeof(Seraph_Atlas_Genesis) &&
+                   range.offset <= atlas->size && range.length <= atlas->size - range.offset &&
+                   (range.offset + range.length <= genesis->log_offset ||
+                    range.offset >= log_end);
+        }
+        if (!sane) {
+            break;
+        }
+
+        at = lsn + sizeof(record) + sizeof(Seraph_Atlas_Genesis);
+        for (uint32_t i = 0; i < record.range_count; i++) {
+            Seraph_Atlas_Log_Range range;
+            atlas_log_read(atlas, at, &range, sizeof(range));
+            at += sizeof(range);
+            atlas_log_read(atlas, at, (uint8_t*)atlas->base + range.offset, (size_t)range.length);
+            at += align_up((size_t)range.length, 8);
+        }
+
+        /* Genesis as of the commit, keeping the log's own bookkeeping */
+        Seraph_Atlas_Genesis image;
+        atlas_log_read(atlas, lsn + sizeof(record), &image, sizeof(image));
+        image.magic = genesis->magic;
+        image.version = genesis->version;
+        image.gen_table_offset = genesis->gen_table_offset;
+        image.log_offset = genesis->log_offset;
+        image.log_size = genesis->log_size;
+        image.log_checkpoint_lsn = genesis->log_checkpoint_lsn;
+        memcpy(genesis, &image, sizeof(image));
+
+        lsn = end;
+        replayed++;
+    }
+
+    if (replayed != 0 && !atlas->read_only) {
+        /* Make the replayed state the new checkpoint */
+        atlas_flush(atlas, atlas->base, atlas->size);
+        genesis->log_checkpoint_lsn = lsn;
+        atlas_flush(atlas, genesis, sizeof(*genesis));
+    }
+
+    atomic_store(&atlas->log_append_lsn, lsn);
+    atomic_store(&atlas->log_flushed_lsn, lsn);
+}
+
 /**
  * @brief Format a new Atlas
  */
@@ -307,6 +648,18 @@ static void atlas_format(Seraph_Atlas* atlas) {
     genesis->commit_count = 0;
     genesis->abort_count = 0;
 
+    /* Reserve the redo log right after the header */
+    size_t log_size = SERAPH_ATLAS_LOG_SIZE;
+    if (log_size > atlas->size / 8) {
+        log_size = (atlas->size / 8) & ~(size_t)SERAPH_PAGE_MASK;
+    }
+    if (log_size >= SERAPH_ATLAS_LOG_MIN_SIZE) {
+        genesis->log_offset = SERAPH_ATLAS_HEADER_SIZE;
+        genesis->log_size = log_size;
+        genesis->log_checkpoint_lsn = 0;
+        genesis->next_alloc_offset += log_size;
+    }
+
     /* Initialize generation table */
     Seraph_Atlas_Gen_Table* gen_table =
         (Seraph_Atlas_Gen_Table*)((uint8_t*)atlas->base + genesis->gen_table_offset);
@@ -346,22 +699,201 @@ static bool atlas_recover(Seraph_Atlas* atlas) {
         return false;
     }
 
-    /* Recovery is instant with copy-on-write:
-     * Genesis always points to last committed state.
-     * Uncommitted data is orphaned and will be reclaimed. */
+    /* Validate the redo log region (zero in Atlases created without one) */
+    if (genesis->log_size != 0) {
+        if (genesis->log_offset < SERAPH_ATLAS_HEADER_SIZE ||
+            genesis->log_offset > atlas->size ||
+            genesis->log_size > atlas->size - genesis->log_offset ||
+            genesis->log_size < SERAPH_ATLAS_LOG_MIN_SIZE) {
+            return false;
+        }
+        /* Redo committed transactions whose pages never reached disk */
+        atlas_log_replay(atlas);
+    }
+
+    /* Uncommitted data is orphaned and will be reclaimed. */
 
     atlas->current_epoch = genesis->commit_count + 1;
 
     return true;
 }
 
+/*============================================================================
+ * Transaction Table and Version Stamps
+ *============================================================================*/
+
+/** Spins before yielding the CPU while waiting for tx_lock */
+#define ATLAS_LOCK_SPINS 64
+
+/** Read/write set slots allocated on first access */
+#define ATLAS_ACCESS_INITIAL 16
+
+static void atlas_spin_lock(atomic_flag* lock) {
+    uint32_t spins = 0;
+    while (atomic_flag_test_and_set_explicit(lock, memory_order_acquire)) {
+        if (++spins < ATLAS_LOCK_SPINS) {
+            continue;
+        }
+        spins = 0;
+        atlas_yield();
+    }
+}
+
+static void atlas_tx_lock(Seraph_Atlas* atlas) {
+    atlas_spin_lock(&atlas->tx_lock);
+}
+
+static void atlas_tx_unlock(Seraph_Atlas* atlas) {
+    atomic_flag_clear_explicit(&atlas->tx_lock, memory_order_release);
+}
+
 /**
- * @brief Align value up to alignment
+ * @brief Allocate the transaction table and per-page volatile state
  */
-static inline size_t align_up(size_t value, size_t alignment) {
-    return (value + alignment - 1) & ~(alignment - 1);
+static bool atlas_tx_init(Seraph_Atlas* atlas) {
+    atlas->page_count = atlas->size / SERAPH_PAGE_SIZE;
+    atlas->page_versions = atlas_heap_calloc(atlas->page_count, sizeof(_Atomic uint64_t));
+    atlas->transactions = atlas_heap_calloc(SERAPH_ATLAS_INITIAL_TRANSACTIONS,
+                                            sizeof(Seraph_Atlas_Transaction*));
+    atlas->cow_pending = atlas_heap_calloc(atlas->page_count, sizeof(uint16_t));
+    if (atlas->page_versions == NULL || atlas->transactions == NULL ||
+        atlas->cow_pending == NULL) {
+        atlas_heap_free((void*)atlas->page_versions);
+        atlas_heap_free(atlas->transactions);
+        atlas_heap_free(atlas->cow_pending);
+        atlas->page_versions = NULL;
+        atlas->transactions = NULL;
+        atlas->cow_pending = NULL;
+        return false;
+    }
+    atlas->tx_capacity = SERAPH_ATLAS_INITIAL_TRANSACTIONS;
+    atomic_flag_clear(&atlas->tx_lock);
+    atomic_flag_clear(&atlas->snap_lock);
+    atomic_flag_clear(&atlas->log_flushing);
+    atomic_flag_clear(&atlas->log_checkpointing);
+    return true;
+}
+
+static void atlas_tx_free(Seraph_Atlas* atlas) {
+    for (uint32_t i = 0; i < atlas->tx_capacity; i++) {
+        if (atlas->transactions[i] != NULL) {
+            atlas_heap_free(atlas->transactions[i]->access);
+            atlas_heap_free(atlas->transactions[i]);
+        }
+    }
+    atlas_heap_free(atlas->transactions);
+    atlas_heap_free((void*)atlas->page_versions);
+    atlas_heap_free(atlas->cow_pending);
+    atlas->transactions = NULL;
+    atlas->tx_capacity = 0;
+    atlas->page_versions = NULL;
+    atlas->cow_pending = NULL;
+    atlas->page_count = 0;
+}
+
+/**
+ * @brief Find a finished slot, or grow the table (caller holds tx_lock)
+ */
+static Seraph_Atlas_Transaction* atlas_tx_slot(Seraph_Atlas* atlas) {
+    for (uint32_t i = 0; i < atlas->tx_capacity; i++) {
+        Seraph_Atlas_Transaction* tx = atlas->transactions[i];
+        if (tx == NULL) {
+            tx = atlas_heap_calloc(1, sizeof(Seraph_Atlas_Transaction));
+            atlas->transactions[i] = tx;
+            return tx;
+        }
+        if (tx->state != SERAPH_ATLAS_TX_ACTIVE) {
+            return tx;
+        }
+    }
+
+    /* Every slot is active: double the table. Transactions are separate
+     * allocations, so pointers held by callers stay valid. */
+    if (atlas->tx_capacity >= SERAPH_ATLAS_MAX_TRANSACTIONS) {
+        return NULL;
+    }
+    uint32_t capacity = atlas->tx_capacity * 2;
+    Seraph_Atlas_Transaction** table =
+        atlas_heap_calloc(capacity, sizeof(Seraph_Atlas_Transaction*));
+    if (table == NULL) {
+        return NULL;
+    }
+    memcpy(table, atlas->transactions, atlas->tx_capacity * sizeof(*table));
+    atlas_heap_free(atlas->transactions);
+    atlas->transactions = table;
+
+    Seraph_Atlas_Transaction* tx = atlas_heap_calloc(1, sizeof(Seraph_Atlas_Transaction));
+    atlas->transactions[atlas->tx_capacity] = tx;
+    atlas->tx_capacity = capacity;
+    return tx;
+}
+
+static bool atlas_access_grow(Seraph_Atlas_Transaction* tx) {
+    uint32_t capacity = tx->access_capacity ? tx->access_capacity * 2 : ATLAS_ACCESS_INITIAL;
+    Seraph_Atlas_Access* slots = atlas_heap_calloc(capacity, sizeof(Seraph_Atlas_Access));
+    if (slots == NULL) {
+        return false;
+    }
+    for (uint32_t i = 0; i < tx->access_capacity; i++) {
+        Seraph_Atlas_Access* a = &tx->access[i];
+        if (a->page == 0) continue;
+        uint32_t h = (uint32_t)(a->page * 0x9E3779B97F4A7C15ULL >> 32) & (capacity - 1);
+        while (slots[h].page != 0) {
+            h = (h + 1) & (capacity - 1);
+        }
+        slots[h] = *a;
+    }
+    atlas_heap_free(tx->access);
+    tx->access = slots;
+    tx->access_capacity = capacity;
+    return true;
+}
+
+/**
+ * @brief Add the pages covering [ptr, ptr + size) to the read/write set
+ *
+ * The first access to a page records its current version stamp; later
+ * accesses only add flags, so validation compares against what the
+ * transaction saw first.
+ */
+static Seraph_Vbit atlas_tx_track(Seraph_Atlas_Transaction* tx, const void* ptr,
+                                  size_t size, uint32_t flags) {
+    Seraph_Atlas* atlas = tx->atlas;
+    uint64_t offset = seraph_atlas_ptr_to_offset(atlas, ptr);
+    if (offset == SERAPH_VOID_U64) {
+        return SERAPH_VBIT_VOID;
+    }
+    uint64_t first = offset / SERAPH_PAGE_SIZE;
+    uint64_t last = (offset + (size ? size - 1 : 0)) / SERAPH_PAGE_SIZE;
+    if (last >= atlas->page_count) {
+        last = atlas->page_count - 1;
+    }
+
+    for (uint64_t page = first; page <= last; page++) {
+        /* Keep the load factor at or below 1/2 */
+        if ((tx->access_count + 1) * 2 > tx->access_capacity && !atlas_access_grow(tx)) {
+            return SERAPH_VBIT_FALSE;
+        }
+        uint32_t mask = tx->access_capacity - 1;
+        uint32_t h = (uint32_t)((page + 1) * 0x9E3779B97F4A7C15ULL >> 32) & mask;
+        while (tx->access[h].page != 0 && tx->access[h].page != page + 1) {
+            h = (h + 1) & mask;
+        }
+
+        Seraph_Atlas_Access* a = &tx->access[h];
+        if (a->page == 0) {
+            a->page = page + 1;
+            a->version = atomic_load_explicit(&atlas->page_versions[page],
+                                              memory_order_acquire);
+            tx->access_count++;
+        }
+        a->flags |= flags;
+    }
+    return SERAPH_VBIT_TRUE;
 }
 
+static void atlas_fault_unregister(Seraph_Atlas* atlas);
+
 /*============================================================================
  * Initialization and Cleanup
  *============================================================================*/
@@ -436,6 +968,11 @@ Seraph_Vbit seraph_atlas_init(
         }
     }
 
+    if (!atlas_tx_init(atlas)) {
+        seraph_atlas_destroy(atlas);
+        return SERAPH_VBIT_VOID;
+    }
+
     atlas->initialized = true;
     atlas->next_tx_id = 1;
 
@@ -468,8 +1005,13 @@ void seraph_atlas_destroy(Seraph_Atlas* atlas) {
             }
         }
 
-        /* Sync before unmapping */
-        seraph_atlas_sync(atlas);
+        /* Sync before unmapping; a final checkpoint leaves nothing to replay */
+        if (seraph_atlas_checkpoint(atlas) != SERAPH_VBIT_TRUE) {
+            seraph_atlas_sync(atlas);
+        }
+
+        /* Committed snapshots keep pages protected; stop resolving faults */
+        atlas_fault_unregister(atlas);
 
 #if defined(SERAPH_KERNEL)
         seraph_atlas_nvme_close(atlas);
@@ -483,6 +1025,8 @@ void seraph_atlas_destroy(Seraph_Atlas* atlas) {
     /* Clear snapshot references */
     memset(atlas->snapshots, 0, sizeof(atlas->snapshots));
 
+    atlas_tx_free(atlas);
+
     atlas->initialized = false;
     atlas->base = NULL;
     atlas->size = 0;
@@ -528,28 +1072,45 @@ Seraph_Vbit seraph_atlas_set_root(Seraph_Atlas* atlas, void* root) {
  * Allocation
  *============================================================================*/
 
+/**
+ * @brief Reserve size bytes from the bump pointer, starting at a multiple of align
+ *
+ * The offset in Genesis is advanced with a compare-and-swap, so threads
+ * may allocate concurrently and the snapshot write fault handler may
+ * allocate page copies even when it interrupted an allocation.
+ *
+ * @return Offset of the reservation, or SERAPH_VOID_U64 if out of space
+ */
+static uint64_t atlas_bump(Seraph_Atlas* atlas, uint64_t size, uint64_t align) {
+    Seraph_Atlas_Genesis* genesis = seraph_atlas_genesis(atlas);
+    uint64_t current = __atomic_load_n(&genesis->next_alloc_offset, __ATOMIC_RELAXED);
+    uint64_t offset;
+    do {
+        offset = align_up(current, align);
+        if (offset > atlas->size || size > atlas->size - offset) {
+            return SERAPH_VOID_U64;
+        }
+    } while (!__atomic_compare_exchange_n(&genesis->next_alloc_offset, &current, offset + size,
+                                          true, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED));
+
+    __atomic_fetch_add(&genesis->total_allocated, size, __ATOMIC_RELAXED);
+    genesis->modified_at = 0;  /* Would be seraph_chronon_now() */
+    return offset;
+}
+
 void* seraph_atlas_alloc(Seraph_Atlas* atlas, size_t size) {
     if (!seraph_atlas_is_valid(atlas) || size == 0) {
         return NULL;
     }
 
-    Seraph_Atlas_Genesis* genesis = seraph_atlas_genesis(atlas);
-
     /* Align size */
     size = align_up(size, SERAPH_ATLAS_ALIGN);
 
-    /* Check if there's enough space */
-    if (genesis->next_alloc_offset + size > atlas->size) {
+    uint64_t offset = atlas_bump(atlas, size, SERAPH_ATLAS_ALIGN);
+    if (offset == SERAPH_VOID_U64) {
         return NULL;  /* Out of space */
     }
-
-    /* Simple bump allocation */
-    void* ptr = (uint8_t*)atlas->base + genesis->next_alloc_offset;
-    genesis->next_alloc_offset += size;
-    genesis->total_allocated += size;
-    genesis->modified_at = 0;  /* Would be seraph_chronon_now() */
-
-    return ptr;
+    return (uint8_t*)atlas->base + offset;
 }
 
 void* seraph_atlas_calloc(Seraph_Atlas* atlas, size_t size) {
@@ -568,22 +1129,12 @@ void* seraph_atlas_alloc_pages(Seraph_Atlas* atlas, size_t size) {
     /* Round up to page size */
     size = align_up(size, SERAPH_PAGE_SIZE);
 
-    Seraph_Atlas_Genesis* genesis = seraph_atlas_genesis(atlas);
-
     /* Align allocation offset to page boundary */
-    uint64_t aligned_offset = align_up(genesis->next_alloc_offset, SERAPH_PAGE_SIZE);
-
-    /* Check if there's enough space */
-    if (aligned_offset + size > atlas->size) {
+    uint64_t offset = atlas_bump(atlas, size, SERAPH_PAGE_SIZE);
+    if (offset == SERAPH_VOID_U64) {
         return NULL;
     }
-
-    void* ptr = (uint8_t*)atlas->base + aligned_offset;
-    genesis->next_alloc_offset = aligned_offset + size;
-    genesis->total_allocated += size;
-    genesis->modified_at = 0;
-
-    return ptr;
+    return (uint8_t*)atlas->base + offset;
 }
 
 void seraph_atlas_free(Seraph_Atlas* atlas, void* ptr, size_t size) {
@@ -663,25 +1214,27 @@ Seraph_Atlas_Transaction* seraph_atlas_begin(Seraph_Atlas* atlas) {
         return NULL;
     }
 
-    /* Find a free transaction slot */
-    Seraph_Atlas_Transaction* tx = NULL;
-    for (int i = 0; i < SERAPH_ATLAS_MAX_TRANSACTIONS; i++) {
-        if (atlas->transactions[i].state == SERAPH_ATLAS_TX_VOID ||
-            atlas->transactions[i].state == SERAPH_ATLAS_TX_COMMITTED ||
-            atlas->transactions[i].state == SERAPH_ATLAS_TX_ABORTED) {
-            tx = &atlas->transactions[i];
-            break;
-        }
-    }
+    atlas_tx_lock(atlas);
 
+    /* Find a free transaction slot, growing the table if all are active */
+    Seraph_Atlas_Transaction* tx = atlas_tx_slot(atlas);
     if (tx == NULL) {
-        return NULL;  /* No free transaction slots */
+        atlas_tx_unlock(atlas);
+        return NULL;  /* Out of memory or SERAPH_ATLAS_MAX_TRANSACTIONS active */
     }
 
     Seraph_Atlas_Genesis* genesis = seraph_atlas_genesis(atlas);
 
-    /* Initialize transaction */
+    /* Initialize transaction, keeping the read/write set allocation */
+    Seraph_Atlas_Access* access = tx->access;
+    uint32_t access_capacity = tx->access_capacity;
     memset(tx, 0, sizeof(Seraph_Atlas_Transaction));
+    if (access != NULL) {
+        memset(access, 0, access_capacity * sizeof(Seraph_Atlas_Access));
+    }
+    tx->atlas = atlas;
+    tx->access = access;
+    tx->access_capacity = access_capacity;
     tx->tx_id = atlas->next_tx_id++;
     tx->epoch = atlas->current_epoch;
     tx->start_generation = genesis->generation;
@@ -689,6 +1242,7 @@ Seraph_Atlas_Transaction* seraph_atlas_begin(Seraph_Atlas* atlas) {
     tx->state = SERAPH_ATLAS_TX_ACTIVE;
     tx->dirty_count = 0;
 
+    atlas_tx_unlock(atlas);
     return tx;
 }
 
@@ -700,33 +1254,88 @@ Seraph_Vbit seraph_atlas_commit(
         return SERAPH_VBIT_VOID;
     }
 
+    atlas_tx_lock(atlas);
+
     if (tx->state != SERAPH_ATLAS_TX_ACTIVE) {
+        atlas_tx_unlock(atlas);
         return SERAPH_VBIT_VOID;  /* Can only commit active transactions */
     }
 
     Seraph_Atlas_Genesis* genesis = seraph_atlas_genesis(atlas);
 
-    /* Check for conflicts (optimistic concurrency) */
-    if (genesis->generation != tx->start_generation) {
-        /* Another transaction modified data - conflict */
-        tx->state = SERAPH_ATLAS_TX_ABORTED;
-        genesis->abort_count++;
-        return SERAPH_VBIT_FALSE;
+    /* Check for conflicts (optimistic concurrency): every page this
+     * transaction read or wrote must still carry the version it saw. */
+    for (uint32_t i = 0; i < tx->access_capacity; i++) {
+        const Seraph_Atlas_Access* a = &tx->access[i];
+        if (a->page == 0) continue;
+        uint64_t current = atomic_load_explicit(&atlas->page_versions[a->page - 1],
+                                                memory_order_relaxed);
+        if (current != a->version) {
+            /* Another transaction modified data - conflict */
+            tx->state = SERAPH_ATLAS_TX_ABORTED;
+            genesis->abort_count++;
+            atlas_tx_unlock(atlas);
+            return SERAPH_VBIT_FALSE;
+        }
     }
 
     /* Increment generation to make this commit visible */
-    genesis->generation++;
+    uint64_t stamp = ++genesis->generation;
+    for (uint32_t i = 0; i < tx->access_capacity; i++) {
+        const Seraph_Atlas_Access* a = &tx->access[i];
+        if (a->page != 0 && (a->flags & SERAPH_ATLAS_ACCESS_WRITE)) {
+            atomic_store_explicit(&atlas->page_versions[a->page - 1], stamp,
+                                  memory_order_release);
+        }
+    }
     genesis->modified_at = 0;  /* Would be seraph_chronon_now() */
     genesis->last_commit_at = genesis->modified_at;
     genesis->commit_count++;
 
-    /* Sync all data to disk */
-    seraph_atlas_sync(atlas);
+    /* Append the redo record; records too large for the log fall back to
+     * flushing the data itself */
+    uint64_t log_end = 0;
+    uint64_t sync_lsn = 0;
+    if (atlas_has_log(atlas)) {
+        size_t record_size = atlas_log_record_size(atlas, tx);
+        if (record_size <= genesis->log_size / 2) {
+            log_end = atlas_log_append(atlas, tx, record_size);
+        } else {
+            /* Every record below this LSN has its data in memory already */
+            sync_lsn = atomic_load_explicit(&atlas->log_append_lsn, memory_order_relaxed);
+        }
+    }
 
     /* Mark transaction as committed */
     tx->state = SERAPH_ATLAS_TX_COMMITTED;
     atlas->current_epoch++;
 
+    atlas_tx_unlock(atlas);
+
+    if (log_end == 0) {
+        /* Sync all data to disk */
+        seraph_atlas_sync(atlas);
+
+        /* The sync is a checkpoint: replaying older records would roll
+         * this unlogged commit back */
+        if (atlas_has_log(atlas)) {
+            atlas_tx_lock(atlas);
+            if (sync_lsn > genesis->log_checkpoint_lsn) {
+                genesis->log_checkpoint_lsn = sync_lsn;
+            }
+            atlas_tx_unlock(atlas);
+            atlas_flush(atlas, genesis, sizeof(*genesis));
+        }
+        return SERAPH_VBIT_TRUE;
+    }
+
+    /* Group commit: one flush covers every record appended so far */
+    atlas_log_wait_durable(atlas, log_end);
+
+    if (log_end - genesis->log_checkpoint_lsn > genesis->log_size / 2) {
+        seraph_atlas_checkpoint(atlas);
+    }
+
     return SERAPH_VBIT_TRUE;
 }
 
@@ -738,7 +1347,10 @@ void seraph_atlas_abort(
         return;
     }
 
+    atlas_tx_lock(atlas);
+
     if (tx->state != SERAPH_ATLAS_TX_ACTIVE) {
+        atlas_tx_unlock(atlas);
         return;  /* Already finished */
     }
 
@@ -747,14 +1359,28 @@ void seraph_atlas_abort(
 
     /* Mark as aborted - dirty pages become garbage */
     tx->state = SERAPH_ATLAS_TX_ABORTED;
+
+    atlas_tx_unlock(atlas);
 }
 
-Seraph_Vbit seraph_atlas_tx_mark_dirty(
+Seraph_Vbit seraph_atlas_tx_mark_read(
     Seraph_Atlas_Transaction* tx,
-    void* ptr,
+    const void* ptr,
     size_t size
 ) {
-    if (tx == NULL || tx->state != SERAPH_ATLAS_TX_ACTIVE) {
+    if (tx == NULL || tx->state != SERAPH_ATLAS_TX_ACTIVE || tx->atlas == NULL) {
+        return SERAPH_VBIT_VOID;
+    }
+
+    return atlas_tx_track(tx, ptr, size, SERAPH_ATLAS_ACCESS_READ);
+}
+
+Seraph_Vbit seraph_atlas_tx_mark_dirty(
+    Seraph_Atlas_Transaction* tx,
+    void* ptr,
+    size_t size
+) {
+    if (tx == NULL || tx->state != SERAPH_ATLAS_TX_ACTIVE) {
         return SERAPH_VBIT_VOID;
     }
 
@@ -762,6 +1388,13 @@ Seraph_Vbit seraph_atlas_tx_mark_dirty(
         return SERAPH_VBIT_FALSE;  /* Too many dirty pages */
     }
 
+    /* Regions inside Atlas join the write set for conflict detection */
+    if (tx->atlas != NULL && seraph_atlas_contains(tx->atlas, ptr)) {
+        if (atlas_tx_track(tx, ptr, size, SERAPH_ATLAS_ACCESS_WRITE) != SERAPH_VBIT_TRUE) {
+            return SERAPH_VBIT_FALSE;
+        }
+    }
+
     /* Record the dirty region */
     tx->dirty_pages[tx->dirty_count].offset = (uint64_t)(uintptr_t)ptr;
     tx->dirty_pages[tx->dirty_count].size = size;
@@ -826,6 +1459,44 @@ Seraph_Vbit seraph_atlas_sync_range(
     return SERAPH_VBIT_TRUE;
 }
 
+Seraph_Vbit seraph_atlas_checkpoint(Seraph_Atlas* atlas) {
+    if (!seraph_atlas_is_valid(atlas) || !atlas_has_log(atlas) || atlas->read_only) {
+        return SERAPH_VBIT_VOID;
+    }
+
+    if (atomic_flag_test_and_set_explicit(&atlas->log_checkpointing, memory_order_acquire)) {
+        return SERAPH_VBIT_FALSE;  /* Another checkpoint is running */
+    }
+
+    /* Every record below this LSN has its data in memory already */
+    uint64_t lsn = atomic_load_explicit(&atlas->log_append_lsn, memory_order_acquire);
+
+    Seraph_Vbit result = SERAPH_VBIT_VOID;
+    if (atlas_flush(atlas, atlas->base, atlas->size)) {
+        Seraph_Atlas_Genesis* genesis = seraph_atlas_genesis(atlas);
+
+        atlas_tx_lock(atlas);
+        if (lsn > genesis->log_checkpoint_lsn) {
+            genesis->log_checkpoint_lsn = lsn;
+        }
+        atlas_tx_unlock(atlas);
+
+        if (atlas_flush(atlas, genesis, sizeof(*genesis))) {
+            atomic_fetch_add_explicit(&atlas->checkpoints, 1, memory_order_relaxed);
+            result = SERAPH_VBIT_TRUE;
+        }
+    }
+
+    atomic_flag_clear_explicit(&atlas->log_checkpointing, memory_order_release);
+    return result;
+}
+
+void seraph_atlas_set_group_commit(Seraph_Atlas* atlas, uint32_t window_us) {
+    if (atlas != NULL) {
+        atlas->group_commit_us = window_us;
+    }
+}
+
 /*============================================================================
  * Generation Table (Capability Persistence)
  *============================================================================*/
@@ -866,8 +1537,10 @@ uint64_t seraph_atlas_revoke(Seraph_Atlas* atlas, uint64_t alloc_id) {
         return SERAPH_VOID_U64;  /* Invalid allocation ID */
     }
 
-    /* Increment generation - all capabilities with old generation become invalid */
+    /* Increment generation - all capabilities with old generation become invalid.
+     * Revocation is not logged, so write the entry back now. */
     table->generations[alloc_id]++;
+    atlas_flush(atlas, &table->generations[alloc_id], sizeof(uint64_t));
 
     return table->generations[alloc_id];
 }
@@ -911,6 +1584,12 @@ Seraph_Atlas_Stats seraph_atlas_get_stats(const Seraph_Atlas* atlas) {
     stats.free_count = genesis->total_freed;
     stats.commit_count = genesis->commit_count;
     stats.abort_count = genesis->abort_count;
+    stats.log_size = genesis->log_size;
+    stats.log_used = atlas_has_log(atlas)
+        ? atomic_load(&atlas->log_append_lsn) - genesis->log_checkpoint_lsn
+        : 0;
+    stats.log_flushes = atomic_load(&atlas->log_flushes);
+    stats.checkpoints = atomic_load(&atlas->checkpoints);
     stats.initialized = atlas->initialized;
 
     return stats;
@@ -928,13 +1607,18 @@ Seraph_Atlas_Stats seraph_atlas_get_stats(const Seraph_Atlas* atlas) {
  *
  * COPY-ON-WRITE MECHANISM:
  *
- * When a snapshot is ACTIVE, writes to included pages trigger COW:
- *   1. Check if page is in snapshot's include set
- *   2. If not already copied, allocate COW storage
- *   3. Copy original page data to COW storage
- *   4. Allow write to proceed on original page
+ * When a snapshot is ACTIVE, included pages are write-protected and the
+ * first write to each one faults:
+ *   1. The fault handler finds the Atlas and the page's pending slots
+ *   2. For each slot, the page is copied to a fresh Atlas page
+ *   3. The copy is recorded in that snapshot's open-addressed index
+ *   4. The page is made writable and the write is retried
  *   5. Snapshot readers see COW copy; live readers see modified page
  *
+ * Per-page pending bits live on the host heap (cow_pending), so the
+ * fault path does no scanning and the number of copies is limited only
+ * by free space in Atlas.
+ *
  * CAUSALITY TRACKING:
  *
  * Each snapshot captures the vector clock at creation time. This enables:
@@ -951,22 +1635,346 @@ Seraph_Atlas_Stats seraph_atlas_get_stats(const Seraph_Atlas* atlas) {
 
 /*--- Internal Helpers ---*/
 
+/** cow_pending: low bits are snapshot slots */
+#define ATLAS_COW_SLOTS 0x00FFu
+
+_Static_assert(SERAPH_ATLAS_MAX_SNAPSHOTS <= 8,
+    "cow_pending has one bit per snapshot slot");
+
+/** Atlases with write-protected snapshot pages, searched on each fault */
+#define ATLAS_FAULT_MAX_ATLASES 16
+
+static Seraph_Atlas* _Atomic atlas_fault_atlases[ATLAS_FAULT_MAX_ATLASES];
+
+#ifdef SERAPH_KERNEL
+static Seraph_VMM* g_atlas_vmm = NULL;
+
+void seraph_atlas_attach_vmm(Seraph_VMM* vmm) {
+    g_atlas_vmm = vmm;
+}
+#endif
+
+static void atlas_snap_lock(Seraph_Atlas* atlas) {
+    atlas_spin_lock(&atlas->snap_lock);
+}
+
+static void atlas_snap_unlock(Seraph_Atlas* atlas) {
+    atomic_flag_clear_explicit(&atlas->snap_lock, memory_order_release);
+}
+
+/**
+ * @brief Make a run of Atlas pages read-only or writable again
+ */
+static void atlas_protect_pages(Seraph_Atlas* atlas, uint64_t first, uint64_t count,
+                                bool writable) {
+    if (count == 0) {
+        return;
+    }
+    uint8_t* addr = (uint8_t*)atlas->base + first * SERAPH_PAGE_SIZE;
+
+#if defined(SERAPH_KERNEL)
+    if (g_atlas_vmm == NULL) {
+        return;
+    }
+    for (uint64_t i = 0; i < count; i++) {
+        uint64_t virt = (uint64_t)(uintptr_t)(addr + i * SERAPH_PAGE_SIZE);
+        uint64_t flags = seraph_vmm_get_flags(g_atlas_vmm, virt) & ~SERAPH_PTE_ADDR_MASK;
+        if (!(flags & SERAPH_PTE_PRESENT)) {
+            continue;
+        }
+        flags = writable ? (flags | SERAPH_PTE_WRITABLE)
+                         : (flags & ~(uint64_t)SERAPH_PTE_WRITABLE);
+        seraph_vmm_map(g_atlas_vmm, virt, seraph_vmm_virt_to_phys(g_atlas_vmm, virt), flags);
+    }
+#elif defined(_WIN32)
+    DWORD old_protect;
+    VirtualProtect(addr, (SIZE_T)(count * SERAPH_PAGE_SIZE),
+                   writable ? PAGE_READWRITE : PAGE_READONLY, &old_protect);
+#else
+    mprotect(addr, (size_t)(count * SERAPH_PAGE_SIZE),
+             writable ? PROT_READ | PROT_WRITE : PROT_READ);
+#endif
+}
+
+#if !defined(SERAPH_KERNEL) && !defined(_WIN32)
+static struct sigaction atlas_prev_segv;
+
+static void atlas_segv_handler(int sig, siginfo_t* info, void* context) {
+    if (seraph_vbit_is_true(seraph_atlas_snapshot_write_fault(info->si_addr))) {
+        return;  /* Page copied and writable: the write is retried */
+    }
+    if (atlas_prev_segv.sa_flags & SA_SIGINFO) {
+        atlas_prev_segv.sa_sigaction(sig, info, context);
+    } else if (atlas_prev_segv.sa_handler != SIG_DFL &&
+               atlas_prev_segv.sa_handler != SIG_IGN) {
+        atlas_prev_segv.sa_handler(sig);
+    } else {
+        /* Not ours: restore the default action and let the access fault again */
+        sigaction(sig, &atlas_prev_segv, NULL);
+    }
+}
+#elif defined(_WIN32)
+static LONG CALLBACK atlas_fault_filter(PEXCEPTION_POINTERS info) {
+    const EXCEPTION_RECORD* record = info->ExceptionRecord;
+    if (record->ExceptionCode == EXCEPTION_ACCESS_VIOLATION &&
+        record->NumberParameters >= 2 && record->ExceptionInformation[0] == 1 &&
+        seraph_vbit_is_true(seraph_atlas_snapshot_write_fault(
+            (void*)record->ExceptionInformation[1]))) {
+        return EXCEPTION_CONTINUE_EXECUTION;
+    }
+    return EXCEPTION_CONTINUE_SEARCH;
+}
+#endif
+
+/**
+ * @brief Install the process-wide write fault handler once
+ */
+static bool atlas_fault_install(void) {
+    static _Atomic int state = 0;  /* 0 = none, 1 = installing, 2 = installed */
+    int expected = 0;
+    if (atomic_compare_exchange_strong(&state, &expected, 1)) {
+        bool ok = true;
+#if defined(SERAPH_KERNEL)
+        /* The VMM page fault handler calls seraph_atlas_snapshot_write_fault() */
+#elif defined(_WIN32)
+        ok = AddVectoredExceptionHandler(1, atlas_fault_filter) != NULL;
+#else
+        struct sigaction sa;
+        memset(&sa, 0, sizeof(sa));
+        sa.sa_sigaction = atlas_segv_handler;
+        sa.sa_flags = SA_SIGINFO;
+        sigemptyset(&sa.sa_mask);
+        ok = sigaction(SIGSEGV, &sa, &atlas_prev_segv) == 0;
+#endif
+        atomic_store(&state, ok ? 2 : 0);
+        return ok;
+    }
+    while ((expected = atomic_load(&state)) == 1) {
+        atlas_yield();
+    }
+    return expected == 2;
+}
+
+static bool atlas_fault_register(Seraph_Atlas* atlas) {
+    for (int i = 0; i < ATLAS_FAULT_MAX_ATLASES; i++) {
+        if (atomic_load(&atlas_fault_atlases[i]) == atlas) {
+            return true;
+        }
+    }
+    for (int i = 0; i < ATLAS_FAULT_MAX_ATLASES; i++) {
+        Seraph_Atlas* expected = NULL;
+        if (atomic_compare_exchange_strong(&atlas_fault_atlases[i], &expected, atlas)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void atlas_fault_unregister(Seraph_Atlas* atlas) {
+    for (int i = 0; i < ATLAS_FAULT_MAX_ATLASES; i++) {
+        Seraph_Atlas* expected = atlas;
+        atomic_compare_exchange_strong(&atlas_fault_atlases[i], &expected, NULL);
+    }
+}
+
+static int snapshot_slot(const Seraph_Atlas* atlas, const Seraph_Atlas_Snapshot* snapshot) {
+    for (int i = 0; i < SERAPH_ATLAS_MAX_SNAPSHOTS; i++) {
+        if (atlas->snapshots[i] == snapshot) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Allocate whole pages for snapshot metadata or copies
+ *
+ * These pages are marked so activation never write-protects them: the
+ * fault handler writes them while resolving faults.
+ */
+static void* snapshot_alloc_meta(Seraph_Atlas* atlas, size_t size) {
+    void* ptr = seraph_atlas_alloc_pages(atlas, size);
+    if (ptr != NULL) {
+        uint64_t first = seraph_atlas_ptr_to_offset(atlas, ptr) / SERAPH_PAGE_SIZE;
+        uint64_t count = align_up(size, SERAPH_PAGE_SIZE) / SERAPH_PAGE_SIZE;
+        for (uint64_t i = 0; i < count; i++) {
+            atlas->cow_pending[first + i] = SERAPH_ATLAS_COW_META;
+        }
+    }
+    return ptr;
+}
+
+static uint32_t snapshot_index_hash(uint64_t page_offset, uint32_t capacity) {
+    return (uint32_t)((page_offset / SERAPH_PAGE_SIZE) * 0x9E3779B97F4A7C15ULL >> 32) &
+           (capacity - 1);
+}
+
+static Seraph_Atlas_COW_Page* snapshot_index(
+    const Seraph_Atlas* atlas,
+    const Seraph_Atlas_Snapshot* snapshot
+) {
+    if (snapshot->cow_index_offset == 0) {
+        return NULL;
+    }
+    return (Seraph_Atlas_COW_Page*)seraph_atlas_offset_to_ptr(atlas, snapshot->cow_index_offset);
+}
+
 /**
  * @brief Find COW entry for a page
  */
 static Seraph_Atlas_COW_Page* snapshot_find_cow_page(
-    Seraph_Atlas_Snapshot* snapshot,
+    const Seraph_Atlas* atlas,
+    const Seraph_Atlas_Snapshot* snapshot,
     uint64_t page_offset
 ) {
-    for (uint32_t i = 0; i < snapshot->cow_page_count; i++) {
-        if ((snapshot->cow_pages[i].flags & SERAPH_ATLAS_COW_VALID) &&
-            snapshot->cow_pages[i].page_offset == page_offset) {
-            return &snapshot->cow_pages[i];
+    Seraph_Atlas_COW_Page* index = snapshot_index(atlas, snapshot);
+    if (index == NULL) {
+        return NULL;
+    }
+    uint32_t mask = snapshot->cow_index_capacity - 1;
+    for (uint32_t h = snapshot_index_hash(page_offset, snapshot->cow_index_capacity);
+         index[h].flags & SERAPH_ATLAS_COW_VALID; h = (h + 1) & mask) {
+        if (index[h].page_offset == page_offset) {
+            return &index[h];
         }
     }
     return NULL;
 }
 
+/**
+ * @brief Double the COW index, keeping the load factor at or below 1/2
+ */
+static bool snapshot_index_grow(Seraph_Atlas* atlas, Seraph_Atlas_Snapshot* snapshot) {
+    uint32_t old_capacity = snapshot->cow_index_capacity;
+    if (old_capacity >= (1u << 31)) {
+        return false;
+    }
+    uint32_t capacity = old_capacity ? old_capacity * 2 : SERAPH_ATLAS_COW_INDEX_INITIAL;
+    size_t bytes = (size_t)capacity * sizeof(Seraph_Atlas_COW_Page);
+    Seraph_Atlas_COW_Page* index = (Seraph_Atlas_COW_Page*)snapshot_alloc_meta(atlas, bytes);
+    if (index == NULL) {
+        return false;
+    }
+    memset(index, 0, bytes);
+
+    Seraph_Atlas_COW_Page* old = snapshot_index(atlas, snapshot);
+    for (uint32_t i = 0; old != NULL && i < old_capacity; i++) {
+        if (!(old[i].flags & SERAPH_ATLAS_COW_VALID)) continue;
+        uint32_t h = snapshot_index_hash(old[i].page_offset, capacity);
+        while (index[h].flags & SERAPH_ATLAS_COW_VALID) {
+            h = (h + 1) & (capacity - 1);
+        }
+        index[h] = old[i];
+    }
+    if (old != NULL) {
+        seraph_atlas_free(atlas, old, (size_t)old_capacity * sizeof(Seraph_Atlas_COW_Page));
+    }
+
+    snapshot->cow_index_offset = seraph_atlas_ptr_to_offset(atlas, index);
+    snapshot->cow_index_capacity = capacity;
+    return true;
+}
+
+/**
+ * @brief Copy one page into the snapshot (caller holds snap_lock)
+ *
+ * @return TRUE if copied, FALSE if already copied, VOID if out of space
+ *         (the snapshot is marked FAILED)
+ */
+static Seraph_Vbit snapshot_copy_page(
+    Seraph_Atlas* atlas,
+    Seraph_Atlas_Snapshot* snapshot,
+    uint64_t page
+) {
+    uint64_t page_offset = page * SERAPH_PAGE_SIZE;
+    if (snapshot_find_cow_page(atlas, snapshot, page_offset) != NULL) {
+        return SERAPH_VBIT_FALSE;  /* Already copied */
+    }
+
+    void* copy = NULL;
+    if (((uint64_t)snapshot->cow_page_count + 1) * 2 <= snapshot->cow_index_capacity ||
+        snapshot_index_grow(atlas, snapshot)) {
+        copy = snapshot_alloc_meta(atlas, SERAPH_PAGE_SIZE);
+    }
+    if (copy == NULL) {
+        snapshot->state = SERAPH_ATLAS_SNAP_FAILED;
+        return SERAPH_VBIT_VOID;
+    }
+
+    /* Copy original page data to COW storage */
+    memcpy(copy, (uint8_t*)atlas->base + page_offset, SERAPH_PAGE_SIZE);
+
+    Seraph_Atlas_COW_Page* index = snapshot_index(atlas, snapshot);
+    uint32_t h = snapshot_index_hash(page_offset, snapshot->cow_index_capacity);
+    while (index[h].flags & SERAPH_ATLAS_COW_VALID) {
+        h = (h + 1) & (snapshot->cow_index_capacity - 1);
+    }
+
+    /* Record COW entry */
+    Seraph_Atlas_COW_Page* cow = &index[h];
+    cow->page_offset = page_offset;
+    cow->copy_offset = seraph_atlas_ptr_to_offset(atlas, copy);
+    cow->modification_time = atlas->current_epoch;
+    cow->page_count = 1;
+    cow->flags = SERAPH_ATLAS_COW_VALID | SERAPH_ATLAS_COW_DIRTY;
+
+    /* Mark Genesis pages specially */
+    if (page_offset < sizeof(Seraph_Atlas_Genesis)) {
+        cow->flags |= SERAPH_ATLAS_COW_GENESIS;
+    }
+
+    snapshot->cow_page_count++;
+    snapshot->cow_storage_size += SERAPH_PAGE_SIZE;
+    return SERAPH_VBIT_TRUE;
+}
+
+/**
+ * @brief Drop a slot's pending pages and free its copies (caller holds snap_lock)
+ *
+ * Pages no other snapshot is waiting on become writable again.
+ */
+static void snapshot_release(Seraph_Atlas* atlas, int slot) {
+    Seraph_Atlas_Snapshot* snapshot = atlas->snapshots[slot];
+    uint16_t bit = (uint16_t)(1u << slot);
+
+    uint64_t run = 0;
+    uint64_t run_len = 0;
+    for (uint64_t page = 0; page < atlas->page_count; page++) {
+        uint16_t pending = atlas->cow_pending[page];
+        if (!(pending & bit)) {
+            atlas_protect_pages(atlas, run, run_len, true);
+            run_len = 0;
+            continue;
+        }
+        atlas->cow_pending[page] = (uint16_t)(pending & ~bit);
+        if ((pending & ATLAS_COW_SLOTS) != bit) {
+            atlas_protect_pages(atlas, run, run_len, true);
+            run_len = 0;
+            continue;  /* Another snapshot still needs a copy */
+        }
+        if (run_len++ == 0) {
+            run = page;
+        }
+    }
+    atlas_protect_pages(atlas, run, run_len, true);
+
+    Seraph_Atlas_COW_Page* index = snapshot_index(atlas, snapshot);
+    if (index != NULL) {
+        for (uint32_t i = 0; i < snapshot->cow_index_capacity; i++) {
+            if (index[i].flags & SERAPH_ATLAS_COW_VALID) {
+                seraph_atlas_free(atlas, seraph_atlas_offset_to_ptr(atlas, index[i].copy_offset),
+                                  (size_t)index[i].page_count * SERAPH_PAGE_SIZE);
+            }
+        }
+        seraph_atlas_free(atlas, index,
+                          (size_t)snapshot->cow_index_capacity * sizeof(Seraph_Atlas_COW_Page));
+    }
+    snapshot->cow_index_offset = 0;
+    snapshot->cow_index_capacity = 0;
+    snapshot->cow_page_count = 0;
+    snapshot->cow_storage_size = 0;
+}
+
 /**
  * @brief Capture current vector clock into snapshot
  */
@@ -1051,24 +2059,29 @@ Seraph_Atlas_Snapshot* seraph_atlas_snapshot_begin(
     /* Find or allocate a snapshot slot */
     Seraph_Atlas_Snapshot* snapshot = NULL;
 
+    atlas_snap_lock(atlas);
     for (int i = 0; i < SERAPH_ATLAS_MAX_SNAPSHOTS; i++) {
         if (atlas->snapshots[i] == NULL) {
-            /* Allocate new snapshot in Atlas (persistent) */
-            snapshot = (Seraph_Atlas_Snapshot*)seraph_atlas_calloc(atlas,
+            /* Allocate new snapshot in Atlas (persistent), on pages of its own */
+            snapshot = (Seraph_Atlas_Snapshot*)snapshot_alloc_meta(atlas,
                 sizeof(Seraph_Atlas_Snapshot));
             if (snapshot == NULL) {
+                atlas_snap_unlock(atlas);
                 return NULL;  /* Allocation failed */
             }
+            memset(snapshot, 0, sizeof(Seraph_Atlas_Snapshot));
             atlas->snapshots[i] = snapshot;
             break;
         }
         if (atlas->snapshots[i]->state == SERAPH_ATLAS_SNAP_VOID ||
             atlas->snapshots[i]->state == SERAPH_ATLAS_SNAP_FAILED) {
             snapshot = atlas->snapshots[i];
+            snapshot_release(atlas, i);
             memset(snapshot, 0, sizeof(Seraph_Atlas_Snapshot));
             break;
         }
     }
+    atlas_snap_unlock(atlas);
 
     if (snapshot == NULL) {
         return NULL;  /* No free slots */
@@ -1097,8 +2110,9 @@ Seraph_Atlas_Snapshot* seraph_atlas_snapshot_begin(
     snapshot->included_pages = 0;
 
     /* Initialize COW state */
+    snapshot->cow_index_offset = 0;
+    snapshot->cow_index_capacity = 0;
     snapshot->cow_page_count = 0;
-    snapshot->cow_storage_offset = 0;
     snapshot->cow_storage_size = 0;
 
     /* Copy Genesis for restore */
@@ -1130,32 +2144,30 @@ Seraph_Vbit seraph_atlas_snapshot_include(
         return SERAPH_VBIT_VOID;  /* Can only add pages in PREPARING state */
     }
 
-    if (!seraph_atlas_contains(atlas, ptr)) {
+    int slot = snapshot_slot(atlas, snapshot);
+    if (slot < 0 || !seraph_atlas_contains(atlas, ptr)) {
         return SERAPH_VBIT_VOID;
     }
 
     /* Calculate page range */
     uint64_t start_offset = seraph_atlas_ptr_to_offset(atlas, ptr);
     uint64_t end_offset = start_offset + size;
-
-    /* Align to page boundaries */
-    uint64_t page_start = (start_offset / SERAPH_PAGE_SIZE) * SERAPH_PAGE_SIZE;
-    uint64_t page_end = ((end_offset + SERAPH_PAGE_SIZE - 1) / SERAPH_PAGE_SIZE) * SERAPH_PAGE_SIZE;
-
-    if (page_end > atlas->size) {
-        page_end = atlas->size;
-    }
-
-    /* Count pages to include */
-    uint32_t page_count = (uint32_t)((page_end - page_start) / SERAPH_PAGE_SIZE);
-
-    /* Check if we can track all pages */
-    if (snapshot->included_page_count + page_count > SERAPH_ATLAS_SNAPSHOT_MAX_PAGES) {
-        return SERAPH_VBIT_FALSE;  /* Too many pages */
+    uint64_t first = start_offset / SERAPH_PAGE_SIZE;
+    uint64_t last = (end_offset + SERAPH_PAGE_SIZE - 1) / SERAPH_PAGE_SIZE;
+    if (last > atlas->page_count) {
+        last = atlas->page_count;
+    }
+
+    /* Mark pages as pending a copy for this slot */
+    uint16_t bit = (uint16_t)(1u << slot);
+    atlas_snap_lock(atlas);
+    for (uint64_t page = first; page < last; page++) {
+        if (!(atlas->cow_pending[page] & bit)) {
+            atlas->cow_pending[page] |= bit;
+            snapshot->included_page_count++;
+        }
     }
-
-    /* Mark pages as included (simplified - just track count) */
-    snapshot->included_page_count += page_count;
+    atlas_snap_unlock(atlas);
 
     return SERAPH_VBIT_TRUE;
 }
@@ -1172,7 +2184,19 @@ Seraph_Vbit seraph_atlas_snapshot_include_all(
         return SERAPH_VBIT_VOID;
     }
 
+    int slot = snapshot_slot(atlas, snapshot);
+    if (slot < 0) {
+        return SERAPH_VBIT_VOID;
+    }
+
     /* Include entire Atlas region */
+    uint16_t bit = (uint16_t)(1u << slot);
+    atlas_snap_lock(atlas);
+    for (uint64_t page = 0; page < atlas->page_count; page++) {
+        atlas->cow_pending[page] |= bit;
+    }
+    atlas_snap_unlock(atlas);
+
     snapshot->included_page_count = snapshot->total_page_count;
     snapshot->included_pages = SERAPH_VOID_U64;  /* All pages flag */
 
@@ -1198,22 +2222,56 @@ Seraph_Vbit seraph_atlas_snapshot_activate(
         return SERAPH_VBIT_VOID;  /* Must include at least one page */
     }
 
-    /* Allocate COW storage region (reserve space for potential copies) */
-    size_t cow_storage_size = (size_t)snapshot->included_page_count * SERAPH_PAGE_SIZE;
-    void* cow_storage = seraph_atlas_alloc_pages(atlas, cow_storage_size);
-
-    if (cow_storage == NULL) {
-        /* Not enough space - still activate but COW may fail later */
-        snapshot->cow_storage_offset = 0;
-        snapshot->cow_storage_size = 0;
-    } else {
-        snapshot->cow_storage_offset = seraph_atlas_ptr_to_offset(atlas, cow_storage);
-        snapshot->cow_storage_size = cow_storage_size;
+    int slot = snapshot_slot(atlas, snapshot);
+    if (slot < 0 || !atlas_fault_install() || !atlas_fault_register(atlas)) {
+        return SERAPH_VBIT_VOID;  /* Writes could not be intercepted */
     }
 
+    /*
+     * Never protect the header (Genesis is restored from its copy, and
+     * the generation table must not roll back), the redo log, snapshot
+     * pages, or space nothing has been allocated in yet.
+     */
+    Seraph_Atlas_Genesis* genesis = seraph_atlas_genesis(atlas);
+    uint64_t header_end = SERAPH_ATLAS_HEADER_SIZE / SERAPH_PAGE_SIZE;
+    uint64_t log_first = genesis->log_offset / SERAPH_PAGE_SIZE;
+    uint64_t log_end = align_up(genesis->log_offset + genesis->log_size,
+                                SERAPH_PAGE_SIZE) / SERAPH_PAGE_SIZE;
+    uint64_t data_end = align_up(genesis->next_alloc_offset, SERAPH_PAGE_SIZE) /
+                        SERAPH_PAGE_SIZE;
+    uint16_t bit = (uint16_t)(1u << slot);
+
+    atlas_snap_lock(atlas);
+
+    /* The snapshot captures Genesis as of activation */
+    memcpy(&snapshot->genesis_copy, genesis, sizeof(Seraph_Atlas_Genesis));
+
     /* Transition to active state */
     snapshot->state = SERAPH_ATLAS_SNAP_ACTIVE;
 
+    uint64_t run = 0;
+    uint64_t run_len = 0;
+    for (uint64_t page = 0; page < atlas->page_count; page++) {
+        uint16_t pending = atlas->cow_pending[page];
+        if ((pending & bit) &&
+            (page < header_end || (page >= log_first && page < log_end) ||
+             page >= data_end || (pending & SERAPH_ATLAS_COW_META))) {
+            pending = (uint16_t)(pending & ~bit);
+            atlas->cow_pending[page] = pending;
+        }
+        if (pending & bit) {
+            if (run_len++ == 0) {
+                run = page;
+            }
+        } else {
+            atlas_protect_pages(atlas, run, run_len, false);
+            run_len = 0;
+        }
+    }
+    atlas_protect_pages(atlas, run, run_len, false);
+
+    atlas_snap_unlock(atlas);
+
     /* Increment vector clock (activation is a causal event) */
     if (atlas->local_node_id < SERAPH_ATLAS_VCLOCK_MAX_NODES) {
         atlas->current_vclock[atlas->local_node_id]++;
@@ -1242,19 +2300,10 @@ Seraph_Vbit seraph_atlas_snapshot_commit(
     /* Record commit time */
     snapshot->commit_time = atlas->current_epoch;
 
-    /* Sync all COW pages to disk */
-    if (snapshot->cow_storage_offset != 0 && snapshot->cow_page_count > 0) {
-        void* cow_storage = seraph_atlas_offset_to_ptr(atlas, snapshot->cow_storage_offset);
-        if (cow_storage != NULL) {
-            seraph_atlas_sync_range(atlas, cow_storage,
-                (size_t)snapshot->cow_page_count * SERAPH_PAGE_SIZE);
-        }
-    }
-
-    /* Sync snapshot metadata */
+    /* Sync snapshot metadata; COW copies and the index go out with the final sync */
     seraph_atlas_sync_range(atlas, snapshot, sizeof(Seraph_Atlas_Snapshot));
 
-    /* Transition to committed state */
+    /* Transition to committed state; pages stay protected until delete */
     snapshot->state = SERAPH_ATLAS_SNAP_COMMITTED;
 
     /* Increment vector clock (commit is a causal event) */
@@ -1280,25 +2329,17 @@ void seraph_atlas_snapshot_abort(
         return;  /* Cannot abort committed snapshot - use delete instead */
     }
 
-    /* Free COW storage if allocated */
-    if (snapshot->cow_storage_offset != 0) {
-        void* cow_storage = seraph_atlas_offset_to_ptr(atlas, snapshot->cow_storage_offset);
-        if (cow_storage != NULL) {
-            seraph_atlas_free(atlas, cow_storage, snapshot->cow_storage_size);
-        }
+    /* Unprotect pending pages and free COW copies; the slot stays allocated */
+    int slot = snapshot_slot(atlas, snapshot);
+    if (slot >= 0 && atlas->cow_pending != NULL) {
+        atlas_snap_lock(atlas);
+        snapshot_release(atlas, slot);
+        atlas_snap_unlock(atlas);
     }
 
     /* Mark slot as void for reuse */
     snapshot->state = SERAPH_ATLAS_SNAP_VOID;
     snapshot->magic = 0;
-
-    /* Find and clear slot reference */
-    for (int i = 0; i < SERAPH_ATLAS_MAX_SNAPSHOTS; i++) {
-        if (atlas->snapshots[i] == snapshot) {
-            /* Keep the allocation but mark as unused */
-            break;
-        }
-    }
 }
 
 Seraph_Vbit seraph_atlas_snapshot_restore(
@@ -1320,15 +2361,21 @@ Seraph_Vbit seraph_atlas_snapshot_restore(
     Seraph_Atlas_Genesis* genesis = seraph_atlas_genesis(atlas);
 
     /* Abort all active transactions */
-    for (int i = 0; i < SERAPH_ATLAS_MAX_TRANSACTIONS; i++) {
-        if (atlas->transactions[i].state == SERAPH_ATLAS_TX_ACTIVE) {
-            seraph_atlas_abort(atlas, &atlas->transactions[i]);
+    for (uint32_t i = 0; i < atlas->tx_capacity; i++) {
+        if (atlas->transactions[i] != NULL &&
+            atlas->transactions[i]->state == SERAPH_ATLAS_TX_ACTIVE) {
+            seraph_atlas_abort(atlas, atlas->transactions[i]);
         }
     }
 
-    /* Restore COW pages to their original locations */
-    for (uint32_t i = 0; i < snapshot->cow_page_count; i++) {
-        const Seraph_Atlas_COW_Page* cow = &snapshot->cow_pages[i];
+    /*
+     * Restore COW pages to their original locations. snap_lock is not
+     * held: a restored page may still be protected for another snapshot,
+     * and the write fault takes the lock.
+     */
+    const Seraph_Atlas_COW_Page* index = snapshot_index(atlas, snapshot);
+    for (uint32_t i = 0; index != NULL && i < snapshot->cow_index_capacity; i++) {
+        const Seraph_Atlas_COW_Page* cow = &index[i];
 
         if (!(cow->flags & SERAPH_ATLAS_COW_VALID)) {
             continue;
@@ -1355,6 +2402,11 @@ Seraph_Vbit seraph_atlas_snapshot_restore(
     uint64_t current_generation = genesis->generation + 1;  /* Increment for safety */
     uint64_t current_commit_count = genesis->commit_count;
     uint64_t current_abort_count = genesis->abort_count;
+    uint64_t current_next_alloc = genesis->next_alloc_offset;
+    uint64_t current_total_allocated = genesis->total_allocated;
+    uint64_t current_log_offset = genesis->log_offset;
+    uint64_t current_log_size = genesis->log_size;
+    uint64_t current_log_checkpoint = genesis->log_checkpoint_lsn;
 
     memcpy(genesis, &snapshot->genesis_copy, sizeof(Seraph_Atlas_Genesis));
 
@@ -1363,6 +2415,15 @@ Seraph_Vbit seraph_atlas_snapshot_restore(
     genesis->commit_count = current_commit_count + 1;  /* Restore counts as a commit */
     genesis->abort_count = current_abort_count;
 
+    /* Snapshot pages were allocated after the snapshot; never hand them out again */
+    genesis->next_alloc_offset = current_next_alloc;
+    genesis->total_allocated = current_total_allocated;
+
+    /* The log region does not move */
+    genesis->log_offset = current_log_offset;
+    genesis->log_size = current_log_size;
+    genesis->log_checkpoint_lsn = current_log_checkpoint;
+
     /* Update vector clock to reflect restore operation */
     /* The restore creates a new causal branch that happens-after both
        the snapshot and the current state */
@@ -1383,8 +2444,10 @@ Seraph_Vbit seraph_atlas_snapshot_restore(
     /* Update epoch */
     atlas->current_epoch = genesis->commit_count + 1;
 
-    /* Sync everything to disk */
-    seraph_atlas_sync(atlas);
+    /* Sync everything to disk; checkpointing stops replay from undoing the restore */
+    if (seraph_atlas_checkpoint(atlas) != SERAPH_VBIT_TRUE) {
+        seraph_atlas_sync(atlas);
+    }
 
     return SERAPH_VBIT_TRUE;
 }
@@ -1476,12 +2539,12 @@ Seraph_Vbit seraph_atlas_snapshot_delete(
         return SERAPH_VBIT_FALSE;  /* Use abort for non-committed snapshots */
     }
 
-    /* Free COW storage */
-    if (snapshot->cow_storage_offset != 0) {
-        void* cow_storage = seraph_atlas_offset_to_ptr(atlas, snapshot->cow_storage_offset);
-        if (cow_storage != NULL) {
-            seraph_atlas_free(atlas, cow_storage, snapshot->cow_storage_size);
-        }
+    /* Unprotect pending pages and free COW copies */
+    int slot = snapshot_slot(atlas, snapshot);
+    if (slot >= 0) {
+        atlas_snap_lock(atlas);
+        snapshot_release(atlas, slot);
+        atlas_snap_unlock(atlas);
     }
 
     /* Mark as void for reuse */
@@ -1535,72 +2598,69 @@ Seraph_Vbit seraph_atlas_snapshot_cow_page(
         return SERAPH_VBIT_VOID;  /* COW only for active snapshots */
     }
 
-    /* Align to page boundary */
     uint64_t offset = seraph_atlas_ptr_to_offset(atlas, page_ptr);
-    if (offset == SERAPH_VOID_U64) {
+    int slot = snapshot_slot(atlas, snapshot);
+    if (offset == SERAPH_VOID_U64 || slot < 0) {
         return SERAPH_VBIT_VOID;
     }
 
-    uint64_t page_offset = (offset / SERAPH_PAGE_SIZE) * SERAPH_PAGE_SIZE;
+    uint64_t page = offset / SERAPH_PAGE_SIZE;
+    uint16_t bit = (uint16_t)(1u << slot);
 
-    /* Check if already copied */
-    if (snapshot_find_cow_page(snapshot, page_offset) != NULL) {
-        return SERAPH_VBIT_FALSE;  /* Already copied */
+    atlas_snap_lock(atlas);
+    Seraph_Vbit result = snapshot_copy_page(atlas, snapshot, page);
+    uint16_t pending = atlas->cow_pending[page];
+    if (pending & bit) {
+        atlas->cow_pending[page] = (uint16_t)(pending & ~bit);
+        if ((pending & ATLAS_COW_SLOTS) == bit) {
+            atlas_protect_pages(atlas, page, 1, true);
+        }
     }
+    atlas_snap_unlock(atlas);
 
-    /* Check if we have space for another COW entry */
-    if (snapshot->cow_page_count >= SERAPH_ATLAS_SNAPSHOT_MAX_PAGES) {
-        snapshot->state = SERAPH_ATLAS_SNAP_FAILED;
-        return SERAPH_VBIT_VOID;  /* Too many COW pages */
-    }
+    return result;
+}
 
-    /* Check if we have COW storage space */
-    if (snapshot->cow_storage_offset == 0) {
-        snapshot->state = SERAPH_ATLAS_SNAP_FAILED;
-        return SERAPH_VBIT_VOID;  /* No COW storage allocated */
-    }
+Seraph_Vbit seraph_atlas_snapshot_write_fault(void* addr) {
+    for (int i = 0; i < ATLAS_FAULT_MAX_ATLASES; i++) {
+        Seraph_Atlas* atlas = atomic_load(&atlas_fault_atlases[i]);
+        if (atlas == NULL || !seraph_atlas_contains(atlas, addr)) {
+            continue;
+        }
+        if (atlas->read_only) {
+            return SERAPH_VBIT_FALSE;  /* A genuine write to a read-only mapping */
+        }
 
-    /* Calculate COW copy destination */
-    uint64_t cow_offset = snapshot->cow_storage_offset +
-        ((uint64_t)snapshot->cow_page_count * SERAPH_PAGE_SIZE);
+        uint64_t page = (uint64_t)((uint8_t*)addr - (uint8_t*)atlas->base) / SERAPH_PAGE_SIZE;
 
-    void* cow_dest = seraph_atlas_offset_to_ptr(atlas, cow_offset);
-    void* page_src = seraph_atlas_offset_to_ptr(atlas, page_offset);
+        atlas_snap_lock(atlas);
+        uint16_t pending = atlas->cow_pending[page];
+        for (int slot = 0; slot < SERAPH_ATLAS_MAX_SNAPSHOTS; slot++) {
+            Seraph_Atlas_Snapshot* snapshot = atlas->snapshots[slot];
+            if ((pending & (1u << slot)) && snapshot != NULL &&
+                (snapshot->state == SERAPH_ATLAS_SNAP_ACTIVE ||
+                 snapshot->state == SERAPH_ATLAS_SNAP_COMMITTED)) {
+                snapshot_copy_page(atlas, snapshot, page);
+            }
+        }
+        atlas->cow_pending[page] = (uint16_t)(pending & ~ATLAS_COW_SLOTS);
 
-    if (cow_dest == NULL || page_src == NULL) {
-        snapshot->state = SERAPH_ATLAS_SNAP_FAILED;
-        return SERAPH_VBIT_VOID;
+        /* Also covers a racing fault whose page another thread already copied */
+        atlas_protect_pages(atlas, page, 1, true);
+        atlas_snap_unlock(atlas);
+        return SERAPH_VBIT_TRUE;
     }
+    return SERAPH_VBIT_FALSE;
+}
 
-    /* Copy original page data to COW storage */
-    memcpy(cow_dest, page_src, SERAPH_PAGE_SIZE);
-
-    /* Record COW entry */
-    Seraph_Atlas_COW_Page* cow = &snapshot->cow_pages[snapshot->cow_page_count];
-    cow->page_offset = page_offset;
-    cow->copy_offset = cow_offset;
-    cow->modification_time = atlas->current_epoch;
-    cow->page_count = 1;
-    cow->flags = SERAPH_ATLAS_COW_VALID | SERAPH_ATLAS_COW_DIRTY;
-
-    /* Mark Genesis pages specially */
-    if (page_offset < sizeof(Seraph_Atlas_Genesis)) {
-        cow->flags |= SERAPH_ATLAS_COW_GENESIS;
-    }
-
-    snapshot->cow_page_count++;
-
-    return SERAPH_VBIT_TRUE;
-}
-
-const void* seraph_atlas_snapshot_read_page(
-    const Seraph_Atlas* atlas,
-    const Seraph_Atlas_Snapshot* snapshot,
-    const void* page_ptr
-) {
-    if (!seraph_atlas_is_valid(atlas) || snapshot == NULL || page_ptr == NULL) {
-        return NULL;
-    }
+const void* seraph_atlas_snapshot_read_page(
+    const Seraph_Atlas* atlas,
+    const Seraph_Atlas_Snapshot* snapshot,
+    const void* page_ptr
+) {
+    if (!seraph_atlas_is_valid(atlas) || snapshot == NULL || page_ptr == NULL) {
+        return NULL;
+    }
 
     /* Get page offset */
     uint64_t offset = seraph_atlas_ptr_to_offset(atlas, page_ptr);
@@ -1611,14 +2671,10 @@ const void* seraph_atlas_snapshot_read_page(
     uint64_t page_offset = (offset / SERAPH_PAGE_SIZE) * SERAPH_PAGE_SIZE;
 
     /* Check if page was modified (has COW copy) */
-    for (uint32_t i = 0; i < snapshot->cow_page_count; i++) {
-        const Seraph_Atlas_COW_Page* cow = &snapshot->cow_pages[i];
-
-        if ((cow->flags & SERAPH_ATLAS_COW_VALID) &&
-            cow->page_offset == page_offset) {
-            /* Return COW copy (original data at snapshot time) */
-            return seraph_atlas_offset_to_ptr(atlas, cow->copy_offset);
-        }
+    const Seraph_Atlas_COW_Page* cow = snapshot_find_cow_page(atlas, snapshot, page_offset);
+    if (cow != NULL) {
+        /* Return COW copy (original data at snapshot time) */
+        return seraph_atlas_offset_to_ptr(atlas, cow->copy_offset);
     }
 
     /* Page not modified - return current data */
@@ -1757,17 +2813,23 @@ static const uint32_t crc32_table[256] = {
 };
 
 /**
- * @brief Calculate CRC32 checksum
+ * @brief Feed bytes into a running CRC32 (caller applies the inversions)
  */
-static uint32_t calculate_crc32(const void* data, size_t size) {
+static uint32_t crc32_update(uint32_t crc, const void* data, size_t size) {
     const uint8_t* bytes = (const uint8_t*)data;
-    uint32_t crc = 0xFFFFFFFF;
 
     for (size_t i = 0; i < size; i++) {
         crc = crc32_table[(crc ^ bytes[i]) & 0xFF] ^ (crc >> 8);
     }
 
-    return crc ^ 0xFFFFFFFF;
+    return crc;
+}
+
+/**
+ * @brief Calculate CRC32 checksum
+ */
+static uint32_t calculate_crc32(const void* data, size_t size) {
+    return crc32_update(0xFFFFFFFF, data, size) ^ 0xFFFFFFFF;
 }
 
 /*============================================================================
@@ -2117,6 +3179,428 @@ static Seraph_Atlas_Validate_Result validate_invariant(
     }
 }
 
+/*============================================================================
+ * Batched Validation
+ *
+ * seraph_atlas_checkpoint_validate() sorts entry indices by type and cuts
+ * them into batches of one type. A batch resolves its objects into a
+ * contiguous array and then runs one invariant at a time across all of
+ * them, so the dispatch happens once per invariant and batch rather than
+ * once per object. Workers claim batches from an atomic counter; every
+ * entry belongs to exactly one batch, so entries are written without
+ * locks.
+ *
+ * NO_CYCLE walks share a visited set keyed by (node, link field). Once a
+ * walk finishes it records for every node it passed how that node ends:
+ * the number of nodes left until NULL, a cycle, or an invalid pointer.
+ * Later walks stop at the first recorded node, so a list whose every node
+ * is registered is walked once in total instead of once per node.
+ *============================================================================*/
+
+/** Entries per batch */
+#define ATLAS_VALIDATE_BATCH        256
+
+/** Upper bound on validation threads */
+#define ATLAS_VALIDATE_MAX_THREADS  16
+
+/** Distinct NO_CYCLE link fields the visited set can tell apart */
+#define ATLAS_VISIT_LINKS           16
+
+/** Linear probes before the visited set gives up on a key */
+#define ATLAS_VISIT_PROBES          32
+
+/** Longest chain accepted before a walk is treated as a cycle */
+#define ATLAS_VISIT_MAX_DEPTH       (2u * SERAPH_ATLAS_MAX_CYCLE_DEPTH)
+
+/* Visited-set states; any other nonzero value is the count of nodes
+ * from that node to the end of its list, itself included */
+#define ATLAS_VISIT_UNKNOWN         0u
+#define ATLAS_VISIT_CYCLE           0xFFFFFFFFu
+#define ATLAS_VISIT_INVALID         0xFFFFFFFEu
+
+typedef struct {
+    _Atomic uint64_t key;       /* (node offset + 1) << 8 | link; 0 = empty */
+    _Atomic uint32_t state;
+} Atlas_Visit_Slot;
+
+typedef struct {
+    Atlas_Visit_Slot* slots;
+    size_t            mask;
+    size_t            links[ATLAS_VISIT_LINKS];
+    uint32_t          link_count;
+} Atlas_Visit_Set;
+
+static uint64_t atlas_visit_key(const Seraph_Atlas* atlas, const void* node,
+                                uint32_t link) {
+    uint64_t offset = (uint64_t)((const uint8_t*)node - (const uint8_t*)atlas->base);
+    return ((offset + 1) << 8) | link;
+}
+
+static Atlas_Visit_Slot* atlas_visit_slot(Atlas_Visit_Set* visit, uint64_t key,
+                                          bool insert) {
+    size_t h = (size_t)(key * 0x9E3779B97F4A7C15ULL >> 32) & visit->mask;
+    for (uint32_t probe = 0; probe < ATLAS_VISIT_PROBES; probe++) {
+        Atlas_Visit_Slot* slot = &visit->slots[h];
+        uint64_t current = atomic_load_explicit(&slot->key, memory_order_acquire);
+        if (current == key) {
+            return slot;
+        }
+        if (current == 0) {
+            if (!insert) {
+                return NULL;
+            }
+            if (atomic_compare_exchange_strong_explicit(&slot->key, &current, key,
+                    memory_order_acq_rel, memory_order_acquire) || current == key) {
+                return slot;
+            }
+        }
+        h = (h + 1) & visit->mask;
+    }
+    return NULL;  /* Table crowded: the walk simply isn't remembered */
+}
+
+static uint32_t atlas_visit_get(const Seraph_Atlas* atlas, Atlas_Visit_Set* visit,
+                                const void* node, uint32_t link) {
+    Atlas_Visit_Slot* slot = atlas_visit_slot(visit, atlas_visit_key(atlas, node, link), false);
+    return slot != NULL ? atomic_load_explicit(&slot->state, memory_order_acquire)
+                        : ATLAS_VISIT_UNKNOWN;
+}
+
+static void atlas_visit_put(const Seraph_Atlas* atlas, Atlas_Visit_Set* visit,
+                            const void* node, uint32_t link, uint32_t state) {
+    Atlas_Visit_Slot* slot = atlas_visit_slot(visit, atlas_visit_key(atlas, node, link), true);
+    if (slot != NULL) {
+        atomic_store_explicit(&slot->state, state, memory_order_release);
+    }
+}
+
+/**
+ * @brief Validate NO_CYCLE through the shared visited set
+ *
+ * Floyd's algorithm with the hare stepping every iteration and the
+ * tortoise every second one, stopping early at any node whose ending is
+ * already known. The nodes walked are then recorded; if several threads
+ * walk the same chain at once they record the same states.
+ */
+static Seraph_Atlas_Validate_Result validate_no_cycle_shared(
+    const Seraph_Atlas* atlas,
+    const void* data,
+    const Seraph_Atlas_Invariant* inv,
+    Atlas_Visit_Set* visit
+) {
+    size_t next_offset = inv->params.cycle.next_offset;
+    uint32_t link = 0;
+    while (visit != NULL && link < visit->link_count && visit->links[link] != next_offset) {
+        link++;
+    }
+    if (visit == NULL || link == visit->link_count) {
+        return validate_no_cycle(atlas, data, inv);
+    }
+
+    void* start = read_ptr_field(data, inv->field_offset);
+    void* slow = start;
+    void* fast = start;
+    void* meet = NULL;
+    uint32_t steps = 0;
+    uint32_t tail;
+
+    for (;;) {
+        if (fast == NULL) {
+            tail = 0;
+            break;
+        }
+        if (!seraph_atlas_contains(atlas, fast)) {
+            tail = ATLAS_VISIT_INVALID;
+            break;
+        }
+        tail = atlas_visit_get(atlas, visit, fast, link);
+        if (tail != ATLAS_VISIT_UNKNOWN) {
+            break;
+        }
+        if (steps == ATLAS_VISIT_MAX_DEPTH) {
+            return SERAPH_ATLAS_VALIDATE_CYCLE_DETECTED;  /* Too deep: treat as cycle */
+        }
+
+        fast = read_ptr_field(fast, next_offset);
+        steps++;
+        if ((steps & 1) == 0) {
+            slow = read_ptr_field(slow, next_offset);
+        }
+        if (fast != NULL && fast == slow) {
+            meet = fast;
+            tail = ATLAS_VISIT_CYCLE;
+            break;
+        }
+    }
+
+    bool ends = tail != ATLAS_VISIT_CYCLE && tail != ATLAS_VISIT_INVALID;
+    if (ends && (uint64_t)steps + tail > ATLAS_VISIT_MAX_DEPTH) {
+        return SERAPH_ATLAS_VALIDATE_CYCLE_DETECTED;
+    }
+
+    /* Record the ring first so the prefix walk below stays bounded */
+    if (meet != NULL) {
+        void* node = meet;
+        uint32_t n = 0;
+        do {
+            atlas_visit_put(atlas, visit, node, link, ATLAS_VISIT_CYCLE);
+            node = read_ptr_field(node, next_offset);
+        } while (node != meet && ++n < ATLAS_VISIT_MAX_DEPTH);
+    }
+
+    void* node = start;
+    for (uint32_t k = 0; k < steps; k++) {
+        uint32_t state = ends ? steps + tail - k : tail;
+        atlas_visit_put(atlas, visit, node, link, state);
+        node = read_ptr_field(node, next_offset);
+    }
+
+    if (tail == ATLAS_VISIT_CYCLE) {
+        return SERAPH_ATLAS_VALIDATE_CYCLE_DETECTED;
+    }
+    if (tail == ATLAS_VISIT_INVALID) {
+        return SERAPH_ATLAS_VALIDATE_INVALID_PTR;
+    }
+    return SERAPH_ATLAS_VALIDATE_OK;
+}
+
+/**
+ * @brief Check one invariant across a batch of objects
+ */
+static void validate_invariant_batch(
+    const Seraph_Atlas* atlas,
+    void* const* data,
+    uint32_t count,
+    const Seraph_Atlas_Invariant* inv,
+    Atlas_Visit_Set* visit,
+    Seraph_Atlas_Validate_Result* results
+) {
+    uint32_t k;
+
+    switch (inv->type) {
+        case SERAPH_ATLAS_INVARIANT_NULL_PTR:
+            for (k = 0; k < count; k++) results[k] = validate_null_ptr(atlas, data[k], inv);
+            break;
+
+        case SERAPH_ATLAS_INVARIANT_NULLABLE_PTR:
+            for (k = 0; k < count; k++) results[k] = validate_nullable_ptr(atlas, data[k], inv);
+            break;
+
+        case SERAPH_ATLAS_INVARIANT_NO_CYCLE:
+            for (k = 0; k < count; k++) {
+                results[k] = validate_no_cycle_shared(atlas, data[k], inv, visit);
+            }
+            break;
+
+        case SERAPH_ATLAS_INVARIANT_ARRAY_BOUNDS:
+            for (k = 0; k < count; k++) results[k] = validate_array_bounds(atlas, data[k], inv);
+            break;
+
+        case SERAPH_ATLAS_INVARIANT_REFCOUNT:
+            for (k = 0; k < count; k++) results[k] = validate_refcount(atlas, data[k], inv);
+            break;
+
+        case SERAPH_ATLAS_INVARIANT_RANGE:
+            for (k = 0; k < count; k++) results[k] = validate_range(atlas, data[k], inv);
+            break;
+
+        case SERAPH_ATLAS_INVARIANT_CUSTOM:
+            for (k = 0; k < count; k++) results[k] = validate_custom(atlas, data[k], inv);
+            break;
+
+        default:
+            for (k = 0; k < count; k++) results[k] = SERAPH_ATLAS_VALIDATE_ERROR;
+            break;
+    }
+}
+
+/** Work shared by all validation workers */
+typedef struct {
+    Seraph_Atlas*            atlas;
+    Seraph_Atlas_Checkpoint* checkpoint;
+    const uint32_t*          order;         /* Entry indices grouped by type */
+    const uint32_t*          batch_start;   /* Batch b is order[start[b] .. start[b + 1]) */
+    uint32_t                 batch_count;
+    uint32_t*                failed;        /* Per entry: mask of failed invariants, or NULL */
+    Atlas_Visit_Set*         visit;         /* NULL when no type has NO_CYCLE */
+    _Atomic uint32_t         next_batch;
+} Atlas_Validate_Job;
+
+/** Per-worker counters and batch scratch */
+typedef struct {
+    Atlas_Validate_Job*          job;
+    uint32_t                     total_errors;
+    uint32_t                     entries_passed;
+    uint32_t                     entries_failed;
+    uint32_t                     invariants_checked;
+    uint32_t                     invariants_passed;
+    uint32_t                     invariants_failed;
+    uint32_t                     index[ATLAS_VALIDATE_BATCH];
+    void*                        data[ATLAS_VALIDATE_BATCH];
+    Seraph_Atlas_Validate_Result results[ATLAS_VALIDATE_BATCH];
+} Atlas_Validate_Worker;
+
+static void atlas_validate_batch(Atlas_Validate_Worker* w, uint32_t batch) {
+    Atlas_Validate_Job* job = w->job;
+    Seraph_Atlas* atlas = job->atlas;
+    Seraph_Atlas_Checkpoint_Entry* entries = job->checkpoint->entries;
+    uint32_t begin = job->batch_start[batch];
+    uint32_t end = job->batch_start[batch + 1];
+
+    const Seraph_Atlas_Type_Info* type =
+        seraph_atlas_checkpoint_get_type(entries[job->order[begin]].type_id);
+
+    /* Resolve the batch into a contiguous array of live objects */
+    uint32_t count = 0;
+    for (uint32_t p = begin; p < end; p++) {
+        uint32_t i = job->order[p];
+        Seraph_Atlas_Checkpoint_Entry* entry = &entries[i];
+
+        if (type == NULL) {
+            entry->flags |= SERAPH_ATLAS_ENTRY_INVALID;
+            entry->error_count++;
+            entry->last_result = SERAPH_ATLAS_VALIDATE_ERROR;
+            w->total_errors++;
+            w->entries_failed++;
+            continue;
+        }
+
+        /* Resolve pointer (in case entry was restored) */
+        void* data = seraph_atlas_offset_to_ptr(atlas, entry->offset);
+        if (data == NULL) {
+            entry->flags |= SERAPH_ATLAS_ENTRY_INVALID;
+            entry->error_count++;
+            entry->last_result = SERAPH_ATLAS_VALIDATE_INVALID_PTR;
+            w->total_errors++;
+            w->entries_failed++;
+            continue;
+        }
+
+        entry->ptr = data;
+        entry->error_count = 0;
+        w->index[count] = i;
+        w->data[count] = data;
+        count++;
+    }
+
+    if (count == 0) {
+        return;
+    }
+
+    for (uint32_t j = 0; j < type->invariant_count; j++) {
+        validate_invariant_batch(atlas, w->data, count, &type->invariants[j],
+                                 job->visit, w->results);
+        w->invariants_checked += count;
+
+        for (uint32_t k = 0; k < count; k++) {
+            Seraph_Atlas_Validate_Result result = w->results[k];
+            if (result == SERAPH_ATLAS_VALIDATE_OK) {
+                w->invariants_passed++;
+                continue;
+            }
+
+            Seraph_Atlas_Checkpoint_Entry* entry = &entries[w->index[k]];
+            w->invariants_failed++;
+            entry->error_count++;
+            if (entry->last_result == SERAPH_ATLAS_VALIDATE_OK) {
+                entry->last_result = result;  /* Record first error */
+            }
+            if (job->failed != NULL) {
+                job->failed[w->index[k]] |= 1u << j;
+            }
+        }
+    }
+
+    /* Run type-level validator if present */
+    if (type->instance_validator != NULL) {
+        for (uint32_t k = 0; k < count; k++) {
+            Seraph_Atlas_Checkpoint_Entry* entry = &entries[w->index[k]];
+            w->invariants_checked++;
+            Seraph_Atlas_Validate_Result result = type->instance_validator(
+                atlas, w->data[k], 0, type->instance_size, type->user_data);
+
+            if (result == SERAPH_ATLAS_VALIDATE_OK) {
+                w->invariants_passed++;
+            } else {
+                w->invariants_failed++;
+                entry->error_count++;
+                if (entry->last_result == SERAPH_ATLAS_VALIDATE_OK) {
+                    entry->last_result = result;
+                }
+            }
+        }
+    }
+
+    for (uint32_t k = 0; k < count; k++) {
+        Seraph_Atlas_Checkpoint_Entry* entry = &entries[w->index[k]];
+
+        /* Update entry flags */
+        if (entry->error_count == 0) {
+            entry->flags &= ~SERAPH_ATLAS_ENTRY_INVALID;
+            w->entries_passed++;
+        } else {
+            entry->flags |= SERAPH_ATLAS_ENTRY_INVALID;
+            w->entries_failed++;
+            w->total_errors += entry->error_count;
+        }
+
+        /* Check for modification (compare checksum) */
+        uint32_t current_checksum = calculate_crc32(w->data[k], entry->alloc_size);
+        if (current_checksum != entry->checksum) {
+            entry->flags |= SERAPH_ATLAS_ENTRY_MODIFIED;
+        }
+    }
+}
+
+static void atlas_validate_drain(Atlas_Validate_Worker* w) {
+    for (;;) {
+        uint32_t batch = atomic_fetch_add_explicit(&w->job->next_batch, 1,
+                                                   memory_order_relaxed);
+        if (batch >= w->job->batch_count) {
+            return;
+        }
+        atlas_validate_batch(w, batch);
+    }
+}
+
+#ifdef ATLAS_VALIDATE_THREADS
+static int atlas_validate_thread_main(void* arg) {
+    atlas_validate_drain((Atlas_Validate_Worker*)arg);
+    return 0;
+}
+#endif
+
+/**
+ * @brief Number of validation threads to use for a checkpoint
+ */
+static uint32_t atlas_validate_thread_count(const Seraph_Atlas* atlas, uint32_t batches) {
+#ifdef ATLAS_VALIDATE_THREADS
+    uint32_t threads = atlas->validate_threads;
+    if (threads == 0) {
+        if (batches < 2) {
+            return 1;
+        }
+#if defined(_WIN32)
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        threads = info.dwNumberOfProcessors > 0 ? (uint32_t)info.dwNumberOfProcessors : 1;
+#elif defined(_SC_NPROCESSORS_ONLN)
+        long n = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = n > 0 ? (uint32_t)n : 1;
+#else
+        threads = 1;
+#endif
+    }
+    if (threads > ATLAS_VALIDATE_MAX_THREADS) threads = ATLAS_VALIDATE_MAX_THREADS;
+    if (threads > batches) threads = batches;
+    return threads == 0 ? 1 : threads;
+#else
+    (void)atlas;
+    (void)batches;
+    return 1;
+#endif
+}
+
 /*============================================================================
  * Invariant Recovery Helpers
  *============================================================================*/
@@ -2639,122 +4123,182 @@ Seraph_Vbit seraph_atlas_checkpoint_validate(
         return SERAPH_VBIT_VOID;  /* Invalid checkpoint */
     }
 
-    /* Initialize report if provided */
+    /* Initialize report if provided, keeping the caller's detail array */
     if (report != NULL) {
+        Seraph_Atlas_Validation_Detail* details = report->details;
+        uint32_t max_details = report->max_details;
         memset(report, 0, sizeof(Seraph_Atlas_Validation_Report));
         report->checkpoint_id = checkpoint->checkpoint_id;
+        report->details = details;
+        report->max_details = details != NULL ? max_details : 0;
+    }
+
+    uint32_t n = checkpoint->entry_count;
+    Seraph_Atlas_Checkpoint_Entry* entries = checkpoint->entries;
+    bool want_details = report != NULL && report->details != NULL &&
+                        report->max_details > 0;
+
+    /* Group entry indices by type (counting sort); unknown ids share the
+     * last bucket and fail as a batch */
+    uint32_t bucket_start[SERAPH_ATLAS_MAX_TYPES + 2] = {0};
+    for (uint32_t i = 0; i < n; i++) {
+        uint32_t t = entries[i].type_id < SERAPH_ATLAS_MAX_TYPES ?
+                     entries[i].type_id : SERAPH_ATLAS_MAX_TYPES;
+        bucket_start[t + 1]++;
+    }
+    for (uint32_t t = 0; t <= SERAPH_ATLAS_MAX_TYPES; t++) {
+        bucket_start[t + 1] += bucket_start[t];
+    }
+
+    uint32_t max_batches = n / ATLAS_VALIDATE_BATCH + SERAPH_ATLAS_MAX_TYPES + 2;
+    uint32_t* order = atlas_heap_calloc(n + 1, sizeof(uint32_t));
+    uint32_t* batch_start = atlas_heap_calloc(max_batches, sizeof(uint32_t));
+    uint32_t* failed = want_details ? atlas_heap_calloc(n + 1, sizeof(uint32_t)) : NULL;
+    if (order == NULL || batch_start == NULL || (want_details && failed == NULL)) {
+        atlas_heap_free(order);
+        atlas_heap_free(batch_start);
+        atlas_heap_free(failed);
+        return SERAPH_VBIT_VOID;
     }
 
-    uint32_t total_errors = 0;
-    uint32_t entries_passed = 0;
-    uint32_t entries_failed = 0;
-    uint32_t invariants_checked = 0;
-    uint32_t invariants_passed = 0;
-    uint32_t invariants_failed = 0;
-
-    /* Validate each entry */
-    for (uint32_t i = 0; i < checkpoint->entry_count; i++) {
-        Seraph_Atlas_Checkpoint_Entry* entry = &checkpoint->entries[i];
-
-        /* Get type */
-        const Seraph_Atlas_Type_Info* type =
-            seraph_atlas_checkpoint_get_type(entry->type_id);
-
-        if (type == NULL) {
-            entry->flags |= SERAPH_ATLAS_ENTRY_INVALID;
-            entry->error_count++;
-            entry->last_result = SERAPH_ATLAS_VALIDATE_ERROR;
-            total_errors++;
-            entries_failed++;
-            continue;
+    uint32_t fill[SERAPH_ATLAS_MAX_TYPES + 1];
+    memcpy(fill, bucket_start, sizeof(fill));
+    for (uint32_t i = 0; i < n; i++) {
+        uint32_t t = entries[i].type_id < SERAPH_ATLAS_MAX_TYPES ?
+                     entries[i].type_id : SERAPH_ATLAS_MAX_TYPES;
+        order[fill[t]++] = i;
+    }
+
+    /* Cut each type group into batches and collect the link fields that
+     * NO_CYCLE invariants follow */
+    Atlas_Validate_Job job = {
+        .atlas = atlas,
+        .checkpoint = checkpoint,
+        .order = order,
+        .batch_start = batch_start,
+        .failed = failed,
+    };
+    atomic_init(&job.next_batch, 0);
+
+    Atlas_Visit_Set visit = {0};
+    for (uint32_t t = 0; t <= SERAPH_ATLAS_MAX_TYPES; t++) {
+        for (uint32_t p = bucket_start[t]; p < bucket_start[t + 1]; p += ATLAS_VALIDATE_BATCH) {
+            batch_start[job.batch_count++] = p;
         }
 
-        /* Resolve pointer (in case entry was restored) */
-        void* data = seraph_atlas_offset_to_ptr(atlas, entry->offset);
-        if (data == NULL) {
-            entry->flags |= SERAPH_ATLAS_ENTRY_INVALID;
-            entry->error_count++;
-            entry->last_result = SERAPH_ATLAS_VALIDATE_INVALID_PTR;
-            total_errors++;
-            entries_failed++;
+        const Seraph_Atlas_Type_Info* type = t < SERAPH_ATLAS_MAX_TYPES ?
+            seraph_atlas_checkpoint_get_type(t) : NULL;
+        if (type == NULL || bucket_start[t] == bucket_start[t + 1]) {
             continue;
         }
-
-        entry->ptr = data;  /* Update pointer */
-        bool entry_valid = true;
-        entry->error_count = 0;
-
-        /* Validate all invariants for this type */
         for (uint32_t j = 0; j < type->invariant_count; j++) {
-            const Seraph_Atlas_Invariant* inv = &type->invariants[j];
-            invariants_checked++;
-
-            Seraph_Atlas_Validate_Result result = validate_invariant(atlas, data, inv);
-
-            if (result == SERAPH_ATLAS_VALIDATE_OK) {
-                invariants_passed++;
-            } else {
-                invariants_failed++;
-                entry->error_count++;
-                entry_valid = false;
-
-                if (entry->last_result == SERAPH_ATLAS_VALIDATE_OK) {
-                    entry->last_result = result;  /* Record first error */
-                }
-
-                /* Record detail if report provided */
-                if (report != NULL && report->details != NULL &&
-                    report->detail_count < report->max_details) {
-                    Seraph_Atlas_Validation_Detail* detail =
-                        &report->details[report->detail_count];
-                    detail->entry_index = i;
-                    detail->invariant_index = j;
-                    detail->result = result;
-                    detail->type_id = entry->type_id;
-                    detail->field_offset = inv->field_offset;
-                    detail->recovery_attempted = false;
-                    detail->recovery_succeeded = false;
-                    report->detail_count++;
-                }
+            if (type->invariants[j].type != SERAPH_ATLAS_INVARIANT_NO_CYCLE) {
+                continue;
+            }
+            size_t next_offset = type->invariants[j].params.cycle.next_offset;
+            uint32_t link = 0;
+            while (link < visit.link_count && visit.links[link] != next_offset) {
+                link++;
+            }
+            if (link == visit.link_count && link < ATLAS_VISIT_LINKS) {
+                visit.links[visit.link_count++] = next_offset;
             }
         }
+    }
+    batch_start[job.batch_count] = n;
 
-        /* Run type-level validator if present */
-        if (type->instance_validator != NULL) {
-            invariants_checked++;
-            Seraph_Atlas_Validate_Result result = type->instance_validator(
-                atlas, data, 0, type->instance_size, type->user_data);
-
-            if (result == SERAPH_ATLAS_VALIDATE_OK) {
-                invariants_passed++;
-            } else {
-                invariants_failed++;
-                entry->error_count++;
-                entry_valid = false;
-
-                if (entry->last_result == SERAPH_ATLAS_VALIDATE_OK) {
-                    entry->last_result = result;
-                }
-            }
+    /* Size the visited set for several nodes per entry; walks that find
+     * it crowded just go unrecorded */
+    if (visit.link_count > 0) {
+        size_t capacity = 1024;
+        while (capacity < (size_t)n * 4 && capacity < ((size_t)1 << 24)) {
+            capacity <<= 1;
+        }
+        visit.slots = atlas_heap_calloc(capacity, sizeof(Atlas_Visit_Slot));
+        visit.mask = capacity - 1;
+        if (visit.slots != NULL) {
+            job.visit = &visit;
         }
+    }
 
-        /* Update entry flags */
-        if (entry_valid) {
-            entry->flags &= ~SERAPH_ATLAS_ENTRY_INVALID;
-            entries_passed++;
-        } else {
-            entry->flags |= SERAPH_ATLAS_ENTRY_INVALID;
-            entries_failed++;
-            total_errors += entry->error_count;
+    uint32_t threads = atlas_validate_thread_count(atlas, job.batch_count);
+    Atlas_Validate_Worker* workers = atlas_heap_calloc(threads, sizeof(Atlas_Validate_Worker));
+    if (workers == NULL) {
+        atlas_heap_free(visit.slots);
+        atlas_heap_free(order);
+        atlas_heap_free(batch_start);
+        atlas_heap_free(failed);
+        return SERAPH_VBIT_VOID;
+    }
+    for (uint32_t w = 0; w < threads; w++) {
+        workers[w].job = &job;
+    }
+
+#ifdef ATLAS_VALIDATE_THREADS
+    /* Worker 0 is the calling thread */
+    thrd_t handles[ATLAS_VALIDATE_MAX_THREADS];
+    bool started[ATLAS_VALIDATE_MAX_THREADS] = {false};
+    for (uint32_t w = 1; w < threads; w++) {
+        started[w] = thrd_create(&handles[w], atlas_validate_thread_main,
+                                 &workers[w]) == thrd_success;
+    }
+    atlas_validate_drain(&workers[0]);
+    for (uint32_t w = 1; w < threads; w++) {
+        if (started[w]) {
+            thrd_join(handles[w], NULL);
         }
+    }
+#else
+    atlas_validate_drain(&workers[0]);
+#endif
 
-        /* Check for modification (compare checksum) */
-        uint32_t current_checksum = calculate_crc32(data, entry->alloc_size);
-        if (current_checksum != entry->checksum) {
-            entry->flags |= SERAPH_ATLAS_ENTRY_MODIFIED;
+    uint32_t total_errors = 0;
+    uint32_t entries_passed = 0;
+    uint32_t entries_failed = 0;
+    uint32_t invariants_checked = 0;
+    uint32_t invariants_passed = 0;
+    uint32_t invariants_failed = 0;
+    for (uint32_t w = 0; w < threads; w++) {
+        total_errors += workers[w].total_errors;
+        entries_passed += workers[w].entries_passed;
+        entries_failed += workers[w].entries_failed;
+        invariants_checked += workers[w].invariants_checked;
+        invariants_passed += workers[w].invariants_passed;
+        invariants_failed += workers[w].invariants_failed;
+    }
+
+    /* Record details in entry order; the failing checks are re-run for
+     * their result codes, which is cheap with the visited set still warm */
+    for (uint32_t i = 0; failed != NULL && i < n &&
+                         report->detail_count < report->max_details; i++) {
+        const Seraph_Atlas_Type_Info* type =
+            seraph_atlas_checkpoint_get_type(entries[i].type_id);
+        for (uint32_t j = 0; failed[i] != 0 && type != NULL && j < type->invariant_count &&
+                             report->detail_count < report->max_details; j++) {
+            if (!(failed[i] & (1u << j))) {
+                continue;
+            }
+            const Seraph_Atlas_Invariant* inv = &type->invariants[j];
+            Seraph_Atlas_Validation_Detail* detail =
+                &report->details[report->detail_count];
+            validate_invariant_batch(atlas, &entries[i].ptr, 1, inv, job.visit,
+                                     &detail->result);
+            detail->entry_index = i;
+            detail->invariant_index = j;
+            detail->type_id = entries[i].type_id;
+            detail->field_offset = inv->field_offset;
+            detail->recovery_attempted = false;
+            detail->recovery_succeeded = false;
+            report->detail_count++;
         }
     }
 
+    atlas_heap_free(workers);
+    atlas_heap_free(visit.slots);
+    atlas_heap_free(order);
+    atlas_heap_free(batch_start);
+    atlas_heap_free(failed);
+
     /* Update checkpoint state */
     checkpoint->validated = true;
     checkpoint->total_errors = total_errors;
@@ -2773,6 +4317,12 @@ Seraph_Vbit seraph_atlas_checkpoint_validate(
     return (entries_failed == 0) ? SERAPH_VBIT_TRUE : SERAPH_VBIT_FALSE;
 }
 
+void seraph_atlas_set_validate_threads(Seraph_Atlas* atlas, uint32_t threads) {
+    if (atlas != NULL) {
+        atlas->validate_threads = threads;
+    }
+}
+
 Seraph_Vbit seraph_atlas_checkpoint_recover(
     Seraph_Atlas* atlas,
     Seraph_Atlas_Checkpoint* checkpoint,
@@ -2793,7 +4343,11 @@ Seraph_Vbit seraph_atlas_checkpoint_recover(
     if (temp_report.entries_failed == 0) {
         /* No errors to recover */
         if (report != NULL) {
+            Seraph_Atlas_Validation_Detail* details = report->details;
+            uint32_t max_details = report->max_details;
             *report = temp_report;
+            report->details = details;
+            report->max_details = details != NULL ? max_details : 0;
             report->passed = true;
         }
         return SERAPH_VBIT_TRUE;
@@ -0,0 +1,532 @@
+/**
+ * @file atlas_export.c
+ * @brief MC27: Atlas snapshot export and import
+ *
+ * Streams a committed snapshot to a file, either in full or as the pages
+ * that changed since an earlier snapshot, and applies such a file to
+ * another Atlas. Export writes one page at a time, so it never holds more
+ * than a page of the store in memory. Import reads the (compressed) file
+ * into memory once and applies from the same bytes it verified.
+ *
+ * Each page is run-length encoded (a PackBits-style scheme: literal runs
+ * and repeated bytes). Delta pages are first XORed with the base
+ * snapshot's copy, which turns every unchanged byte into a zero run. The
+ * file ends with a SHA-256 of everything before the trailer.
+ */
+
+#include "seraph/atlas.h"
+
+#ifndef SERAPH_KERNEL
+
+#include "seraph/crypto/sha256.h"
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/** Largest encoded page worth keeping; anything bigger is stored raw */
+#define EXPORT_RLE_LIMIT (SERAPH_PAGE_SIZE - 1)
+
+/** Longest literal and repeat runs of one control byte */
+#define EXPORT_RLE_LITERAL_MAX 128
+#define EXPORT_RLE_REPEAT_MIN  3
+#define EXPORT_RLE_REPEAT_MAX  130
+
+/*============================================================================
+ * Run-Length Encoding
+ *
+ * Control byte c < 128: c + 1 literal bytes follow.
+ * Control byte c >= 128: the next byte repeats c - 125 times (3..130).
+ *============================================================================*/
+
+static size_t export_rle_encode(const uint8_t* in, size_t n, uint8_t* out, size_t cap) {
+    size_t i = 0;
+    size_t o = 0;
+    while (i < n) {
+        size_t run = 1;
+        while (i + run < n && run < EXPORT_RLE_REPEAT_MAX && in[i + run] == in[i]) {
+            run++;
+        }
+        if (run >= EXPORT_RLE_REPEAT_MIN) {
+            if (o + 2 > cap) return 0;
+            out[o++] = (uint8_t)(run + 125);
+            out[o++] = in[i];
+            i += run;
+            continue;
+        }
+
+        /* Literal run up to the next repeat worth encoding */
+        size_t start = i;
+        while (i < n && i - start < EXPORT_RLE_LITERAL_MAX) {
+            if (i + 2 < n && in[i] == in[i + 1] && in[i] == in[i + 2]) {
+                break;
+            }
+            i++;
+        }
+        size_t len = i - start;
+        if (o + 1 + len > cap) return 0;
+        out[o++] = (uint8_t)(len - 1);
+        memcpy(out + o, in + start, len);
+        o += len;
+    }
+    return o;
+}
+
+static bool export_rle_decode(const uint8_t* in, size_t size, uint8_t* out, size_t n) {
+    size_t i = 0;
+    size_t o = 0;
+    while (i < size) {
+        uint8_t c = in[i++];
+        if (c < 128) {
+            size_t len = (size_t)c + 1;
+            if (i + len > size || o + len > n) return false;
+            memcpy(out + o, in + i, len);
+            i += len;
+            o += len;
+        } else {
+            size_t len = (size_t)c - 125;
+            if (i >= size || o + len > n) return false;
+            memset(out + o, in[i++], len);
+            o += len;
+        }
+    }
+    return o == n;
+}
+
+/*============================================================================
+ * Shared Helpers
+ *============================================================================*/
+
+/**
+ * @brief Digest identifying an Atlas state, used to match delta bases
+ *
+ * The checkpoint LSN is left out: it moves whenever the importing Atlas
+ * checkpoints, without any change to its contents.
+ */
+static void export_genesis_digest(const Seraph_Atlas_Genesis* genesis, uint8_t digest[32]) {
+    Seraph_Atlas_Genesis copy = *genesis;
+    copy.log_checkpoint_lsn = 0;
+    sha256(&copy, sizeof(copy), digest);
+}
+
+static uint64_t export_header_pages(void) {
+    return SERAPH_ATLAS_HEADER_SIZE / SERAPH_PAGE_SIZE;
+}
+
+/**
+ * @brief Pages holding snapshot metadata or the redo log are never exported
+ */
+static bool export_skip_page(const Seraph_Atlas* atlas, const Seraph_Atlas_Genesis* genesis,
+                             uint64_t page) {
+    uint64_t offset = page * SERAPH_PAGE_SIZE;
+    if (offset >= genesis->log_offset && offset < genesis->log_offset + genesis->log_size) {
+        return true;
+    }
+    return page < atlas->page_count && (atlas->cow_pending[page] & SERAPH_ATLAS_COW_META);
+}
+
+/*============================================================================
+ * Export
+ *============================================================================*/
+
+typedef struct {
+    FILE*                       file;
+    SHA256_Context              sha;
+    uint64_t                    records;
+    Seraph_Atlas_Export_Stats   stats;
+    bool                        ok;
+} Export_Writer;
+
+static void export_write(Export_Writer* w, const void* data, size_t size) {
+    if (!w->ok) {
+        return;
+    }
+    if (fwrite(data, 1, size, w->file) != size) {
+        w->ok = false;
+        return;
+    }
+    sha256_update(&w->sha, data, size);
+    w->stats.file_bytes += size;
+}
+
+/**
+ * @brief Write one page, XORed against @p base when given
+ */
+static void export_page(Export_Writer* w, uint64_t page_offset, const uint8_t* page,
+                        const uint8_t* base) {
+    uint8_t data[SERAPH_PAGE_SIZE];
+    uint8_t encoded[SERAPH_PAGE_SIZE];
+
+    memcpy(data, page, SERAPH_PAGE_SIZE);
+    if (page_offset == 0) {
+        /* Genesis travels in the export header */
+        memset(data, 0, sizeof(Seraph_Atlas_Genesis));
+    }
+    Seraph_Atlas_Export_Record record = { .page_offset = page_offset };
+    if (base != NULL) {
+        for (size_t i = 0; i < SERAPH_PAGE_SIZE; i++) {
+            data[i] ^= base[i];
+        }
+        record.flags = SERAPH_ATLAS_EXPORT_XOR;
+    }
+
+    size_t size = export_rle_encode(data, SERAPH_PAGE_SIZE, encoded, EXPORT_RLE_LIMIT);
+    const uint8_t* payload = encoded;
+    record.encoding = SERAPH_ATLAS_EXPORT_RLE;
+    if (size == 0) {
+        size = SERAPH_PAGE_SIZE;
+        payload = data;
+        record.encoding = SERAPH_ATLAS_EXPORT_RAW;
+    }
+    record.size = (uint32_t)size;
+
+    export_write(w, &record, sizeof(record));
+    export_write(w, payload, size);
+    w->records++;
+    w->stats.pages++;
+    w->stats.page_bytes += SERAPH_PAGE_SIZE;
+}
+
+/**
+ * @brief The page as @p snapshot sees it
+ */
+static const uint8_t* export_view(Seraph_Atlas* atlas, const Seraph_Atlas_Snapshot* snapshot,
+                                  uint64_t page) {
+    return (const uint8_t*)seraph_atlas_snapshot_read_page(
+        atlas, snapshot, (uint8_t*)atlas->base + page * SERAPH_PAGE_SIZE);
+}
+
+Seraph_Vbit seraph_atlas_snapshot_export(
+    Seraph_Atlas* atlas,
+    const Seraph_Atlas_Snapshot* snapshot,
+    uint64_t base_snapshot_id,
+    const char* path,
+    Seraph_Atlas_Export_Stats* stats
+) {
+    if (!seraph_atlas_is_valid(atlas) || snapshot == NULL || path == NULL) {
+        return SERAPH_VBIT_VOID;
+    }
+    if (snapshot->state != SERAPH_ATLAS_SNAP_COMMITTED ||
+        snapshot->magic != SERAPH_ATLAS_SNAPSHOT_MAGIC) {
+        return SERAPH_VBIT_VOID;
+    }
+
+    /* A delta base must list every page modified after it */
+    const Seraph_Atlas_Snapshot* base = NULL;
+    if (base_snapshot_id != 0) {
+        base = seraph_atlas_snapshot_get(atlas, base_snapshot_id);
+        if (base == NULL || base->state != SERAPH_ATLAS_SNAP_COMMITTED ||
+            base->included_pages != SERAPH_VOID_U64 ||
+            base->snapshot_id >= snapshot->snapshot_id) {
+            return SERAPH_VBIT_FALSE;
+        }
+    }
+
+    Export_Writer w = { .file = fopen(path, "wb"), .ok = true };
+    if (w.file == NULL) {
+        return SERAPH_VBIT_FALSE;
+    }
+    sha256_init(&w.sha);
+
+    const Seraph_Atlas_Genesis* genesis = &snapshot->genesis_copy;
+    Seraph_Atlas_Export_Header header;
+    memset(&header, 0, sizeof(header));
+    header.magic = SERAPH_ATLAS_EXPORT_MAGIC;
+    header.version = SERAPH_ATLAS_EXPORT_VERSION;
+    header.flags = base != NULL ? SERAPH_ATLAS_EXPORT_DELTA : 0;
+    header.snapshot_id = snapshot->snapshot_id;
+    header.base_snapshot_id = base_snapshot_id;
+    header.atlas_size = atlas->size;
+    header.page_size = SERAPH_PAGE_SIZE;
+    header.vclock_node_count = snapshot->vclock_node_count;
+    memcpy(header.vclock, snapshot->vclock, sizeof(header.vclock));
+    if (base != NULL) {
+        export_genesis_digest(&base->genesis_copy, header.base_digest);
+    }
+    header.genesis = *genesis;
+    export_write(&w, &header, sizeof(header));
+
+    /* The header page always goes out whole: it has no snapshot copy */
+    uint64_t header_end = export_header_pages();
+    for (uint64_t page = 0; page < header_end; page++) {
+        export_page(&w, page * SERAPH_PAGE_SIZE,
+                    (const uint8_t*)atlas->base + page * SERAPH_PAGE_SIZE, NULL);
+    }
+
+    uint64_t data_end = (genesis->next_alloc_offset + SERAPH_PAGE_SIZE - 1) / SERAPH_PAGE_SIZE;
+    if (data_end > atlas->page_count) {
+        data_end = atlas->page_count;
+    }
+    uint64_t first_new = header_end;
+
+    if (base != NULL) {
+        /* Pages the base copied are the only old pages that can differ */
+        const Seraph_Atlas_COW_Page* index = (const Seraph_Atlas_COW_Page*)
+            seraph_atlas_offset_to_ptr(atlas, base->cow_index_offset);
+        for (uint32_t i = 0; base->cow_index_offset != 0 && i < base->cow_index_capacity; i++) {
+            if (!(index[i].flags & SERAPH_ATLAS_COW_VALID)) continue;
+            uint64_t page = index[i].page_offset / SERAPH_PAGE_SIZE;
+            if (page < header_end || page >= data_end || export_skip_page(atlas, genesis, page)) {
+                continue;
+            }
+            const uint8_t* now = export_view(atlas, snapshot, page);
+            const uint8_t* before = (const uint8_t*)seraph_atlas_offset_to_ptr(
+                atlas, index[i].copy_offset);
+            if (now != NULL && before != NULL && memcmp(now, before, SERAPH_PAGE_SIZE) != 0) {
+                export_page(&w, index[i].page_offset, now, before);
+            }
+        }
+        /* Pages allocated after the base are sent whole */
+        first_new = (base->genesis_copy.next_alloc_offset + SERAPH_PAGE_SIZE - 1) /
+                    SERAPH_PAGE_SIZE;
+        if (first_new < header_end) {
+            first_new = header_end;
+        }
+    }
+
+    for (uint64_t page = first_new; page < data_end; page++) {
+        if (export_skip_page(atlas, genesis, page)) continue;
+        const uint8_t* now = export_view(atlas, snapshot, page);
+        if (now != NULL) {
+            export_page(&w, page * SERAPH_PAGE_SIZE, now, NULL);
+        }
+    }
+
+    Seraph_Atlas_Export_Trailer trailer = {
+        .magic = SERAPH_ATLAS_EXPORT_END_MAGIC,
+        .record_count = w.records,
+    };
+    sha256_final(&w.sha, trailer.digest);
+    if (w.ok && fwrite(&trailer, 1, sizeof(trailer), w.file) == sizeof(trailer)) {
+        w.stats.file_bytes += sizeof(trailer);
+    } else {
+        w.ok = false;
+    }
+
+    if (fclose(w.file) != 0) {
+        w.ok = false;
+    }
+    if (!w.ok) {
+        remove(path);
+        return SERAPH_VBIT_FALSE;
+    }
+    if (stats != NULL) {
+        *stats = w.stats;
+    }
+    return SERAPH_VBIT_TRUE;
+}
+
+/*============================================================================
+ * Import
+ *============================================================================*/
+
+typedef struct {
+    const uint8_t*  data;       /**< The whole file */
+    size_t          size;
+    size_t          pos;
+    SHA256_Context  sha;
+} Import_Reader;
+
+static bool import_read(Import_Reader* r, void* data, size_t size, bool hash) {
+    if (size > r->size - r->pos) {
+        return false;
+    }
+    memcpy(data, r->data + r->pos, size);
+    r->pos += size;
+    if (hash) {
+        sha256_update(&r->sha, data, size);
+    }
+    return true;
+}
+
+/**
+ * @brief Read a whole file into a malloc'd buffer
+ */
+static uint8_t* import_load(const char* path, size_t* size) {
+    FILE* file = fopen(path, "rb");
+    if (file == NULL) {
+        return NULL;
+    }
+    long end = -1;
+    if (fseek(file, 0, SEEK_END) == 0) {
+        end = ftell(file);
+    }
+    uint8_t* data = NULL;
+    if (end > 0 && fseek(file, 0, SEEK_SET) == 0) {
+        data = malloc((size_t)end);
+        if (data != NULL && fread(data, 1, (size_t)end, file) != (size_t)end) {
+            free(data);
+            data = NULL;
+        }
+    }
+    fclose(file);
+    *size = data != NULL ? (size_t)end : 0;
+    return data;
+}
+
+/**
+ * @brief Read every record after the header, decoding each into @p page
+ *
+ * With @p apply false this only validates the file: records must decode
+ * to whole pages inside the target, and the trailer's count and digest
+ * must match. With @p apply true each page is written to the Atlas.
+ */
+static bool import_records(Seraph_Atlas* atlas, Import_Reader* r,
+                           const Seraph_Atlas_Export_Header* header, bool apply,
+                           Seraph_Atlas_Export_Stats* stats) {
+    uint8_t payload[SERAPH_PAGE_SIZE];
+    uint8_t page[SERAPH_PAGE_SIZE];
+    uint64_t records = 0;
+
+    for (;;) {
+        Seraph_Atlas_Export_Record record;
+        if (!import_read(r, &record, sizeof(record), false)) {
+            return false;
+        }
+
+        if (record.page_offset == SERAPH_ATLAS_EXPORT_END_MAGIC) {
+            /* The record header was really the start of the trailer */
+            Seraph_Atlas_Export_Trailer trailer;
+            memcpy(&trailer, &record, sizeof(record));
+            if (!import_read(r, (uint8_t*)&trailer + sizeof(record),
+                             sizeof(trailer) - sizeof(record), false)) {
+                return false;
+            }
+            uint8_t digest[32];
+            sha256_final(&r->sha, digest);
+            return trailer.record_count == records &&
+                   sha256_equal(digest, trailer.digest) &&
+                   r->pos == r->size;
+        }
+        sha256_update(&r->sha, &record, sizeof(record));
+
+        if (record.page_offset % SERAPH_PAGE_SIZE != 0 ||
+            record.page_offset >= header->atlas_size ||
+            record.size > SERAPH_PAGE_SIZE ||
+            (record.flags & ~SERAPH_ATLAS_EXPORT_XOR) != 0 ||
+            !import_read(r, payload, record.size, true)) {
+            return false;
+        }
+
+        if (record.encoding == SERAPH_ATLAS_EXPORT_RAW) {
+            if (record.size != SERAPH_PAGE_SIZE) return false;
+            memcpy(page, payload, SERAPH_PAGE_SIZE);
+        } else if (record.encoding != SERAPH_ATLAS_EXPORT_RLE ||
+                   !export_rle_decode(payload, record.size, page, SERAPH_PAGE_SIZE)) {
+            return false;
+        }
+        records++;
+
+        if (!apply) {
+            continue;
+        }
+
+        /* Genesis comes from the export header, not the page image */
+        size_t skip = record.page_offset == 0 ? sizeof(Seraph_Atlas_Genesis) : 0;
+        uint8_t* dst = (uint8_t*)atlas->base + record.page_offset;
+        if (record.flags & SERAPH_ATLAS_EXPORT_XOR) {
+            for (size_t i = skip; i < SERAPH_PAGE_SIZE; i++) {
+                dst[i] ^= page[i];
+            }
+        } else {
+            memcpy(dst + skip, page + skip, SERAPH_PAGE_SIZE - skip);
+        }
+        stats->pages++;
+        stats->page_bytes += SERAPH_PAGE_SIZE;
+        stats->file_bytes += sizeof(record) + record.size;
+    }
+}
+
+Seraph_Vbit seraph_atlas_snapshot_import(
+    Seraph_Atlas* atlas,
+    const char* path,
+    Seraph_Atlas_Export_Stats* stats
+) {
+    if (!seraph_atlas_is_valid(atlas) || path == NULL) {
+        return SERAPH_VBIT_VOID;
+    }
+
+    Import_Reader r = { 0 };
+    uint8_t* data = import_load(path, &r.size);
+    if (data == NULL) {
+        return SERAPH_VBIT_FALSE;
+    }
+    r.data = data;
+
+    Seraph_Atlas_Genesis* genesis = seraph_atlas_genesis(atlas);
+    Seraph_Atlas_Export_Header header;
+    Seraph_Atlas_Export_Stats applied = { 0 };
+    bool ok = false;
+
+    /* Pass 1: check that the file is whole and fits this Atlas */
+    sha256_init(&r.sha);
+    if (import_read(&r, &header, sizeof(header), true) &&
+        header.magic == SERAPH_ATLAS_EXPORT_MAGIC &&
+        header.version == SERAPH_ATLAS_EXPORT_VERSION &&
+        header.page_size == SERAPH_PAGE_SIZE &&
+        header.atlas_size <= atlas->size &&
+        header.genesis.magic == SERAPH_ATLAS_MAGIC &&
+        header.genesis.next_alloc_offset <= atlas->size &&
+        header.genesis.log_offset == genesis->log_offset &&
+        header.genesis.log_size == genesis->log_size &&
+        header.vclock_node_count <= SERAPH_ATLAS_VCLOCK_MAX_NODES) {
+        ok = import_records(atlas, &r, &header, false, &applied);
+    }
+
+    /* A delta only applies on top of its base */
+    if (ok && (header.flags & SERAPH_ATLAS_EXPORT_DELTA)) {
+        uint8_t digest[32];
+        export_genesis_digest(genesis, digest);
+        ok = sha256_equal(digest, header.base_digest);
+    }
+
+    if (!ok) {
+        free(data);
+        return SERAPH_VBIT_FALSE;
+    }
+
+    /* Abort all active transactions, as restore does */
+    for (uint32_t i = 0; i < atlas->tx_capacity; i++) {
+        if (atlas->transactions[i] != NULL &&
+            atlas->transactions[i]->state == SERAPH_ATLAS_TX_ACTIVE) {
+            seraph_atlas_abort(atlas, atlas->transactions[i]);
+        }
+    }
+
+    /* Pass 2: apply the pages from the verified buffer, then Genesis */
+    r.pos = 0;
+    sha256_init(&r.sha);
+    applied = (Seraph_Atlas_Export_Stats){ .file_bytes = sizeof(header) +
+                                                         sizeof(Seraph_Atlas_Export_Trailer) };
+    ok = import_read(&r, &header, sizeof(header), true) &&
+         import_records(atlas, &r, &header, true, &applied);
+    free(data);
+    if (!ok) {
+        return SERAPH_VBIT_FALSE;
+    }
+
+    uint64_t log_checkpoint_lsn = genesis->log_checkpoint_lsn;
+    memcpy(genesis, &header.genesis, sizeof(Seraph_Atlas_Genesis));
+    genesis->log_checkpoint_lsn = log_checkpoint_lsn;
+
+    /* The imported state happens-after both timelines */
+    for (uint32_t i = 0; i < header.vclock_node_count; i++) {
+        if (header.vclock[i] > atlas->current_vclock[i]) {
+            atlas->current_vclock[i] = header.vclock[i];
+        }
+    }
+    if (atlas->local_node_id < SERAPH_ATLAS_VCLOCK_MAX_NODES) {
+        atlas->current_vclock[atlas->local_node_id]++;
+    }
+
+    /* Checkpoint so log replay cannot bring back pre-import pages */
+    if (seraph_atlas_checkpoint(atlas) != SERAPH_VBIT_TRUE) {
+        seraph_atlas_sync(atlas);
+    }
+
+    if (stats != NULL) {
+        *stats = applied;
+    }
+    return SERAPH_VBIT_TRUE;
+}
+
+#endif /* !SERAPH_KERNEL */
@@ -194,6 +194,71 @@ Seraph_Vbit seraph_cap_copy(Seraph_Capability dst, uint64_t dst_offset,
     return SERAPH_VBIT_TRUE;
 }
 
+/*============================================================================
+ * Bulk Capability Operations
+ *============================================================================*/
+
+Seraph_Vbit seraph_cap_read_array(Seraph_Capability cap, uint64_t offset,
+                                   void* dst, uint64_t length) {
+    if (seraph_cap_is_void(cap) || dst == NULL) return SERAPH_VBIT_VOID;
+    if (!seraph_cap_can_read(cap)) return SERAPH_VBIT_FALSE;
+    if (!seraph_cap_range_valid(cap, offset, length)) return SERAPH_VBIT_FALSE;
+    if (seraph_cap_is_sealed(cap)) return SERAPH_VBIT_FALSE;
+
+    memcpy(dst, (char*)cap.base + offset, length);
+    return SERAPH_VBIT_TRUE;
+}
+
+Seraph_Vbit seraph_cap_write_array(Seraph_Capability cap, uint64_t offset,
+                                    const void* src, uint64_t length) {
+    if (seraph_cap_is_void(cap) || src == NULL) return SERAPH_VBIT_VOID;
+    if (!seraph_cap_can_write(cap)) return SERAPH_VBIT_FALSE;
+    if (!seraph_cap_range_valid(cap, offset, length)) return SERAPH_VBIT_FALSE;
+    if (seraph_cap_is_sealed(cap)) return SERAPH_VBIT_FALSE;
+
+    memcpy((char*)cap.base + offset, src, length);
+    return SERAPH_VBIT_TRUE;
+}
+
+Seraph_Vbit seraph_cap_fill(Seraph_Capability cap, uint64_t offset,
+                             uint8_t value, uint64_t length) {
+    if (seraph_cap_is_void(cap)) return SERAPH_VBIT_VOID;
+    if (!seraph_cap_can_write(cap)) return SERAPH_VBIT_FALSE;
+    if (!seraph_cap_range_valid(cap, offset, length)) return SERAPH_VBIT_FALSE;
+    if (seraph_cap_is_sealed(cap)) return SERAPH_VBIT_FALSE;
+    if (SERAPH_IS_VOID_U8(value)) return SERAPH_VBIT_FALSE;
+
+    memset((char*)cap.base + offset, value, length);
+    return SERAPH_VBIT_TRUE;
+}
+
+Seraph_Vbit seraph_cap_compare(Seraph_Capability a, uint64_t a_offset,
+                                Seraph_Capability b, uint64_t b_offset,
+                                uint64_t length) {
+    Seraph_CapSpan sa = seraph_cap_span(a, a_offset, length, SERAPH_CAP_READ);
+    Seraph_CapSpan sb = seraph_cap_span(b, b_offset, length, SERAPH_CAP_READ);
+    if (seraph_span_is_void(sa) || seraph_span_is_void(sb)) {
+        return SERAPH_VBIT_VOID;
+    }
+
+    return memcmp(sa.data, sb.data, length) == 0 ? SERAPH_VBIT_TRUE : SERAPH_VBIT_FALSE;
+}
+
+/*============================================================================
+ * Checked Spans
+ *============================================================================*/
+
+Seraph_CapSpan seraph_cap_span(Seraph_Capability cap, uint64_t offset,
+                                uint64_t length, uint8_t perms) {
+    if (seraph_cap_is_void(cap)) return SERAPH_CAP_SPAN_VOID;
+    if (!seraph_cap_has_perm(cap, perms)) return SERAPH_CAP_SPAN_VOID;
+    if (!seraph_cap_range_valid(cap, offset, length)) return SERAPH_CAP_SPAN_VOID;
+    if (seraph_cap_is_sealed(cap)) return SERAPH_CAP_SPAN_VOID;
+
+    Seraph_CapSpan span = { (uint8_t*)cap.base + offset, length, perms };
+    return span;
+}
+
 /*============================================================================
  * Capability Descriptor Table (CDT)
  *============================================================================*/
@@ -3,18 +3,28 @@
  * @brief SHA-256 Cryptographic Hash Implementation
  *
  * FIPS 180-4 compliant SHA-256 implementation.
- * Optimized for clarity and correctness over speed.
  *
  * This implementation:
  * - Has no external dependencies
- * - Is suitable for kernel space
+ * - Is suitable for kernel space (scalar only there)
  * - Handles arbitrary input lengths
  * - Provides Merkle tree support
+ * - Selects SHA-NI or AVX2 block kernels at runtime on x86-64
  */
 
 #include "seraph/crypto/sha256.h"
+#include <stdatomic.h>
 #include <string.h>
 
+/*
+ * SIMD kernels need GCC/Clang target attributes and are never used in the
+ * kernel, where vector registers are not saved across interrupts.
+ */
+#if !defined(SERAPH_KERNEL) && defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define SHA256_X86_SIMD 1
+#include <immintrin.h>
+#endif
+
 /*============================================================================
  * SHA-256 Constants
  *============================================================================*/
@@ -91,64 +101,404 @@ static inline void store_be64(uint8_t* p, uint64_t v) {
 }
 
 /*============================================================================
- * SHA-256 Transform (Process One Block)
+ * Scalar Block Kernel
  *============================================================================*/
 
 /**
- * @brief Process a single 512-bit (64-byte) block
+ * @brief Process consecutive 512-bit (64-byte) blocks
  */
-static void sha256_transform(uint32_t state[8], const uint8_t block[64]) {
+static void sha256_blocks_scalar(uint32_t state[8], const uint8_t* data, size_t blocks) {
     uint32_t W[64];
     uint32_t a, b, c, d, e, f, g, h;
     uint32_t T1, T2;
     int t;
 
-    /* Prepare message schedule */
-    for (t = 0; t < 16; t++) {
-        W[t] = load_be32(&block[t * 4]);
-    }
-    for (t = 16; t < 64; t++) {
-        W[t] = sigma1(W[t-2]) + W[t-7] + sigma0(W[t-15]) + W[t-16];
-    }
-
-    /* Initialize working variables */
-    a = state[0];
-    b = state[1];
-    c = state[2];
-    d = state[3];
-    e = state[4];
-    f = state[5];
-    g = state[6];
-    h = state[7];
-
-    /* 64 rounds */
-    for (t = 0; t < 64; t++) {
-        T1 = h + SIGMA1(e) + CH(e, f, g) + K[t] + W[t];
-        T2 = SIGMA0(a) + MAJ(a, b, c);
-        h = g;
-        g = f;
-        f = e;
-        e = d + T1;
-        d = c;
-        c = b;
-        b = a;
-        a = T1 + T2;
-    }
-
-    /* Update state */
-    state[0] += a;
-    state[1] += b;
-    state[2] += c;
-    state[3] += d;
-    state[4] += e;
-    state[5] += f;
-    state[6] += g;
-    state[7] += h;
+    for (; blocks > 0; blocks--, data += SHA256_BLOCK_SIZE) {
+        /* Prepare message schedule */
+        for (t = 0; t < 16; t++) {
+            W[t] = load_be32(&data[t * 4]);
+        }
+        for (t = 16; t < 64; t++) {
+            W[t] = sigma1(W[t-2]) + W[t-7] + sigma0(W[t-15]) + W[t-16];
+        }
+
+        /* Initialize working variables */
+        a = state[0];
+        b = state[1];
+        c = state[2];
+        d = state[3];
+        e = state[4];
+        f = state[5];
+        g = state[6];
+        h = state[7];
+
+        /* 64 rounds */
+        for (t = 0; t < 64; t++) {
+            T1 = h + SIGMA1(e) + CH(e, f, g) + K[t] + W[t];
+            T2 = SIGMA0(a) + MAJ(a, b, c);
+            h = g;
+            g = f;
+            f = e;
+            e = d + T1;
+            d = c;
+            c = b;
+            b = a;
+            a = T1 + T2;
+        }
+
+        /* Update state */
+        state[0] += a;
+        state[1] += b;
+        state[2] += c;
+        state[3] += d;
+        state[4] += e;
+        state[5] += f;
+        state[6] += g;
+        state[7] += h;
+    }
 
     /* Clear sensitive data */
     memset(W, 0, sizeof(W));
 }
 
+#ifdef SHA256_X86_SIMD
+
+/*============================================================================
+ * SHA-NI Block Kernel
+ *============================================================================*/
+
+/*
+ * The SHA extensions keep the state as two vectors, ABEF and CDGH.
+ * SHA256RNDS2 runs two rounds per call; each 4-word message group
+ * feeds four rounds. SHA256MSG1/MSG2 extend the message schedule.
+ */
+
+/* Four rounds on message group w with round constants K[4i..4i+3] */
+#define SHANI_ROUNDS(i, w) do { \
+        __m128i m_ = _mm_add_epi32((w), _mm_loadu_si128((const __m128i*)&K[(i) * 4])); \
+        state1 = _mm_sha256rnds2_epu32(state1, state0, m_); \
+        state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(m_, 0x0E)); \
+    } while (0)
+
+/* Replace w0 with the group following w0..w3 */
+#define SHANI_SCHEDULE(w0, w1, w2, w3) \
+    (w0) = _mm_sha256msg2_epu32( \
+        _mm_add_epi32(_mm_sha256msg1_epu32((w0), (w1)), _mm_alignr_epi8((w3), (w2), 4)), (w3))
+
+__attribute__((target("sha,sse4.1")))
+static void sha256_blocks_shani(uint32_t state[8], const uint8_t* data, size_t blocks) {
+    const __m128i bswap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+
+    __m128i tmp = _mm_loadu_si128((const __m128i*)&state[0]);
+    __m128i state1 = _mm_loadu_si128((const __m128i*)&state[4]);
+    tmp = _mm_shuffle_epi32(tmp, 0xB1);                 /* CDAB */
+    state1 = _mm_shuffle_epi32(state1, 0x1B);           /* EFGH */
+    __m128i state0 = _mm_alignr_epi8(tmp, state1, 8);   /* ABEF */
+    state1 = _mm_blend_epi16(state1, tmp, 0xF0);        /* CDGH */
+
+    for (; blocks > 0; blocks--, data += SHA256_BLOCK_SIZE) {
+        __m128i abef_save = state0;
+        __m128i cdgh_save = state1;
+
+        __m128i w0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(data + 0)), bswap);
+        __m128i w1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(data + 16)), bswap);
+        __m128i w2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(data + 32)), bswap);
+        __m128i w3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(data + 48)), bswap);
+
+        SHANI_ROUNDS(0, w0);
+        SHANI_ROUNDS(1, w1);
+        SHANI_ROUNDS(2, w2);
+        SHANI_ROUNDS(3, w3);
+        for (int i = 4; i < 16; i += 4) {
+            SHANI_SCHEDULE(w0, w1, w2, w3);
+            SHANI_ROUNDS(i, w0);
+            SHANI_SCHEDULE(w1, w2, w3, w0);
+            SHANI_ROUNDS(i + 1, w1);
+            SHANI_SCHEDULE(w2, w3, w0, w1);
+            SHANI_ROUNDS(i + 2, w2);
+            SHANI_SCHEDULE(w3, w0, w1, w2);
+            SHANI_ROUNDS(i + 3, w3);
+        }
+
+        state0 = _mm_add_epi32(state0, abef_save);
+        state1 = _mm_add_epi32(state1, cdgh_save);
+    }
+
+    tmp = _mm_shuffle_epi32(state0, 0x1B);              /* FEBA */
+    state1 = _mm_shuffle_epi32(state1, 0xB1);           /* DCHG */
+    state0 = _mm_blend_epi16(tmp, state1, 0xF0);        /* DCBA */
+    state1 = _mm_alignr_epi8(state1, tmp, 8);           /* HGFE */
+    _mm_storeu_si128((__m128i*)&state[0], state0);
+    _mm_storeu_si128((__m128i*)&state[4], state1);
+}
+
+/*============================================================================
+ * AVX2 Multi-Buffer Kernel
+ *============================================================================*/
+
+/* Per-lane view of one message: whole blocks from the input, then 1-2
+ * padded tail blocks from a private buffer. */
+typedef struct {
+    const uint8_t* data;
+    size_t full_blocks;
+    size_t total_blocks;
+    uint8_t tail[SHA256_BLOCK_SIZE * 2];
+} SHA256_Lane;
+
+static void sha256_lane_init(SHA256_Lane* lane, const uint8_t* data, size_t len,
+                             uint64_t prefix_bits) {
+    size_t rem = len % SHA256_BLOCK_SIZE;
+    size_t tail_blocks = rem + 9 > SHA256_BLOCK_SIZE ? 2 : 1;
+
+    lane->data = data;
+    lane->full_blocks = len / SHA256_BLOCK_SIZE;
+    lane->total_blocks = lane->full_blocks + tail_blocks;
+
+    memset(lane->tail, 0, sizeof(lane->tail));
+    if (rem > 0) {
+        memcpy(lane->tail, data + lane->full_blocks * SHA256_BLOCK_SIZE, rem);
+    }
+    lane->tail[rem] = 0x80;
+    store_be64(&lane->tail[tail_blocks * SHA256_BLOCK_SIZE - 8],
+               prefix_bits + (uint64_t)len * 8);
+}
+
+static const uint8_t* sha256_lane_block(const SHA256_Lane* lane, size_t j) {
+    if (j < lane->full_blocks) return lane->data + j * SHA256_BLOCK_SIZE;
+    return lane->tail + (j - lane->full_blocks) * SHA256_BLOCK_SIZE;
+}
+
+#define MB_ROTR(x, n) _mm256_or_si256(_mm256_srli_epi32((x), (n)), _mm256_slli_epi32((x), 32 - (n)))
+#define MB_XOR3(a, b, c) _mm256_xor_si256(_mm256_xor_si256((a), (b)), (c))
+#define MB_SIGMA0(x) MB_XOR3(MB_ROTR(x, 2), MB_ROTR(x, 13), MB_ROTR(x, 22))
+#define MB_SIGMA1(x) MB_XOR3(MB_ROTR(x, 6), MB_ROTR(x, 11), MB_ROTR(x, 25))
+#define MB_sigma0(x) MB_XOR3(MB_ROTR(x, 7), MB_ROTR(x, 18), _mm256_srli_epi32((x), 3))
+#define MB_sigma1(x) MB_XOR3(MB_ROTR(x, 17), MB_ROTR(x, 19), _mm256_srli_epi32((x), 10))
+
+/**
+ * @brief Hash up to eight messages, one per 32-bit lane
+ *
+ * Each lane starts from its start context (block-aligned, buffer empty)
+ * or from the initial state when start is NULL. Lanes whose message is
+ * exhausted keep running on a dummy block but their state is masked out
+ * of the update.
+ */
+__attribute__((target("avx2")))
+static void sha256_x8_avx2(const SHA256_Context* const start[], const uint8_t* const data[],
+                           const size_t len[], size_t count, uint8_t* digests) {
+    static const uint8_t zero_block[SHA256_BLOCK_SIZE];
+    const __m256i bswap = _mm256_set_epi8(
+        12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3,
+        12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+
+    SHA256_Lane lanes[SHA256_MULTI_LANES];
+    uint32_t init[8][SHA256_MULTI_LANES];
+    size_t max_blocks = 0;
+    for (size_t l = 0; l < SHA256_MULTI_LANES; l++) {
+        const uint32_t* from = l < count && start != NULL ? start[l]->state : sha256_init_state;
+        for (int i = 0; i < 8; i++) {
+            init[i][l] = from[i];
+        }
+        if (l < count) {
+            sha256_lane_init(&lanes[l], data[l], len[l], start != NULL ? start[l]->count : 0);
+        } else {
+            lanes[l].data = zero_block;
+            lanes[l].full_blocks = 0;
+            lanes[l].total_blocks = 0;
+        }
+        if (lanes[l].total_blocks > max_blocks) max_blocks = lanes[l].total_blocks;
+    }
+
+    __m256i st[8];
+    for (int i = 0; i < 8; i++) {
+        st[i] = _mm256_loadu_si256((const __m256i*)init[i]);
+    }
+
+    for (size_t j = 0; j < max_blocks; j++) {
+        const uint8_t* blk[SHA256_MULTI_LANES];
+        int32_t active[SHA256_MULTI_LANES];
+        for (size_t l = 0; l < SHA256_MULTI_LANES; l++) {
+            active[l] = j < lanes[l].total_blocks ? -1 : 0;
+            blk[l] = active[l] ? sha256_lane_block(&lanes[l], j) : zero_block;
+        }
+        __m256i mask = _mm256_loadu_si256((const __m256i*)active);
+
+        __m256i W[16];
+        for (int t = 0; t < 16; t++) {
+            uint32_t word[SHA256_MULTI_LANES];
+            for (size_t l = 0; l < SHA256_MULTI_LANES; l++) {
+                memcpy(&word[l], blk[l] + t * 4, 4);
+            }
+            W[t] = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*)word), bswap);
+        }
+
+        __m256i a = st[0], b = st[1], c = st[2], d = st[3];
+        __m256i e = st[4], f = st[5], g = st[6], h = st[7];
+
+        for (int t = 0; t < 64; t++) {
+            __m256i w;
+            if (t < 16) {
+                w = W[t];
+            } else {
+                w = _mm256_add_epi32(
+                    _mm256_add_epi32(MB_sigma1(W[(t - 2) & 15]), W[(t - 7) & 15]),
+                    _mm256_add_epi32(MB_sigma0(W[(t - 15) & 15]), W[t & 15]));
+                W[t & 15] = w;
+            }
+
+            __m256i ch = _mm256_xor_si256(_mm256_and_si256(e, f), _mm256_andnot_si256(e, g));
+            __m256i maj = _mm256_xor_si256(
+                _mm256_and_si256(a, b),
+                _mm256_and_si256(c, _mm256_xor_si256(a, b)));
+            __m256i t1 = _mm256_add_epi32(
+                _mm256_add_epi32(h, MB_SIGMA1(e)),
+                _mm256_add_epi32(_mm256_add_epi32(ch, _mm256_set1_epi32((int)K[t])), w));
+            __m256i t2 = _mm256_add_epi32(MB_SIGMA0(a), maj);
+
+            h = g;
+            g = f;
+            f = e;
+            e = _mm256_add_epi32(d, t1);
+            d = c;
+            c = b;
+            b = a;
+            a = _mm256_add_epi32(t1, t2);
+        }
+
+        __m256i out[8] = { a, b, c, d, e, f, g, h };
+        for (int i = 0; i < 8; i++) {
+            st[i] = _mm256_blendv_epi8(st[i], _mm256_add_epi32(st[i], out[i]), mask);
+        }
+    }
+
+    for (size_t l = 0; l < count && l < SHA256_MULTI_LANES; l++) {
+        for (int i = 0; i < 8; i++) {
+            uint32_t word[SHA256_MULTI_LANES];
+            _mm256_storeu_si256((__m256i*)word, st[i]);
+            store_be32(&digests[l * SHA256_DIGEST_SIZE + i * 4], word[l]);
+        }
+    }
+    memset(lanes, 0, sizeof(lanes));
+    memset(init, 0, sizeof(init));
+}
+
+/*============================================================================
+ * CPU Feature Detection
+ *============================================================================*/
+
+static void sha256_cpuid(uint32_t leaf, uint32_t sub, uint32_t* a, uint32_t* b,
+                         uint32_t* c, uint32_t* d) {
+    __asm__ volatile("cpuid" : "=a"(*a), "=b"(*b), "=c"(*c), "=d"(*d) : "a"(leaf), "c"(sub));
+}
+
+static int sha256_cpu_has(SHA256_Impl impl) {
+    uint32_t a, b, c, d;
+    sha256_cpuid(0, 0, &a, &b, &c, &d);
+    if (a < 7) return 0;
+
+    sha256_cpuid(1, 0, &a, &b, &c, &d);
+    uint32_t ecx1 = c;
+    sha256_cpuid(7, 0, &a, &b, &c, &d);
+    uint32_t ebx7 = b;
+
+    if (impl == SHA256_IMPL_SHA_NI) {
+        /* SHA (7.EBX[29]) plus SSSE3 and SSE4.1 for the shuffles */
+        return (ebx7 >> 29 & 1) && (ecx1 >> 9 & 1) && (ecx1 >> 19 & 1);
+    }
+    if (impl == SHA256_IMPL_AVX2) {
+        /* AVX2 (7.EBX[5]) and the OS saving YMM state (OSXSAVE, XCR0[2:1]) */
+        if (!(ebx7 >> 5 & 1) || !(ecx1 >> 27 & 1)) return 0;
+        uint32_t xcr0_lo, xcr0_hi;
+        __asm__ volatile("xgetbv" : "=a"(xcr0_lo), "=d"(xcr0_hi) : "c"(0));
+        return (xcr0_lo & 6) == 6;
+    }
+    return 0;
+}
+
+#endif /* SHA256_X86_SIMD */
+
+/*============================================================================
+ * Dispatch
+ *============================================================================*/
+
+typedef void (*SHA256_Blocks_Fn)(uint32_t state[8], const uint8_t* data, size_t blocks);
+
+/*
+ * Resolved on first use by whichever thread gets there; racing resolutions
+ * store the same values. The function pointer is published last, with
+ * release, so a reader that sees it also sees the matching multi impl.
+ */
+static _Atomic(SHA256_Blocks_Fn) sha256_blocks_fn = NULL;
+static _Atomic(SHA256_Impl) sha256_multi_impl = SHA256_IMPL_SCALAR;
+
+static SHA256_Blocks_Fn sha256_active_blocks(void) {
+    SHA256_Blocks_Fn fn = atomic_load_explicit(&sha256_blocks_fn, memory_order_acquire);
+    if (fn == NULL) {
+        sha256_set_impl(SHA256_IMPL_AUTO);
+        fn = atomic_load_explicit(&sha256_blocks_fn, memory_order_acquire);
+    }
+    return fn;
+}
+
+int sha256_impl_supported(SHA256_Impl impl) {
+    switch (impl) {
+        case SHA256_IMPL_AUTO:
+        case SHA256_IMPL_SCALAR:
+            return 1;
+#ifdef SHA256_X86_SIMD
+        case SHA256_IMPL_SHA_NI:
+        case SHA256_IMPL_AVX2:
+            return sha256_cpu_has(impl);
+#endif
+        default:
+            return 0;
+    }
+}
+
+int sha256_set_impl(SHA256_Impl impl) {
+    if (!sha256_impl_supported(impl)) return 0;
+
+    if (impl == SHA256_IMPL_AUTO) {
+        /* One SHA-NI stream outruns eight AVX2 lanes, so prefer it for both */
+        if (sha256_impl_supported(SHA256_IMPL_SHA_NI)) {
+            impl = SHA256_IMPL_SHA_NI;
+        } else if (sha256_impl_supported(SHA256_IMPL_AVX2)) {
+            impl = SHA256_IMPL_AVX2;
+        } else {
+            impl = SHA256_IMPL_SCALAR;
+        }
+    }
+
+    SHA256_Blocks_Fn fn = sha256_blocks_scalar;
+#ifdef SHA256_X86_SIMD
+    if (impl == SHA256_IMPL_SHA_NI) {
+        fn = sha256_blocks_shani;
+    }
+#endif
+    atomic_store_explicit(&sha256_multi_impl, impl, memory_order_relaxed);
+    atomic_store_explicit(&sha256_blocks_fn, fn, memory_order_release);
+    return 1;
+}
+
+SHA256_Impl sha256_get_impl(void) {
+    sha256_active_blocks();
+    return atomic_load_explicit(&sha256_multi_impl, memory_order_relaxed);
+}
+
+const char* sha256_impl_name(SHA256_Impl impl) {
+    switch (impl) {
+        case SHA256_IMPL_AUTO:   return "auto";
+        case SHA256_IMPL_SCALAR: return "scalar";
+        case SHA256_IMPL_SHA_NI: return "sha-ni";
+        case SHA256_IMPL_AVX2:   return "avx2";
+        default:                 return "unknown";
+    }
+}
+
+static void sha256_blocks(uint32_t state[8], const uint8_t* data, size_t blocks) {
+    sha256_active_blocks()(state, data, blocks);
+}
+
 /*============================================================================
  * Context API Implementation
  *============================================================================*/
@@ -174,7 +524,7 @@ void sha256_update(SHA256_Context* ctx, const void* data, size_t len) {
         size_t needed = SHA256_BLOCK_SIZE - buffer_fill;
         if (len >= needed) {
             memcpy(&ctx->buffer[buffer_fill], input, needed);
-            sha256_transform(ctx->state, ctx->buffer);
+            sha256_blocks(ctx->state, ctx->buffer, 1);
             input += needed;
             len -= needed;
             buffer_fill = 0;
@@ -185,10 +535,11 @@ void sha256_update(SHA256_Context* ctx, const void* data, size_t len) {
     }
 
     /* Process complete blocks */
-    while (len >= SHA256_BLOCK_SIZE) {
-        sha256_transform(ctx->state, input);
-        input += SHA256_BLOCK_SIZE;
-        len -= SHA256_BLOCK_SIZE;
+    if (len >= SHA256_BLOCK_SIZE) {
+        size_t blocks = len / SHA256_BLOCK_SIZE;
+        sha256_blocks(ctx->state, input, blocks);
+        input += blocks * SHA256_BLOCK_SIZE;
+        len -= blocks * SHA256_BLOCK_SIZE;
     }
 
     /* Store remaining partial block */
@@ -228,10 +579,7 @@ void sha256_final(SHA256_Context* ctx, uint8_t* digest) {
     store_be64(&finalblock[buffer_fill + pad_len - 8], ctx->count);
 
     /* Process final block(s) */
-    sha256_transform(ctx->state, finalblock);
-    if (buffer_fill > 56) {
-        sha256_transform(ctx->state, &finalblock[64]);
-    }
+    sha256_blocks(ctx->state, finalblock, (buffer_fill + pad_len) / SHA256_BLOCK_SIZE);
 
     /* Output hash */
     for (int i = 0; i < 8; i++) {
@@ -265,6 +613,54 @@ SHA256_Hash sha256_compute(const void* data, size_t len) {
     return hash;
 }
 
+void sha256_multi(const void* const data[], const size_t len[], size_t count,
+                  uint8_t* digests) {
+    if (data == NULL || len == NULL || digests == NULL) return;
+
+#ifdef SHA256_X86_SIMD
+    if (sha256_get_impl() == SHA256_IMPL_AVX2) {
+        for (size_t i = 0; i < count; i += SHA256_MULTI_LANES) {
+            size_t n = count - i < SHA256_MULTI_LANES ? count - i : SHA256_MULTI_LANES;
+            sha256_x8_avx2(NULL, (const uint8_t* const*)&data[i], &len[i], n,
+                           &digests[i * SHA256_DIGEST_SIZE]);
+        }
+        return;
+    }
+#endif
+
+    for (size_t i = 0; i < count; i++) {
+        sha256(data[i], len[i], &digests[i * SHA256_DIGEST_SIZE]);
+    }
+}
+
+void sha256_multi_from(const SHA256_Context* const start[], const void* const data[],
+                       const size_t len[], size_t count, uint8_t* digests) {
+    if (start == NULL || data == NULL || len == NULL || digests == NULL) return;
+
+#ifdef SHA256_X86_SIMD
+    if (sha256_get_impl() == SHA256_IMPL_AVX2) {
+        int aligned = 1;
+        for (size_t i = 0; i < count; i++) {
+            aligned &= start[i]->count % (SHA256_BLOCK_SIZE * 8) == 0;
+        }
+        if (aligned) {
+            for (size_t i = 0; i < count; i += SHA256_MULTI_LANES) {
+                size_t n = count - i < SHA256_MULTI_LANES ? count - i : SHA256_MULTI_LANES;
+                sha256_x8_avx2(&start[i], (const uint8_t* const*)&data[i], &len[i], n,
+                               &digests[i * SHA256_DIGEST_SIZE]);
+            }
+            return;
+        }
+    }
+#endif
+
+    for (size_t i = 0; i < count; i++) {
+        SHA256_Context ctx = *start[i];
+        sha256_update(&ctx, data[i], len[i]);
+        sha256_final(&ctx, &digests[i * SHA256_DIGEST_SIZE]);
+    }
+}
+
 /*============================================================================
  * Utility Functions Implementation
  *============================================================================*/
@@ -353,6 +749,40 @@ void sha256_hash_pair(const uint8_t* left, const uint8_t* right, uint8_t* parent
     sha256_final(&ctx, parent);
 }
 
+/**
+ * @brief Hash one Merkle level into its parent level
+ *
+ * Pairs go through sha256_multi() so AVX2 can hash eight at a time.
+ * parents may equal level: each batch is read before it is written.
+ */
+static void merkle_hash_level(const uint8_t* level, size_t level_size, uint8_t* parents) {
+    size_t next_size = (level_size + 1) / 2;
+    uint8_t odd[2 * SHA256_DIGEST_SIZE];
+    uint8_t out[SHA256_MULTI_LANES * SHA256_DIGEST_SIZE];
+    const void* msgs[SHA256_MULTI_LANES];
+    size_t lens[SHA256_MULTI_LANES];
+
+    for (size_t i = 0; i < next_size; i += SHA256_MULTI_LANES) {
+        size_t n = next_size - i < SHA256_MULTI_LANES ? next_size - i : SHA256_MULTI_LANES;
+
+        for (size_t k = 0; k < n; k++) {
+            size_t left = (i + k) * 2;
+            if (left + 1 < level_size) {
+                msgs[k] = &level[left * SHA256_DIGEST_SIZE];
+            } else {
+                /* Odd number of nodes: duplicate last one */
+                sha256_copy(odd, &level[left * SHA256_DIGEST_SIZE]);
+                sha256_copy(odd + SHA256_DIGEST_SIZE, &level[left * SHA256_DIGEST_SIZE]);
+                msgs[k] = odd;
+            }
+            lens[k] = 2 * SHA256_DIGEST_SIZE;
+        }
+
+        sha256_multi(msgs, lens, n, out);
+        memcpy(&parents[i * SHA256_DIGEST_SIZE], out, n * SHA256_DIGEST_SIZE);
+    }
+}
+
 int sha256_merkle_root(
     const uint8_t* leaves,
     size_t leaf_count,
@@ -378,23 +808,8 @@ int sha256_merkle_root(
     uint8_t* level_data = work_buffer;
 
     while (level_size > 1) {
-        size_t next_size = (level_size + 1) / 2;
-
-        for (size_t i = 0; i < next_size; i++) {
-            const uint8_t* left = &level_data[i * 2 * SHA256_DIGEST_SIZE];
-            const uint8_t* right;
-
-            if (i * 2 + 1 < level_size) {
-                right = &level_data[(i * 2 + 1) * SHA256_DIGEST_SIZE];
-            } else {
-                /* Odd number of nodes: duplicate last one */
-                right = left;
-            }
-
-            sha256_hash_pair(left, right, &level_data[i * SHA256_DIGEST_SIZE]);
-        }
-
-        level_size = next_size;
+        merkle_hash_level(level_data, level_size, level_data);
+        level_size = (level_size + 1) / 2;
     }
 
     /* Root is at the beginning of work buffer */
@@ -441,6 +856,78 @@ int sha256_merkle_root_alloc(
     return result;
 }
 
+size_t sha256_merkle_tree_nodes(size_t leaf_count) {
+    size_t nodes = 0;
+    size_t level_size = leaf_count;
+
+    while (level_size > 1) {
+        nodes += level_size;
+        level_size = (level_size + 1) / 2;
+    }
+    return nodes + level_size;
+}
+
+int sha256_merkle_tree(const uint8_t* leaves, size_t leaf_count, uint8_t* tree) {
+    if (leaves == NULL || tree == NULL || leaf_count == 0) {
+        return 0;
+    }
+
+    memcpy(tree, leaves, leaf_count * SHA256_DIGEST_SIZE);
+
+    uint8_t* level_data = tree;
+    size_t level_size = leaf_count;
+
+    while (level_size > 1) {
+        uint8_t* next_data = level_data + level_size * SHA256_DIGEST_SIZE;
+        merkle_hash_level(level_data, level_size, next_data);
+        level_data = next_data;
+        level_size = (level_size + 1) / 2;
+    }
+    return 1;
+}
+
+int sha256_merkle_verify_path(
+    const uint8_t* leaf,
+    size_t index,
+    size_t leaf_count,
+    const uint8_t* tree,
+    const uint8_t* root
+) {
+    if (leaf == NULL || tree == NULL || root == NULL || index >= leaf_count) {
+        return 0;
+    }
+
+    uint8_t node[SHA256_DIGEST_SIZE];
+    sha256_copy(node, leaf);
+
+    const uint8_t* level_data = tree;
+    size_t level_size = leaf_count;
+
+    while (level_size > 1) {
+        size_t sibling_index = index ^ 1;
+        uint8_t sibling[SHA256_DIGEST_SIZE];
+
+        if (sibling_index < level_size) {
+            sha256_copy(sibling, &level_data[sibling_index * SHA256_DIGEST_SIZE]);
+        } else {
+            /* Odd tail pairs with itself, as in sha256_merkle_root() */
+            sha256_copy(sibling, node);
+        }
+
+        if (index & 1) {
+            sha256_hash_pair(sibling, node, node);
+        } else {
+            sha256_hash_pair(node, sibling, node);
+        }
+
+        level_data += level_size * SHA256_DIGEST_SIZE;
+        level_size = (level_size + 1) / 2;
+        index >>= 1;
+    }
+
+    return sha256_equal(node, root);
+}
+
 /*============================================================================
  * HMAC-SHA256 Implementation
  *============================================================================*/
@@ -4,6 +4,7 @@
  */
 
 #include "seraph/galactic.h"
+#include <string.h>
 
 /*============================================================================
  * Transcendental Functions
@@ -295,3 +296,208 @@ Seraph_Galactic seraph_galactic_length3(Seraph_Galactic x, Seraph_Galactic y,
     Seraph_Galactic sum = seraph_galactic_add(seraph_galactic_add(x2, y2), z2);
     return seraph_galactic_sqrt(sum);
 }
+
+/*============================================================================
+ * Batch Operations
+ *============================================================================*/
+
+/* Elements per chunk; the temporaries below live on the stack */
+#define GALACTIC_BATCH_CHUNK 64
+
+typedef struct {
+    int64_t  hi[GALACTIC_BATCH_CHUNK];
+    uint64_t lo[GALACTIC_BATCH_CHUNK];
+} Galactic_Chunk;
+
+static inline Seraph_Q128_Lanes galactic_chunk_lanes(Galactic_Chunk* c) {
+    return (Seraph_Q128_Lanes){ c->hi, c->lo };
+}
+
+static inline Seraph_Galactic_Lanes galactic_lanes_at(Seraph_Galactic_Lanes x, size_t index) {
+    return (Seraph_Galactic_Lanes){
+        seraph_q128_lanes_at(x.primal, index),
+        seraph_q128_lanes_at(x.tangent, index)
+    };
+}
+
+/* mask[k] |= all-ones where either component of x[k] is VOID */
+static void galactic_void_mask_chunk(Seraph_Galactic_Lanes x, uint64_t* mask, size_t n) {
+    for (size_t k = 0; k < n; k++) {
+        uint64_t p = (uint64_t)x.primal.hi[k] & x.primal.lo[k];
+        uint64_t t = (uint64_t)x.tangent.hi[k] & x.tangent.lo[k];
+        mask[k] |= (uint64_t)0 - ((p == UINT64_MAX) | (t == UINT64_MAX));
+    }
+}
+
+/* dst[k] = { primal[k], tangent[k] }, or VOID where mask[k] is set */
+static void galactic_store_chunk(Seraph_Galactic_Lanes dst, Galactic_Chunk* primal,
+                                 Galactic_Chunk* tangent, const uint64_t* mask, size_t n) {
+    for (size_t k = 0; k < n; k++) {
+        dst.primal.hi[k] = primal->hi[k] | (int64_t)mask[k];
+        dst.primal.lo[k] = primal->lo[k] | mask[k];
+        dst.tangent.hi[k] = tangent->hi[k] | (int64_t)mask[k];
+        dst.tangent.lo[k] = tangent->lo[k] | mask[k];
+    }
+}
+
+Seraph_Vbit seraph_galactic_lanes_from_soa(const Seraph_SoA_Array* array,
+                                           uint32_t first_field,
+                                           Seraph_Galactic_Lanes* out) {
+    if (out == NULL) return SERAPH_VBIT_VOID;
+    Seraph_Galactic_Lanes lanes;
+    if (seraph_q128_lanes_from_soa(array, first_field, &lanes.primal) != SERAPH_VBIT_TRUE ||
+        seraph_q128_lanes_from_soa(array, first_field + 2, &lanes.tangent) != SERAPH_VBIT_TRUE) {
+        return SERAPH_VBIT_VOID;
+    }
+    *out = lanes;
+    return SERAPH_VBIT_TRUE;
+}
+
+void seraph_galactic_lanes_scatter(Seraph_Galactic_Lanes dst, const Seraph_Galactic* src,
+                                   size_t count) {
+    if (src == NULL) return;
+    for (size_t i = 0; i < count; i++) {
+        dst.primal.hi[i] = src[i].primal.hi;
+        dst.primal.lo[i] = src[i].primal.lo;
+        dst.tangent.hi[i] = src[i].tangent.hi;
+        dst.tangent.lo[i] = src[i].tangent.lo;
+    }
+}
+
+void seraph_galactic_lanes_gather(Seraph_Galactic* dst, Seraph_Galactic_Lanes src,
+                                  size_t count) {
+    if (dst == NULL) return;
+    for (size_t i = 0; i < count; i++) {
+        dst[i].primal = (Seraph_Q128){ src.primal.hi[i], src.primal.lo[i] };
+        dst[i].tangent = (Seraph_Q128){ src.tangent.hi[i], src.tangent.lo[i] };
+    }
+}
+
+/*
+ * Componentwise add or sub, shared by add_n and sub_n. Each component
+ * only reads its own inputs, so the results go straight to dst and the
+ * VOID mask (taken before anything is written) is applied afterwards.
+ */
+static void galactic_addsub_n(Seraph_Galactic_Lanes dst, Seraph_Galactic_Lanes a,
+                              Seraph_Galactic_Lanes b, size_t count,
+                              void (*op)(Seraph_Q128_Lanes, Seraph_Q128_Lanes,
+                                         Seraph_Q128_Lanes, size_t)) {
+    uint64_t mask[GALACTIC_BATCH_CHUNK];
+
+    for (size_t i = 0; i < count; i += GALACTIC_BATCH_CHUNK) {
+        size_t n = count - i < GALACTIC_BATCH_CHUNK ? count - i : GALACTIC_BATCH_CHUNK;
+        Seraph_Galactic_Lanes ca = galactic_lanes_at(a, i);
+        Seraph_Galactic_Lanes cb = galactic_lanes_at(b, i);
+        Seraph_Galactic_Lanes cd = galactic_lanes_at(dst, i);
+
+        memset(mask, 0, n * sizeof(uint64_t));
+        galactic_void_mask_chunk(ca, mask, n);
+        galactic_void_mask_chunk(cb, mask, n);
+
+        op(cd.primal, ca.primal, cb.primal, n);
+        op(cd.tangent, ca.tangent, cb.tangent, n);
+        for (size_t k = 0; k < n; k++) {
+            cd.primal.hi[k] |= (int64_t)mask[k];
+            cd.primal.lo[k] |= mask[k];
+            cd.tangent.hi[k] |= (int64_t)mask[k];
+            cd.tangent.lo[k] |= mask[k];
+        }
+    }
+}
+
+void seraph_galactic_add_n(Seraph_Galactic_Lanes dst, Seraph_Galactic_Lanes a,
+                           Seraph_Galactic_Lanes b, size_t count) {
+    galactic_addsub_n(dst, a, b, count, seraph_q128_add_n);
+}
+
+void seraph_galactic_sub_n(Seraph_Galactic_Lanes dst, Seraph_Galactic_Lanes a,
+                           Seraph_Galactic_Lanes b, size_t count) {
+    galactic_addsub_n(dst, a, b, count, seraph_q128_sub_n);
+}
+
+void seraph_galactic_mul_n(Seraph_Galactic_Lanes dst, Seraph_Galactic_Lanes a,
+                           Seraph_Galactic_Lanes b, size_t count) {
+    Galactic_Chunk primal, tangent, cross;
+    uint64_t mask[GALACTIC_BATCH_CHUNK];
+
+    for (size_t i = 0; i < count; i += GALACTIC_BATCH_CHUNK) {
+        size_t n = count - i < GALACTIC_BATCH_CHUNK ? count - i : GALACTIC_BATCH_CHUNK;
+        Seraph_Galactic_Lanes ca = galactic_lanes_at(a, i);
+        Seraph_Galactic_Lanes cb = galactic_lanes_at(b, i);
+
+        memset(mask, 0, n * sizeof(uint64_t));
+        galactic_void_mask_chunk(ca, mask, n);
+        galactic_void_mask_chunk(cb, mask, n);
+
+        /* ab + (a'b + ab')ε */
+        seraph_q128_mul_n(galactic_chunk_lanes(&primal), ca.primal, cb.primal, n);
+        seraph_q128_mul_n(galactic_chunk_lanes(&tangent), ca.tangent, cb.primal, n);
+        seraph_q128_mul_n(galactic_chunk_lanes(&cross), ca.primal, cb.tangent, n);
+        seraph_q128_add_n(galactic_chunk_lanes(&tangent), galactic_chunk_lanes(&tangent),
+                          galactic_chunk_lanes(&cross), n);
+        galactic_store_chunk(galactic_lanes_at(dst, i), &primal, &tangent, mask, n);
+    }
+}
+
+void seraph_galactic_scale_n(Seraph_Galactic_Lanes dst, Seraph_Galactic_Lanes x,
+                             Seraph_Q128 c, size_t count) {
+    Galactic_Chunk primal, tangent, scale;
+    uint64_t mask[GALACTIC_BATCH_CHUNK];
+    uint64_t c_void = seraph_q128_is_void(c) ? UINT64_MAX : 0;
+
+    for (size_t k = 0; k < GALACTIC_BATCH_CHUNK; k++) {
+        scale.hi[k] = c.hi;
+        scale.lo[k] = c.lo;
+    }
+
+    for (size_t i = 0; i < count; i += GALACTIC_BATCH_CHUNK) {
+        size_t n = count - i < GALACTIC_BATCH_CHUNK ? count - i : GALACTIC_BATCH_CHUNK;
+        Seraph_Galactic_Lanes cx = galactic_lanes_at(x, i);
+
+        for (size_t k = 0; k < n; k++) mask[k] = c_void;
+        galactic_void_mask_chunk(cx, mask, n);
+
+        seraph_q128_mul_n(galactic_chunk_lanes(&primal), cx.primal,
+                          galactic_chunk_lanes(&scale), n);
+        seraph_q128_mul_n(galactic_chunk_lanes(&tangent), cx.tangent,
+                          galactic_chunk_lanes(&scale), n);
+        galactic_store_chunk(galactic_lanes_at(dst, i), &primal, &tangent, mask, n);
+    }
+}
+
+void seraph_galactic_sqrt_n(Seraph_Galactic_Lanes dst, Seraph_Galactic_Lanes x,
+                            size_t count) {
+    Galactic_Chunk primal, tangent, two;
+    uint64_t mask[GALACTIC_BATCH_CHUNK];
+    Seraph_Q128 two_q = seraph_q128_from_i64(2);
+
+    for (size_t k = 0; k < GALACTIC_BATCH_CHUNK; k++) {
+        two.hi[k] = two_q.hi;
+        two.lo[k] = two_q.lo;
+    }
+
+    for (size_t i = 0; i < count; i += GALACTIC_BATCH_CHUNK) {
+        size_t n = count - i < GALACTIC_BATCH_CHUNK ? count - i : GALACTIC_BATCH_CHUNK;
+        Seraph_Galactic_Lanes cx = galactic_lanes_at(x, i);
+
+        /* VOID for VOID inputs and negative primals */
+        for (size_t k = 0; k < n; k++) mask[k] = (uint64_t)0 - (cx.primal.hi[k] < 0);
+        galactic_void_mask_chunk(cx, mask, n);
+
+        /* sqrt(a) + (a' / (2×sqrt(a)))ε */
+        for (size_t k = 0; k < n; k++) {
+            Seraph_Q128 s = seraph_q128_sqrt((Seraph_Q128){ cx.primal.hi[k], cx.primal.lo[k] });
+            primal.hi[k] = s.hi;
+            primal.lo[k] = s.lo;
+        }
+        seraph_q128_mul_n(galactic_chunk_lanes(&tangent), galactic_chunk_lanes(&two),
+                          galactic_chunk_lanes(&primal), n);
+        for (size_t k = 0; k < n; k++) {
+            Seraph_Q128 q = seraph_q128_div((Seraph_Q128){ cx.tangent.hi[k], cx.tangent.lo[k] },
+                                            (Seraph_Q128){ tangent.hi[k], tangent.lo[k] });
+            tangent.hi[k] = q.hi;
+            tangent.lo[k] = q.lo;
+        }
+        galactic_store_chunk(galactic_lanes_at(dst, i), &primal, &tangent, mask, n);
+    }
+}
@@ -13,7 +13,9 @@
  */
 
 #include "seraph/glyph.h"
+#include "seraph/math_cache.h"
 #include <math.h>
+#include <string.h>
 
 /*============================================================================
  * Helper Constants
@@ -733,3 +735,301 @@ void seraph_glyph_normal(
     *out_nx = seraph_q128_to_double(seraph_q128_div(result.gradient_x, mag));
     *out_ny = seraph_q128_to_double(seraph_q128_div(result.gradient_y, mag));
 }
+
+/*============================================================================
+ * Shape Programs
+ *============================================================================*/
+
+/**
+ * @brief Stack depth check without evaluating anything
+ */
+static bool glyph_shape_well_formed(const Seraph_SDF_Node* nodes, uint32_t count) {
+    if (nodes == NULL || count == 0) return false;
+    uint32_t depth = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        Seraph_SDF_Op op = nodes[i].op;
+        if (op <= SERAPH_SDF_OP_TRIANGLE) {
+            if (depth == SERAPH_SDF_SHAPE_STACK) return false;
+            depth++;
+        } else if (op <= SERAPH_SDF_OP_SMOOTH_INTERSECT) {
+            if (depth < 2) return false;
+            depth--;
+        } else if (op <= SERAPH_SDF_OP_OFFSET) {
+            if (depth < 1) return false;
+        } else {
+            return false;
+        }
+    }
+    return depth == 1;
+}
+
+/**
+ * @brief Evaluate a shape program at a point
+ */
+Seraph_SDF_Result seraph_sdf_shape_eval(
+    const Seraph_SDF_Node* nodes,
+    uint32_t count,
+    Seraph_Glyph_Point p
+) {
+    if (!glyph_shape_well_formed(nodes, count)) {
+        return SERAPH_SDF_VOID;
+    }
+
+    Seraph_SDF_Result stack[SERAPH_SDF_SHAPE_STACK];
+    uint32_t top = 0;
+
+    for (uint32_t i = 0; i < count; i++) {
+        const Seraph_Q128* a = nodes[i].p;
+        Seraph_SDF_Result* r = &stack[top > 0 ? top - 1 : 0];  /* Top, for unary operations */
+        Seraph_SDF_Result* l = &stack[top > 1 ? top - 2 : 0];  /* Below it, for binary ones */
+
+        switch (nodes[i].op) {
+            case SERAPH_SDF_OP_CIRCLE:
+                stack[top++] = seraph_sdf_circle(p, a[0], a[1], a[2]);
+                break;
+            case SERAPH_SDF_OP_BOX:
+                stack[top++] = seraph_sdf_box(p, a[0], a[1]);
+                break;
+            case SERAPH_SDF_OP_ROUNDED_BOX:
+                stack[top++] = seraph_sdf_rounded_box(p, a[0], a[1], a[2]);
+                break;
+            case SERAPH_SDF_OP_LINE:
+                stack[top++] = seraph_sdf_line(p, a[0], a[1], a[2], a[3], a[4]);
+                break;
+            case SERAPH_SDF_OP_RING:
+                stack[top++] = seraph_sdf_ring(p, a[0], a[1], a[2], a[3]);
+                break;
+            case SERAPH_SDF_OP_TRIANGLE:
+                stack[top++] = seraph_sdf_triangle(p, a[0], a[1], a[2], a[3], a[4], a[5]);
+                break;
+            case SERAPH_SDF_OP_UNION:
+                *l = seraph_sdf_union(*l, *r);
+                top--;
+                break;
+            case SERAPH_SDF_OP_INTERSECT:
+                *l = seraph_sdf_intersect(*l, *r);
+                top--;
+                break;
+            case SERAPH_SDF_OP_SUBTRACT:
+                *l = seraph_sdf_subtract(*l, *r);
+                top--;
+                break;
+            case SERAPH_SDF_OP_XOR:
+                *l = seraph_sdf_xor(*l, *r);
+                top--;
+                break;
+            case SERAPH_SDF_OP_SMOOTH_UNION:
+                *l = seraph_sdf_smooth_union(*l, *r, a[0]);
+                top--;
+                break;
+            case SERAPH_SDF_OP_SMOOTH_SUBTRACT:
+                *l = seraph_sdf_smooth_subtract(*l, *r, a[0]);
+                top--;
+                break;
+            case SERAPH_SDF_OP_SMOOTH_INTERSECT:
+                *l = seraph_sdf_smooth_intersect(*l, *r, a[0]);
+                top--;
+                break;
+            case SERAPH_SDF_OP_NEGATE:
+                *r = seraph_sdf_negate(*r);
+                break;
+            case SERAPH_SDF_OP_OFFSET:
+                *r = seraph_sdf_offset(*r, a[0]);
+                break;
+        }
+    }
+
+    return stack[0];
+}
+
+/**
+ * @brief 64-bit hash of a shape program
+ */
+uint64_t seraph_sdf_shape_hash(const Seraph_SDF_Node* nodes, uint32_t count) {
+    uint64_t h = seraph_cache_hash64(0x9E3779B97F4A7C15ULL ^ count);
+    for (uint32_t i = 0; nodes != NULL && i < count; i++) {
+        h = seraph_cache_hash64(h ^ (uint64_t)nodes[i].op);
+        for (int j = 0; j < 6; j++) {
+            h = seraph_cache_hash64(h ^ (uint64_t)nodes[i].p[j].hi);
+            h = seraph_cache_hash64(h ^ nodes[i].p[j].lo);
+        }
+    }
+    return h;
+}
+
+/*============================================================================
+ * Glyph Distance Cache
+ *============================================================================*/
+
+#define GLYPH_CACHE_TEXELS (SERAPH_GLYPH_CACHE_RES * SERAPH_GLYPH_CACHE_RES)
+
+/**
+ * @brief Q128 to Q16, saturating; VOID is as far outside as Q16 goes
+ */
+static int32_t glyph_q16_from_q128(Seraph_Q128 v) {
+    if (seraph_q128_is_void(v) || v.hi >= 32768) return INT32_MAX;
+    if (v.hi < -32768) return -INT32_MAX;
+    return (int32_t)(v.hi * 65536 + (int64_t)(v.lo >> 48));
+}
+
+static bool glyph_q128_eq(Seraph_Q128 a, Seraph_Q128 b) {
+    return a.hi == b.hi && a.lo == b.lo;
+}
+
+/**
+ * @brief Sample the analytic SDF at every texel center
+ */
+static void glyph_cache_bake(
+    Seraph_Glyph_Cache_Entry* entry,
+    const Seraph_SDF_Node* nodes,
+    uint32_t count
+) {
+    Seraph_Q128 res = seraph_q128_from_i64(SERAPH_GLYPH_CACHE_RES);
+    Seraph_Q128 texel = seraph_q128_div(entry->size, res);
+    Seraph_Q128 per_texel = seraph_q128_div(res, entry->size);
+    Seraph_Q128 half = seraph_q128_mul(texel, Q128_HALF);
+
+    Seraph_Q128 y = seraph_q128_add(entry->min_y, half);
+    for (uint32_t j = 0; j < SERAPH_GLYPH_CACHE_RES; j++) {
+        Seraph_Q128 x = seraph_q128_add(entry->min_x, half);
+        int32_t* row = &entry->dist[j * SERAPH_GLYPH_CACHE_RES];
+        for (uint32_t i = 0; i < SERAPH_GLYPH_CACHE_RES; i++) {
+            Seraph_SDF_Result r = seraph_sdf_shape_eval(nodes, count,
+                                                        seraph_glyph_point_create(x, y));
+            row[i] = seraph_sdf_is_void(r)
+                         ? INT32_MAX
+                         : glyph_q16_from_q128(seraph_q128_mul(r.distance, per_texel));
+            x = seraph_q128_add(x, texel);
+        }
+        y = seraph_q128_add(y, texel);
+    }
+}
+
+void seraph_glyph_cache_init(Seraph_Glyph_Cache* cache) {
+    if (cache == NULL) return;
+    memset(cache, 0, sizeof(*cache));
+}
+
+const Seraph_Glyph_Cache_Entry* seraph_glyph_cache_lookup(
+    Seraph_Glyph_Cache* cache,
+    const Seraph_SDF_Node* nodes,
+    uint32_t count,
+    Seraph_Q128 min_x,
+    Seraph_Q128 min_y,
+    Seraph_Q128 size
+) {
+    if (cache == NULL || !glyph_shape_well_formed(nodes, count) ||
+        seraph_q128_is_void(min_x) || seraph_q128_is_void(min_y) ||
+        seraph_q128_is_void(size) || size.hi < 0 || seraph_q128_is_zero(size)) {
+        return NULL;
+    }
+
+    uint64_t key = seraph_sdf_shape_hash(nodes, count);
+    key = seraph_cache_hash64(key ^ (uint64_t)min_x.hi ^ (min_x.lo >> 1));
+    key = seraph_cache_hash64(key ^ (uint64_t)min_y.hi ^ (min_y.lo >> 1));
+    key = seraph_cache_hash64(key ^ (uint64_t)size.hi ^ (size.lo >> 1));
+    if (key == 0) key = 1;
+
+    cache->tick++;
+
+    /* Hit, or else the least recently used slot (empty slots have never been used) */
+    Seraph_Glyph_Cache_Entry* victim = &cache->entries[0];
+    for (uint32_t i = 0; i < SERAPH_GLYPH_CACHE_SLOTS; i++) {
+        Seraph_Glyph_Cache_Entry* e = &cache->entries[i];
+        if (e->key == key && glyph_q128_eq(e->min_x, min_x) &&
+            glyph_q128_eq(e->min_y, min_y) && glyph_q128_eq(e->size, size)) {
+            e->last_used = cache->tick;
+            cache->hits++;
+            return e;
+        }
+        if (e->last_used < victim->last_used) {
+            victim = e;
+        }
+    }
+
+    cache->misses++;
+    if (victim->key != 0) {
+        cache->evictions++;
+    }
+    victim->key = key;
+    victim->last_used = cache->tick;
+    victim->min_x = min_x;
+    victim->min_y = min_y;
+    victim->size = size;
+    glyph_cache_bake(victim, nodes, count);
+    return victim;
+}
+
+/**
+ * @brief Bilinear sample; see seraph_glyph_cache_sample
+ */
+static inline int32_t glyph_cache_sample_at(const int32_t* dist, int32_t u, int32_t v) {
+    const int32_t last = (SERAPH_GLYPH_CACHE_RES - 1) << 16;
+    int64_t du = u < 0 ? -(int64_t)u : (u > last ? (int64_t)u - last : 0);
+    int64_t dv = v < 0 ? -(int64_t)v : (v > last ? (int64_t)v - last : 0);
+    if (u < 0) u = 0;
+    if (u > last) u = last;
+    if (v < 0) v = 0;
+    if (v > last) v = last;
+
+    /* The last texel interpolates from its left/top neighbor with weight 1 */
+    int32_t i = u >> 16, j = v >> 16;
+    if (i == SERAPH_GLYPH_CACHE_RES - 1) i--;
+    if (j == SERAPH_GLYPH_CACHE_RES - 1) j--;
+    int64_t fx = u - (i << 16), fy = v - (j << 16);
+
+    const int32_t* t = dist + j * SERAPH_GLYPH_CACHE_RES + i;
+    int64_t top = t[0] + ((((int64_t)t[1] - t[0]) * fx) >> 16);
+    int64_t bot = t[SERAPH_GLYPH_CACHE_RES] +
+                  ((((int64_t)t[SERAPH_GLYPH_CACHE_RES + 1] - t[SERAPH_GLYPH_CACHE_RES]) * fx) >> 16);
+    int64_t d = top + (((bot - top) * fy) >> 16) + (du > dv ? du : dv);
+
+    if (d > INT32_MAX) return INT32_MAX;
+    if (d < -INT32_MAX) return -INT32_MAX;
+    return (int32_t)d;
+}
+
+int32_t seraph_glyph_cache_sample(
+    const Seraph_Glyph_Cache_Entry* entry,
+    int32_t u,
+    int32_t v
+) {
+    if (entry == NULL) return INT32_MAX;
+    return glyph_cache_sample_at(entry->dist, u, v);
+}
+
+void seraph_glyph_cache_rasterize(
+    const Seraph_Glyph_Cache_Entry* entry,
+    uint8_t* coverage,
+    uint32_t size,
+    uint32_t stride
+) {
+    if (entry == NULL || coverage == NULL || size == 0 || size > (1u << 15)) {
+        return;
+    }
+
+    /* Pixel centers in Q16 texels: (x + 0.5) * RES / size - 0.5 */
+    int64_t step = ((int64_t)SERAPH_GLYPH_CACHE_RES << 16) / size;
+    int64_t start = step / 2 - 32768;
+
+    for (uint32_t y = 0; y < size; y++) {
+        int32_t v = (int32_t)(start + (int64_t)y * step);
+        int64_t u = start;
+        uint8_t* out = coverage + (size_t)y * stride;
+
+        for (uint32_t x = 0; x < size; x++, u += step) {
+            /* Texels to pixels, then coverage = smoothstep over [-0.5, 0.5] px */
+            int64_t d = (int64_t)glyph_cache_sample_at(entry->dist, (int32_t)u, v) * size /
+                        SERAPH_GLYPH_CACHE_RES;
+            int64_t t = 32768 - d;
+            if (t <= 0) {
+                out[x] = 0;
+            } else if (t >= 65536) {
+                out[x] = 255;
+            } else {
+                int64_t s = (((t * t) >> 16) * (196608 - 2 * t)) >> 16;
+                out[x] = (uint8_t)((s * 255 + 32768) >> 16);
+            }
+        }
+    }
+}
@@ -154,34 +154,551 @@ Q16 seraph_harmonic16_triangle(Q16 theta, int num_harmonics) {
  * FFT Twiddle Factors
  *============================================================================*/
 
+#define HARMONIC_Q32_ONE  0x100000000LL
+#define HARMONIC_2PI_Q61  0xC90FDAA22168C234ULL   /* 2π in Q3.61 */
+
+/**
+ * @brief sin/cos of x in [0, π/4], both Q32.32
+ *
+ * Nested Taylor series through x^13; the first omitted term is below
+ * 1e-13 on this range, so the result is good to a few Q32 LSBs.
+ */
+static void harmonic32_sincos_octant(int64_t x, int64_t* sin_out, int64_t* cos_out) {
+    int64_t x2 = seraph_q32_mul(x, x);
+    int64_t ps = HARMONIC_Q32_ONE;
+    int64_t pc = HARMONIC_Q32_ONE;
+
+    /* sin x = x(1 - x²/2·3 (1 - x²/4·5 (...)))
+     * cos x =   1 - x²/1·2 (1 - x²/3·4 (...)) */
+    for (int k = 12; k >= 2; k -= 2) {
+        ps = HARMONIC_Q32_ONE - seraph_q32_mul(x2, ps) / (k * (k + 1));
+        pc = HARMONIC_Q32_ONE - seraph_q32_mul(x2, pc) / ((k - 1) * k);
+    }
+
+    *sin_out = seraph_q32_mul(x, ps);
+    *cos_out = pc;
+}
+
+/**
+ * @brief W_N^k for k < N/2 as (cos, -sin) in Q32.32
+ *
+ * k/N is formed as an exact 0.64 fraction of a turn and folded onto the
+ * first octant, so symmetric factors come out exactly symmetric.
+ */
+static void harmonic32_twiddle(int k, int N, int64_t* cos_out, int64_t* sin_out) {
+    uint64_t num = (uint64_t)k << 32;
+    uint64_t frac = (num / (uint64_t)N) << 32;
+    frac |= ((num % (uint64_t)N) << 32) / (uint64_t)N;
+
+    bool negate_cos = false;
+    bool swap = false;
+    if (frac > (1ULL << 62)) {          /* θ > π/2: use π - θ */
+        frac = (1ULL << 63) - frac;
+        negate_cos = true;
+    }
+    if (frac > (1ULL << 61)) {          /* θ > π/4: use π/2 - θ */
+        frac = (1ULL << 62) - frac;
+        swap = true;
+    }
+
+    uint64_t angle_q61;
+    seraph_mulx_u64(frac, HARMONIC_2PI_Q61, &angle_q61);
+    int64_t angle = (int64_t)((angle_q61 + (1ULL << 28)) >> 29);
+
+    int64_t s, c;
+    harmonic32_sincos_octant(angle, &s, &c);
+    if (swap) {
+        int64_t t = s;
+        s = c;
+        c = t;
+    }
+
+    *cos_out = negate_cos ? -c : c;
+    *sin_out = -s;  /* Negative for DFT convention */
+}
+
 void seraph_harmonic16_fft_twiddles(int N, Q16* cos_out, Q16* sin_out) {
     if (N <= 0 || cos_out == NULL || sin_out == NULL) return;
 
-    /* W_N^k = exp(-2πik/N) = cos(2πk/N) - i·sin(2πk/N)
-     *
-     * Generate using harmonic recurrence with θ = 2π/N
-     */
-    Q16 theta = q16_div(Q16_2PI, Q16_FROM_INT(N));
+    for (int k = 0; k < N / 2; k++) {
+        int64_t c, s;
+        harmonic32_twiddle(k, N, &c, &s);
+        cos_out[k] = (Q16)((c + 0x8000) >> 16);
+        sin_out[k] = (Q16)((s + 0x8000) >> 16);
+    }
+}
 
-    Seraph_Harmonic16 harm;
-    seraph_harmonic16_init(&harm, theta);
+void seraph_harmonic32_fft_twiddles(int N, int64_t* cos_out, int64_t* sin_out) {
+    if (N <= 0 || cos_out == NULL || sin_out == NULL) return;
+
+    for (int k = 0; k < N / 2; k++) {
+        harmonic32_twiddle(k, N, &cos_out[k], &sin_out[k]);
+    }
+}
+
+/*============================================================================
+ * Fixed-Point FFT
+ *
+ * Data enters in natural order and is permuted to bit-reversed order by
+ * the normalizing pass. In bit-reversed order a block of 4L holds the
+ * L-point spectra of the residues 0, 2, 1, 3 (mod 4) of its samples, so
+ * each radix-4 butterfly reads F0, F2, F1, F3 from its four quarters and
+ * writes X[j], X[j+L], X[j+2L], X[j+3L] back in their place.
+ *
+ * Every pass returns the OR of its output magnitudes; the next pass
+ * derives its pre-shift from that without a separate scan.
+ *============================================================================*/
+
+/* Largest |component| a pass may start from. Radix-4 outputs grow by at
+ * most 4·√2 < 2^3, radix-2 outputs and the real split by 1 + √2 < 2^2. */
+#define FFT16_RADIX4_BITS  28
+#define FFT16_RADIX2_BITS  29
+#define FFT32_RADIX4_BITS  60
+#define FFT32_RADIX2_BITS  61
+
+/* Right shift that brings every value with magnitude bits in mag below 2^bits */
+static int fft_shift_for(uint64_t mag, int bits) {
+    int s = 0;
+    while ((mag >> s) >> bits) s++;
+    return s;
+}
+
+/* Left (positive) or rounding right (negative) shift, overflow-free */
+static int64_t fft_scale(int64_t v, int shift) {
+    if (shift >= 0) return (int64_t)((uint64_t)v << shift);
+    return (v >> -shift) + ((v >> (-shift - 1)) & 1);
+}
+
+static uint64_t fft_abs(int64_t v) {
+    return v < 0 ? 0 - (uint64_t)v : (uint64_t)v;
+}
 
-    int half_N = N / 2;
+/* Advance j to the next index in bit-reversed counting order over n */
+static inline int fft_bitrev_next(int j, int n) {
+    int bit = n >> 1;
+    while (j & bit) {
+        j ^= bit;
+        bit >>= 1;
+    }
+    return j | bit;
+}
+
+static bool fft16_plan_valid(const Seraph_FFT16* fft) {
+    return fft != NULL && fft->cos_tw != NULL && fft->sin_tw != NULL &&
+           fft->log2n >= 1 && fft->log2n <= SERAPH_FFT_MAX_LOG2 &&
+           fft->n == (1 << fft->log2n);
+}
+
+static bool fft32_plan_valid(const Seraph_FFT32* fft) {
+    return fft != NULL && fft->cos_tw != NULL && fft->sin_tw != NULL &&
+           fft->log2n >= 1 && fft->log2n <= SERAPH_FFT_MAX_LOG2 &&
+           fft->n == (1 << fft->log2n);
+}
+
+static int fft_log2(int n) {
+    if (n < 2 || (n & (n - 1)) != 0) return -1;
+    int log2n = 0;
+    while ((1 << log2n) < n) log2n++;
+    return log2n <= SERAPH_FFT_MAX_LOG2 ? log2n : -1;
+}
 
-    for (int k = 0; k < half_N; k++) {
-        /* For k=0, we have cos(0)=1, sin(0)=0 */
-        if (k == 0) {
-            cos_out[0] = Q16_ONE;
-            sin_out[0] = 0;
+/*----------------------------------------------------------------------------
+ * Q16 passes
+ *----------------------------------------------------------------------------*/
+
+/* Bit-reverse n points in place, scaling by 2^shift */
+static uint32_t fft16_bitrev(Q16* re, Q16* im, int n, int shift) {
+    uint32_t mag = 0;
+    for (int i = 0, j = 0; i < n; i++, j = fft_bitrev_next(j, n)) {
+        if (j < i) continue;
+        Q16 ar = (Q16)fft_scale(re[i], shift), ai = (Q16)fft_scale(im[i], shift);
+        Q16 br = (Q16)fft_scale(re[j], shift), bi = (Q16)fft_scale(im[j], shift);
+        re[i] = br; im[i] = bi;
+        re[j] = ar; im[j] = ai;
+        mag |= (uint32_t)(fft_abs(ar) | fft_abs(ai) | fft_abs(br) | fft_abs(bi));
+    }
+    return mag;
+}
+
+/* Two-point butterflies on adjacent pairs (the L = 1 pass) */
+static uint32_t fft16_radix2_pass(Q16* re, Q16* im, int n, int shift) {
+    int32_t rnd = (1 << shift) >> 1;
+    uint32_t mag = 0;
+    for (int b = 0; b < n; b += 2) {
+        int32_t ar = (re[b] + rnd) >> shift, ai = (im[b] + rnd) >> shift;
+        int32_t br = (re[b + 1] + rnd) >> shift, bi = (im[b + 1] + rnd) >> shift;
+        re[b] = ar + br; im[b] = ai + bi;
+        re[b + 1] = ar - br; im[b + 1] = ai - bi;
+        mag |= (uint32_t)(fft_abs(ar + br) | fft_abs(ai + bi) |
+                          fft_abs(ar - br) | fft_abs(ai - bi));
+    }
+    return mag;
+}
+
+/* Combine 4 L-point spectra into 4L-point spectra. W_4L^j is entry
+ * j·step of the plan's table; indices past n/2 wrap with a sign flip. */
+static uint32_t fft16_radix4_pass(Q16* re, Q16* im, int n, int span, int shift,
+                                  const Seraph_FFT16* fft) {
+    int32_t rnd = (1 << shift) >> 1;
+    int step = fft->n / (4 * span);
+    int half = fft->n / 2;
+    uint32_t mag = 0;
+
+    for (int j = 0; j < span; j++) {
+        int k1 = j * step, k2 = 2 * k1, k3 = 3 * k1;
+        int64_t c1 = fft->cos_tw[k1], s1 = fft->sin_tw[k1];
+        int64_t c2 = fft->cos_tw[k2], s2 = fft->sin_tw[k2];
+        int64_t c3, s3;
+        if (k3 < half) {
+            c3 = fft->cos_tw[k3];
+            s3 = fft->sin_tw[k3];
         } else {
-            /* Advance to harmonic k */
-            while (harm.harmonic < k) {
-                seraph_harmonic16_next(&harm);
-            }
-            cos_out[k] = harm.cos_curr;
-            sin_out[k] = -harm.sin_curr;  /* Negative for DFT convention */
+            c3 = -fft->cos_tw[k3 - half];
+            s3 = -fft->sin_tw[k3 - half];
+        }
+
+        for (int b = j; b < n; b += 4 * span) {
+            Q16* r = re + b;
+            Q16* m = im + b;
+            int64_t f0r = (r[0] + rnd) >> shift,        f0i = (m[0] + rnd) >> shift;
+            int64_t f2r = (r[span] + rnd) >> shift,     f2i = (m[span] + rnd) >> shift;
+            int64_t f1r = (r[2 * span] + rnd) >> shift, f1i = (m[2 * span] + rnd) >> shift;
+            int64_t f3r = (r[3 * span] + rnd) >> shift, f3i = (m[3 * span] + rnd) >> shift;
+
+            int32_t t1r = (int32_t)((f1r * c1 - f1i * s1 + 0x8000) >> 16);
+            int32_t t1i = (int32_t)((f1r * s1 + f1i * c1 + 0x8000) >> 16);
+            int32_t t2r = (int32_t)((f2r * c2 - f2i * s2 + 0x8000) >> 16);
+            int32_t t2i = (int32_t)((f2r * s2 + f2i * c2 + 0x8000) >> 16);
+            int32_t t3r = (int32_t)((f3r * c3 - f3i * s3 + 0x8000) >> 16);
+            int32_t t3i = (int32_t)((f3r * s3 + f3i * c3 + 0x8000) >> 16);
+
+            int32_t ar = (int32_t)f0r + t2r, ai = (int32_t)f0i + t2i;
+            int32_t br = (int32_t)f0r - t2r, bi = (int32_t)f0i - t2i;
+            int32_t cr = t1r + t3r, ci = t1i + t3i;
+            int32_t dr = t1r - t3r, di = t1i - t3i;
+
+            r[0] = ar + cr;            m[0] = ai + ci;
+            r[2 * span] = ar - cr;     m[2 * span] = ai - ci;
+            r[span] = br + di;         m[span] = bi - dr;      /* B - iD */
+            r[3 * span] = br - di;     m[3 * span] = bi + dr;  /* B + iD */
+
+            mag |= (uint32_t)(fft_abs(r[0]) | fft_abs(m[0]) |
+                              fft_abs(r[span]) | fft_abs(m[span]) |
+                              fft_abs(r[2 * span]) | fft_abs(m[2 * span]) |
+                              fft_abs(r[3 * span]) | fft_abs(m[3 * span]));
         }
     }
+    return mag;
+}
+
+/* All passes over 2^log2n bit-reversed points; returns the exponent */
+static int fft16_passes(const Seraph_FFT16* fft, Q16* re, Q16* im, int log2n,
+                        uint32_t* mag) {
+    int n = 1 << log2n;
+    int exponent = 0;
+    int span = 1;
+
+    if (log2n & 1) {
+        int s = fft_shift_for(*mag, FFT16_RADIX2_BITS);
+        *mag = fft16_radix2_pass(re, im, n, s);
+        exponent += s;
+        span = 2;
+    }
+    for (; span < n; span *= 4) {
+        int s = fft_shift_for(*mag, FFT16_RADIX4_BITS);
+        *mag = fft16_radix4_pass(re, im, n, span, s, fft);
+        exponent += s;
+    }
+    return exponent;
+}
+
+/* Normalizing shift: puts the top magnitude bit just below 2^28 */
+static int fft16_normalize_shift(uint32_t mag) {
+    return FFT16_RADIX4_BITS - (32 - __builtin_clz(mag));
+}
+
+static int fft16_complex(const Seraph_FFT16* fft, Q16* re, Q16* im) {
+    int n = fft->n;
+    uint32_t mag = 0;
+    for (int i = 0; i < n; i++) {
+        mag |= (uint32_t)(fft_abs(re[i]) | fft_abs(im[i]));
+    }
+    if (mag == 0) return 0;
+
+    int shift = fft16_normalize_shift(mag);
+    mag = fft16_bitrev(re, im, n, shift);
+    return fft16_passes(fft, re, im, fft->log2n, &mag) - shift;
+}
+
+/*
+ * Real input: z[j] = x[2j] + i·x[2j+1] is transformed at h = n/2 points,
+ * then X[k] = E - i·W_n^k·O with E = (Z[k] + Z*[h-k])/2 and
+ * O = (Z[k] - Z*[h-k])/2, producing k and h - k together.
+ */
+static int fft16_real_one(const Seraph_FFT16* fft, const Q16* x, Q16* re, Q16* im) {
+    int n = fft->n;
+    int h = n / 2;
+
+    uint32_t mag = 0;
+    for (int i = 0; i < n; i++) {
+        mag |= (uint32_t)fft_abs(x[i]);
+    }
+    if (mag == 0) {
+        for (int k = 0; k <= h; k++) {
+            re[k] = 0;
+            im[k] = 0;
+        }
+        return 0;
+    }
+
+    int shift = fft16_normalize_shift(mag);
+    mag = 0;
+    for (int i = 0, j = 0; i < h; i++, j = fft_bitrev_next(j, h)) {
+        re[j] = (Q16)fft_scale(x[2 * i], shift);
+        im[j] = (Q16)fft_scale(x[2 * i + 1], shift);
+        mag |= (uint32_t)(fft_abs(re[j]) | fft_abs(im[j]));
+    }
+    int exponent = fft16_passes(fft, re, im, fft->log2n - 1, &mag) - shift;
+
+    int s = fft_shift_for(mag, FFT16_RADIX2_BITS);
+    int64_t rnd = (1 << s) >> 1;
+    exponent += s;
+
+    int64_t zr = (re[0] + rnd) >> s, zi = (im[0] + rnd) >> s;
+    re[0] = (Q16)(zr + zi); im[0] = 0;
+    re[h] = (Q16)(zr - zi); im[h] = 0;
+
+    for (int k = 1; k <= h / 2; k++) {
+        int m = h - k;
+        int64_t pr = (re[k] + rnd) >> s, pi = (im[k] + rnd) >> s;
+        int64_t qr = (re[m] + rnd) >> s, qi = (im[m] + rnd) >> s;
+
+        /* Doubled E and O, so the halving rounds once at the end */
+        int64_t er = pr + qr, ei = pi - qi;
+        int64_t or_ = pr - qr, oi = pi + qi;
+
+        int64_t c = fft->cos_tw[k], sn = fft->sin_tw[k];
+        int64_t tr = or_ * c - oi * sn;             /* W^k·O */
+        int64_t ti = or_ * sn + oi * c;
+        re[k] = (Q16)(((er << 16) + ti + 0x10000) >> 17);
+        im[k] = (Q16)(((ei << 16) - tr + 0x10000) >> 17);
+
+        if (m != k) {
+            c = fft->cos_tw[m];
+            sn = fft->sin_tw[m];
+            int64_t ur = or_ * c + oi * sn;         /* W^m·conj(O) */
+            int64_t ui = or_ * sn - oi * c;
+            re[m] = (Q16)(((er << 16) - ui + 0x10000) >> 17);
+            im[m] = (Q16)((-(ei << 16) + ur + 0x10000) >> 17);
+        }
+    }
+    return exponent;
+}
+
+bool seraph_fft16_init(Seraph_FFT16* fft, int n, Q16* cos_tw, Q16* sin_tw) {
+    int log2n = fft_log2(n);
+    if (fft == NULL || cos_tw == NULL || sin_tw == NULL || log2n < 0) return false;
+
+    seraph_harmonic16_fft_twiddles(n, cos_tw, sin_tw);
+    fft->n = n;
+    fft->log2n = log2n;
+    fft->cos_tw = cos_tw;
+    fft->sin_tw = sin_tw;
+    return true;
+}
+
+bool seraph_fft16_forward(const Seraph_FFT16* fft, Q16* re, Q16* im, int* exponent) {
+    if (!fft16_plan_valid(fft) || re == NULL || im == NULL || exponent == NULL) {
+        return false;
+    }
+    *exponent = fft16_complex(fft, re, im);
+    return true;
+}
+
+bool seraph_fft16_inverse(const Seraph_FFT16* fft, Q16* re, Q16* im, int* exponent) {
+    if (!fft16_plan_valid(fft) || re == NULL || im == NULL || exponent == NULL) {
+        return false;
+    }
+    /* Swapping real and imaginary parts turns the forward transform
+     * into the unscaled inverse */
+    *exponent = fft16_complex(fft, im, re) - fft->log2n;
+    return true;
+}
+
+bool seraph_fft16_real(const Seraph_FFT16* fft, const Q16* x,
+                       Q16* re, Q16* im, int* exponent) {
+    if (!fft16_plan_valid(fft) || fft->n < 4 || x == NULL || re == NULL ||
+        im == NULL || exponent == NULL) {
+        return false;
+    }
+    *exponent = fft16_real_one(fft, x, re, im);
+    return true;
+}
+
+bool seraph_fft16_forward_batch(const Seraph_FFT16* fft, Q16* re, Q16* im,
+                                size_t channels, int* exponents) {
+    if (!fft16_plan_valid(fft) || re == NULL || im == NULL || exponents == NULL) {
+        return false;
+    }
+    size_t n = (size_t)fft->n;
+    for (size_t c = 0; c < channels; c++) {
+        exponents[c] = fft16_complex(fft, re + c * n, im + c * n);
+    }
+    return true;
+}
+
+bool seraph_fft16_real_batch(const Seraph_FFT16* fft, const Q16* x,
+                             Q16* re, Q16* im, size_t channels, int* exponents) {
+    if (!fft16_plan_valid(fft) || fft->n < 4 || x == NULL || re == NULL ||
+        im == NULL || exponents == NULL) {
+        return false;
+    }
+    size_t n = (size_t)fft->n;
+    size_t bins = n / 2 + 1;
+    for (size_t c = 0; c < channels; c++) {
+        exponents[c] = fft16_real_one(fft, x + c * n, re + c * bins, im + c * bins);
+    }
+    return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Q32.32 passes (same structure, 64-bit data, seraph_q32_mul products)
+ *----------------------------------------------------------------------------*/
+
+static uint64_t fft32_bitrev(int64_t* re, int64_t* im, int n, int shift) {
+    uint64_t mag = 0;
+    for (int i = 0, j = 0; i < n; i++, j = fft_bitrev_next(j, n)) {
+        if (j < i) continue;
+        int64_t ar = fft_scale(re[i], shift), ai = fft_scale(im[i], shift);
+        int64_t br = fft_scale(re[j], shift), bi = fft_scale(im[j], shift);
+        re[i] = br; im[i] = bi;
+        re[j] = ar; im[j] = ai;
+        mag |= fft_abs(ar) | fft_abs(ai) | fft_abs(br) | fft_abs(bi);
+    }
+    return mag;
+}
+
+static uint64_t fft32_radix2_pass(int64_t* re, int64_t* im, int n, int shift) {
+    int64_t rnd = (INT64_C(1) << shift) >> 1;
+    uint64_t mag = 0;
+    for (int b = 0; b < n; b += 2) {
+        int64_t ar = (re[b] + rnd) >> shift, ai = (im[b] + rnd) >> shift;
+        int64_t br = (re[b + 1] + rnd) >> shift, bi = (im[b + 1] + rnd) >> shift;
+        re[b] = ar + br; im[b] = ai + bi;
+        re[b + 1] = ar - br; im[b + 1] = ai - bi;
+        mag |= fft_abs(ar + br) | fft_abs(ai + bi) | fft_abs(ar - br) | fft_abs(ai - bi);
+    }
+    return mag;
+}
+
+static uint64_t fft32_radix4_pass(int64_t* re, int64_t* im, int n, int span, int shift,
+                                  const Seraph_FFT32* fft) {
+    int64_t rnd = (INT64_C(1) << shift) >> 1;
+    int step = fft->n / (4 * span);
+    int half = fft->n / 2;
+    uint64_t mag = 0;
+
+    for (int j = 0; j < span; j++) {
+        int k1 = j * step, k2 = 2 * k1, k3 = 3 * k1;
+        int64_t c1 = fft->cos_tw[k1], s1 = fft->sin_tw[k1];
+        int64_t c2 = fft->cos_tw[k2], s2 = fft->sin_tw[k2];
+        int64_t c3, s3;
+        if (k3 < half) {
+            c3 = fft->cos_tw[k3];
+            s3 = fft->sin_tw[k3];
+        } else {
+            c3 = -fft->cos_tw[k3 - half];
+            s3 = -fft->sin_tw[k3 - half];
+        }
+
+        for (int b = j; b < n; b += 4 * span) {
+            int64_t* r = re + b;
+            int64_t* m = im + b;
+            int64_t f0r = (r[0] + rnd) >> shift,        f0i = (m[0] + rnd) >> shift;
+            int64_t f2r = (r[span] + rnd) >> shift,     f2i = (m[span] + rnd) >> shift;
+            int64_t f1r = (r[2 * span] + rnd) >> shift, f1i = (m[2 * span] + rnd) >> shift;
+            int64_t f3r = (r[3 * span] + rnd) >> shift, f3i = (m[3 * span] + rnd) >> shift;
+
+            int64_t t1r = seraph_q32_mul(f1r, c1) - seraph_q32_mul(f1i, s1);
+            int64_t t1i = seraph_q32_mul(f1r, s1) + seraph_q32_mul(f1i, c1);
+            int64_t t2r = seraph_q32_mul(f2r, c2) - seraph_q32_mul(f2i, s2);
+            int64_t t2i = seraph_q32_mul(f2r, s2) + seraph_q32_mul(f2i, c2);
+            int64_t t3r = seraph_q32_mul(f3r, c3) - seraph_q32_mul(f3i, s3);
+            int64_t t3i = seraph_q32_mul(f3r, s3) + seraph_q32_mul(f3i, c3);
+
+            int64_t ar = f0r + t2r, ai = f0i + t2i;
+            int64_t br = f0r - t2r, bi = f0i - t2i;
+            int64_t cr = t1r + t3r, ci = t1i + t3i;
+            int64_t dr = t1r - t3r, di = t1i - t3i;
+
+            r[0] = ar + cr;            m[0] = ai + ci;
+            r[2 * span] = ar - cr;     m[2 * span] = ai - ci;
+            r[span] = br + di;         m[span] = bi - dr;
+            r[3 * span] = br - di;     m[3 * span] = bi + dr;
+
+            mag |= fft_abs(r[0]) | fft_abs(m[0]) | fft_abs(r[span]) | fft_abs(m[span]) |
+                   fft_abs(r[2 * span]) | fft_abs(m[2 * span]) |
+                   fft_abs(r[3 * span]) | fft_abs(m[3 * span]);
+        }
+    }
+    return mag;
+}
+
+static int fft32_complex(const Seraph_FFT32* fft, int64_t* re, int64_t* im) {
+    int n = fft->n;
+    uint64_t mag = 0;
+    for (int i = 0; i < n; i++) {
+        mag |= fft_abs(re[i]) | fft_abs(im[i]);
+    }
+    if (mag == 0) return 0;
+
+    int shift = FFT32_RADIX4_BITS - (64 - __builtin_clzll(mag));
+    mag = fft32_bitrev(re, im, n, shift);
+
+    int exponent = -shift;
+    int span = 1;
+    if (fft->log2n & 1) {
+        int s = fft_shift_for(mag, FFT32_RADIX2_BITS);
+        mag = fft32_radix2_pass(re, im, n, s);
+        exponent += s;
+        span = 2;
+    }
+    for (; span < n; span *= 4) {
+        int s = fft_shift_for(mag, FFT32_RADIX4_BITS);
+        mag = fft32_radix4_pass(re, im, n, span, s, fft);
+        exponent += s;
+    }
+    return exponent;
+}
+
+bool seraph_fft32_init(Seraph_FFT32* fft, int n, int64_t* cos_tw, int64_t* sin_tw) {
+    int log2n = fft_log2(n);
+    if (fft == NULL || cos_tw == NULL || sin_tw == NULL || log2n < 0) return false;
+
+    seraph_harmonic32_fft_twiddles(n, cos_tw, sin_tw);
+    fft->n = n;
+    fft->log2n = log2n;
+    fft->cos_tw = cos_tw;
+    fft->sin_tw = sin_tw;
+    return true;
+}
+
+bool seraph_fft32_forward(const Seraph_FFT32* fft, int64_t* re, int64_t* im,
+                          int* exponent) {
+    if (!fft32_plan_valid(fft) || re == NULL || im == NULL || exponent == NULL) {
+        return false;
+    }
+    *exponent = fft32_complex(fft, re, im);
+    return true;
+}
+
+bool seraph_fft32_inverse(const Seraph_FFT32* fft, int64_t* re, int64_t* im,
+                          int* exponent) {
+    if (!fft32_plan_valid(fft) || re == NULL || im == NULL || exponent == NULL) {
+        return false;
+    }
+    *exponent = fft32_complex(fft, im, re) - fft->log2n;
+    return true;
 }
 
 /*============================================================================
@@ -23,6 +23,7 @@
 #include "seraph/pmm.h"
 #include "seraph/vmm.h"
 #include "seraph/kmalloc.h"
+#include "seraph/atlas.h"
 #include "seraph/interrupts.h"
 #include "seraph/scheduler.h"
 #include "seraph/sovereign.h"
@@ -805,6 +806,9 @@ void kernel_main(Seraph_BootInfo* boot_info) {
         kernel_panic("Failed to initialize kmalloc");
     }
 
+    /* Atlas snapshots write-protect pages through the kernel page tables */
+    seraph_atlas_attach_vmm(&g_vmm);
+
     /*------------------------------------------------------------------------
      * Step 8: Test allocations
      *------------------------------------------------------------------------*/
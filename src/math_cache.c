@@ -49,23 +49,177 @@ Seraph_Q64_Trig_Cache* seraph_q64_trig_cache_get(void) {
     return &tls_q64_cache;
 }
 
+/*============================================================================
+ * Set-Associative Memo Cache
+ *============================================================================*/
+
+bool seraph_memo_cache_init(Seraph_Memo_Cache* cache, Seraph_Memo_Entry* entries,
+                            uint32_t* tags, uint32_t capacity, uint32_t ways,
+                            uint32_t tag) {
+    if (cache == NULL || entries == NULL || tags == NULL || tag == 0) return false;
+    if (ways != 1 && ways != 2 && ways != SERAPH_MEMO_MAX_WAYS) return false;
+    if (capacity < ways || (capacity & (capacity - 1)) != 0) return false;
+
+    memset(cache, 0, sizeof(*cache));
+    cache->entries = entries;
+    cache->tags = tags;
+    cache->set_mask = capacity / ways - 1;
+    cache->ways = ways;
+    cache->tag = tag;
+    memset(tags, 0, capacity * sizeof(uint32_t));
+    return true;
+}
+
+Seraph_Memo_Cache* seraph_memo_cache_create(Seraph_Arena* arena, uint32_t capacity,
+                                            uint32_t ways, uint32_t tag) {
+    if (arena == NULL || capacity == 0 || capacity > (1u << 31) || tag == 0) return NULL;
+    if (ways != 1 && ways != 2 && ways != SERAPH_MEMO_MAX_WAYS) return NULL;
+
+    uint32_t rounded = ways;
+    while (rounded < capacity) rounded <<= 1;
+
+    Seraph_Memo_Cache* cache = seraph_arena_alloc(arena, sizeof(*cache),
+                                                  _Alignof(Seraph_Memo_Cache));
+    Seraph_Memo_Entry* entries = seraph_arena_alloc_array(arena, sizeof(Seraph_Memo_Entry),
+                                                          rounded, 64);
+    uint32_t* tags = seraph_arena_alloc_array(arena, sizeof(uint32_t), rounded, 64);
+    if (SERAPH_IS_VOID_PTR(cache) || SERAPH_IS_VOID_PTR(entries) ||
+        SERAPH_IS_VOID_PTR(tags)) {
+        return NULL;
+    }
+    if (!seraph_memo_cache_init(cache, entries, tags, rounded, ways, tag)) {
+        return NULL;
+    }
+    return cache;
+}
+
+void seraph_memo_cache_clear(Seraph_Memo_Cache* cache) {
+    if (cache == NULL) return;
+    memset(cache->tags, 0, ((size_t)cache->set_mask + 1) * cache->ways * sizeof(uint32_t));
+}
+
+size_t seraph_memo_cache_lookup_n(Seraph_Memo_Cache* cache, const uint64_t* keys,
+                                  uint64_t* values, size_t count,
+                                  Seraph_Compute_Fn compute) {
+    if (cache == NULL || keys == NULL || values == NULL || compute == NULL) return 0;
+
+    /* Counters accumulate locally; fill's victim choice reads misses */
+    size_t hits = 0;
+    for (size_t i = 0; i < count; i++) {
+        uint64_t v;
+        if (seraph_memo_cache_find(cache, cache->tag, keys[i], &v)) {
+            values[i] = v;
+            hits++;
+        } else {
+            cache->misses++;
+            values[i] = compute(keys[i]);
+            seraph_memo_cache_fill(cache, cache->tag, keys[i], values[i]);
+        }
+    }
+    cache->hits += hits;
+    return hits;
+}
+
+void seraph_memo_cache_stats(const Seraph_Memo_Cache* cache, Seraph_Memo_Stats* stats) {
+    if (cache == NULL || stats == NULL) return;
+
+    uint32_t capacity = (cache->set_mask + 1) * cache->ways;
+    uint32_t occupied = 0;
+    for (uint32_t i = 0; i < capacity; i++) {
+        occupied += cache->tags[i] != 0;
+    }
+    stats->hits = cache->hits;
+    stats->misses = cache->misses;
+    stats->evictions = cache->evictions;
+    stats->occupied = occupied;
+    stats->capacity = capacity;
+}
+
+void seraph_memo_cache_reset_stats(Seraph_Memo_Cache* cache) {
+    if (cache == NULL) return;
+    cache->hits = 0;
+    cache->misses = 0;
+    cache->evictions = 0;
+}
+
+/*============================================================================
+ * Thread-Local Memo Cache
+ *
+ * Backs the *_cached functions. Static per-thread storage stands in for
+ * an arena here since these entry points take no context.
+ *============================================================================*/
+
+#define MATH_MEMO_CAPACITY (SERAPH_MATH_CACHE_SIZE * 4)
+
+static SERAPH_THREAD_LOCAL Seraph_Memo_Entry tls_memo_entries[MATH_MEMO_CAPACITY];
+static SERAPH_THREAD_LOCAL uint32_t tls_memo_tags[MATH_MEMO_CAPACITY];
+static SERAPH_THREAD_LOCAL Seraph_Memo_Cache tls_memo;
+static SERAPH_THREAD_LOCAL int tls_memo_initialized = 0;
+
+Seraph_Memo_Cache* seraph_math_memo_get(void) {
+    if (!tls_memo_initialized) {
+        seraph_memo_cache_init(&tls_memo, tls_memo_entries, tls_memo_tags,
+                               MATH_MEMO_CAPACITY, SERAPH_MEMO_MAX_WAYS,
+                               SERAPH_MEMO_TAG_Q16_SINCOS);
+        tls_memo_initialized = 1;
+    }
+    return &tls_memo;
+}
+
 /*============================================================================
  * Cached Trig Functions
+ *
+ * sin/cos pairs are packed into one value: sin in the high half.
  *============================================================================*/
 
-/**
- * @brief Q16 sincos callback for cache
- */
-static void q16_sincos_callback(int32_t angle, int32_t* sin_out, int32_t* cos_out) {
-    q16_sincos((Q16)angle, (Q16*)sin_out, (Q16*)cos_out);
+static inline uint64_t sincos_pack(Q16 s, Q16 c) {
+    return ((uint64_t)(uint32_t)s << 32) | (uint32_t)c;
 }
 
 /**
  * @brief Cached Q16 sincos
  */
 void seraph_q16_sincos_cached(Q16 angle, Q16* sin_out, Q16* cos_out) {
-    Seraph_Q16_Trig_Cache* cache = seraph_q16_trig_cache_get();
-    seraph_q16_trig_cache_lookup(cache, angle, sin_out, cos_out, q16_sincos_callback);
+    Seraph_Memo_Cache* cache = seraph_math_memo_get();
+    uint64_t key = (uint32_t)angle;
+    uint64_t v;
+
+    if (!seraph_memo_cache_probe(cache, SERAPH_MEMO_TAG_Q16_SINCOS, key, &v)) {
+        Q16 s, c;
+        q16_sincos(angle, &s, &c);
+        v = sincos_pack(s, c);
+        seraph_memo_cache_fill(cache, SERAPH_MEMO_TAG_Q16_SINCOS, key, v);
+    }
+    *sin_out = (Q16)(uint32_t)(v >> 32);
+    *cos_out = (Q16)(uint32_t)v;
+}
+
+/**
+ * @brief Batched cached Q16 sincos
+ */
+size_t seraph_q16_sincos_cached_n(const Q16* angles, Q16* sin_out,
+                                  Q16* cos_out, size_t count) {
+    if (angles == NULL || sin_out == NULL || cos_out == NULL) return 0;
+
+    Seraph_Memo_Cache* cache = seraph_math_memo_get();
+    size_t hits = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        uint64_t key = (uint32_t)angles[i];
+        uint64_t v;
+        if (seraph_memo_cache_find(cache, SERAPH_MEMO_TAG_Q16_SINCOS, key, &v)) {
+            sin_out[i] = (Q16)(uint32_t)(v >> 32);
+            cos_out[i] = (Q16)(uint32_t)v;
+            hits++;
+        } else {
+            cache->misses++;
+            q16_sincos(angles[i], &sin_out[i], &cos_out[i]);
+            seraph_memo_cache_fill(cache, SERAPH_MEMO_TAG_Q16_SINCOS, key,
+                                   sincos_pack(sin_out[i], cos_out[i]));
+        }
+    }
+    cache->hits += hits;
+    return hits;
 }
 
 /**
@@ -94,15 +248,12 @@ Q16 seraph_q16_cos_cached(Q16 angle) {
  * @brief Pre-populate cache with common angles
  */
 void seraph_q16_cache_warm(void) {
-    Seraph_Q16_Trig_Cache* cache = seraph_q16_trig_cache_get();
-
     /* Warm cache with angles at regular intervals */
     Q16 step = Q16_2PI / 256;
 
     for (int i = 0; i < 256; i++) {
-        Q16 angle = step * i;
         Q16 s, c;
-        seraph_q16_trig_cache_lookup(cache, angle, &s, &c, q16_sincos_callback);
+        seraph_q16_sincos_cached(step * i, &s, &c);
     }
 }
 
@@ -110,11 +261,9 @@ void seraph_q16_cache_warm(void) {
  * @brief Pre-populate cache with specific angles
  */
 void seraph_q16_cache_warm_angles(const Q16* angles, size_t count) {
-    Seraph_Q16_Trig_Cache* cache = seraph_q16_trig_cache_get();
-
     for (size_t i = 0; i < count; i++) {
         Q16 s, c;
-        seraph_q16_trig_cache_lookup(cache, angles[i], &s, &c, q16_sincos_callback);
+        seraph_q16_sincos_cached(angles[i], &s, &c);
     }
 }
 
@@ -122,161 +271,51 @@ void seraph_q16_cache_warm_angles(const Q16* angles, size_t count) {
  * Cache Diagnostics
  *============================================================================*/
 
-#ifdef SERAPH_CACHE_STATS
-
-/**
- * @brief Print cache statistics
- */
-void seraph_q16_cache_print_stats(void) {
-    Seraph_Q16_Trig_Cache* cache = seraph_q16_trig_cache_get();
-
-    uint32_t total = cache->hits + cache->misses;
-    double hit_rate = (total > 0) ? (double)cache->hits / total : 0.0;
-
-    /* Would use seraph_print or similar */
-    (void)hit_rate;  /* Suppress unused warning in release */
-}
-
 /**
  * @brief Get detailed cache info
  */
 void seraph_q16_cache_info(uint32_t* hits, uint32_t* misses,
                             uint32_t* occupied, uint32_t* capacity) {
-    Seraph_Q16_Trig_Cache* cache = seraph_q16_trig_cache_get();
-
-    if (hits) *hits = cache->hits;
-    if (misses) *misses = cache->misses;
+    Seraph_Memo_Stats stats;
+    seraph_memo_cache_stats(seraph_math_memo_get(), &stats);
 
-    if (occupied) {
-        uint32_t count = 0;
-        for (int i = 0; i < SERAPH_MATH_CACHE_SIZE; i++) {
-            if (cache->entries[i].valid) count++;
-        }
-        *occupied = count;
-    }
-
-    if (capacity) *capacity = SERAPH_MATH_CACHE_SIZE;
-}
-
-#endif /* SERAPH_CACHE_STATS */
-
-/*============================================================================
- * Generic Memo Cache Implementation
- *============================================================================*/
-
-/**
- * @brief Create a memo cache
- */
-Seraph_Memo_Cache* seraph_memo_cache_create(void) {
-    /* In a full implementation, this would allocate from arena */
-    static Seraph_Memo_Cache static_cache;
-    static int initialized = 0;
-
-    if (!initialized) {
-        seraph_memo_cache_init(&static_cache);
-        initialized = 1;
-    }
-
-    return &static_cache;
-}
-
-/**
- * @brief Clear all entries in memo cache
- */
-void seraph_memo_cache_clear(Seraph_Memo_Cache* cache) {
-    if (cache == NULL) return;
-    memset(cache, 0, sizeof(*cache));
+    if (hits) *hits = (uint32_t)stats.hits;
+    if (misses) *misses = (uint32_t)stats.misses;
+    if (occupied) *occupied = stats.occupied;
+    if (capacity) *capacity = stats.capacity;
 }
 
 /*============================================================================
  * Specialized Caches
  *============================================================================*/
 
-/**
- * @brief Square root cache
- */
-typedef struct {
-    uint64_t keys[SERAPH_MATH_CACHE_SIZE];
-    uint32_t values[SERAPH_MATH_CACHE_SIZE];  /* Q16 results */
-    uint8_t valid[SERAPH_MATH_CACHE_SIZE / 8 + 1];
-} Seraph_Sqrt_Cache;
-
-static SERAPH_THREAD_LOCAL Seraph_Sqrt_Cache tls_sqrt_cache;
-static SERAPH_THREAD_LOCAL int tls_sqrt_initialized = 0;
-
 /**
  * @brief Cached Q16 sqrt
  */
 Q16 seraph_q16_sqrt_cached(Q16 x) {
-    if (!tls_sqrt_initialized) {
-        memset(&tls_sqrt_cache, 0, sizeof(tls_sqrt_cache));
-        tls_sqrt_initialized = 1;
-    }
-
     if (x <= 0) return 0;
 
-    uint32_t idx = seraph_cache_hash32((uint32_t)x) & SERAPH_MATH_CACHE_MASK;
-
-    int valid = (tls_sqrt_cache.valid[idx / 8] >> (idx % 8)) & 1;
-    int hit = valid && (tls_sqrt_cache.keys[idx] == (uint64_t)x);
-
-    /* Always compute (branchless) */
-    Q16 computed = q16_sqrt(x);
-
-    /* Select result */
-    Q16 result = seraph_select32(hit, tls_sqrt_cache.values[idx], (uint32_t)computed);
-
-    /* Update cache */
-    tls_sqrt_cache.keys[idx] = (uint64_t)x;
-    tls_sqrt_cache.values[idx] = (uint32_t)result;
-    tls_sqrt_cache.valid[idx / 8] |= (1 << (idx % 8));
-
-    return result;
+    Seraph_Memo_Cache* cache = seraph_math_memo_get();
+    uint64_t v;
+    if (!seraph_memo_cache_probe(cache, SERAPH_MEMO_TAG_Q16_SQRT, (uint32_t)x, &v)) {
+        v = (uint32_t)q16_sqrt(x);
+        seraph_memo_cache_fill(cache, SERAPH_MEMO_TAG_Q16_SQRT, (uint32_t)x, v);
+    }
+    return (Q16)(uint32_t)v;
 }
 
-/*============================================================================
- * Angle Normalization Cache
- *
- * Caches the result of angle reduction for frequently used angles.
- *============================================================================*/
-
-typedef struct {
-    Q16 input[SERAPH_MATH_CACHE_SIZE];
-    Q16 reduced[SERAPH_MATH_CACHE_SIZE];
-    int8_t quadrant[SERAPH_MATH_CACHE_SIZE];
-    uint8_t valid[SERAPH_MATH_CACHE_SIZE / 8 + 1];
-} Seraph_AngleReduce_Cache;
-
-static SERAPH_THREAD_LOCAL Seraph_AngleReduce_Cache tls_angle_cache;
-static SERAPH_THREAD_LOCAL int tls_angle_initialized = 0;
-
 /**
- * @brief Cached angle reduction
+ * @brief Cached angle reduction (quadrant in the high half of the value)
  */
 Q16 seraph_q16_reduce_cached(Q16 angle, int* quadrant) {
-    if (!tls_angle_initialized) {
-        memset(&tls_angle_cache, 0, sizeof(tls_angle_cache));
-        tls_angle_initialized = 1;
+    Seraph_Memo_Cache* cache = seraph_math_memo_get();
+    uint64_t v;
+    if (!seraph_memo_cache_probe(cache, SERAPH_MEMO_TAG_Q16_REDUCE, (uint32_t)angle, &v)) {
+        int quad;
+        Q16 reduced = q16_reduce_angle(angle, &quad);
+        v = ((uint64_t)(uint32_t)quad << 32) | (uint32_t)reduced;
+        seraph_memo_cache_fill(cache, SERAPH_MEMO_TAG_Q16_REDUCE, (uint32_t)angle, v);
     }
-
-    uint32_t idx = seraph_cache_hash32((uint32_t)angle) & SERAPH_MATH_CACHE_MASK;
-
-    int valid = (tls_angle_cache.valid[idx / 8] >> (idx % 8)) & 1;
-    int hit = valid && (tls_angle_cache.input[idx] == angle);
-
-    /* Always compute */
-    int computed_quad;
-    Q16 computed = q16_reduce_angle(angle, &computed_quad);
-
-    /* Select */
-    Q16 result = seraph_select32(hit, tls_angle_cache.reduced[idx], computed);
-    *quadrant = hit ? tls_angle_cache.quadrant[idx] : computed_quad;
-
-    /* Update cache */
-    tls_angle_cache.input[idx] = angle;
-    tls_angle_cache.reduced[idx] = result;
-    tls_angle_cache.quadrant[idx] = (int8_t)*quadrant;
-    tls_angle_cache.valid[idx / 8] |= (1 << (idx % 8));
-
-    return result;
+    *quadrant = (int)(v >> 32);
+    return (Q16)(uint32_t)v;
 }
@@ -7,6 +7,7 @@
  */
 
 #include "seraph/proof_blob.h"
+#include "seraph/crypto/sha256.h"
 #include <string.h>
 #include <stdlib.h>
 #include <stdio.h>
@@ -43,170 +44,51 @@ static uint64_t fnv1a_hash(const uint8_t* data, size_t len) {
 static uint64_t g_proof_blob_generation = 1;
 
 /*============================================================================
- * Internal: Simple SHA-256 Implementation (NIH: No OpenSSL dependency)
+ * Per-Thread Query Statistics
+ *
+ * Queries never write to the blob, so a loaded blob is shareable across
+ * threads; each thread counts its own queries here.
  *============================================================================*/
 
-/**
- * SHA-256 context
- */
-typedef struct {
-    uint32_t state[8];
-    uint64_t count;
-    uint8_t  buffer[64];
-} SHA256_CTX;
-
-/** SHA-256 constants */
-static const uint32_t sha256_k[64] = {
-    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
-    0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
-    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
-    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
-    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
-    0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
-    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
-    0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
-    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
-    0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
-    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
-    0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
-    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
-    0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
-    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
-    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
-};
-
-#define SHA256_ROTR(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
-#define SHA256_CH(x, y, z)  (((x) & (y)) ^ (~(x) & (z)))
-#define SHA256_MAJ(x, y, z) (((x) & (y)) ^ ((x) & (z)) ^ ((y) & (z)))
-#define SHA256_EP0(x) (SHA256_ROTR(x, 2) ^ SHA256_ROTR(x, 13) ^ SHA256_ROTR(x, 22))
-#define SHA256_EP1(x) (SHA256_ROTR(x, 6) ^ SHA256_ROTR(x, 11) ^ SHA256_ROTR(x, 25))
-#define SHA256_SIG0(x) (SHA256_ROTR(x, 7) ^ SHA256_ROTR(x, 18) ^ ((x) >> 3))
-#define SHA256_SIG1(x) (SHA256_ROTR(x, 17) ^ SHA256_ROTR(x, 19) ^ ((x) >> 10))
-
-static void sha256_transform(SHA256_CTX* ctx, const uint8_t data[64]) {
-    uint32_t a, b, c, d, e, f, g, h, t1, t2;
-    uint32_t w[64];
-
-    /* Prepare message schedule */
-    for (int i = 0; i < 16; i++) {
-        w[i] = ((uint32_t)data[i * 4] << 24) |
-               ((uint32_t)data[i * 4 + 1] << 16) |
-               ((uint32_t)data[i * 4 + 2] << 8) |
-               ((uint32_t)data[i * 4 + 3]);
-    }
-    for (int i = 16; i < 64; i++) {
-        w[i] = SHA256_SIG1(w[i - 2]) + w[i - 7] +
-               SHA256_SIG0(w[i - 15]) + w[i - 16];
-    }
-
-    /* Initialize working variables */
-    a = ctx->state[0];
-    b = ctx->state[1];
-    c = ctx->state[2];
-    d = ctx->state[3];
-    e = ctx->state[4];
-    f = ctx->state[5];
-    g = ctx->state[6];
-    h = ctx->state[7];
-
-    /* Main loop */
-    for (int i = 0; i < 64; i++) {
-        t1 = h + SHA256_EP1(e) + SHA256_CH(e, f, g) + sha256_k[i] + w[i];
-        t2 = SHA256_EP0(a) + SHA256_MAJ(a, b, c);
-        h = g;
-        g = f;
-        f = e;
-        e = d + t1;
-        d = c;
-        c = b;
-        b = a;
-        a = t1 + t2;
-    }
+#if defined(__GNUC__) || defined(__clang__)
+    #define PROOF_BLOB_TLS __thread
+#elif defined(_WIN32) && defined(_MSC_VER)
+    #define PROOF_BLOB_TLS __declspec(thread)
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+    #define PROOF_BLOB_TLS _Thread_local
+#else
+    #define PROOF_BLOB_TLS
+#endif
 
-    /* Add to state */
-    ctx->state[0] += a;
-    ctx->state[1] += b;
-    ctx->state[2] += c;
-    ctx->state[3] += d;
-    ctx->state[4] += e;
-    ctx->state[5] += f;
-    ctx->state[6] += g;
-    ctx->state[7] += h;
-}
-
-static void sha256_init(SHA256_CTX* ctx) {
-    ctx->state[0] = 0x6a09e667;
-    ctx->state[1] = 0xbb67ae85;
-    ctx->state[2] = 0x3c6ef372;
-    ctx->state[3] = 0xa54ff53a;
-    ctx->state[4] = 0x510e527f;
-    ctx->state[5] = 0x9b05688c;
-    ctx->state[6] = 0x1f83d9ab;
-    ctx->state[7] = 0x5be0cd19;
-    ctx->count = 0;
-}
+static PROOF_BLOB_TLS Seraph_Proof_Blob_Query_Stats tls_query_stats;
 
-static void sha256_update(SHA256_CTX* ctx, const uint8_t* data, size_t len) {
-    size_t i = 0;
-    size_t idx = (size_t)(ctx->count & 0x3F);
-
-    ctx->count += len;
-
-    /* Fill buffer and transform */
-    if (idx) {
-        size_t left = 64 - idx;
-        if (len < left) {
-            memcpy(ctx->buffer + idx, data, len);
-            return;
-        }
-        memcpy(ctx->buffer + idx, data, left);
-        sha256_transform(ctx, ctx->buffer);
-        i = left;
-    }
-
-    /* Transform full blocks */
-    while (i + 64 <= len) {
-        sha256_transform(ctx, data + i);
-        i += 64;
-    }
+/*============================================================================
+ * Internal: Bloom Filter
+ *
+ * Blocked filter: each (location, kind) key sets three bits inside a
+ * single 64-bit word, so a lookup costs one load.
+ *============================================================================*/
 
-    /* Copy remainder */
-    if (i < len) {
-        memcpy(ctx->buffer, data + i, len - i);
-    }
+/**
+ * @brief Mix location hash and kind into the Bloom key
+ */
+static inline uint64_t bloom_key(uint64_t location_hash, uint8_t kind) {
+    uint64_t h = location_hash ^ ((uint64_t)kind * 0x9E3779B97F4A7C15ULL);
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
 }
 
-static void sha256_final(SHA256_CTX* ctx, uint8_t hash[32]) {
-    size_t idx = (size_t)(ctx->count & 0x3F);
-    uint64_t bits = ctx->count * 8;
-
-    /* Pad */
-    ctx->buffer[idx++] = 0x80;
-    if (idx > 56) {
-        memset(ctx->buffer + idx, 0, 64 - idx);
-        sha256_transform(ctx, ctx->buffer);
-        idx = 0;
-    }
-    memset(ctx->buffer + idx, 0, 56 - idx);
-
-    /* Append length */
-    ctx->buffer[56] = (uint8_t)(bits >> 56);
-    ctx->buffer[57] = (uint8_t)(bits >> 48);
-    ctx->buffer[58] = (uint8_t)(bits >> 40);
-    ctx->buffer[59] = (uint8_t)(bits >> 32);
-    ctx->buffer[60] = (uint8_t)(bits >> 24);
-    ctx->buffer[61] = (uint8_t)(bits >> 16);
-    ctx->buffer[62] = (uint8_t)(bits >> 8);
-    ctx->buffer[63] = (uint8_t)(bits);
-    sha256_transform(ctx, ctx->buffer);
-
-    /* Output hash */
-    for (int i = 0; i < 8; i++) {
-        hash[i * 4]     = (uint8_t)(ctx->state[i] >> 24);
-        hash[i * 4 + 1] = (uint8_t)(ctx->state[i] >> 16);
-        hash[i * 4 + 2] = (uint8_t)(ctx->state[i] >> 8);
-        hash[i * 4 + 3] = (uint8_t)(ctx->state[i]);
-    }
+/**
+ * @brief The three bits a key sets in its word
+ */
+static inline uint64_t bloom_bits(uint64_t key) {
+    return (1ULL << ((key >> 40) & 63)) |
+           (1ULL << ((key >> 46) & 63)) |
+           (1ULL << ((key >> 52) & 63));
 }
 
 /*============================================================================
@@ -298,15 +180,35 @@ Seraph_Vbit seraph_proof_blob_load(
         return SERAPH_VBIT_FALSE;
     }
 
+    /* Slot and Bloom word counts must be powers of two */
+    uint32_t slots = header->bucket_count;
+    uint32_t words = header->bloom_words;
+    if (slots == 0 || (slots & (slots - 1)) != 0 ||
+        words == 0 || (words & (words - 1)) != 0) {
+        return SERAPH_VBIT_FALSE;
+    }
+
+    /* Index, filter and proofs must fit their regions */
+    uint64_t index_end = header->index_offset +
+                         (uint64_t)slots * sizeof(Seraph_Proof_Blob_Slot) +
+                         (uint64_t)words * sizeof(uint64_t);
+    uint64_t proofs_end = header->proofs_offset +
+                          (uint64_t)header->proof_count * sizeof(Seraph_Proof_Blob_Record);
+    if (index_end > header->proofs_offset || proofs_end > header->checksum_offset) {
+        return SERAPH_VBIT_FALSE;
+    }
+
     /* Map structures */
     blob->header = header;
     blob->blob_size = size;
 
-    /* Map hash index */
+    /* Map hash index and Bloom filter */
     const uint8_t* base = (const uint8_t*)data;
-    blob->buckets = (const uint32_t*)(base + header->index_offset);
-    blob->entries = (const Seraph_Proof_Blob_Index_Entry*)(
-        base + header->index_offset + header->bucket_count * sizeof(uint32_t));
+    blob->slots = (const Seraph_Proof_Blob_Slot*)(base + header->index_offset);
+    blob->bloom = (const uint64_t*)(
+        base + header->index_offset + (size_t)slots * sizeof(Seraph_Proof_Blob_Slot));
+    blob->slot_mask = slots - 1;
+    blob->bloom_mask = words - 1;
 
     /* Map proofs */
     blob->proofs = (const Seraph_Proof_Blob_Record*)(base + header->proofs_offset);
@@ -330,7 +232,7 @@ Seraph_Vbit seraph_proof_blob_verify(const Seraph_Proof_Blob* blob) {
     if (!blob || !blob->header) return SERAPH_VBIT_VOID;
 
     /* Compute SHA-256 of everything except the checksum */
-    SHA256_CTX ctx;
+    SHA256_Context ctx;
     sha256_init(&ctx);
 
     const uint8_t* data = (const uint8_t*)blob->header;
@@ -358,6 +260,40 @@ void seraph_proof_blob_unload(Seraph_Proof_Blob* blob) {
  * Proof Lookup
  *============================================================================*/
 
+/**
+ * @brief Find the index slot for (location_hash, kind)
+ *
+ * Checks the Bloom filter first; *filtered tells whether it answered.
+ */
+static const Seraph_Proof_Blob_Slot* blob_find_slot(
+    const Seraph_Proof_Blob* blob,
+    uint64_t location_hash,
+    uint8_t kind,
+    bool* filtered)
+{
+    uint64_t key = bloom_key(location_hash, kind);
+    uint64_t bits = bloom_bits(key);
+    if ((blob->bloom[key & blob->bloom_mask] & bits) != bits) {
+        *filtered = true;
+        return NULL;
+    }
+    *filtered = false;
+
+    /* Linear probe; the table is at most half full, so an empty slot ends it */
+    uint32_t i = (uint32_t)location_hash & blob->slot_mask;
+    for (uint32_t n = 0; n <= blob->slot_mask; n++) {
+        const Seraph_Proof_Blob_Slot* slot = &blob->slots[i];
+        if (slot->proof_index == SERAPH_PROOF_BLOB_EMPTY_BUCKET) {
+            return NULL;
+        }
+        if (slot->code_hash == location_hash && slot->kind == kind) {
+            return slot;
+        }
+        i = (i + 1) & blob->slot_mask;
+    }
+    return NULL;
+}
+
 Seraph_Proof_Status seraph_proof_blob_query(
     const Seraph_Proof_Blob* blob,
     uint64_t location_hash,
@@ -365,30 +301,18 @@ Seraph_Proof_Status seraph_proof_blob_query(
 {
     if (!blob || !blob->header) return SERAPH_PROOF_STATUS_SKIPPED;
 
-    /* Update statistics (cast away const for stats) */
-    ((Seraph_Proof_Blob*)blob)->queries++;
-
-    /* Calculate bucket */
-    uint32_t bucket = (uint32_t)(location_hash % blob->header->bucket_count);
-    uint32_t entry_idx = blob->buckets[bucket];
-
-    /* Walk chain */
-    while (entry_idx != SERAPH_PROOF_BLOB_EMPTY_BUCKET) {
-        const Seraph_Proof_Blob_Index_Entry* entry = &blob->entries[entry_idx];
+    tls_query_stats.queries++;
 
-        if (entry->code_hash == location_hash) {
-            const Seraph_Proof_Blob_Record* proof = &blob->proofs[entry->proof_index];
-
-            if (proof->kind == kind) {
-                ((Seraph_Proof_Blob*)blob)->hits++;
-                return (Seraph_Proof_Status)proof->status;
-            }
-        }
-
-        entry_idx = entry->next;
+    bool filtered;
+    const Seraph_Proof_Blob_Slot* slot =
+        blob_find_slot(blob, location_hash, (uint8_t)kind, &filtered);
+    if (slot) {
+        tls_query_stats.hits++;
+        return (Seraph_Proof_Status)slot->status;
     }
 
-    ((Seraph_Proof_Blob*)blob)->misses++;
+    tls_query_stats.misses++;
+    if (filtered) tls_query_stats.bloom_rejects++;
     return SERAPH_PROOF_STATUS_SKIPPED;
 }
 
@@ -399,26 +323,13 @@ const Seraph_Proof_Blob_Record* seraph_proof_blob_get(
 {
     if (!blob || !blob->header) return NULL;
 
-    /* Calculate bucket */
-    uint32_t bucket = (uint32_t)(location_hash % blob->header->bucket_count);
-    uint32_t entry_idx = blob->buckets[bucket];
-
-    /* Walk chain */
-    while (entry_idx != SERAPH_PROOF_BLOB_EMPTY_BUCKET) {
-        const Seraph_Proof_Blob_Index_Entry* entry = &blob->entries[entry_idx];
-
-        if (entry->code_hash == location_hash) {
-            const Seraph_Proof_Blob_Record* proof = &blob->proofs[entry->proof_index];
-
-            if (proof->kind == kind) {
-                return proof;
-            }
-        }
-
-        entry_idx = entry->next;
+    bool filtered;
+    const Seraph_Proof_Blob_Slot* slot =
+        blob_find_slot(blob, location_hash, (uint8_t)kind, &filtered);
+    if (!slot || slot->proof_index >= blob->header->proof_count) {
+        return NULL;
     }
-
-    return NULL;
+    return &blob->proofs[slot->proof_index];
 }
 
 /*============================================================================
@@ -524,27 +435,37 @@ Seraph_Vbit seraph_proof_blob_builder_add(
 }
 
 /**
- * @brief Calculate optimal bucket count for hash table
+ * @brief Round up to a power of two
  */
-static uint32_t calculate_bucket_count(uint32_t proof_count) {
-    /* Use load factor of ~0.75 */
-    uint32_t buckets = (proof_count * 4) / 3;
+static uint32_t next_pow2(uint32_t v) {
+    if (v <= 1) return 1;
+    v--;
+    v |= v >> 1;
+    v |= v >> 2;
+    v |= v >> 4;
+    v |= v >> 8;
+    v |= v >> 16;
+    return v + 1;
+}
 
-    /* Round up to power of 2 for fast modulo */
+/**
+ * @brief Calculate slot count for the open-addressed index
+ */
+static uint32_t calculate_bucket_count(uint32_t proof_count) {
+    /* Load factor at most 0.5 keeps linear probes short */
+    uint32_t buckets = proof_count * 2;
     if (buckets < SERAPH_PROOF_BLOB_MIN_BUCKETS) {
         buckets = SERAPH_PROOF_BLOB_MIN_BUCKETS;
     }
+    return next_pow2(buckets);
+}
 
-    /* Find next power of 2 */
-    buckets--;
-    buckets |= buckets >> 1;
-    buckets |= buckets >> 2;
-    buckets |= buckets >> 4;
-    buckets |= buckets >> 8;
-    buckets |= buckets >> 16;
-    buckets++;
-
-    return buckets;
+/**
+ * @brief Calculate Bloom filter size in 64-bit words
+ */
+static uint32_t calculate_bloom_words(uint32_t proof_count) {
+    uint32_t bits = proof_count * SERAPH_PROOF_BLOB_BLOOM_BITS_PER_PROOF;
+    return next_pow2((bits + 63) / 64);
 }
 
 size_t seraph_proof_blob_builder_finalize(Seraph_Proof_Blob_Builder* builder) {
@@ -552,12 +473,13 @@ size_t seraph_proof_blob_builder_finalize(Seraph_Proof_Blob_Builder* builder) {
 
     uint32_t proof_count = builder->proof_count;
     uint32_t bucket_count = calculate_bucket_count(proof_count);
+    uint32_t bloom_words = calculate_bloom_words(proof_count);
 
     /* Calculate sizes */
     size_t header_size = sizeof(Seraph_Proof_Blob_Header);
-    size_t bucket_size = bucket_count * sizeof(uint32_t);
-    size_t entries_size = proof_count * sizeof(Seraph_Proof_Blob_Index_Entry);
-    size_t index_size = bucket_size + entries_size;
+    size_t slots_size = bucket_count * sizeof(Seraph_Proof_Blob_Slot);
+    size_t bloom_size = bloom_words * sizeof(uint64_t);
+    size_t index_size = slots_size + bloom_size;
     size_t proofs_size = proof_count * sizeof(Seraph_Proof_Blob_Record);
     size_t checksum_size = SERAPH_PROOF_BLOB_CHECKSUM_SIZE;
 
@@ -590,26 +512,37 @@ size_t seraph_proof_blob_builder_finalize(Seraph_Proof_Blob_Builder* builder) {
     header->checksum_offset = checksum_offset;
     header->module_hash = builder->module_hash;
     header->generation = g_proof_blob_generation++;  /* Monotonic logical timestamp */
+    header->bloom_words = bloom_words;
     memset(header->reserved, 0, sizeof(header->reserved));
 
-    /* Write buckets (all empty initially) */
-    uint32_t* buckets = (uint32_t*)(builder->buffer + index_offset);
+    /* Write slots (all empty initially) and a clear filter */
+    Seraph_Proof_Blob_Slot* slots =
+        (Seraph_Proof_Blob_Slot*)(builder->buffer + index_offset);
+    memset(slots, 0, slots_size);
     for (uint32_t i = 0; i < bucket_count; i++) {
-        buckets[i] = SERAPH_PROOF_BLOB_EMPTY_BUCKET;
+        slots[i].proof_index = SERAPH_PROOF_BLOB_EMPTY_BUCKET;
     }
+    uint64_t* bloom = (uint64_t*)(builder->buffer + index_offset + slots_size);
+    memset(bloom, 0, bloom_size);
 
-    /* Write entries and build hash chains */
-    Seraph_Proof_Blob_Index_Entry* entries =
-        (Seraph_Proof_Blob_Index_Entry*)(builder->buffer + index_offset + bucket_size);
-
+    /* Insert by linear probing; a repeated (hash, kind) keeps the last proof */
+    uint32_t mask = bucket_count - 1;
     for (uint32_t i = 0; i < proof_count; i++) {
         uint64_t hash = builder->temp_hashes[i];
-        uint32_t bucket = (uint32_t)(hash % bucket_count);
+        const Seraph_Proof_Blob_Record* proof = &builder->temp_proofs[i];
 
-        entries[i].code_hash = hash;
-        entries[i].proof_index = i;
-        entries[i].next = buckets[bucket];
-        buckets[bucket] = i;
+        uint32_t s = (uint32_t)hash & mask;
+        while (slots[s].proof_index != SERAPH_PROOF_BLOB_EMPTY_BUCKET &&
+               !(slots[s].code_hash == hash && slots[s].kind == proof->kind)) {
+            s = (s + 1) & mask;
+        }
+        slots[s].code_hash = hash;
+        slots[s].proof_index = i;
+        slots[s].kind = proof->kind;
+        slots[s].status = proof->status;
+
+        uint64_t key = bloom_key(hash, proof->kind);
+        bloom[key & (bloom_words - 1)] |= bloom_bits(key);
     }
 
     /* Write proofs */
@@ -618,7 +551,7 @@ size_t seraph_proof_blob_builder_finalize(Seraph_Proof_Blob_Builder* builder) {
            proofs_size);
 
     /* Compute and write checksum */
-    SHA256_CTX ctx;
+    SHA256_Context ctx;
     sha256_init(&ctx);
     sha256_update(&ctx, builder->buffer, checksum_offset);
     sha256_final(&ctx, builder->buffer + checksum_offset);
@@ -686,9 +619,9 @@ void seraph_proof_blob_stats(
     if (!blob || !blob->header) return;
 
     stats->total_proofs = blob->header->proof_count;
-    stats->queries = blob->queries;
-    stats->hits = blob->hits;
-    stats->misses = blob->misses;
+    stats->queries = tls_query_stats.queries;
+    stats->hits = tls_query_stats.hits;
+    stats->misses = tls_query_stats.misses;
 
     /* Count by status */
     for (uint32_t i = 0; i < blob->header->proof_count; i++) {
@@ -712,6 +645,15 @@ void seraph_proof_blob_stats(
     }
 }
 
+void seraph_proof_blob_query_stats(Seraph_Proof_Blob_Query_Stats* stats) {
+    if (!stats) return;
+    *stats = tls_query_stats;
+}
+
+void seraph_proof_blob_query_stats_reset(void) {
+    memset(&tls_query_stats, 0, sizeof(tls_query_stats));
+}
+
 const char* seraph_proof_blob_kind_name(Seraph_Proof_Kind kind) {
     switch (kind) {
         case SERAPH_PROOF_BOUNDS:      return "BOUNDS";
@@ -761,7 +703,8 @@ void seraph_proof_blob_print(const Seraph_Proof_Blob* blob) {
     fprintf(stderr, "Module Hash:    0x%016llx\n",
             (unsigned long long)blob->header->module_hash);
     fprintf(stderr, "Size:           %zu bytes\n", blob->blob_size);
-    fprintf(stderr, "Buckets:        %u\n", blob->header->bucket_count);
+    fprintf(stderr, "Index Slots:    %u\n", blob->header->bucket_count);
+    fprintf(stderr, "Bloom Words:    %u\n", blob->header->bloom_words);
     fprintf(stderr, "--------------------------------------------------------------------------------\n");
     fprintf(stderr, "PROOFS:\n");
     fprintf(stderr, "  Total:        %llu\n", (unsigned long long)stats.total_proofs);
@@ -774,7 +717,7 @@ void seraph_proof_blob_print(const Seraph_Proof_Blob* blob) {
     fprintf(stderr, "  Assumed:      %llu\n", (unsigned long long)stats.assumed_count);
     fprintf(stderr, "  Failed:       %llu\n", (unsigned long long)stats.failed_count);
     fprintf(stderr, "--------------------------------------------------------------------------------\n");
-    fprintf(stderr, "QUERY STATISTICS:\n");
+    fprintf(stderr, "QUERY STATISTICS (this thread):\n");
     fprintf(stderr, "  Queries:      %llu\n", (unsigned long long)stats.queries);
     fprintf(stderr, "  Hits:         %llu (%.1f%%)\n",
             (unsigned long long)stats.hits,
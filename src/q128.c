@@ -7,6 +7,20 @@
 #include <string.h>
 #include <stdio.h>
 
+/*
+ * The MULX/ADX multiply is compiled with a target attribute and chosen at
+ * runtime, so the portable path stays available on CPUs without ADX.
+ */
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define Q128_X86_BMI2 1
+#include <immintrin.h>
+#endif
+
+/* AVX2 batch kernels follow the VBIT variant; the kernel build keeps to GPRs */
+#if !defined(SERAPH_KERNEL) && defined(Q128_X86_BMI2)
+#define Q128_X86_SIMD 1
+#endif
+
 /*============================================================================
  * Constants
  *============================================================================*/
@@ -58,7 +72,6 @@ static U128 u128_sub(U128 a, U128 b) {
 }
 
 /* Compare U128: returns -1, 0, +1 */
-__attribute__((unused))
 static int u128_compare(U128 a, U128 b) {
     if (a.hi != b.hi) return (a.hi > b.hi) ? 1 : -1;
     if (a.lo != b.lo) return (a.lo > b.lo) ? 1 : -1;
@@ -94,7 +107,6 @@ static U128 u64_mul_wide(uint64_t a, uint64_t b) {
 }
 
 /* Right shift U128 by n bits */
-__attribute__((unused))
 static U128 u128_shr(U128 x, int n) {
     if (n >= 128) return (U128){0, 0};
     if (n >= 64) {
@@ -107,6 +119,258 @@ static U128 u128_shr(U128 x, int n) {
     };
 }
 
+/* Left shift U128 by n bits (0 <= n < 128) */
+static U128 u128_shl(U128 x, int n) {
+    if (n >= 64) {
+        return (U128){ 0, x.lo << (n - 64) };
+    }
+    if (n == 0) return x;
+    return (U128){
+        x.lo << n,
+        (x.hi << n) | (x.lo >> (64 - n))
+    };
+}
+
+/* Leading zero count of a non-zero U128 */
+static int u128_clz(U128 x) {
+    return x.hi ? __builtin_clzll(x.hi) : 64 + __builtin_clzll(x.lo);
+}
+
+/*============================================================================
+ * Integer Division
+ *
+ * Division by invariant integers (Moller & Granlund): a 256-entry table
+ * seeds an 11-bit reciprocal of the normalized divisor, three Newton steps
+ * take it to 64 bits, and each 2-by-1 limb division then costs two
+ * multiplies instead of a DIV. Q128 quotients use schoolbook division with
+ * 64-bit limbs on top of that. No floating point anywhere.
+ *============================================================================*/
+
+/* floor((2^19 - 3*2^8) / (256 + i)), the 11-bit reciprocal seed */
+static const uint16_t u64_reciprocal_table[256] = {
+    0x7FD, 0x7F5, 0x7ED, 0x7E5, 0x7DD, 0x7D5, 0x7CE, 0x7C6, 0x7BF, 0x7B7, 0x7B0, 0x7A8,
+    0x7A1, 0x79A, 0x792, 0x78B, 0x784, 0x77D, 0x776, 0x76F, 0x768, 0x761, 0x75B, 0x754,
+    0x74D, 0x747, 0x740, 0x739, 0x733, 0x72C, 0x726, 0x720, 0x719, 0x713, 0x70D, 0x707,
+    0x700, 0x6FA, 0x6F4, 0x6EE, 0x6E8, 0x6E2, 0x6DC, 0x6D6, 0x6D1, 0x6CB, 0x6C5, 0x6BF,
+    0x6BA, 0x6B4, 0x6AE, 0x6A9, 0x6A3, 0x69E, 0x698, 0x693, 0x68D, 0x688, 0x683, 0x67D,
+    0x678, 0x673, 0x66E, 0x669, 0x664, 0x65E, 0x659, 0x654, 0x64F, 0x64A, 0x645, 0x640,
+    0x63C, 0x637, 0x632, 0x62D, 0x628, 0x624, 0x61F, 0x61A, 0x616, 0x611, 0x60C, 0x608,
+    0x603, 0x5FF, 0x5FA, 0x5F6, 0x5F1, 0x5ED, 0x5E9, 0x5E4, 0x5E0, 0x5DC, 0x5D7, 0x5D3,
+    0x5CF, 0x5CB, 0x5C6, 0x5C2, 0x5BE, 0x5BA, 0x5B6, 0x5B2, 0x5AE, 0x5AA, 0x5A6, 0x5A2,
+    0x59E, 0x59A, 0x596, 0x592, 0x58E, 0x58A, 0x586, 0x583, 0x57F, 0x57B, 0x577, 0x574,
+    0x570, 0x56C, 0x568, 0x565, 0x561, 0x55E, 0x55A, 0x556, 0x553, 0x54F, 0x54C, 0x548,
+    0x545, 0x541, 0x53E, 0x53A, 0x537, 0x534, 0x530, 0x52D, 0x52A, 0x526, 0x523, 0x520,
+    0x51C, 0x519, 0x516, 0x513, 0x50F, 0x50C, 0x509, 0x506, 0x503, 0x500, 0x4FC, 0x4F9,
+    0x4F6, 0x4F3, 0x4F0, 0x4ED, 0x4EA, 0x4E7, 0x4E4, 0x4E1, 0x4DE, 0x4DB, 0x4D8, 0x4D5,
+    0x4D2, 0x4CF, 0x4CC, 0x4CA, 0x4C7, 0x4C4, 0x4C1, 0x4BE, 0x4BB, 0x4B9, 0x4B6, 0x4B3,
+    0x4B0, 0x4AD, 0x4AB, 0x4A8, 0x4A5, 0x4A3, 0x4A0, 0x49D, 0x49B, 0x498, 0x495, 0x493,
+    0x490, 0x48D, 0x48B, 0x488, 0x486, 0x483, 0x481, 0x47E, 0x47C, 0x479, 0x477, 0x474,
+    0x472, 0x46F, 0x46D, 0x46A, 0x468, 0x465, 0x463, 0x461, 0x45E, 0x45C, 0x459, 0x457,
+    0x455, 0x452, 0x450, 0x44E, 0x44B, 0x449, 0x447, 0x444, 0x442, 0x440, 0x43E, 0x43B,
+    0x439, 0x437, 0x435, 0x432, 0x430, 0x42E, 0x42C, 0x42A, 0x428, 0x425, 0x423, 0x421,
+    0x41F, 0x41D, 0x41B, 0x419, 0x417, 0x414, 0x412, 0x410, 0x40E, 0x40C, 0x40A, 0x408,
+    0x406, 0x404, 0x402, 0x400
+};
+
+/* floor((2^128 - 1) / d) - 2^64 for d with the top bit set */
+static uint64_t u64_reciprocal(uint64_t d) {
+    uint64_t d0 = d & 1;
+    uint64_t d9 = d >> 55;
+    uint64_t d40 = (d >> 24) + 1;
+    uint64_t d63 = (d >> 1) + d0;
+
+    uint64_t v0 = u64_reciprocal_table[d9 - 256];
+    uint64_t v1 = (v0 << 11) - ((v0 * v0 * d40) >> 40) - 1;
+    uint64_t v2 = (v1 << 13) + ((v1 * ((1ULL << 60) - v1 * d40)) >> 47);
+    uint64_t e = ((v2 >> 1) & (0 - d0)) - v2 * d63;
+    uint64_t v3 = (v2 << 31) + (u64_mul_wide(v2, e).hi >> 1);
+
+    U128 p = u128_add(u64_mul_wide(v3, d), (U128){ d, 0 });
+    return v3 - p.hi - d;
+}
+
+/* (u1:u0) / d with u1 < d, d normalized and v = u64_reciprocal(d) */
+static uint64_t u128_div_2by1(uint64_t u1, uint64_t u0, uint64_t d, uint64_t v,
+                              uint64_t* rem) {
+    U128 q = u128_add(u64_mul_wide(v, u1), (U128){ u0, u1 });
+    uint64_t q1 = q.hi + 1;
+    uint64_t r = u0 - q1 * d;
+    if (r > q.lo) {
+        q1--;
+        r += d;
+    }
+    if (r >= d) {
+        q1++;
+        r -= d;
+    }
+    *rem = r;
+    return q1;
+}
+
+/*
+ * One quotient limb of (u2:u1:u0) / (d1:d0), given (u2:u1) < (d1:d0) and
+ * d1 normalized. The estimate from the top limbs is at most two too large
+ * (Knuth, Algorithm D), so the divisor is added back until the remainder
+ * is non-negative.
+ */
+static uint64_t u128_div_limb(uint64_t u2, uint64_t u1, uint64_t u0,
+                              U128 d, uint64_t v, U128* rem) {
+    uint64_t q = UINT64_MAX;
+    uint64_t r_est;
+    if (u2 < d.hi) {
+        q = u128_div_2by1(u2, u1, d.hi, v, &r_est);
+    }
+
+    /* (r2:r1:r0) = (u2:u1:u0) - q * (d1:d0), modulo 2^192 */
+    U128 p_lo = u64_mul_wide(q, d.lo);
+    U128 p_hi = u64_mul_wide(q, d.hi);
+    uint64_t t1 = p_lo.hi + p_hi.lo;
+    uint64_t t2 = p_hi.hi + (t1 < p_hi.lo);
+
+    uint64_t r0 = u0 - p_lo.lo;
+    uint64_t borrow = u0 < p_lo.lo;
+    uint64_t r1 = u1 - t1 - borrow;
+    borrow = (u1 < t1) | ((u1 - t1) < borrow);
+    uint64_t r2 = u2 - t2 - borrow;
+    borrow = (u2 < t2) | ((u2 - t2) < borrow);
+
+    while (borrow) {
+        q--;
+        r0 += d.lo;
+        uint64_t carry = r0 < d.lo;
+        uint64_t s = r1 + d.hi;
+        uint64_t carry_out = s < d.hi;
+        r1 = s + carry;
+        carry_out |= r1 < carry;
+        r2 += carry_out;
+        /* Back to non-negative once the add carries out of the top limb */
+        borrow = !(carry_out && r2 == 0);
+    }
+
+    *rem = (U128){ r0, r1 };
+    return q;
+}
+
+/*
+ * floor(a * 2^64 / b) for magnitudes a and b (b != 0): the Q64.64 quotient.
+ * Returns false when it needs 127 bits or more and cannot be a Q128.
+ */
+static bool u128_div_q64(U128 a, U128 b, U128* quot) {
+    /* quotient < 2^127  <=>  a < b * 2^63  <=>  floor(a / 2^63) < b */
+    if (u128_compare(u128_shr(a, 63), b) >= 0) return false;
+
+    int s = u128_clz(b);
+    U128 d = u128_shl(b, s);
+
+    /* Dividend a << (s + 64) as limbs n2:n1:n0:0; it is below 2^255 */
+    uint64_t n2, n1, n0;
+    if (s == 0) {
+        n2 = 0;
+        n1 = a.hi;
+        n0 = a.lo;
+    } else if (s < 64) {
+        n2 = a.hi >> (64 - s);
+        n1 = (a.hi << s) | (a.lo >> (64 - s));
+        n0 = a.lo << s;
+    } else {
+        U128 top = u128_shl(a, s - 64);
+        n2 = top.hi;
+        n1 = top.lo;
+        n0 = 0;
+    }
+
+    uint64_t v = u64_reciprocal(d.hi);
+    U128 rem;
+    uint64_t q1 = u128_div_limb(n2, n1, n0, d, v, &rem);
+    uint64_t q0 = u128_div_limb(rem.hi, rem.lo, 0, d, v, &rem);
+    *quot = (U128){ q0, q1 };
+    return true;
+}
+
+/*============================================================================
+ * Multiply Kernels
+ *============================================================================*/
+
+/* Bits [64, 192) of the 256-bit product of two magnitudes */
+static U128 q128_mul_mid_portable(U128 a, U128 b) {
+    U128 p00 = u64_mul_wide(a.lo, b.lo);
+    U128 p01 = u64_mul_wide(a.lo, b.hi);
+    U128 p10 = u64_mul_wide(a.hi, b.lo);
+
+    U128 mid = u128_add(u128_add((U128){ p00.hi, 0 }, p01), p10);
+    mid.hi += a.hi * b.hi;
+    return mid;
+}
+
+#ifdef Q128_X86_BMI2
+/* BMI2 (CPUID.07H:EBX[8]) and ADX (CPUID.07H:EBX[19]) */
+static bool q128_cpu_has_bmi2_adx(void) {
+    uint32_t a, b, c, d;
+    __asm__ volatile("cpuid" : "=a"(a), "=b"(b), "=c"(c), "=d"(d) : "a"(0), "c"(0));
+    if (a < 7) return false;
+    __asm__ volatile("cpuid" : "=a"(a), "=b"(b), "=c"(c), "=d"(d) : "a"(7), "c"(0));
+    return (b >> 8 & 1) && (b >> 19 & 1);
+}
+
+/* Same product with MULX and two independent ADCX/ADOX carry chains */
+__attribute__((target("bmi2,adx")))
+static U128 q128_mul_mid_bmi2(U128 a, U128 b) {
+    unsigned long long h00, h01, h10, t, lo, u, hi;
+    _mulx_u64(a.lo, b.lo, &h00);
+    unsigned long long l01 = _mulx_u64(a.lo, b.hi, &h01);
+    unsigned long long l10 = _mulx_u64(a.hi, b.lo, &h10);
+
+    /* Separate outputs keep the chains in registers */
+    unsigned char c1 = _addcarryx_u64(0, h00, l01, &t);
+    unsigned char c2 = _addcarryx_u64(0, t, l10, &lo);
+    _addcarryx_u64(c1, h01, h10, &u);
+    _addcarryx_u64(c2, u, a.hi * b.hi, &hi);
+    return (U128){ lo, hi };
+}
+#endif
+
+static Seraph_Q128_Impl q128_impl = SERAPH_Q128_IMPL_AUTO;
+
+bool seraph_q128_impl_supported(Seraph_Q128_Impl impl) {
+    switch (impl) {
+        case SERAPH_Q128_IMPL_AUTO:
+        case SERAPH_Q128_IMPL_PORTABLE:
+            return true;
+#ifdef Q128_X86_BMI2
+        case SERAPH_Q128_IMPL_BMI2:
+            return q128_cpu_has_bmi2_adx();
+#endif
+        default:
+            return false;
+    }
+}
+
+bool seraph_q128_set_impl(Seraph_Q128_Impl impl) {
+    if (!seraph_q128_impl_supported(impl)) return false;
+
+    if (impl == SERAPH_Q128_IMPL_AUTO) {
+        impl = seraph_q128_impl_supported(SERAPH_Q128_IMPL_BMI2)
+             ? SERAPH_Q128_IMPL_BMI2 : SERAPH_Q128_IMPL_PORTABLE;
+    }
+    q128_impl = impl;
+    return true;
+}
+
+Seraph_Q128_Impl seraph_q128_get_impl(void) {
+    if (q128_impl == SERAPH_Q128_IMPL_AUTO) seraph_q128_set_impl(SERAPH_Q128_IMPL_AUTO);
+    return q128_impl;
+}
+
+const char* seraph_q128_impl_name(Seraph_Q128_Impl impl) {
+    switch (impl) {
+        case SERAPH_Q128_IMPL_AUTO:     return "auto";
+        case SERAPH_Q128_IMPL_PORTABLE: return "portable";
+        case SERAPH_Q128_IMPL_BMI2:     return "bmi2+adx";
+        default:                        return "unknown";
+    }
+}
+
+
 /*============================================================================
  * Q128 Creation
  *============================================================================*/
@@ -253,7 +517,8 @@ Seraph_Q128 seraph_q128_sub(Seraph_Q128 a, Seraph_Q128 b) {
     return seraph_q128_select(SERAPH_Q128_VOID, result, void_mask);
 }
 
-Seraph_Q128 seraph_q128_neg(Seraph_Q128 x) {
+/* Inlined into the multiply and divide kernels; see seraph_q128_neg */
+static inline Seraph_Q128 q128_neg(Seraph_Q128 x) {
     Seraph_Q128 void_mask = seraph_q128_void_mask(x);
 
     /* Branchless negation: if lo==0, result is {-hi, 0}, else {~hi, ~lo+1} */
@@ -267,54 +532,70 @@ Seraph_Q128 seraph_q128_neg(Seraph_Q128 x) {
     return seraph_q128_select(SERAPH_Q128_VOID, result, void_mask);
 }
 
-Seraph_Q128 seraph_q128_abs(Seraph_Q128 x) {
+static inline Seraph_Q128 q128_abs(Seraph_Q128 x) {
     Seraph_Q128 void_mask = seraph_q128_void_mask(x);
 
     /* Branchless: negate if negative */
     int64_t is_neg = -(int64_t)(x.hi < 0);
-    Seraph_Q128 neg_x = seraph_q128_neg(x);
+    Seraph_Q128 neg_x = q128_neg(x);
     Seraph_Q128 neg_mask = { is_neg, (uint64_t)is_neg };
     Seraph_Q128 result = seraph_q128_select(neg_x, x, neg_mask);
 
     return seraph_q128_select(SERAPH_Q128_VOID, result, void_mask);
 }
 
-Seraph_Q128 seraph_q128_mul(Seraph_Q128 a, Seraph_Q128 b) {
-    Seraph_Q128 void_mask = seraph_q128_void_mask2(a, b);
+Seraph_Q128 seraph_q128_neg(Seraph_Q128 x) {
+    return q128_neg(x);
+}
 
-    /* Determine sign (branchless) */
-    int64_t negative = -(int64_t)((a.hi < 0) != (b.hi < 0));
+Seraph_Q128 seraph_q128_abs(Seraph_Q128 x) {
+    return q128_abs(x);
+}
 
-    /* Get absolute values (branchless) */
-    Seraph_Q128 abs_a = seraph_q128_abs(a);
-    Seraph_Q128 abs_b = seraph_q128_abs(b);
+/* (x ^ s) - s: two's complement negation when s is all-ones, else x */
+static inline U128 u128_cond_neg(U128 x, uint64_t s) {
+    return u128_sub((U128){ x.lo ^ s, x.hi ^ s }, (U128){ s, s });
+}
 
-    /* Full 256-bit multiplication, then extract middle 128 bits */
-    U128 p00 = u64_mul_wide(abs_a.lo, abs_b.lo);
-    U128 p01 = u64_mul_wide(abs_a.lo, (uint64_t)abs_b.hi);
-    U128 p10 = u64_mul_wide((uint64_t)abs_a.hi, abs_b.lo);
-    U128 p11 = u64_mul_wide((uint64_t)abs_a.hi, (uint64_t)abs_b.hi);
+/*
+ * Signed multiply around a magnitude kernel. Always inlined so the BMI2
+ * instance is compiled whole under the target attribute rather than
+ * paying a call into the kernel.
+ */
+__attribute__((always_inline))
+static inline Seraph_Q128 q128_mul_with(Seraph_Q128 a, Seraph_Q128 b,
+                                        U128 (*mul_mid)(U128, U128)) {
+    Seraph_Q128 void_mask = seraph_q128_void_mask2(a, b);
 
-    /* Middle 128 bits */
-    uint64_t result_lo = p00.hi;
-    uint64_t result_hi = p11.lo;
+    /* Sign masks (branchless) */
+    uint64_t sign_a = (uint64_t)0 - (a.hi < 0);
+    uint64_t sign_b = (uint64_t)0 - (b.hi < 0);
+    uint64_t negative = sign_a ^ sign_b;
 
-    uint64_t carry1 = (result_lo + p01.lo < result_lo) ? 1 : 0;
-    result_lo += p01.lo;
-    result_hi += p01.hi + carry1;
+    /* Full 256-bit multiplication of the magnitudes, middle 128 bits */
+    U128 mid = mul_mid(u128_cond_neg((U128){ a.lo, (uint64_t)a.hi }, sign_a),
+                       u128_cond_neg((U128){ b.lo, (uint64_t)b.hi }, sign_b));
 
-    uint64_t carry2 = (result_lo + p10.lo < result_lo) ? 1 : 0;
-    result_lo += p10.lo;
-    result_hi += p10.hi + carry2;
+    /* Negate if needed; a wrapped product that reads as VOID stays VOID */
+    uint64_t wrapped = (uint64_t)0 - ((mid.hi & mid.lo) == UINT64_MAX);
+    U128 r = u128_cond_neg(mid, negative);
+    uint64_t mask = (uint64_t)void_mask.lo | (negative & wrapped);
 
-    Seraph_Q128 result = { (int64_t)result_hi, result_lo };
+    return (Seraph_Q128){ (int64_t)(r.hi | mask), r.lo | mask };
+}
 
-    /* Negate if needed (branchless) */
-    Seraph_Q128 neg_result = seraph_q128_neg(result);
-    Seraph_Q128 neg_mask = { negative, (uint64_t)negative };
-    result = seraph_q128_select(neg_result, result, neg_mask);
+#ifdef Q128_X86_BMI2
+__attribute__((target("bmi2,adx")))
+static Seraph_Q128 q128_mul_bmi2(Seraph_Q128 a, Seraph_Q128 b) {
+    return q128_mul_with(a, b, q128_mul_mid_bmi2);
+}
+#endif
 
-    return seraph_q128_select(SERAPH_Q128_VOID, result, void_mask);
+Seraph_Q128 seraph_q128_mul(Seraph_Q128 a, Seraph_Q128 b) {
+#ifdef Q128_X86_BMI2
+    if (seraph_q128_get_impl() == SERAPH_Q128_IMPL_BMI2) return q128_mul_bmi2(a, b);
+#endif
+    return q128_mul_with(a, b, q128_mul_mid_portable);
 }
 
 Seraph_Q128 seraph_q128_div(Seraph_Q128 a, Seraph_Q128 b) {
@@ -329,28 +610,24 @@ Seraph_Q128 seraph_q128_div(Seraph_Q128 a, Seraph_Q128 b) {
     int64_t negative = -(int64_t)((a.hi < 0) != (b.hi < 0));
 
     /* Get absolute values */
-    Seraph_Q128 abs_a = seraph_q128_abs(a);
-    Seraph_Q128 abs_b = seraph_q128_abs(b);
+    Seraph_Q128 abs_a = q128_abs(a);
+    Seraph_Q128 abs_b = q128_abs(b);
 
-    /* Avoid division by zero in approximation by using safe value */
+    /* Avoid division by zero in the divider by using safe value */
     Seraph_Q128 safe_b = seraph_q128_select(SERAPH_Q128_ONE, abs_b, zero_mask);
 
-    /* Initial estimate for 1/b */
-    double b_approx = seraph_q128_to_double(safe_b);
-    Seraph_Q128 x = seraph_q128_from_double(1.0 / b_approx);
+    /* Exact quotient, truncated toward zero */
+    U128 quot = { 0, 0 };
+    bool fits = u128_div_q64((U128){ abs_a.lo, (uint64_t)abs_a.hi },
+                             (U128){ safe_b.lo, (uint64_t)safe_b.hi }, &quot);
+    int64_t overflow = -(int64_t)!fits;
+    combined_void.hi |= overflow;
+    combined_void.lo |= (uint64_t)overflow;
 
-    /* Newton iterations: x = x * (2 - b*x) */
-    Seraph_Q128 two = seraph_q128_from_i64(2);
-    for (int i = 0; i < 4; i++) {
-        Seraph_Q128 bx = seraph_q128_mul(safe_b, x);
-        Seraph_Q128 diff = seraph_q128_sub(two, bx);
-        x = seraph_q128_mul(x, diff);
-    }
-
-    Seraph_Q128 result = seraph_q128_mul(abs_a, x);
+    Seraph_Q128 result = { (int64_t)quot.hi, quot.lo };
 
     /* Negate if needed (branchless) */
-    Seraph_Q128 neg_result = seraph_q128_neg(result);
+    Seraph_Q128 neg_result = q128_neg(result);
     Seraph_Q128 neg_mask = { negative, (uint64_t)negative };
     result = seraph_q128_select(neg_result, result, neg_mask);
 
@@ -365,6 +642,253 @@ int seraph_q128_compare(Seraph_Q128 a, Seraph_Q128 b) {
     return 0;
 }
 
+/*============================================================================
+ * Q128 Batch Operations
+ *
+ * Each AVX2 kernel handles whole groups of four and returns how many
+ * elements it consumed; the scalar loop finishes the tail (and everything
+ * when AVX2 is not selected). VOID is all-ones in both words, so OR-ing a
+ * lane mask into the result selects VOID.
+ *============================================================================*/
+
+Seraph_Vbit seraph_q128_lanes_from_soa(const Seraph_SoA_Array* array,
+                                       uint32_t first_field,
+                                       Seraph_Q128_Lanes* out) {
+    if (out == NULL) return SERAPH_VBIT_VOID;
+    Seraph_Prism hi = seraph_soa_get_prism(array, first_field);
+    Seraph_Prism lo = seraph_soa_get_prism(array, first_field + 1);
+    if (!seraph_prism_is_valid(hi) || !seraph_prism_is_valid(lo)) return SERAPH_VBIT_VOID;
+    if (hi.element_size != sizeof(int64_t) || lo.element_size != sizeof(uint64_t)) {
+        return SERAPH_VBIT_VOID;
+    }
+    out->hi = (int64_t*)hi.base;
+    out->lo = (uint64_t*)lo.base;
+    return SERAPH_VBIT_TRUE;
+}
+
+void seraph_q128_lanes_scatter(Seraph_Q128_Lanes dst, const Seraph_Q128* src, size_t count) {
+    if (src == NULL) return;
+    for (size_t i = 0; i < count; i++) {
+        dst.hi[i] = src[i].hi;
+        dst.lo[i] = src[i].lo;
+    }
+}
+
+void seraph_q128_lanes_gather(Seraph_Q128* dst, Seraph_Q128_Lanes src, size_t count) {
+    if (dst == NULL) return;
+    for (size_t i = 0; i < count; i++) {
+        dst[i] = (Seraph_Q128){ src.hi[i], src.lo[i] };
+    }
+}
+
+static inline Seraph_Q128 q128_lane(Seraph_Q128_Lanes x, size_t i) {
+    return (Seraph_Q128){ x.hi[i], x.lo[i] };
+}
+
+static inline void q128_lane_set(Seraph_Q128_Lanes x, size_t i, Seraph_Q128 v) {
+    x.hi[i] = v.hi;
+    x.lo[i] = v.lo;
+}
+
+#ifdef Q128_X86_SIMD
+#define Q128_AVX2 __attribute__((target("avx2")))
+
+#define Q128_LOAD(p)     _mm256_loadu_si256((const __m256i*)(const void*)(p))
+#define Q128_STORE(p, v) _mm256_storeu_si256((__m256i*)(void*)(p), (v))
+
+/* All-ones lanes where { hi, lo } is VOID */
+Q128_AVX2 static inline __m256i q128_void_lanes(__m256i hi, __m256i lo) {
+    return _mm256_cmpeq_epi64(_mm256_and_si256(hi, lo), _mm256_set1_epi64x(-1));
+}
+
+/* All-ones lanes where a < b as unsigned 64-bit values */
+Q128_AVX2 static inline __m256i q128_ult_lanes(__m256i a, __m256i b) {
+    const __m256i bias = _mm256_set1_epi64x(INT64_MIN);
+    return _mm256_cmpgt_epi64(_mm256_xor_si256(b, bias), _mm256_xor_si256(a, bias));
+}
+
+Q128_AVX2
+static size_t q128_add_n_avx2(Seraph_Q128_Lanes dst, Seraph_Q128_Lanes a,
+                              Seraph_Q128_Lanes b, size_t count) {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256i ah = Q128_LOAD(a.hi + i), al = Q128_LOAD(a.lo + i);
+        __m256i bh = Q128_LOAD(b.hi + i), bl = Q128_LOAD(b.lo + i);
+
+        __m256i lo = _mm256_add_epi64(al, bl);
+        __m256i carry = q128_ult_lanes(lo, al);
+        __m256i hi = _mm256_sub_epi64(_mm256_add_epi64(ah, bh), carry);
+
+        /* Overflow: operands share a sign that the sum does not */
+        __m256i flip = _mm256_andnot_si256(_mm256_xor_si256(ah, bh), _mm256_xor_si256(ah, hi));
+        __m256i mask = _mm256_cmpgt_epi64(_mm256_setzero_si256(), flip);
+        mask = _mm256_or_si256(mask, _mm256_or_si256(q128_void_lanes(ah, al),
+                                                     q128_void_lanes(bh, bl)));
+
+        Q128_STORE(dst.hi + i, _mm256_or_si256(hi, mask));
+        Q128_STORE(dst.lo + i, _mm256_or_si256(lo, mask));
+    }
+    return i;
+}
+
+Q128_AVX2
+static size_t q128_sub_n_avx2(Seraph_Q128_Lanes dst, Seraph_Q128_Lanes a,
+                              Seraph_Q128_Lanes b, size_t count) {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256i ah = Q128_LOAD(a.hi + i), al = Q128_LOAD(a.lo + i);
+        __m256i bh = Q128_LOAD(b.hi + i), bl = Q128_LOAD(b.lo + i);
+
+        __m256i borrow = q128_ult_lanes(al, bl);
+        __m256i lo = _mm256_sub_epi64(al, bl);
+        __m256i hi = _mm256_add_epi64(_mm256_sub_epi64(ah, bh), borrow);
+        __m256i mask = _mm256_or_si256(q128_void_lanes(ah, al), q128_void_lanes(bh, bl));
+
+        Q128_STORE(dst.hi + i, _mm256_or_si256(hi, mask));
+        Q128_STORE(dst.lo + i, _mm256_or_si256(lo, mask));
+    }
+    return i;
+}
+
+Q128_AVX2
+static size_t q128_neg_n_avx2(Seraph_Q128_Lanes dst, Seraph_Q128_Lanes x, size_t count) {
+    const __m256i zero = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256i xh = Q128_LOAD(x.hi + i), xl = Q128_LOAD(x.lo + i);
+
+        /* { ~hi, -lo }, plus one on hi when lo is zero */
+        __m256i lo_zero = _mm256_cmpeq_epi64(xl, zero);
+        __m256i hi = _mm256_sub_epi64(_mm256_xor_si256(xh, _mm256_set1_epi64x(-1)), lo_zero);
+        __m256i lo = _mm256_sub_epi64(zero, xl);
+        __m256i mask = q128_void_lanes(xh, xl);
+
+        Q128_STORE(dst.hi + i, _mm256_or_si256(hi, mask));
+        Q128_STORE(dst.lo + i, _mm256_or_si256(lo, mask));
+    }
+    return i;
+}
+
+Q128_AVX2
+static size_t q128_lt_n_avx2(Seraph_Q128_Lanes a, Seraph_Q128_Lanes b,
+                             Seraph_Vbit* out, size_t count) {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256i ah = Q128_LOAD(a.hi + i), al = Q128_LOAD(a.lo + i);
+        __m256i bh = Q128_LOAD(b.hi + i), bl = Q128_LOAD(b.lo + i);
+
+        __m256i lt = _mm256_or_si256(_mm256_cmpgt_epi64(bh, ah),
+                                     _mm256_and_si256(_mm256_cmpeq_epi64(ah, bh),
+                                                      q128_ult_lanes(al, bl)));
+        __m256i v = _mm256_or_si256(q128_void_lanes(ah, al), q128_void_lanes(bh, bl));
+
+        int lt_bits = _mm256_movemask_pd(_mm256_castsi256_pd(lt));
+        int void_bits = _mm256_movemask_pd(_mm256_castsi256_pd(v));
+        for (int k = 0; k < 4; k++) {
+            out[i + k] = (void_bits >> k & 1) ? SERAPH_VBIT_VOID
+                       : (Seraph_Vbit)(lt_bits >> k & 1);
+        }
+    }
+    return i;
+}
+
+Q128_AVX2
+static size_t q128_void_mask_n_avx2(Seraph_Q128_Lanes x, Seraph_Vbit* out, size_t count,
+                                    size_t* void_count) {
+    size_t voids = 0;
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        int bits = _mm256_movemask_pd(_mm256_castsi256_pd(
+            q128_void_lanes(Q128_LOAD(x.hi + i), Q128_LOAD(x.lo + i))));
+        for (int k = 0; k < 4; k++) {
+            out[i + k] = (Seraph_Vbit)(bits >> k & 1);
+        }
+        voids += (size_t)__builtin_popcount((unsigned)bits);
+    }
+    *void_count = voids;
+    return i;
+}
+
+#define Q128_BATCH_DISPATCH(kernel, ...) \
+    (seraph_vbit_get_impl() == SERAPH_VBIT_IMPL_AVX2 ? kernel##_avx2(__VA_ARGS__) : 0)
+#else
+#define Q128_BATCH_DISPATCH(kernel, ...) ((size_t)0)
+#endif /* Q128_X86_SIMD */
+
+void seraph_q128_add_n(Seraph_Q128_Lanes dst, Seraph_Q128_Lanes a,
+                       Seraph_Q128_Lanes b, size_t count) {
+    size_t i = Q128_BATCH_DISPATCH(q128_add_n, dst, a, b, count);
+    for (; i < count; i++) {
+        q128_lane_set(dst, i, seraph_q128_add(q128_lane(a, i), q128_lane(b, i)));
+    }
+}
+
+void seraph_q128_sub_n(Seraph_Q128_Lanes dst, Seraph_Q128_Lanes a,
+                       Seraph_Q128_Lanes b, size_t count) {
+    size_t i = Q128_BATCH_DISPATCH(q128_sub_n, dst, a, b, count);
+    for (; i < count; i++) {
+        q128_lane_set(dst, i, seraph_q128_sub(q128_lane(a, i), q128_lane(b, i)));
+    }
+}
+
+static void q128_mul_n_portable(Seraph_Q128_Lanes dst, Seraph_Q128_Lanes a,
+                                Seraph_Q128_Lanes b, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        q128_lane_set(dst, i, q128_mul_with(q128_lane(a, i), q128_lane(b, i),
+                                            q128_mul_mid_portable));
+    }
+}
+
+#ifdef Q128_X86_BMI2
+__attribute__((target("bmi2,adx")))
+static void q128_mul_n_bmi2(Seraph_Q128_Lanes dst, Seraph_Q128_Lanes a,
+                            Seraph_Q128_Lanes b, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        q128_lane_set(dst, i, q128_mul_with(q128_lane(a, i), q128_lane(b, i),
+                                            q128_mul_mid_bmi2));
+    }
+}
+#endif
+
+void seraph_q128_mul_n(Seraph_Q128_Lanes dst, Seraph_Q128_Lanes a,
+                       Seraph_Q128_Lanes b, size_t count) {
+#ifdef Q128_X86_BMI2
+    if (seraph_q128_get_impl() == SERAPH_Q128_IMPL_BMI2) {
+        q128_mul_n_bmi2(dst, a, b, count);
+        return;
+    }
+#endif
+    q128_mul_n_portable(dst, a, b, count);
+}
+
+void seraph_q128_neg_n(Seraph_Q128_Lanes dst, Seraph_Q128_Lanes x, size_t count) {
+    size_t i = Q128_BATCH_DISPATCH(q128_neg_n, dst, x, count);
+    for (; i < count; i++) {
+        q128_lane_set(dst, i, seraph_q128_neg(q128_lane(x, i)));
+    }
+}
+
+void seraph_q128_lt_n(Seraph_Q128_Lanes a, Seraph_Q128_Lanes b,
+                      Seraph_Vbit* out, size_t count) {
+    if (out == NULL) return;
+    size_t i = Q128_BATCH_DISPATCH(q128_lt_n, a, b, out, count);
+    for (; i < count; i++) {
+        out[i] = seraph_q128_lt(q128_lane(a, i), q128_lane(b, i));
+    }
+}
+
+size_t seraph_q128_void_mask_n(Seraph_Q128_Lanes x, Seraph_Vbit* out, size_t count) {
+    if (out == NULL) return 0;
+    size_t voids = 0;
+    size_t i = Q128_BATCH_DISPATCH(q128_void_mask_n, x, out, count, &voids);
+    for (; i < count; i++) {
+        bool is_void = seraph_q128_is_void(q128_lane(x, i));
+        out[i] = is_void ? SERAPH_VBIT_TRUE : SERAPH_VBIT_FALSE;
+        voids += is_void;
+    }
+    return voids;
+}
+
 /*============================================================================
  * Q128 Rounding
  *============================================================================*/
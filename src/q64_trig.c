@@ -5,7 +5,7 @@
  * MC26: SERAPH Performance Revolution - Pillar 2
  *
  * High-precision trigonometry using 256-entry lookup tables
- * with quadratic interpolation and BMI2 acceleration.
+ * with angle-addition refinement and BMI2 acceleration.
  */
 
 #include "seraph/q64_trig.h"
@@ -50,12 +50,24 @@ const Q64 Q64_TRIG_STEP = {
     .lo = 0x00C90FDAA22168C2ULL  /* (π/4) / 256 */
 };
 
+/* 4/π in 1.127 fixed point: angle · 4/π counts octants */
+#define Q64_4_OVER_PI_HI    0xA2F9836E4E441529ULL
+#define Q64_4_OVER_PI_LO    0xFC2757D1F534DDC0ULL
+
+/* π/4 as a 0.64 fraction (rounded) and as a 0.128 fraction */
+#define Q64_PI_4_FRAC       0xC90FDAA22168C235ULL
+#define Q64_PI_4_FRAC128_HI 0xC90FDAA22168C234ULL
+#define Q64_PI_4_FRAC128_LO 0xC4C6628B80DC1CD1ULL
+
+/* Octant fraction bits below the table index */
+#define Q64_TRIG_RESIDUAL_BITS  56
+
 /*============================================================================
  * Micro-Table (Generated at Init Time)
  *============================================================================*/
 
 /* The micro-table (initialized at runtime via q64_trig_init) */
-Q64_Trig_Entry q64_trig_table[Q64_TRIG_TABLE_SIZE];
+Q64_Trig_Entry q64_trig_table[Q64_TRIG_TABLE_SIZE + 1];
 
 static int q64_trig_initialized = 0;
 
@@ -152,10 +164,67 @@ Q64 q64_div(Q64 a, Q64 b) {
     return result_neg ? q64_neg(result) : result;
 }
 
+/*============================================================================
+ * Fraction Arithmetic
+ *
+ * The evaluator works on unsigned 0.64 fractions (value · 2^64); the
+ * table generator on 0.128 fractions. Products keep the high half.
+ *============================================================================*/
+
+static inline uint64_t frac64_mul(uint64_t a, uint64_t b) {
+    uint64_t hi;
+    seraph_mulx_u64(a, b, &hi);
+    return hi;
+}
+
+typedef struct {
+    uint64_t hi;
+    uint64_t lo;
+} Frac128;
+
+static Frac128 frac128_mul(Frac128 a, Frac128 b) {
+    uint64_t p[4];
+    seraph_mul128x128_full(a.lo, a.hi, b.lo, b.hi, p);
+    return (Frac128){ p[3], p[2] };
+}
+
+static Frac128 frac128_add(Frac128 a, Frac128 b) {
+    uint64_t lo = a.lo + b.lo;
+    return (Frac128){ a.hi + b.hi + (lo < a.lo), lo };
+}
+
+static Frac128 frac128_sub(Frac128 a, Frac128 b) {
+    return (Frac128){ a.hi - b.hi - (a.lo < b.lo), a.lo - b.lo };
+}
+
+/* Long division by a small integer, 32 bits at a time */
+static Frac128 frac128_div_small(Frac128 a, uint32_t n) {
+    uint32_t words[4] = {
+        (uint32_t)(a.hi >> 32), (uint32_t)a.hi,
+        (uint32_t)(a.lo >> 32), (uint32_t)a.lo
+    };
+    uint64_t rem = 0;
+    for (int i = 0; i < 4; i++) {
+        uint64_t cur = (rem << 32) | words[i];
+        words[i] = (uint32_t)(cur / n);
+        rem = cur % n;
+    }
+    return (Frac128){ ((uint64_t)words[0] << 32) | words[1],
+                      ((uint64_t)words[2] << 32) | words[3] };
+}
+
+/* Round a 0.128 fraction to Q64.64 */
+static Q64 frac128_round(Frac128 x) {
+    uint64_t lo = x.hi + (x.lo >> 63);
+    return (Q64){ .hi = (lo < x.hi), .lo = lo };
+}
+
 /*============================================================================
  * Table Initialization
  *
- * Uses CORDIC to generate high-precision sin/cos values.
+ * Entry i holds sin and cos of i·(π/4)/256 for i = 0..256, from Taylor
+ * series evaluated in 0.128 fractions and rounded, so each entry is
+ * within half an ulp of the true value.
  *============================================================================*/
 
 /* CORDIC angles: atan(2^-i) in Q64.64 format */
@@ -171,66 +240,55 @@ static const Q64 cordic_angles[64] = {
     /* ... more angles would go here ... */
 };
 
-/* CORDIC gain factor K = Π(1/sqrt(1 + 2^-2i)) ≈ 0.607252935 */
-static const Q64 cordic_gain = {
-    .hi = 0,
-    .lo = 0x9B74EDA8A2DEE5AFULL  /* K in Q64.64 */
-};
-
 /**
- * @brief CORDIC rotation for angle in first octant
+ * @brief sin(a) and 1 - cos(a) for a in [0, π/4] as 0.128 fractions
  */
-static void q64_cordic_sincos(Q64 angle, Q64* sin_out, Q64* cos_out) {
-    /* Start with (1, 0) and rotate by angle */
-    Q64 x = Q64_ONE;
-    Q64 y = Q64_ZERO;
-    Q64 z = angle;
-
-    /* CORDIC iterations */
-    for (int i = 0; i < 50; i++) {
-        Q64 x_shift = q64_shr(x, i);
-        Q64 y_shift = q64_shr(y, i);
-
-        int sign = (z.hi >= 0) ? 1 : -1;
-
-        if (sign > 0) {
-            Q64 new_x = q64_sub(x, y_shift);
-            Q64 new_y = q64_add(y, x_shift);
-            x = new_x;
-            y = new_y;
-            z = q64_sub(z, (i < 64) ? cordic_angles[i] : Q64_ZERO);
-        } else {
-            Q64 new_x = q64_add(x, y_shift);
-            Q64 new_y = q64_sub(y, x_shift);
-            x = new_x;
-            y = new_y;
-            z = q64_add(z, (i < 64) ? cordic_angles[i] : Q64_ZERO);
-        }
+static void frac128_sin_vers(Frac128 a, Frac128* sin_out, Frac128* vers_out) {
+    Frac128 a2 = frac128_mul(a, a);
+
+    /* sin a = a - a³/3! + a⁵/5! - ... */
+    Frac128 term = a, sum = a;
+    for (uint32_t k = 1; term.hi | term.lo; k++) {
+        term = frac128_div_small(frac128_mul(term, a2), (2 * k) * (2 * k + 1));
+        sum = (k & 1) ? frac128_sub(sum, term) : frac128_add(sum, term);
     }
-
-    /* Apply CORDIC gain correction */
-    *cos_out = q64_mul(x, cordic_gain);
-    *sin_out = q64_mul(y, cordic_gain);
+    *sin_out = sum;
+
+    /* 1 - cos a = a²/2! - a⁴/4! + ... */
+    term = frac128_div_small(a2, 2);
+    sum = term;
+    for (uint32_t k = 2; term.hi | term.lo; k++) {
+        term = frac128_div_small(frac128_mul(term, a2), (2 * k - 1) * (2 * k));
+        sum = (k & 1) ? frac128_add(sum, term) : frac128_sub(sum, term);
+    }
+    *vers_out = sum;
 }
 
 void q64_trig_init(void) {
     if (q64_trig_initialized) return;
 
-    /* Generate table entries for first octant [0, π/4] */
-    for (int i = 0; i < Q64_TRIG_TABLE_SIZE; i++) {
-        /* Angle = i * (π/4) / 256 */
-        Q64 angle = q64_mul(q64_from_i64(i), Q64_TRIG_STEP);
+    /* Generate table entries for first octant [0, π/4], both ends included */
+    for (int i = 0; i <= Q64_TRIG_TABLE_SIZE; i++) {
+        /* Angle = i * (π/4) / 256, exact to 2^-128 */
+        uint64_t p_hi, c_hi;
+        uint64_t p_lo = seraph_mulx_u64(Q64_PI_4_FRAC128_LO, (uint64_t)i, &c_hi);
+        uint64_t p_mid = seraph_mulx_u64(Q64_PI_4_FRAC128_HI, (uint64_t)i, &p_hi);
+        p_mid += c_hi;
+        p_hi += p_mid < c_hi;
+        Frac128 angle = { (p_hi << 56) | (p_mid >> 8), (p_mid << 56) | (p_lo >> 8) };
 
-        /* Compute sin/cos using CORDIC */
-        Q64 s, c;
-        q64_cordic_sincos(angle, &s, &c);
+        Frac128 s, v;
+        frac128_sin_vers(angle, &s, &v);
 
-        q64_trig_table[i].sin_val = s;
+        /* cos = 1 - vers; vers = 0 only at angle 0 */
+        Q64 c = (v.hi | v.lo) ? frac128_round(frac128_sub((Frac128){ 0, 0 }, v)) : Q64_ONE;
+
+        q64_trig_table[i].sin_val = frac128_round(s);
         q64_trig_table[i].cos_val = c;
 
         /* Derivative: d(sin)/dθ = cos, d(cos)/dθ = -sin */
         q64_trig_table[i].sin_deriv = c;
-        q64_trig_table[i].cos_deriv = q64_neg(s);
+        q64_trig_table[i].cos_deriv = q64_neg(q64_trig_table[i].sin_val);
     }
 
     q64_trig_initialized = 1;
@@ -238,33 +296,91 @@ void q64_trig_init(void) {
 
 /*============================================================================
  * Angle Reduction
+ *
+ * |angle| · 4/π as one 128 x 128 MULX product: bits 193..191 are the
+ * octant, the 64 bits below them the position within it. Odd octants
+ * are mirrored so the position always runs from the nearer axis; its top
+ * 8 bits (9 when a mirrored position is exactly 1) pick the table entry
+ * and the rest becomes the residual angle in radians.
  *============================================================================*/
 
+typedef struct {
+    uint32_t index;     /* Table entry, 0..256 */
+    uint32_t octant;    /* Octant of |angle|, 0..7 */
+    uint64_t residual;  /* Radians past the entry, 0.64, below one step */
+    uint64_t negative;  /* 1 if the angle was negative */
+} Q64_Reduced;
+
+static inline Q64_Reduced q64_reduce(Q64 angle) {
+    Q64_Reduced red;
+    uint64_t neg = (uint64_t)angle.hi >> 63;
+    uint64_t m = (uint64_t)0 - neg;
+
+    /* Magnitude as an unsigned 128-bit value */
+    uint64_t lo = (angle.lo ^ m) + neg;
+    uint64_t hi = ((uint64_t)angle.hi ^ m) + (neg & (angle.lo == 0));
+
+    uint64_t p[4];
+    seraph_mul128x128_full(lo, hi, Q64_4_OVER_PI_LO, Q64_4_OVER_PI_HI, p);
+    uint32_t octant = (uint32_t)(((p[3] & 3) << 1) | (p[2] >> 63));
+    uint64_t pos = (p[2] << 1) | (p[1] >> 63);
+
+    /* Mirror odd octants: 1 - pos, as a 65-bit value */
+    uint64_t odd = octant & 1;
+    uint64_t mirrored = (pos ^ ((uint64_t)0 - odd)) + odd;
+    uint64_t carry = odd & (pos == 0);
+
+    red.index = (uint32_t)((carry << 8) | (mirrored >> Q64_TRIG_RESIDUAL_BITS));
+    red.octant = octant;
+    red.residual = frac64_mul(mirrored & ((1ULL << Q64_TRIG_RESIDUAL_BITS) - 1),
+                              Q64_PI_4_FRAC);
+    red.negative = neg;
+    return red;
+}
+
 Q64 q64_reduce_to_octant(Q64 angle, int* octant) {
-    /* Normalize to [0, 2π) */
-    while (q64_cmp(angle, Q64_ZERO) < 0) {
-        angle = q64_add(angle, Q64_2PI);
-    }
-    while (q64_cmp(angle, Q64_2PI) >= 0) {
-        angle = q64_sub(angle, Q64_2PI);
-    }
+    Q64_Reduced red = q64_reduce(angle);
+    *octant = (int)red.octant;
 
-    /* Determine octant */
-    *octant = 0;
-    Q64 octant_size = Q64_PI_4;
+    /* index · step + residual, with step = (π/4)/256 */
+    if (red.index == Q64_TRIG_TABLE_SIZE) return Q64_PI_4;
+    uint64_t base = frac64_mul((uint64_t)red.index << Q64_TRIG_RESIDUAL_BITS, Q64_PI_4_FRAC);
+    return (Q64){ .hi = 0, .lo = base + red.residual };
+}
 
-    while (q64_cmp(angle, octant_size) >= 0 && *octant < 7) {
-        angle = q64_sub(angle, octant_size);
-        (*octant)++;
-    }
+/*============================================================================
+ * Evaluation
+ *
+ * sin(a + r) = sin a + cos a · sin r - sin a · (1 - cos r)
+ * cos(a + r) = cos a - sin a · sin r - cos a · (1 - cos r)
+ *
+ * with a a table angle and r below one step (~0.0031), where three Taylor
+ * terms each for sin r and 1 - cos r reach 2^-64. Every value is a 0.64
+ * fraction except cos a, which is exactly 1 at entry 0.
+ *============================================================================*/
 
-    /* Reduce to first octant using symmetry */
-    if (*octant & 1) {
-        /* Odd octant: reflect */
-        angle = q64_sub(Q64_PI_4, angle);
-    }
+/* cos a · x with cos a in [0, 1] as Q64 */
+static inline uint64_t q64_mul_cos(Q64 c, uint64_t x) {
+    return frac64_mul(c.lo, x) + (x & ((uint64_t)0 - (uint64_t)c.hi));
+}
 
-    return angle;
+static inline void q64_eval(const Q64_Trig_Entry* table, uint32_t index, uint64_t r,
+                            Q64* sin_out, Q64* cos_out) {
+    const Q64_Trig_Entry* e = &table[index];
+    uint64_t s = e->sin_val.lo;
+    Q64 c = e->cos_val;
+
+    uint64_t r2 = frac64_mul(r, r);
+    uint64_t r3 = frac64_mul(r2, r);
+    uint64_t r4 = frac64_mul(r2, r2);
+    uint64_t r5 = frac64_mul(r4, r);
+    uint64_t r6 = frac64_mul(r4, r2);
+    uint64_t sin_r = r - r3 / 6 + r5 / 120;
+    uint64_t vers_r = r2 / 2 - r4 / 24 + r6 / 720;
+
+    *sin_out = (Q64){ .hi = 0, .lo = s + q64_mul_cos(c, sin_r) - frac64_mul(s, vers_r) };
+    uint64_t dc = frac64_mul(s, sin_r) + q64_mul_cos(c, vers_r);
+    *cos_out = (Q64){ .hi = c.hi - (int64_t)(c.lo < dc), .lo = c.lo - dc };
 }
 
 /*============================================================================
@@ -273,35 +389,13 @@ Q64 q64_reduce_to_octant(Q64 angle, int* octant) {
 
 void q64_interpolate(const Q64_Trig_Entry* table, int index,
                       Q64 frac, Q64* sin_out, Q64* cos_out) {
+    if (!q64_trig_initialized) q64_trig_init();
     if (index < 0) index = 0;
-    if (index >= Q64_TRIG_TABLE_SIZE - 1) index = Q64_TRIG_TABLE_SIZE - 2;
-
-    const Q64_Trig_Entry* e0 = &table[index];
-    const Q64_Trig_Entry* e1 = &table[index + 1];
+    if (index > Q64_TRIG_TABLE_SIZE) index = Q64_TRIG_TABLE_SIZE;
 
-    /* Linear interpolation with derivative correction (quadratic) */
-    /* f(x + t) ≈ f(x) + t·f'(x) + t²·(f(x+1) - f(x) - f'(x))/2 */
-
-    Q64 t = frac;
-    Q64 t2 = q64_mul(t, t);
-
-    /* Sin interpolation */
-    Q64 delta_sin = q64_sub(e1->sin_val, e0->sin_val);
-    Q64 correction_sin = q64_sub(delta_sin, e0->sin_deriv);
-    correction_sin = q64_mul(correction_sin, t2);
-    correction_sin = q64_shr(correction_sin, 1);  /* Divide by 2 */
-
-    *sin_out = q64_add(e0->sin_val, q64_mul(t, e0->sin_deriv));
-    *sin_out = q64_add(*sin_out, correction_sin);
-
-    /* Cos interpolation */
-    Q64 delta_cos = q64_sub(e1->cos_val, e0->cos_val);
-    Q64 correction_cos = q64_sub(delta_cos, e0->cos_deriv);
-    correction_cos = q64_mul(correction_cos, t2);
-    correction_cos = q64_shr(correction_cos, 1);
-
-    *cos_out = q64_add(e0->cos_val, q64_mul(t, e0->cos_deriv));
-    *cos_out = q64_add(*cos_out, correction_cos);
+    /* frac of a step, in radians */
+    uint64_t r = frac64_mul(frac.lo, Q64_TRIG_STEP.lo);
+    q64_eval(table, (uint32_t)index, r, sin_out, cos_out);
 }
 
 /*============================================================================
@@ -314,22 +408,10 @@ void q64_sincos(Q64 angle, Q64* sin_out, Q64* cos_out) {
     }
 
     /* Reduce to first octant */
-    int octant;
-    Q64 reduced = q64_reduce_to_octant(angle, &octant);
+    Q64_Reduced red = q64_reduce(angle);
 
-    /* Compute table index and fractional part */
-    /* index = reduced / step */
-    Q64 idx_q = q64_div(reduced, Q64_TRIG_STEP);
-    int index = (int)idx_q.hi;
-    if (index >= Q64_TRIG_TABLE_SIZE - 1) index = Q64_TRIG_TABLE_SIZE - 2;
-
-    /* Fractional part for interpolation */
-    Q64 frac = q64_sub(reduced, q64_mul(q64_from_i64(index), Q64_TRIG_STEP));
-    frac = q64_div(frac, Q64_TRIG_STEP);  /* Normalize to [0, 1) */
-
-    /* Interpolate */
     Q64 s, c;
-    q64_interpolate(q64_trig_table, index, frac, &s, &c);
+    q64_eval(q64_trig_table, red.index, red.residual, &s, &c);
 
     /* Apply octant transformations */
     /* Octant mapping:
@@ -342,7 +424,7 @@ void q64_sincos(Q64 angle, Q64* sin_out, Q64* cos_out) {
      *   6: -cos, sin
      *   7: -sin, cos
      */
-    switch (octant) {
+    switch (red.octant) {
         case 0:
             *sin_out = s;
             *cos_out = c;
@@ -371,11 +453,67 @@ void q64_sincos(Q64 angle, Q64* sin_out, Q64* cos_out) {
             *sin_out = q64_neg(c);
             *cos_out = s;
             break;
-        case 7:
+        default:
             *sin_out = q64_neg(s);
             *cos_out = c;
             break;
     }
+
+    /* sin is odd, cos even */
+    if (red.negative) {
+        *sin_out = q64_neg(*sin_out);
+    }
+}
+
+/*============================================================================
+ * Batched sin/cos
+ *============================================================================*/
+
+/* Angles reduced together before any is evaluated */
+#define Q64_SINCOS_BATCH 8
+
+/* mask ? a : b */
+static inline Q64 q64_select(uint64_t mask, Q64 a, Q64 b) {
+    return (Q64){ .hi = (int64_t)(((uint64_t)a.hi & mask) | ((uint64_t)b.hi & ~mask)),
+                  .lo = (a.lo & mask) | (b.lo & ~mask) };
+}
+
+/* flag ? -x : x, flag 0 or 1 */
+static inline Q64 q64_neg_if(Q64 x, uint64_t flag) {
+    uint64_t m = (uint64_t)0 - flag;
+    uint64_t lo = (x.lo ^ m) + flag;
+    return (Q64){ .hi = (int64_t)(((uint64_t)x.hi ^ m) + (flag & (x.lo == 0))), .lo = lo };
+}
+
+void q64_sincos_n(const Q64* angles, Q64* sin_out, Q64* cos_out, size_t count) {
+    if (angles == NULL || sin_out == NULL || cos_out == NULL) return;
+    if (!q64_trig_initialized) {
+        q64_trig_init();
+    }
+
+    Q64_Reduced red[Q64_SINCOS_BATCH];
+    for (size_t base = 0; base < count; base += Q64_SINCOS_BATCH) {
+        size_t n = count - base < Q64_SINCOS_BATCH ? count - base : Q64_SINCOS_BATCH;
+
+        /* All reads happen here, so outputs may alias the inputs */
+        for (size_t i = 0; i < n; i++) {
+            red[i] = q64_reduce(angles[base + i]);
+        }
+
+        for (size_t i = 0; i < n; i++) {
+            Q64 s, c;
+            q64_eval(q64_trig_table, red[i].index, red[i].residual, &s, &c);
+
+            /* Same mapping as the switch in q64_sincos */
+            uint64_t o = red[i].octant;
+            uint64_t swap = (uint64_t)0 - (((o + 1) >> 1) & 1);
+            uint64_t neg_sin = (o >> 2) ^ red[i].negative;
+            uint64_t neg_cos = ((o + 2) >> 2) & 1;
+
+            sin_out[base + i] = q64_neg_if(q64_select(swap, c, s), neg_sin);
+            cos_out[base + i] = q64_neg_if(q64_select(swap, s, c), neg_cos);
+        }
+    }
 }
 
 Q64 q64_sin(Q64 angle) {
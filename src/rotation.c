@@ -9,8 +9,15 @@
 
 #include "seraph/rotation.h"
 #include "seraph/bmi2_intrin.h"
+#include "seraph/vbit.h"
 #include <string.h>
 
+/* AVX2 kernels follow the VBIT variant; the kernel build keeps to GPRs */
+#if !defined(SERAPH_KERNEL) && defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define ROTATION_X86_SIMD 1
+#include <immintrin.h>
+#endif
+
 /*============================================================================
  * Q32.32 Trig (Simplified - Uses Q16 with scaling)
  *
@@ -145,6 +152,52 @@ void seraph_oscillator16_set_frequency(Seraph_Oscillator16* osc,
     seraph_rotation16_set_velocity(&osc->state, (Q16)omega);
 }
 
+/*============================================================================
+ * AVX2 Q16 Arithmetic
+ *
+ * Eight Q16 values per vector. q16_mul is (a·b) >> 16 on the 64-bit
+ * product; the even and odd lanes are multiplied separately and their
+ * bits 16..47 recombined, so every lane matches the scalar result
+ * exactly.
+ *============================================================================*/
+
+#ifdef ROTATION_X86_SIMD
+#define ROTATION_AVX2 __attribute__((target("avx2")))
+
+#define ROTATION_LOAD(p)     _mm256_loadu_si256((const __m256i*)(const void*)(p))
+#define ROTATION_STORE(p, v) _mm256_storeu_si256((__m256i*)(void*)(p), (v))
+
+ROTATION_AVX2 static inline __m256i rotation_q16_mul8(__m256i a, __m256i b) {
+    __m256i even = _mm256_mul_epi32(a, b);
+    __m256i odd = _mm256_mul_epi32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+    return _mm256_blend_epi32(_mm256_srli_epi64(even, 16), _mm256_slli_epi64(odd, 16), 0xAA);
+}
+
+/* Four interleaved (x, y) points per vector */
+ROTATION_AVX2
+static size_t rotation16_apply_batch_avx2(Q16 cos_theta, Q16 sin_theta,
+                                          Q16* points, size_t count) {
+    const __m256i c = _mm256_set1_epi32(cos_theta);
+    const __m256i s = _mm256_set1_epi32(sin_theta);
+    const __m256i sign = _mm256_setr_epi32(-1, 1, -1, 1, -1, 1, -1, 1);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256i xy = ROTATION_LOAD(points + 2 * i);
+        __m256i yx = _mm256_shuffle_epi32(xy, 0xB1);
+        /* x' = x·c - y·s, y' = y·c + x·s */
+        __m256i r = _mm256_add_epi32(rotation_q16_mul8(xy, c),
+                                     _mm256_sign_epi32(rotation_q16_mul8(yx, s), sign));
+        ROTATION_STORE(points + 2 * i, r);
+    }
+    return i;
+}
+
+#define ROTATION_DISPATCH(kernel, ...) \
+    (seraph_vbit_get_impl() == SERAPH_VBIT_IMPL_AVX2 ? kernel##_avx2(__VA_ARGS__) : 0)
+#else
+#define ROTATION_DISPATCH(kernel, ...) ((size_t)0)
+#endif /* ROTATION_X86_SIMD */
+
 /*============================================================================
  * Batch Rotation
  *============================================================================*/
@@ -157,7 +210,9 @@ void seraph_rotation16_apply_batch(const Seraph_Rotation16* rot,
     Q16 sin_theta = rot->sin_theta;
 
     /* Process pairs of (x, y) */
-    for (size_t i = 0; i < count; i++) {
+    size_t i = ROTATION_DISPATCH(rotation16_apply_batch, cos_theta, sin_theta,
+                                 points, count);
+    for (; i < count; i++) {
         Q16 x = points[i * 2];
         Q16 y = points[i * 2 + 1];
 
@@ -198,3 +253,236 @@ Q16 seraph_oscillator_bank_sample(Seraph_Oscillator16* oscs, size_t count) {
 
     return (Q16)sum;
 }
+
+/*============================================================================
+ * SoA Oscillator Bank
+ *
+ * Frames are produced in blocks of OSC_BANK_BLOCK; within a block each
+ * group of eight oscillators is loaded into registers once, stepped
+ * through every frame and stored back. Oscillators past the last whole
+ * group (or all of them without AVX2) take the scalar path, which does
+ * the same arithmetic. Blocks never straddle a renormalization point, so
+ * the output does not depend on how callers split their requests.
+ *============================================================================*/
+
+#define OSC_BANK_BLOCK 64
+
+typedef enum {
+    OSC_BANK_MIX,       /* Accumulate into acc[f] */
+    OSC_BANK_RENDER     /* Store to out[f · count + i] */
+} Osc_Bank_Mode;
+
+static Q16 osc_bank_omega(uint32_t frequency, uint32_t sample_rate) {
+    /* Same angular velocity as seraph_oscillator16_init */
+    return (Q16)(((int64_t)Q16_2PI * frequency) / sample_rate);
+}
+
+static void osc_bank_scalar(Seraph_Oscillator_Bank16* bank, size_t first,
+                            Osc_Bank_Mode mode, int64_t* acc, Q16* out,
+                            size_t frames) {
+    /* Frame-major so consecutive oscillators give independent chains */
+    for (size_t f = 0; f < frames; f++) {
+        int64_t sum = 0;
+        for (size_t i = first; i < bank->count; i++) {
+            Q16 s = bank->sin_theta[i], c = bank->cos_theta[i];
+            Q16 sd = bank->sin_delta[i], cd = bank->cos_delta[i];
+            Q16 sample = q16_mul(s, bank->amplitude[i]);
+            if (mode == OSC_BANK_MIX) {
+                sum += sample;
+            } else {
+                out[f * bank->count + i] = sample;
+            }
+            bank->sin_theta[i] = q16_mul(s, cd) + q16_mul(c, sd);
+            bank->cos_theta[i] = q16_mul(c, cd) - q16_mul(s, sd);
+        }
+        if (mode == OSC_BANK_MIX) {
+            acc[f] += sum;
+        }
+    }
+}
+
+static void osc_bank_normalize_scalar(Seraph_Oscillator_Bank16* bank, size_t first) {
+    for (size_t i = first; i < bank->count; i++) {
+        Q16 s = bank->sin_theta[i], c = bank->cos_theta[i];
+        Q16 scale = (Q16_FROM_INT(3) - (q16_mul(s, s) + q16_mul(c, c))) >> 1;
+        bank->sin_theta[i] = q16_mul(s, scale);
+        bank->cos_theta[i] = q16_mul(c, scale);
+    }
+}
+
+#ifdef ROTATION_X86_SIMD
+/* Steps OSC_BANK_LANES groups of eight side by side to hide multiply latency */
+#define OSC_BANK_LANES 4
+
+ROTATION_AVX2
+static void osc_bank_groups_avx2(Seraph_Oscillator_Bank16* bank, size_t g, size_t lanes,
+                                 Osc_Bank_Mode mode, __m256i* sums, Q16* out,
+                                 size_t frames) {
+    __m256i s[OSC_BANK_LANES], c[OSC_BANK_LANES], sd[OSC_BANK_LANES];
+    __m256i cd[OSC_BANK_LANES], amp[OSC_BANK_LANES];
+    for (size_t l = 0; l < lanes; l++) {
+        s[l] = ROTATION_LOAD(bank->sin_theta + g + 8 * l);
+        c[l] = ROTATION_LOAD(bank->cos_theta + g + 8 * l);
+        sd[l] = ROTATION_LOAD(bank->sin_delta + g + 8 * l);
+        cd[l] = ROTATION_LOAD(bank->cos_delta + g + 8 * l);
+        amp[l] = ROTATION_LOAD(bank->amplitude + g + 8 * l);
+    }
+    for (size_t f = 0; f < frames; f++) {
+        __m256i mixed = _mm256_setzero_si256();
+        for (size_t l = 0; l < lanes; l++) {
+            __m256i sample = rotation_q16_mul8(s[l], amp[l]);
+            if (mode == OSC_BANK_MIX) {
+                /* Samples may be full-range Q16: widen before summing */
+                mixed = _mm256_add_epi64(mixed,
+                    _mm256_cvtepi32_epi64(_mm256_castsi256_si128(sample)));
+                mixed = _mm256_add_epi64(mixed,
+                    _mm256_cvtepi32_epi64(_mm256_extracti128_si256(sample, 1)));
+            } else {
+                ROTATION_STORE(out + f * bank->count + g + 8 * l, sample);
+            }
+            __m256i ns = _mm256_add_epi32(rotation_q16_mul8(s[l], cd[l]),
+                                          rotation_q16_mul8(c[l], sd[l]));
+            c[l] = _mm256_sub_epi32(rotation_q16_mul8(c[l], cd[l]),
+                                    rotation_q16_mul8(s[l], sd[l]));
+            s[l] = ns;
+        }
+        if (mode == OSC_BANK_MIX) {
+            sums[f] = _mm256_add_epi64(sums[f], mixed);
+        }
+    }
+    for (size_t l = 0; l < lanes; l++) {
+        ROTATION_STORE(bank->sin_theta + g + 8 * l, s[l]);
+        ROTATION_STORE(bank->cos_theta + g + 8 * l, c[l]);
+    }
+}
+
+ROTATION_AVX2
+static size_t osc_bank_avx2(Seraph_Oscillator_Bank16* bank, Osc_Bank_Mode mode,
+                            int64_t* acc, Q16* out, size_t frames) {
+    __m256i sums[OSC_BANK_BLOCK];
+    size_t groups = bank->count / 8 * 8;
+    if (mode == OSC_BANK_MIX) {
+        memset(sums, 0, sizeof(sums[0]) * frames);
+    }
+
+    size_t g = 0;
+    for (; g + 8 * OSC_BANK_LANES <= groups; g += 8 * OSC_BANK_LANES) {
+        osc_bank_groups_avx2(bank, g, OSC_BANK_LANES, mode, sums, out, frames);
+    }
+    if (g < groups) {
+        osc_bank_groups_avx2(bank, g, (groups - g) / 8, mode, sums, out, frames);
+    }
+
+    if (mode == OSC_BANK_MIX && groups > 0) {
+        for (size_t f = 0; f < frames; f++) {
+            int64_t lanes[4];
+            ROTATION_STORE(lanes, sums[f]);
+            acc[f] += lanes[0] + lanes[1] + lanes[2] + lanes[3];
+        }
+    }
+    return groups;
+}
+
+ROTATION_AVX2
+static size_t osc_bank_normalize_avx2(Seraph_Oscillator_Bank16* bank) {
+    const __m256i three = _mm256_set1_epi32(Q16_FROM_INT(3));
+    size_t groups = bank->count / 8 * 8;
+    for (size_t g = 0; g < groups; g += 8) {
+        __m256i s = ROTATION_LOAD(bank->sin_theta + g), c = ROTATION_LOAD(bank->cos_theta + g);
+        __m256i mag_sq = _mm256_add_epi32(rotation_q16_mul8(s, s), rotation_q16_mul8(c, c));
+        __m256i scale = _mm256_srai_epi32(_mm256_sub_epi32(three, mag_sq), 1);
+        ROTATION_STORE(bank->sin_theta + g, rotation_q16_mul8(s, scale));
+        ROTATION_STORE(bank->cos_theta + g, rotation_q16_mul8(c, scale));
+    }
+    return groups;
+}
+#endif /* ROTATION_X86_SIMD */
+
+void seraph_oscillator_bank16_normalize(Seraph_Oscillator_Bank16* bank) {
+    if (bank == NULL) return;
+    size_t i = ROTATION_DISPATCH(osc_bank_normalize, bank);
+    osc_bank_normalize_scalar(bank, i);
+    bank->since_renorm = 0;
+}
+
+static void osc_bank_run(Seraph_Oscillator_Bank16* bank, Osc_Bank_Mode mode,
+                         Q16* out, size_t frames) {
+    int64_t acc[OSC_BANK_BLOCK];
+
+    while (frames > 0) {
+        size_t block = SERAPH_OSC_BANK_RENORM_INTERVAL - bank->since_renorm;
+        if (block > OSC_BANK_BLOCK) block = OSC_BANK_BLOCK;
+        if (block > frames) block = frames;
+
+        if (mode == OSC_BANK_MIX) {
+            memset(acc, 0, sizeof(acc[0]) * block);
+        }
+        size_t i = ROTATION_DISPATCH(osc_bank, bank, mode, acc, out, block);
+        osc_bank_scalar(bank, i, mode, acc, out, block);
+
+        if (mode == OSC_BANK_MIX) {
+            for (size_t f = 0; f < block; f++) {
+                int64_t v = acc[f];
+                if (v > 0x7FFFFFFF) v = 0x7FFFFFFF;
+                if (v < -0x7FFFFFFF) v = -0x7FFFFFFF;
+                out[f] = (Q16)v;
+            }
+            out += block;
+        } else {
+            out += block * bank->count;
+        }
+        frames -= block;
+
+        bank->since_renorm += (uint32_t)block;
+        if (bank->since_renorm == SERAPH_OSC_BANK_RENORM_INTERVAL) {
+            seraph_oscillator_bank16_normalize(bank);
+        }
+    }
+}
+
+bool seraph_oscillator_bank16_init(Seraph_Oscillator_Bank16* bank, Q16* storage,
+                                   size_t count, const uint32_t* frequencies,
+                                   uint32_t sample_rate, Q16 amplitude) {
+    if (bank == NULL || storage == NULL || frequencies == NULL || sample_rate == 0) {
+        return false;
+    }
+
+    bank->sin_theta = storage;
+    bank->cos_theta = storage + count;
+    bank->sin_delta = storage + 2 * count;
+    bank->cos_delta = storage + 3 * count;
+    bank->amplitude = storage + 4 * count;
+    bank->count = count;
+    bank->sample_rate = sample_rate;
+    bank->since_renorm = 0;
+
+    Q16 s0, c0;
+    q16_sincos(0, &s0, &c0);
+    for (size_t i = 0; i < count; i++) {
+        bank->sin_theta[i] = s0;
+        bank->cos_theta[i] = c0;
+        q16_sincos(osc_bank_omega(frequencies[i], sample_rate),
+                   &bank->sin_delta[i], &bank->cos_delta[i]);
+        bank->amplitude[i] = amplitude;
+    }
+    return true;
+}
+
+void seraph_oscillator_bank16_set_frequency(Seraph_Oscillator_Bank16* bank,
+                                            size_t index, uint32_t frequency) {
+    if (bank == NULL || index >= bank->count) return;
+    q16_sincos(osc_bank_omega(frequency, bank->sample_rate),
+               &bank->sin_delta[index], &bank->cos_delta[index]);
+}
+
+void seraph_oscillator_bank16_mix(Seraph_Oscillator_Bank16* bank,
+                                  Q16* out, size_t frames) {
+    if (bank == NULL || out == NULL) return;
+    osc_bank_run(bank, OSC_BANK_MIX, out, frames);
+}
+
+void seraph_oscillator_bank16_render(Seraph_Oscillator_Bank16* bank,
+                                     Q16* out, size_t frames) {
+    if (bank == NULL || out == NULL) return;
+    osc_bank_run(bank, OSC_BANK_RENDER, out, frames);
+}
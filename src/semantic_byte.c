@@ -5,6 +5,179 @@
 
 #include "seraph/semantic_byte.h"
 
+/*
+ * The array kernels treat Seraph_SemanticByte as a 16-bit lane with the
+ * mask in the low byte and the value in the high byte, 16 per AVX2 vector
+ * and 8 per SSE vector. They follow seraph_vbit_get_impl(), return how
+ * many elements they consumed, and leave the tail to the scalar loop.
+ */
+#if !defined(SERAPH_KERNEL) && defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define SBYTE_X86_SIMD 1
+#include <immintrin.h>
+#endif
+
+_Static_assert(sizeof(Seraph_SemanticByte) == 2, "semantic byte must be two bytes");
+
+#ifdef SBYTE_X86_SIMD
+#define SBYTE_DISPATCH(kernel, ...) \
+    (seraph_vbit_get_impl() == SERAPH_VBIT_IMPL_AVX2  ? kernel##_avx2(__VA_ARGS__) : \
+     seraph_vbit_get_impl() == SERAPH_VBIT_IMPL_SSE42 ? kernel##_sse42(__VA_ARGS__) : 0)
+
+#define SBYTE_SSE  __attribute__((target("sse4.2,popcnt")))
+#define SBYTE_AVX2 __attribute__((target("avx2,popcnt")))
+
+/*============================================================================
+ * SSE4.2 Kernels (8 semantic bytes per vector)
+ *============================================================================*/
+
+/* Binary operation: mask = a.mask & b.mask, value = op(a.value, b.value) & mask */
+#define SBYTE_SSE_BINARY(name, value_op)                                        \
+SBYTE_SSE                                                                       \
+static size_t name##_sse42(const Seraph_SemanticByte* a,                        \
+                           const Seraph_SemanticByte* b,                        \
+                           Seraph_SemanticByte* out, size_t count) {            \
+    const __m128i low = _mm_set1_epi16(0x00FF);                                 \
+    size_t i = 0;                                                               \
+    for (; i + 8 <= count; i += 8) {                                            \
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));                   \
+        __m128i y = _mm_loadu_si128((const __m128i*)(b + i));                   \
+        __m128i m = _mm_and_si128(x, y);                                        \
+        __m128i v = _mm_and_si128(value_op(x, y), _mm_slli_epi16(m, 8));        \
+        _mm_storeu_si128((__m128i*)(out + i), _mm_or_si128(_mm_and_si128(m, low), v)); \
+    }                                                                           \
+    return i;                                                                   \
+}
+
+SBYTE_SSE_BINARY(sbyte_and, _mm_and_si128)
+SBYTE_SSE_BINARY(sbyte_or,  _mm_or_si128)
+SBYTE_SSE_BINARY(sbyte_xor, _mm_xor_si128)
+
+SBYTE_SSE
+static size_t sbyte_not_sse42(const Seraph_SemanticByte* arr, Seraph_SemanticByte* out,
+                              size_t count) {
+    const __m128i low = _mm_set1_epi16(0x00FF);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(arr + i));
+        __m128i v = _mm_andnot_si128(x, _mm_slli_epi16(x, 8));
+        _mm_storeu_si128((__m128i*)(out + i), _mm_or_si128(_mm_and_si128(x, low), v));
+    }
+    return i;
+}
+
+/* Two movemask bits per element whose mask byte equals want */
+SBYTE_SSE
+static size_t sbyte_count_mask_sse42(const Seraph_SemanticByte* arr, size_t count,
+                                     uint16_t want, size_t* matches) {
+    const __m128i low = _mm_set1_epi16(0x00FF);
+    const __m128i vwant = _mm_set1_epi16((short)want);
+    size_t bits = 0;
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m128i x = _mm_and_si128(_mm_loadu_si128((const __m128i*)(arr + i)), low);
+        bits += (size_t)__builtin_popcount((unsigned)_mm_movemask_epi8(_mm_cmpeq_epi16(x, vwant)));
+    }
+    *matches += bits / 2;
+    return i;
+}
+
+SBYTE_SSE
+static size_t sbyte_extract_valid_sse42(const Seraph_SemanticByte* arr, size_t count,
+                                        uint8_t* out, size_t out_size, size_t* extracted) {
+    const __m128i low = _mm_set1_epi16(0x00FF);
+    size_t n = *extracted;
+    size_t i = 0;
+    for (; i + 8 <= count && n + 8 <= out_size; i += 8) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(arr + i));
+        unsigned m = (unsigned)_mm_movemask_epi8(
+            _mm_cmpeq_epi16(_mm_and_si128(x, low), low)) & 0x5555u;
+        while (m) {
+            out[n++] = arr[i + (size_t)__builtin_ctz(m) / 2].value;
+            m &= m - 1;
+        }
+    }
+    *extracted = n;
+    return i;
+}
+
+/*============================================================================
+ * AVX2 Kernels (16 semantic bytes per vector)
+ *============================================================================*/
+
+#define SBYTE_AVX2_BINARY(name, value_op)                                       \
+SBYTE_AVX2                                                                      \
+static size_t name##_avx2(const Seraph_SemanticByte* a,                         \
+                          const Seraph_SemanticByte* b,                         \
+                          Seraph_SemanticByte* out, size_t count) {             \
+    const __m256i low = _mm256_set1_epi16(0x00FF);                              \
+    size_t i = 0;                                                               \
+    for (; i + 16 <= count; i += 16) {                                          \
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));                \
+        __m256i y = _mm256_loadu_si256((const __m256i*)(b + i));                \
+        __m256i m = _mm256_and_si256(x, y);                                     \
+        __m256i v = _mm256_and_si256(value_op(x, y), _mm256_slli_epi16(m, 8));  \
+        _mm256_storeu_si256((__m256i*)(out + i),                                \
+                            _mm256_or_si256(_mm256_and_si256(m, low), v));      \
+    }                                                                           \
+    return i;                                                                   \
+}
+
+SBYTE_AVX2_BINARY(sbyte_and, _mm256_and_si256)
+SBYTE_AVX2_BINARY(sbyte_or,  _mm256_or_si256)
+SBYTE_AVX2_BINARY(sbyte_xor, _mm256_xor_si256)
+
+SBYTE_AVX2
+static size_t sbyte_not_avx2(const Seraph_SemanticByte* arr, Seraph_SemanticByte* out,
+                             size_t count) {
+    const __m256i low = _mm256_set1_epi16(0x00FF);
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(arr + i));
+        __m256i v = _mm256_andnot_si256(x, _mm256_slli_epi16(x, 8));
+        _mm256_storeu_si256((__m256i*)(out + i), _mm256_or_si256(_mm256_and_si256(x, low), v));
+    }
+    return i;
+}
+
+SBYTE_AVX2
+static size_t sbyte_count_mask_avx2(const Seraph_SemanticByte* arr, size_t count,
+                                    uint16_t want, size_t* matches) {
+    const __m256i low = _mm256_set1_epi16(0x00FF);
+    const __m256i vwant = _mm256_set1_epi16((short)want);
+    size_t bits = 0;
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m256i x = _mm256_and_si256(_mm256_loadu_si256((const __m256i*)(arr + i)), low);
+        bits += (size_t)__builtin_popcount(
+            (unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi16(x, vwant)));
+    }
+    *matches += bits / 2;
+    return i;
+}
+
+SBYTE_AVX2
+static size_t sbyte_extract_valid_avx2(const Seraph_SemanticByte* arr, size_t count,
+                                       uint8_t* out, size_t out_size, size_t* extracted) {
+    const __m256i low = _mm256_set1_epi16(0x00FF);
+    size_t n = *extracted;
+    size_t i = 0;
+    for (; i + 16 <= count && n + 16 <= out_size; i += 16) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(arr + i));
+        unsigned m = (unsigned)_mm256_movemask_epi8(
+            _mm256_cmpeq_epi16(_mm256_and_si256(x, low), low)) & 0x55555555u;
+        while (m) {
+            out[n++] = arr[i + (size_t)__builtin_ctz(m) / 2].value;
+            m &= m - 1;
+        }
+    }
+    *extracted = n;
+    return i;
+}
+
+#else
+#define SBYTE_DISPATCH(kernel, ...) ((size_t)0)
+#endif /* SBYTE_X86_SIMD */
+
 Seraph_SemanticByte seraph_sbyte_from_vbits(const Seraph_Vbit bits[8]) {
     uint8_t mask = 0;
     uint8_t value = 0;
@@ -81,7 +254,8 @@ size_t seraph_sbyte_count_valid(const Seraph_SemanticByte* arr, size_t count) {
     if (!arr || count == 0) return 0;
 
     size_t valid_count = 0;
-    for (size_t i = 0; i < count; i++) {
+    size_t i = SBYTE_DISPATCH(sbyte_count_mask, arr, count, 0x00FF, &valid_count);
+    for (; i < count; i++) {
         if (seraph_sbyte_is_valid(arr[i])) {
             valid_count++;
         }
@@ -96,7 +270,8 @@ size_t seraph_sbyte_count_void(const Seraph_SemanticByte* arr, size_t count) {
     if (!arr || count == 0) return 0;
 
     size_t void_count = 0;
-    for (size_t i = 0; i < count; i++) {
+    size_t i = SBYTE_DISPATCH(sbyte_count_mask, arr, count, 0x0000, &void_count);
+    for (; i < count; i++) {
         if (seraph_sbyte_is_void(arr[i])) {
             void_count++;
         }
@@ -113,7 +288,8 @@ size_t seraph_sbyte_extract_valid(const Seraph_SemanticByte* arr, size_t count,
     if (!arr || !out || count == 0 || out_size == 0) return 0;
 
     size_t extracted = 0;
-    for (size_t i = 0; i < count && extracted < out_size; i++) {
+    size_t i = SBYTE_DISPATCH(sbyte_extract_valid, arr, count, out, out_size, &extracted);
+    for (; i < count && extracted < out_size; i++) {
         if (seraph_sbyte_is_valid(arr[i])) {
             out[extracted++] = arr[i].value;
         }
@@ -156,7 +332,8 @@ void seraph_sbyte_and_array(const Seraph_SemanticByte* a,
                             Seraph_SemanticByte* out, size_t count) {
     if (!a || !b || !out || count == 0) return;
 
-    for (size_t i = 0; i < count; i++) {
+    size_t i = SBYTE_DISPATCH(sbyte_and, a, b, out, count);
+    for (; i < count; i++) {
         out[i] = seraph_sbyte_and(a[i], b[i]);
     }
 }
@@ -169,7 +346,8 @@ void seraph_sbyte_or_array(const Seraph_SemanticByte* a,
                            Seraph_SemanticByte* out, size_t count) {
     if (!a || !b || !out || count == 0) return;
 
-    for (size_t i = 0; i < count; i++) {
+    size_t i = SBYTE_DISPATCH(sbyte_or, a, b, out, count);
+    for (; i < count; i++) {
         out[i] = seraph_sbyte_or(a[i], b[i]);
     }
 }
@@ -182,7 +360,8 @@ void seraph_sbyte_xor_array(const Seraph_SemanticByte* a,
                             Seraph_SemanticByte* out, size_t count) {
     if (!a || !b || !out || count == 0) return;
 
-    for (size_t i = 0; i < count; i++) {
+    size_t i = SBYTE_DISPATCH(sbyte_xor, a, b, out, count);
+    for (; i < count; i++) {
         out[i] = seraph_sbyte_xor(a[i], b[i]);
     }
 }
@@ -194,7 +373,8 @@ void seraph_sbyte_not_array(const Seraph_SemanticByte* arr,
                             Seraph_SemanticByte* out, size_t count) {
     if (!arr || !out || count == 0) return;
 
-    for (size_t i = 0; i < count; i++) {
+    size_t i = SBYTE_DISPATCH(sbyte_not, arr, out, count);
+    for (; i < count; i++) {
         out[i] = seraph_sbyte_not(arr[i]);
     }
 }
@@ -0,0 +1,459 @@
+/**
+ * @file celestial_cache.c
+ * @brief Incremental Compilation Cache
+ *
+ * MC29: Native Backends
+ *
+ * Entry file layout (little-endian):
+ *
+ *   "SCC1" | key[32] | code_size u32 | reloc_count u32 | code
+ *   | { site u32, kind u8, name_len u16, name } * reloc_count
+ *   | SHA-256 of everything before it
+ */
+
+#include "seraph/seraphim/celestial_cache.h"
+#include "seraph/crypto/sha256.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if !defined(SERAPH_KERNEL)
+#include <errno.h>
+#include <sys/stat.h>
+#if defined(_WIN32)
+#include <direct.h>
+#include <process.h>
+#define cache_mkdir(path) _mkdir(path)
+#define cache_pid() ((unsigned long)_getpid())
+#else
+#include <unistd.h>
+#define cache_mkdir(path) mkdir((path), 0755)
+#define cache_pid() ((unsigned long)getpid())
+#endif
+#endif
+
+#define CACHE_MAGIC        "SCC1"
+#define CACHE_HEADER_SIZE  (4 + CELESTIAL_CACHE_KEY_SIZE + 4 + 4)
+#define CACHE_RELOC_SIZE   (4 + 1 + 2)
+
+/** Entries larger than this are treated as damaged */
+#define CACHE_MAX_ENTRY    (64u * 1024 * 1024)
+
+/** Nesting limit when hashing types (struct fields may point back) */
+#define CACHE_TYPE_DEPTH   8
+
+/*============================================================================
+ * Key Computation
+ *============================================================================*/
+
+static void key_u32(SHA256_Context* h, uint32_t v) {
+    uint8_t b[4] = { (uint8_t)v, (uint8_t)(v >> 8), (uint8_t)(v >> 16), (uint8_t)(v >> 24) };
+    sha256_update(h, b, sizeof(b));
+}
+
+static void key_u64(SHA256_Context* h, uint64_t v) {
+    key_u32(h, (uint32_t)v);
+    key_u32(h, (uint32_t)(v >> 32));
+}
+
+static void key_name(SHA256_Context* h, const char* name, size_t len) {
+    if (!name) {
+        key_u32(h, UINT32_MAX);
+        return;
+    }
+    key_u32(h, (uint32_t)len);
+    sha256_update(h, name, len);
+}
+
+static void key_type(SHA256_Context* h, const Celestial_Type* type, int depth) {
+    if (!type) {
+        key_u32(h, UINT32_MAX);
+        return;
+    }
+    key_u32(h, (uint32_t)type->kind);
+    if (depth >= CACHE_TYPE_DEPTH) {
+        return;
+    }
+
+    switch (type->kind) {
+        case CIR_TYPE_STRUCT:
+            key_name(h, type->struct_type.name, type->struct_type.name_len);
+            key_u64(h, type->struct_type.field_count);
+            for (size_t i = 0; i < type->struct_type.field_count; i++) {
+                key_type(h, type->struct_type.fields[i], depth + 1);
+            }
+            break;
+        case CIR_TYPE_ARRAY:
+            key_u64(h, type->array_type.length);
+            key_type(h, type->array_type.elem_type, depth + 1);
+            break;
+        case CIR_TYPE_SLICE:
+            key_type(h, type->slice_type.elem_type, depth + 1);
+            break;
+        case CIR_TYPE_ENUM:
+            key_name(h, type->enum_type.name, type->enum_type.name_len);
+            key_u64(h, type->enum_type.variant_count);
+            for (size_t i = 0; i < type->enum_type.variant_count; i++) {
+                key_type(h, type->enum_type.variant_types
+                            ? type->enum_type.variant_types[i] : NULL, depth + 1);
+            }
+            break;
+        case CIR_TYPE_FUNCTION:
+            key_u32(h, type->func_type.effects);
+            key_type(h, type->func_type.ret_type, depth + 1);
+            key_u64(h, type->func_type.param_count);
+            for (size_t i = 0; i < type->func_type.param_count; i++) {
+                key_type(h, type->func_type.param_types[i], depth + 1);
+            }
+            break;
+        case CIR_TYPE_VOIDABLE:
+            key_type(h, type->voidable_type.inner_type, depth + 1);
+            break;
+        case CIR_TYPE_POINTER:
+            key_type(h, type->pointer_type.pointee_type, depth + 1);
+            break;
+        default:
+            break;
+    }
+}
+
+static void key_value(SHA256_Context* h, const Celestial_Value* v) {
+    if (!v) {
+        key_u32(h, UINT32_MAX);
+        return;
+    }
+    key_u32(h, (uint32_t)v->kind);
+    key_u32(h, v->id);
+    key_u32(h, (uint32_t)v->may_be_void);
+    key_type(h, v->type, 0);
+    key_type(h, v->alloca_type, 0);
+
+    switch (v->kind) {
+        case CIR_VALUE_CONST: {
+            /* Only the bytes the constant's type actually uses */
+            size_t words = 1;
+            if (v->type && v->type->kind == CIR_TYPE_GALACTIC) {
+                words = 4;
+            } else if (v->type && (v->type->kind == CIR_TYPE_SCALAR ||
+                                   v->type->kind == CIR_TYPE_DUAL)) {
+                words = 2;
+            }
+            const int64_t* w = &v->constant.galactic.w;
+            for (size_t i = 0; i < words; i++) {
+                key_u64(h, (uint64_t)w[i]);
+            }
+            break;
+        }
+        case CIR_VALUE_PARAM:
+            key_u32(h, v->param.index);
+            break;
+        case CIR_VALUE_GLOBAL:
+            key_name(h, v->global.name, v->global.name_len);
+            break;
+        case CIR_VALUE_STRING:
+            if (v->string.str_const) {
+                key_name(h, v->string.str_const->data, v->string.str_const->len);
+                key_u32(h, v->string.str_const->id);
+            }
+            break;
+        case CIR_VALUE_FNPTR:
+            key_name(h, v->fnptr.fn ? v->fnptr.fn->name : NULL,
+                     v->fnptr.fn ? v->fnptr.fn->name_len : 0);
+            break;
+        default:
+            break;
+    }
+}
+
+void celestial_cache_key(const Celestial_Cache* cache, const Celestial_Function* fn,
+                         uint8_t key[CELESTIAL_CACHE_KEY_SIZE]) {
+    SHA256_Context h;
+    sha256_init(&h);
+    sha256_update(&h, cache->salt, sizeof(cache->salt));
+
+    key_name(&h, fn->name, fn->name_len);
+    key_type(&h, fn->type, 0);
+    key_u32(&h, fn->declared_effects);
+    key_u32(&h, fn->next_vreg_id);
+    key_u32(&h, fn->next_block_id);
+    key_u64(&h, fn->param_count);
+    for (size_t i = 0; i < fn->param_count; i++) {
+        key_value(&h, fn->params[i]);
+    }
+
+    key_u32(&h, fn->entry ? fn->entry->id : UINT32_MAX);
+    for (const Celestial_Block* block = fn->blocks; block; block = block->next) {
+        key_u32(&h, block->id);
+        key_u32(&h, (uint32_t)block->substrate);
+        for (const Celestial_Instr* instr = block->first; instr; instr = instr->next) {
+            key_u32(&h, (uint32_t)instr->opcode);
+            key_u32(&h, instr->effects);
+            key_value(&h, instr->result);
+            key_u64(&h, instr->operand_count);
+            for (size_t i = 0; i < instr->operand_count; i++) {
+                key_value(&h, instr->operands[i]);
+            }
+            key_u32(&h, instr->target1 ? instr->target1->id : UINT32_MAX);
+            key_u32(&h, instr->target2 ? instr->target2->id : UINT32_MAX);
+            key_name(&h, instr->callee ? instr->callee->name : NULL,
+                     instr->callee ? instr->callee->name_len : 0);
+        }
+        key_u32(&h, UINT32_MAX);  /* End of block */
+    }
+
+    sha256_final(&h, key);
+}
+
+/*============================================================================
+ * Directory and Entries
+ *============================================================================*/
+
+Seraph_Vbit celestial_cache_open(Celestial_Cache* cache, const char* dir,
+                                 const char* compiler_id, uint32_t target) {
+    if (!cache || !dir || !compiler_id) {
+        return SERAPH_VBIT_VOID;
+    }
+    memset(cache, 0, sizeof(*cache));
+
+    size_t len = strlen(dir);
+    /* Room for "/<64 hex>.tmp.<pid>" after the directory */
+    if (len == 0 || len + 96 >= CELESTIAL_CACHE_PATH_MAX) {
+        return SERAPH_VBIT_FALSE;
+    }
+    memcpy(cache->dir, dir, len + 1);
+
+    SHA256_Context h;
+    sha256_init(&h);
+    key_name(&h, compiler_id, strlen(compiler_id));
+    key_u32(&h, target);
+    sha256_final(&h, cache->salt);
+
+#if defined(SERAPH_KERNEL)
+    return SERAPH_VBIT_FALSE;
+#else
+    if (cache_mkdir(cache->dir) != 0 && errno != EEXIST) {
+        return SERAPH_VBIT_FALSE;
+    }
+    struct stat st;
+    if (stat(cache->dir, &st) != 0 || (st.st_mode & S_IFMT) != S_IFDIR) {
+        return SERAPH_VBIT_FALSE;
+    }
+    return SERAPH_VBIT_TRUE;
+#endif
+}
+
+/**
+ * @brief Format the path of an entry
+ *
+ * @return false if the path does not fit; the entry is then unusable
+ */
+static bool entry_path(const Celestial_Cache* cache,
+                       const uint8_t key[CELESTIAL_CACHE_KEY_SIZE],
+                       char* path, size_t size) {
+    char hex[2 * CELESTIAL_CACHE_KEY_SIZE + 1];
+    sha256_to_hex(key, hex, sizeof(hex));
+    int n = snprintf(path, size, "%s/%s", cache->dir, hex);
+    return n >= 0 && (size_t)n < size;
+}
+
+static uint32_t read_u32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) |
+           ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static void write_u32(uint8_t* p, uint32_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+Seraph_Vbit celestial_cache_load(Celestial_Cache* cache,
+                                 const uint8_t key[CELESTIAL_CACHE_KEY_SIZE],
+                                 Celestial_Cache_Entry* entry) {
+    if (!cache || !key || !entry) {
+        return SERAPH_VBIT_VOID;
+    }
+    memset(entry, 0, sizeof(*entry));
+    cache->lookups++;
+
+#if defined(SERAPH_KERNEL)
+    return SERAPH_VBIT_FALSE;
+#else
+    char path[CELESTIAL_CACHE_PATH_MAX];
+    if (!entry_path(cache, key, path, sizeof(path))) {
+        return SERAPH_VBIT_FALSE;
+    }
+    FILE* f = fopen(path, "rb");
+    if (!f) {
+        return SERAPH_VBIT_FALSE;
+    }
+
+    long file_size = -1;
+    if (fseek(f, 0, SEEK_END) == 0) {
+        file_size = ftell(f);
+    }
+    if (file_size < CACHE_HEADER_SIZE + SHA256_DIGEST_SIZE ||
+        (unsigned long)file_size > CACHE_MAX_ENTRY || fseek(f, 0, SEEK_SET) != 0) {
+        fclose(f);
+        return SERAPH_VBIT_FALSE;
+    }
+
+    size_t size = (size_t)file_size;
+    uint8_t* data = malloc(size);
+    if (!data || fread(data, 1, size, f) != size) {
+        free(data);
+        fclose(f);
+        return SERAPH_VBIT_FALSE;
+    }
+    fclose(f);
+
+    /* Checksum, magic and key must all agree */
+    size_t body = size - SHA256_DIGEST_SIZE;
+    uint8_t digest[SHA256_DIGEST_SIZE];
+    sha256(data, body, digest);
+    if (!sha256_equal(digest, data + body) ||
+        memcmp(data, CACHE_MAGIC, 4) != 0 ||
+        memcmp(data + 4, key, CELESTIAL_CACHE_KEY_SIZE) != 0) {
+        free(data);
+        return SERAPH_VBIT_FALSE;
+    }
+
+    const uint8_t* p = data + 4 + CELESTIAL_CACHE_KEY_SIZE;
+    size_t code_size = read_u32(p);
+    size_t reloc_count = read_u32(p + 4);
+    size_t pos = CACHE_HEADER_SIZE;
+    if (code_size > body - pos || reloc_count > (body - pos - code_size) / CACHE_RELOC_SIZE) {
+        free(data);
+        return SERAPH_VBIT_FALSE;
+    }
+
+    Celestial_Cache_Reloc* relocs = NULL;
+    if (reloc_count > 0) {
+        relocs = malloc(reloc_count * sizeof(Celestial_Cache_Reloc));
+        if (!relocs) {
+            free(data);
+            return SERAPH_VBIT_FALSE;
+        }
+    }
+
+    entry->code = data + pos;
+    entry->code_size = code_size;
+    pos += code_size;
+
+    for (size_t i = 0; i < reloc_count; i++) {
+        Celestial_Cache_Reloc* r = &relocs[i];
+        if (body - pos < CACHE_RELOC_SIZE) goto damaged;
+        r->site = read_u32(data + pos);
+        r->kind = data[pos + 4];
+        r->name_len = (size_t)data[pos + 5] | ((size_t)data[pos + 6] << 8);
+        pos += CACHE_RELOC_SIZE;
+        if (r->name_len > body - pos || (size_t)r->site + 4 > code_size) goto damaged;
+        r->name = (const char*)data + pos;
+        pos += r->name_len;
+    }
+    if (pos != body) goto damaged;
+
+    entry->relocs = relocs;
+    entry->reloc_count = reloc_count;
+    entry->storage = data;
+    cache->hits++;
+    return SERAPH_VBIT_TRUE;
+
+damaged:
+    free(relocs);
+    free(data);
+    memset(entry, 0, sizeof(*entry));
+    return SERAPH_VBIT_FALSE;
+#endif
+}
+
+Seraph_Vbit celestial_cache_store(Celestial_Cache* cache,
+                                  const uint8_t key[CELESTIAL_CACHE_KEY_SIZE],
+                                  const Celestial_Cache_Entry* entry) {
+    if (!cache || !key || !entry || (entry->code_size && !entry->code)) {
+        return SERAPH_VBIT_VOID;
+    }
+
+#if defined(SERAPH_KERNEL)
+    return SERAPH_VBIT_FALSE;
+#else
+    if (entry->code_size > CACHE_MAX_ENTRY || entry->reloc_count > UINT32_MAX) {
+        return SERAPH_VBIT_FALSE;
+    }
+
+    size_t size = CACHE_HEADER_SIZE + entry->code_size + SHA256_DIGEST_SIZE;
+    for (size_t i = 0; i < entry->reloc_count; i++) {
+        if (entry->relocs[i].name_len > UINT16_MAX) {
+            return SERAPH_VBIT_FALSE;
+        }
+        size += CACHE_RELOC_SIZE + entry->relocs[i].name_len;
+    }
+    if (size > CACHE_MAX_ENTRY) {
+        return SERAPH_VBIT_FALSE;
+    }
+
+    char path[CELESTIAL_CACHE_PATH_MAX];
+    char tmp[CELESTIAL_CACHE_PATH_MAX + 32];
+    if (!entry_path(cache, key, path, sizeof(path))) {
+        return SERAPH_VBIT_FALSE;
+    }
+    int n = snprintf(tmp, sizeof(tmp), "%s.tmp.%lu", path, cache_pid());
+    if (n < 0 || (size_t)n >= sizeof(tmp)) {
+        return SERAPH_VBIT_FALSE;
+    }
+
+    uint8_t* data = malloc(size);
+    if (!data) {
+        return SERAPH_VBIT_FALSE;
+    }
+
+    memcpy(data, CACHE_MAGIC, 4);
+    memcpy(data + 4, key, CELESTIAL_CACHE_KEY_SIZE);
+    write_u32(data + 4 + CELESTIAL_CACHE_KEY_SIZE, (uint32_t)entry->code_size);
+    write_u32(data + 8 + CELESTIAL_CACHE_KEY_SIZE, (uint32_t)entry->reloc_count);
+    size_t pos = CACHE_HEADER_SIZE;
+    if (entry->code_size) {
+        memcpy(data + pos, entry->code, entry->code_size);
+    }
+    pos += entry->code_size;
+
+    for (size_t i = 0; i < entry->reloc_count; i++) {
+        const Celestial_Cache_Reloc* r = &entry->relocs[i];
+        write_u32(data + pos, r->site);
+        data[pos + 4] = r->kind;
+        data[pos + 5] = (uint8_t)r->name_len;
+        data[pos + 6] = (uint8_t)(r->name_len >> 8);
+        pos += CACHE_RELOC_SIZE;
+        memcpy(data + pos, r->name, r->name_len);
+        pos += r->name_len;
+    }
+    sha256(data, pos, data + pos);
+
+    /* Write aside and rename so readers never see a partial entry */
+    FILE* f = fopen(tmp, "wb");
+    int ok = f != NULL && fwrite(data, 1, size, f) == size;
+    if (f && fclose(f) != 0) {
+        ok = 0;
+    }
+    free(data);
+
+#if defined(_WIN32)
+    if (ok) remove(path);
+#endif
+    if (!ok || rename(tmp, path) != 0) {
+        remove(tmp);
+        return SERAPH_VBIT_FALSE;
+    }
+
+    cache->stores++;
+    return SERAPH_VBIT_TRUE;
+#endif
+}
+
+void celestial_cache_entry_free(Celestial_Cache_Entry* entry) {
+    if (!entry) return;
+    free(entry->relocs);
+    free(entry->storage);
+    memset(entry, 0, sizeof(*entry));
+}
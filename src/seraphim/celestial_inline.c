@@ -0,0 +1,906 @@
+/**
+ * @file celestial_inline.c
+ * @brief Celestial IR Inliner and Call-Site Specializer
+ *
+ * MC28: Celestial IR Optimization Passes
+ *
+ * Replaces calls to small scalar functions with a copy of the callee's
+ * body, and clones larger callees for call sites that pass constants.
+ *
+ * Inlining a call site:
+ *
+ *   Single-block callee:  the callee's instructions are copied in front of
+ *                         the call, and every use of the call's result is
+ *                         rewritten to the returned value.
+ *
+ *   Multi-block callee:   the caller's block is split at the call. The
+ *                         callee's blocks are copied between the two halves;
+ *                         each RETURN becomes a store to a stack slot plus a
+ *                         jump to the continuation, and the CALL itself is
+ *                         rewritten into a LOAD of that slot so existing uses
+ *                         of its result stay valid.
+ *
+ * Copied blocks are linked directly after the split block so the linear
+ * block order the backends allocate registers over stays natural.
+ */
+
+#include "seraph/seraphim/celestial_inline.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+/*============================================================================
+ * Call Graph
+ *============================================================================*/
+
+/**
+ * @brief Per-function call graph node
+ */
+typedef struct {
+    Celestial_Function* fn;
+    uint32_t            cost;        /**< Cached celestial_inline_cost() */
+    uint32_t            call_sites;  /**< Direct CIR_CALLs targeting fn */
+    uint8_t             state;       /**< 0 = unvisited, 1 = on stack, 2 = done */
+    uint8_t             recursive;   /**< Part of a call cycle */
+} Inline_Node;
+
+/**
+ * @brief Module call graph with pointer-keyed node lookup
+ */
+typedef struct {
+    Inline_Node*         nodes;
+    size_t               node_count;
+    uint32_t*            slots;      /**< Open-addressed index into nodes (+1) */
+    size_t               slot_mask;
+    Celestial_Function** order;      /**< Bottom-up (post-order) visit order */
+    size_t               order_count;
+} Inline_Call_Graph;
+
+static size_t fn_hash(Celestial_Function* fn) {
+    uintptr_t p = (uintptr_t)fn;
+    p ^= p >> 17;
+    p *= (uintptr_t)0x9E3779B97F4A7C15ULL;
+    return (size_t)(p ^ (p >> 29));
+}
+
+static Inline_Node* graph_find(Inline_Call_Graph* g, Celestial_Function* fn) {
+    if (fn == NULL || g->slots == NULL) return NULL;
+    size_t i = fn_hash(fn) & g->slot_mask;
+    while (g->slots[i] != 0) {
+        Inline_Node* node = &g->nodes[g->slots[i] - 1];
+        if (node->fn == fn) return node;
+        i = (i + 1) & g->slot_mask;
+    }
+    return NULL;
+}
+
+static void graph_visit(Inline_Call_Graph* g, Inline_Node* node) {
+    node->state = 1;
+
+    for (Celestial_Block* block = node->fn->blocks; block; block = block->next) {
+        for (Celestial_Instr* instr = block->first; instr; instr = instr->next) {
+            if (instr->opcode != CIR_CALL) continue;
+
+            Inline_Node* callee = graph_find(g, instr->callee);
+            if (callee == NULL) continue;
+
+            if (callee->state == 1) {
+                /* Back edge: everything on the cycle stays a real call */
+                callee->recursive = 1;
+                node->recursive = 1;
+            } else if (callee->state == 0) {
+                graph_visit(g, callee);
+                if (callee->recursive && callee->fn == node->fn) {
+                    node->recursive = 1;
+                }
+            }
+        }
+    }
+
+    node->state = 2;
+    g->order[g->order_count++] = node->fn;
+}
+
+static int graph_build(Inline_Call_Graph* g, Celestial_Module* mod) {
+    memset(g, 0, sizeof(*g));
+
+    size_t count = 0;
+    for (Celestial_Function* fn = mod->functions; fn; fn = fn->next) count++;
+    if (count == 0) return 1;
+
+    size_t slot_count = 16;
+    while (slot_count < count * 2) slot_count <<= 1;
+
+    g->nodes = calloc(count, sizeof(Inline_Node));
+    g->slots = calloc(slot_count, sizeof(uint32_t));
+    g->order = calloc(count, sizeof(Celestial_Function*));
+    if (!g->nodes || !g->slots || !g->order) return 0;
+    g->slot_mask = slot_count - 1;
+
+    for (Celestial_Function* fn = mod->functions; fn; fn = fn->next) {
+        Inline_Node* node = &g->nodes[g->node_count++];
+        node->fn = fn;
+        node->cost = celestial_inline_cost(fn);
+
+        size_t i = fn_hash(fn) & g->slot_mask;
+        while (g->slots[i] != 0) i = (i + 1) & g->slot_mask;
+        g->slots[i] = (uint32_t)g->node_count;
+    }
+
+    /* Count call sites per callee */
+    for (size_t n = 0; n < g->node_count; n++) {
+        for (Celestial_Block* block = g->nodes[n].fn->blocks; block; block = block->next) {
+            for (Celestial_Instr* instr = block->first; instr; instr = instr->next) {
+                if (instr->opcode != CIR_CALL) continue;
+                Inline_Node* callee = graph_find(g, instr->callee);
+                if (callee != NULL) callee->call_sites++;
+            }
+        }
+    }
+
+    for (size_t n = 0; n < g->node_count; n++) {
+        if (g->nodes[n].state == 0) {
+            graph_visit(g, &g->nodes[n]);
+        }
+    }
+
+    return 1;
+}
+
+static void graph_free(Inline_Call_Graph* g) {
+    free(g->nodes);
+    free(g->slots);
+    free(g->order);
+    memset(g, 0, sizeof(*g));
+}
+
+/*============================================================================
+ * Candidate Selection
+ *============================================================================*/
+
+/**
+ * @brief Check if a type is passed and returned in a single register
+ */
+static int is_scalar_type(Celestial_Type* type) {
+    if (type == NULL) return 0;
+    switch (type->kind) {
+        case CIR_TYPE_VOID:
+        case CIR_TYPE_BOOL:
+        case CIR_TYPE_I8:  case CIR_TYPE_I16:
+        case CIR_TYPE_I32: case CIR_TYPE_I64:
+        case CIR_TYPE_U8:  case CIR_TYPE_U16:
+        case CIR_TYPE_U32: case CIR_TYPE_U64:
+        case CIR_TYPE_POINTER:
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+/**
+ * @brief Check if an integer constant can be bound to a parameter
+ */
+static int is_int_constant(Celestial_Value* v) {
+    return v != NULL && v->kind == CIR_VALUE_CONST && v->type != NULL &&
+           v->type->kind >= CIR_TYPE_BOOL && v->type->kind <= CIR_TYPE_U64;
+}
+
+static int is_terminator(Celestial_Opcode op) {
+    return op == CIR_JUMP || op == CIR_BRANCH || op == CIR_RETURN ||
+           op == CIR_UNREACHABLE || op == CIR_SWITCH;
+}
+
+uint32_t celestial_inline_cost(Celestial_Function* fn) {
+    if (fn == NULL || fn->blocks == NULL || fn->type == NULL) return UINT32_MAX;
+
+    Celestial_Type* ftype = fn->type;
+    if (!is_scalar_type(ftype->func_type.ret_type)) return UINT32_MAX;
+    for (size_t i = 0; i < ftype->func_type.param_count; i++) {
+        if (ftype->func_type.param_types[i]->kind == CIR_TYPE_VOID ||
+            !is_scalar_type(ftype->func_type.param_types[i])) {
+            return UINT32_MAX;
+        }
+    }
+
+    uint32_t cost = 0;
+    for (Celestial_Block* block = fn->blocks; block; block = block->next) {
+        if (block->last == NULL) return UINT32_MAX;
+
+        for (Celestial_Instr* instr = block->first; instr; instr = instr->next) {
+            switch (instr->opcode) {
+                case CIR_NOP:
+                    continue;
+
+                /* These act on the enclosing frame and cannot be moved */
+                case CIR_VOID_PROP:
+                case CIR_TAIL_CALL:
+                case CIR_SWITCH:
+                case CIR_PHI:
+                    return UINT32_MAX;
+
+                case CIR_RETURN:
+                    /* Backend returns small local structs by value */
+                    if (instr->operand_count > 0 && instr->operands[0] &&
+                        instr->operands[0]->alloca_type != NULL) {
+                        return UINT32_MAX;
+                    }
+                    break;
+
+                default:
+                    break;
+            }
+            cost++;
+            if (is_terminator(instr->opcode)) break;
+        }
+    }
+
+    return cost;
+}
+
+void celestial_inline_default_options(Celestial_Inline_Options* opts,
+                                      int opt_level) {
+    if (opts == NULL) return;
+
+    memset(opts, 0, sizeof(*opts));
+
+    /* The x64 backend tracks at most 256 live intervals per function */
+    opts->max_caller_values = 224;
+
+    switch (opt_level) {
+        case 0:
+            break;
+        case 1:
+            opts->inline_threshold  = 8;
+            opts->const_arg_bonus   = 2;
+            opts->single_site_bonus = 4;
+            break;
+        case 2:
+            opts->inline_threshold     = 24;
+            opts->const_arg_bonus      = 3;
+            opts->single_site_bonus    = 12;
+            opts->specialize           = 1;
+            opts->specialize_threshold = 128;
+            opts->max_specializations  = 64;
+            break;
+        default:
+            opts->inline_threshold     = 48;
+            opts->const_arg_bonus      = 4;
+            opts->single_site_bonus    = 24;
+            opts->specialize           = 1;
+            opts->specialize_threshold = 256;
+            opts->max_specializations  = 256;
+            break;
+    }
+}
+
+/*============================================================================
+ * Instruction List Helpers
+ *============================================================================*/
+
+static void block_unlink_instr(Celestial_Block* block, Celestial_Instr* instr) {
+    if (instr->prev) instr->prev->next = instr->next;
+    else block->first = instr->next;
+    if (instr->next) instr->next->prev = instr->prev;
+    else block->last = instr->prev;
+    instr->next = instr->prev = NULL;
+    block->instr_count--;
+}
+
+static void block_insert_before(Celestial_Block* block, Celestial_Instr* pos,
+                                Celestial_Instr* instr) {
+    if (pos == NULL) {
+        instr->prev = block->last;
+        instr->next = NULL;
+        if (block->last) block->last->next = instr;
+        else block->first = instr;
+        block->last = instr;
+    } else {
+        instr->next = pos;
+        instr->prev = pos->prev;
+        if (pos->prev) pos->prev->next = instr;
+        else block->first = instr;
+        pos->prev = instr;
+    }
+    block->instr_count++;
+}
+
+/**
+ * @brief Relink a freshly created block directly after `anchor`
+ */
+static void block_move_after(Celestial_Function* fn, Celestial_Block* block,
+                             Celestial_Block* anchor) {
+    if (anchor == block || anchor->next == block) return;
+
+    /* Unlink (new blocks are always appended, so never the head) */
+    if (block->prev) block->prev->next = block->next;
+    if (block->next) block->next->prev = block->prev;
+    if (fn->blocks == block) fn->blocks = block->next;
+
+    block->prev = anchor;
+    block->next = anchor->next;
+    if (anchor->next) anchor->next->prev = block;
+    anchor->next = block;
+}
+
+static void replace_all_uses(Celestial_Function* fn, Celestial_Value* from,
+                             Celestial_Value* to) {
+    for (Celestial_Block* block = fn->blocks; block; block = block->next) {
+        for (Celestial_Instr* instr = block->first; instr; instr = instr->next) {
+            for (size_t i = 0; i < instr->operand_count; i++) {
+                if (instr->operands[i] == from) instr->operands[i] = to;
+            }
+        }
+    }
+}
+
+/*============================================================================
+ * Body Cloning
+ *============================================================================*/
+
+/**
+ * @brief State for copying one function body into another
+ */
+typedef struct {
+    Celestial_Module*   mod;
+    Celestial_Function* callee;
+    Celestial_Function* target;  /**< Function receiving the copy */
+    Celestial_Value**   args;    /**< Value bound to each callee parameter */
+    Celestial_Value**   vmap;    /**< Callee vreg id -> copied value */
+    Celestial_Block**   bmap;    /**< Callee block id -> copied block */
+} Inline_Clone;
+
+static int clone_init(Inline_Clone* c, Celestial_Module* mod,
+                      Celestial_Function* callee, Celestial_Function* target,
+                      Celestial_Value** args) {
+    c->mod = mod;
+    c->callee = callee;
+    c->target = target;
+    c->args = args;
+    c->vmap = calloc(callee->next_vreg_id + 1, sizeof(Celestial_Value*));
+    c->bmap = calloc(callee->next_block_id + 1, sizeof(Celestial_Block*));
+    return c->vmap != NULL && c->bmap != NULL;
+}
+
+static void clone_free(Inline_Clone* c) {
+    free(c->vmap);
+    free(c->bmap);
+}
+
+static Celestial_Value* clone_map_value(Inline_Clone* c, Celestial_Value* v) {
+    if (v == NULL) return NULL;
+
+    if (v->kind == CIR_VALUE_PARAM) {
+        uint32_t idx = v->param.index;
+        if (idx < c->callee->param_count && c->callee->params[idx] == v) {
+            return c->args[idx];
+        }
+        return v;
+    }
+
+    if (v->kind == CIR_VALUE_VREG && v->id < c->callee->next_vreg_id &&
+        c->vmap[v->id] != NULL) {
+        return c->vmap[v->id];
+    }
+
+    /* Constants, globals, strings and function pointers are shared */
+    return v;
+}
+
+/**
+ * @brief Copy one instruction; operands are remapped later
+ */
+static Celestial_Instr* clone_instr(Inline_Clone* c, Celestial_Instr* src) {
+    Seraph_Arena* arena = c->mod->arena;
+
+    Celestial_Instr* instr = (Celestial_Instr*)seraph_arena_alloc(
+        arena, sizeof(Celestial_Instr), _Alignof(Celestial_Instr));
+    if (instr == NULL) return NULL;
+
+    *instr = *src;
+    instr->next = instr->prev = NULL;
+
+    if (src->operand_count > 0) {
+        instr->operands = (Celestial_Value**)seraph_arena_alloc(
+            arena, src->operand_count * sizeof(Celestial_Value*),
+            _Alignof(Celestial_Value*));
+        if (instr->operands == NULL) return NULL;
+        memcpy(instr->operands, src->operands,
+               src->operand_count * sizeof(Celestial_Value*));
+    }
+
+    if (src->result != NULL) {
+        Celestial_Value* result = (Celestial_Value*)seraph_arena_alloc(
+            arena, sizeof(Celestial_Value), _Alignof(Celestial_Value));
+        if (result == NULL) return NULL;
+
+        *result = *src->result;
+        result->id = c->target->next_vreg_id++;
+        if (result->kind == CIR_VALUE_VREG) {
+            result->vreg.def = instr;
+        }
+        instr->result = result;
+
+        if (src->result->id < c->callee->next_vreg_id) {
+            c->vmap[src->result->id] = result;
+        }
+    }
+
+    return instr;
+}
+
+static void clone_remap_instr(Inline_Clone* c, Celestial_Instr* instr) {
+    for (size_t i = 0; i < instr->operand_count; i++) {
+        instr->operands[i] = clone_map_value(c, instr->operands[i]);
+    }
+    if (instr->target1) instr->target1 = c->bmap[instr->target1->id];
+    if (instr->target2) instr->target2 = c->bmap[instr->target2->id];
+}
+
+/**
+ * @brief Copy every callee block into the target, after `anchor`
+ *
+ * RETURNs are copied verbatim; the caller rewrites them if needed.
+ *
+ * @return Last copied block, or NULL on allocation failure
+ */
+static Celestial_Block* clone_blocks(Inline_Clone* c, Celestial_Block* anchor,
+                                     uint32_t* copied) {
+    Celestial_Block* prev = anchor;
+
+    for (Celestial_Block* src = c->callee->blocks; src; src = src->next) {
+        Celestial_Block* block = celestial_block_create(c->target, src->name);
+        if (block == NULL) return NULL;
+        block->substrate = src->substrate;
+        if (prev != NULL) {
+            block_move_after(c->target, block, prev);
+        }
+        c->bmap[src->id] = block;
+        prev = block;
+    }
+
+    /* Copy all instructions first so forward references resolve.
+     * Anything after a block's first terminator is unreachable. */
+    for (Celestial_Block* src = c->callee->blocks; src; src = src->next) {
+        Celestial_Block* block = c->bmap[src->id];
+        for (Celestial_Instr* s = src->first; s; s = s->next) {
+            if (s->opcode == CIR_NOP) continue;
+            Celestial_Instr* instr = clone_instr(c, s);
+            if (instr == NULL) return NULL;
+            block_insert_before(block, NULL, instr);
+            (*copied)++;
+            if (is_terminator(s->opcode)) break;
+        }
+    }
+
+    for (Celestial_Block* src = c->callee->blocks; src; src = src->next) {
+        for (Celestial_Instr* instr = c->bmap[src->id]->first; instr; instr = instr->next) {
+            clone_remap_instr(c, instr);
+        }
+    }
+
+    return prev;
+}
+
+/*============================================================================
+ * Inlining
+ *============================================================================*/
+
+/**
+ * @brief Inline a single-block callee in front of the call
+ *
+ * @param resume Receives the instruction to resume scanning at
+ * @return 1 if inlined, 0 if out of memory (the call is left in place)
+ */
+static int inline_straight(Inline_Clone* c, Celestial_Block* block,
+                           Celestial_Instr* call, Celestial_Instr** resume,
+                           uint32_t* copied) {
+    *resume = call->next;
+    Celestial_Value* ret_val = NULL;
+
+    Celestial_Instr* first_copy = NULL;
+    uint32_t count = 0;
+    for (Celestial_Instr* s = c->callee->blocks->first; s; s = s->next) {
+        if (s->opcode == CIR_NOP) continue;
+        if (s->opcode == CIR_RETURN) {
+            if (s->operand_count > 0) ret_val = s->operands[0];
+            break;
+        }
+        Celestial_Instr* instr = clone_instr(c, s);
+        if (instr == NULL) {
+            /* Drop the partial copy */
+            while (first_copy != NULL && first_copy != call) {
+                Celestial_Instr* next = first_copy->next;
+                block_unlink_instr(block, first_copy);
+                first_copy = next;
+            }
+            return 0;
+        }
+        block_insert_before(block, call, instr);
+        if (first_copy == NULL) first_copy = instr;
+        count++;
+    }
+
+    for (Celestial_Instr* instr = first_copy; instr && instr != call; instr = instr->next) {
+        clone_remap_instr(c, instr);
+    }
+
+    if (call->result != NULL && ret_val != NULL) {
+        replace_all_uses(c->target, call->result, clone_map_value(c, ret_val));
+    }
+
+    block_unlink_instr(block, call);
+    *copied += count;
+    return 1;
+}
+
+/**
+ * @brief Unlink the blocks after `from`, up to and including `to`
+ */
+static void block_remove_range(Celestial_Function* fn, Celestial_Block* from,
+                               Celestial_Block* to) {
+    Celestial_Block* after = to->next;
+    for (Celestial_Block* b = from->next; b != after; b = b->next) {
+        fn->block_count--;
+    }
+    from->next = after;
+    if (after) after->prev = from;
+}
+
+/**
+ * @brief Inline a multi-block callee by splitting the caller's block
+ *
+ * Everything that allocates (return slot, load operand, continuation,
+ * copied blocks and their jumps) is built before the caller's block is
+ * split. On failure the new blocks are unlinked and the call stays.
+ *
+ * @param out_block Receives the block to resume scanning in
+ * @param resume Receives the instruction to resume scanning at
+ * @return 1 if inlined, 0 if out of memory
+ */
+static int inline_split(Inline_Clone* c, Celestial_Block* block,
+                        Celestial_Instr* call, Celestial_Block** out_block,
+                        Celestial_Instr** resume, uint32_t* copied) {
+    Celestial_Function* fn = c->target;
+    Celestial_Builder builder;
+    celestial_builder_init(&builder, c->mod);
+    builder.function = fn;
+
+    *out_block = block;
+    *resume = call->next;
+
+    /* Return slot lives in the entry block so loops reuse it; an unused
+     * slot left behind by a failure is harmless */
+    Celestial_Value* slot = NULL;
+    Celestial_Value** operands = call->operands;
+    if (call->result != NULL) {
+        if (call->operand_count < 1) {
+            operands = (Celestial_Value**)seraph_arena_alloc(
+                c->mod->arena, sizeof(Celestial_Value*), _Alignof(Celestial_Value*));
+            if (operands == NULL || SERAPH_IS_VOID_PTR(operands)) return 0;
+        }
+        builder.block = fn->entry;
+        builder.insert_point = fn->entry->first;
+        slot = celestial_build_alloca(&builder, call->result->type, "inline.ret");
+        if (slot == NULL) return 0;
+    }
+
+    Celestial_Block* cont = celestial_block_create(fn, "inline.cont");
+    if (cont == NULL) return 0;
+    cont->substrate = block->substrate;
+    block_move_after(fn, cont, block);
+
+    /* Copies land between block and cont, unreachable until the split */
+    uint32_t count = 0;
+    int ok = clone_blocks(c, block, &count) != NULL;
+
+    /* Rewrite copied returns into store + jump to continuation */
+    for (Celestial_Block* b = block->next; ok && b != cont; b = b->next) {
+        Celestial_Instr* term = b->last;
+        if (term == NULL || term->opcode != CIR_RETURN) continue;
+
+        block_unlink_instr(b, term);
+        size_t expected = b->instr_count + 1;
+        builder.block = b;
+        builder.insert_point = NULL;
+        if (slot != NULL && term->operand_count > 0) {
+            celestial_build_store(&builder, slot, term->operands[0]);
+            expected++;
+        }
+        celestial_build_jump(&builder, cont);
+        ok = b->instr_count == expected;
+    }
+
+    /* The jump into the copy is built in the empty continuation, then moved */
+    if (ok) {
+        builder.block = cont;
+        builder.insert_point = NULL;
+        celestial_build_jump(&builder, c->bmap[c->callee->entry->id]);
+        ok = cont->first != NULL;
+    }
+    if (!ok) {
+        block_remove_range(fn, block, cont);
+        return 0;
+    }
+    Celestial_Instr* enter = cont->first;
+    block_unlink_instr(cont, enter);
+
+    /* Nothing below allocates: move everything after the call into the
+     * continuation and end the block with the jump */
+    while (call->next != NULL) {
+        Celestial_Instr* moved = call->next;
+        block_unlink_instr(block, moved);
+        block_insert_before(cont, NULL, moved);
+    }
+    block_unlink_instr(block, call);
+    block_insert_before(block, NULL, enter);
+
+    *copied += count;
+    *out_block = cont;
+    if (slot == NULL) {
+        *resume = cont->first;
+        return 1;
+    }
+
+    /* The call becomes a load of the return slot, keeping its result */
+    call->opcode = CIR_LOAD;
+    call->operands = operands;
+    call->operands[0] = slot;
+    call->operand_count = 1;
+    call->callee = NULL;
+    call->effects = CIR_EFFECT_READ;
+    block_insert_before(cont, cont->first, call);
+
+    *resume = call->next;
+    return 1;
+}
+
+/*============================================================================
+ * Call-Site Specialization
+ *============================================================================*/
+
+/**
+ * @brief A specialized clone and the constants it was built for
+ */
+typedef struct {
+    Celestial_Function* callee;
+    Celestial_Function* clone;
+    Celestial_Value**   bound;   /**< Constant per param, NULL if not bound */
+} Inline_Spec;
+
+typedef struct {
+    Inline_Spec* specs;
+    size_t       count;
+    size_t       capacity;
+} Inline_Spec_Table;
+
+static int same_constant(Celestial_Value* a, Celestial_Value* b) {
+    if (a == NULL || b == NULL) return a == b;
+    return a->type->kind == b->type->kind && a->constant.i64 == b->constant.i64;
+}
+
+static Celestial_Function* spec_lookup(Inline_Spec_Table* t,
+                                       Celestial_Function* callee,
+                                       Celestial_Value** bound) {
+    for (size_t i = 0; i < t->count; i++) {
+        if (t->specs[i].callee != callee) continue;
+        size_t p = 0;
+        for (; p < callee->param_count; p++) {
+            if (!same_constant(t->specs[i].bound[p], bound[p])) break;
+        }
+        if (p == callee->param_count) return t->specs[i].clone;
+    }
+    return NULL;
+}
+
+static Celestial_Function* specialize(Celestial_Module* mod, Inline_Spec_Table* t,
+                                      Celestial_Function* callee,
+                                      Celestial_Value** bound) {
+    char name[128];
+    snprintf(name, sizeof(name), "%.*s.spec%zu",
+             (int)(callee->name_len > 96 ? 96 : callee->name_len),
+             callee->name ? callee->name : "fn", t->count);
+
+    Celestial_Function* clone = celestial_function_create(mod, name, callee->type);
+    if (clone == NULL) return NULL;
+    clone->declared_effects = callee->declared_effects;
+
+    Celestial_Value** args = (Celestial_Value**)seraph_arena_alloc(
+        mod->arena, (callee->param_count + 1) * sizeof(Celestial_Value*),
+        _Alignof(Celestial_Value*));
+    if (args == NULL) return NULL;
+    for (size_t p = 0; p < callee->param_count; p++) {
+        args[p] = bound[p] != NULL ? bound[p] : clone->params[p];
+    }
+
+    Inline_Clone c;
+    uint32_t copied = 0;
+    if (!clone_init(&c, mod, callee, clone, args)) {
+        clone_free(&c);
+        return NULL;
+    }
+    Celestial_Block* last = clone_blocks(&c, NULL, &copied);
+    clone_free(&c);
+    if (last == NULL) return NULL;
+
+    if (t->count == t->capacity) {
+        size_t cap = t->capacity ? t->capacity * 2 : 16;
+        Inline_Spec* grown = realloc(t->specs, cap * sizeof(Inline_Spec));
+        if (grown == NULL) return clone;
+        t->specs = grown;
+        t->capacity = cap;
+    }
+    t->specs[t->count].callee = callee;
+    t->specs[t->count].clone = clone;
+    t->specs[t->count].bound = args;
+    for (size_t p = 0; p < callee->param_count; p++) {
+        /* Remember only the bound constants, not the clone's own params */
+        if (bound[p] == NULL) args[p] = NULL;
+    }
+    t->count++;
+
+    return clone;
+}
+
+/*============================================================================
+ * Driver
+ *============================================================================*/
+
+typedef struct {
+    Celestial_Module*              mod;
+    const Celestial_Inline_Options* opts;
+    Celestial_Inline_Stats*         stats;
+    Inline_Call_Graph              graph;
+    Inline_Spec_Table              specs;
+} Inline_Context;
+
+/**
+ * @brief Decide what to do with one call site
+ *
+ * @return 1 = inline, 2 = specialize, 0 = leave as call
+ */
+static int inline_decide(Inline_Context* ctx, Celestial_Function* caller,
+                         Celestial_Instr* call) {
+    const Celestial_Inline_Options* o = ctx->opts;
+    Celestial_Function* callee = call->callee;
+    if (callee == NULL || callee == caller) return 0;
+    if (call->operand_count != callee->param_count) return 0;
+
+    Inline_Node* node = graph_find(&ctx->graph, callee);
+    if (node == NULL || node->recursive || node->cost == UINT32_MAX) return 0;
+
+    uint32_t const_args = 0;
+    for (size_t i = 0; i < call->operand_count; i++) {
+        if (is_int_constant(call->operands[i])) const_args++;
+    }
+
+    if (o->inline_threshold > 0) {
+        uint32_t discount = const_args * o->const_arg_bonus;
+        if (node->call_sites == 1) discount += o->single_site_bonus;
+        uint32_t cost = node->cost > discount ? node->cost - discount : 0;
+
+        if (cost <= o->inline_threshold &&
+            caller->next_vreg_id + callee->next_vreg_id <= o->max_caller_values) {
+            return 1;
+        }
+    }
+
+    if (o->specialize && const_args > 0 && node->cost <= o->specialize_threshold &&
+        ctx->stats->specializations < o->max_specializations) {
+        return 2;
+    }
+
+    return 0;
+}
+
+static int inline_function(Inline_Context* ctx, Celestial_Function* fn) {
+    int changed = 0;
+
+    for (Celestial_Block* block = fn->blocks; block; block = block->next) {
+        Celestial_Instr* instr = block->first;
+        while (instr != NULL) {
+            if (instr->opcode != CIR_CALL) {
+                instr = instr->next;
+                continue;
+            }
+
+            int action = inline_decide(ctx, fn, instr);
+            Celestial_Function* callee = instr->callee;
+
+            if (action == 1) {
+                Inline_Clone c;
+                uint32_t copied = 0;
+                if (!clone_init(&c, ctx->mod, callee, fn, instr->operands)) {
+                    clone_free(&c);
+                    return changed;
+                }
+                int inlined;
+                if (callee->blocks->next == NULL) {
+                    inlined = inline_straight(&c, block, instr, &instr, &copied);
+                } else {
+                    inlined = inline_split(&c, block, instr, &block, &instr, &copied);
+                }
+                clone_free(&c);
+
+                if (inlined) {
+                    ctx->stats->calls_inlined++;
+                    ctx->stats->instrs_added += copied;
+                    changed++;
+                }
+                continue;
+            }
+
+            if (action == 2) {
+                Celestial_Value* bound[64];
+                if (callee->param_count <= 64) {
+                    for (size_t i = 0; i < callee->param_count; i++) {
+                        bound[i] = is_int_constant(instr->operands[i]) ?
+                                   instr->operands[i] : NULL;
+                    }
+                    Celestial_Function* clone = spec_lookup(&ctx->specs, callee, bound);
+                    if (clone == NULL) {
+                        clone = specialize(ctx->mod, &ctx->specs, callee, bound);
+                        if (clone != NULL) ctx->stats->specializations++;
+                    }
+                    if (clone != NULL) {
+                        instr->callee = clone;
+                        ctx->stats->calls_specialized++;
+                        changed++;
+                    }
+                }
+            }
+
+            instr = instr->next;
+        }
+    }
+
+    return changed;
+}
+
+int celestial_inline_module(Celestial_Module* mod,
+                            const Celestial_Inline_Options* opts,
+                            Celestial_Inline_Stats* stats) {
+    if (mod == NULL) return 0;
+
+    Celestial_Inline_Options defaults;
+    if (opts == NULL) {
+        celestial_inline_default_options(&defaults, 2);
+        opts = &defaults;
+    }
+
+    Celestial_Inline_Stats local_stats;
+    if (stats == NULL) stats = &local_stats;
+    memset(stats, 0, sizeof(*stats));
+
+    if (opts->inline_threshold == 0 && !opts->specialize) return 0;
+
+    Inline_Context ctx;
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.mod = mod;
+    ctx.opts = opts;
+    ctx.stats = stats;
+
+    if (!graph_build(&ctx.graph, mod)) {
+        graph_free(&ctx.graph);
+        return 0;
+    }
+
+    int changed = 0;
+
+    /* Bottom-up: callees are finished before their callers look at them */
+    for (size_t i = 0; i < ctx.graph.order_count; i++) {
+        Celestial_Function* fn = ctx.graph.order[i];
+        if (fn->blocks == NULL) continue;
+
+        int n = inline_function(&ctx, fn);
+        if (n > 0) {
+            changed += n;
+            Inline_Node* node = graph_find(&ctx.graph, fn);
+            if (node != NULL) node->cost = celestial_inline_cost(fn);
+        }
+    }
+
+    graph_free(&ctx.graph);
+    free(ctx.specs.specs);
+
+    return changed;
+}
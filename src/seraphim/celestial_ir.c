@@ -368,6 +368,7 @@ Celestial_Type* celestial_type_function(Celestial_Module* mod,
                                                                 _Alignof(Celestial_Type));
     if (type == NULL) return NULL;
 
+    memset(type, 0, sizeof(Celestial_Type));
     type->kind = CIR_TYPE_FUNCTION;
     type->func_type.ret_type = ret;
     type->func_type.effects = effects;
@@ -0,0 +1,309 @@
+/**
+ * @file celestial_jobs.c
+ * @brief Parallel Per-Function Job Runner
+ *
+ * MC29: Native Backends
+ *
+ * A deliberately small pool: threads are created per module, claim
+ * indices from an atomic counter, and are joined before returning. The
+ * thread start cost is noise next to lowering thousands of functions,
+ * and it keeps the compiler free of global pool state.
+ */
+
+#include "seraph/seraphim/celestial_jobs.h"
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(SERAPH_USERSPACE) && !defined(SERAPH_KERNEL) && \
+    !defined(__STDC_NO_THREADS__) && defined(__has_include)
+#if __has_include(<threads.h>)
+#define CELESTIAL_JOBS_THREADS 1
+#endif
+#endif
+
+#ifdef CELESTIAL_JOBS_THREADS
+#include <threads.h>
+#include <stdatomic.h>
+#endif
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#elif !defined(SERAPH_KERNEL)
+#include <unistd.h>
+#endif
+
+/*============================================================================
+ * Worker Count
+ *============================================================================*/
+
+uint32_t celestial_jobs_hardware_threads(void) {
+#if defined(_WIN32)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? (uint32_t)info.dwNumberOfProcessors : 1;
+#elif !defined(SERAPH_KERNEL) && defined(_SC_NPROCESSORS_ONLN)
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (uint32_t)n : 1;
+#else
+    return 1;
+#endif
+}
+
+uint32_t celestial_jobs_effective(uint32_t requested, size_t count) {
+#ifdef CELESTIAL_JOBS_THREADS
+    uint32_t jobs = requested == 0 ? celestial_jobs_hardware_threads() : requested;
+    if (jobs > CELESTIAL_JOBS_MAX) jobs = CELESTIAL_JOBS_MAX;
+    if ((size_t)jobs > count) jobs = (uint32_t)count;
+    return jobs == 0 ? 1 : jobs;
+#else
+    (void)requested;
+    (void)count;
+    return 1;
+#endif
+}
+
+/*============================================================================
+ * Runner
+ *============================================================================*/
+
+#ifdef CELESTIAL_JOBS_THREADS
+
+typedef struct {
+    Celestial_Job_Fn fn;
+    void*            shared;
+    size_t           count;
+    atomic_size_t    next;
+} Jobs_Queue;
+
+typedef struct {
+    Jobs_Queue* queue;
+    uint32_t    worker;
+} Jobs_Worker;
+
+static void jobs_drain(Jobs_Queue* q, uint32_t worker) {
+    for (;;) {
+        size_t i = atomic_fetch_add_explicit(&q->next, 1, memory_order_relaxed);
+        if (i >= q->count) return;
+        q->fn(q->shared, worker, i);
+    }
+}
+
+static int jobs_thread_main(void* arg) {
+    Jobs_Worker* w = (Jobs_Worker*)arg;
+    jobs_drain(w->queue, w->worker);
+    return 0;
+}
+
+#endif /* CELESTIAL_JOBS_THREADS */
+
+uint32_t celestial_jobs_run(size_t count, uint32_t jobs,
+                            Celestial_Job_Fn fn, void* shared) {
+    if (!fn || count == 0) return 0;
+
+#ifdef CELESTIAL_JOBS_THREADS
+    if (jobs > 1) {
+        if (jobs > CELESTIAL_JOBS_MAX) jobs = CELESTIAL_JOBS_MAX;
+
+        Jobs_Queue queue;
+        queue.fn = fn;
+        queue.shared = shared;
+        queue.count = count;
+        atomic_init(&queue.next, 0);
+
+        thrd_t threads[CELESTIAL_JOBS_MAX];
+        Jobs_Worker workers[CELESTIAL_JOBS_MAX];
+        int started[CELESTIAL_JOBS_MAX] = {0};
+
+        /* Worker 0 is the calling thread */
+        for (uint32_t w = 1; w < jobs; w++) {
+            workers[w].queue = &queue;
+            workers[w].worker = w;
+            started[w] = thrd_create(&threads[w], jobs_thread_main, &workers[w]) == thrd_success;
+        }
+
+        jobs_drain(&queue, 0);
+
+        uint32_t ran = 1;
+        for (uint32_t w = 1; w < jobs; w++) {
+            if (started[w]) {
+                thrd_join(threads[w], NULL);
+                ran++;
+            }
+        }
+        return ran;
+    }
+#else
+    (void)jobs;
+#endif
+
+    for (size_t i = 0; i < count; i++) {
+        fn(shared, 0, i);
+    }
+    return 1;
+}
+
+/*============================================================================
+ * Function List
+ *============================================================================*/
+
+Celestial_Function** celestial_jobs_function_list(Celestial_Module* mod,
+                                                  size_t* out_count) {
+    if (out_count) *out_count = 0;
+    if (!mod) return NULL;
+
+    size_t count = 0;
+    for (Celestial_Function* fn = mod->functions; fn; fn = fn->next) {
+        count++;
+    }
+    if (count == 0) return NULL;
+
+    Celestial_Function** list = (Celestial_Function**)malloc(count * sizeof(*list));
+    if (!list) return NULL;
+
+    size_t i = 0;
+    for (Celestial_Function* fn = mod->functions; fn; fn = fn->next) {
+        list[i++] = fn;
+    }
+
+    if (out_count) *out_count = count;
+    return list;
+}
+
+/*============================================================================
+ * Fixed-Width Backends
+ *============================================================================*/
+
+typedef struct {
+    Seraph_Arena arena;
+    uint32_t*    words;         /**< Scratch instruction memory */
+} Words_Worker;
+
+typedef struct {
+    uint32_t* code;             /**< Instructions of one function (malloc'd) */
+    size_t    count;
+    int       ok;
+} Words_Unit;
+
+typedef struct {
+    Celestial_Function** fns;
+    Celestial_Words_Fn   fn;
+    void*                backend;
+    size_t               capacity;
+    Words_Worker*        workers;
+    Words_Unit*          units;
+} Words_Job;
+
+/**
+ * @brief Job callback: lower one function into its unit
+ */
+static void words_compile_unit(void* shared, uint32_t worker, size_t index) {
+    Words_Job* job = (Words_Job*)shared;
+    Words_Worker* w = &job->workers[worker];
+    Words_Unit* unit = &job->units[index];
+
+    seraph_arena_reset(&w->arena);
+    unit->count = job->fn(job->backend, job->fns[index], &w->arena, w->words, job->capacity);
+    if (unit->count > job->capacity) return;
+
+    unit->code = malloc(sizeof(uint32_t) * (unit->count ? unit->count : 1));
+    if (!unit->code) return;
+    memcpy(unit->code, w->words, sizeof(uint32_t) * unit->count);
+    unit->ok = 1;
+}
+
+Seraph_Vbit celestial_jobs_compile_words(Celestial_Module* mod, uint32_t jobs,
+                                         size_t capacity, Celestial_Words_Fn fn,
+                                         void* backend, uint32_t** out_words,
+                                         size_t* out_count, size_t** out_starts) {
+    if (!mod || !fn || !out_words || !out_count || !out_starts) {
+        return SERAPH_VBIT_VOID;
+    }
+    *out_words = NULL;
+    *out_count = 0;
+    *out_starts = NULL;
+
+    size_t fn_count = 0;
+    Celestial_Function** fns = celestial_jobs_function_list(mod, &fn_count);
+    uint32_t workers = celestial_jobs_effective(jobs, fn_count);
+    if (!fns || workers <= 1) {
+        free(fns);
+        return SERAPH_VBIT_FALSE;
+    }
+
+    Words_Job job;
+    job.fns = fns;
+    job.fn = fn;
+    job.backend = backend;
+    job.capacity = capacity ? capacity : 1;
+    job.units = calloc(fn_count, sizeof(Words_Unit));
+    job.workers = calloc(workers, sizeof(Words_Worker));
+    uint32_t* words = NULL;
+    size_t* starts = NULL;
+    Seraph_Vbit result = SERAPH_VBIT_FALSE;
+
+    uint32_t ready = 0;
+    if (job.units && job.workers) {
+        for (; ready < workers; ready++) {
+            Words_Worker* w = &job.workers[ready];
+            if (!seraph_vbit_is_true(seraph_arena_create(&w->arena, CELESTIAL_JOBS_ARENA_SIZE, 0,
+                                                          SERAPH_ARENA_FLAG_ZERO_ON_ALLOC))) {
+                break;
+            }
+            w->words = malloc(sizeof(uint32_t) * job.capacity);
+            if (!w->words) {
+                seraph_arena_destroy(&w->arena);
+                break;
+            }
+        }
+    }
+    if (ready == 0) {
+        goto done;
+    }
+
+    celestial_jobs_run(fn_count, ready, words_compile_unit, &job);
+
+    /* Any missing function would shift every later one: all or nothing */
+    size_t total = 0;
+    for (size_t i = 0; i < fn_count; i++) {
+        if (!job.units[i].ok) {
+            goto done;
+        }
+        total += job.units[i].count;
+    }
+
+    words = malloc(sizeof(uint32_t) * (total ? total : 1));
+    starts = malloc(sizeof(size_t) * fn_count);
+    if (!words || !starts) {
+        free(words);
+        free(starts);
+        goto done;
+    }
+
+    size_t pos = 0;
+    for (size_t i = 0; i < fn_count; i++) {
+        starts[i] = pos;
+        memcpy(words + pos, job.units[i].code, sizeof(uint32_t) * job.units[i].count);
+        pos += job.units[i].count;
+    }
+
+    *out_words = words;
+    *out_count = total;
+    *out_starts = starts;
+    result = SERAPH_VBIT_TRUE;
+
+done:
+    for (uint32_t w = 0; w < ready; w++) {
+        seraph_arena_destroy(&job.workers[w].arena);
+        free(job.workers[w].words);
+    }
+    if (job.units) {
+        for (size_t i = 0; i < fn_count; i++) {
+            free(job.units[i].code);
+        }
+    }
+    free(job.units);
+    free(job.workers);
+    free(fns);
+    return result;
+}
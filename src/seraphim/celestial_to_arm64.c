@@ -11,6 +11,8 @@
  */
 
 #include "seraph/seraphim/celestial_to_arm64.h"
+#include "seraph/seraphim/celestial_jobs.h"
+#include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
 
@@ -945,3 +947,69 @@ void arm64_compile_module(ARM64_Context* ctx) {
         arm64_patch(ctx->code, bl_index, bl_instr);
     }
 }
+
+/*============================================================================
+ * Parallel Module Compilation
+ *============================================================================*/
+
+/**
+ * @brief Lower one function for celestial_jobs_compile_words()
+ *
+ * Branch fixups are resolved inside the function, relative to its own
+ * start, so the instructions can be moved anywhere afterwards.
+ */
+static size_t arm64_compile_words(void* module, Celestial_Function* fn,
+                                  Seraph_Arena* arena, uint32_t* words, size_t capacity) {
+    ARM64_Buffer code;
+    arm64_buffer_init(&code, words, capacity * sizeof(uint32_t));
+
+    ARM64_Context ctx;
+    arm64_context_init(&ctx, &code, (Celestial_Module*)module, arena);
+    arm64_compile_function(&ctx, fn);
+    return code.count;
+}
+
+void arm64_compile_module_parallel(ARM64_Context* ctx, uint32_t jobs) {
+    if (!ctx || !ctx->module) return;
+
+    /* No function can be larger than the whole output buffer */
+    uint32_t* words = NULL;
+    size_t count = 0;
+    size_t* starts = NULL;
+    if (!seraph_vbit_is_true(celestial_jobs_compile_words(ctx->module, jobs, ctx->code->capacity,
+                                                          arm64_compile_words, ctx->module,
+                                                          &words, &count, &starts))) {
+        arm64_compile_module(ctx);
+        return;
+    }
+
+    /* Same layout as the serial path: startup stub, then functions in order */
+    size_t bl_index = arm64_emit_startup_stub(ctx);
+    size_t base = ctx->code->count;
+    size_t main_index = 0;
+    int found_main = 0;
+
+    size_t i = 0;
+    for (Celestial_Function* fn = ctx->module->functions; fn; fn = fn->next, i++) {
+        if (fn->name && strcmp(fn->name, "main") == 0) {
+            main_index = base + starts[i];
+            found_main = 1;
+        }
+    }
+    for (size_t k = 0; k < count; k++) {
+        arm64_emit(ctx->code, words[k]);
+    }
+
+    /* Patch BL instruction to call main */
+    if (found_main) {
+        /* ARM64 BL uses signed imm26 (in instructions, not bytes) as offset */
+        int32_t imm26 = (int32_t)(main_index - bl_index);
+
+        /* Encode BL: 100101 | imm26 */
+        uint32_t bl_instr = 0x94000000 | (imm26 & 0x03FFFFFF);
+        arm64_patch(ctx->code, bl_index, bl_instr);
+    }
+
+    free(words);
+    free(starts);
+}
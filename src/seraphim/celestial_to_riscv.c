@@ -11,6 +11,8 @@
  */
 
 #include "seraph/seraphim/celestial_to_riscv.h"
+#include "seraph/seraphim/celestial_jobs.h"
+#include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
 
@@ -1045,3 +1047,69 @@ void rv_compile_module(RV_Context* ctx) {
         rv_patch(ctx->code, jal_index, jal_instr);
     }
 }
+
+/*============================================================================
+ * Parallel Module Compilation
+ *============================================================================*/
+
+/**
+ * @brief Lower one function for celestial_jobs_compile_words()
+ *
+ * Branch fixups are resolved inside the function, relative to its own
+ * start, so the instructions can be moved anywhere afterwards.
+ */
+static size_t rv_compile_words(void* module, Celestial_Function* fn,
+                               Seraph_Arena* arena, uint32_t* words, size_t capacity) {
+    RV_Buffer code;
+    rv_buffer_init(&code, words, capacity * sizeof(uint32_t));
+
+    RV_Context ctx;
+    rv_context_init(&ctx, &code, (Celestial_Module*)module, arena);
+    rv_compile_function(&ctx, fn);
+    return code.count;
+}
+
+void rv_compile_module_parallel(RV_Context* ctx, uint32_t jobs) {
+    if (!ctx || !ctx->module) return;
+
+    /* No function can be larger than the whole output buffer */
+    uint32_t* words = NULL;
+    size_t count = 0;
+    size_t* starts = NULL;
+    if (!seraph_vbit_is_true(celestial_jobs_compile_words(ctx->module, jobs, ctx->code->capacity,
+                                                          rv_compile_words, ctx->module,
+                                                          &words, &count, &starts))) {
+        rv_compile_module(ctx);
+        return;
+    }
+
+    /* Same layout as the serial path: startup stub, then functions in order */
+    size_t jal_index = rv_emit_startup_stub(ctx);
+    size_t base = ctx->code->count;
+    size_t main_index = 0;
+    int found_main = 0;
+
+    size_t i = 0;
+    for (Celestial_Function* fn = ctx->module->functions; fn; fn = fn->next, i++) {
+        if (fn->name && strcmp(fn->name, "main") == 0) {
+            main_index = base + starts[i];
+            found_main = 1;
+        }
+    }
+    for (size_t k = 0; k < count; k++) {
+        rv_emit(ctx->code, words[k]);
+    }
+
+    /* Patch JAL instruction to call main */
+    if (found_main) {
+        /* RISC-V JAL offset is in bytes (instruction index * 4) */
+        int32_t offset_bytes = (int32_t)((main_index - jal_index) * 4);
+
+        /* Use the rv_jal helper which handles encoding */
+        uint32_t jal_instr = rv_jal(RV_RA, offset_bytes);
+        rv_patch(ctx->code, jal_index, jal_instr);
+    }
+
+    free(words);
+    free(starts);
+}
@@ -12,9 +12,13 @@
  *   3. VOID Semantics Implementation
  *   4. Capability-Based Memory Access
  *   5. Galactic Number Operations
+ *   6. Peephole Selection (store-load forwarding, immediate operands,
+ *      compare-and-branch fusion, fall-through jumps)
  */
 
 #include "seraph/seraphim/celestial_to_x64.h"
+#include "seraph/seraphim/celestial_jobs.h"
+#include <stdlib.h>
 #include <string.h>
 
 /*============================================================================
@@ -47,6 +51,10 @@ static Seraph_Vbit compile_block(X64_CompileContext* ctx, Celestial_Block* block
 static uint32_t get_or_create_block_label(X64_CompileContext* ctx, Celestial_Block* block);
 static void emit_move_if_needed(X64_CompileContext* ctx, X64_Reg dst, X64_Reg src);
 static int32_t alloc_spill_slot(X64_RegAlloc* ra, size_t size);
+static void x64_emit_frame_store(X64_CompileContext* ctx, int32_t offset,
+                                 X64_Reg src, X64_Size size);
+static void x64_emit_frame_load(X64_CompileContext* ctx, X64_Reg dst,
+                                int32_t offset, X64_Size size);
 
 /*============================================================================
  * Register Allocator Implementation
@@ -591,7 +599,7 @@ Seraph_Vbit x64_load_value(X64_CompileContext* ctx,
         emit_move_if_needed(ctx, dst_reg, src_reg);
     } else if (offset != -1) {
         /* Spilled to stack */
-        x64_mov_reg_mem(buf, dst_reg, X64_RBP, offset, X64_SZ_64);
+        x64_emit_frame_load(ctx, dst_reg, offset, X64_SZ_64);
     } else {
         return SERAPH_VBIT_FALSE;
     }
@@ -604,8 +612,6 @@ Seraph_Vbit x64_store_value(X64_CompileContext* ctx,
                              Celestial_Value* value) {
     if (!ctx || !value || !ctx->output) return SERAPH_VBIT_VOID;
 
-    X64_Buffer* buf = ctx->output;
-
     /* Get location */
     X64_Reg dst_reg;
     int32_t offset;
@@ -620,7 +626,7 @@ Seraph_Vbit x64_store_value(X64_CompileContext* ctx,
         emit_move_if_needed(ctx, dst_reg, src_reg);
     } else if (offset != -1) {
         /* Spilled to stack */
-        x64_mov_mem_reg(buf, X64_RBP, offset, src_reg, X64_SZ_64);
+        x64_emit_frame_store(ctx, offset, src_reg, X64_SZ_64);
     } else {
         return SERAPH_VBIT_FALSE;
     }
@@ -629,8 +635,246 @@ Seraph_Vbit x64_store_value(X64_CompileContext* ctx,
 }
 
 static void emit_move_if_needed(X64_CompileContext* ctx, X64_Reg dst, X64_Reg src) {
-    if (dst != src) {
-        x64_mov_reg_reg(ctx->output, dst, src, X64_SZ_64);
+    if (dst == src) return;
+
+    /* mov B, A right after mov A, B: both registers already agree */
+    X64_Buffer* buf = ctx->output;
+    if (ctx->mov_end == buf->size && ctx->mov_dst == src && ctx->mov_src == dst &&
+        ctx->labels->last_defined != buf->size) {
+        return;
+    }
+
+    x64_mov_reg_reg(buf, dst, src, X64_SZ_64);
+    ctx->mov_dst = dst;
+    ctx->mov_src = src;
+    ctx->mov_end = buf->size;
+}
+
+/*============================================================================
+ * Peephole Selection Helpers
+ *
+ * Instructions are lowered one at a time, so the straightforward output is
+ * full of spill-store/reload pairs, constants materialized into scratch
+ * registers, and booleans built with SETcc only to be tested again by the
+ * branch that consumes them. These helpers pick the cheaper form while
+ * emitting, so no pass has to rewrite the buffer (and its label, call and
+ * function-pointer fixups) afterwards.
+ *============================================================================*/
+
+/**
+ * @brief Store to an RBP-relative slot and remember it for forwarding
+ */
+static void x64_emit_frame_store(X64_CompileContext* ctx, int32_t offset,
+                                 X64_Reg src, X64_Size size) {
+    x64_mov_mem_reg(ctx->output, X64_RBP, offset, src, size);
+
+    if (size == X64_SZ_64) {
+        ctx->fwd_offset = offset;
+        ctx->fwd_reg = src;
+        ctx->fwd_end = ctx->output->size;
+    }
+}
+
+/**
+ * @brief Load from an RBP-relative slot, forwarding a store just emitted
+ *
+ * The store's source register still holds the value if nothing has been
+ * emitted since the store and no label (a possible jump target) was defined
+ * after it.
+ */
+static void x64_emit_frame_load(X64_CompileContext* ctx, X64_Reg dst,
+                                int32_t offset, X64_Size size) {
+    X64_Buffer* buf = ctx->output;
+
+    if (size == X64_SZ_64 && ctx->fwd_end == buf->size &&
+        ctx->fwd_offset == offset && ctx->labels->last_defined != buf->size) {
+        emit_move_if_needed(ctx, dst, ctx->fwd_reg);
+        return;
+    }
+
+    x64_mov_reg_mem(buf, dst, X64_RBP, offset, size);
+}
+
+/**
+ * @brief Constant usable as an imm32 without a VOID check
+ *
+ * Negative constants carry bit 63 (the VOID bit) once sign-extended, so
+ * only [0, INT32_MAX] skips the check the register form would perform.
+ */
+static int x64_const_imm32(Celestial_Value* value, int32_t* out) {
+    if (value == NULL || value->kind != CIR_VALUE_CONST) return 0;
+    int64_t imm = value->constant.i64;
+    if (imm < 0 || imm > INT32_MAX) return 0;
+    *out = (int32_t)imm;
+    return 1;
+}
+
+/**
+ * @brief Constant usable as a sign-extended imm32 (no VOID semantics)
+ */
+static int x64_const_simm32(Celestial_Value* value, int32_t* out) {
+    if (value == NULL || value->kind != CIR_VALUE_CONST) return 0;
+    int64_t imm = value->constant.i64;
+    if (imm < INT32_MIN || imm > INT32_MAX) return 0;
+    *out = (int32_t)imm;
+    return 1;
+}
+
+/**
+ * @brief RBP offset of an ALLOCA's storage, or 0 if not yet lowered
+ */
+static int32_t x64_frame_slot_of(X64_CompileContext* ctx, Celestial_Value* addr) {
+    if (ctx->frame_slots == NULL || addr == NULL ||
+        addr->kind != CIR_VALUE_VREG || addr->id >= ctx->value_id_limit) {
+        return 0;
+    }
+    return ctx->frame_slots[addr->id];
+}
+
+static int x64_is_compare(Celestial_Opcode opcode) {
+    switch (opcode) {
+        case CIR_EQ:  case CIR_NE:
+        case CIR_LT:  case CIR_LE:  case CIR_GT:  case CIR_GE:
+        case CIR_ULT: case CIR_ULE: case CIR_UGT: case CIR_UGE:
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+/**
+ * @brief Whether a comparison is emitted by the BRANCH that consumes it
+ *
+ * True when the comparison's only use is the next live instruction, a
+ * BRANCH on its result: the branch then emits CMP + Jcc directly instead
+ * of CMP + SETcc + MOVZX followed by CMP + Jcc.
+ */
+static int x64_compare_fuses(X64_CompileContext* ctx, Celestial_Instr* cmp) {
+    if (cmp == NULL || !x64_is_compare(cmp->opcode) || cmp->operand_count < 2) return 0;
+    if (cmp->result == NULL || cmp->result->kind != CIR_VALUE_VREG) return 0;
+    if (ctx->use_counts == NULL || cmp->result->id >= ctx->value_id_limit) return 0;
+    if (ctx->use_counts[cmp->result->id] != 1) return 0;
+
+    Celestial_Instr* next = cmp->next;
+    while (next != NULL && next->opcode == CIR_NOP) next = next->next;
+
+    return next != NULL && next->opcode == CIR_BRANCH &&
+           next->operand_count >= 1 && next->operands[0] == cmp->result;
+}
+
+/**
+ * @brief Emit the flag-setting part of a comparison
+ *
+ * Leaves the flags set for operands[0] vs operands[1]; a VOID operand
+ * jumps to void_label instead.
+ */
+static void x64_emit_compare(X64_CompileContext* ctx, Celestial_Instr* cmp,
+                             uint32_t void_label) {
+    X64_Buffer* buf = ctx->output;
+    int32_t imm;
+
+    x64_load_value(ctx, cmp->operands[0], X64_RAX);
+    x64_emit_void_check(ctx, X64_RAX, void_label);
+
+    if (x64_const_imm32(cmp->operands[1], &imm)) {
+        x64_cmp_reg_imm(buf, X64_RAX, imm, X64_SZ_64);
+    } else {
+        x64_load_value(ctx, cmp->operands[1], X64_RCX);
+        x64_emit_void_check(ctx, X64_RCX, void_label);
+        x64_cmp_reg_reg(buf, X64_RAX, X64_RCX, X64_SZ_64);
+    }
+}
+
+/**
+ * @brief Emit a two-way branch on cc, falling through where possible
+ */
+static void x64_emit_cond_branch(X64_CompileContext* ctx, X64_Condition cc,
+                                 Celestial_Block* then_block,
+                                 Celestial_Block* else_block) {
+    X64_Buffer* buf = ctx->output;
+    X64_Labels* labels = ctx->labels;
+    uint32_t then_label = get_or_create_block_label(ctx, then_block);
+    uint32_t else_label = get_or_create_block_label(ctx, else_block);
+
+    if (then_block == ctx->next_block && else_block != ctx->next_block) {
+        /* Condition codes pair up as cc / cc^1 (E/NE, L/GE, ...) */
+        x64_jcc_label(buf, (X64_Condition)(cc ^ 1), labels, else_label);
+        return;
+    }
+
+    x64_jcc_label(buf, cc, labels, then_label);
+    if (else_block != ctx->next_block) {
+        x64_jmp_label(buf, labels, else_label);
+    }
+}
+
+/**
+ * @brief Checked ADD/SUB/MUL with an immediate operand
+ *
+ * ADD and MUL commute, so a constant on the left is used as well.
+ *
+ * @return 1 if emitted (result in reg), 0 if the register form is needed
+ */
+static int x64_emit_arith_imm(X64_CompileContext* ctx, Celestial_Instr* instr,
+                              X64_Reg reg, uint32_t void_label) {
+    X64_Buffer* buf = ctx->output;
+    Celestial_Value* lhs = instr->operands[0];
+    Celestial_Value* rhs = instr->operands[1];
+    int32_t imm;
+
+    if (!x64_const_imm32(rhs, &imm)) {
+        if (instr->opcode == CIR_SUB || !x64_const_imm32(lhs, &imm)) return 0;
+        lhs = instr->operands[1];
+    }
+
+    x64_load_value(ctx, lhs, reg);
+    x64_emit_void_check(ctx, reg, void_label);
+    if (instr->opcode == CIR_ADD) {
+        x64_add_reg_imm(buf, reg, imm, X64_SZ_64);
+    } else if (instr->opcode == CIR_SUB) {
+        x64_sub_reg_imm(buf, reg, imm, X64_SZ_64);
+    } else {
+        x64_imul_reg_imm(buf, reg, reg, imm, X64_SZ_64);
+    }
+    x64_jcc_label(buf, X64_CC_O, ctx->labels, void_label);
+    return 1;
+}
+
+/**
+ * @brief Count operand uses of every value in the function
+ *
+ * Folded and dead instructions are CIR_NOP but keep their operands;
+ * they are skipped so they do not pin values.
+ */
+static void x64_count_uses(X64_CompileContext* ctx) {
+    Celestial_Function* fn = ctx->function;
+    uint32_t limit = fn->next_vreg_id;
+    if (limit == 0) return;
+
+    ctx->use_counts = (uint32_t*)seraph_arena_alloc(ctx->arena,
+        limit * sizeof(uint32_t), _Alignof(uint32_t));
+    ctx->frame_slots = (int32_t*)seraph_arena_alloc(ctx->arena,
+        limit * sizeof(int32_t), _Alignof(int32_t));
+    if (ctx->use_counts == NULL || ctx->frame_slots == NULL) {
+        ctx->use_counts = NULL;
+        ctx->frame_slots = NULL;
+        return;
+    }
+    memset(ctx->use_counts, 0, limit * sizeof(uint32_t));
+    memset(ctx->frame_slots, 0, limit * sizeof(int32_t));
+    ctx->value_id_limit = limit;
+
+    for (Celestial_Block* block = fn->blocks; block; block = block->next) {
+        for (Celestial_Instr* instr = block->first; instr; instr = instr->next) {
+            if (instr->opcode == CIR_NOP) continue;
+            for (size_t i = 0; i < instr->operand_count; i++) {
+                Celestial_Value* op = instr->operands[i];
+                if (op && (op->kind == CIR_VALUE_VREG || op->kind == CIR_VALUE_PARAM) &&
+                    op->id < limit) {
+                    ctx->use_counts[op->id]++;
+                }
+            }
+        }
     }
 }
 
@@ -1013,6 +1257,8 @@ Seraph_Vbit x64_lower_arithmetic(X64_CompileContext* ctx,
 
     switch (instr->opcode) {
         case CIR_ADD:
+            if (x64_emit_arith_imm(ctx, instr, op1_reg, void_label)) break;
+
             /* Load operands */
             x64_load_value(ctx, instr->operands[0], op1_reg);
             x64_load_value(ctx, instr->operands[1], op2_reg);
@@ -1029,6 +1275,7 @@ Seraph_Vbit x64_lower_arithmetic(X64_CompileContext* ctx,
             break;
 
         case CIR_SUB:
+            if (x64_emit_arith_imm(ctx, instr, op1_reg, void_label)) break;
             x64_load_value(ctx, instr->operands[0], op1_reg);
             x64_load_value(ctx, instr->operands[1], op2_reg);
             x64_emit_void_check(ctx, op1_reg, void_label);
@@ -1038,6 +1285,7 @@ Seraph_Vbit x64_lower_arithmetic(X64_CompileContext* ctx,
             break;
 
         case CIR_MUL:
+            if (x64_emit_arith_imm(ctx, instr, op1_reg, void_label)) break;
             x64_load_value(ctx, instr->operands[0], op1_reg);
             x64_load_value(ctx, instr->operands[1], op2_reg);
             x64_emit_void_check(ctx, op1_reg, void_label);
@@ -1144,7 +1392,7 @@ Seraph_Vbit x64_lower_arithmetic(X64_CompileContext* ctx,
     if (instr->result) {
         emit_move_if_needed(ctx, result_reg, op1_reg);
         if (result_offset != -1) {
-            x64_mov_mem_reg(buf, X64_RBP, result_offset, result_reg, X64_SZ_64);
+            x64_emit_frame_store(ctx, result_offset, result_reg, X64_SZ_64);
         }
     }
 
@@ -1168,22 +1416,35 @@ Seraph_Vbit x64_lower_bitwise(X64_CompileContext* ctx,
 
     X64_Reg op1_reg = X64_RAX;
     X64_Reg op2_reg = X64_RCX;
+    int32_t imm;
 
     switch (instr->opcode) {
         case CIR_AND:
             x64_load_value(ctx, instr->operands[0], op1_reg);
+            if (x64_const_simm32(instr->operands[1], &imm)) {
+                x64_and_reg_imm(buf, op1_reg, imm, X64_SZ_64);
+                break;
+            }
             x64_load_value(ctx, instr->operands[1], op2_reg);
             x64_and_reg_reg(buf, op1_reg, op2_reg, X64_SZ_64);
             break;
 
         case CIR_OR:
             x64_load_value(ctx, instr->operands[0], op1_reg);
+            if (x64_const_simm32(instr->operands[1], &imm)) {
+                x64_or_reg_imm(buf, op1_reg, imm, X64_SZ_64);
+                break;
+            }
             x64_load_value(ctx, instr->operands[1], op2_reg);
             x64_or_reg_reg(buf, op1_reg, op2_reg, X64_SZ_64);
             break;
 
         case CIR_XOR:
             x64_load_value(ctx, instr->operands[0], op1_reg);
+            if (x64_const_simm32(instr->operands[1], &imm)) {
+                x64_xor_reg_imm(buf, op1_reg, imm, X64_SZ_64);
+                break;
+            }
             x64_load_value(ctx, instr->operands[1], op2_reg);
             x64_xor_reg_reg(buf, op1_reg, op2_reg, X64_SZ_64);
             break;
@@ -1234,7 +1495,7 @@ Seraph_Vbit x64_lower_bitwise(X64_CompileContext* ctx,
     if (instr->result) {
         emit_move_if_needed(ctx, result_reg, op1_reg);
         if (result_offset != -1) {
-            x64_mov_mem_reg(buf, X64_RBP, result_offset, result_reg, X64_SZ_64);
+            x64_emit_frame_store(ctx, result_offset, result_reg, X64_SZ_64);
         }
     }
 
@@ -1257,19 +1518,17 @@ Seraph_Vbit x64_lower_comparison(X64_CompileContext* ctx,
         result_reg = X64_RAX;
     }
 
-    /* Load operands */
-    x64_load_value(ctx, instr->operands[0], X64_RAX);
-    x64_load_value(ctx, instr->operands[1], X64_RCX);
+    /* Consumed directly by the following BRANCH (see CIR_BRANCH) */
+    if (x64_compare_fuses(ctx, instr)) {
+        return SERAPH_VBIT_TRUE;
+    }
 
-    /* Check for VOID operands - comparison with VOID produces VOID */
+    /* Comparison with VOID produces VOID */
     uint32_t void_label = x64_label_create(labels);
     uint32_t end_label = x64_label_create(labels);
 
-    x64_emit_void_check(ctx, X64_RAX, void_label);
-    x64_emit_void_check(ctx, X64_RCX, void_label);
-
     /* Perform comparison */
-    x64_cmp_reg_reg(buf, X64_RAX, X64_RCX, X64_SZ_64);
+    x64_emit_compare(ctx, instr, void_label);
 
     /* Map opcode to condition code */
     X64_Condition cc = x64_cc_from_cir_cmp(instr->opcode);
@@ -1292,7 +1551,7 @@ Seraph_Vbit x64_lower_comparison(X64_CompileContext* ctx,
     if (instr->result) {
         emit_move_if_needed(ctx, result_reg, X64_RAX);
         if (result_offset != -1) {
-            x64_mov_mem_reg(buf, X64_RBP, result_offset, result_reg, X64_SZ_64);
+            x64_emit_frame_store(ctx, result_offset, result_reg, X64_SZ_64);
         }
     }
 
@@ -1326,25 +1585,35 @@ Seraph_Vbit x64_lower_control_flow(X64_CompileContext* ctx,
         case CIR_JUMP:
             {
                 uint32_t target_label = get_or_create_block_label(ctx, instr->target1);
-                x64_jmp_label(buf, labels, target_label);
+                if (instr->target1 != ctx->next_block) {
+                    x64_jmp_label(buf, labels, target_label);
+                }
             }
             break;
 
         case CIR_BRANCH:
             {
+                Celestial_Value* cond = instr->operands[0];
+                Celestial_Instr* cmp = (cond && cond->kind == CIR_VALUE_VREG) ?
+                                       cond->vreg.def : NULL;
+
+                if (x64_compare_fuses(ctx, cmp)) {
+                    /* cmp + jcc; a VOID operand takes the else edge, as a
+                     * VOID condition would */
+                    uint32_t else_label = get_or_create_block_label(ctx, instr->target2);
+                    x64_emit_compare(ctx, cmp, else_label);
+                    x64_emit_cond_branch(ctx, x64_cc_from_cir_cmp(cmp->opcode),
+                                         instr->target1, instr->target2);
+                    break;
+                }
+
                 /* Load condition */
-                x64_load_value(ctx, instr->operands[0], X64_RAX);
+                x64_load_value(ctx, cond, X64_RAX);
 
                 /* Test if TRUE (1) */
                 x64_cmp_reg_imm(buf, X64_RAX, 1, X64_SZ_8);
 
-                uint32_t then_label = get_or_create_block_label(ctx, instr->target1);
-                uint32_t else_label = get_or_create_block_label(ctx, instr->target2);
-
-                /* je then_label */
-                x64_jcc_label(buf, X64_CC_E, labels, then_label);
-                /* jmp else_label */
-                x64_jmp_label(buf, labels, else_label);
+                x64_emit_cond_branch(ctx, X64_CC_E, instr->target1, instr->target2);
             }
             break;
 
@@ -1687,7 +1956,7 @@ Seraph_Vbit x64_lower_void_op(X64_CompileContext* ctx,
     if (instr->result) {
         emit_move_if_needed(ctx, result_reg, X64_RAX);
         if (result_offset != -1) {
-            x64_mov_mem_reg(buf, X64_RBP, result_offset, result_reg, X64_SZ_64);
+            x64_emit_frame_store(ctx, result_offset, result_reg, X64_SZ_64);
         }
     }
 
@@ -2012,8 +2281,12 @@ Seraph_Vbit x64_lower_memory_op(X64_CompileContext* ctx,
     switch (instr->opcode) {
         case CIR_LOAD:
             {
-                /* Raw memory load (no capability check) */
-                x64_load_value(ctx, instr->operands[0], X64_RAX);  /* address */
+                /* Raw memory load (no capability check). Loads from an
+                 * ALLOCA address its frame slot directly. */
+                int32_t slot = x64_frame_slot_of(ctx, instr->operands[0]);
+                if (slot == 0) {
+                    x64_load_value(ctx, instr->operands[0], X64_RAX);  /* address */
+                }
 
                 /* Determine load size based on result type */
                 X64_Size load_sz = X64_SZ_64;
@@ -2040,7 +2313,9 @@ Seraph_Vbit x64_lower_memory_op(X64_CompileContext* ctx,
                 }
 
                 /* For sub-64-bit loads, use movzx/movsx or movsxd to zero/sign extend */
-                if (load_sz == X64_SZ_32) {
+                if (slot != 0) {
+                    x64_emit_frame_load(ctx, X64_RAX, slot, load_sz);
+                } else if (load_sz == X64_SZ_32) {
                     /* mov eax, [rax] - automatically zero-extends to 64-bit */
                     x64_mov_reg_mem(buf, X64_RAX, X64_RAX, 0, X64_SZ_32);
                 } else {
@@ -2056,7 +2331,10 @@ Seraph_Vbit x64_lower_memory_op(X64_CompileContext* ctx,
         case CIR_STORE:
             {
                 /* Raw memory store */
-                x64_load_value(ctx, instr->operands[0], X64_RDI);  /* address */
+                int32_t slot = x64_frame_slot_of(ctx, instr->operands[0]);
+                if (slot == 0) {
+                    x64_load_value(ctx, instr->operands[0], X64_RDI);  /* address */
+                }
                 x64_load_value(ctx, instr->operands[1], X64_RAX);  /* value */
 
                 /* Determine store size based on value type */
@@ -2083,7 +2361,11 @@ Seraph_Vbit x64_lower_memory_op(X64_CompileContext* ctx,
                     }
                 }
 
-                x64_mov_mem_reg(buf, X64_RDI, 0, X64_RAX, store_sz);
+                if (slot != 0) {
+                    x64_emit_frame_store(ctx, slot, X64_RAX, store_sz);
+                } else {
+                    x64_mov_mem_reg(buf, X64_RDI, 0, X64_RAX, store_sz);
+                }
             }
             break;
 
@@ -2110,6 +2392,12 @@ Seraph_Vbit x64_lower_memory_op(X64_CompileContext* ctx,
                 x64_lea(buf, X64_RAX, X64_RBP, data_offset);
                 x64_mov_mem_reg(buf, X64_RBP, addr_slot, X64_RAX, X64_SZ_64);
 
+                /* Later LOAD/STORE through this value can address the slot */
+                if (instr->result && ctx->frame_slots &&
+                    instr->result->id < ctx->value_id_limit) {
+                    ctx->frame_slots[instr->result->id] = data_offset;
+                }
+
                 /* Record the address slot as the value's location */
                 if (instr->result) {
                     /* Force spill location */
@@ -2161,9 +2449,15 @@ Seraph_Vbit x64_lower_memory_op(X64_CompileContext* ctx,
                     } else if (instr->operands[1]) {
                         /* Dynamic index: multiply at runtime */
                         x64_load_value(ctx, instr->operands[1], X64_RCX);  /* index */
-                        /* RCX = index * elem_size */
-                        x64_imul_reg_imm(buf, X64_RCX, X64_RCX, (int32_t)elem_size, X64_SZ_64);
-                        x64_add_reg_reg(buf, X64_RAX, X64_RCX, X64_SZ_64);
+                        if (elem_size == 1 || elem_size == 2 ||
+                            elem_size == 4 || elem_size == 8) {
+                            /* RAX = RAX + RCX * elem_size in one LEA */
+                            x64_lea_sib(buf, X64_RAX, X64_RAX, X64_RCX, (int)elem_size, 0);
+                        } else {
+                            /* RCX = index * elem_size */
+                            x64_imul_reg_imm(buf, X64_RCX, X64_RCX, (int32_t)elem_size, X64_SZ_64);
+                            x64_add_reg_reg(buf, X64_RAX, X64_RCX, X64_SZ_64);
+                        }
                     }
                 } else {
                     /* Struct GEP: operands[1] is already a byte offset */
@@ -2522,7 +2816,7 @@ Seraph_Vbit x64_lower_conversion(X64_CompileContext* ctx,
     if (instr->result) {
         emit_move_if_needed(ctx, result_reg, X64_RAX);
         if (result_offset != -1) {
-            x64_mov_mem_reg(buf, X64_RBP, result_offset, result_reg, X64_SZ_64);
+            x64_emit_frame_store(ctx, result_offset, result_reg, X64_SZ_64);
         }
     }
 
@@ -2582,6 +2876,9 @@ static Seraph_Vbit compile_block(X64_CompileContext* ctx, Celestial_Block* block
         }
     }
 
+    /* Blocks are laid out in list order; jumps to the next one fall through */
+    ctx->next_block = block->next;
+
     /* Lower each instruction in the block */
     uint32_t instr_count = 0;
     for (Celestial_Instr* instr = block->first; instr; instr = instr->next) {
@@ -2630,6 +2927,8 @@ Seraph_Vbit celestial_compile_function(Celestial_Function* fn,
     ctx.labels = labels;
     ctx.arena = arena;
     ctx.mod_ctx = mod_ctx;
+    ctx.fwd_end = SIZE_MAX;
+    ctx.mov_end = SIZE_MAX;
 
     /* Initialize register allocator */
     Seraph_Vbit ra_result = x64_regalloc_init(&ctx.regalloc, arena);
@@ -2644,6 +2943,9 @@ Seraph_Vbit celestial_compile_function(Celestial_Function* fn,
     }
     ctx.block_count = 0;
 
+    /* Use counts for compare-and-branch fusion */
+    x64_count_uses(&ctx);
+
     /* Compute live intervals */
     Seraph_Vbit li_result = x64_compute_live_intervals(&ctx);
     if (!seraph_vbit_is_true(li_result)) {
@@ -2720,6 +3022,24 @@ static size_t x64_emit_startup_stub(X64_Buffer* output) {
  * @brief Helper to find function offset in the module context
  */
 static size_t find_function_offset(X64_ModuleContext* mod_ctx, Celestial_Function* fn) {
+    if (mod_ctx->functions_sorted) {
+        size_t lo = 0;
+        size_t hi = mod_ctx->function_count;
+        while (lo < hi) {
+            size_t mid = lo + (hi - lo) / 2;
+            uintptr_t key = (uintptr_t)mod_ctx->functions[mid].fn;
+            if (key == (uintptr_t)fn) {
+                return mod_ctx->functions[mid].offset;
+            }
+            if (key < (uintptr_t)fn) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        return 0;  /* Not found - should not happen */
+    }
+
     for (size_t i = 0; i < mod_ctx->function_count; i++) {
         if (mod_ctx->functions[i].fn == fn) {
             return mod_ctx->functions[i].offset;
@@ -2728,6 +3048,55 @@ static size_t find_function_offset(X64_ModuleContext* mod_ctx, Celestial_Functio
     return 0;  /* Not found - should not happen */
 }
 
+/**
+ * @brief Write a little-endian rel32 at a code offset
+ */
+static void patch_rel32(X64_Buffer* output, size_t site, int32_t rel32) {
+    output->code[site + 0] = (uint8_t)(rel32 & 0xFF);
+    output->code[site + 1] = (uint8_t)((rel32 >> 8) & 0xFF);
+    output->code[site + 2] = (uint8_t)((rel32 >> 16) & 0xFF);
+    output->code[site + 3] = (uint8_t)((rel32 >> 24) & 0xFF);
+}
+
+/**
+ * @brief Patch the startup call, internal calls and function pointer loads
+ *
+ * @param startup_call_fixup Offset of the _start CALL rel32
+ * @param main_offset Offset of main, or SIZE_MAX if the module has none
+ */
+static void patch_module_fixups(X64_ModuleContext* mod_ctx, X64_Buffer* output,
+                                size_t startup_call_fixup, size_t main_offset) {
+    /* Patch startup CALL to main */
+    if (main_offset != SIZE_MAX) {
+        /* CALL rel32 ends 4 bytes after the operand */
+        patch_rel32(output, startup_call_fixup,
+                    (int32_t)(main_offset - (startup_call_fixup + 4)));
+    }
+
+    /* Patch all internal function calls */
+    for (size_t i = 0; i < mod_ctx->call_fixup_count; i++) {
+        X64_CallFixup* fixup = &mod_ctx->call_fixups[i];
+        size_t callee_offset = find_function_offset(mod_ctx, fixup->callee);
+
+        /* rel32 = target - (call_site + 4) */
+        /* call_site points to the rel32 operand, so PC after call is call_site + 4 */
+        patch_rel32(output, fixup->call_site,
+                    (int32_t)(callee_offset - (fixup->call_site + 4)));
+    }
+
+    /* Patch all function pointer loads */
+    for (size_t i = 0; i < mod_ctx->fnptr_fixup_count; i++) {
+        X64_FnptrFixup* fixup = &mod_ctx->fnptr_fixups[i];
+        size_t fn_offset = find_function_offset(mod_ctx, fixup->fn);
+
+        /* For LEA reg, [RIP + disp32]:
+         * disp32 = target - (fixup_site + 4)
+         * fixup_site points to the disp32, RIP is at fixup_site + 4 */
+        patch_rel32(output, fixup->fixup_site,
+                    (int32_t)(fn_offset - (fixup->fixup_site + 4)));
+    }
+}
+
 Seraph_Vbit celestial_compile_module(Celestial_Module* mod,
                                       X64_Buffer* output,
                                       Seraph_Arena* arena) {
@@ -2742,12 +3111,6 @@ Seraph_Vbit celestial_compile_module(Celestial_Module* mod,
         return SERAPH_VBIT_FALSE;
     }
 
-    /* Count functions */
-    size_t fn_count = 0;
-    for (Celestial_Function* fn = mod->functions; fn; fn = fn->next) {
-        fn_count++;
-    }
-
     /* Initialize module context for call fixup tracking */
     X64_ModuleContext mod_ctx;
     memset(&mod_ctx, 0, sizeof(mod_ctx));
@@ -2784,11 +3147,9 @@ Seraph_Vbit celestial_compile_module(Celestial_Module* mod,
 
     /* Emit startup stub first (entry point) */
     size_t startup_call_fixup = x64_emit_startup_stub(output);
-    size_t startup_call_end = startup_call_fixup + 4;  /* CALL rel32 ends 4 bytes after */
 
     /* First pass: record function offsets and compile */
-    size_t main_offset = 0;
-    int found_main = 0;
+    size_t main_offset = SIZE_MAX;
 
     for (Celestial_Function* fn = mod->functions; fn; fn = fn->next) {
         /* Record function offset before compiling */
@@ -2800,7 +3161,6 @@ Seraph_Vbit celestial_compile_module(Celestial_Module* mod,
 
         if (fn->name && strcmp(fn->name, "main") == 0) {
             main_offset = output->size;
-            found_main = 1;
         }
 
         Seraph_Vbit fn_result = celestial_compile_function(fn, mod, output,
@@ -2811,50 +3171,444 @@ Seraph_Vbit celestial_compile_module(Celestial_Module* mod,
         }
     }
 
-    /* Patch startup CALL to main */
-    if (found_main) {
-        int32_t rel32 = (int32_t)(main_offset - startup_call_end);
-        output->code[startup_call_fixup + 0] = (uint8_t)(rel32 & 0xFF);
-        output->code[startup_call_fixup + 1] = (uint8_t)((rel32 >> 8) & 0xFF);
-        output->code[startup_call_fixup + 2] = (uint8_t)((rel32 >> 16) & 0xFF);
-        output->code[startup_call_fixup + 3] = (uint8_t)((rel32 >> 24) & 0xFF);
+    /* Second pass: patch main, internal calls and function pointers */
+    patch_module_fixups(&mod_ctx, output, startup_call_fixup, main_offset);
+
+    /* Free labels (fixups already resolved) */
+    x64_labels_free(&labels);
+
+    return SERAPH_VBIT_TRUE;
+}
+
+/*============================================================================
+ * Parallel Module Compilation
+ *============================================================================*/
+
+/** Per-worker arena size; reset after every function */
+#define X64_WORKER_ARENA_SIZE (32 * 1024 * 1024)
+
+/**
+ * @brief Code and fixups of one function, offsets relative to its start
+ */
+typedef struct {
+    uint8_t*        code;
+    size_t          size;
+    X64_CallFixup*  calls;
+    size_t          call_count;
+    X64_FnptrFixup* fnptrs;
+    size_t          fnptr_count;
+    int             ok;
+} X64_FunctionUnit;
+
+/**
+ * @brief Private state of one worker thread
+ */
+typedef struct {
+    Seraph_Arena      arena;
+    X64_Buffer        code;
+    X64_Labels        labels;
+    X64_ModuleContext mod_ctx;
+} X64_Worker;
+
+typedef struct {
+    Celestial_Module*    mod;
+    Celestial_Function** fns;
+    X64_FunctionUnit*    units;
+    X64_Worker*          workers;
+    size_t*              todo;      /**< Function indices still to lower */
+} X64_ParallelJob;
+
+static void x64_worker_free(X64_Worker* w) {
+    seraph_arena_destroy(&w->arena);
+    x64_buf_free(&w->code);
+    x64_labels_free(&w->labels);
+    free(w->mod_ctx.call_fixups);
+    free(w->mod_ctx.fnptr_fixups);
+}
+
+static int x64_worker_init(X64_Worker* w) {
+    memset(w, 0, sizeof(*w));
+    if (!seraph_vbit_is_true(seraph_arena_create(&w->arena, X64_WORKER_ARENA_SIZE, 0,
+                                                  SERAPH_ARENA_FLAG_ZERO_ON_ALLOC))) {
+        return 0;
+    }
+    if (!seraph_vbit_is_true(x64_buf_init(&w->code, 64 * 1024)) ||
+        !seraph_vbit_is_true(x64_labels_init(&w->labels))) {
+        x64_worker_free(w);
+        return 0;
     }
 
-    /* Second pass: patch all internal function calls */
-    for (size_t i = 0; i < mod_ctx.call_fixup_count; i++) {
-        X64_CallFixup* fixup = &mod_ctx.call_fixups[i];
-        size_t callee_offset = find_function_offset(&mod_ctx, fixup->callee);
+    /* Workers only collect fixups; the function table lives in the merge */
+    w->mod_ctx.call_fixups = malloc(sizeof(X64_CallFixup) * SERAPH_X64_MAX_CALL_FIXUPS);
+    w->mod_ctx.call_fixup_capacity = SERAPH_X64_MAX_CALL_FIXUPS;
+    w->mod_ctx.fnptr_fixups = malloc(sizeof(X64_FnptrFixup) * SERAPH_X64_MAX_FNPTR_FIXUPS);
+    w->mod_ctx.fnptr_fixup_capacity = SERAPH_X64_MAX_FNPTR_FIXUPS;
+    if (!w->mod_ctx.call_fixups || !w->mod_ctx.fnptr_fixups) {
+        x64_worker_free(w);
+        return 0;
+    }
+    return 1;
+}
 
-        /* rel32 = target - (call_site + 4) */
-        /* call_site points to the rel32 operand, so PC after call is call_site + 4 */
-        int32_t rel32 = (int32_t)(callee_offset - (fixup->call_site + 4));
-        output->code[fixup->call_site + 0] = (uint8_t)(rel32 & 0xFF);
-        output->code[fixup->call_site + 1] = (uint8_t)((rel32 >> 8) & 0xFF);
-        output->code[fixup->call_site + 2] = (uint8_t)((rel32 >> 16) & 0xFF);
-        output->code[fixup->call_site + 3] = (uint8_t)((rel32 >> 24) & 0xFF);
+/**
+ * @brief Job callback: lower one function into its unit
+ */
+static void x64_compile_unit(void* shared, uint32_t worker, size_t index) {
+    X64_ParallelJob* job = (X64_ParallelJob*)shared;
+    X64_Worker* w = &job->workers[worker];
+    index = job->todo[index];
+    X64_FunctionUnit* unit = &job->units[index];
+
+    seraph_arena_reset(&w->arena);
+    w->code.size = 0;
+    x64_labels_reset(&w->labels);
+    w->mod_ctx.call_fixup_count = 0;
+    w->mod_ctx.fnptr_fixup_count = 0;
+
+    Seraph_Vbit result = celestial_compile_function(job->fns[index], job->mod,
+                                                     &w->code, &w->labels,
+                                                     &w->arena, &w->mod_ctx);
+    if (!seraph_vbit_is_true(result)) {
+        return;
+    }
+
+    unit->size = w->code.size;
+    unit->code = malloc(unit->size ? unit->size : 1);
+    unit->call_count = w->mod_ctx.call_fixup_count;
+    unit->calls = unit->call_count
+        ? malloc(sizeof(X64_CallFixup) * unit->call_count) : NULL;
+    unit->fnptr_count = w->mod_ctx.fnptr_fixup_count;
+    unit->fnptrs = unit->fnptr_count
+        ? malloc(sizeof(X64_FnptrFixup) * unit->fnptr_count) : NULL;
+    if (!unit->code || (unit->call_count && !unit->calls) ||
+        (unit->fnptr_count && !unit->fnptrs)) {
+        return;
+    }
+
+    memcpy(unit->code, w->code.code, unit->size);
+    if (unit->call_count) {
+        memcpy(unit->calls, w->mod_ctx.call_fixups,
+               sizeof(X64_CallFixup) * unit->call_count);
+    }
+    if (unit->fnptr_count) {
+        memcpy(unit->fnptrs, w->mod_ctx.fnptr_fixups,
+               sizeof(X64_FnptrFixup) * unit->fnptr_count);
+    }
+    unit->ok = 1;
+}
+
+static int compare_function_entries(const void* a, const void* b) {
+    uintptr_t fa = (uintptr_t)((const X64_FunctionEntry*)a)->fn;
+    uintptr_t fb = (uintptr_t)((const X64_FunctionEntry*)b)->fn;
+    return (fa > fb) - (fa < fb);
+}
+
+/**
+ * @brief Concatenate units in module order and rebase their fixups
+ */
+static Seraph_Vbit merge_function_units(X64_ParallelJob* job, size_t fn_count,
+                                        X64_Buffer* output, Seraph_Arena* arena) {
+    size_t total_calls = 0;
+    size_t total_fnptrs = 0;
+    for (size_t i = 0; i < fn_count; i++) {
+        if (!job->units[i].ok) {
+            return SERAPH_VBIT_FALSE;
+        }
+        total_calls += job->units[i].call_count;
+        total_fnptrs += job->units[i].fnptr_count;
     }
 
-    /* Third pass: patch all function pointer loads */
-    for (size_t i = 0; i < mod_ctx.fnptr_fixup_count; i++) {
-        X64_FnptrFixup* fixup = &mod_ctx.fnptr_fixups[i];
-        size_t fn_offset = find_function_offset(&mod_ctx, fixup->fn);
+    X64_ModuleContext mod_ctx;
+    memset(&mod_ctx, 0, sizeof(mod_ctx));
+    mod_ctx.functions = seraph_arena_alloc(arena, sizeof(X64_FunctionEntry) * fn_count, 8);
+    mod_ctx.call_fixups = seraph_arena_alloc(arena,
+        sizeof(X64_CallFixup) * (total_calls ? total_calls : 1), 8);
+    mod_ctx.fnptr_fixups = seraph_arena_alloc(arena,
+        sizeof(X64_FnptrFixup) * (total_fnptrs ? total_fnptrs : 1), 8);
+    if (!mod_ctx.functions || !mod_ctx.call_fixups || !mod_ctx.fnptr_fixups) {
+        return SERAPH_VBIT_FALSE;
+    }
+    mod_ctx.function_capacity = fn_count;
+    mod_ctx.call_fixup_capacity = total_calls;
+    mod_ctx.fnptr_fixup_capacity = total_fnptrs;
 
-        /* For LEA reg, [RIP + disp32]:
-         * disp32 = target - (fixup_site + 4)
-         * fixup_site points to the disp32, RIP is at fixup_site + 4 */
-        int32_t disp32 = (int32_t)(fn_offset - (fixup->fixup_site + 4));
-        output->code[fixup->fixup_site + 0] = (uint8_t)(disp32 & 0xFF);
-        output->code[fixup->fixup_site + 1] = (uint8_t)((disp32 >> 8) & 0xFF);
-        output->code[fixup->fixup_site + 2] = (uint8_t)((disp32 >> 16) & 0xFF);
-        output->code[fixup->fixup_site + 3] = (uint8_t)((disp32 >> 24) & 0xFF);
+    size_t startup_call_fixup = x64_emit_startup_stub(output);
+    size_t main_offset = SIZE_MAX;
+
+    for (size_t i = 0; i < fn_count; i++) {
+        X64_FunctionUnit* unit = &job->units[i];
+        size_t base = output->size;
+
+        mod_ctx.functions[mod_ctx.function_count].fn = job->fns[i];
+        mod_ctx.functions[mod_ctx.function_count].offset = base;
+        mod_ctx.function_count++;
+
+        if (job->fns[i]->name && strcmp(job->fns[i]->name, "main") == 0) {
+            main_offset = base;
+        }
+
+        if (!seraph_vbit_is_true(x64_buf_reserve(output, unit->size))) {
+            return SERAPH_VBIT_FALSE;
+        }
+        memcpy(output->code + base, unit->code, unit->size);
+        output->size += unit->size;
+
+        for (size_t c = 0; c < unit->call_count; c++) {
+            X64_CallFixup* fixup = &mod_ctx.call_fixups[mod_ctx.call_fixup_count++];
+            fixup->call_site = base + unit->calls[c].call_site;
+            fixup->callee = unit->calls[c].callee;
+        }
+        for (size_t f = 0; f < unit->fnptr_count; f++) {
+            X64_FnptrFixup* fixup = &mod_ctx.fnptr_fixups[mod_ctx.fnptr_fixup_count++];
+            fixup->fixup_site = base + unit->fnptrs[f].fixup_site;
+            fixup->fn = unit->fnptrs[f].fn;
+        }
     }
 
-    /* Free labels (fixups already resolved) */
-    x64_labels_free(&labels);
+    /* Thousands of functions: look offsets up by binary search */
+    qsort(mod_ctx.functions, mod_ctx.function_count, sizeof(X64_FunctionEntry),
+          compare_function_entries);
+    mod_ctx.functions_sorted = 1;
 
+    patch_module_fixups(&mod_ctx, output, startup_call_fixup, main_offset);
     return SERAPH_VBIT_TRUE;
 }
 
+/*============================================================================
+ * Incremental Compilation Cache
+ *============================================================================*/
+
+static int compare_names(const char* a, size_t a_len, const char* b, size_t b_len) {
+    int c = memcmp(a, b, a_len < b_len ? a_len : b_len);
+    if (c != 0) return c;
+    return (a_len > b_len) - (a_len < b_len);
+}
+
+static int compare_function_names(const void* a, const void* b) {
+    const Celestial_Function* fa = *(Celestial_Function* const*)a;
+    const Celestial_Function* fb = *(Celestial_Function* const*)b;
+    return compare_names(fa->name, fa->name_len, fb->name, fb->name_len);
+}
+
+/**
+ * @brief Functions sorted by name, or NULL if names are missing or repeated
+ *
+ * Cached relocations name their target, so every name must be unique.
+ */
+static Celestial_Function** sort_functions_by_name(Celestial_Function** fns, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        if (!fns[i]->name || fns[i]->name_len == 0) return NULL;
+    }
+    Celestial_Function** by_name = malloc(count * sizeof(*by_name));
+    if (!by_name) return NULL;
+    memcpy(by_name, fns, count * sizeof(*by_name));
+    qsort(by_name, count, sizeof(*by_name), compare_function_names);
+    for (size_t i = 1; i < count; i++) {
+        if (compare_function_names(&by_name[i - 1], &by_name[i]) == 0) {
+            free(by_name);
+            return NULL;
+        }
+    }
+    return by_name;
+}
+
+static Celestial_Function* find_function_by_name(Celestial_Function** by_name, size_t count,
+                                                 const char* name, size_t name_len) {
+    size_t lo = 0;
+    size_t hi = count;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        int c = compare_names(name, name_len, by_name[mid]->name, by_name[mid]->name_len);
+        if (c == 0) return by_name[mid];
+        if (c < 0) hi = mid;
+        else lo = mid + 1;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Rebuild a unit from a cache entry, resolving relocations by name
+ */
+static int x64_unit_from_cache(X64_FunctionUnit* unit, const Celestial_Cache_Entry* entry,
+                               Celestial_Function** by_name, size_t fn_count) {
+    for (size_t r = 0; r < entry->reloc_count; r++) {
+        if (entry->relocs[r].kind == CELESTIAL_CACHE_RELOC_CALL) unit->call_count++;
+        else unit->fnptr_count++;
+    }
+
+    unit->size = entry->code_size;
+    unit->code = malloc(unit->size ? unit->size : 1);
+    unit->calls = unit->call_count
+        ? malloc(sizeof(X64_CallFixup) * unit->call_count) : NULL;
+    unit->fnptrs = unit->fnptr_count
+        ? malloc(sizeof(X64_FnptrFixup) * unit->fnptr_count) : NULL;
+    if (!unit->code || (unit->call_count && !unit->calls) ||
+        (unit->fnptr_count && !unit->fnptrs)) {
+        goto miss;
+    }
+    memcpy(unit->code, entry->code, unit->size);
+
+    size_t calls = 0;
+    size_t fnptrs = 0;
+    for (size_t r = 0; r < entry->reloc_count; r++) {
+        const Celestial_Cache_Reloc* reloc = &entry->relocs[r];
+        Celestial_Function* target = find_function_by_name(by_name, fn_count,
+                                                           reloc->name, reloc->name_len);
+        if (!target) goto miss;
+        if (reloc->kind == CELESTIAL_CACHE_RELOC_CALL) {
+            unit->calls[calls].call_site = reloc->site;
+            unit->calls[calls].callee = target;
+            calls++;
+        } else {
+            unit->fnptrs[fnptrs].fixup_site = reloc->site;
+            unit->fnptrs[fnptrs].fn = target;
+            fnptrs++;
+        }
+    }
+    unit->ok = 1;
+    return 1;
+
+miss:
+    free(unit->code);
+    free(unit->calls);
+    free(unit->fnptrs);
+    memset(unit, 0, sizeof(*unit));
+    return 0;
+}
+
+static void x64_unit_to_cache(Celestial_Cache* cache, const uint8_t* key,
+                              const X64_FunctionUnit* unit) {
+    size_t count = unit->call_count + unit->fnptr_count;
+    Celestial_Cache_Entry entry;
+    memset(&entry, 0, sizeof(entry));
+    entry.code = unit->code;
+    entry.code_size = unit->size;
+    entry.relocs = count ? malloc(count * sizeof(Celestial_Cache_Reloc)) : NULL;
+    if (count && !entry.relocs) return;
+
+    for (size_t c = 0; c < unit->call_count; c++) {
+        Celestial_Cache_Reloc* reloc = &entry.relocs[entry.reloc_count++];
+        reloc->site = (uint32_t)unit->calls[c].call_site;
+        reloc->kind = CELESTIAL_CACHE_RELOC_CALL;
+        reloc->name = unit->calls[c].callee->name;
+        reloc->name_len = unit->calls[c].callee->name_len;
+    }
+    for (size_t f = 0; f < unit->fnptr_count; f++) {
+        Celestial_Cache_Reloc* reloc = &entry.relocs[entry.reloc_count++];
+        reloc->site = (uint32_t)unit->fnptrs[f].fixup_site;
+        reloc->kind = CELESTIAL_CACHE_RELOC_FNPTR;
+        reloc->name = unit->fnptrs[f].fn->name;
+        reloc->name_len = unit->fnptrs[f].fn->name_len;
+    }
+
+    /* A failed store only costs the next build a recompile */
+    celestial_cache_store(cache, key, &entry);
+    free(entry.relocs);
+}
+
+Seraph_Vbit celestial_compile_module_parallel(Celestial_Module* mod,
+                                               X64_Buffer* output,
+                                               Seraph_Arena* arena,
+                                               uint32_t jobs) {
+    return celestial_compile_module_cached(mod, output, arena, jobs, NULL);
+}
+
+Seraph_Vbit celestial_compile_module_cached(Celestial_Module* mod,
+                                             X64_Buffer* output,
+                                             Seraph_Arena* arena,
+                                             uint32_t jobs,
+                                             Celestial_Cache* cache) {
+    if (!mod || !output || !arena) {
+        return SERAPH_VBIT_VOID;
+    }
+
+    size_t fn_count = 0;
+    Celestial_Function** fns = celestial_jobs_function_list(mod, &fn_count);
+    Celestial_Function** by_name = NULL;
+    if (fns && cache) {
+        by_name = sort_functions_by_name(fns, fn_count);
+        if (!by_name) cache = NULL;
+    }
+    if (!fns || (!cache && celestial_jobs_effective(jobs, fn_count) <= 1)) {
+        free(fns);
+        return celestial_compile_module(mod, output, arena);
+    }
+
+    X64_ParallelJob job;
+    job.mod = mod;
+    job.fns = fns;
+    job.units = calloc(fn_count, sizeof(X64_FunctionUnit));
+    job.todo = malloc(fn_count * sizeof(size_t));
+    job.workers = NULL;
+    uint8_t (*keys)[CELESTIAL_CACHE_KEY_SIZE] = cache
+        ? malloc(fn_count * CELESTIAL_CACHE_KEY_SIZE) : NULL;
+    Seraph_Vbit result = SERAPH_VBIT_FALSE;
+    uint32_t ready = 0;
+
+    if (!job.units || !job.todo || (cache && !keys)) {
+        goto done;
+    }
+
+    /* Cache lookups run here; only the misses go to the workers */
+    size_t todo_count = 0;
+    for (size_t i = 0; i < fn_count; i++) {
+        if (cache) {
+            Celestial_Cache_Entry entry;
+            celestial_cache_key(cache, fns[i], keys[i]);
+            if (seraph_vbit_is_true(celestial_cache_load(cache, keys[i], &entry))) {
+                int hit = x64_unit_from_cache(&job.units[i], &entry, by_name, fn_count);
+                celestial_cache_entry_free(&entry);
+                if (hit) continue;
+            }
+        }
+        job.todo[todo_count++] = i;
+    }
+
+    if (todo_count > 0) {
+        uint32_t workers = celestial_jobs_effective(jobs, todo_count);
+        job.workers = calloc(workers, sizeof(X64_Worker));
+        if (job.workers) {
+            while (ready < workers && x64_worker_init(&job.workers[ready])) {
+                ready++;
+            }
+        }
+        if (ready == 0) {
+            goto done;
+        }
+        celestial_jobs_run(todo_count, ready, x64_compile_unit, &job);
+
+        if (cache) {
+            for (size_t t = 0; t < todo_count; t++) {
+                size_t i = job.todo[t];
+                if (job.units[i].ok) {
+                    x64_unit_to_cache(cache, keys[i], &job.units[i]);
+                }
+            }
+        }
+    }
+
+    result = merge_function_units(&job, fn_count, output, arena);
+
+done:
+    for (uint32_t w = 0; w < ready; w++) {
+        x64_worker_free(&job.workers[w]);
+    }
+    if (job.units) {
+        for (size_t i = 0; i < fn_count; i++) {
+            free(job.units[i].code);
+            free(job.units[i].calls);
+            free(job.units[i].fnptrs);
+        }
+    }
+    free(job.units);
+    free(job.workers);
+    free(job.todo);
+    free(keys);
+    free(by_name);
+    free(fns);
+    return result;
+}
+
 /*============================================================================
  * Utility Functions
  *============================================================================*/
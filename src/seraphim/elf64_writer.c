@@ -1077,7 +1077,9 @@ Seraph_Vbit seraph_elf_from_celestial(Celestial_Module* module,
 Seraph_Vbit seraph_elf_from_celestial_target(Celestial_Module* module,
                                               const Seraph_Proof_Table* proofs,
                                               Seraph_Elf_Target target,
-                                              const char* filename) {
+                                              const char* filename,
+                                              uint32_t jobs,
+                                              Celestial_Cache* cache) {
     if (!module || !filename) {
         return SERAPH_VBIT_VOID;
     }
@@ -1109,7 +1111,7 @@ Seraph_Vbit seraph_elf_from_celestial_target(Celestial_Module* module,
                 return SERAPH_VBIT_FALSE;
             }
 
-            result = celestial_compile_module(module, &code_buf, &arena);
+            result = celestial_compile_module_cached(module, &code_buf, &arena, jobs, cache);
             if (!seraph_vbit_is_true(result)) {
                 x64_buf_free(&code_buf);
                 seraph_arena_destroy(&arena);
@@ -1140,7 +1142,7 @@ Seraph_Vbit seraph_elf_from_celestial_target(Celestial_Module* module,
 
             ARM64_Context ctx;
             arm64_context_init(&ctx, &code_buf, module, &arena);
-            arm64_compile_module(&ctx);
+            arm64_compile_module_parallel(&ctx, jobs);
 
             /* Copy code to persistent buffer */
             code_size = arm64_buffer_pos(&code_buf) * sizeof(uint32_t);
@@ -1165,7 +1167,7 @@ Seraph_Vbit seraph_elf_from_celestial_target(Celestial_Module* module,
 
             RV_Context ctx;
             rv_context_init(&ctx, &code_buf, module, &arena);
-            rv_compile_module(&ctx);
+            rv_compile_module_parallel(&ctx, jobs);
 
             /* Copy code to persistent buffer */
             code_size = rv_buffer_pos(&code_buf) * sizeof(uint32_t);
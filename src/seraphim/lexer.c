@@ -147,85 +147,126 @@ static void skip_whitespace_and_comments(Seraph_Lexer* lexer) {
 
 typedef struct {
     const char* name;
+    uint8_t len;
     Seraph_Token_Type type;
 } Keyword_Entry;
 
+#define KEYWORD(name, type) { name, sizeof(name) - 1, type }
+
 static const Keyword_Entry keywords[] = {
     /* Control flow */
-    {"fn",       SERAPH_TOK_FN},
-    {"let",      SERAPH_TOK_LET},
-    {"mut",      SERAPH_TOK_MUT},
-    {"if",       SERAPH_TOK_IF},
-    {"else",     SERAPH_TOK_ELSE},
-    {"for",      SERAPH_TOK_FOR},
-    {"while",    SERAPH_TOK_WHILE},
-    {"return",   SERAPH_TOK_RETURN},
-    {"match",    SERAPH_TOK_MATCH},
-    {"in",       SERAPH_TOK_IN},
-    {"break",    SERAPH_TOK_BREAK},
-    {"continue", SERAPH_TOK_CONTINUE},
-    {"as",       SERAPH_TOK_AS},
+    KEYWORD("fn",       SERAPH_TOK_FN),
+    KEYWORD("let",      SERAPH_TOK_LET),
+    KEYWORD("mut",      SERAPH_TOK_MUT),
+    KEYWORD("if",       SERAPH_TOK_IF),
+    KEYWORD("else",     SERAPH_TOK_ELSE),
+    KEYWORD("for",      SERAPH_TOK_FOR),
+    KEYWORD("while",    SERAPH_TOK_WHILE),
+    KEYWORD("return",   SERAPH_TOK_RETURN),
+    KEYWORD("match",    SERAPH_TOK_MATCH),
+    KEYWORD("in",       SERAPH_TOK_IN),
+    KEYWORD("break",    SERAPH_TOK_BREAK),
+    KEYWORD("continue", SERAPH_TOK_CONTINUE),
+    KEYWORD("as",       SERAPH_TOK_AS),
 
     /* Declarations */
-    {"struct",   SERAPH_TOK_STRUCT},
-    {"enum",     SERAPH_TOK_ENUM},
-    {"const",    SERAPH_TOK_CONST},
-    {"use",      SERAPH_TOK_USE},
-    {"foreign",  SERAPH_TOK_FOREIGN},
-    {"type",     SERAPH_TOK_TYPE},
-    {"impl",     SERAPH_TOK_IMPL},
+    KEYWORD("struct",   SERAPH_TOK_STRUCT),
+    KEYWORD("enum",     SERAPH_TOK_ENUM),
+    KEYWORD("const",    SERAPH_TOK_CONST),
+    KEYWORD("use",      SERAPH_TOK_USE),
+    KEYWORD("foreign",  SERAPH_TOK_FOREIGN),
+    KEYWORD("type",     SERAPH_TOK_TYPE),
+    KEYWORD("impl",     SERAPH_TOK_IMPL),
 
     /* Substrate blocks */
-    {"persist",  SERAPH_TOK_PERSIST},
-    {"aether",   SERAPH_TOK_AETHER_BLOCK},
-    {"recover",  SERAPH_TOK_RECOVER},
-    {"effects",  SERAPH_TOK_EFFECTS},
+    KEYWORD("persist",  SERAPH_TOK_PERSIST),
+    KEYWORD("aether",   SERAPH_TOK_AETHER_BLOCK),
+    KEYWORD("recover",  SERAPH_TOK_RECOVER),
+    KEYWORD("effects",  SERAPH_TOK_EFFECTS),
 
     /* Effects */
-    {"pure",     SERAPH_TOK_PURE},
-    {"VOID",     SERAPH_TOK_EFFECT_VOID},
-    {"PERSIST",  SERAPH_TOK_EFFECT_PERSIST},
-    {"NETWORK",  SERAPH_TOK_EFFECT_NETWORK},
-    {"TIMER",    SERAPH_TOK_EFFECT_TIMER},
-    {"IO",       SERAPH_TOK_EFFECT_IO},
+    KEYWORD("pure",     SERAPH_TOK_PURE),
+    KEYWORD("VOID",     SERAPH_TOK_EFFECT_VOID),
+    KEYWORD("PERSIST",  SERAPH_TOK_EFFECT_PERSIST),
+    KEYWORD("NETWORK",  SERAPH_TOK_EFFECT_NETWORK),
+    KEYWORD("TIMER",    SERAPH_TOK_EFFECT_TIMER),
+    KEYWORD("IO",       SERAPH_TOK_EFFECT_IO),
 
     /* Primitive types */
-    {"u8",       SERAPH_TOK_U8},
-    {"u16",      SERAPH_TOK_U16},
-    {"u32",      SERAPH_TOK_U32},
-    {"u64",      SERAPH_TOK_U64},
-    {"i8",       SERAPH_TOK_I8},
-    {"i16",      SERAPH_TOK_I16},
-    {"i32",      SERAPH_TOK_I32},
-    {"i64",      SERAPH_TOK_I64},
-    {"bool",     SERAPH_TOK_BOOL},
-    {"char",     SERAPH_TOK_CHAR},
-    {"f32",      SERAPH_TOK_F32},
-    {"f64",      SERAPH_TOK_F64},
+    KEYWORD("u8",       SERAPH_TOK_U8),
+    KEYWORD("u16",      SERAPH_TOK_U16),
+    KEYWORD("u32",      SERAPH_TOK_U32),
+    KEYWORD("u64",      SERAPH_TOK_U64),
+    KEYWORD("i8",       SERAPH_TOK_I8),
+    KEYWORD("i16",      SERAPH_TOK_I16),
+    KEYWORD("i32",      SERAPH_TOK_I32),
+    KEYWORD("i64",      SERAPH_TOK_I64),
+    KEYWORD("bool",     SERAPH_TOK_BOOL),
+    KEYWORD("char",     SERAPH_TOK_CHAR),
+    KEYWORD("f32",      SERAPH_TOK_F32),
+    KEYWORD("f64",      SERAPH_TOK_F64),
 
     /* Numeric types */
-    {"scalar",   SERAPH_TOK_SCALAR},
-    {"dual",     SERAPH_TOK_DUAL},
-    {"galactic", SERAPH_TOK_GALACTIC},
+    KEYWORD("scalar",   SERAPH_TOK_SCALAR),
+    KEYWORD("dual",     SERAPH_TOK_DUAL),
+    KEYWORD("galactic", SERAPH_TOK_GALACTIC),
 
     /* Substrate types */
-    {"volatile", SERAPH_TOK_VOLATILE},
-    {"atlas",    SERAPH_TOK_ATLAS},
+    KEYWORD("volatile", SERAPH_TOK_VOLATILE),
+    KEYWORD("atlas",    SERAPH_TOK_ATLAS),
 
     /* Literals */
-    {"true",     SERAPH_TOK_TRUE},
-    {"false",    SERAPH_TOK_FALSE},
-    {"void",     SERAPH_TOK_VOID_LIT},
-    {"null",     SERAPH_TOK_VOID_LIT},  /* null == VOID for pointers */
+    KEYWORD("true",     SERAPH_TOK_TRUE),
+    KEYWORD("false",    SERAPH_TOK_FALSE),
+    KEYWORD("void",     SERAPH_TOK_VOID_LIT),
+    KEYWORD("null",     SERAPH_TOK_VOID_LIT),  /* null == VOID for pointers */
+
+    {NULL, 0, SERAPH_TOK_VOID}
+};
+
+/*
+ * Perfect hash over keywords[]: every keyword lands in its own slot of
+ * keyword_slots[], which holds (index into keywords[]) + 1, or 0 for an
+ * empty slot. A lookup is one hash, one table load and one memcmp.
+ *
+ * The multipliers were found by search so the 51 keywords do not
+ * collide in 128 slots. After adding a keyword, regenerate the table
+ * (and the multipliers, if needed); the lexer tests look up every keyword.
+ */
+#define KEYWORD_MIN_LEN 2
+#define KEYWORD_MAX_LEN 8
+#define KEYWORD_SLOTS   128
+
+static inline uint32_t keyword_hash(const char* name, size_t len) {
+    const uint8_t* s = (const uint8_t*)name;
+    return ((uint32_t)s[0] * 15u + (uint32_t)s[len - 1] * 19u +
+            (uint32_t)len * 18u + (uint32_t)s[1]) & (KEYWORD_SLOTS - 1);
+}
 
-    {NULL, SERAPH_TOK_VOID}
+static const uint8_t keyword_slots[KEYWORD_SLOTS] = {
+     0,  0, 43, 17,  0, 48, 47, 23,  0,  0,  0,  2, 19, 50,  0, 21,
+    36, 18,  0,  0,  0,  6,  0, 30,  0, 41,  0,  0,  0, 44,  5,  0,
+     0,  0,  0, 34,  0, 29,  0,  0,  0,  8,  3, 35,  0, 26,  0, 27,
+     0,  0, 16, 51, 49,  0,  1,  0, 15, 14,  7,  0,  0,  0,  0,  0,
+     0,  0, 42,  4, 32,  0, 37,  0,  0,  0,  0, 12, 25,  0,  0, 13,
+     0,  0,  0, 45,  0,  0,  9,  0, 24,  0,  0,  0,  0,  0,  0, 31,
+    20,  0,  0, 10,  0,  0, 28,  0, 46,  0,  0,  0,  0,  0,  0, 38,
+     0,  0,  0, 40,  0,  0, 22,  0,  0, 39, 33, 11,  0,  0,  0,  0,
 };
 
 Seraph_Token_Type seraph_lexer_lookup_keyword(const char* name, size_t len) {
-    for (const Keyword_Entry* entry = keywords; entry->name != NULL; entry++) {
-        if (strlen(entry->name) == len && memcmp(entry->name, name, len) == 0) {
-            return entry->type;
-        }
+    if (len < KEYWORD_MIN_LEN || len > KEYWORD_MAX_LEN) {
+        return SERAPH_TOK_IDENT;
+    }
+
+    uint8_t slot = keyword_slots[keyword_hash(name, len)];
+    if (slot == 0) {
+        return SERAPH_TOK_IDENT;
+    }
+
+    const Keyword_Entry* entry = &keywords[slot - 1];
+    if (entry->len == len && memcmp(entry->name, name, len) == 0) {
+        return entry->type;
     }
     return SERAPH_TOK_IDENT;
 }
@@ -6,11 +6,35 @@
  */
 
 #include "seraph/seraphim/sbf_loader.h"
+#include "seraph/seraphim/celestial_jobs.h"
 #include "seraph/crypto/sha256.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
 
+#if !defined(SERAPH_KERNEL) && (defined(__unix__) || defined(__APPLE__))
+#define SBF_LOADER_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/*============================================================================
+ * Chunk Verification State
+ *============================================================================*/
+
+enum {
+    SBF_CHUNK_UNCHECKED = 0,
+    SBF_CHUNK_VERIFIED  = 1,
+    SBF_CHUNK_CORRUPT   = 2,
+};
+
+struct SBF_Chunk_Cache {
+    uint64_t verified_bytes;            /* Content bytes hashed and matched */
+    uint8_t state[];                    /* SBF_CHUNK_* per chunk */
+};
+
 /*============================================================================
  * Default Configuration
  *============================================================================*/
@@ -23,6 +47,8 @@ static const SBF_Loader_Config default_config = {
     .require_signed = false,
     .min_kernel_version = 0,
     .max_kernel_version = 0,
+    .lazy_verify = false,
+    .verify_threads = 0,
 };
 
 /*============================================================================
@@ -84,11 +110,56 @@ const char* sbf_load_error_name(SBF_Load_Error error) {
  * Loading
  *============================================================================*/
 
+#ifdef SBF_LOADER_MMAP
+/* Map the whole file read-only; returns false to fall back to reading */
+static bool map_file(SBF_Loader* loader, const char* path, SBF_Load_Error* error) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        *error = SBF_LOAD_ERR_IO;
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+        close(fd);
+        return false;
+    }
+    if ((uint64_t)st.st_size < SBF_HEADER_SIZE) {
+        close(fd);
+        *error = SBF_LOAD_ERR_TRUNCATED;
+        return false;
+    }
+
+    void* map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) return false;
+
+    if (loader->config.lazy_verify) {
+        /* Sections are touched on demand; skip speculative readahead */
+        madvise(map, (size_t)st.st_size, MADV_RANDOM);
+    }
+
+    loader->data = (uint8_t*)map;
+    loader->data_size = (size_t)st.st_size;
+    loader->owns_data = false;
+    loader->mapped = true;
+    return true;
+}
+#endif
+
 SBF_Load_Error sbf_loader_load_file(SBF_Loader* loader, const char* path) {
     if (loader == NULL) return SBF_LOAD_ERR_ALLOC;
     if (loader->loaded) return (loader->last_error = SBF_LOAD_ERR_ALREADY_LOADED);
     if (path == NULL) return (loader->last_error = SBF_LOAD_ERR_IO);
 
+#ifdef SBF_LOADER_MMAP
+    SBF_Load_Error map_error = SBF_LOAD_OK;
+    if (map_file(loader, path, &map_error)) {
+        return sbf_loader_load_buffer(loader, loader->data, loader->data_size, false);
+    }
+    if (map_error != SBF_LOAD_OK) return (loader->last_error = map_error);
+#endif
+
     /* Open file */
     FILE* f = fopen(path, "rb");
     if (f == NULL) return (loader->last_error = SBF_LOAD_ERR_IO);
@@ -132,6 +203,43 @@ SBF_Load_Error sbf_loader_load_file(SBF_Loader* loader, const char* path) {
     return sbf_loader_load_buffer(loader, loader->data, loader->data_size, false);
 }
 
+/* Locate and bounds-check the chunk table of an SBF_FLAG_CHUNKED file */
+static bool parse_chunk_table(SBF_Loader* loader) {
+    const SBF_Header* hdr = loader->header;
+
+    if (!(hdr->flags & SBF_FLAG_CHUNKED)) return true;
+    if (hdr->chunks_offset < SBF_HEADER_SIZE ||
+        hdr->chunks_size < sizeof(SBF_Chunk_Table) ||
+        hdr->chunks_offset > loader->data_size ||
+        hdr->chunks_size > loader->data_size - hdr->chunks_offset) {
+        return false;
+    }
+
+    const SBF_Chunk_Table* table =
+        (const SBF_Chunk_Table*)(loader->data + hdr->chunks_offset);
+    if (table->magic != SBF_CHUNK_MAGIC) return false;
+    if (table->chunk_shift < SBF_CHUNK_SHIFT_MIN || table->chunk_shift > SBF_CHUNK_SHIFT_MAX) {
+        return false;
+    }
+    if (table->covered_size != hdr->chunks_offset - SBF_HEADER_SIZE) return false;
+
+    uint64_t chunk_count = (table->covered_size + (1ull << table->chunk_shift) - 1) >>
+                           table->chunk_shift;
+    if (chunk_count == 0 || chunk_count != table->chunk_count) return false;
+    if (table->node_count != sha256_merkle_tree_nodes(table->chunk_count)) return false;
+    if ((uint64_t)table->node_count * SHA256_DIGEST_SIZE >
+        hdr->chunks_size - sizeof(SBF_Chunk_Table)) {
+        return false;
+    }
+
+    loader->chunk_cache = (SBF_Chunk_Cache*)calloc(1, sizeof(SBF_Chunk_Cache) + table->chunk_count);
+    if (loader->chunk_cache == NULL) return false;
+
+    loader->chunk_table = table;
+    loader->chunk_tree = (const uint8_t*)table + sizeof(SBF_Chunk_Table);
+    return true;
+}
+
 static bool parse_sections(SBF_Loader* loader) {
     const SBF_Header* hdr = loader->header;
 
@@ -178,6 +286,16 @@ static bool parse_sections(SBF_Loader* loader) {
             loader->proofs = (const SBF_Proof_Entry*)(
                 (const uint8_t*)loader->proof_table + sizeof(SBF_Proof_Table));
         }
+
+        /* Stored proof tree follows the entries when it fits */
+        uint64_t entries_size = sizeof(SBF_Proof_Table) +
+            (uint64_t)loader->proof_table->entry_count * sizeof(SBF_Proof_Entry);
+        uint64_t tree_size = (uint64_t)sha256_merkle_tree_nodes(loader->proof_table->entry_count) *
+                             SHA256_DIGEST_SIZE;
+        if (entries_size > hdr->proofs_size) return false;
+        if (tree_size > 0 && hdr->proofs_size - entries_size >= tree_size) {
+            loader->proof_tree = (const uint8_t*)loader->proof_table + entries_size;
+        }
     }
 
     /* Parse capability table */
@@ -208,7 +326,7 @@ static bool parse_sections(SBF_Loader* loader) {
             (const uint8_t*)loader->string_table + sizeof(SBF_String_Table));
     }
 
-    return true;
+    return parse_chunk_table(loader);
 }
 
 SBF_Load_Error sbf_loader_load_buffer(
@@ -272,10 +390,21 @@ void sbf_loader_unload(SBF_Loader* loader) {
         memset(loader->data, 0, loader->data_size);
         free(loader->data);
     }
+#ifdef SBF_LOADER_MMAP
+    if (loader->mapped && loader->data != NULL) {
+        munmap(loader->data, loader->data_size);
+    }
+#endif
+    free(loader->chunk_cache);
 
     loader->data = NULL;
     loader->data_size = 0;
     loader->owns_data = false;
+    loader->mapped = false;
+    loader->chunk_cache = NULL;
+    loader->chunk_table = NULL;
+    loader->chunk_tree = NULL;
+    loader->proof_tree = NULL;
     loader->loaded = false;
     loader->header = NULL;
     loader->manifest = NULL;
@@ -299,6 +428,103 @@ bool sbf_loader_is_loaded(const SBF_Loader* loader) {
     return loader->loaded;
 }
 
+/*============================================================================
+ * Chunked Content Hash
+ *============================================================================*/
+
+static uint64_t chunk_length(const SBF_Chunk_Table* table, size_t index) {
+    uint64_t start = (uint64_t)index << table->chunk_shift;
+    uint64_t size = 1ull << table->chunk_shift;
+    return table->covered_size - start < size ? table->covered_size - start : size;
+}
+
+static void hash_chunk(const SBF_Loader* loader, size_t index, uint8_t* digest) {
+    const SBF_Chunk_Table* table = loader->chunk_table;
+    sha256(loader->data + SBF_HEADER_SIZE + ((uint64_t)index << table->chunk_shift),
+           (size_t)chunk_length(table, index), digest);
+}
+
+/* Hash one chunk and check it against content_hash through its Merkle path */
+static bool verify_chunk(const SBF_Loader* loader, size_t index) {
+    SBF_Chunk_Cache* cache = loader->chunk_cache;
+    if (cache->state[index] != SBF_CHUNK_UNCHECKED) {
+        return cache->state[index] == SBF_CHUNK_VERIFIED;
+    }
+
+    uint8_t digest[SHA256_DIGEST_SIZE];
+    hash_chunk(loader, index, digest);
+    bool ok = sha256_merkle_verify_path(digest, index, loader->chunk_table->chunk_count,
+                                        loader->chunk_tree,
+                                        loader->header->content_hash) == 1;
+
+    cache->state[index] = ok ? SBF_CHUNK_VERIFIED : SBF_CHUNK_CORRUPT;
+    if (ok) {
+        cache->verified_bytes += chunk_length(loader->chunk_table, index);
+    }
+    return ok;
+}
+
+/* Verify the chunks under [offset, offset + size); the header is not hashed */
+static bool verify_chunks_in_range(const SBF_Loader* loader, uint64_t offset, uint64_t size) {
+    const SBF_Chunk_Table* table = loader->chunk_table;
+    uint64_t end = offset + size < offset ? UINT64_MAX : offset + size;
+
+    if (offset < SBF_HEADER_SIZE) offset = SBF_HEADER_SIZE;
+    if (end > loader->header->chunks_offset) end = loader->header->chunks_offset;
+    if (offset >= end) return true;
+
+    size_t first = (size_t)((offset - SBF_HEADER_SIZE) >> table->chunk_shift);
+    size_t last = (size_t)((end - 1 - SBF_HEADER_SIZE) >> table->chunk_shift);
+    for (size_t i = first; i <= last; i++) {
+        if (!verify_chunk(loader, i)) return false;
+    }
+    return true;
+}
+
+/* Section getters: with lazy_verify, check the chunks behind a section first */
+static bool lazy_section_ok(const SBF_Loader* loader, uint64_t offset, uint64_t size) {
+    if (!loader->config.lazy_verify || loader->chunk_cache == NULL) return true;
+    return verify_chunks_in_range(loader, offset, size);
+}
+
+typedef struct {
+    const SBF_Loader* loader;
+    uint8_t* digests;
+} Chunk_Hash_Job;
+
+static void chunk_hash_job(void* shared, uint32_t worker, size_t index) {
+    (void)worker;
+    Chunk_Hash_Job* job = (Chunk_Hash_Job*)shared;
+    hash_chunk(job->loader, index, &job->digests[index * SHA256_DIGEST_SIZE]);
+}
+
+/* Hash every chunk on the job runner and compare the rebuilt root */
+static bool verify_all_chunks(SBF_Loader* loader) {
+    const SBF_Chunk_Table* table = loader->chunk_table;
+    SBF_Chunk_Cache* cache = loader->chunk_cache;
+    size_t count = table->chunk_count;
+
+    Chunk_Hash_Job job = {
+        .loader = loader,
+        .digests = (uint8_t*)malloc(count * SHA256_DIGEST_SIZE),
+    };
+    if (job.digests == NULL) return false;
+
+    uint32_t jobs = celestial_jobs_effective(loader->config.verify_threads, count);
+    celestial_jobs_run(count, jobs, chunk_hash_job, &job);
+
+    int result = sha256_merkle_root_alloc(job.digests, count, loader->computed_content_hash);
+    free(job.digests);
+    if (result != 1) return false;
+
+    bool ok = sha256_equal(loader->computed_content_hash, loader->header->content_hash) == 1;
+    if (ok) {
+        memset(cache->state, SBF_CHUNK_VERIFIED, count);
+        cache->verified_bytes = table->covered_size;
+    }
+    return ok;
+}
+
 /*============================================================================
  * Validation
  *============================================================================*/
@@ -317,6 +543,22 @@ SBF_Validation_Result sbf_loader_validate(SBF_Loader* loader) {
         return result;
     }
 
+    /* Lazy mode still checks what validation itself reads */
+    if (loader->config.verify_content_hash && loader->config.lazy_verify &&
+        loader->chunk_cache != NULL) {
+        bool ok = verify_chunks_in_range(loader, loader->header->manifest_offset,
+                                         loader->header->manifest_size);
+        if (ok && loader->proof_table != NULL) {
+            ok = verify_chunks_in_range(loader, loader->header->proofs_offset,
+                                        sizeof(SBF_Proof_Table));
+        }
+        if (!ok) {
+            loader->validation_result = SBF_ERR_HASH_MISMATCH;
+            loader->last_error = SBF_LOAD_ERR_HASH_MISMATCH;
+            return SBF_ERR_HASH_MISMATCH;
+        }
+    }
+
     /* Verify manifest */
     if (loader->manifest == NULL) {
         loader->validation_result = SBF_ERR_MANIFEST_INVALID;
@@ -341,8 +583,9 @@ SBF_Validation_Result sbf_loader_validate(SBF_Loader* loader) {
         }
     }
 
-    /* Verify content hash if configured */
-    if (loader->config.verify_content_hash) {
+    /* Verify content hash if configured (lazy mode defers it to section access) */
+    bool lazy = loader->config.lazy_verify && loader->chunk_cache != NULL;
+    if (loader->config.verify_content_hash && !lazy) {
         if (!sbf_loader_verify_content_hash(loader)) {
             loader->validation_result = SBF_ERR_HASH_MISMATCH;
             loader->last_error = SBF_LOAD_ERR_HASH_MISMATCH;
@@ -352,7 +595,14 @@ SBF_Validation_Result sbf_loader_validate(SBF_Loader* loader) {
 
     /* Verify proof Merkle root if configured */
     if (loader->config.verify_proof_root && loader->proof_table != NULL) {
-        if (!sbf_loader_verify_proof_root(loader)) {
+        bool ok;
+        if (lazy && loader->proof_tree != NULL) {
+            /* Entries are checked one at a time by sbf_loader_verify_proof() */
+            ok = sha256_equal(loader->proof_table->merkle_root, loader->header->proof_root) == 1;
+        } else {
+            ok = sbf_loader_verify_proof_root(loader);
+        }
+        if (!ok) {
             loader->validation_result = SBF_ERR_PROOF_ROOT_MISMATCH;
             loader->last_error = SBF_LOAD_ERR_PROOF_ROOT;
             return SBF_ERR_PROOF_ROOT_MISMATCH;
@@ -394,6 +644,10 @@ bool sbf_loader_verify_content_hash(SBF_Loader* loader) {
     if (loader == NULL || !loader->loaded) return false;
     if (loader->data_size <= SBF_HEADER_SIZE) return false;
 
+    if (loader->chunk_cache != NULL) {
+        return verify_all_chunks(loader);
+    }
+
     /* Compute hash of everything after header */
     sha256(loader->data + SBF_HEADER_SIZE,
            loader->data_size - SBF_HEADER_SIZE,
@@ -433,6 +687,38 @@ bool sbf_loader_verify_proof_root(SBF_Loader* loader) {
     return sha256_equal(loader->computed_proof_root, loader->header->proof_root);
 }
 
+bool sbf_loader_verify_range(SBF_Loader* loader, uint64_t offset, uint64_t size) {
+    if (loader == NULL || !loader->loaded) return false;
+    if (loader->chunk_cache == NULL) {
+        return sbf_loader_verify_content_hash(loader);
+    }
+    return verify_chunks_in_range(loader, offset, size);
+}
+
+uint64_t sbf_loader_get_verified_bytes(const SBF_Loader* loader) {
+    if (loader == NULL || !loader->loaded || loader->chunk_cache == NULL) return 0;
+    return loader->chunk_cache->verified_bytes;
+}
+
+bool sbf_loader_verify_proof(SBF_Loader* loader, size_t index) {
+    if (loader == NULL || !loader->loaded || loader->proofs == NULL) return false;
+    if (index >= loader->proof_table->entry_count) return false;
+
+    /* The entry must be the one the content hash covers */
+    const SBF_Proof_Entry* entry = &loader->proofs[index];
+    if (loader->chunk_cache != NULL &&
+        !verify_chunks_in_range(loader, (uint64_t)((const uint8_t*)entry - loader->data),
+                                sizeof(*entry))) {
+        return false;
+    }
+
+    if (loader->proof_tree == NULL) {
+        return sbf_loader_verify_proof_root(loader);
+    }
+    return sha256_merkle_verify_path(entry->hash, index, loader->proof_table->entry_count,
+                                     loader->proof_tree, loader->header->proof_root) == 1;
+}
+
 bool sbf_loader_has_failed_proofs(const SBF_Loader* loader) {
     if (loader == NULL || !loader->loaded || loader->proof_table == NULL) return false;
     return loader->proof_table->failed_count > 0;
@@ -454,6 +740,8 @@ const SBF_Header* sbf_loader_get_header(const SBF_Loader* loader) {
 
 const SBF_Manifest* sbf_loader_get_manifest(const SBF_Loader* loader) {
     if (loader == NULL || !loader->loaded) return NULL;
+    const SBF_Header* hdr = loader->header;
+    if (!lazy_section_ok(loader, hdr->manifest_offset, hdr->manifest_size)) return NULL;
     return loader->manifest;
 }
 
@@ -481,7 +769,12 @@ const void* sbf_loader_get_code(const SBF_Loader* loader, size_t* out_size) {
         if (out_size) *out_size = 0;
         return NULL;
     }
-    if (out_size) *out_size = (size_t)loader->header->code_size;
+    const SBF_Header* hdr = loader->header;
+    if (!lazy_section_ok(loader, hdr->code_offset, hdr->code_size)) {
+        if (out_size) *out_size = 0;
+        return NULL;
+    }
+    if (out_size) *out_size = (size_t)hdr->code_size;
     return loader->code;
 }
 
@@ -490,7 +783,12 @@ const void* sbf_loader_get_rodata(const SBF_Loader* loader, size_t* out_size) {
         if (out_size) *out_size = 0;
         return NULL;
     }
-    if (out_size) *out_size = (size_t)loader->header->rodata_size;
+    const SBF_Header* hdr = loader->header;
+    if (!lazy_section_ok(loader, hdr->rodata_offset, hdr->rodata_size)) {
+        if (out_size) *out_size = 0;
+        return NULL;
+    }
+    if (out_size) *out_size = (size_t)hdr->rodata_size;
     return loader->rodata;
 }
 
@@ -499,7 +797,12 @@ const void* sbf_loader_get_data(const SBF_Loader* loader, size_t* out_size) {
         if (out_size) *out_size = 0;
         return NULL;
     }
-    if (out_size) *out_size = (size_t)loader->header->data_size;
+    const SBF_Header* hdr = loader->header;
+    if (!lazy_section_ok(loader, hdr->data_offset, hdr->data_size)) {
+        if (out_size) *out_size = 0;
+        return NULL;
+    }
+    if (out_size) *out_size = (size_t)hdr->data_size;
     return loader->data_section;
 }
 
@@ -514,13 +817,21 @@ uint64_t sbf_loader_get_bss_size(const SBF_Loader* loader) {
 
 const SBF_Proof_Table* sbf_loader_get_proof_table(const SBF_Loader* loader) {
     if (loader == NULL || !loader->loaded) return NULL;
+    if (!lazy_section_ok(loader, loader->header->proofs_offset, sizeof(SBF_Proof_Table))) {
+        return NULL;
+    }
     return loader->proof_table;
 }
 
 const SBF_Proof_Entry* sbf_loader_get_proof(const SBF_Loader* loader, size_t index) {
     if (loader == NULL || !loader->loaded || loader->proofs == NULL) return NULL;
     if (loader->proof_table == NULL || index >= loader->proof_table->entry_count) return NULL;
-    return &loader->proofs[index];
+    const SBF_Proof_Entry* entry = &loader->proofs[index];
+    if (!lazy_section_ok(loader, (uint64_t)((const uint8_t*)entry - loader->data),
+                         sizeof(*entry))) {
+        return NULL;
+    }
+    return entry;
 }
 
 size_t sbf_loader_get_proof_count(const SBF_Loader* loader) {
@@ -544,12 +855,18 @@ size_t sbf_loader_get_failed_count(const SBF_Loader* loader) {
 
 const SBF_Cap_Table* sbf_loader_get_cap_table(const SBF_Loader* loader) {
     if (loader == NULL || !loader->loaded) return NULL;
+    if (!lazy_section_ok(loader, loader->header->caps_offset, loader->header->caps_size)) {
+        return NULL;
+    }
     return loader->cap_table;
 }
 
 const SBF_Cap_Template* sbf_loader_get_capability(const SBF_Loader* loader, size_t index) {
     if (loader == NULL || !loader->loaded || loader->caps == NULL) return NULL;
     if (loader->cap_table == NULL || index >= loader->cap_table->entry_count) return NULL;
+    if (!lazy_section_ok(loader, loader->header->caps_offset, loader->header->caps_size)) {
+        return NULL;
+    }
     return &loader->caps[index];
 }
 
@@ -579,12 +896,18 @@ const SBF_Cap_Template* sbf_loader_get_stack_cap(const SBF_Loader* loader) {
 
 const SBF_Effect_Table* sbf_loader_get_effect_table(const SBF_Loader* loader) {
     if (loader == NULL || !loader->loaded) return NULL;
+    if (!lazy_section_ok(loader, loader->header->effects_offset, loader->header->effects_size)) {
+        return NULL;
+    }
     return loader->effect_table;
 }
 
 const SBF_Effect_Entry* sbf_loader_get_effect(const SBF_Loader* loader, size_t index) {
     if (loader == NULL || !loader->loaded || loader->effects == NULL) return NULL;
     if (loader->effect_table == NULL || index >= loader->effect_table->entry_count) return NULL;
+    if (!lazy_section_ok(loader, loader->header->effects_offset, loader->header->effects_size)) {
+        return NULL;
+    }
     return &loader->effects[index];
 }
 
@@ -605,6 +928,9 @@ uint32_t sbf_loader_get_effect_mask(const SBF_Loader* loader) {
 const char* sbf_loader_get_string(const SBF_Loader* loader, uint32_t offset) {
     if (loader == NULL || !loader->loaded || loader->strings == NULL) return NULL;
     if (loader->string_table == NULL) return NULL;
+    if (!lazy_section_ok(loader, loader->header->strings_offset, loader->header->strings_size)) {
+        return NULL;
+    }
 
     /* Check bounds */
     size_t string_data_size = loader->string_table->total_size - sizeof(SBF_String_Table);
@@ -590,16 +590,26 @@ size_t sbf_writer_get_effect_count(const SBF_Writer* writer) {
  *============================================================================*/
 
 static bool compute_proof_merkle_root(SBF_Writer* writer) {
+    free(writer->merkle_nodes);
+    writer->merkle_nodes = NULL;
+    writer->merkle_node_count = 0;
+
     if (writer->proofs.count == 0) {
         /* No proofs - set root to zeros */
         memset(writer->proof_table_header.merkle_root, 0, SHA256_DIGEST_SIZE);
         return true;
     }
 
-    /* Allocate space for leaf hashes */
+    /* Allocate space for leaf hashes and the stored tree */
     size_t leaf_count = writer->proofs.count;
+    size_t node_count = sha256_merkle_tree_nodes(leaf_count);
     uint8_t* leaves = (uint8_t*)malloc(leaf_count * SHA256_DIGEST_SIZE);
-    if (leaves == NULL) return false;
+    uint8_t* nodes = (uint8_t*)malloc(node_count * SHA256_DIGEST_SIZE);
+    if (leaves == NULL || nodes == NULL) {
+        free(leaves);
+        free(nodes);
+        return false;
+    }
 
     /* Copy proof hashes as leaves */
     for (size_t i = 0; i < leaf_count; i++) {
@@ -608,12 +618,74 @@ static bool compute_proof_merkle_root(SBF_Writer* writer) {
                SHA256_DIGEST_SIZE);
     }
 
-    /* Compute Merkle root */
-    int result = sha256_merkle_root_alloc(leaves, leaf_count,
-        writer->proof_table_header.merkle_root);
+    /* Build the full tree so loaders can check single proofs */
+    int result = sha256_merkle_tree(leaves, leaf_count, nodes);
+    free(leaves);
+    if (result != 1) {
+        free(nodes);
+        return false;
+    }
+
+    writer->merkle_nodes = nodes;
+    writer->merkle_node_count = node_count;
+    memcpy(writer->proof_table_header.merkle_root,
+           &nodes[(node_count - 1) * SHA256_DIGEST_SIZE],
+           SHA256_DIGEST_SIZE);
+    return true;
+}
+
+/*============================================================================
+ * Chunked Content Hash
+ *============================================================================*/
+
+static uint32_t writer_chunk_shift(const SBF_Writer* writer) {
+    uint32_t shift = writer->config.chunk_shift;
+    if (shift == 0) return SBF_CHUNK_SHIFT_DEFAULT;
+    if (shift < SBF_CHUNK_SHIFT_MIN) return SBF_CHUNK_SHIFT_MIN;
+    if (shift > SBF_CHUNK_SHIFT_MAX) return SBF_CHUNK_SHIFT_MAX;
+    return shift;
+}
+
+/**
+ * Hash every content chunk, store the Merkle tree in the chunk table and
+ * set content_hash to its root. Everything before chunks_offset must
+ * already be written.
+ */
+static bool write_chunk_table(SBF_Writer* writer) {
+    SBF_Chunk_Table table;
+    memset(&table, 0, sizeof(table));
+    table.magic = SBF_CHUNK_MAGIC;
+    table.chunk_shift = writer_chunk_shift(writer);
+    table.covered_size = writer->header.chunks_offset - SBF_HEADER_SIZE;
+
+    uint64_t chunk_size = 1ull << table.chunk_shift;
+    size_t chunk_count = (size_t)((table.covered_size + chunk_size - 1) >> table.chunk_shift);
+    size_t node_count = sha256_merkle_tree_nodes(chunk_count);
+    table.chunk_count = (uint32_t)chunk_count;
+    table.node_count = (uint32_t)node_count;
+
+    uint8_t* leaves = (uint8_t*)malloc(chunk_count * SHA256_DIGEST_SIZE);
+    if (leaves == NULL) return false;
 
+    const uint8_t* content = writer->output + SBF_HEADER_SIZE;
+    for (size_t i = 0; i < chunk_count; i++) {
+        uint64_t start = (uint64_t)i << table.chunk_shift;
+        uint64_t len = table.covered_size - start < chunk_size
+            ? table.covered_size - start : chunk_size;
+        sha256(content + start, (size_t)len, &leaves[i * SHA256_DIGEST_SIZE]);
+    }
+
+    uint8_t* table_ptr = writer->output + writer->header.chunks_offset;
+    uint8_t* tree = table_ptr + sizeof(SBF_Chunk_Table);
+    int result = sha256_merkle_tree(leaves, chunk_count, tree);
     free(leaves);
-    return result == 1;
+    if (result != 1) return false;
+
+    memcpy(table_ptr, &table, sizeof(table));
+    memcpy(writer->header.content_hash,
+           &tree[(node_count - 1) * SHA256_DIGEST_SIZE],
+           SHA256_DIGEST_SIZE);
+    return true;
 }
 
 /*============================================================================
@@ -671,7 +743,8 @@ static void compute_layout(SBF_Writer* writer) {
         offset = align_offset(offset, 8);
         writer->header.proofs_offset = offset;
         writer->header.proofs_size = sizeof(SBF_Proof_Table) +
-            writer->proofs.count * sizeof(SBF_Proof_Entry);
+            writer->proofs.count * sizeof(SBF_Proof_Entry) +
+            sha256_merkle_tree_nodes(writer->proofs.count) * SHA256_DIGEST_SIZE;
         offset += writer->header.proofs_size;
     } else {
         writer->header.proofs_offset = 0;
@@ -713,6 +786,16 @@ static void compute_layout(SBF_Writer* writer) {
         writer->header.strings_size = 0;
     }
 
+    /* Chunk table (8-byte aligned, always last: it hashes everything before it) */
+    offset = align_offset(offset, 8);
+    uint32_t shift = writer_chunk_shift(writer);
+    uint64_t covered = offset - SBF_HEADER_SIZE;
+    size_t chunk_count = (size_t)((covered + (1ull << shift) - 1) >> shift);
+    writer->header.chunks_offset = offset;
+    writer->header.chunks_size = sizeof(SBF_Chunk_Table) +
+        sha256_merkle_tree_nodes(chunk_count) * SHA256_DIGEST_SIZE;
+    offset += writer->header.chunks_size;
+
     /* Total size */
     writer->header.total_size = offset;
 }
@@ -730,7 +813,7 @@ SBF_Write_Error sbf_writer_finalize(SBF_Writer* writer) {
     memset(&writer->header, 0, sizeof(writer->header));
     writer->header.magic = SBF_MAGIC;
     writer->header.version = SBF_VERSION;
-    writer->header.flags = writer->config.flags;
+    writer->header.flags = writer->config.flags | SBF_FLAG_CHUNKED;
     writer->header.header_size = SBF_HEADER_SIZE;
     writer->header.entry_point = writer->config.entry_point;
     writer->header.architecture = writer->config.architecture;
@@ -865,6 +948,10 @@ SBF_Write_Error sbf_writer_finalize(SBF_Writer* writer) {
         memcpy(proof_ptr + sizeof(SBF_Proof_Table),
                writer->proofs.entries,
                writer->proofs.count * sizeof(SBF_Proof_Entry));
+        memcpy(proof_ptr + sizeof(SBF_Proof_Table) +
+                   writer->proofs.count * sizeof(SBF_Proof_Entry),
+               writer->merkle_nodes,
+               writer->merkle_node_count * SHA256_DIGEST_SIZE);
     }
 
     /* Write capability table */
@@ -894,14 +981,15 @@ SBF_Write_Error sbf_writer_finalize(SBF_Writer* writer) {
                writer->strings.size);
     }
 
-    /* Compute content hash (everything after header) */
-    if (writer->header.total_size > SBF_HEADER_SIZE) {
-        sha256(writer->output + SBF_HEADER_SIZE,
-               writer->output_size - SBF_HEADER_SIZE,
-               writer->header.content_hash);
-        /* Update header in output with content hash */
-        memcpy(writer->output, &writer->header, sizeof(writer->header));
+    /* Compute chunked content hash (everything between header and chunk table) */
+    if (!write_chunk_table(writer)) {
+        free(writer->output);
+        writer->output = NULL;
+        writer->output_size = 0;
+        return (writer->last_error = SBF_WRITE_ERR_HASH_FAIL);
     }
+    /* Update header in output with content hash */
+    memcpy(writer->output, &writer->header, sizeof(writer->header));
 
     /* TODO: Sign manifest if keys provided */
     if (writer->config.author_private_key != NULL) {
@@ -17,6 +17,7 @@
  *   --emit-c      Output C code (transpilation mode)
  *   -O<n>         Optimization level (0-3)
  *   --target=<t>  Target architecture (x64, arm64, riscv64)
+ *   --cache-dir=<d> Reuse unchanged functions' code across builds
  *   --help        Show help
  *   --version     Show version
  *
@@ -32,6 +33,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 
 #include "seraph/arena.h"
 #include "seraph/vbit.h"
@@ -39,6 +41,9 @@
 #include "seraph/seraphim/parser.h"
 #include "seraph/seraphim/checker.h"
 #include "seraph/seraphim/celestial_ir.h"
+#include "seraph/seraphim/celestial_inline.h"
+#include "seraph/seraphim/celestial_cache.h"
+#include "seraph/seraphim/celestial_jobs.h"
 #include "seraph/seraphim/celestial_to_x64.h"
 #include "seraph/seraphim/celestial_to_arm64.h"
 #include "seraph/seraphim/celestial_to_riscv.h"
@@ -59,6 +64,13 @@
 #define SERAPHIC_VERSION_PATCH 0
 #define SERAPHIC_VERSION_STRING "0.1.0"
 
+#define SERAPHIC_STRINGIFY_(x) #x
+#define SERAPHIC_STRINGIFY(x) SERAPHIC_STRINGIFY_(x)
+
+/** Cache entries from another compiler or backend version are never reused */
+#define SERAPHIC_CACHE_ID "seraphic " SERAPHIC_VERSION_STRING \
+    " x64-codegen " SERAPHIC_STRINGIFY(SERAPH_X64_CODEGEN_VERSION)
+
 /*============================================================================
  * Compilation Options
  *============================================================================*/
@@ -83,6 +95,8 @@ typedef struct {
     Seraphic_Target     target;
     Seraphic_Output_Type output_type;
     int                 opt_level;
+    uint32_t            jobs;           /**< Code generation threads (0 = auto) */
+    const char*         cache_dir;      /**< Incremental cache directory, or NULL */
     int                 debug_info;
     int                 verbose;
     int                 show_help;
@@ -102,6 +116,7 @@ static Seraph_Vbit compile_to_native(Seraphic_Options* opts, const char* source,
 static Celestial_Module* ast_to_celestial_ir(Seraph_AST_Node* module_ast,
                                               Seraph_Type_Context* types,
                                               Seraph_Arena* arena);
+static double elapsed_ms(const struct timespec* start);
 
 /*============================================================================
  * Main Entry Point
@@ -113,6 +128,7 @@ int main(int argc, char** argv) {
     opts.output_type = OUTPUT_EXECUTABLE;
     opts.output_file = "a.out";
     opts.opt_level = 0;
+    opts.jobs = 1;
 
     /* Parse command-line arguments */
     if (parse_args(argc, argv, &opts) != 0) {
@@ -135,6 +151,9 @@ int main(int argc, char** argv) {
         return 1;
     }
 
+    struct timespec start;
+    timespec_get(&start, TIME_UTC);
+
     /* Read source file */
     size_t source_len;
     char* source = read_file(opts.input_file, &source_len);
@@ -163,7 +182,8 @@ int main(int argc, char** argv) {
     }
 
     if (opts.verbose) {
-        printf("Successfully compiled to '%s'\n", opts.output_file);
+        printf("Successfully compiled to '%s' in %.1f ms\n",
+               opts.output_file, elapsed_ms(&start));
     }
 
     return 0;
@@ -198,6 +218,22 @@ static int parse_args(int argc, char** argv, Seraphic_Options* opts) {
             if (opts->opt_level < 0 || opts->opt_level > 3) {
                 opts->opt_level = 0;
             }
+        } else if (strncmp(arg, "-j", 2) == 0) {
+            const char* count = arg + 2;
+            if (*count == '\0') {
+                if (i + 1 >= argc) {
+                    fprintf(stderr, "Error: -j requires an argument\n");
+                    return 1;
+                }
+                count = argv[++i];
+            }
+            char* end = NULL;
+            unsigned long jobs = strtoul(count, &end, 10);
+            if (end == count || *end != '\0' || jobs > CELESTIAL_JOBS_MAX) {
+                fprintf(stderr, "Error: Invalid job count '%s'\n", count);
+                return 1;
+            }
+            opts->jobs = (uint32_t)jobs;
         } else if (strcmp(arg, "-g") == 0) {
             opts->debug_info = 1;
         } else if (strcmp(arg, "-v") == 0 || strcmp(arg, "--verbose") == 0) {
@@ -214,6 +250,12 @@ static int parse_args(int argc, char** argv, Seraphic_Options* opts) {
                 fprintf(stderr, "Error: Unknown target '%s'\n", target);
                 return 1;
             }
+        } else if (strncmp(arg, "--cache-dir=", 12) == 0) {
+            opts->cache_dir = arg + 12;
+            if (*opts->cache_dir == '\0') {
+                fprintf(stderr, "Error: --cache-dir requires a directory\n");
+                return 1;
+            }
         } else if (arg[0] == '-') {
             fprintf(stderr, "Error: Unknown option '%s'\n", arg);
             return 1;
@@ -235,9 +277,11 @@ static void print_usage(const char* program) {
     printf("  --emit-asm      Output assembly listing\n");
     printf("  --emit-c        Output C code (transpilation)\n");
     printf("  -O<n>           Optimization level (0-3)\n");
+    printf("  -j <n>          Code generation threads (0 = all cores)\n");
     printf("  -g              Include debug info\n");
     printf("  -v, --verbose   Verbose output\n");
     printf("  --target=<t>    Target: x64, arm64, riscv64\n");
+    printf("  --cache-dir=<d> Reuse unchanged functions from earlier builds\n");
     printf("  --help, -h      Show this help\n");
     printf("  --version, -V   Show version\n");
 }
@@ -436,7 +480,21 @@ static Seraph_Vbit compile_to_native(Seraphic_Options* opts, const char* source,
         return SERAPH_VBIT_FALSE;
     }
 
-    /* Run optimization passes */
+    /* Run optimization passes. Inlining goes first so that constants
+     * bound into inlined or specialized bodies fold in the same pass. */
+    if (opts->opt_level > 0) {
+        Celestial_Inline_Options inline_opts;
+        Celestial_Inline_Stats inline_stats;
+        celestial_inline_default_options(&inline_opts, opts->opt_level);
+        int inlined = celestial_inline_module(ir_module, &inline_opts, &inline_stats);
+        if (opts->verbose && inlined > 0) {
+            printf("Inlining: %u calls inlined (%u instructions), "
+                   "%u calls specialized into %u clones\n",
+                   inline_stats.calls_inlined, inline_stats.instrs_added,
+                   inline_stats.calls_specialized, inline_stats.specializations);
+        }
+    }
+
     int folded = celestial_fold_constants(ir_module);
     if (opts->verbose && folded > 0) {
         printf("Constant folding: %d instructions folded\n", folded);
@@ -475,6 +533,15 @@ static Seraph_Vbit compile_to_native(Seraphic_Options* opts, const char* source,
         proofs.proven_count = 1;  /* At least one proof (type safety) */
     }
 
+    if (opts->verbose) {
+        size_t fn_count = 0;
+        for (Celestial_Function* fn = ir_module->functions; fn; fn = fn->next) {
+            fn_count++;
+        }
+        printf("Code generation: %zu functions on %u thread(s)\n",
+               fn_count, celestial_jobs_effective(opts->jobs, fn_count));
+    }
+
     /* Map compiler target to ELF target */
     Seraph_Elf_Target elf_target;
     switch (opts->target) {
@@ -493,14 +560,35 @@ static Seraph_Vbit compile_to_native(Seraphic_Options* opts, const char* source,
             return SERAPH_VBIT_FALSE;
     }
 
+    /* An unusable cache directory only costs a full rebuild */
+    Celestial_Cache cache;
+    Celestial_Cache* cache_ptr = NULL;
+    if (opts->cache_dir) {
+        if (seraph_vbit_is_true(celestial_cache_open(&cache, opts->cache_dir,
+                                                     SERAPHIC_CACHE_ID,
+                                                     (uint32_t)elf_target))) {
+            cache_ptr = &cache;
+        } else {
+            fprintf(stderr, "Warning: Cannot use cache directory '%s'\n", opts->cache_dir);
+        }
+    }
+
     if (!seraph_vbit_is_true(seraph_elf_from_celestial_target(ir_module, &proofs,
                                                                elf_target,
-                                                               opts->output_file))) {
+                                                               opts->output_file,
+                                                               opts->jobs,
+                                                               cache_ptr))) {
         fprintf(stderr, "Error: Failed to generate executable\n");
         seraph_arena_destroy(&arena);
         return SERAPH_VBIT_FALSE;
     }
 
+    if (opts->verbose && cache_ptr && cache.lookups > 0) {
+        printf("Cache: %u/%u functions reused (%.1f%% hit rate), %u stored\n",
+               cache.hits, cache.lookups, 100.0 * cache.hits / cache.lookups,
+               cache.stores);
+    }
+
     seraph_arena_destroy(&arena);
     return SERAPH_VBIT_TRUE;
 }
@@ -522,3 +610,14 @@ static Celestial_Module* ast_to_celestial_ir(Seraph_AST_Node* module_ast,
                                               Seraph_Arena* arena) {
     return ir_convert_module(module_ast, types, arena);
 }
+
+/*============================================================================
+ * Timing
+ *============================================================================*/
+
+static double elapsed_ms(const struct timespec* start) {
+    struct timespec now;
+    timespec_get(&now, TIME_UTC);
+    return (double)(now.tv_sec - start->tv_sec) * 1000.0 +
+           (double)(now.tv_nsec - start->tv_nsec) / 1e6;
+}
@@ -628,8 +628,7 @@ Seraph_Vbit seraph_type_context_init(Seraph_Type_Context* ctx, Seraph_Arena* are
     );
     if (ctx->global == NULL) return SERAPH_VBIT_VOID;
 
-    ctx->global->symbols = NULL;
-    ctx->global->parent = NULL;
+    memset(ctx->global, 0, sizeof(Seraph_Scope));
     ctx->scope = ctx->global;
 
     return SERAPH_VBIT_TRUE;
@@ -643,7 +642,7 @@ void seraph_type_push_scope(Seraph_Type_Context* ctx) {
     );
     if (scope == NULL) return;
 
-    scope->symbols = NULL;
+    memset(scope, 0, sizeof(Seraph_Scope));
     scope->parent = ctx->scope;
     ctx->scope = scope;
 }
@@ -654,6 +653,130 @@ void seraph_type_pop_scope(Seraph_Type_Context* ctx) {
     ctx->scope = ctx->scope->parent;
 }
 
+/*============================================================================
+ * Identifier Interning and Scope Hash Tables
+ *============================================================================*/
+
+/** Initial intern table size (power of two) */
+#define INTERN_INITIAL_CAPACITY 64
+
+/** Initial per-scope table size (power of two) */
+#define SCOPE_INITIAL_SLOTS 8
+
+static int types_alloc_ok(const void* p) {
+    return p != NULL && p != SERAPH_VOID_PTR;
+}
+
+/** FNV-1a over the name bytes */
+static uint32_t name_hash(const char* name, size_t len) {
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < len; i++) {
+        h ^= (uint8_t)name[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+/** Find the slot for a name: its entry, or the empty slot it would take */
+static Seraph_Intern_Entry* intern_find(const Seraph_Intern_Table* t,
+                                        const char* name, size_t len, uint32_t hash) {
+    uint32_t mask = t->capacity - 1;
+    for (uint32_t i = hash & mask; ; i = (i + 1) & mask) {
+        Seraph_Intern_Entry* e = &t->entries[i];
+        if (e->str == NULL) return e;
+        if (e->hash == hash && e->len == len && memcmp(e->str, name, len) == 0) {
+            return e;
+        }
+    }
+}
+
+static int intern_grow(Seraph_Type_Context* ctx) {
+    Seraph_Intern_Table* t = &ctx->interns;
+    uint32_t new_cap = t->capacity ? t->capacity * 2 : INTERN_INITIAL_CAPACITY;
+    Seraph_Intern_Entry* entries = (Seraph_Intern_Entry*)seraph_arena_alloc(
+        ctx->arena, sizeof(Seraph_Intern_Entry) * new_cap, _Alignof(Seraph_Intern_Entry)
+    );
+    if (!types_alloc_ok(entries)) return 0;
+    memset(entries, 0, sizeof(Seraph_Intern_Entry) * new_cap);
+
+    Seraph_Intern_Table grown = { entries, new_cap, t->count };
+    for (uint32_t i = 0; i < t->capacity; i++) {
+        const Seraph_Intern_Entry* e = &t->entries[i];
+        if (e->str != NULL) {
+            *intern_find(&grown, e->str, e->len, e->hash) = *e;
+        }
+    }
+    *t = grown;
+    return 1;
+}
+
+/** Interned pointer for a name, or NULL if it was never interned */
+static const char* intern_peek(const Seraph_Type_Context* ctx,
+                               const char* name, size_t len, uint32_t hash) {
+    if (ctx->interns.capacity == 0) return NULL;
+    return intern_find(&ctx->interns, name, len, hash)->str;
+}
+
+static const char* intern_hashed(Seraph_Type_Context* ctx,
+                                 const char* name, size_t len, uint32_t hash) {
+    Seraph_Intern_Table* t = &ctx->interns;
+
+    /* Keep load factor at or below 1/2 */
+    if ((t->count + 1) * 2 > t->capacity && !intern_grow(ctx)) {
+        return NULL;
+    }
+
+    Seraph_Intern_Entry* e = intern_find(t, name, len, hash);
+    if (e->str != NULL) return e->str;
+
+    char* copy = (char*)seraph_arena_alloc(ctx->arena, len + 1, 1);
+    if (!types_alloc_ok(copy)) return NULL;
+    memcpy(copy, name, len);
+    copy[len] = '\0';
+
+    e->str = copy;
+    e->len = len;
+    e->hash = hash;
+    t->count++;
+    return copy;
+}
+
+const char* seraph_type_intern(Seraph_Type_Context* ctx,
+                               const char* name, size_t name_len) {
+    if (ctx == NULL || name == NULL) return NULL;
+    return intern_hashed(ctx, name, name_len, name_hash(name, name_len));
+}
+
+/** Slot for an interned name in a scope: its symbol, or an empty slot */
+static Seraph_Symbol** scope_find(Seraph_Symbol** slots, uint32_t slot_count,
+                                  const char* interned, uint32_t hash) {
+    uint32_t mask = slot_count - 1;
+    for (uint32_t i = hash & mask; ; i = (i + 1) & mask) {
+        if (slots[i] == NULL || slots[i]->name == interned) {
+            return &slots[i];
+        }
+    }
+}
+
+static int scope_grow(Seraph_Type_Context* ctx, Seraph_Scope* scope) {
+    uint32_t new_count = scope->slot_count ? scope->slot_count * 2 : SCOPE_INITIAL_SLOTS;
+    Seraph_Symbol** slots = (Seraph_Symbol**)seraph_arena_alloc(
+        ctx->arena, sizeof(Seraph_Symbol*) * new_count, _Alignof(Seraph_Symbol*)
+    );
+    if (!types_alloc_ok(slots)) return 0;
+    memset(slots, 0, sizeof(Seraph_Symbol*) * new_count);
+
+    for (uint32_t i = 0; i < scope->slot_count; i++) {
+        Seraph_Symbol* sym = scope->slots[i];
+        if (sym != NULL) {
+            *scope_find(slots, new_count, sym->name, sym->name_hash) = sym;
+        }
+    }
+    scope->slots = slots;
+    scope->slot_count = new_count;
+    return 1;
+}
+
 Seraph_Vbit seraph_type_define(Seraph_Type_Context* ctx,
                                 const char* name, size_t name_len,
                                 Seraph_Type* type, Seraph_AST_Node* decl,
@@ -661,18 +784,37 @@ Seraph_Vbit seraph_type_define(Seraph_Type_Context* ctx,
     if (ctx == NULL || ctx->scope == NULL) return SERAPH_VBIT_VOID;
     if (name == NULL || type == NULL) return SERAPH_VBIT_VOID;
 
+    Seraph_Scope* scope = ctx->scope;
+    uint32_t hash = name_hash(name, name_len);
+    const char* interned = intern_hashed(ctx, name, name_len, hash);
+    if (interned == NULL) return SERAPH_VBIT_VOID;
+
+    /* Keep load factor at or below 3/4 */
+    if ((scope->symbol_count + 1) * 4 > scope->slot_count * 3 &&
+        !scope_grow(ctx, scope)) {
+        return SERAPH_VBIT_VOID;
+    }
+
     Seraph_Symbol* sym = (Seraph_Symbol*)seraph_arena_alloc(
         ctx->arena, sizeof(Seraph_Symbol), _Alignof(Seraph_Symbol)
     );
-    if (sym == NULL) return SERAPH_VBIT_VOID;
+    if (!types_alloc_ok(sym)) return SERAPH_VBIT_VOID;
 
-    sym->name = name;
+    sym->name = interned;
     sym->name_len = name_len;
+    sym->name_hash = hash;
     sym->type = type;
     sym->decl = decl;
     sym->is_mut = is_mut;
-    sym->next = ctx->scope->symbols;
-    ctx->scope->symbols = sym;
+    sym->next = scope->symbols;
+    scope->symbols = sym;
+
+    /* A redefinition in the same scope shadows the earlier symbol */
+    Seraph_Symbol** slot = scope_find(scope->slots, scope->slot_count, interned, hash);
+    if (*slot == NULL) {
+        scope->symbol_count++;
+    }
+    *slot = sym;
 
     return SERAPH_VBIT_TRUE;
 }
@@ -681,11 +823,16 @@ Seraph_Symbol* seraph_type_lookup(Seraph_Type_Context* ctx,
                                    const char* name, size_t name_len) {
     if (ctx == NULL || name == NULL) return NULL;
 
+    /* A name that was never interned was never defined */
+    uint32_t hash = name_hash(name, name_len);
+    const char* interned = intern_peek(ctx, name, name_len, hash);
+    if (interned == NULL) return NULL;
+
     for (Seraph_Scope* scope = ctx->scope; scope != NULL; scope = scope->parent) {
-        for (Seraph_Symbol* sym = scope->symbols; sym != NULL; sym = sym->next) {
-            if (sym->name_len == name_len && memcmp(sym->name, name, name_len) == 0) {
-                return sym;
-            }
+        if (scope->slot_count == 0) continue;
+        Seraph_Symbol* sym = *scope_find(scope->slots, scope->slot_count, interned, hash);
+        if (sym != NULL) {
+            return sym;
         }
     }
     return NULL;
@@ -136,6 +136,7 @@ Seraph_Vbit x64_labels_init(X64_Labels* labels) {
     labels->fixup_capacity = 0;
 
     labels->next_id = 1;  /* Start at 1, 0 is invalid */
+    labels->last_defined = SIZE_MAX;
 
     return SERAPH_VBIT_TRUE;
 }
@@ -158,6 +159,15 @@ void x64_labels_free(X64_Labels* labels) {
     labels->fixup_capacity = 0;
 }
 
+void x64_labels_reset(X64_Labels* labels) {
+    if (labels == NULL) return;
+
+    labels->count = 0;
+    labels->fixup_count = 0;
+    labels->next_id = 1;
+    labels->last_defined = SIZE_MAX;
+}
+
 uint32_t x64_label_create(X64_Labels* labels) {
     if (labels == NULL) return UINT32_MAX;
 
@@ -192,6 +202,7 @@ Seraph_Vbit x64_label_define(X64_Labels* labels, X64_Buffer* buf, uint32_t label
                 return SERAPH_VBIT_FALSE;
             }
             labels->labels[i].offset = buf->size;
+            labels->last_defined = buf->size;
             return SERAPH_VBIT_TRUE;
         }
     }
@@ -209,6 +220,7 @@ Seraph_Vbit x64_label_define(X64_Labels* labels, X64_Buffer* buf, uint32_t label
     labels->labels[labels->count].id = label_id;
     labels->labels[labels->count].offset = buf->size;
     labels->count++;
+    labels->last_defined = buf->size;
 
     /* Update next_id if needed */
     if (label_id >= labels->next_id) {
@@ -799,10 +811,18 @@ void x64_or_reg_reg(X64_Buffer* buf, X64_Reg dst, X64_Reg src, X64_Size size) {
     x64_alu_reg_reg(buf, 0x09, dst, src, size);  /* OR r/m, r */
 }
 
+void x64_or_reg_imm(X64_Buffer* buf, X64_Reg dst, int32_t imm, X64_Size size) {
+    x64_alu_reg_imm(buf, 1, dst, imm, size);  /* /1 for OR */
+}
+
 void x64_xor_reg_reg(X64_Buffer* buf, X64_Reg dst, X64_Reg src, X64_Size size) {
     x64_alu_reg_reg(buf, 0x31, dst, src, size);  /* XOR r/m, r */
 }
 
+void x64_xor_reg_imm(X64_Buffer* buf, X64_Reg dst, int32_t imm, X64_Size size) {
+    x64_alu_reg_imm(buf, 6, dst, imm, size);  /* /6 for XOR */
+}
+
 void x64_not_reg(X64_Buffer* buf, X64_Reg reg, X64_Size size) {
     if (buf == NULL) return;
 
@@ -98,12 +98,18 @@ const char* seraph_strand_state_string(Seraph_Strand_State state) {
  * Strand Creation and Lifecycle
  *============================================================================*/
 
-/* Direct framebuffer debug - write colored bars */
+/* Direct framebuffer debug - write colored bars (kernel only: the
+ * framebuffer address is unmapped in hosted builds) */
 static void strand_debug_bar(int row, uint32_t color) {
+#ifdef SERAPH_KERNEL
     volatile uint32_t* fb = (volatile uint32_t*)0xC0000000ULL;
     for (int x = 0; x < 200; x++) {
         fb[row * 1920 + x] = color;
     }
+#else
+    (void)row;
+    (void)color;
+#endif
 }
 
 Seraph_Strand_Error seraph_strand_create(
@@ -32,26 +32,8 @@ static uint64_t generate_orb_id(void) {
     return orb_id_counter;
 }
 
-/**
- * @brief Clamp value to range
- */
-static float clamp_f(float val, float min, float max) {
-    if (val < min) return min;
-    if (val > max) return max;
-    return val;
-}
-
 /* lerp_f removed - using Galactic integration instead */
 
-/**
- * @brief Smooth step (cubic interpolation)
- * Used for smooth SDF anti-aliasing transitions
- */
-static float smoothstep_f(float edge0, float edge1, float x) {
-    float t = clamp_f((x - edge0) / (edge1 - edge0), 0.0f, 1.0f);
-    return t * t * (3.0f - 2.0f * t);
-}
-
 /**
  * @brief Distance between two points
  */
@@ -794,74 +776,432 @@ bool seraph_surface_is_orb_expanded(
  *============================================================================*/
 
 /**
- * @brief Render a filled circle using SDF
+ * Rendering is integer-only: orb geometry is taken from the Q128 fields as
+ * Q16.16 pixels and every disc is evaluated with squared distances in Q32,
+ * stepped incrementally along each scanline. The frame is walked in
+ * SURFACE_TILE x SURFACE_TILE tiles: each band of tiles is painted with the
+ * background, then every tile gets only the discs whose coverage reaches
+ * it, in paint order.
  */
-static void render_circle_sdf(
-    uint32_t* framebuffer,
-    uint32_t fb_width,
-    uint32_t fb_height,
-    float cx,
-    float cy,
-    float radius,
-    Seraph_Color fill_color,
-    Seraph_Color glow_color,
-    float glow_amount
+#define SURFACE_TILE        32
+#define SURFACE_SPAN        64      /**< Pixels blended per span buffer */
+#define SURFACE_MAX_DISCS   (SERAPH_SURFACE_MAX_ORBS + 1)
+#define SURFACE_MAX_RADIUS  16384   /**< Pixels; keeps squared Q16 in int64 */
+
+#if !defined(SERAPH_KERNEL) && defined(__x86_64__) && defined(__SSE2__)
+#include <emmintrin.h>
+#define SURFACE_X86_SIMD 1
+#endif
+
+/**
+ * Glow falloff (1 - dist/radius)^2 sampled over u = (d^2 - r^2) / (3 r^2),
+ * which runs 0..1 across the glow band r <= d < 2r. Q16, 256 intervals.
+ */
+static const uint16_t surface_glow_lut[257] = {
+    65535, 64772, 64018, 63272, 62534, 61805, 61085, 60372, 59667, 58970, 58281, 57600,
+    56926, 56260, 55600, 54948, 54303, 53665, 53034, 52409, 51792, 51180, 50576, 49977,
+    49385, 48799, 48219, 47646, 47078, 46516, 45960, 45410, 44865, 44326, 43792, 43264,
+    42741, 42224, 41711, 41204, 40702, 40206, 39714, 39227, 38745, 38267, 37795, 37327,
+    36864, 36405, 35952, 35502, 35057, 34617, 34180, 33748, 33321, 32897, 32478, 32063,
+    31652, 31245, 30842, 30443, 30048, 29657, 29270, 28886, 28506, 28130, 27758, 27389,
+    27024, 26663, 26305, 25951, 25600, 25253, 24909, 24568, 24231, 23897, 23567, 23239,
+    22915, 22595, 22277, 21963, 21651, 21343, 21038, 20736, 20437, 20141, 19848, 19558,
+    19271, 18986, 18705, 18427, 18151, 17878, 17608, 17341, 17076, 16814, 16555, 16299,
+    16045, 15794, 15545, 15299, 15056, 14815, 14577, 14341, 14108, 13877, 13649, 13423,
+    13200, 12979, 12760, 12544, 12330, 12119, 11909, 11703, 11498, 11296, 11096, 10898,
+    10702, 10509, 10318, 10129,  9942,  9757,  9575,  9394,  9216,  9040,  8866,  8694,
+     8524,  8356,  8190,  8026,  7864,  7704,  7546,  7390,  7236,  7084,  6934,  6786,
+     6640,  6495,  6353,  6212,  6073,  5936,  5801,  5668,  5536,  5407,  5279,  5153,
+     5028,  4906,  4785,  4666,  4548,  4433,  4319,  4207,  4096,  3987,  3880,  3774,
+     3670,  3568,  3468,  3369,  3271,  3175,  3081,  2989,  2898,  2808,  2720,  2634,
+     2549,  2466,  2384,  2304,  2225,  2148,  2072,  1998,  1925,  1854,  1784,  1716,
+     1649,  1584,  1520,  1457,  1396,  1336,  1278,  1221,  1165,  1111,  1058,  1007,
+      957,   908,   861,   815,   770,   727,   685,   644,   605,   567,   530,   494,
+      460,   427,   395,   365,   336,   308,   281,   256,   232,   209,   187,   167,
+      147,   129,   113,    97,    82,    69,    57,    46,    36,    28,    20,    14,
+        9,     5,     2,     1,     0
+};
+
+/**
+ * @brief One SDF disc ready to rasterize
+ *
+ * Positions and radii are Q16.16 pixels, squared quantities Q32. The pixel
+ * box is inclusive and already clipped to the framebuffer.
+ */
+typedef struct {
+    int64_t  cx, cy;
+    int64_t  radius;
+    int64_t  r2;            /**< Inside below this */
+    int64_t  aa2;           /**< Anti-aliased edge below this: (r + 1.5)^2 */
+    int64_t  glow2;         /**< Glow band below this: (2r)^2 */
+    int64_t  cover2;        /**< Nothing is drawn at or beyond this */
+    uint64_t edge_inv;      /**< 2^48 / 2r, for the edge distance */
+    uint64_t glow_inv;      /**< 2^48 / ((glow2 - r2) >> glow_shift) */
+    int      glow_shift;
+    uint32_t glow_amount;   /**< Q8, 0..256; 0 disables the glow band */
+    uint32_t fill;
+    uint32_t glow;
+    int32_t  x0, y0, x1, y1;
+} Surface_Disc;
+
+/**
+ * @brief Q128 to Q16.16, saturating; VOID reads as 0
+ */
+static int64_t surface_q16_from_q128(Seraph_Q128 v) {
+    if (seraph_q128_is_void(v)) return 0;
+    if (v.hi >= (1 << 24)) return (int64_t)1 << 40;
+    if (v.hi < -(1 << 24)) return -((int64_t)1 << 40);
+    return v.hi * 65536 + (int64_t)(v.lo >> 48);
+}
+
+/**
+ * @brief Q128 in [0, 1] to Q8 (0..256); VOID reads as 0
+ */
+static uint32_t surface_q8_from_q128(Seraph_Q128 v) {
+    if (seraph_q128_is_void(v) || v.hi < 0) return 0;
+    if (v.hi >= 1) return 256;
+    return (uint32_t)(v.lo >> 56);
+}
+
+/**
+ * @brief Float pixels to Q16.16 at the float API boundary
+ */
+static int64_t surface_q16_from_float(float v) {
+    if (!(v > -16777216.0f)) return -((int64_t)1 << 40);
+    if (v > 16777216.0f) return (int64_t)1 << 40;
+    return (int64_t)(v * 65536.0f);
+}
+
+/**
+ * @brief Set up a disc; false when nothing of it lands in the framebuffer
+ */
+static bool surface_disc_init(
+    Surface_Disc* d,
+    int64_t cx, int64_t cy, int64_t radius,
+    Seraph_Color fill, Seraph_Color glow, uint32_t glow_amount,
+    uint32_t fb_width, uint32_t fb_height
 ) {
-    /* Compute bounding box with glow margin */
-    float margin = radius * 2.0f;
-    int32_t x0 = (int32_t)(cx - margin);
-    int32_t y0 = (int32_t)(cy - margin);
-    int32_t x1 = (int32_t)(cx + margin);
-    int32_t y1 = (int32_t)(cy + margin);
-
-    /* Clamp to framebuffer */
-    if (x0 < 0) x0 = 0;
-    if (y0 < 0) y0 = 0;
-    if (x1 >= (int32_t)fb_width) x1 = (int32_t)fb_width - 1;
-    if (y1 >= (int32_t)fb_height) y1 = (int32_t)fb_height - 1;
+    if (radius <= 0 || fb_width == 0 || fb_height == 0) return false;
+    if (radius > ((int64_t)SURFACE_MAX_RADIUS << 16)) {
+        radius = (int64_t)SURFACE_MAX_RADIUS << 16;
+    }
+
+    d->cx = cx;
+    d->cy = cy;
+    d->radius = radius;
+    d->r2 = radius * radius;
+    d->aa2 = (radius + 98304) * (radius + 98304);
+    d->glow2 = 4 * d->r2;
+    d->glow_amount = glow_amount > 256 ? 256 : glow_amount;
+    d->cover2 = (d->glow_amount && d->glow2 > d->aa2) ? d->glow2 : d->aa2;
+    d->fill = seraph_color_to_u32(fill);
+    d->glow = seraph_color_to_u32(glow);
+
+    /* Edge distances use 2r of at least one pixel so the reciprocal stays in 31 bits */
+    uint64_t two_r = (uint64_t)(radius < 65536 ? 65536 : radius) * 2;
+    d->edge_inv = ((uint64_t)1 << 48) / two_r;
+
+    uint64_t den = (uint64_t)(d->glow2 - d->r2);
+    d->glow_shift = den >> 32 ? 32 - __builtin_clzll(den) : 0;
+    d->glow_inv = ((uint64_t)1 << 48) / (den >> d->glow_shift);
+
+    /* Pixel box: every pixel whose center can fall inside the coverage */
+    int64_t reach = d->cover2 == d->glow2 ? 2 * radius : radius + 98304;
+    int64_t x0 = (cx - reach) >> 16, x1 = (cx + reach) >> 16;
+    int64_t y0 = (cy - reach) >> 16, y1 = (cy + reach) >> 16;
+    if (x1 < 0 || y1 < 0 || x0 >= (int64_t)fb_width || y0 >= (int64_t)fb_height) {
+        return false;
+    }
+    d->x0 = (int32_t)(x0 < 0 ? 0 : x0);
+    d->y0 = (int32_t)(y0 < 0 ? 0 : y0);
+    d->x1 = (int32_t)(x1 >= (int64_t)fb_width ? (int64_t)fb_width - 1 : x1);
+    d->y1 = (int32_t)(y1 >= (int64_t)fb_height ? (int64_t)fb_height - 1 : y1);
+    return true;
+}
 
-    for (int32_t y = y0; y <= y1; y++) {
-        for (int32_t x = x0; x <= x1; x++) {
-            /* SDF: distance from circle */
-            float px = (float)x + 0.5f;
-            float py = (float)y + 0.5f;
-            float dist = distance_2d(px, py, cx, cy) - radius;
-
-            /* Inside the circle */
-            if (dist < 0.0f) {
-                framebuffer[y * fb_width + x] = seraph_color_to_u32(fill_color);
-            }
-            /* Anti-aliased edge using smoothstep for crisp but smooth edges */
-            else if (dist < 1.5f) {
-                float alpha = 1.0f - smoothstep_f(0.0f, 1.5f, dist);
-                Seraph_Color bg = {
-                    (framebuffer[y * fb_width + x] >> 24) & 0xFF,
-                    (framebuffer[y * fb_width + x] >> 16) & 0xFF,
-                    (framebuffer[y * fb_width + x] >> 8) & 0xFF,
-                    255
-                };
-                Seraph_Color blended = seraph_color_lerp(bg, fill_color, alpha);
-                framebuffer[y * fb_width + x] = seraph_color_to_u32(blended);
-            }
-            /* Glow region */
-            else if (glow_amount > 0.0f && dist < radius) {
-                float glow_fade = 1.0f - (dist / radius);
-                glow_fade = glow_fade * glow_fade * glow_amount;
-                if (glow_fade > 0.01f) {
-                    Seraph_Color bg = {
-                        (framebuffer[y * fb_width + x] >> 24) & 0xFF,
-                        (framebuffer[y * fb_width + x] >> 16) & 0xFF,
-                        (framebuffer[y * fb_width + x] >> 8) & 0xFF,
-                        255
-                    };
-                    Seraph_Color blended = seraph_color_lerp(bg, glow_color, glow_fade);
-                    framebuffer[y * fb_width + x] = seraph_color_to_u32(blended);
-                }
+/**
+ * @brief Coverage (Q8) of the anti-aliased edge at squared distance d2
+ *
+ * With m = d^2 - r^2, the edge distance is m / (d + r). The first estimate
+ * m / 2r overshoots by about e^2 / 2r, which one correction term removes;
+ * the residual is below e^3 / 2r^2. The ramp is 1 - smoothstep(0, 1.5, e).
+ */
+static inline uint32_t surface_edge_alpha(const Surface_Disc* d, int64_t d2) {
+    uint64_t m = (uint64_t)(d2 - d->r2) >> 16;
+    int64_t e0 = (int64_t)((m * d->edge_inv) >> 32);
+    int64_t e = e0 - (int64_t)(((uint64_t)(e0 * e0) >> 16) * d->edge_inv >> 32);
+    if (e <= 0) return 256;
+    int64_t t = (e * 43691) >> 16;          /* e / 1.5 */
+    if (t >= 65536) return 0;
+    int64_t s = (((t * t) >> 16) * (196608 - 2 * t)) >> 16;
+    return (uint32_t)((65536 - s + 128) >> 8);
+}
+
+/**
+ * @brief Glow coverage (Q8) at squared distance d2 inside the glow band
+ */
+static inline uint32_t surface_glow_alpha(const Surface_Disc* d, int64_t d2) {
+    uint64_t u = (((uint64_t)(d2 - d->r2) >> d->glow_shift) * d->glow_inv) >> 32;
+    if (u >= 65536) return 0;
+    uint32_t i = (uint32_t)(u >> 8), frac = (uint32_t)(u & 255);
+    int32_t f = surface_glow_lut[i] -
+                (int32_t)(((surface_glow_lut[i] - surface_glow_lut[i + 1]) * frac) >> 8);
+    uint32_t alpha = ((uint32_t)f * d->glow_amount + 32768) >> 16;
+    return alpha > 2 ? alpha : 0;
+}
+
+/**
+ * @brief Store one packed color over n pixels
+ */
+static void surface_fill_span(uint32_t* dst, uint32_t color, size_t n) {
+    size_t i = 0;
+#ifdef SURFACE_X86_SIMD
+    const __m128i v = _mm_set1_epi32((int)color);
+    for (; i + 8 <= n; i += 8) {
+        _mm_storeu_si128((__m128i*)(dst + i), v);
+        _mm_storeu_si128((__m128i*)(dst + i + 4), v);
+    }
+#endif
+    for (; i < n; i++) {
+        dst[i] = color;
+    }
+}
+
+/**
+ * @brief dst = dst * (256 - a) + src * a, per channel, Q8 alpha
+ */
+static void surface_blend_span(
+    uint32_t* dst, const uint32_t* src, const uint16_t* alpha, uint32_t n
+) {
+    uint32_t i = 0;
+#ifdef SURFACE_X86_SIMD
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i full = _mm_set1_epi16(256);
+    for (; i + 4 <= n; i += 4) {
+        __m128i a = _mm_loadl_epi64((const __m128i*)(alpha + i));
+        if (_mm_cvtsi128_si64(a) == 0) continue;
+        a = _mm_unpacklo_epi16(a, a);
+        __m128i a_lo = _mm_unpacklo_epi32(a, a);
+        __m128i a_hi = _mm_unpackhi_epi32(a, a);
+        __m128i bg = _mm_loadu_si128((const __m128i*)(dst + i));
+        __m128i fg = _mm_loadu_si128((const __m128i*)(src + i));
+        __m128i lo = _mm_add_epi16(
+            _mm_mullo_epi16(_mm_unpacklo_epi8(bg, zero), _mm_sub_epi16(full, a_lo)),
+            _mm_mullo_epi16(_mm_unpacklo_epi8(fg, zero), a_lo));
+        __m128i hi = _mm_add_epi16(
+            _mm_mullo_epi16(_mm_unpackhi_epi8(bg, zero), _mm_sub_epi16(full, a_hi)),
+            _mm_mullo_epi16(_mm_unpackhi_epi8(fg, zero), a_hi));
+        _mm_storeu_si128((__m128i*)(dst + i),
+                         _mm_packus_epi16(_mm_srli_epi16(lo, 8), _mm_srli_epi16(hi, 8)));
+    }
+#endif
+    for (; i < n; i++) {
+        uint32_t a = alpha[i];
+        if (a == 0) continue;
+        uint32_t bg = dst[i], fg = src[i], out = 0;
+        for (int shift = 0; shift < 32; shift += 8) {
+            uint32_t c = (((bg >> shift) & 0xFF) * (256 - a) + ((fg >> shift) & 0xFF) * a) >> 8;
+            out |= c << shift;
+        }
+        dst[i] = out;
+    }
+}
+
+/**
+ * @brief Integer square root, rounded down
+ */
+static uint64_t surface_isqrt(uint64_t x) {
+    if (x == 0) return 0;
+    uint64_t r = (uint64_t)1 << ((65 - __builtin_clzll(x)) / 2);
+    for (;;) {
+        uint64_t next = (r + x / r) >> 1;
+        if (next >= r) return r;
+        r = next;
+    }
+}
+
+/**
+ * @brief Squared distance (Q32) from the disc center to pixel column x
+ */
+static inline int64_t surface_disc_d2(const Surface_Disc* d, int64_t x, int64_t dy2) {
+    int64_t dx = x * 65536 + 32768 - d->cx;
+    return dx * dx + dy2;
+}
+
+/**
+ * @brief Move the chord [*lo, *hi] of pixels with d2 < limit onto this row
+ *
+ * The chord always contains the center column c when it is not empty, and
+ * between rows its ends move only by the change in width, so they are
+ * stepped from the previous row's ends. An empty chord (lo > hi) is seeded
+ * with a square root instead. Leaves lo > hi when the row misses.
+ */
+static void surface_chord(
+    const Surface_Disc* d, int64_t dy2, int64_t limit, int64_t* lo, int64_t* hi
+) {
+    int64_t c = d->cx >> 16;
+    if (surface_disc_d2(d, c, dy2) >= limit) {
+        *lo = c + 1;
+        *hi = c;
+        return;
+    }
+    int64_t l = *lo, h = *hi;
+    if (l > h) {
+        int64_t half = (int64_t)surface_isqrt((uint64_t)(limit - dy2));
+        l = (d->cx - half) >> 16;
+        h = (d->cx + half) >> 16;
+    }
+    if (l > c) l = c;
+    if (h < c) h = c;
+    while (surface_disc_d2(d, l - 1, dy2) < limit) l--;
+    while (surface_disc_d2(d, l, dy2) >= limit) l++;
+    while (surface_disc_d2(d, h + 1, dy2) < limit) h++;
+    while (surface_disc_d2(d, h, dy2) >= limit) h--;
+    *lo = l;
+    *hi = h;
+}
+
+/**
+ * @brief Classify and blend pixels x0..x1 of one row of the edge/glow ring
+ *
+ * Along a row the squared distance advances by (dx + 1)^2 - dx^2 = 2 dx + 1
+ * per pixel, so each pixel costs two adds before it is classified.
+ */
+static void surface_draw_ring(
+    uint32_t* row, const Surface_Disc* d, int64_t dy2, int64_t x0, int64_t x1
+) {
+    uint32_t src[SURFACE_SPAN];
+    uint16_t alpha[SURFACE_SPAN];
+
+    for (int64_t xs = x0; xs <= x1; xs += SURFACE_SPAN) {
+        uint32_t n = (uint32_t)(x1 - xs + 1);
+        if (n > SURFACE_SPAN) n = SURFACE_SPAN;
+
+        int64_t dx = xs * 65536 + 32768 - d->cx;
+        int64_t d2 = dx * dx + dy2;
+        int64_t step = dx * 131072 + ((int64_t)1 << 32);
+        bool touched = false;
+
+        for (uint32_t k = 0; k < n; k++) {
+            uint32_t a = 0;
+            if (d2 < d->r2) {
+                a = 256;
+                src[k] = d->fill;
+            } else if (d2 < d->aa2) {
+                a = surface_edge_alpha(d, d2);
+                src[k] = d->fill;
+            } else if (d2 < d->cover2) {
+                a = surface_glow_alpha(d, d2);
+                src[k] = d->glow;
             }
+            alpha[k] = (uint16_t)a;
+            touched |= a != 0;
+            d2 += step;
+            step += (int64_t)1 << 33;
         }
+        if (touched) {
+            surface_blend_span(row + xs, src, alpha, n);
+        }
+    }
+}
+
+/**
+ * @brief Rasterize one disc over the inclusive pixel rectangle given
+ *
+ * The rectangle must lie inside the disc's box. Each row is cut to the
+ * chord of the coverage circle; the chord of the disc itself is solid fill
+ * and only the ring on either side is classified and blended.
+ */
+static void surface_draw_disc(
+    uint32_t* framebuffer, uint32_t stride, const Surface_Disc* d,
+    int32_t x0, int32_t y0, int32_t x1, int32_t y1
+) {
+    int64_t c = d->cx >> 16;
+    int64_t outer_lo = c + 1, outer_hi = c;
+    int64_t inner_lo = c + 1, inner_hi = c;
+
+    for (int32_t y = y0; y <= y1; y++) {
+        int64_t dy = (int64_t)y * 65536 + 32768 - d->cy;
+        int64_t dy2 = dy * dy;
+        surface_chord(d, dy2, d->cover2, &outer_lo, &outer_hi);
+        surface_chord(d, dy2, d->r2, &inner_lo, &inner_hi);
+
+        int64_t a = outer_lo > x0 ? outer_lo : x0;
+        int64_t b = outer_hi < x1 ? outer_hi : x1;
+        if (a > b) continue;
+        uint32_t* row = framebuffer + (size_t)y * stride;
+
+        int64_t fa = inner_lo > a ? inner_lo : a;
+        int64_t fb = inner_hi < b ? inner_hi : b;
+        if (fa > fb) {
+            surface_draw_ring(row, d, dy2, a, b);
+            continue;
+        }
+        surface_draw_ring(row, d, dy2, a, fa - 1);
+        surface_fill_span(row + fa, d->fill, (size_t)(fb - fa + 1));
+        surface_draw_ring(row, d, dy2, fb + 1, b);
     }
 }
 
+/**
+ * @brief Rasterize a whole disc, clipped only by the framebuffer
+ */
+static void surface_draw_disc_full(uint32_t* framebuffer, uint32_t stride, const Surface_Disc* d) {
+    surface_draw_disc(framebuffer, stride, d, d->x0, d->y0, d->x1, d->y1);
+}
+
+/**
+ * @brief Build the locus disc
+ */
+static bool surface_locus_disc(
+    Seraph_Locus* locus, uint32_t width, uint32_t height, Surface_Disc* d
+) {
+    /* A subtle indicator: radius 5, glow 0.3 */
+    return surface_disc_init(
+        d,
+        surface_q16_from_q128(locus->position_x.primal),
+        surface_q16_from_q128(locus->position_y.primal),
+        (int64_t)5 << 16,
+        SERAPH_THEME_LOCUS, SERAPH_THEME_GLOW, 77,
+        width, height
+    );
+}
+
+/**
+ * @brief Build an orb's disc at the given Q16 center
+ */
+static bool surface_orb_disc(
+    Seraph_Orb* orb, int64_t cx, int64_t cy,
+    uint32_t width, uint32_t height, Surface_Disc* d
+) {
+    if (orb->state == SERAPH_ORB_VOID) {
+        return false;
+    }
+
+    /* Determine color based on state */
+    Seraph_Color fill = orb->color_base;
+    if (seraph_vbit_is_true(orb->focused)) {
+        fill = SERAPH_THEME_ORB_HOVER;
+    }
+    if (orb->state == SERAPH_ORB_SWELLING) {
+        fill = SERAPH_THEME_ORB_ACTIVE;
+    }
+
+    /* Apply brightness */
+    uint32_t brightness = surface_q8_from_q128(orb->brightness.primal);
+    fill.r = (uint8_t)((fill.r * brightness) >> 8);
+    fill.g = (uint8_t)((fill.g * brightness) >> 8);
+    fill.b = (uint8_t)((fill.b * brightness) >> 8);
+
+    /* Add glow for notifications */
+    uint32_t glow = orb->notifications > 0 ? 128 : surface_q8_from_q128(orb->glow.primal);
+
+    return surface_disc_init(
+        d, cx, cy, surface_q16_from_q128(orb->radius.primal),
+        fill, orb->color_glow, glow, width, height
+    );
+}
+
 void seraph_surface_render_locus(
     Seraph_Locus* locus,
     uint32_t* framebuffer,
@@ -872,17 +1212,10 @@ void seraph_surface_render_locus(
         return;
     }
 
-    float cx = (float)seraph_q128_to_double(locus->position_x.primal);
-    float cy = (float)seraph_q128_to_double(locus->position_y.primal);
-
-    /* Render a subtle locus indicator */
-    render_circle_sdf(
-        framebuffer, width, height,
-        cx, cy, 5.0f,
-        SERAPH_THEME_LOCUS,
-        SERAPH_THEME_GLOW,
-        0.3f
-    );
+    Surface_Disc d;
+    if (surface_locus_disc(locus, width, height, &d)) {
+        surface_draw_disc_full(framebuffer, width, &d);
+    }
 }
 
 void seraph_surface_render_orb(
@@ -897,38 +1230,153 @@ void seraph_surface_render_orb(
         return;
     }
 
-    if (orb->state == SERAPH_ORB_VOID) {
-        return;
+    Surface_Disc d;
+    if (surface_orb_disc(orb, surface_q16_from_float(center_x), surface_q16_from_float(center_y),
+                         width, height, &d)) {
+        surface_draw_disc_full(framebuffer, width, &d);
     }
+}
 
-    float radius = orb_get_radius(orb);
-    float brightness = (float)seraph_q128_to_double(orb->brightness.primal);
-    float glow = (float)seraph_q128_to_double(orb->glow.primal);
-
-    /* Determine color based on state */
-    Seraph_Color fill = orb->color_base;
-    if (seraph_vbit_is_true(orb->focused)) {
-        fill = SERAPH_THEME_ORB_HOVER;
+/**
+ * @brief Does the disc's coverage reach the inclusive pixel rectangle?
+ */
+static bool surface_disc_hits_rect(
+    const Surface_Disc* d, int32_t x0, int32_t y0, int32_t x1, int32_t y1
+) {
+    if (d->x1 < x0 || d->x0 > x1 || d->y1 < y0 || d->y0 > y1) {
+        return false;
     }
-    if (orb->state == SERAPH_ORB_SWELLING) {
-        fill = SERAPH_THEME_ORB_ACTIVE;
+    /* Nearest pixel center of the rectangle to the disc center */
+    int64_t nx = d->cx, ny = d->cy;
+    int64_t lx = (int64_t)x0 * 65536 + 32768, hx = (int64_t)x1 * 65536 + 32768;
+    int64_t ly = (int64_t)y0 * 65536 + 32768, hy = (int64_t)y1 * 65536 + 32768;
+    if (nx < lx) nx = lx;
+    if (nx > hx) nx = hx;
+    if (ny < ly) ny = ly;
+    if (ny > hy) ny = hy;
+    int64_t dx = nx - d->cx, dy = ny - d->cy;
+    return dx * dx + dy * dy < d->cover2;
+}
+
+/**
+ * @brief Draw one region: background, then every disc reaching each tile
+ *
+ * The region is aligned to the tile grid (its far edges may be clipped by
+ * the framebuffer), so tiles here are the same tiles a full frame uses.
+ */
+static void surface_render_region(
+    uint32_t* framebuffer, uint32_t width,
+    const Surface_Disc* discs, uint32_t count, const Seraph_Surface_Rect* r
+) {
+    uint32_t bg = seraph_color_to_u32(SERAPH_THEME_BACKGROUND);
+    uint8_t row_discs[SURFACE_MAX_DISCS];
+    uint32_t x_end = r->x + r->width, y_end = r->y + r->height;
+
+    for (uint32_t ty = r->y; ty < y_end; ty += SURFACE_TILE) {
+        int32_t y0 = (int32_t)ty;
+        int32_t y1 = (int32_t)(ty + SURFACE_TILE > y_end ? y_end : ty + SURFACE_TILE) - 1;
+
+        uint32_t row_count = 0;
+        for (uint32_t i = 0; i < count; i++) {
+            if (discs[i].y1 >= y0 && discs[i].y0 <= y1) {
+                row_discs[row_count++] = (uint8_t)i;
+            }
+        }
+
+        /* A full-width band is contiguous, so its background goes down in one pass */
+        if (r->width == width) {
+            surface_fill_span(framebuffer + (size_t)ty * width, bg, (size_t)(y1 - y0 + 1) * width);
+        } else {
+            for (int32_t y = y0; y <= y1; y++) {
+                surface_fill_span(framebuffer + (size_t)y * width + r->x, bg, r->width);
+            }
+        }
+
+        for (uint32_t tx = r->x; tx < x_end; tx += SURFACE_TILE) {
+            int32_t x0 = (int32_t)tx;
+            int32_t x1 = (int32_t)(tx + SURFACE_TILE > x_end ? x_end : tx + SURFACE_TILE) - 1;
+
+            for (uint32_t k = 0; k < row_count; k++) {
+                const Surface_Disc* d = &discs[row_discs[k]];
+                if (!surface_disc_hits_rect(d, x0, y0, x1, y1)) {
+                    continue;
+                }
+                surface_draw_disc(framebuffer, width, d,
+                                  d->x0 > x0 ? d->x0 : x0, d->y0 > y0 ? d->y0 : y0,
+                                  d->x1 < x1 ? d->x1 : x1, d->y1 < y1 ? d->y1 : y1);
+            }
+        }
     }
+}
 
-    /* Apply brightness */
-    fill.r = (uint8_t)(fill.r * brightness);
-    fill.g = (uint8_t)(fill.g * brightness);
-    fill.b = (uint8_t)(fill.b * brightness);
+/**
+ * @brief Record what a disc looks like on screen
+ */
+static Seraph_Surface_Drawn surface_drawn_of(const Surface_Disc* d, uint8_t layer) {
+    return (Seraph_Surface_Drawn){
+        .cx = d->cx, .cy = d->cy, .radius = d->radius,
+        .fill = d->fill, .glow = d->glow, .glow_amount = d->glow_amount,
+        .x0 = d->x0, .y0 = d->y0, .x1 = d->x1, .y1 = d->y1,
+        .layer = layer, .drawn = true
+    };
+}
 
-    /* Add glow for notifications */
-    if (orb->notifications > 0) {
-        glow = 0.5f;
+static bool surface_drawn_equal(const Seraph_Surface_Drawn* a, const Seraph_Surface_Drawn* b) {
+    if (a->drawn != b->drawn) return false;
+    if (!a->drawn) return true;
+    return a->cx == b->cx && a->cy == b->cy && a->radius == b->radius &&
+           a->fill == b->fill && a->glow == b->glow && a->glow_amount == b->glow_amount &&
+           a->layer == b->layer;
+}
+
+static bool surface_rects_overlap(const Seraph_Surface_Rect* a, const Seraph_Surface_Rect* b) {
+    return a->x < b->x + b->width && b->x < a->x + a->width &&
+           a->y < b->y + b->height && b->y < a->y + a->height;
+}
+
+static Seraph_Surface_Rect surface_rect_union(const Seraph_Surface_Rect* a, const Seraph_Surface_Rect* b) {
+    uint32_t x0 = a->x < b->x ? a->x : b->x;
+    uint32_t y0 = a->y < b->y ? a->y : b->y;
+    uint32_t x1 = a->x + a->width > b->x + b->width ? a->x + a->width : b->x + b->width;
+    uint32_t y1 = a->y + a->height > b->y + b->height ? a->y + a->height : b->y + b->height;
+    return (Seraph_Surface_Rect){ x0, y0, x1 - x0, y1 - y0 };
+}
+
+/**
+ * @brief Add pixels x0..x1, y0..y1 (inclusive) to the damage list
+ *
+ * The area is widened to whole tiles and merged with every region it
+ * overlaps, so the list stays disjoint and nothing is drawn twice.
+ */
+static void surface_damage_add(
+    Seraph_Surface_Damage* damage, uint32_t width, uint32_t height,
+    int32_t x0, int32_t y0, int32_t x1, int32_t y1
+) {
+    uint32_t rx = (uint32_t)x0 & ~(uint32_t)(SURFACE_TILE - 1);
+    uint32_t ry = (uint32_t)y0 & ~(uint32_t)(SURFACE_TILE - 1);
+    uint32_t rx_end = ((uint32_t)x1 | (SURFACE_TILE - 1)) + 1;
+    uint32_t ry_end = ((uint32_t)y1 | (SURFACE_TILE - 1)) + 1;
+    if (rx_end > width) rx_end = width;
+    if (ry_end > height) ry_end = height;
+    Seraph_Surface_Rect r = { rx, ry, rx_end - rx, ry_end - ry };
+
+    for (uint32_t i = 0; i < damage->count; ) {
+        if (surface_rects_overlap(&damage->rects[i], &r)) {
+            r = surface_rect_union(&damage->rects[i], &r);
+            damage->rects[i] = damage->rects[--damage->count];
+            i = 0;
+        } else {
+            i++;
+        }
     }
 
-    render_circle_sdf(
-        framebuffer, width, height,
-        center_x, center_y, radius,
-        fill, orb->color_glow, glow
-    );
+    if (damage->count == SERAPH_SURFACE_MAX_DAMAGE) {
+        for (uint32_t i = 0; i < damage->count; i++) {
+            r = surface_rect_union(&damage->rects[i], &r);
+        }
+        damage->count = 0;
+    }
+    damage->rects[damage->count++] = r;
 }
 
 void seraph_surface_render(
@@ -941,49 +1389,103 @@ void seraph_surface_render(
         return;
     }
 
-    /* Fill background with theme color */
-    uint32_t bg = seraph_color_to_u32(SERAPH_THEME_BACKGROUND);
-    for (uint32_t i = 0; i < width * height; i++) {
-        framebuffer[i] = bg;
+    Seraph_Surface_Damage* damage = &surface->damage;
+    damage->count = 0;
+    if (width == 0 || height == 0) {
+        surface->drawn_valid = false;
+        return;
     }
 
-    /* Render the locus */
-    seraph_surface_render_locus(&surface->locus, framebuffer, width, height);
+    /* Partial redraw only makes sense over the buffer the last frame went into */
+    bool incremental = surface->drawn_valid &&
+                       surface->drawn_framebuffer == framebuffer &&
+                       surface->drawn_width == width && surface->drawn_height == height;
+    surface->drawn_framebuffer = framebuffer;
+    surface->drawn_width = width;
+    surface->drawn_height = height;
+    surface->drawn_valid = true;
 
-    /* Render all orbs (back to front, peripheral first) */
-    /* First pass: peripheral orbs */
-    for (int32_t i = 0; i < SERAPH_SURFACE_MAX_ORBS; i++) {
-        Seraph_Orb* orb = &surface->orbs[i];
-        if (orb->state == SERAPH_ORB_PERIPHERAL) {
-            float orb_x, orb_y;
-            orb_get_center(orb, &orb_x, &orb_y);
-            seraph_surface_render_orb(orb, framebuffer, width, height, orb_x, orb_y);
+    /* A fullscreen orb covers everything else */
+    if (surface->expanded_orb_index >= 0) {
+        Seraph_Orb* orb = &surface->orbs[surface->expanded_orb_index];
+        if (orb->state == SERAPH_ORB_FULLSCREEN) {
+            uint32_t fill = seraph_color_to_u32(orb->color_base);
+            if (!incremental || !surface->drawn_fullscreen ||
+                surface->drawn_fullscreen_fill != fill) {
+                surface_fill_span(framebuffer, fill, (size_t)width * height);
+                damage->rects[damage->count++] = (Seraph_Surface_Rect){ 0, 0, width, height };
+            }
+            surface->drawn_fullscreen = true;
+            surface->drawn_fullscreen_fill = fill;
+            return;
         }
     }
-
-    /* Second pass: normal orbs */
-    for (int32_t i = 0; i < SERAPH_SURFACE_MAX_ORBS; i++) {
-        Seraph_Orb* orb = &surface->orbs[i];
-        if (orb->state != SERAPH_ORB_VOID &&
-            orb->state != SERAPH_ORB_PERIPHERAL &&
-            orb->state != SERAPH_ORB_FULLSCREEN) {
-            float orb_x, orb_y;
-            orb_get_center(orb, &orb_x, &orb_y);
-            seraph_surface_render_orb(orb, framebuffer, width, height, orb_x, orb_y);
+    if (surface->drawn_fullscreen) {
+        incremental = false;
+        surface->drawn_fullscreen = false;
+    }
+
+    /* Paint order: locus, peripheral orbs, then normal orbs */
+    Surface_Disc discs[SURFACE_MAX_DISCS];
+    Seraph_Surface_Drawn now[SERAPH_SURFACE_MAX_ORBS + 1];
+    uint32_t count = 0;
+    memset(now, 0, sizeof(now));
+    if (surface_locus_disc(&surface->locus, width, height, &discs[count])) {
+        now[0] = surface_drawn_of(&discs[count++], 0);
+    }
+    for (int pass = 0; pass < 2; pass++) {
+        for (int32_t i = 0; i < SERAPH_SURFACE_MAX_ORBS; i++) {
+            Seraph_Orb* orb = &surface->orbs[i];
+            bool peripheral = orb->state == SERAPH_ORB_PERIPHERAL;
+            if (orb->state == SERAPH_ORB_FULLSCREEN || peripheral != (pass == 0)) {
+                continue;
+            }
+            if (surface_orb_disc(orb,
+                                 surface_q16_from_q128(orb->position_x.primal),
+                                 surface_q16_from_q128(orb->position_y.primal),
+                                 width, height, &discs[count])) {
+                now[i + 1] = surface_drawn_of(&discs[count++], (uint8_t)(pass + 1));
+            }
         }
     }
 
-    /* Third pass: fullscreen orb (if any) */
-    if (surface->expanded_orb_index >= 0) {
-        Seraph_Orb* orb = &surface->orbs[surface->expanded_orb_index];
-        if (orb->state == SERAPH_ORB_FULLSCREEN) {
-            /* For fullscreen, fill the entire screen with orb color */
-            uint32_t fill = seraph_color_to_u32(orb->color_base);
-            for (uint32_t i = 0; i < width * height; i++) {
-                framebuffer[i] = fill;
+    /* Whatever changed damages both where it was and where it is now */
+    if (incremental) {
+        for (uint32_t s = 0; s <= SERAPH_SURFACE_MAX_ORBS; s++) {
+            const Seraph_Surface_Drawn* was = &surface->drawn[s];
+            if (surface_drawn_equal(was, &now[s])) {
+                continue;
+            }
+            if (was->drawn) {
+                surface_damage_add(damage, width, height, was->x0, was->y0, was->x1, was->y1);
+            }
+            if (now[s].drawn) {
+                surface_damage_add(damage, width, height,
+                                   now[s].x0, now[s].y0, now[s].x1, now[s].y1);
             }
         }
+    } else {
+        damage->rects[damage->count++] = (Seraph_Surface_Rect){ 0, 0, width, height };
+    }
+
+    for (uint32_t i = 0; i < damage->count; i++) {
+        surface_render_region(framebuffer, width, discs, count, &damage->rects[i]);
+    }
+    memcpy(surface->drawn, now, sizeof(now));
+}
+
+const Seraph_Surface_Damage* seraph_surface_get_damage(const Seraph_Surface* surface) {
+    if (!seraph_surface_is_valid(surface)) {
+        return NULL;
+    }
+    return &surface->damage;
+}
+
+void seraph_surface_invalidate(Seraph_Surface* surface) {
+    if (surface == NULL) {
+        return;
     }
+    surface->drawn_valid = false;
 }
 
 /*============================================================================
@@ -6,6 +6,495 @@
 #include "seraph/vbit.h"
 #include <string.h>
 
+/*
+ * SIMD kernels need GCC/Clang target attributes and are never used in the
+ * kernel, where vector registers are not saved across interrupts. Each
+ * kernel handles whole vectors and returns how many elements it consumed;
+ * the scalar loop after it finishes the tail.
+ */
+#if !defined(SERAPH_KERNEL) && defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define VBIT_X86_SIMD 1
+#include <immintrin.h>
+#endif
+
+static Seraph_Vbit_Impl vbit_impl = SERAPH_VBIT_IMPL_AUTO;
+
+static inline Seraph_Vbit_Impl vbit_active_impl(void) {
+    if (vbit_impl == SERAPH_VBIT_IMPL_AUTO) seraph_vbit_set_impl(SERAPH_VBIT_IMPL_AUTO);
+    return vbit_impl;
+}
+
+#ifdef VBIT_X86_SIMD
+#define VBIT_DISPATCH(kernel, ...) \
+    (vbit_active_impl() == SERAPH_VBIT_IMPL_AVX2  ? kernel##_avx2(__VA_ARGS__) : \
+     vbit_impl == SERAPH_VBIT_IMPL_SSE42          ? kernel##_sse42(__VA_ARGS__) : 0)
+#else
+#define VBIT_DISPATCH(kernel, ...) ((size_t)0)
+#endif
+
+#ifdef VBIT_X86_SIMD
+
+/*============================================================================
+ * SSE4.2 Kernels (16 VBITs per vector)
+ *============================================================================*/
+
+#define VBIT_SSE __attribute__((target("sse4.2,popcnt")))
+
+VBIT_SSE
+static size_t vbit_scan_sse42(const Seraph_Vbit* v, size_t count, Seraph_Vbit stop,
+                              bool* has_void) {
+    const __m128i vstop = _mm_set1_epi8((char)stop);
+    const __m128i vvoid = _mm_set1_epi8((char)SERAPH_VBIT_VOID);
+    __m128i seen_void = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(v + i));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(x, vstop))) break;
+        seen_void = _mm_or_si128(seen_void, _mm_cmpeq_epi8(x, vvoid));
+    }
+    if (!_mm_testz_si128(seen_void, seen_void)) *has_void = true;
+    return i;
+}
+
+VBIT_SSE
+static size_t vbit_count_sse42(const Seraph_Vbit* v, size_t count, Seraph_Vbit value,
+                               size_t* matches) {
+    const __m128i vval = _mm_set1_epi8((char)value);
+    size_t n = 0;
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(v + i));
+        n += (size_t)__builtin_popcount((unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(x, vval)));
+    }
+    *matches += n;
+    return i;
+}
+
+VBIT_SSE
+static size_t vbit_not_sse42(const Seraph_Vbit* src, Seraph_Vbit* dst, size_t count) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i vvoid = _mm_set1_epi8((char)SERAPH_VBIT_VOID);
+    const __m128i one = _mm_set1_epi8(1);
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(src + i));
+        __m128i r = _mm_or_si128(_mm_cmpeq_epi8(x, vvoid),
+                                 _mm_and_si128(_mm_cmpeq_epi8(x, zero), one));
+        _mm_storeu_si128((__m128i*)(dst + i), r);
+    }
+    return i;
+}
+
+VBIT_SSE
+static size_t vbit_and_sse42(const Seraph_Vbit* a, const Seraph_Vbit* b,
+                             Seraph_Vbit* dst, size_t count) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i vvoid = _mm_set1_epi8((char)SERAPH_VBIT_VOID);
+    const __m128i one = _mm_set1_epi8(1);
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i y = _mm_loadu_si128((const __m128i*)(b + i));
+        /* FALSE dominates, then VOID, else TRUE */
+        __m128i f = _mm_or_si128(_mm_cmpeq_epi8(x, zero), _mm_cmpeq_epi8(y, zero));
+        __m128i u = _mm_or_si128(_mm_cmpeq_epi8(x, vvoid), _mm_cmpeq_epi8(y, vvoid));
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_andnot_si128(f, _mm_or_si128(u, one)));
+    }
+    return i;
+}
+
+VBIT_SSE
+static size_t vbit_or_sse42(const Seraph_Vbit* a, const Seraph_Vbit* b,
+                            Seraph_Vbit* dst, size_t count) {
+    const __m128i one = _mm_set1_epi8(1);
+    const __m128i vvoid = _mm_set1_epi8((char)SERAPH_VBIT_VOID);
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i y = _mm_loadu_si128((const __m128i*)(b + i));
+        /* TRUE dominates, then VOID, else FALSE */
+        __m128i t = _mm_or_si128(_mm_cmpeq_epi8(x, one), _mm_cmpeq_epi8(y, one));
+        __m128i u = _mm_or_si128(_mm_cmpeq_epi8(x, vvoid), _mm_cmpeq_epi8(y, vvoid));
+        __m128i r = _mm_or_si128(_mm_andnot_si128(t, u), _mm_and_si128(t, one));
+        _mm_storeu_si128((__m128i*)(dst + i), r);
+    }
+    return i;
+}
+
+VBIT_SSE
+static size_t vbit_xor_sse42(const Seraph_Vbit* a, const Seraph_Vbit* b,
+                             Seraph_Vbit* dst, size_t count) {
+    const __m128i one = _mm_set1_epi8(1);
+    const __m128i vvoid = _mm_set1_epi8((char)SERAPH_VBIT_VOID);
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i y = _mm_loadu_si128((const __m128i*)(b + i));
+        __m128i u = _mm_or_si128(_mm_cmpeq_epi8(x, vvoid), _mm_cmpeq_epi8(y, vvoid));
+        __m128i r = _mm_or_si128(u, _mm_andnot_si128(_mm_cmpeq_epi8(x, y), one));
+        _mm_storeu_si128((__m128i*)(dst + i), r);
+    }
+    return i;
+}
+
+VBIT_SSE
+static size_t vbit_filter_true_sse42(const Seraph_Vbit* v, size_t count,
+                                     size_t* indices, size_t* found) {
+    const __m128i one = _mm_set1_epi8(1);
+    size_t n = *found;
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(v + i));
+        unsigned m = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(x, one));
+        while (m) {
+            indices[n++] = i + (size_t)__builtin_ctz(m);
+            m &= m - 1;
+        }
+    }
+    *found = n;
+    return i;
+}
+
+VBIT_SSE
+static size_t vbit_pack_bitmap_sse42(const Seraph_Vbit* v, size_t count, uint8_t* bitmap) {
+    const __m128i one = _mm_set1_epi8(1);
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(v + i));
+        uint16_t m = (uint16_t)_mm_movemask_epi8(_mm_cmpeq_epi8(x, one));
+        memcpy(bitmap + i / 8, &m, sizeof(m));
+    }
+    return i;
+}
+
+/* Spread 16 bits to 16 bytes: 0xFF where the bit is set */
+VBIT_SSE
+static inline __m128i vbit_expand16_sse42(uint16_t bits) {
+    const __m128i spread = _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1);
+    const __m128i select = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128,
+                                         1, 2, 4, 8, 16, 32, 64, -128);
+    __m128i x = _mm_shuffle_epi8(_mm_cvtsi32_si128(bits), spread);
+    return _mm_cmpeq_epi8(_mm_and_si128(x, select), select);
+}
+
+VBIT_SSE
+static size_t vbit_unpack_bitmap_sse42(const uint8_t* bitmap, size_t count, Seraph_Vbit* v) {
+    const __m128i one = _mm_set1_epi8(1);
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        uint16_t m;
+        memcpy(&m, bitmap + i / 8, sizeof(m));
+        _mm_storeu_si128((__m128i*)(v + i), _mm_and_si128(vbit_expand16_sse42(m), one));
+    }
+    return i;
+}
+
+VBIT_SSE
+static size_t vbit_pack_sse42(const Seraph_Vbit* v, size_t count, Seraph_Vbit_Packed* out) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i one = _mm_set1_epi8(1);
+    size_t i = 0;
+    for (; i + 64 <= count; i += 64) {
+        uint64_t t = 0;
+        uint64_t f = 0;
+        for (unsigned k = 0; k < 64; k += 16) {
+            __m128i x = _mm_loadu_si128((const __m128i*)(v + i + k));
+            t |= (uint64_t)(uint16_t)_mm_movemask_epi8(_mm_cmpeq_epi8(x, one)) << k;
+            f |= (uint64_t)(uint16_t)_mm_movemask_epi8(_mm_cmpeq_epi8(x, zero)) << k;
+        }
+        out[i / 64].t = t;
+        out[i / 64].f = f;
+    }
+    return i;
+}
+
+VBIT_SSE
+static size_t vbit_unpack_sse42(const Seraph_Vbit_Packed* words, size_t count, Seraph_Vbit* v) {
+    const __m128i one = _mm_set1_epi8(1);
+    size_t i = 0;
+    for (; i + 64 <= count; i += 64) {
+        Seraph_Vbit_Packed w = words[i / 64];
+        for (unsigned k = 0; k < 64; k += 16) {
+            __m128i t = vbit_expand16_sse42((uint16_t)(w.t >> k));
+            __m128i f = vbit_expand16_sse42((uint16_t)(w.f >> k));
+            /* TRUE -> 0x01, FALSE -> 0x00, neither -> VOID (0xFF) */
+            __m128i r = _mm_or_si128(_mm_and_si128(t, one),
+                                     _mm_xor_si128(_mm_or_si128(t, f), _mm_set1_epi8(-1)));
+            _mm_storeu_si128((__m128i*)(v + i + k), r);
+        }
+    }
+    return i;
+}
+
+/*============================================================================
+ * AVX2 Kernels (32 VBITs per vector)
+ *============================================================================*/
+
+#define VBIT_AVX2 __attribute__((target("avx2,popcnt")))
+
+VBIT_AVX2
+static size_t vbit_scan_avx2(const Seraph_Vbit* v, size_t count, Seraph_Vbit stop,
+                             bool* has_void) {
+    const __m256i vstop = _mm256_set1_epi8((char)stop);
+    const __m256i vvoid = _mm256_set1_epi8((char)SERAPH_VBIT_VOID);
+    __m256i seen_void = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(v + i));
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, vstop))) break;
+        seen_void = _mm256_or_si256(seen_void, _mm256_cmpeq_epi8(x, vvoid));
+    }
+    if (!_mm256_testz_si256(seen_void, seen_void)) *has_void = true;
+    return i;
+}
+
+VBIT_AVX2
+static size_t vbit_count_avx2(const Seraph_Vbit* v, size_t count, Seraph_Vbit value,
+                              size_t* matches) {
+    const __m256i vval = _mm256_set1_epi8((char)value);
+    size_t n = 0;
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(v + i));
+        n += (size_t)__builtin_popcount((unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, vval)));
+    }
+    *matches += n;
+    return i;
+}
+
+VBIT_AVX2
+static size_t vbit_not_avx2(const Seraph_Vbit* src, Seraph_Vbit* dst, size_t count) {
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i vvoid = _mm256_set1_epi8((char)SERAPH_VBIT_VOID);
+    const __m256i one = _mm256_set1_epi8(1);
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(src + i));
+        __m256i r = _mm256_or_si256(_mm256_cmpeq_epi8(x, vvoid),
+                                    _mm256_and_si256(_mm256_cmpeq_epi8(x, zero), one));
+        _mm256_storeu_si256((__m256i*)(dst + i), r);
+    }
+    return i;
+}
+
+VBIT_AVX2
+static size_t vbit_and_avx2(const Seraph_Vbit* a, const Seraph_Vbit* b,
+                            Seraph_Vbit* dst, size_t count) {
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i vvoid = _mm256_set1_epi8((char)SERAPH_VBIT_VOID);
+    const __m256i one = _mm256_set1_epi8(1);
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i y = _mm256_loadu_si256((const __m256i*)(b + i));
+        __m256i f = _mm256_or_si256(_mm256_cmpeq_epi8(x, zero), _mm256_cmpeq_epi8(y, zero));
+        __m256i u = _mm256_or_si256(_mm256_cmpeq_epi8(x, vvoid), _mm256_cmpeq_epi8(y, vvoid));
+        _mm256_storeu_si256((__m256i*)(dst + i), _mm256_andnot_si256(f, _mm256_or_si256(u, one)));
+    }
+    return i;
+}
+
+VBIT_AVX2
+static size_t vbit_or_avx2(const Seraph_Vbit* a, const Seraph_Vbit* b,
+                           Seraph_Vbit* dst, size_t count) {
+    const __m256i one = _mm256_set1_epi8(1);
+    const __m256i vvoid = _mm256_set1_epi8((char)SERAPH_VBIT_VOID);
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i y = _mm256_loadu_si256((const __m256i*)(b + i));
+        __m256i t = _mm256_or_si256(_mm256_cmpeq_epi8(x, one), _mm256_cmpeq_epi8(y, one));
+        __m256i u = _mm256_or_si256(_mm256_cmpeq_epi8(x, vvoid), _mm256_cmpeq_epi8(y, vvoid));
+        __m256i r = _mm256_or_si256(_mm256_andnot_si256(t, u), _mm256_and_si256(t, one));
+        _mm256_storeu_si256((__m256i*)(dst + i), r);
+    }
+    return i;
+}
+
+VBIT_AVX2
+static size_t vbit_xor_avx2(const Seraph_Vbit* a, const Seraph_Vbit* b,
+                            Seraph_Vbit* dst, size_t count) {
+    const __m256i one = _mm256_set1_epi8(1);
+    const __m256i vvoid = _mm256_set1_epi8((char)SERAPH_VBIT_VOID);
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i y = _mm256_loadu_si256((const __m256i*)(b + i));
+        __m256i u = _mm256_or_si256(_mm256_cmpeq_epi8(x, vvoid), _mm256_cmpeq_epi8(y, vvoid));
+        __m256i r = _mm256_or_si256(u, _mm256_andnot_si256(_mm256_cmpeq_epi8(x, y), one));
+        _mm256_storeu_si256((__m256i*)(dst + i), r);
+    }
+    return i;
+}
+
+VBIT_AVX2
+static size_t vbit_filter_true_avx2(const Seraph_Vbit* v, size_t count,
+                                    size_t* indices, size_t* found) {
+    const __m256i one = _mm256_set1_epi8(1);
+    size_t n = *found;
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(v + i));
+        unsigned m = (unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, one));
+        while (m) {
+            indices[n++] = i + (size_t)__builtin_ctz(m);
+            m &= m - 1;
+        }
+    }
+    *found = n;
+    return i;
+}
+
+VBIT_AVX2
+static size_t vbit_pack_bitmap_avx2(const Seraph_Vbit* v, size_t count, uint8_t* bitmap) {
+    const __m256i one = _mm256_set1_epi8(1);
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(v + i));
+        uint32_t m = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, one));
+        memcpy(bitmap + i / 8, &m, sizeof(m));
+    }
+    return i;
+}
+
+/* Spread 32 bits to 32 bytes: 0xFF where the bit is set */
+VBIT_AVX2
+static inline __m256i vbit_expand32_avx2(uint32_t bits) {
+    const __m256i spread = _mm256_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+                                            2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3);
+    const __m256i select = _mm256_set1_epi64x((long long)0x8040201008040201ull);
+    __m256i x = _mm256_shuffle_epi8(_mm256_set1_epi32((int)bits), spread);
+    return _mm256_cmpeq_epi8(_mm256_and_si256(x, select), select);
+}
+
+VBIT_AVX2
+static size_t vbit_unpack_bitmap_avx2(const uint8_t* bitmap, size_t count, Seraph_Vbit* v) {
+    const __m256i one = _mm256_set1_epi8(1);
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32) {
+        uint32_t m;
+        memcpy(&m, bitmap + i / 8, sizeof(m));
+        _mm256_storeu_si256((__m256i*)(v + i), _mm256_and_si256(vbit_expand32_avx2(m), one));
+    }
+    return i;
+}
+
+VBIT_AVX2
+static size_t vbit_pack_avx2(const Seraph_Vbit* v, size_t count, Seraph_Vbit_Packed* out) {
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i one = _mm256_set1_epi8(1);
+    size_t i = 0;
+    for (; i + 64 <= count; i += 64) {
+        __m256i lo = _mm256_loadu_si256((const __m256i*)(v + i));
+        __m256i hi = _mm256_loadu_si256((const __m256i*)(v + i + 32));
+        out[i / 64].t = (uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(lo, one)) |
+                        (uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(hi, one)) << 32;
+        out[i / 64].f = (uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(lo, zero)) |
+                        (uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(hi, zero)) << 32;
+    }
+    return i;
+}
+
+VBIT_AVX2
+static size_t vbit_unpack_avx2(const Seraph_Vbit_Packed* words, size_t count, Seraph_Vbit* v) {
+    const __m256i one = _mm256_set1_epi8(1);
+    const __m256i all = _mm256_set1_epi8(-1);
+    size_t i = 0;
+    for (; i + 64 <= count; i += 64) {
+        Seraph_Vbit_Packed w = words[i / 64];
+        for (unsigned k = 0; k < 64; k += 32) {
+            __m256i t = vbit_expand32_avx2((uint32_t)(w.t >> k));
+            __m256i f = vbit_expand32_avx2((uint32_t)(w.f >> k));
+            __m256i r = _mm256_or_si256(_mm256_and_si256(t, one),
+                                        _mm256_xor_si256(_mm256_or_si256(t, f), all));
+            _mm256_storeu_si256((__m256i*)(v + i + k), r);
+        }
+    }
+    return i;
+}
+
+/*============================================================================
+ * CPU Feature Detection
+ *============================================================================*/
+
+static void vbit_cpuid(uint32_t leaf, uint32_t sub, uint32_t* a, uint32_t* b,
+                       uint32_t* c, uint32_t* d) {
+    __asm__ volatile("cpuid" : "=a"(*a), "=b"(*b), "=c"(*c), "=d"(*d) : "a"(leaf), "c"(sub));
+}
+
+static bool vbit_cpu_has(Seraph_Vbit_Impl impl) {
+    uint32_t a, b, c, d;
+    vbit_cpuid(0, 0, &a, &b, &c, &d);
+    uint32_t max_leaf = a;
+
+    vbit_cpuid(1, 0, &a, &b, &c, &d);
+    uint32_t ecx1 = c;
+    /* SSE4.2 (1.ECX[20]) and POPCNT (1.ECX[23]) back both variants */
+    if (!(ecx1 >> 20 & 1) || !(ecx1 >> 23 & 1)) return false;
+    if (impl == SERAPH_VBIT_IMPL_SSE42) return true;
+
+    if (impl == SERAPH_VBIT_IMPL_AVX2 && max_leaf >= 7) {
+        vbit_cpuid(7, 0, &a, &b, &c, &d);
+        /* AVX2 (7.EBX[5]) and the OS saving YMM state (OSXSAVE, XCR0[2:1]) */
+        if (!(b >> 5 & 1) || !(ecx1 >> 27 & 1)) return false;
+        uint32_t xcr0_lo, xcr0_hi;
+        __asm__ volatile("xgetbv" : "=a"(xcr0_lo), "=d"(xcr0_hi) : "c"(0));
+        return (xcr0_lo & 6) == 6;
+    }
+    return false;
+}
+
+#endif /* VBIT_X86_SIMD */
+
+/*============================================================================
+ * Dispatch
+ *============================================================================*/
+
+bool seraph_vbit_impl_supported(Seraph_Vbit_Impl impl) {
+    switch (impl) {
+        case SERAPH_VBIT_IMPL_AUTO:
+        case SERAPH_VBIT_IMPL_SCALAR:
+            return true;
+#ifdef VBIT_X86_SIMD
+        case SERAPH_VBIT_IMPL_SSE42:
+        case SERAPH_VBIT_IMPL_AVX2:
+            return vbit_cpu_has(impl);
+#endif
+        default:
+            return false;
+    }
+}
+
+bool seraph_vbit_set_impl(Seraph_Vbit_Impl impl) {
+    if (!seraph_vbit_impl_supported(impl)) return false;
+
+    if (impl == SERAPH_VBIT_IMPL_AUTO) {
+        if (seraph_vbit_impl_supported(SERAPH_VBIT_IMPL_AVX2)) {
+            impl = SERAPH_VBIT_IMPL_AVX2;
+        } else if (seraph_vbit_impl_supported(SERAPH_VBIT_IMPL_SSE42)) {
+            impl = SERAPH_VBIT_IMPL_SSE42;
+        } else {
+            impl = SERAPH_VBIT_IMPL_SCALAR;
+        }
+    }
+    vbit_impl = impl;
+    return true;
+}
+
+Seraph_Vbit_Impl seraph_vbit_get_impl(void) {
+    return vbit_active_impl();
+}
+
+const char* seraph_vbit_impl_name(Seraph_Vbit_Impl impl) {
+    switch (impl) {
+        case SERAPH_VBIT_IMPL_AUTO:   return "auto";
+        case SERAPH_VBIT_IMPL_SCALAR: return "scalar";
+        case SERAPH_VBIT_IMPL_SSE42:  return "sse4.2";
+        case SERAPH_VBIT_IMPL_AVX2:   return "avx2";
+        default:                      return "unknown";
+    }
+}
+
 /*============================================================================
  * VBIT Array Operations Implementation
  *============================================================================*/
@@ -15,7 +504,9 @@ Seraph_Vbit seraph_vbit_all_true(const Seraph_Vbit* values, size_t count) {
 
     bool has_void = false;
 
-    for (size_t i = 0; i < count; i++) {
+    /* Skips whole vectors without FALSE; the loop below finds it */
+    size_t i = VBIT_DISPATCH(vbit_scan, values, count, SERAPH_VBIT_FALSE, &has_void);
+    for (; i < count; i++) {
         if (values[i] == SERAPH_VBIT_FALSE) {
             return SERAPH_VBIT_FALSE;  /* FALSE dominates */
         }
@@ -33,7 +524,8 @@ Seraph_Vbit seraph_vbit_any_true(const Seraph_Vbit* values, size_t count) {
 
     bool has_void = false;
 
-    for (size_t i = 0; i < count; i++) {
+    size_t i = VBIT_DISPATCH(vbit_scan, values, count, SERAPH_VBIT_TRUE, &has_void);
+    for (; i < count; i++) {
         if (values[i] == SERAPH_VBIT_TRUE) {
             return SERAPH_VBIT_TRUE;  /* TRUE dominates */
         }
@@ -50,7 +542,8 @@ size_t seraph_vbit_count_true(const Seraph_Vbit* values, size_t count) {
     if (!values || count == 0) return 0;
 
     size_t true_count = 0;
-    for (size_t i = 0; i < count; i++) {
+    size_t i = VBIT_DISPATCH(vbit_count, values, count, SERAPH_VBIT_TRUE, &true_count);
+    for (; i < count; i++) {
         if (values[i] == SERAPH_VBIT_TRUE) {
             true_count++;
         }
@@ -62,7 +555,8 @@ size_t seraph_vbit_count_false(const Seraph_Vbit* values, size_t count) {
     if (!values || count == 0) return 0;
 
     size_t false_count = 0;
-    for (size_t i = 0; i < count; i++) {
+    size_t i = VBIT_DISPATCH(vbit_count, values, count, SERAPH_VBIT_FALSE, &false_count);
+    for (; i < count; i++) {
         if (values[i] == SERAPH_VBIT_FALSE) {
             false_count++;
         }
@@ -74,7 +568,8 @@ size_t seraph_vbit_count_void(const Seraph_Vbit* values, size_t count) {
     if (!values || count == 0) return 0;
 
     size_t void_count = 0;
-    for (size_t i = 0; i < count; i++) {
+    size_t i = VBIT_DISPATCH(vbit_count, values, count, SERAPH_VBIT_VOID, &void_count);
+    for (; i < count; i++) {
         if (values[i] == SERAPH_VBIT_VOID) {
             void_count++;
         }
@@ -85,7 +580,8 @@ size_t seraph_vbit_count_void(const Seraph_Vbit* values, size_t count) {
 void seraph_vbit_not_array(const Seraph_Vbit* src, Seraph_Vbit* dst, size_t count) {
     if (!src || !dst || count == 0) return;
 
-    for (size_t i = 0; i < count; i++) {
+    size_t i = VBIT_DISPATCH(vbit_not, src, dst, count);
+    for (; i < count; i++) {
         dst[i] = seraph_vbit_not(src[i]);
     }
 }
@@ -94,7 +590,8 @@ void seraph_vbit_and_array(const Seraph_Vbit* a, const Seraph_Vbit* b,
                            Seraph_Vbit* dst, size_t count) {
     if (!a || !b || !dst || count == 0) return;
 
-    for (size_t i = 0; i < count; i++) {
+    size_t i = VBIT_DISPATCH(vbit_and, a, b, dst, count);
+    for (; i < count; i++) {
         dst[i] = seraph_vbit_and(a[i], b[i]);
     }
 }
@@ -103,7 +600,8 @@ void seraph_vbit_or_array(const Seraph_Vbit* a, const Seraph_Vbit* b,
                           Seraph_Vbit* dst, size_t count) {
     if (!a || !b || !dst || count == 0) return;
 
-    for (size_t i = 0; i < count; i++) {
+    size_t i = VBIT_DISPATCH(vbit_or, a, b, dst, count);
+    for (; i < count; i++) {
         dst[i] = seraph_vbit_or(a[i], b[i]);
     }
 }
@@ -119,7 +617,8 @@ void seraph_vbit_xor_array(const Seraph_Vbit* a, const Seraph_Vbit* b,
                            Seraph_Vbit* dst, size_t count) {
     if (!a || !b || !dst || count == 0) return;
 
-    for (size_t i = 0; i < count; i++) {
+    size_t i = VBIT_DISPATCH(vbit_xor, a, b, dst, count);
+    for (; i < count; i++) {
         dst[i] = seraph_vbit_xor(a[i], b[i]);
     }
 }
@@ -136,7 +635,8 @@ size_t seraph_vbit_filter_true(const Seraph_Vbit* values, size_t count,
     if (!values || !indices || count == 0) return 0;
 
     size_t found = 0;
-    for (size_t i = 0; i < count; i++) {
+    size_t i = VBIT_DISPATCH(vbit_filter_true, values, count, indices, &found);
+    for (; i < count; i++) {
         if (values[i] == SERAPH_VBIT_TRUE) {
             indices[found++] = i;
         }
@@ -182,7 +682,8 @@ void seraph_vbit_pack_bitmap(const Seraph_Vbit* values, size_t count, uint8_t* b
     size_t bytes = (count + 7) / 8;
     memset(bitmap, 0, bytes);
 
-    for (size_t i = 0; i < count; i++) {
+    size_t i = VBIT_DISPATCH(vbit_pack_bitmap, values, count, bitmap);
+    for (; i < count; i++) {
         if (values[i] == SERAPH_VBIT_TRUE) {
             bitmap[i / 8] |= (1u << (i % 8));
         }
@@ -195,7 +696,8 @@ void seraph_vbit_pack_bitmap(const Seraph_Vbit* values, size_t count, uint8_t* b
 void seraph_vbit_unpack_bitmap(const uint8_t* bitmap, size_t count, Seraph_Vbit* values) {
     if (!bitmap || !values || count == 0) return;
 
-    for (size_t i = 0; i < count; i++) {
+    size_t i = VBIT_DISPATCH(vbit_unpack_bitmap, bitmap, count, values);
+    for (; i < count; i++) {
         if (bitmap[i / 8] & (1u << (i % 8))) {
             values[i] = SERAPH_VBIT_TRUE;
         } else {
@@ -204,6 +706,110 @@ void seraph_vbit_unpack_bitmap(const uint8_t* bitmap, size_t count, Seraph_Vbit*
     }
 }
 
+/*============================================================================
+ * Packed VBIT Arrays
+ *============================================================================*/
+
+void seraph_vbit_pack(const Seraph_Vbit* values, size_t count, Seraph_Vbit_Packed* out) {
+    if (!values || !out || count == 0) return;
+
+    size_t i = VBIT_DISPATCH(vbit_pack, values, count, out);
+    for (; i < count; i += 64) {
+        size_t n = count - i < 64 ? count - i : 64;
+        Seraph_Vbit_Packed w = { 0, 0 };
+        for (size_t j = 0; j < n; j++) {
+            w.t |= (uint64_t)(values[i + j] == SERAPH_VBIT_TRUE) << j;
+            w.f |= (uint64_t)(values[i + j] == SERAPH_VBIT_FALSE) << j;
+        }
+        out[i / 64] = w;
+    }
+}
+
+void seraph_vbit_unpack(const Seraph_Vbit_Packed* words, size_t count, Seraph_Vbit* values) {
+    if (!words || !values || count == 0) return;
+
+    size_t i = VBIT_DISPATCH(vbit_unpack, words, count, values);
+    for (; i < count; i++) {
+        uint64_t bit = 1ull << (i % 64);
+        const Seraph_Vbit_Packed* w = &words[i / 64];
+        if (w->t & bit) {
+            values[i] = SERAPH_VBIT_TRUE;
+        } else if (w->f & bit) {
+            values[i] = SERAPH_VBIT_FALSE;
+        } else {
+            values[i] = SERAPH_VBIT_VOID;
+        }
+    }
+}
+
+void seraph_vbit_packed_and(const Seraph_Vbit_Packed* a, const Seraph_Vbit_Packed* b,
+                            Seraph_Vbit_Packed* dst, size_t words) {
+    if (!a || !b || !dst) return;
+
+    for (size_t i = 0; i < words; i++) {
+        Seraph_Vbit_Packed r = { a[i].t & b[i].t, a[i].f | b[i].f };
+        dst[i] = r;
+    }
+}
+
+void seraph_vbit_packed_or(const Seraph_Vbit_Packed* a, const Seraph_Vbit_Packed* b,
+                           Seraph_Vbit_Packed* dst, size_t words) {
+    if (!a || !b || !dst) return;
+
+    for (size_t i = 0; i < words; i++) {
+        Seraph_Vbit_Packed r = { a[i].t | b[i].t, a[i].f & b[i].f };
+        dst[i] = r;
+    }
+}
+
+void seraph_vbit_packed_xor(const Seraph_Vbit_Packed* a, const Seraph_Vbit_Packed* b,
+                            Seraph_Vbit_Packed* dst, size_t words) {
+    if (!a || !b || !dst) return;
+
+    for (size_t i = 0; i < words; i++) {
+        Seraph_Vbit_Packed r = {
+            (a[i].t & b[i].f) | (a[i].f & b[i].t),
+            (a[i].t & b[i].t) | (a[i].f & b[i].f)
+        };
+        dst[i] = r;
+    }
+}
+
+void seraph_vbit_packed_not(const Seraph_Vbit_Packed* src, Seraph_Vbit_Packed* dst,
+                            size_t words) {
+    if (!src || !dst) return;
+
+    for (size_t i = 0; i < words; i++) {
+        Seraph_Vbit_Packed r = { src[i].f, src[i].t };
+        dst[i] = r;
+    }
+}
+
+/* Bits of the words holding count elements, last word masked */
+static size_t vbit_packed_popcount(const Seraph_Vbit_Packed* words, size_t count,
+                                   bool true_plane) {
+    if (!words || count == 0) return 0;
+
+    size_t n = 0;
+    size_t full = count / 64;
+    for (size_t i = 0; i < full; i++) {
+        n += (size_t)__builtin_popcountll(true_plane ? words[i].t : words[i].f);
+    }
+    if (count % 64) {
+        uint64_t tail = true_plane ? words[full].t : words[full].f;
+        n += (size_t)__builtin_popcountll(tail & ((1ull << (count % 64)) - 1));
+    }
+    return n;
+}
+
+size_t seraph_vbit_packed_count_true(const Seraph_Vbit_Packed* words, size_t count) {
+    return vbit_packed_popcount(words, count, true);
+}
+
+size_t seraph_vbit_packed_count_false(const Seraph_Vbit_Packed* words, size_t count) {
+    return vbit_packed_popcount(words, count, false);
+}
+
 /**
  * @brief Three-way comparison with VBIT result
  *
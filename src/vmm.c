@@ -18,6 +18,7 @@
  */
 
 #include "seraph/vmm.h"
+#include "seraph/atlas.h"
 #include "seraph/void.h"
 #include <string.h>
 
@@ -602,6 +603,11 @@ Seraph_Vbit seraph_vmm_handle_page_fault(Seraph_VMM* vmm, uint64_t fault_addr,
             return SERAPH_VBIT_TRUE;  /* CoW handled successfully */
         }
 
+        /* Atlas snapshot pages are read-only until their first write is copied */
+        if (seraph_vbit_is_true(seraph_atlas_snapshot_write_fault((void*)(uintptr_t)fault_addr))) {
+            return SERAPH_VBIT_TRUE;
+        }
+
         /* Write to read-only page without CoW - protection violation */
         return SERAPH_VBIT_FALSE;
     }
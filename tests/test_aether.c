@@ -13,12 +13,16 @@
  * - Coherence protocol
  * - VOID failure injection
  * - Statistics tracking
+ * - Frame authentication (HMAC-SHA256, batch validation)
  */
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <stddef.h>
 #include <string.h>
 #include "seraph/aether.h"
+#include "seraph/aether_security.h"
+#include "seraph/drivers/nic.h"
 
 static int tests_run = 0;
 static int tests_passed = 0;
@@ -899,6 +903,238 @@ TEST(multiple_sim_nodes) {
     seraph_aether_destroy(&aether);
 }
 
+/*============================================================================
+ * Frame Authentication Tests
+ *============================================================================*/
+
+/* Wire layout checked by aether_security_validate_frame() */
+typedef struct __attribute__((packed)) {
+    Seraph_Ethernet_Header eth;
+    uint32_t magic;
+    uint16_t version;
+    uint16_t type;
+    uint32_t seq_num;
+    uint16_t src_node;
+    uint16_t dst_node;
+    uint64_t offset;
+    uint16_t flags;
+    uint16_t data_len;
+    uint64_t generation;
+    uint8_t  payload[16];
+    uint8_t  mac[AETHER_HMAC_DIGEST_SIZE];
+} Test_Auth_Frame;
+
+static void test_build_frame(Test_Auth_Frame* f, const Aether_Security_State* sec,
+                             uint16_t src, uint32_t seq) {
+    memset(f, 0, sizeof(*f));
+    f->eth.ethertype = SERAPH_ETHERTYPE_AETHER;
+    f->magic = 0x48544541;
+    f->version = 1;
+    f->type = 0x06;  /* ACK */
+    f->seq_num = seq;
+    f->src_node = src;
+    f->data_len = sizeof(f->payload);
+    for (size_t i = 0; i < sizeof(f->payload); i++) {
+        f->payload[i] = (uint8_t)(seq * 7 + i);
+    }
+    aether_security_compute_hmac(sec, src, f, offsetof(Test_Auth_Frame, mac), f->mac);
+}
+
+TEST(hmac_rfc4231) {
+    /* RFC 4231 test case 2 */
+    static const uint8_t expect[32] = {
+        0x5b, 0xdc, 0xc1, 0x46, 0xbf, 0x60, 0x75, 0x4e, 0x6a, 0x04, 0x24, 0x26,
+        0x08, 0x95, 0x75, 0xc7, 0x5a, 0x00, 0x3f, 0x08, 0x9d, 0x27, 0x39, 0x83,
+        0x9d, 0xec, 0x58, 0xb9, 0x64, 0xec, 0x38, 0x43
+    };
+    const char* msg = "what do ya want for nothing?";
+    uint8_t mac[32];
+
+    aether_hmac_sha256((const uint8_t*)"Jefe", 4, msg, strlen(msg), mac);
+    ASSERT(memcmp(mac, expect, 32) == 0);
+
+    Aether_HMAC_Key hk;
+    aether_hmac_key_init(&hk, (const uint8_t*)"Jefe", 4);
+    memset(mac, 0, sizeof(mac));
+    aether_hmac_sha256_keyed(&hk, msg, strlen(msg), mac);
+    ASSERT(memcmp(mac, expect, 32) == 0);
+
+    /* Incremental use of a precomputed key */
+    Aether_HMAC_Context ctx;
+    aether_hmac_sha256_init_key(&ctx, &hk);
+    aether_hmac_sha256_update(&ctx, msg, 10);
+    aether_hmac_sha256_update(&ctx, msg + 10, strlen(msg) - 10);
+    memset(mac, 0, sizeof(mac));
+    aether_hmac_sha256_final(&ctx, mac);
+    ASSERT(memcmp(mac, expect, 32) == 0);
+}
+
+TEST(hmac_multi) {
+    static const SHA256_Impl impls[] = {
+        SHA256_IMPL_SCALAR, SHA256_IMPL_SHA_NI, SHA256_IMPL_AVX2
+    };
+    uint8_t data[2000];
+    for (size_t i = 0; i < sizeof(data); i++) {
+        data[i] = (uint8_t)(i * 13 + 5);
+    }
+
+    Aether_HMAC_Key key_store[3];
+    for (int k = 0; k < 3; k++) {
+        uint8_t key[AETHER_HMAC_KEY_SIZE + 40];
+        memset(key, 0x20 + k, sizeof(key));
+        /* Third key is longer than a block and gets hashed first */
+        aether_hmac_key_init(&key_store[k], key, k == 2 ? sizeof(key) : (size_t)(20 + k));
+    }
+
+    enum { COUNT = 19 };
+    const Aether_HMAC_Key* keys[COUNT];
+    const void* msgs[COUNT];
+    size_t lens[COUNT];
+    for (size_t i = 0; i < COUNT; i++) {
+        keys[i] = &key_store[i % 3];
+        msgs[i] = data + i * 3;
+        lens[i] = (i * 97) % 1200;
+    }
+
+    for (size_t v = 0; v < sizeof(impls) / sizeof(impls[0]); v++) {
+        if (!sha256_set_impl(impls[v])) continue;
+        uint8_t macs[COUNT * 32];
+        aether_hmac_sha256_multi(keys, msgs, lens, COUNT, macs);
+        for (size_t i = 0; i < COUNT; i++) {
+            uint8_t one[32];
+            aether_hmac_sha256_keyed(keys[i], msgs[i], lens[i], one);
+            ASSERT(memcmp(one, &macs[i * 32], 32) == 0);
+        }
+    }
+    sha256_set_impl(SHA256_IMPL_AUTO);
+}
+
+TEST(validate_frames_batch) {
+    static Aether_Security_State single;
+    static Aether_Security_State batch;
+    uint8_t key1[AETHER_HMAC_KEY_SIZE];
+    uint8_t key2[AETHER_HMAC_KEY_SIZE];
+    memset(key1, 0x11, sizeof(key1));
+    memset(key2, 0x22, sizeof(key2));
+
+    Aether_Security_State* states[2] = { &single, &batch };
+    for (int s = 0; s < 2; s++) {
+        ASSERT_TRUE(seraph_vbit_is_true(aether_security_init(states[s])));
+        aether_rate_config_init(&states[s]->rate_config, 1000, 7, 1000);
+        aether_security_set_node_key(states[s], 1, key1, AETHER_NODE_PERM_ALL);
+        aether_security_set_node_key(states[s], 2, key2, AETHER_NODE_PERM_ALL);
+    }
+
+    /* Node 3 has no key, so its frames carry a MAC nobody accepts */
+    enum { COUNT = 20 };
+    static Test_Auth_Frame frames[COUNT];
+    const void* ptrs[COUNT];
+    size_t lens[COUNT];
+    for (uint32_t i = 0; i < COUNT; i++) {
+        uint16_t src = (uint16_t)(i % 3 == 2 ? 2 : 1);
+        test_build_frame(&frames[i], &single, src, 100 + i);
+        ptrs[i] = &frames[i];
+        lens[i] = sizeof(Test_Auth_Frame);
+    }
+    frames[3].mac[5] ^= 1;                  /* Forged MAC */
+    frames[7] = frames[6];                  /* Replay within the burst */
+    frames[9].src_node = 3;                 /* Unknown key */
+    frames[12].magic = 0;                   /* Malformed */
+    lens[15] = offsetof(Test_Auth_Frame, mac) - 1;  /* Truncated */
+
+    Aether_Validate_Result expect[COUNT];
+    for (size_t i = 0; i < COUNT; i++) {
+        uint16_t src = 0;
+        expect[i] = aether_security_validate_frame(&single, ptrs[i], lens[i], 5, &src);
+        if (expect[i] == AETHER_VALIDATE_OK) {
+            aether_security_accept_packet(&single, src, frames[i].seq_num);
+        }
+    }
+    ASSERT_EQ(expect[0], AETHER_VALIDATE_OK);
+    ASSERT_EQ(expect[3], AETHER_VALIDATE_HMAC_FAIL);
+    ASSERT_EQ(expect[7], AETHER_VALIDATE_REPLAY);
+    ASSERT_EQ(expect[9], AETHER_VALIDATE_HMAC_FAIL);
+    ASSERT_EQ(expect[12], AETHER_VALIDATE_MALFORMED);
+
+    Aether_Validate_Result results[COUNT];
+    uint16_t srcs[COUNT];
+    size_t passed = aether_security_validate_frames(&batch, ptrs, lens, COUNT, 5,
+                                                    results, srcs);
+    size_t expect_passed = 0;
+    for (size_t i = 0; i < COUNT; i++) {
+        ASSERT_EQ(results[i], expect[i]);
+        if (expect[i] == AETHER_VALIDATE_OK) {
+            ASSERT_EQ(srcs[i], frames[i].src_node);
+            expect_passed++;
+        }
+    }
+    ASSERT_EQ(passed, expect_passed);
+    /* Bucket of 7 per node: the last node 1 frames are rate limited */
+    ASSERT_EQ(results[COUNT - 1], AETHER_VALIDATE_RATE_LIMITED);
+
+    uint64_t v1, r1, h1, p1, l1, d1, v2, r2, h2, p2, l2, d2;
+    aether_security_get_stats(&single, &v1, &r1, &h1, &p1, &l1, &d1);
+    aether_security_get_stats(&batch, &v2, &r2, &h2, &p2, &l2, &d2);
+    ASSERT_EQ(v1, v2);
+    ASSERT_EQ(r1, r2);
+    ASSERT_EQ(h1, h2);
+    ASSERT_EQ(p1, p2);
+    ASSERT_EQ(l1, l2);
+    ASSERT_EQ(batch.rate[1].tokens, single.rate[1].tokens);
+    ASSERT_EQ(batch.rate[2].tokens, single.rate[2].tokens);
+
+    aether_security_destroy(&single);
+    aether_security_destroy(&batch);
+}
+
+TEST(validate_frames_forged_burst) {
+    static Aether_Security_State single;
+    static Aether_Security_State batch;
+    uint8_t key[AETHER_HMAC_KEY_SIZE];
+    memset(key, 0x33, sizeof(key));
+
+    Aether_Security_State* states[2] = { &single, &batch };
+    for (int s = 0; s < 2; s++) {
+        ASSERT_TRUE(seraph_vbit_is_true(aether_security_init(states[s])));
+        aether_rate_config_init(&states[s]->rate_config, 1000, 3, 1000);
+        aether_security_set_node_key(states[s], 1, key, AETHER_NODE_PERM_ALL);
+    }
+
+    /* Forged frames ahead of valid ones in one group of eight */
+    enum { COUNT = 6 };
+    static Test_Auth_Frame frames[COUNT];
+    const void* ptrs[COUNT];
+    size_t lens[COUNT];
+    for (uint32_t i = 0; i < COUNT; i++) {
+        test_build_frame(&frames[i], &single, 1, 200 + i);
+        if (i < 3) frames[i].mac[0] ^= 0x80;
+        ptrs[i] = &frames[i];
+        lens[i] = sizeof(Test_Auth_Frame);
+    }
+
+    Aether_Validate_Result expect[COUNT];
+    for (size_t i = 0; i < COUNT; i++) {
+        uint16_t src = 0;
+        expect[i] = aether_security_validate_frame(&single, ptrs[i], lens[i], 5, &src);
+        if (expect[i] == AETHER_VALIDATE_OK) {
+            aether_security_accept_packet(&single, src, frames[i].seq_num);
+        }
+    }
+
+    Aether_Validate_Result results[COUNT];
+    size_t passed = aether_security_validate_frames(&batch, ptrs, lens, COUNT, 5,
+                                                    results, NULL);
+    ASSERT_EQ(passed, 3);
+    for (size_t i = 0; i < COUNT; i++) {
+        ASSERT_EQ(results[i], expect[i]);
+        ASSERT_EQ(results[i], i < 3 ? AETHER_VALIDATE_HMAC_FAIL : AETHER_VALIDATE_OK);
+    }
+    ASSERT_EQ(batch.rate[1].tokens, single.rate[1].tokens);
+
+    aether_security_destroy(&single);
+    aether_security_destroy(&batch);
+}
+
 /*============================================================================
  * Main Test Runner
  *============================================================================*/
@@ -970,6 +1206,12 @@ void run_aether_tests(void) {
     RUN_TEST(null_parameter_handling);
     RUN_TEST(multiple_sim_nodes);
 
+    printf("\nFrame Authentication:\n");
+    RUN_TEST(hmac_rfc4231);
+    RUN_TEST(hmac_multi);
+    RUN_TEST(validate_frames_batch);
+    RUN_TEST(validate_frames_forged_burst);
+
     printf("\n=== Aether Tests Complete ===\n");
     printf("Tests run: %d, Passed: %d\n\n", tests_run, tests_passed);
 }
@@ -7,6 +7,7 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#include <stddef.h>
 
 #ifdef _WIN32
 #include <windows.h>
@@ -54,6 +55,8 @@ static int test_failed_flag = 0;
 /* Test file path */
 static const char* TEST_PATH = "test_atlas.dat";
 static const char* TEST_PATH_2 = "test_atlas_2.dat";
+static const char* TEST_EXPORT_PATH = "test_atlas_export.snap";
+static const char* TEST_DELTA_PATH = "test_atlas_delta.snap";
 
 /*
  * Note: Static storage was removed - tests use local variables with 8MB stack.
@@ -65,6 +68,35 @@ static const char* TEST_PATH_2 = "test_atlas_2.dat";
 static void cleanup_test_files(void) {
     unlink(TEST_PATH);
     unlink(TEST_PATH_2);
+    unlink(TEST_EXPORT_PATH);
+    unlink(TEST_DELTA_PATH);
+}
+
+/*
+ * Copy the backing file as it stands, simulating a crash: the copy holds
+ * whatever had been written when the "power failed".
+ */
+static int copy_test_file(const char* from, const char* to) {
+    FILE* in = fopen(from, "rb");
+    FILE* out = fopen(to, "wb");
+    char buf[8192];
+    size_t n;
+    int ok = in != NULL && out != NULL;
+    while (ok && (n = fread(buf, 1, sizeof(buf), in)) > 0) {
+        ok = fwrite(buf, 1, n, out) == n;
+    }
+    if (in) fclose(in);
+    if (out) fclose(out);
+    return ok;
+}
+
+/* Overwrite bytes of a file in place */
+static int patch_test_file(const char* path, uint64_t offset, const void* data, size_t size) {
+    FILE* f = fopen(path, "r+b");
+    if (f == NULL) return 0;
+    int ok = fseek(f, (long)offset, SEEK_SET) == 0 && fwrite(data, 1, size, f) == size;
+    fclose(f);
+    return ok;
 }
 
 /*============================================================================
@@ -516,6 +548,102 @@ TEST(test_atlas_tx_multiple) {
     cleanup_test_files();
 }
 
+TEST(test_atlas_tx_disjoint_pages) {
+    cleanup_test_files();
+
+    Seraph_Atlas atlas;
+    seraph_atlas_init(&atlas, TEST_PATH, 1024 * 1024);
+
+    uint64_t* a = (uint64_t*)seraph_atlas_alloc_pages(&atlas, SERAPH_PAGE_SIZE);
+    uint64_t* b = (uint64_t*)seraph_atlas_alloc_pages(&atlas, SERAPH_PAGE_SIZE);
+    ASSERT_NOT_NULL(a);
+    ASSERT_NOT_NULL(b);
+
+    Seraph_Atlas_Transaction* tx1 = seraph_atlas_begin(&atlas);
+    Seraph_Atlas_Transaction* tx2 = seraph_atlas_begin(&atlas);
+    ASSERT_NOT_NULL(tx1);
+    ASSERT_NOT_NULL(tx2);
+
+    /* Writers on different pages do not conflict */
+    ASSERT_TRUE(seraph_vbit_is_true(seraph_atlas_tx_mark_dirty(tx1, a, sizeof(*a))));
+    ASSERT_TRUE(seraph_vbit_is_true(seraph_atlas_tx_mark_dirty(tx2, b, sizeof(*b))));
+    *a = 1;
+    *b = 2;
+
+    ASSERT_TRUE(seraph_vbit_is_true(seraph_atlas_commit(&atlas, tx1)));
+    ASSERT_TRUE(seraph_vbit_is_true(seraph_atlas_commit(&atlas, tx2)));
+
+    seraph_atlas_destroy(&atlas);
+    cleanup_test_files();
+}
+
+TEST(test_atlas_tx_conflict) {
+    cleanup_test_files();
+
+    Seraph_Atlas atlas;
+    seraph_atlas_init(&atlas, TEST_PATH, 1024 * 1024);
+
+    uint64_t* a = (uint64_t*)seraph_atlas_alloc_pages(&atlas, SERAPH_PAGE_SIZE);
+    ASSERT_NOT_NULL(a);
+
+    Seraph_Atlas_Genesis* genesis = seraph_atlas_genesis(&atlas);
+    uint64_t abort_count_before = genesis->abort_count;
+
+    Seraph_Atlas_Transaction* writer = seraph_atlas_begin(&atlas);
+    Seraph_Atlas_Transaction* reader = seraph_atlas_begin(&atlas);
+    ASSERT_NOT_NULL(writer);
+    ASSERT_NOT_NULL(reader);
+
+    ASSERT_TRUE(seraph_vbit_is_true(seraph_atlas_tx_mark_read(reader, a, sizeof(*a))));
+    ASSERT_TRUE(seraph_vbit_is_true(seraph_atlas_tx_mark_dirty(writer, a, sizeof(*a))));
+    ASSERT_TRUE(seraph_vbit_is_true(seraph_atlas_commit(&atlas, writer)));
+
+    /* The reader saw a version that has since been overwritten */
+    ASSERT_TRUE(seraph_vbit_is_false(seraph_atlas_commit(&atlas, reader)));
+    ASSERT_EQ(reader->state, SERAPH_ATLAS_TX_ABORTED);
+    ASSERT_EQ(genesis->abort_count, abort_count_before + 1);
+
+    /* A transaction that starts afterwards sees the new version */
+    Seraph_Atlas_Transaction* retry = seraph_atlas_begin(&atlas);
+    ASSERT_NOT_NULL(retry);
+    ASSERT_TRUE(seraph_vbit_is_true(seraph_atlas_tx_mark_read(retry, a, sizeof(*a))));
+    ASSERT_TRUE(seraph_vbit_is_true(seraph_atlas_commit(&atlas, retry)));
+
+    /* Reads outside Atlas cannot be tracked */
+    uint64_t local = 0;
+    Seraph_Atlas_Transaction* tx = seraph_atlas_begin(&atlas);
+    ASSERT_TRUE(seraph_vbit_is_void(seraph_atlas_tx_mark_read(tx, &local, sizeof(local))));
+    seraph_atlas_abort(&atlas, tx);
+
+    seraph_atlas_destroy(&atlas);
+    cleanup_test_files();
+}
+
+TEST(test_atlas_tx_table_growth) {
+    cleanup_test_files();
+
+    Seraph_Atlas atlas;
+    seraph_atlas_init(&atlas, TEST_PATH, 1024 * 1024);
+
+    /* Far more concurrent transactions than the initial table holds */
+    Seraph_Atlas_Transaction* txs[100];
+    for (int i = 0; i < 100; i++) {
+        txs[i] = seraph_atlas_begin(&atlas);
+        ASSERT_NOT_NULL(txs[i]);
+    }
+    ASSERT_TRUE(atlas.tx_capacity >= 100);
+    ASSERT_NE(txs[0], txs[99]);
+
+    /* Earlier transactions stay valid across table growth */
+    for (int i = 0; i < 100; i++) {
+        ASSERT_EQ(txs[i]->state, SERAPH_ATLAS_TX_ACTIVE);
+        ASSERT_TRUE(seraph_vbit_is_true(seraph_atlas_commit(&atlas, txs[i])));
+    }
+
+    seraph_atlas_destroy(&atlas);
+    cleanup_test_files();
+}
+
 /*============================================================================
  * Persistence Tests
  *============================================================================*/
@@ -583,6 +711,184 @@ TEST(test_atlas_genesis_survives_reopen) {
     cleanup_test_files();
 }
 
+TEST(test_atlas_log_replay) {
+    cleanup_test_files();
+
+    Seraph_Atlas atlas;
+    seraph_atlas_init(&atlas, TEST_PATH, 1024 * 1024);
+    ASSERT_TRUE(seraph_atlas_get_stats(&atlas).log_size > 0);
+
+    uint64_t* data = (uint64_t*)seraph_atlas_alloc(&atlas, sizeof(uint64_t));
+    ASSERT_NOT_NULL(data);
+    *data = 1;
+    seraph_atlas_set_root(&atlas, data);
+    ASSERT_TRUE(seraph_vbit_is_true(seraph_atlas_checkpoint(&atlas)));
+    ASSERT_EQ(seraph_atlas_get_stats(&atlas).log_used, 0);
+
+    /* Committed only to the log */
+    Seraph_Atlas_Transaction* tx = seraph_atlas_begin(&atlas);
+    ASSERT_NOT_NULL(tx);
+    *data = 42;
+    seraph_atlas_tx_mark_dirty(tx, data, sizeof(*data));
+    ASSERT_TRUE(seraph_vbit_is_true(seraph_atlas_commit(&atlas, tx)));
+    ASSERT_TRUE(seraph_atlas_get_stats(&atlas).log_used > 0);
+
+    uint64_t offset = seraph_atlas_ptr_to_offset(&atlas, data);
+    uint64_t commit_count = seraph_atlas_genesis(&atlas)->commit_count;
+
+    /* Crash with the data page still holding its checkpointed value */
+    ASSERT_TRUE(copy_test_file(TEST_PATH, TEST_PATH_2));
+    uint64_t stale = 1;
+    ASSERT_TRUE(patch_test_file(TEST_PATH_2, offset, &stale, sizeof(stale)));
+    seraph_atlas_destroy(&atlas);
+
+    Seraph_Atlas recovered;
+    ASSERT_TRUE(seraph_vbit_is_true(seraph_atlas_init(&recovered, TEST_PATH_2, 0)));
+    uint64_t* root = (uint64_t*)seraph_atlas_get_root(&recovered);
+    ASSERT_NOT_NULL(root);
+    ASSERT_EQ(*root, 42);
+    ASSERT_EQ(seraph_atlas_genesis(&recovered)->commit_count, commit_count);
+
+    /* Replay made the recovered state the new checkpoint */
+    ASSERT_EQ(seraph_atlas_get_stats(&recovered).log_used, 0);
+
+    seraph_atlas_destroy(&recovered);
+    cleanup_test_files();
+}
+
+TEST(test_atlas_log_torn_record) {
+    cleanup_test_files();
+
+    Seraph_Atlas atlas;
+    seraph_atlas_init(&atlas, TEST_PATH, 1024 * 1024);
+
+    uint64_t* data = (uint64_t*)seraph_atlas_alloc(&atlas, sizeof(uint64_t));
+    ASSERT_NOT_NULL(data);
+    *data = 1;
+    seraph_atlas_set_root(&atlas, data);
+    seraph_atlas_checkpoint(&atlas);
+
+    Seraph_Atlas_Genesis* genesis = seraph_atlas_genesis(&atlas);
+    uint64_t record_at = genesis->log_offset + genesis->log_checkpoint_lsn % genesis->log_size;
+
+    Seraph_Atlas_Transaction* tx = seraph_atlas_begin(&atlas);
+    *data = 42;
+    seraph_atlas_tx_mark_dirty(tx, data, sizeof(*data));
+    ASSERT_TRUE(seraph_vbit_is_true(seraph_atlas_commit(&atlas, tx)));
+
+    uint64_t offset = seraph_atlas_ptr_to_offset(&atlas, data);
+    ASSERT_TRUE(copy_test_file(TEST_PATH, TEST_PATH_2));
+    seraph_atlas_destroy(&atlas);
+
+    /* Damage the record's after-image and revert the data page */
+    uint64_t stale = 1;
+    uint8_t garbage = 0xA5;
+    uint64_t image_at = record_at + sizeof(Seraph_Atlas_Log_Record) +
+                        sizeof(Seraph_Atlas_Genesis) + sizeof(Seraph_Atlas_Log_Range);
+    ASSERT_TRUE(patch_test_file(TEST_PATH_2, image_at, &garbage, 1));
+    ASSERT_TRUE(patch_test_file(TEST_PATH_2, offset, &stale, sizeof(stale)));
+
+    /* The checksum rejects the record, so the last checkpoint stands */
+    Seraph_Atlas recovered;
+    ASSERT_TRUE(seraph_vbit_is_true(seraph_atlas_init(&recovered, TEST_PATH_2, 0)));
+    uint64_t* root = (uint64_t*)seraph_atlas_get_root(&recovered);
+    ASSERT_NOT_NULL(root);
+    ASSERT_EQ(*root, 1);
+
+    seraph_atlas_destroy(&recovered);
+    cleanup_test_files();
+}
+
+TEST(test_atlas_log_wraparound) {
+    cleanup_test_files();
+
+    Seraph_Atlas atlas;
+    seraph_atlas_init(&atlas, TEST_PATH, 1024 * 1024);
+    size_t log_size = seraph_atlas_get_stats(&atlas).log_size;
+
+    uint8_t* block = (uint8_t*)seraph_atlas_alloc(&atlas, 3000);
+    ASSERT_NOT_NULL(block);
+
+    /* Write several times the log's capacity; checkpoints free space */
+    uint32_t commits = (uint32_t)(log_size / 3000) * 4;
+    for (uint32_t i = 0; i < commits; i++) {
+        Seraph_Atlas_Transaction* tx = seraph_atlas_begin(&atlas);
+        ASSERT_NOT_NULL(tx);
+        memset(block, (int)(i & 0xFF), 3000);
+        seraph_atlas_tx_mark_dirty(tx, block, 3000);
+        ASSERT_TRUE(seraph_vbit_is_true(seraph_atlas_commit(&atlas, tx)));
+    }
+
+    Seraph_Atlas_Stats stats = seraph_atlas_get_stats(&atlas);
+    ASSERT_TRUE(stats.checkpoints > 0);
+    ASSERT_TRUE(stats.log_used <= log_size);
+    ASSERT_TRUE(stats.log_flushes >= commits / 2);
+
+    uint64_t offset = seraph_atlas_ptr_to_offset(&atlas, block);
+    ASSERT_TRUE(copy_test_file(TEST_PATH, TEST_PATH_2));
+    seraph_atlas_destroy(&atlas);
+
+    /* Revert the block; replay of the tail of the log restores it */
+    uint8_t zeros[3000] = {0};
+    ASSERT_TRUE(patch_test_file(TEST_PATH_2, offset, zeros, sizeof(zeros)));
+
+    Seraph_Atlas recovered;
+    ASSERT_TRUE(seraph_vbit_is_true(seraph_atlas_init(&recovered, TEST_PATH_2, 0)));
+    uint8_t* restored = (uint8_t*)seraph_atlas_offset_to_ptr(&recovered, offset);
+    ASSERT_EQ(restored[0], (uint8_t)((commits - 1) & 0xFF));
+    ASSERT_EQ(restored[2999], (uint8_t)((commits - 1) & 0xFF));
+
+    seraph_atlas_destroy(&recovered);
+    cleanup_test_files();
+}
+
+TEST(test_atlas_log_oversized_commit) {
+    cleanup_test_files();
+
+    Seraph_Atlas atlas;
+    seraph_atlas_init(&atlas, TEST_PATH, 4 * 1024 * 1024);
+    size_t log_size = seraph_atlas_get_stats(&atlas).log_size;
+    ASSERT_TRUE(log_size > 0);
+
+    uint64_t* data = (uint64_t*)seraph_atlas_alloc(&atlas, sizeof(uint64_t));
+    uint8_t* block = (uint8_t*)seraph_atlas_alloc(&atlas, log_size);
+    ASSERT_NOT_NULL(data);
+    ASSERT_NOT_NULL(block);
+    seraph_atlas_set_root(&atlas, data);
+    seraph_atlas_checkpoint(&atlas);
+
+    /* Logged commit */
+    Seraph_Atlas_Transaction* tx = seraph_atlas_begin(&atlas);
+    *data = 1;
+    seraph_atlas_tx_mark_dirty(tx, data, sizeof(*data));
+    ASSERT_TRUE(seraph_vbit_is_true(seraph_atlas_commit(&atlas, tx)));
+    ASSERT_TRUE(seraph_atlas_get_stats(&atlas).log_used > 0);
+
+    /* Too large for the log, so it is synced directly */
+    tx = seraph_atlas_begin(&atlas);
+    *data = 2;
+    memset(block, 0x5A, log_size);
+    seraph_atlas_tx_mark_dirty(tx, data, sizeof(*data));
+    seraph_atlas_tx_mark_dirty(tx, block, log_size);
+    ASSERT_TRUE(seraph_vbit_is_true(seraph_atlas_commit(&atlas, tx)));
+    ASSERT_EQ(seraph_atlas_get_stats(&atlas).log_used, 0);
+
+    uint64_t commit_count = seraph_atlas_genesis(&atlas)->commit_count;
+    ASSERT_TRUE(copy_test_file(TEST_PATH, TEST_PATH_2));
+    seraph_atlas_destroy(&atlas);
+
+    /* Replay must not re-apply the older record over the synced commit */
+    Seraph_Atlas recovered;
+    ASSERT_TRUE(seraph_vbit_is_true(seraph_atlas_init(&recovered, TEST_PATH_2, 0)));
+    uint64_t* root = (uint64_t*)seraph_atlas_get_root(&recovered);
+    ASSERT_NOT_NULL(root);
+    ASSERT_EQ(*root, 2);
+    ASSERT_EQ(seraph_atlas_genesis(&recovered)->commit_count, commit_count);
+
+    seraph_atlas_destroy(&recovered);
+    cleanup_test_files();
+}
+
 /*============================================================================
  * Generation Table Tests
  *============================================================================*/
@@ -792,6 +1098,427 @@ TEST(test_atlas_sync_range) {
     cleanup_test_files();
 }
 
+/*============================================================================
+ * Snapshot Tests
+ *============================================================================*/
+
+TEST(test_atlas_snapshot_write_fault) {
+    cleanup_test_files();
+
+    Seraph_Atlas atlas;
+    ASSERT_TRUE(seraph_vbit_is_true(seraph_atlas_init(&atlas, TEST_PATH, 1024 * 1024)));
+
+    uint8_t* pages = (uint8_t*)seraph_atlas_alloc_pages(&atlas, 4 * SERAPH_PAGE_SIZE);
+    ASSERT_NOT_NULL(pages);
+    memset(pages, 0xAA, 4 * SERAPH_PAGE_SIZE);
+
+    Seraph_Atlas_Snapshot* snap = seraph_atlas_snapshot_begin(&atlas, NULL);
+    ASSERT_NOT_NULL(snap);
+    ASSERT_TRUE(seraph_vbit_is_true(
+        seraph_atlas_snapshot_include(&atlas, snap, pages, 4 * SERAPH_PAGE_SIZE)));
+    ASSERT_TRUE(seraph_vbit_is_true(seraph_atlas_snapshot_activate(&atlas, snap)));
+
+    /* Plain stores; the write fault takes the copies */
+    pages[0] = 0x11;
+    pages[2 * SERAPH_PAGE_SIZE + 7] = 0x22;
+    pages[2 * SERAPH_PAGE_SIZE + 8] = 0x33;
+    ASSERT_EQ(snap->cow_page_count, 2u);
+
+    const uint8_t* old0 = (const uint8_t*)seraph_atlas_snapshot_read_page(&atlas, snap, pages);
+    const uint8_t* old1 = (const uint8_t*)seraph_atlas_snapshot_read_page(
+        &atlas, snap, pages + SERAPH_PAGE_SIZE);
+    ASSERT_NOT_NULL(old0);
+    ASSERT_NE(old0, pages);
+    ASSERT_EQ(old0[0], 0xAA);
+    ASSERT_EQ(old1, pages + SERAPH_PAGE_SIZE);
+
+    /* An explicit copy of an already copied page is a no-op */
+    ASSERT_TRUE(seraph_vbit_is_false(seraph_atlas_snapshot_cow_page(&atlas, snap, pages)));
+
+    /* Still copying after commit, so restore sees the activation state */
+    ASSERT_TRUE(seraph_vbit_is_true(seraph_atlas_snapshot_commit(&atlas, snap)));
+    pages[3 * SERAPH_PAGE_SIZE] = 0x44;
+    ASSERT_EQ(snap->cow_page_count, 3u);
+
+    ASSERT_TRUE(seraph_vbit_is_true(seraph_atlas_snapshot_restore(&atlas, snap)));
+    ASSERT_EQ(pages[0], 0xAA);
+    ASSERT_EQ(pages[2 * SERAPH_PAGE_SIZE + 7], 0xAA);
+    ASSERT_EQ(pages[3 * SERAPH_PAGE_SIZE], 0xAA);
+
+    ASSERT_TRUE(seraph_vbit_is_true(seraph_atlas_snapshot_delete(&atlas, snap)));
+    pages[SERAPH_PAGE_SIZE] = 0x55;
+    ASSERT_EQ(pages[SERAPH_PAGE_SIZE], 0x55);
+
+    seraph_atlas_destroy(&atlas);
+    cleanup_test_files();
+}
+
+TEST(test_atlas_snapshot_many_pages) {
+    cleanup_test_files();
+
+    /* Twice the old fixed limit of 1024 tracked pages */
+    const size_t count = 2048;
+    Seraph_Atlas atlas;
+    ASSERT_TRUE(seraph_vbit_is_true(seraph_atlas_init(&atlas, TEST_PATH, 32 * 1024 * 1024)));
+
+    uint8_t* pages = (uint8_t*)seraph_atlas_alloc_pages(&atlas, count * SERAPH_PAGE_SIZE);
+    ASSERT_NOT_NULL(pages);
+    for (size_t i = 0; i < count; i++) {
+        pages[i * SERAPH_PAGE_SIZE] = (uint8_t)i;
+    }
+
+    Seraph_Atlas_Snapshot* snap = seraph_atlas_snapshot_begin(&atlas, NULL);
+    ASSERT_NOT_NULL(snap);
+    ASSERT_TRUE(seraph_vbit_is_true(seraph_atlas_snapshot_include_all(&atlas, snap)));
+    ASSERT_TRUE(seraph_vbit_is_true(seraph_atlas_snapshot_activate(&atlas, snap)));
+
+    for (size_t i = 0; i < count; i++) {
+        pages[i * SERAPH_PAGE_SIZE] = (uint8_t)(i + 1);
+    }
+    ASSERT_EQ(snap->cow_page_count, count);
+    ASSERT_EQ(snap->state, SERAPH_ATLAS_SNAP_ACTIVE);
+
+    for (size_t i = 0; i < count; i += 97) {
+        const uint8_t* old = (const uint8_t*)seraph_atlas_snapshot_read_page(
+            &atlas, snap, pages + i * SERAPH_PAGE_SIZE);
+        ASSERT_NOT_NULL(old);
+        ASSERT_EQ(old[0], (uint8_t)i);
+    }
+
+    /* Abort frees the copies and leaves every page writable */
+    seraph_atlas_snapshot_abort(&atlas, snap);
+    ASSERT_EQ(snap->cow_page_count, 0u);
+    for (size_t i = 0; i < count; i++) {
+        pages[i * SERAPH_PAGE_SIZE] = 0;
+    }
+    ASSERT_EQ(pages[(count - 1) * SERAPH_PAGE_SIZE], 0);
+
+    seraph_atlas_destroy(&atlas);
+    cleanup_test_files();
+}
+
+TEST(test_atlas_snapshot_overlapping) {
+    cleanup_test_files();
+
+    Seraph_Atlas atlas;
+    ASSERT_TRUE(seraph_vbit_is_true(seraph_atlas_init(&atlas, TEST_PATH, 1024 * 1024)));
+
+    uint64_t* value = (uint64_t*)seraph_atlas_alloc_pages(&atlas, SERAPH_PAGE_SIZE);
+    ASSERT_NOT_NULL(value);
+    *value = 1;
+
+    Seraph_Atlas_Snapshot* a = seraph_atlas_snapshot_begin(&atlas, NULL);
+    ASSERT_NOT_NULL(a);
+    seraph_atlas_snapshot_include(&atlas, a, value, sizeof(*value));
+    ASSERT_TRUE(seraph_vbit_is_true(seraph_atlas_snapshot_activate(&atlas, a)));
+    *value = 2;
+
+    Seraph_Atlas_Snapshot* b = seraph_atlas_snapshot_begin(&atlas, NULL);
+    ASSERT_NOT_NULL(b);
+    seraph_atlas_snapshot_include(&atlas, b, value, sizeof(*value));
+    ASSERT_TRUE(seraph_vbit_is_true(seraph_atlas_snapshot_activate(&atlas, b)));
+
+    /* Aborting one snapshot must not unprotect a page the other still needs */
+    seraph_atlas_snapshot_abort(&atlas, a);
+    *value = 3;
+
+    const uint64_t* old = (const uint64_t*)seraph_atlas_snapshot_read_page(&atlas, b, value);
+    ASSERT_NOT_NULL(old);
+    ASSERT_EQ(*old, 2u);
+    ASSERT_EQ(*value, 3u);
+
+    seraph_atlas_snapshot_abort(&atlas, b);
+    seraph_atlas_destroy(&atlas);
+    cleanup_test_files();
+}
+
+/* Take a committed include_all snapshot */
+static Seraph_Atlas_Snapshot* take_snapshot(Seraph_Atlas* atlas) {
+    Seraph_Atlas_Snapshot* snap = seraph_atlas_snapshot_begin(atlas, NULL);
+    if (snap == NULL ||
+        !seraph_vbit_is_true(seraph_atlas_snapshot_include_all(atlas, snap)) ||
+        !seraph_vbit_is_true(seraph_atlas_snapshot_activate(atlas, snap)) ||
+        !seraph_vbit_is_true(seraph_atlas_snapshot_commit(atlas, snap))) {
+        return NULL;
+    }
+    return snap;
+}
+
+TEST(test_atlas_snapshot_export_full) {
+    cleanup_test_files();
+
+    Seraph_Atlas src;
+    ASSERT_TRUE(seraph_vbit_is_true(seraph_atlas_init(&src, TEST_PATH, 1024 * 1024)));
+    uint64_t* data = (uint64_t*)seraph_atlas_alloc_pages(&src, 8 * SERAPH_PAGE_SIZE);
+    ASSERT_NOT_NULL(data);
+    for (size_t i = 0; i < 8 * SERAPH_PAGE_SIZE / sizeof(uint64_t); i += 64) {
+        data[i] = i * 0x9E3779B97F4A7C15ULL;
+    }
+    seraph_atlas_set_root(&src, data);
+
+    Seraph_Atlas_Snapshot* snap = take_snapshot(&src);
+    ASSERT_NOT_NULL(snap);
+    data[0] = 0xDEAD;  /* After the snapshot: must not be exported */
+
+    Seraph_Atlas_Export_Stats out;
+    ASSERT_TRUE(seraph_vbit_is_true(
+        seraph_atlas_snapshot_export(&src, snap, 0, TEST_EXPORT_PATH, &out)));
+    ASSERT_TRUE(out.file_bytes < out.page_bytes / 4);  /* Sparse pages compress */
+
+    Seraph_Atlas dst;
+    ASSERT_TRUE(seraph_vbit_is_true(seraph_atlas_init(&dst, TEST_PATH_2, 1024 * 1024)));
+    Seraph_Atlas_Export_Stats in;
+    ASSERT_TRUE(seraph_vbit_is_true(seraph_atlas_snapshot_import(&dst, TEST_EXPORT_PATH, &in)));
+    ASSERT_EQ(in.pages, out.pages);
+
+    uint64_t* copy = (uint64_t*)seraph_atlas_get_root(&dst);
+    ASSERT_NOT_NULL(copy);
+    ASSERT_EQ(seraph_atlas_ptr_to_offset(&dst, copy), seraph_atlas_ptr_to_offset(&src, data));
+    ASSERT_EQ(copy[0], 0u);
+    for (size_t i = 64; i < 8 * SERAPH_PAGE_SIZE / sizeof(uint64_t); i += 64) {
+        ASSERT_EQ(copy[i], i * 0x9E3779B97F4A7C15ULL);
+    }
+
+    seraph_atlas_destroy(&dst);
+    seraph_atlas_destroy(&src);
+    cleanup_test_files();
+}
+
+TEST(test_atlas_snapshot_export_delta) {
+    cleanup_test_files();
+
+    Seraph_Atlas src;
+    ASSERT_TRUE(seraph_vbit_is_true(seraph_atlas_init(&src, TEST_PATH, 4 * 1024 * 1024)));
+    uint8_t* data = (uint8_t*)seraph_atlas_alloc_pages(&src, 256 * SERAPH_PAGE_SIZE);
+    ASSERT_NOT_NULL(data);
+    for (size_t i = 0; i < 256 * SERAPH_PAGE_SIZE; i++) {
+        data[i] = (uint8_t)(i * 31 + (i >> 12));
+    }
+
+    Seraph_Atlas_Snapshot* base = take_snapshot(&src);
+    ASSERT_NOT_NULL(base);
+    ASSERT_TRUE(seraph_vbit_is_true(
+        seraph_atlas_snapshot_export(&src, base, 0, TEST_EXPORT_PATH, NULL)));
+
+    /* Change two old pages and add a new one */
+    data[5 * SERAPH_PAGE_SIZE + 100] ^= 0xFF;
+    data[200 * SERAPH_PAGE_SIZE] ^= 0x01;
+    uint8_t* extra = (uint8_t*)seraph_atlas_alloc_pages(&src, SERAPH_PAGE_SIZE);
+    ASSERT_NOT_NULL(extra);
+    memset(extra, 0x5A, SERAPH_PAGE_SIZE);
+
+    Seraph_Atlas_Snapshot* next = take_snapshot(&src);
+    ASSERT_NOT_NULL(next);
+    Seraph_Atlas_Export_Stats full;
+    Seraph_Atlas_Export_Stats delta;
+    ASSERT_TRUE(seraph_vbit_is_true(
+        seraph_atlas_snapshot_export(&src, next, 0, TEST_DELTA_PATH, &full)));
+    ASSERT_TRUE(seraph_vbit_is_true(
+        seraph_atlas_snapshot_export(&src, next, base->snapshot_id, TEST_DELTA_PATH, &delta)));
+    ASSERT_TRUE(delta.pages < 16);
+    ASSERT_TRUE(delta.file_bytes * 20 < full.file_bytes);
+
+    /* A delta is refused until its base has been imported */
+    Seraph_Atlas dst;
+    ASSERT_TRUE(seraph_vbit_is_true(seraph_atlas_init(&dst, TEST_PATH_2, 4 * 1024 * 1024)));
+    ASSERT_TRUE(seraph_vbit_is_false(seraph_atlas_snapshot_import(&dst, TEST_DELTA_PATH, NULL)));
+    ASSERT_TRUE(seraph_vbit_is_true(seraph_atlas_snapshot_import(&dst, TEST_EXPORT_PATH, NULL)));
+    ASSERT_TRUE(seraph_vbit_is_true(seraph_atlas_snapshot_import(&dst, TEST_DELTA_PATH, NULL)));
+
+    uint8_t* copy = (uint8_t*)dst.base + seraph_atlas_ptr_to_offset(&src, data);
+    ASSERT_TRUE(memcmp(copy, data, 256 * SERAPH_PAGE_SIZE) == 0);
+    ASSERT_EQ(*((uint8_t*)dst.base + seraph_atlas_ptr_to_offset(&src, extra)), 0x5A);
+    ASSERT_EQ(seraph_atlas_genesis(&dst)->next_alloc_offset,
+              seraph_atlas_genesis(&src)->next_alloc_offset);
+
+    seraph_atlas_destroy(&dst);
+    seraph_atlas_destroy(&src);
+    cleanup_test_files();
+}
+
+TEST(test_atlas_snapshot_import_corrupt) {
+    cleanup_test_files();
+
+    Seraph_Atlas src;
+    ASSERT_TRUE(seraph_vbit_is_true(seraph_atlas_init(&src, TEST_PATH, 1024 * 1024)));
+    uint64_t* value = (uint64_t*)seraph_atlas_alloc_pages(&src, SERAPH_PAGE_SIZE);
+    ASSERT_NOT_NULL(value);
+    *value = 42;
+    Seraph_Atlas_Snapshot* snap = take_snapshot(&src);
+    ASSERT_NOT_NULL(snap);
+    Seraph_Atlas_Export_Stats out;
+    ASSERT_TRUE(seraph_vbit_is_true(
+        seraph_atlas_snapshot_export(&src, snap, 0, TEST_EXPORT_PATH, &out)));
+
+    /* Flip a byte in the last page record */
+    uint8_t junk = 0xA5;
+    ASSERT_TRUE(patch_test_file(TEST_EXPORT_PATH,
+        out.file_bytes - sizeof(Seraph_Atlas_Export_Trailer) - 1, &junk, 1));
+
+    Seraph_Atlas dst;
+    ASSERT_TRUE(seraph_vbit_is_true(seraph_atlas_init(&dst, TEST_PATH_2, 1024 * 1024)));
+    uint64_t next_alloc = seraph_atlas_genesis(&dst)->next_alloc_offset;
+    ASSERT_TRUE(seraph_vbit_is_false(seraph_atlas_snapshot_import(&dst, TEST_EXPORT_PATH, NULL)));
+    ASSERT_EQ(seraph_atlas_genesis(&dst)->next_alloc_offset, next_alloc);
+    ASSERT_EQ(*(uint64_t*)((uint8_t*)dst.base + seraph_atlas_ptr_to_offset(&src, value)), 0u);
+
+    seraph_atlas_destroy(&dst);
+    seraph_atlas_destroy(&src);
+    cleanup_test_files();
+}
+
+/*============================================================================
+ * Checkpoint Validation Tests
+ *============================================================================*/
+
+typedef struct Test_Node {
+    struct Test_Node* next;
+    int64_t value;
+} Test_Node;
+
+typedef struct {
+    int64_t refcount;
+} Test_Blob;
+
+/* The type registry is global, so register the test types once */
+static uint32_t test_node_type = SERAPH_VOID_U32;
+static uint32_t test_blob_type = SERAPH_VOID_U32;
+
+static int register_test_types(void) {
+    if (test_node_type == SERAPH_VOID_U32) {
+        test_node_type = seraph_atlas_checkpoint_register_type("test_node", sizeof(Test_Node));
+        Seraph_Atlas_Invariant acyclic =
+            seraph_atlas_invariant_no_cycle(offsetof(Test_Node, next), "acyclic");
+        Seraph_Atlas_Invariant range =
+            seraph_atlas_invariant_range(offsetof(Test_Node, value), 8, 0, 100, "value");
+        seraph_atlas_checkpoint_add_invariant(test_node_type, &acyclic);
+        seraph_atlas_checkpoint_add_invariant(test_node_type, &range);
+
+        test_blob_type = seraph_atlas_checkpoint_register_type("test_blob", sizeof(Test_Blob));
+        Seraph_Atlas_Invariant refs =
+            seraph_atlas_invariant_refcount(offsetof(Test_Blob, refcount), 1, false, "refs");
+        seraph_atlas_checkpoint_add_invariant(test_blob_type, &refs);
+    }
+    return test_node_type != SERAPH_VOID_U32 && test_blob_type != SERAPH_VOID_U32;
+}
+
+TEST(test_atlas_checkpoint_validate_threads) {
+    cleanup_test_files();
+    ASSERT_TRUE(register_test_types());
+
+    Seraph_Atlas atlas;
+    ASSERT_TRUE(seraph_vbit_is_true(seraph_atlas_init(&atlas, TEST_PATH, 4 * 1024 * 1024)));
+
+    /* Four lists of 500 nodes; the third loops back on itself halfway */
+    enum { LISTS = 4, LEN = 500 };
+    Test_Node* nodes = (Test_Node*)seraph_atlas_calloc(&atlas, LISTS * LEN * sizeof(Test_Node));
+    Test_Blob* blobs = (Test_Blob*)seraph_atlas_calloc(&atlas, LEN * sizeof(Test_Blob));
+    ASSERT_NOT_NULL(nodes);
+    ASSERT_NOT_NULL(blobs);
+    for (int l = 0; l < LISTS; l++) {
+        for (int k = 0; k < LEN; k++) {
+            Test_Node* node = &nodes[l * LEN + k];
+            node->next = k + 1 < LEN ? node + 1 : NULL;
+            node->value = k % 100;
+        }
+    }
+    nodes[2 * LEN + LEN - 1].next = &nodes[2 * LEN + LEN / 2];
+    nodes[7].value = 1000;
+    nodes[3 * LEN + 9].value = -1;
+    for (int k = 0; k < LEN; k++) {
+        blobs[k].refcount = k == 42 ? 0 : 1;
+    }
+
+    /* Interleave the types so grouping has work to do */
+    Seraph_Atlas_Checkpoint* ckpt =
+        seraph_atlas_checkpoint_create(&atlas, "threads", LISTS * LEN + LEN, 0);
+    ASSERT_NOT_NULL(ckpt);
+    for (int k = 0; k < LISTS * LEN; k++) {
+        ASSERT_TRUE(seraph_atlas_checkpoint_add_entry(&atlas, ckpt, &nodes[k],
+                                                      test_node_type, 0, 0));
+        if (k % LISTS == 0) {
+            ASSERT_TRUE(seraph_atlas_checkpoint_add_entry(&atlas, ckpt, &blobs[k / LISTS],
+                                                          test_blob_type, 0, 0));
+        }
+    }
+
+    Seraph_Atlas_Validation_Detail details[2][16];
+    Seraph_Atlas_Validation_Report reports[2];
+    static const uint32_t thread_counts[2] = { 1, 4 };
+    for (int r = 0; r < 2; r++) {
+        seraph_atlas_set_validate_threads(&atlas, thread_counts[r]);
+        memset(details[r], 0, sizeof(details[r]));
+        Seraph_Atlas_Validation_Report* report = &reports[r];
+        memset(report, 0, sizeof(*report));
+        report->details = details[r];
+        report->max_details = 16;
+        ASSERT_TRUE(seraph_vbit_is_false(seraph_atlas_checkpoint_validate(&atlas, ckpt, report)));
+    }
+
+    for (int r = 0; r < 2; r++) {
+        ASSERT_EQ(reports[r].entries_validated, (uint32_t)(LISTS * LEN + LEN));
+        ASSERT_EQ(reports[r].entries_failed, (uint32_t)(LEN + 3));
+        ASSERT_EQ(reports[r].invariants_checked, (uint32_t)(LISTS * LEN * 2 + LEN));
+        ASSERT_EQ(reports[r].invariants_failed, (uint32_t)(LEN + 3));
+    }
+    ASSERT_EQ(reports[0].detail_count, reports[1].detail_count);
+    ASSERT_EQ(memcmp(details[0], details[1], sizeof(details[0])), 0);
+
+    /* Details come out in entry order */
+    ASSERT_EQ(reports[0].detail_count, 16u);
+    for (uint32_t d = 1; d < reports[0].detail_count; d++) {
+        ASSERT_TRUE(details[0][d - 1].entry_index < details[0][d].entry_index);
+    }
+
+    /* Every node of the looping list reaches the cycle */
+    for (uint32_t i = 0; i < ckpt->entry_count; i++) {
+        Test_Node* node = (Test_Node*)ckpt->entries[i].ptr;
+        if (ckpt->entries[i].type_id == test_node_type &&
+            node >= &nodes[2 * LEN] && node < &nodes[3 * LEN]) {
+            ASSERT_EQ(ckpt->entries[i].last_result, SERAPH_ATLAS_VALIDATE_CYCLE_DETECTED);
+        }
+    }
+    ASSERT_FALSE(ckpt->entries[0].flags & SERAPH_ATLAS_ENTRY_INVALID);
+
+    seraph_atlas_destroy(&atlas);
+    cleanup_test_files();
+}
+
+TEST(test_atlas_checkpoint_validate_long_list) {
+    cleanup_test_files();
+    ASSERT_TRUE(register_test_types());
+
+    Seraph_Atlas atlas;
+    ASSERT_TRUE(seraph_vbit_is_true(seraph_atlas_init(&atlas, TEST_PATH, 8 * 1024 * 1024)));
+
+    /* One 60000-node list with every node registered: a walk per node
+     * would take billions of steps, the shared visited set takes one pass */
+    enum { LEN = 60000, BROKEN = 1000 };
+    Test_Node* nodes = (Test_Node*)seraph_atlas_calloc(&atlas, LEN * sizeof(Test_Node));
+    ASSERT_NOT_NULL(nodes);
+    for (int k = 0; k < LEN; k++) {
+        nodes[k].next = k + 1 < LEN ? &nodes[k + 1] : NULL;
+    }
+    nodes[BROKEN].next = (Test_Node*)(uintptr_t)0x10;
+
+    Seraph_Atlas_Checkpoint* ckpt = seraph_atlas_checkpoint_create(&atlas, "long", LEN, 0);
+    ASSERT_NOT_NULL(ckpt);
+    for (int k = 0; k < LEN; k++) {
+        ASSERT_TRUE(seraph_atlas_checkpoint_add_entry(&atlas, ckpt, &nodes[k],
+                                                      test_node_type, 0, 0));
+    }
+
+    Seraph_Atlas_Validation_Report report;
+    ASSERT_TRUE(seraph_vbit_is_false(seraph_atlas_checkpoint_validate(&atlas, ckpt, &report)));
+    ASSERT_EQ(report.entries_failed, (uint32_t)(BROKEN + 1));
+    ASSERT_EQ(ckpt->entries[0].last_result, SERAPH_ATLAS_VALIDATE_INVALID_PTR);
+    ASSERT_EQ(ckpt->entries[BROKEN].last_result, SERAPH_ATLAS_VALIDATE_INVALID_PTR);
+    ASSERT_FALSE(ckpt->entries[BROKEN + 1].flags & SERAPH_ATLAS_ENTRY_INVALID);
+
+    seraph_atlas_destroy(&atlas);
+    cleanup_test_files();
+}
+
 /*============================================================================
  * Main Test Runner
  *============================================================================*/
@@ -838,11 +1565,18 @@ void run_atlas_tests(void) {
     RUN_TEST(test_atlas_tx_commit);
     RUN_TEST(test_atlas_tx_abort);
     RUN_TEST(test_atlas_tx_multiple);
+    RUN_TEST(test_atlas_tx_disjoint_pages);
+    RUN_TEST(test_atlas_tx_conflict);
+    RUN_TEST(test_atlas_tx_table_growth);
 
     /* Persistence tests */
     printf("\nPersistence Tests:\n");
     RUN_TEST(test_atlas_data_survives_reopen);
     RUN_TEST(test_atlas_genesis_survives_reopen);
+    RUN_TEST(test_atlas_log_replay);
+    RUN_TEST(test_atlas_log_torn_record);
+    RUN_TEST(test_atlas_log_wraparound);
+    RUN_TEST(test_atlas_log_oversized_commit);
 
     /* Generation table tests */
     printf("\nGeneration Table Tests:\n");
@@ -865,6 +1599,20 @@ void run_atlas_tests(void) {
     RUN_TEST(test_atlas_sync);
     RUN_TEST(test_atlas_sync_range);
 
+    /* Snapshot tests */
+    printf("\nSnapshot Tests:\n");
+    RUN_TEST(test_atlas_snapshot_write_fault);
+    RUN_TEST(test_atlas_snapshot_many_pages);
+    RUN_TEST(test_atlas_snapshot_overlapping);
+    RUN_TEST(test_atlas_snapshot_export_full);
+    RUN_TEST(test_atlas_snapshot_export_delta);
+    RUN_TEST(test_atlas_snapshot_import_corrupt);
+
+    /* Checkpoint validation tests */
+    printf("\nCheckpoint Validation Tests:\n");
+    RUN_TEST(test_atlas_checkpoint_validate_threads);
+    RUN_TEST(test_atlas_checkpoint_validate_long_list);
+
     printf("\n----------------------------------------\n");
     printf("Atlas Tests: %d/%d passed\n", tests_passed, tests_run);
     printf("----------------------------------------\n");
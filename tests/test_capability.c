@@ -277,6 +277,112 @@ TEST(capability_copy) {
     ASSERT(memcmp(dst_buffer, src_buffer, 100) == 0);
 }
 
+/*============================================================================
+ * Bulk and Span Tests
+ *============================================================================*/
+
+TEST(capability_read_write_array) {
+    uint8_t buffer[300];
+    uint8_t data[200];
+    uint8_t back[200];
+    for (int i = 0; i < 200; i++) data[i] = (uint8_t)(i * 7);  /* includes 0xFF */
+    memset(buffer, 0, sizeof(buffer));
+
+    Seraph_Capability cap = seraph_cap_create(buffer, 300, 1, SERAPH_CAP_RW);
+    ASSERT(seraph_vbit_is_true(seraph_cap_write_array(cap, 50, data, 200)));
+    ASSERT(memcmp(buffer + 50, data, 200) == 0);
+    ASSERT(buffer[49] == 0 && buffer[250] == 0);
+
+    ASSERT(seraph_vbit_is_true(seraph_cap_read_array(cap, 50, back, 200)));
+    ASSERT(memcmp(back, data, 200) == 0);
+
+    /* One byte past the end fails without touching anything */
+    ASSERT(seraph_vbit_is_false(seraph_cap_write_array(cap, 101, data, 200)));
+    ASSERT(seraph_vbit_is_false(seraph_cap_read_array(cap, 101, back, 200)));
+    ASSERT(seraph_vbit_is_true(seraph_cap_read_array(cap, 300, back, 0)));
+
+    Seraph_Capability ro = seraph_cap_restrict(cap, SERAPH_CAP_WRITE);
+    ASSERT(seraph_vbit_is_false(seraph_cap_write_array(ro, 0, data, 10)));
+    ASSERT(seraph_vbit_is_void(seraph_cap_read_array(SERAPH_CAP_VOID, 0, back, 10)));
+    ASSERT(seraph_vbit_is_void(seraph_cap_read_array(cap, 0, NULL, 10)));
+}
+
+TEST(capability_fill_compare) {
+    uint8_t a[128];
+    uint8_t b[128];
+    memset(a, 0, sizeof(a));
+    memset(b, 0, sizeof(b));
+
+    Seraph_Capability ca = seraph_cap_create(a, 128, 1, SERAPH_CAP_RW);
+    Seraph_Capability cb = seraph_cap_create(b, 128, 1, SERAPH_CAP_RW);
+
+    ASSERT(seraph_vbit_is_true(seraph_cap_fill(ca, 8, 0x5A, 100)));
+    ASSERT(a[7] == 0 && a[8] == 0x5A && a[107] == 0x5A && a[108] == 0);
+    ASSERT(seraph_vbit_is_false(seraph_cap_fill(ca, 0, SERAPH_VOID_U8, 10)));
+    ASSERT(seraph_vbit_is_false(seraph_cap_fill(ca, 100, 0x01, 29)));
+
+    ASSERT(seraph_vbit_is_false(seraph_cap_compare(ca, 0, cb, 0, 128)));
+    ASSERT(seraph_vbit_is_true(seraph_cap_fill(cb, 8, 0x5A, 100)));
+    ASSERT(seraph_vbit_is_true(seraph_cap_compare(ca, 0, cb, 0, 128)));
+    ASSERT(seraph_vbit_is_true(seraph_cap_compare(ca, 8, cb, 9, 99)));
+    ASSERT(seraph_vbit_is_void(seraph_cap_compare(ca, 0, cb, 1, 128)));
+
+    Seraph_Capability wo = seraph_cap_restrict(cb, SERAPH_CAP_READ);
+    ASSERT(seraph_vbit_is_void(seraph_cap_compare(ca, 0, wo, 0, 16)));
+}
+
+TEST(capability_span) {
+    uint8_t buffer[64];
+    for (int i = 0; i < 64; i++) buffer[i] = (uint8_t)i;
+
+    Seraph_Capability cap = seraph_cap_create(buffer, 64, 1, SERAPH_CAP_RW);
+    Seraph_CapSpan span = seraph_cap_span(cap, 16, 32, SERAPH_CAP_READ);
+    ASSERT(!seraph_span_is_void(span));
+    ASSERT(span.length == 32);
+
+    uint32_t sum = 0;
+    for (uint64_t i = 0; i < span.length; i++) {
+        sum += seraph_span_read_u8(span, i);
+    }
+    ASSERT(sum == (16 + 47) * 32 / 2);
+    ASSERT(seraph_span_read_u16(span, 0) == seraph_cap_read_u16(cap, 16));
+    ASSERT(seraph_span_read_u64(span, 24) == seraph_cap_read_u64(cap, 40));
+
+    /* Accesses stay inside the span, not the capability */
+    ASSERT(SERAPH_IS_VOID_U8(seraph_span_read_u8(span, 32)));
+    ASSERT(SERAPH_IS_VOID_U32(seraph_span_read_u32(span, 29)));
+    ASSERT(SERAPH_IS_VOID_U64(seraph_span_read_u64(span, UINT64_MAX)));
+
+    /* Read-only span rejects writes */
+    ASSERT(seraph_vbit_is_false(seraph_span_write_u8(span, 0, 1)));
+
+    Seraph_CapSpan rw = seraph_cap_span(cap, 0, 64, SERAPH_CAP_RW);
+    ASSERT(seraph_vbit_is_true(seraph_span_write_u32(rw, 60, 0xDEADBEEF)));
+    ASSERT(seraph_cap_read_u32(cap, 60) == 0xDEADBEEF);
+    ASSERT(seraph_vbit_is_false(seraph_span_write_u32(rw, 61, 1)));
+    ASSERT(seraph_vbit_is_false(seraph_span_write_u16(rw, 0, SERAPH_VOID_U16)));
+
+    Seraph_CapSpan sub = seraph_span_sub(rw, 60, 4);
+    ASSERT(seraph_span_read_u32(sub, 0) == 0xDEADBEEF);
+    ASSERT(seraph_span_is_void(seraph_span_sub(rw, 60, 5)));
+}
+
+TEST(capability_span_invalid) {
+    uint8_t buffer[32];
+    Seraph_Capability cap = seraph_cap_create(buffer, 32, 1,
+                                               SERAPH_CAP_READ | SERAPH_CAP_SEAL);
+
+    ASSERT(seraph_span_is_void(seraph_cap_span(SERAPH_CAP_NULL, 0, 1, SERAPH_CAP_READ)));
+    ASSERT(seraph_span_is_void(seraph_cap_span(cap, 0, 32, SERAPH_CAP_RW)));
+    ASSERT(seraph_span_is_void(seraph_cap_span(cap, 1, 32, SERAPH_CAP_READ)));
+    ASSERT(seraph_span_is_void(seraph_cap_span(seraph_cap_seal(cap, 3), 0, 8,
+                                               SERAPH_CAP_READ)));
+
+    Seraph_CapSpan none = SERAPH_CAP_SPAN_VOID;
+    ASSERT(SERAPH_IS_VOID_U8(seraph_span_read_u8(none, 0)));
+    ASSERT(seraph_vbit_is_void(seraph_span_write_u8(none, 0, 1)));
+}
+
 /*============================================================================
  * Sealing Tests
  *============================================================================*/
@@ -453,6 +559,12 @@ void run_capability_tests(void) {
     RUN_TEST(capability_access_out_of_bounds);
     RUN_TEST(capability_copy);
 
+    /* Bulk and spans */
+    RUN_TEST(capability_read_write_array);
+    RUN_TEST(capability_fill_compare);
+    RUN_TEST(capability_span);
+    RUN_TEST(capability_span_invalid);
+
     /* Sealing */
     RUN_TEST(capability_seal_unseal);
     RUN_TEST(capability_unseal_wrong_type);
@@ -258,6 +258,102 @@ TEST(galactic_void_propagation) {
     ASSERT(seraph_galactic_is_void(div_result));
 }
 
+/*============================================================================
+ * Batch Tests
+ *============================================================================*/
+
+static bool galactic_same(Seraph_Galactic a, Seraph_Galactic b) {
+    return a.primal.hi == b.primal.hi && a.primal.lo == b.primal.lo &&
+           a.tangent.hi == b.tangent.hi && a.tangent.lo == b.tangent.lo;
+}
+
+TEST(galactic_batch) {
+    enum { N = 203 };
+    static Seraph_Galactic av[N], bv[N], out[N];
+    static int64_t h[6][N];
+    static uint64_t l[6][N];
+    Seraph_Galactic_Lanes a = { { h[0], l[0] }, { h[1], l[1] } };
+    Seraph_Galactic_Lanes b = { { h[2], l[2] }, { h[3], l[3] } };
+    Seraph_Galactic_Lanes dst = { { h[4], l[4] }, { h[5], l[5] } };
+
+    for (int i = 0; i < N; i++) {
+        av[i] = seraph_galactic_create(seraph_q128_from_double((i % 37) * 0.75 - 9.0),
+                                       seraph_q128_from_double((i % 11) * 0.5 - 2.0));
+        bv[i] = seraph_galactic_create(seraph_q128_from_double((i % 13) * 1.25 - 3.0),
+                                       seraph_q128_from_double((i % 7) * 0.25));
+    }
+    av[5].tangent = SERAPH_Q128_VOID;
+    bv[17].primal = SERAPH_Q128_VOID;
+    av[100] = seraph_galactic_create(seraph_q128_from_i64(INT64_MAX / 2 + 1),
+                                     seraph_q128_from_i64(3));
+    bv[100] = av[100];  /* primal sum overflows, tangent does not */
+    seraph_galactic_lanes_scatter(a, av, N);
+    seraph_galactic_lanes_scatter(b, bv, N);
+
+    seraph_galactic_add_n(dst, a, b, N);
+    seraph_galactic_lanes_gather(out, dst, N);
+    for (int i = 0; i < N; i++) ASSERT(galactic_same(out[i], seraph_galactic_add(av[i], bv[i])));
+    ASSERT(seraph_q128_is_void(out[100].primal) && !seraph_q128_is_void(out[100].tangent));
+
+    seraph_galactic_sub_n(dst, a, b, N);
+    seraph_galactic_lanes_gather(out, dst, N);
+    for (int i = 0; i < N; i++) ASSERT(galactic_same(out[i], seraph_galactic_sub(av[i], bv[i])));
+
+    seraph_galactic_mul_n(dst, a, b, N);
+    seraph_galactic_lanes_gather(out, dst, N);
+    for (int i = 0; i < N; i++) ASSERT(galactic_same(out[i], seraph_galactic_mul(av[i], bv[i])));
+
+    Seraph_Q128 c = seraph_q128_from_frac(3, 8);
+    seraph_galactic_scale_n(dst, a, c, N);
+    seraph_galactic_lanes_gather(out, dst, N);
+    for (int i = 0; i < N; i++) ASSERT(galactic_same(out[i], seraph_galactic_scale(av[i], c)));
+
+    seraph_galactic_sqrt_n(dst, a, N);
+    seraph_galactic_lanes_gather(out, dst, N);
+    for (int i = 0; i < N; i++) ASSERT(galactic_same(out[i], seraph_galactic_sqrt(av[i])));
+
+    /* In place: a = a * b */
+    seraph_galactic_mul_n(a, a, b, N);
+    seraph_galactic_lanes_gather(out, a, N);
+    for (int i = 0; i < N; i++) ASSERT(galactic_same(out[i], seraph_galactic_mul(av[i], bv[i])));
+}
+
+TEST(galactic_lanes_from_soa) {
+    Seraph_Arena arena;
+    ASSERT(seraph_arena_create(&arena, 65536, 0, 0) == SERAPH_VBIT_TRUE);
+
+    Seraph_FieldDesc fields[] = {
+        SERAPH_FIELD(Seraph_Galactic, primal.hi),
+        SERAPH_FIELD(Seraph_Galactic, primal.lo),
+        SERAPH_FIELD(Seraph_Galactic, tangent.hi),
+        SERAPH_FIELD(Seraph_Galactic, tangent.lo)
+    };
+    Seraph_SoA_Schema schema;
+    seraph_soa_schema_create(&schema, sizeof(Seraph_Galactic), _Alignof(Seraph_Galactic),
+                             fields, 4);
+    Seraph_SoA_Array array;
+    seraph_soa_array_create(&array, &arena, &schema, 32);
+    for (int i = 0; i < 20; i++) {
+        Seraph_Galactic x = seraph_galactic_variable(seraph_q128_from_i64(i));
+        seraph_soa_array_push(&array, &x);
+    }
+
+    /* d/dx x*x = 2x */
+    Seraph_Galactic_Lanes x;
+    ASSERT(seraph_galactic_lanes_from_soa(&array, 0, &x) == SERAPH_VBIT_TRUE);
+    seraph_galactic_mul_n(x, x, x, seraph_soa_array_count(&array));
+
+    Seraph_Galactic got;
+    seraph_soa_array_get(&array, 9, &got);
+    ASSERT(seraph_q128_to_i64(got.primal) == 81);
+    ASSERT(seraph_q128_to_i64(got.tangent) == 18);
+
+    ASSERT(seraph_galactic_lanes_from_soa(&array, 1, &x) == SERAPH_VBIT_VOID);
+
+    seraph_soa_schema_destroy(&schema);
+    seraph_arena_destroy(&arena);
+}
+
 /*============================================================================
  * Utility Tests
  *============================================================================*/
@@ -310,6 +406,10 @@ void run_galactic_tests(void) {
     /* VOID */
     RUN_TEST(galactic_void_propagation);
 
+    /* Batch */
+    RUN_TEST(galactic_batch);
+    RUN_TEST(galactic_lanes_from_soa);
+
     /* Utility */
     RUN_TEST(galactic_lerp);
 
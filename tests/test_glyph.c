@@ -614,6 +614,137 @@ TEST(sdf_offset) {
     ASSERT_NEAR(exp_dist, orig_dist - 0.5, 1e-6);
 }
 
+/*============================================================================
+ * Shape Program and Distance Cache Tests
+ *============================================================================*/
+
+/* A rounded button with a ring carved out of it, plus a detached dot */
+static const Seraph_SDF_Node* test_shape(uint32_t* count) {
+    static Seraph_SDF_Node nodes[5];
+    nodes[0] = (Seraph_SDF_Node){ SERAPH_SDF_OP_ROUNDED_BOX, {
+        seraph_q128_from_i64(6), seraph_q128_from_i64(4), seraph_q128_from_i64(1) } };
+    nodes[1] = (Seraph_SDF_Node){ SERAPH_SDF_OP_RING, {
+        seraph_q128_from_i64(2), SERAPH_Q128_ZERO, seraph_q128_from_i64(2), SERAPH_Q128_ONE } };
+    nodes[2] = (Seraph_SDF_Node){ SERAPH_SDF_OP_SUBTRACT, { SERAPH_Q128_ZERO } };
+    nodes[3] = (Seraph_SDF_Node){ SERAPH_SDF_OP_CIRCLE, {
+        seraph_q128_from_i64(-6), seraph_q128_from_i64(6), SERAPH_Q128_ONE } };
+    nodes[4] = (Seraph_SDF_Node){ SERAPH_SDF_OP_UNION, { SERAPH_Q128_ZERO } };
+    *count = 5;
+    return nodes;
+}
+
+TEST(shape_eval_matches_calls) {
+    uint32_t count;
+    const Seraph_SDF_Node* nodes = test_shape(&count);
+    double pts[][2] = { { 0, 0 }, { 2, 2 }, { -6, 6 }, { 5.5, -3.5 }, { 9, 9 } };
+
+    for (int i = 0; i < 5; i++) {
+        Seraph_Glyph_Point p = make_point(pts[i][0], pts[i][1]);
+        Seraph_SDF_Result expected = seraph_sdf_union(
+            seraph_sdf_subtract(
+                seraph_sdf_rounded_box(p, nodes[0].p[0], nodes[0].p[1], nodes[0].p[2]),
+                seraph_sdf_ring(p, nodes[1].p[0], nodes[1].p[1], nodes[1].p[2], nodes[1].p[3])),
+            seraph_sdf_circle(p, nodes[3].p[0], nodes[3].p[1], nodes[3].p[2]));
+        Seraph_SDF_Result r = seraph_sdf_shape_eval(nodes, count, p);
+        ASSERT(r.distance.hi == expected.distance.hi && r.distance.lo == expected.distance.lo);
+    }
+
+    /* Malformed programs are VOID */
+    ASSERT(seraph_sdf_is_void(seraph_sdf_shape_eval(nodes, 2, make_point(0, 0))));
+    ASSERT(seraph_sdf_is_void(seraph_sdf_shape_eval(nodes + 2, 1, make_point(0, 0))));
+    ASSERT(seraph_sdf_is_void(seraph_sdf_shape_eval(NULL, 0, make_point(0, 0))));
+    ASSERT(seraph_sdf_shape_hash(nodes, count) != seraph_sdf_shape_hash(nodes, count - 2));
+}
+
+TEST(glyph_cache_bake_and_sample) {
+    static Seraph_Glyph_Cache cache;
+    seraph_glyph_cache_init(&cache);
+    uint32_t count;
+    const Seraph_SDF_Node* nodes = test_shape(&count);
+
+    /* Frame [-8, 8)^2 over 32 texels: half a unit per texel */
+    Seraph_Q128 lo = seraph_q128_from_i64(-8), size = seraph_q128_from_i64(16);
+    const Seraph_Glyph_Cache_Entry* e = seraph_glyph_cache_lookup(&cache, nodes, count, lo, lo, size);
+    ASSERT(e != NULL);
+    ASSERT(cache.misses == 1 && cache.hits == 0);
+    ASSERT(seraph_glyph_cache_lookup(&cache, nodes, count, lo, lo, size) == e);
+    ASSERT(cache.hits == 1);
+
+    /* Sampled distances track the analytic ones away from sharp features */
+    double texel = 16.0 / SERAPH_GLYPH_CACHE_RES;
+    double pts[][2] = { { -3, 0 }, { -5.2, 6.7 }, { 4.5, 4.5 }, { 0, -5 }, { -7.3, 2.2 } };
+    for (int i = 0; i < 5; i++) {
+        double u = (pts[i][0] + 8.0) / texel - 0.5, v = (pts[i][1] + 8.0) / texel - 0.5;
+        double cached = seraph_glyph_cache_sample(e, (int32_t)(u * 65536), (int32_t)(v * 65536)) /
+                        65536.0 * texel;
+        double exact = sdf_dist(seraph_sdf_shape_eval(nodes, count, make_point(pts[i][0], pts[i][1])));
+        ASSERT_NEAR(cached, exact, 0.15);
+    }
+
+    /* Outside the texture, distance keeps growing */
+    int32_t edge = seraph_glyph_cache_sample(e, 31 << 16, 16 << 16);
+    ASSERT(seraph_glyph_cache_sample(e, 40 << 16, 16 << 16) > edge);
+
+    ASSERT(seraph_glyph_cache_lookup(&cache, nodes, count - 2, lo, lo, SERAPH_Q128_ZERO) == NULL);
+    ASSERT(seraph_glyph_cache_lookup(&cache, nodes, 2, lo, lo, size) == NULL);
+}
+
+TEST(glyph_cache_rasterize) {
+    static Seraph_Glyph_Cache cache;
+    seraph_glyph_cache_init(&cache);
+    uint32_t count;
+    const Seraph_SDF_Node* nodes = test_shape(&count);
+    Seraph_Q128 lo = seraph_q128_from_i64(-8), size = seraph_q128_from_i64(16);
+    const Seraph_Glyph_Cache_Entry* e = seraph_glyph_cache_lookup(&cache, nodes, count, lo, lo, size);
+    ASSERT(e != NULL);
+
+    /* 64 px over 16 units: compare with analytic coverage at each pixel center */
+    enum { N = 64 };
+    static uint8_t coverage[N * N];
+    seraph_glyph_cache_rasterize(e, coverage, N, N);
+    int mismatched = 0;
+    for (int y = 0; y < N; y++) {
+        for (int x = 0; x < N; x++) {
+            double px = -8.0 + (x + 0.5) * 16.0 / N, py = -8.0 + (y + 0.5) * 16.0 / N;
+            double exact = seraph_glyph_alpha(
+                seraph_sdf_shape_eval(nodes, count, make_point(px, py)), 16.0 / N) * 255.0;
+            if (fabs(coverage[y * N + x] - exact) > 64.0) mismatched++;
+        }
+    }
+    ASSERT(coverage[32 * N + 8] == 255);        /* Inside the box, left of the ring */
+    ASSERT(coverage[2 * N + 62] == 0);          /* Empty corner */
+    ASSERT(mismatched < N * N / 100);
+}
+
+TEST(glyph_cache_eviction) {
+    static Seraph_Glyph_Cache cache;
+    seraph_glyph_cache_init(&cache);
+    Seraph_SDF_Node circle = { SERAPH_SDF_OP_CIRCLE, {
+        SERAPH_Q128_ZERO, SERAPH_Q128_ZERO, SERAPH_Q128_ONE } };
+    Seraph_Q128 lo = seraph_q128_from_i64(-2), size = seraph_q128_from_i64(4);
+
+    /* Fill every slot, touch the first again, then add one more */
+    for (int i = 0; i < SERAPH_GLYPH_CACHE_SLOTS; i++) {
+        circle.p[2] = seraph_q128_from_i64(1 + i);
+        ASSERT(seraph_glyph_cache_lookup(&cache, &circle, 1, lo, lo, size) != NULL);
+    }
+    ASSERT(cache.evictions == 0);
+    circle.p[2] = SERAPH_Q128_ONE;
+    seraph_glyph_cache_lookup(&cache, &circle, 1, lo, lo, size);
+    ASSERT(cache.hits == 1);
+    circle.p[2] = seraph_q128_from_i64(SERAPH_GLYPH_CACHE_SLOTS + 1);
+    seraph_glyph_cache_lookup(&cache, &circle, 1, lo, lo, size);
+    ASSERT(cache.evictions == 1);
+
+    /* The least recently used (radius 2) went; radius 1 survived */
+    circle.p[2] = SERAPH_Q128_ONE;
+    seraph_glyph_cache_lookup(&cache, &circle, 1, lo, lo, size);
+    ASSERT(cache.hits == 2);
+    circle.p[2] = seraph_q128_from_i64(2);
+    seraph_glyph_cache_lookup(&cache, &circle, 1, lo, lo, size);
+    ASSERT(cache.misses == SERAPH_GLYPH_CACHE_SLOTS + 2);
+}
+
 /*============================================================================
  * Main Test Runner
  *============================================================================*/
@@ -684,5 +815,11 @@ void run_glyph_tests(void) {
     RUN_TEST(sdf_negate);
     RUN_TEST(sdf_offset);
 
+    printf("\nShape Program/Cache Tests:\n");
+    RUN_TEST(shape_eval_matches_calls);
+    RUN_TEST(glyph_cache_bake_and_sample);
+    RUN_TEST(glyph_cache_rasterize);
+    RUN_TEST(glyph_cache_eviction);
+
     printf("\nGlyph Tests: %d/%d passed\n", tests_passed, tests_run);
 }
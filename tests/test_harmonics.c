@@ -0,0 +1,347 @@
+/**
+ * @file test_harmonics.c
+ * @brief Test suite for MC26 Pillar 4: Harmonic Synthesis and the fixed-point FFT
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "seraph/harmonics.h"
+
+static int tests_run = 0;
+static int tests_passed = 0;
+static int current_test_failed = 0;
+
+#define TEST(name) __attribute__((unused)) static void test_##name(void)
+#define RUN_TEST(name) do { \
+    printf("  Running %s... ", #name); fflush(stdout); \
+    tests_run++; \
+    current_test_failed = 0; \
+    test_##name(); \
+    if (!current_test_failed) { \
+        tests_passed++; \
+        printf("PASSED\n"); \
+    } \
+    fflush(stdout); \
+} while(0)
+
+#define ASSERT(cond) do { \
+    if (!(cond)) { \
+        printf("FAILED at line %d: %s\n", __LINE__, #cond); \
+        current_test_failed = 1; \
+        return; \
+    } \
+} while(0)
+
+#define ASSERT_EQ(a, b) ASSERT((a) == (b))
+#define ASSERT_TRUE(x) ASSERT((x) == true)
+#define ASSERT_FALSE(x) ASSERT((x) == false)
+#define ASSERT_NEAR(a, b, tol) ASSERT(fabs((a) - (b)) < (tol))
+
+/*============================================================================
+ * Helper Functions
+ *============================================================================*/
+
+#define FFT_TEST_N 256
+
+static Q16 tw_cos[FFT_TEST_N / 2], tw_sin[FFT_TEST_N / 2];
+
+static uint32_t rng_state = 0x12345678u;
+
+static Q16 random_q16(Q16 amplitude) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return (Q16)((int64_t)(rng_state % 0x20001u) * amplitude / 0x10000) - amplitude;
+}
+
+/* Reference DFT in double, from Q16 input */
+static void reference_dft(const Q16* re, const Q16* im, int n, double* out_re, double* out_im) {
+    for (int k = 0; k < n; k++) {
+        double sr = 0.0, si = 0.0;
+        for (int j = 0; j < n; j++) {
+            double t = -2.0 * M_PI * (double)((j * k) % n) / n;
+            double xr = re[j] / 65536.0, xi = im ? im[j] / 65536.0 : 0.0;
+            sr += xr * cos(t) - xi * sin(t);
+            si += xr * sin(t) + xi * cos(t);
+        }
+        out_re[k] = sr;
+        out_im[k] = si;
+    }
+}
+
+static double q16_scaled(Q16 v, int exponent) {
+    return ldexp((double)v, exponent) / 65536.0;
+}
+
+/* Largest component error of a Q16 spectrum against the reference */
+static double spectrum_error(const Q16* re, const Q16* im, int exponent,
+                             const double* ref_re, const double* ref_im, int bins) {
+    double err = 0.0;
+    for (int k = 0; k < bins; k++) {
+        err = fmax(err, fabs(q16_scaled(re[k], exponent) - ref_re[k]));
+        err = fmax(err, fabs(q16_scaled(im[k], exponent) - ref_im[k]));
+    }
+    return err;
+}
+
+/*============================================================================
+ * Twiddle Tests
+ *============================================================================*/
+
+TEST(fft_twiddles_accurate) {
+    static Q16 c[512], s[512];
+    seraph_harmonic16_fft_twiddles(1024, c, s);
+    for (int k = 0; k < 512; k++) {
+        double t = 2.0 * M_PI * k / 1024.0;
+        ASSERT_NEAR(c[k] / 65536.0, cos(t), 1.0 / 65536.0);
+        ASSERT_NEAR(s[k] / 65536.0, -sin(t), 1.0 / 65536.0);
+    }
+    /* Quadrant points are exact */
+    ASSERT_EQ(c[0], Q16_ONE);
+    ASSERT_EQ(s[0], 0);
+    ASSERT_EQ(c[256], 0);
+    ASSERT_EQ(s[256], -Q16_ONE);
+}
+
+TEST(fft32_twiddles_accurate) {
+    static int64_t c[96], s[96];
+    seraph_harmonic32_fft_twiddles(192, c, s);   /* Not a power of two */
+    for (int k = 0; k < 96; k++) {
+        double t = 2.0 * M_PI * k / 192.0;
+        ASSERT_NEAR((double)c[k] / 4294967296.0, cos(t), 1e-9);
+        ASSERT_NEAR((double)s[k] / 4294967296.0, -sin(t), 1e-9);
+    }
+}
+
+/*============================================================================
+ * FFT Tests
+ *============================================================================*/
+
+TEST(fft_init_rejects_bad_sizes) {
+    Seraph_FFT16 fft;
+    ASSERT_FALSE(seraph_fft16_init(&fft, 0, tw_cos, tw_sin));
+    ASSERT_FALSE(seraph_fft16_init(&fft, 1, tw_cos, tw_sin));
+    ASSERT_FALSE(seraph_fft16_init(&fft, 96, tw_cos, tw_sin));
+    ASSERT_FALSE(seraph_fft16_init(&fft, 1 << (SERAPH_FFT_MAX_LOG2 + 1), tw_cos, tw_sin));
+    ASSERT_FALSE(seraph_fft16_init(&fft, 64, NULL, tw_sin));
+    ASSERT_TRUE(seraph_fft16_init(&fft, 64, tw_cos, tw_sin));
+    ASSERT_EQ(fft.log2n, 6);
+
+    Q16 re[64] = {0}, im[64] = {0};
+    int e;
+    ASSERT_FALSE(seraph_fft16_forward(NULL, re, im, &e));
+    ASSERT_FALSE(seraph_fft16_forward(&fft, re, NULL, &e));
+    ASSERT_TRUE(seraph_fft16_forward(&fft, re, im, &e));
+    ASSERT_EQ(e, 0);
+    ASSERT_EQ(re[5], 0);
+}
+
+TEST(fft_matches_dft) {
+    /* 256 points (radix-4 only) and 128 points (one radix-2 pass) */
+    static const int sizes[2] = { 256, 128 };
+    static Q16 re[FFT_TEST_N], im[FFT_TEST_N], x_re[FFT_TEST_N], x_im[FFT_TEST_N];
+    static double ref_re[FFT_TEST_N], ref_im[FFT_TEST_N];
+
+    for (int t = 0; t < 2; t++) {
+        int n = sizes[t];
+        Seraph_FFT16 fft;
+        ASSERT_TRUE(seraph_fft16_init(&fft, n, tw_cos, tw_sin));
+        for (int i = 0; i < n; i++) {
+            x_re[i] = re[i] = random_q16(Q16_ONE);
+            x_im[i] = im[i] = random_q16(Q16_ONE);
+        }
+        reference_dft(x_re, x_im, n, ref_re, ref_im);
+
+        int e;
+        ASSERT_TRUE(seraph_fft16_forward(&fft, re, im, &e));
+        /* ~16 significant bits relative to a spectrum of magnitude ~n/2 */
+        ASSERT(spectrum_error(re, im, e, ref_re, ref_im, n) < n * 2e-5);
+    }
+}
+
+TEST(fft_single_tone) {
+    static Q16 re[FFT_TEST_N], im[FFT_TEST_N];
+    Seraph_FFT16 fft;
+    ASSERT_TRUE(seraph_fft16_init(&fft, FFT_TEST_N, tw_cos, tw_sin));
+
+    /* cos(2π·10j/N): all energy in bins 10 and N - 10, N/2 each */
+    for (int j = 0; j < FFT_TEST_N; j++) {
+        int k = (10 * j) % FFT_TEST_N;
+        re[j] = k < FFT_TEST_N / 2 ? tw_cos[k] : -tw_cos[k - FFT_TEST_N / 2];
+        im[j] = 0;
+    }
+
+    int e;
+    ASSERT_TRUE(seraph_fft16_forward(&fft, re, im, &e));
+    for (int k = 0; k < FFT_TEST_N; k++) {
+        double expect = (k == 10 || k == FFT_TEST_N - 10) ? FFT_TEST_N / 2.0 : 0.0;
+        ASSERT_NEAR(q16_scaled(re[k], e), expect, 0.01);
+        ASSERT_NEAR(q16_scaled(im[k], e), 0.0, 0.01);
+    }
+}
+
+TEST(fft_inverse_round_trip) {
+    static Q16 re[FFT_TEST_N], im[FFT_TEST_N], x_re[FFT_TEST_N], x_im[FFT_TEST_N];
+    Seraph_FFT16 fft;
+    ASSERT_TRUE(seraph_fft16_init(&fft, FFT_TEST_N, tw_cos, tw_sin));
+    for (int i = 0; i < FFT_TEST_N; i++) {
+        x_re[i] = re[i] = random_q16(Q16_ONE / 2);
+        x_im[i] = im[i] = random_q16(Q16_ONE / 2);
+    }
+
+    int e_fwd, e_inv;
+    ASSERT_TRUE(seraph_fft16_forward(&fft, re, im, &e_fwd));
+    ASSERT_TRUE(seraph_fft16_inverse(&fft, re, im, &e_inv));
+    for (int i = 0; i < FFT_TEST_N; i++) {
+        ASSERT_NEAR(q16_scaled(re[i], e_fwd + e_inv), x_re[i] / 65536.0, 1e-4);
+        ASSERT_NEAR(q16_scaled(im[i], e_fwd + e_inv), x_im[i] / 65536.0, 1e-4);
+    }
+}
+
+TEST(fft_full_scale_no_overflow) {
+    /* A full-scale DC block grows by N: the block exponent must absorb it */
+    static Q16 re[FFT_TEST_N], im[FFT_TEST_N];
+    Seraph_FFT16 fft;
+    ASSERT_TRUE(seraph_fft16_init(&fft, FFT_TEST_N, tw_cos, tw_sin));
+    for (int i = 0; i < FFT_TEST_N; i++) {
+        re[i] = 0x7FFFFFFF;
+        im[i] = (Q16)0x80000000;
+    }
+
+    int e;
+    ASSERT_TRUE(seraph_fft16_forward(&fft, re, im, &e));
+    ASSERT_NEAR(q16_scaled(re[0], e) / (FFT_TEST_N * 32768.0), 1.0, 1e-6);
+    ASSERT_NEAR(q16_scaled(im[0], e) / (FFT_TEST_N * 32768.0), -1.0, 1e-6);
+    for (int k = 1; k < FFT_TEST_N; k++) {
+        ASSERT_NEAR(q16_scaled(re[k], e), 0.0, 1.0);
+        ASSERT_NEAR(q16_scaled(im[k], e), 0.0, 1.0);
+    }
+}
+
+TEST(fft_real_matches_complex) {
+    static const int sizes[2] = { 256, 32 };
+    static Q16 x[FFT_TEST_N], re[FFT_TEST_N], im[FFT_TEST_N];
+    static Q16 bins_re[FFT_TEST_N / 2 + 1], bins_im[FFT_TEST_N / 2 + 1];
+    static double ref_re[FFT_TEST_N], ref_im[FFT_TEST_N];
+
+    for (int t = 0; t < 2; t++) {
+        int n = sizes[t];
+        Seraph_FFT16 fft;
+        ASSERT_TRUE(seraph_fft16_init(&fft, n, tw_cos, tw_sin));
+        for (int i = 0; i < n; i++) {
+            x[i] = re[i] = random_q16(Q16_ONE);
+            im[i] = 0;
+        }
+        reference_dft(x, NULL, n, ref_re, ref_im);
+
+        int e_real, e_cplx;
+        ASSERT_TRUE(seraph_fft16_real(&fft, x, bins_re, bins_im, &e_real));
+        ASSERT_TRUE(seraph_fft16_forward(&fft, re, im, &e_cplx));
+        ASSERT(spectrum_error(bins_re, bins_im, e_real, ref_re, ref_im, n / 2 + 1) < n * 2e-5);
+        ASSERT(spectrum_error(re, im, e_cplx, ref_re, ref_im, n / 2 + 1) < n * 2e-5);
+        ASSERT_EQ(bins_im[0], 0);
+        ASSERT_EQ(bins_im[n / 2], 0);
+    }
+
+    Seraph_FFT16 tiny;
+    int e;
+    ASSERT_TRUE(seraph_fft16_init(&tiny, 2, tw_cos, tw_sin));
+    ASSERT_FALSE(seraph_fft16_real(&tiny, x, bins_re, bins_im, &e));
+}
+
+TEST(fft_batch_channels) {
+    enum { N = 64, CH = 3 };
+    static Q16 re[N * CH], im[N * CH], one_re[N], one_im[N];
+    static Q16 x[N * CH], bins_re[(N / 2 + 1) * CH], bins_im[(N / 2 + 1) * CH];
+    static Q16 one_bins_re[N / 2 + 1], one_bins_im[N / 2 + 1];
+    static const Q16 amplitude[CH] = { Q16_ONE, Q16_ONE / 1000, 0 };
+    Seraph_FFT16 fft;
+    ASSERT_TRUE(seraph_fft16_init(&fft, N, tw_cos, tw_sin));
+
+    for (int c = 0; c < CH; c++) {
+        for (int i = 0; i < N; i++) {
+            x[c * N + i] = re[c * N + i] = random_q16(amplitude[c]);
+            im[c * N + i] = random_q16(amplitude[c]);
+        }
+    }
+
+    int exps[CH], real_exps[CH];
+    ASSERT_TRUE(seraph_fft16_real_batch(&fft, x, bins_re, bins_im, CH, real_exps));
+    for (int c = 0; c < CH; c++) {
+        for (int i = 0; i < N; i++) {
+            one_re[i] = re[c * N + i];
+            one_im[i] = im[c * N + i];
+        }
+        int e;
+        ASSERT_TRUE(seraph_fft16_forward(&fft, one_re, one_im, &e));
+        ASSERT_TRUE(seraph_fft16_real(&fft, x + c * N, one_bins_re, one_bins_im, &e));
+        ASSERT_EQ(e, real_exps[c]);
+        for (int k = 0; k <= N / 2; k++) {
+            ASSERT_EQ(bins_re[c * (N / 2 + 1) + k], one_bins_re[k]);
+            ASSERT_EQ(bins_im[c * (N / 2 + 1) + k], one_bins_im[k]);
+        }
+    }
+
+    ASSERT_TRUE(seraph_fft16_forward_batch(&fft, re, im, CH, exps));
+    /* The quiet channel keeps its own, smaller exponent */
+    ASSERT(exps[1] < exps[0]);
+    ASSERT_EQ(exps[2], 0);
+    for (int k = 0; k < N; k++) {
+        ASSERT_EQ(re[2 * N + k], 0);
+    }
+}
+
+TEST(fft32_round_trip) {
+    enum { N = 512 };
+    static int64_t cos32[N / 2], sin32[N / 2], re[N], im[N], x_re[N];
+    static Q16 q_re[N];
+    static double ref_re[N], ref_im[N];
+    Seraph_FFT32 fft;
+    ASSERT_TRUE(seraph_fft32_init(&fft, N, cos32, sin32));
+    ASSERT_FALSE(seraph_fft32_init(&fft, 48, cos32, sin32));
+
+    for (int i = 0; i < N; i++) {
+        q_re[i] = random_q16(Q16_ONE);
+        x_re[i] = re[i] = (int64_t)q_re[i] << 16;
+        im[i] = 0;
+    }
+    reference_dft(q_re, NULL, N, ref_re, ref_im);
+
+    int e_fwd, e_inv;
+    ASSERT_TRUE(seraph_fft32_forward(&fft, re, im, &e_fwd));
+    for (int k = 0; k < N; k++) {
+        ASSERT_NEAR(ldexp((double)re[k], e_fwd) / 4294967296.0, ref_re[k], 1e-6);
+        ASSERT_NEAR(ldexp((double)im[k], e_fwd) / 4294967296.0, ref_im[k], 1e-6);
+    }
+
+    ASSERT_TRUE(seraph_fft32_inverse(&fft, re, im, &e_inv));
+    for (int i = 0; i < N; i++) {
+        ASSERT_NEAR(ldexp((double)re[i], e_fwd + e_inv) / 4294967296.0,
+                    (double)x_re[i] / 4294967296.0, 1e-8);
+    }
+}
+
+/*============================================================================
+ * Main Test Runner
+ *============================================================================*/
+
+void run_harmonics_tests(void) {
+    printf("\n=== MC26: Harmonic Synthesis Tests ===\n\n");
+
+    printf("Twiddle Tests:\n");
+    RUN_TEST(fft_twiddles_accurate);
+    RUN_TEST(fft32_twiddles_accurate);
+
+    printf("\nFFT Tests:\n");
+    RUN_TEST(fft_init_rejects_bad_sizes);
+    RUN_TEST(fft_matches_dft);
+    RUN_TEST(fft_single_tone);
+    RUN_TEST(fft_inverse_round_trip);
+    RUN_TEST(fft_full_scale_no_overflow);
+    RUN_TEST(fft_real_matches_complex);
+    RUN_TEST(fft_batch_channels);
+    RUN_TEST(fft32_round_trip);
+
+    printf("\nHarmonics Tests: %d/%d passed\n", tests_passed, tests_run);
+}
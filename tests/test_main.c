@@ -17,6 +17,10 @@ extern void run_semantic_byte_tests(void);
 extern void run_integer_tests(void);
 extern void run_q128_tests(void);
 extern void run_galactic_tests(void);
+extern void run_harmonics_tests(void);
+extern void run_rotation_tests(void);
+extern void run_math_cache_tests(void);
+extern void run_q64_trig_tests(void);
 /* Note: Galactic scheduler tests run as separate executable */
 
 /* Test suite declarations - Phase 2: Memory Safety */
@@ -50,6 +54,8 @@ extern void run_seraphim_lexer_tests(void);
 extern void run_seraphim_parser_tests(void);
 extern void run_seraphim_types_tests(void);
 extern void run_seraphim_effects_tests(void);
+extern void run_seraphim_inline_tests(void);
+extern void run_seraphim_x64_tests(void);
 /* Note: proofs and codegen tests run as separate executables */
 #ifdef SERAPH_INCLUDE_COMPILER_FULL_TESTS
 extern void run_seraphim_proofs_tests(void);
@@ -140,6 +146,30 @@ int main(int argc, char* argv[]) {
         suites_passed++;
     }
 
+    if (!suite || strcmp(suite, "harmonics") == 0) {
+        run_harmonics_tests();
+        suites_run++;
+        suites_passed++;
+    }
+
+    if (!suite || strcmp(suite, "rotation") == 0) {
+        run_rotation_tests();
+        suites_run++;
+        suites_passed++;
+    }
+
+    if (!suite || strcmp(suite, "math_cache") == 0) {
+        run_math_cache_tests();
+        suites_run++;
+        suites_passed++;
+    }
+
+    if (!suite || strcmp(suite, "q64_trig") == 0) {
+        run_q64_trig_tests();
+        suites_run++;
+        suites_passed++;
+    }
+
     /* Note: galactic_sched tests run as separate executable */
 
     /* Phase 2: Memory Safety */
@@ -235,6 +265,18 @@ int main(int argc, char* argv[]) {
         suites_passed++;
     }
 
+    if (!suite || strcmp(suite, "seraphim") == 0 || strcmp(suite, "inline") == 0) {
+        run_seraphim_inline_tests();
+        suites_run++;
+        suites_passed++;
+    }
+
+    if (!suite || strcmp(suite, "seraphim") == 0 || strcmp(suite, "x64") == 0) {
+        run_seraphim_x64_tests();
+        suites_run++;
+        suites_passed++;
+    }
+
 #ifdef SERAPH_INCLUDE_COMPILER_FULL_TESTS
     if (!suite || strcmp(suite, "seraphim") == 0 || strcmp(suite, "proofs") == 0) {
         run_seraphim_proofs_tests();
@@ -0,0 +1,285 @@
+/**
+ * @file test_math_cache.c
+ * @brief Test suite for the math memoization caches
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "seraph/math_cache.h"
+#include "seraph/q16_trig.h"
+
+static int tests_run = 0;
+static int tests_passed = 0;
+static int current_test_failed = 0;
+
+#define TEST(name) __attribute__((unused)) static void test_##name(void)
+#define RUN_TEST(name) do { \
+    printf("  Running %s... ", #name); fflush(stdout); \
+    tests_run++; \
+    current_test_failed = 0; \
+    test_##name(); \
+    if (!current_test_failed) { \
+        tests_passed++; \
+        printf("PASSED\n"); \
+    } \
+    fflush(stdout); \
+} while(0)
+
+#define ASSERT(cond) do { \
+    if (!(cond)) { \
+        printf("FAILED at line %d: %s\n", __LINE__, #cond); \
+        current_test_failed = 1; \
+        return; \
+    } \
+} while(0)
+
+#define ASSERT_EQ(a, b) ASSERT((a) == (b))
+#define ASSERT_NULL(p) ASSERT((p) == NULL)
+#define ASSERT_NOT_NULL(p) ASSERT((p) != NULL)
+#define ASSERT_TRUE(x) ASSERT((x) == true)
+#define ASSERT_FALSE(x) ASSERT((x) == false)
+
+static int compute_calls = 0;
+
+static uint64_t square_plus_one(uint64_t key) {
+    compute_calls++;
+    return key * key + 1;
+}
+
+static uint64_t negate(uint64_t key) {
+    compute_calls++;
+    return ~key;
+}
+
+/* Keys that land in set 0 under tag */
+static size_t keys_in_set_zero(const Seraph_Memo_Cache* cache, uint32_t tag,
+                               uint64_t* keys, size_t want) {
+    size_t found = 0;
+    for (uint64_t k = 1; found < want && k < 1000000; k++) {
+        if (seraph_memo_cache_set(cache, tag, k) == 0) keys[found++] = k;
+    }
+    return found;
+}
+
+/*============================================================================
+ * Memo Cache Tests
+ *============================================================================*/
+
+TEST(memo_create_validates) {
+    Seraph_Arena arena;
+    ASSERT_EQ(seraph_arena_create(&arena, 1 << 18, 0, SERAPH_ARENA_FLAG_NONE), SERAPH_VBIT_TRUE);
+
+    ASSERT_NULL(seraph_memo_cache_create(NULL, 64, 4, SERAPH_MEMO_TAG_USER));
+    ASSERT_NULL(seraph_memo_cache_create(&arena, 0, 4, SERAPH_MEMO_TAG_USER));
+    ASSERT_NULL(seraph_memo_cache_create(&arena, 64, 0, SERAPH_MEMO_TAG_USER));
+    ASSERT_NULL(seraph_memo_cache_create(&arena, 64, 3, SERAPH_MEMO_TAG_USER));
+    ASSERT_NULL(seraph_memo_cache_create(&arena, 64, 8, SERAPH_MEMO_TAG_USER));
+    ASSERT_NULL(seraph_memo_cache_create(&arena, 64, 2, 0));
+    ASSERT_NULL(seraph_memo_cache_create(&arena, 1 << 20, 4, SERAPH_MEMO_TAG_USER));
+
+    Seraph_Memo_Cache* cache = seraph_memo_cache_create(&arena, 100, 2, SERAPH_MEMO_TAG_USER);
+    ASSERT_NOT_NULL(cache);
+    Seraph_Memo_Stats stats;
+    seraph_memo_cache_stats(cache, &stats);
+    ASSERT_EQ(stats.capacity, 128u);
+    ASSERT_EQ(stats.occupied, 0u);
+
+    seraph_arena_destroy(&arena);
+}
+
+TEST(memo_lookup_computes_once) {
+    Seraph_Arena arena;
+    seraph_arena_create(&arena, 1 << 18, 0, SERAPH_ARENA_FLAG_NONE);
+    Seraph_Memo_Cache* cache = seraph_memo_cache_create(&arena, 4096, 4, SERAPH_MEMO_TAG_USER);
+    ASSERT_NOT_NULL(cache);
+
+    compute_calls = 0;
+    for (int pass = 0; pass < 3; pass++) {
+        for (uint64_t k = 0; k < 100; k++) {
+            ASSERT_EQ(seraph_memo_cache_lookup(cache, k, square_plus_one), k * k + 1);
+        }
+    }
+    ASSERT_EQ(compute_calls, 100);
+
+    Seraph_Memo_Stats stats;
+    seraph_memo_cache_stats(cache, &stats);
+    ASSERT_EQ(stats.hits, 200u);
+    ASSERT_EQ(stats.misses, 100u);
+    ASSERT_EQ(stats.occupied, 100u);
+
+    seraph_memo_cache_reset_stats(cache);
+    seraph_memo_cache_clear(cache);
+    seraph_memo_cache_stats(cache, &stats);
+    ASSERT_EQ(stats.hits + stats.misses + stats.evictions, 0u);
+    ASSERT_EQ(stats.occupied, 0u);
+
+    seraph_arena_destroy(&arena);
+}
+
+TEST(memo_colliding_keys_coexist) {
+    Seraph_Arena arena;
+    seraph_arena_create(&arena, 1 << 18, 0, SERAPH_ARENA_FLAG_NONE);
+    Seraph_Memo_Cache* cache = seraph_memo_cache_create(&arena, 64, 4, SERAPH_MEMO_TAG_USER);
+    ASSERT_NOT_NULL(cache);
+
+    uint64_t keys[5];
+    ASSERT_EQ(keys_in_set_zero(cache, SERAPH_MEMO_TAG_USER, keys, 5), 5u);
+
+    /* Four colliding keys fit in one 4-way set */
+    compute_calls = 0;
+    for (int pass = 0; pass < 2; pass++) {
+        for (int i = 0; i < 4; i++) {
+            seraph_memo_cache_lookup(cache, keys[i], square_plus_one);
+        }
+    }
+    ASSERT_EQ(compute_calls, 4);
+
+    /* A fifth key displaces exactly one of them */
+    seraph_memo_cache_lookup(cache, keys[4], square_plus_one);
+    ASSERT_EQ(compute_calls, 5);
+    int present = 0;
+    for (int i = 0; i < 5; i++) {
+        uint64_t v;
+        if (seraph_memo_cache_find(cache, SERAPH_MEMO_TAG_USER, keys[i], &v)) {
+            ASSERT_EQ(v, keys[i] * keys[i] + 1);
+            present++;
+        }
+    }
+    ASSERT_EQ(present, 4);
+
+    Seraph_Memo_Stats stats;
+    seraph_memo_cache_stats(cache, &stats);
+    ASSERT_EQ(stats.evictions, 1u);
+    ASSERT_EQ(stats.hits, 4u);
+
+    seraph_arena_destroy(&arena);
+}
+
+TEST(memo_tags_separate_functions) {
+    Seraph_Arena arena;
+    seraph_arena_create(&arena, 1 << 18, 0, SERAPH_ARENA_FLAG_NONE);
+    Seraph_Memo_Cache* cache = seraph_memo_cache_create(&arena, 4096, 2, SERAPH_MEMO_TAG_USER);
+    ASSERT_NOT_NULL(cache);
+
+    const uint32_t other = SERAPH_MEMO_TAG_USER + 1;
+    compute_calls = 0;
+    for (uint64_t k = 0; k < 20; k++) {
+        ASSERT_EQ(seraph_memo_cache_lookup(cache, k, square_plus_one), k * k + 1);
+        ASSERT_EQ(seraph_memo_cache_lookup_tagged(cache, other, k, negate), ~k);
+    }
+    for (uint64_t k = 0; k < 20; k++) {
+        ASSERT_EQ(seraph_memo_cache_lookup_tagged(cache, other, k, negate), ~k);
+        ASSERT_EQ(seraph_memo_cache_lookup(cache, k, square_plus_one), k * k + 1);
+    }
+    ASSERT_EQ(compute_calls, 40);
+
+    seraph_arena_destroy(&arena);
+}
+
+TEST(memo_lookup_n_matches_scalar) {
+    Seraph_Arena arena;
+    seraph_arena_create(&arena, 1 << 18, 0, SERAPH_ARENA_FLAG_NONE);
+    Seraph_Memo_Cache* cache = seraph_memo_cache_create(&arena, 512, 4, SERAPH_MEMO_TAG_USER);
+    ASSERT_NOT_NULL(cache);
+
+    uint64_t keys[300], values[300];
+    for (int i = 0; i < 300; i++) keys[i] = (uint64_t)(i % 150) * 7919;
+
+    compute_calls = 0;
+    size_t hits = seraph_memo_cache_lookup_n(cache, keys, values, 300, square_plus_one);
+    ASSERT_EQ(hits, 150u);
+    ASSERT_EQ(compute_calls, 150);
+    for (int i = 0; i < 300; i++) ASSERT_EQ(values[i], keys[i] * keys[i] + 1);
+
+    ASSERT_EQ(seraph_memo_cache_lookup_n(cache, keys, values, 300, square_plus_one), 300u);
+    ASSERT_EQ(compute_calls, 150);
+
+    seraph_arena_destroy(&arena);
+}
+
+/*============================================================================
+ * Cached Q16 Function Tests
+ *============================================================================*/
+
+TEST(q16_sincos_cached_n_matches) {
+    Q16 angles[200], s[200], c[200];
+    for (int i = 0; i < 200; i++) {
+        angles[i] = (Q16)((i % 40) * 0x3C5A1) - 0x600000;
+    }
+    Seraph_Memo_Cache* memo = seraph_math_memo_get();
+    seraph_memo_cache_clear(memo);
+
+    size_t hits = seraph_q16_sincos_cached_n(angles, s, c, 200);
+    ASSERT_EQ(hits, 160u);
+    for (int i = 0; i < 200; i++) {
+        Q16 rs, rc;
+        q16_sincos(angles[i], &rs, &rc);
+        ASSERT_EQ(s[i], rs);
+        ASSERT_EQ(c[i], rc);
+    }
+    ASSERT_EQ(seraph_q16_sincos_cached_n(angles, s, c, 200), 200u);
+
+    Q16 one_s, one_c;
+    seraph_q16_sincos_cached(angles[7], &one_s, &one_c);
+    ASSERT_EQ(one_s, s[7]);
+    ASSERT_EQ(one_c, c[7]);
+}
+
+TEST(q16_cached_functions_share_memo) {
+    Seraph_Memo_Cache* memo = seraph_math_memo_get();
+    seraph_memo_cache_clear(memo);
+    seraph_memo_cache_reset_stats(memo);
+
+    /* Same key under three tags: three independent entries */
+    Q16 x = 0x28000;
+    int quad_ref, quad;
+    Q16 reduced_ref = q16_reduce_angle(x, &quad_ref);
+    for (int pass = 0; pass < 2; pass++) {
+        ASSERT_EQ(seraph_q16_sqrt_cached(x), q16_sqrt(x));
+        ASSERT_EQ(seraph_q16_reduce_cached(x, &quad), reduced_ref);
+        ASSERT_EQ(quad, quad_ref);
+        ASSERT_EQ(seraph_q16_sin_cached(x), q16_sin(x));
+    }
+
+    uint32_t hits, misses, occupied, capacity;
+    seraph_q16_cache_info(&hits, &misses, &occupied, &capacity);
+    ASSERT_EQ(hits, 3u);
+    ASSERT_EQ(misses, 3u);
+    ASSERT_EQ(occupied, 3u);
+    ASSERT_EQ(capacity, SERAPH_MATH_CACHE_SIZE * 4u);
+}
+
+TEST(branchless_trig_cache_counts) {
+    Seraph_Q16_Trig_Cache* cache = seraph_q16_trig_cache_get();
+    seraph_q16_cache_reset_stats(cache);
+    seraph_q16_trig_cache_init(cache);
+
+    int32_t s, c;
+    seraph_q16_trig_cache_lookup(cache, 0x1234, &s, &c, (Seraph_Sincos_Fn)q16_sincos);
+    seraph_q16_trig_cache_lookup(cache, 0x1234, &s, &c, (Seraph_Sincos_Fn)q16_sincos);
+    ASSERT_EQ(cache->hits, 1u);
+    ASSERT_EQ(cache->misses, 1u);
+    ASSERT(seraph_q16_cache_hit_rate(cache) > 0.49);
+}
+
+/*============================================================================
+ * Main Test Runner
+ *============================================================================*/
+
+void run_math_cache_tests(void) {
+    printf("\n=== MC26: Math Cache Tests ===\n\n");
+
+    printf("Memo Cache Tests:\n");
+    RUN_TEST(memo_create_validates);
+    RUN_TEST(memo_lookup_computes_once);
+    RUN_TEST(memo_colliding_keys_coexist);
+    RUN_TEST(memo_tags_separate_functions);
+    RUN_TEST(memo_lookup_n_matches_scalar);
+
+    printf("\nCached Q16 Function Tests:\n");
+    RUN_TEST(q16_sincos_cached_n_matches);
+    RUN_TEST(q16_cached_functions_share_memo);
+    RUN_TEST(branchless_trig_cache_counts);
+
+    printf("\nMath Cache Tests: %d/%d passed\n", tests_passed, tests_run);
+}
@@ -6,6 +6,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <threads.h>
 #include "seraph/proof_blob.h"
 #include "seraph/strand.h"
 
@@ -406,6 +407,163 @@ static int test_proof_blob_stats(void) {
     TEST_PASS("test_proof_blob_stats");
 }
 
+/*============================================================================
+ * Test: Open-Addressed Index and Bloom Filter
+ *============================================================================*/
+
+#define INDEX_TEST_LOCATIONS 2000
+
+/* Location i carries BOUNDS, plus VOID on even i, plus NULL every third */
+static uint8_t* build_index_blob(uint64_t mod_hash, size_t* size_out) {
+    Seraph_Proof_Blob_Builder builder;
+    uint8_t* buffer = NULL;
+    size_t size = 0;
+
+    for (int pass = 0; pass < 2; pass++) {
+        if (seraph_proof_blob_builder_init(&builder, buffer, size, mod_hash)
+            != SERAPH_VBIT_TRUE) {
+            free(buffer);
+            return NULL;
+        }
+        for (uint32_t i = 0; i < INDEX_TEST_LOCATIONS; i++) {
+            uint64_t loc = seraph_proof_location_hash(mod_hash, 0, i, 0);
+            Seraph_Proof proof = {0};
+            proof.kind = SERAPH_PROOF_BOUNDS;
+            proof.status = (i & 1) ? SERAPH_PROOF_STATUS_RUNTIME : SERAPH_PROOF_STATUS_PROVEN;
+            seraph_proof_blob_builder_add(&builder, loc, &proof);
+            if (i % 2 == 0) {
+                proof.kind = SERAPH_PROOF_VOID;
+                proof.status = SERAPH_PROOF_STATUS_ASSUMED;
+                seraph_proof_blob_builder_add(&builder, loc, &proof);
+            }
+            if (i % 3 == 0) {
+                proof.kind = SERAPH_PROOF_NULL;
+                proof.status = SERAPH_PROOF_STATUS_PROVEN;
+                seraph_proof_blob_builder_add(&builder, loc, &proof);
+            }
+        }
+        size = seraph_proof_blob_builder_finalize(&builder);
+        seraph_proof_blob_builder_destroy(&builder);
+        if (pass == 0) {
+            buffer = (uint8_t*)malloc(size);
+            if (!buffer) return NULL;
+        }
+    }
+
+    *size_out = size;
+    return buffer;
+}
+
+static int test_index_and_bloom(void) {
+    uint64_t mod_hash = seraph_proof_string_hash("index_test");
+    size_t size = 0;
+    uint8_t* buffer = build_index_blob(mod_hash, &size);
+    TEST_ASSERT(buffer != NULL, "Blob build should succeed");
+
+    Seraph_Proof_Blob blob;
+    TEST_ASSERT(seraph_proof_blob_load(&blob, buffer, size, true) == SERAPH_VBIT_TRUE,
+                "Loading blob should succeed");
+    uint32_t slots = blob.header->bucket_count;
+    TEST_ASSERT((slots & (slots - 1)) == 0, "Slot count should be a power of two");
+    TEST_ASSERT(slots >= 2 * blob.header->proof_count, "Index should be at most half full");
+
+    seraph_proof_blob_query_stats_reset();
+
+    /* Every stored proof is found with its status and record */
+    uint64_t expect_hits = 0;
+    for (uint32_t i = 0; i < INDEX_TEST_LOCATIONS; i++) {
+        uint64_t loc = seraph_proof_location_hash(mod_hash, 0, i, 0);
+        Seraph_Proof_Status st = seraph_proof_blob_query(&blob, loc, SERAPH_PROOF_BOUNDS);
+        TEST_ASSERT(st == ((i & 1) ? SERAPH_PROOF_STATUS_RUNTIME : SERAPH_PROOF_STATUS_PROVEN),
+                    "BOUNDS status should round-trip");
+        st = seraph_proof_blob_query(&blob, loc, SERAPH_PROOF_VOID);
+        TEST_ASSERT(st == (i % 2 == 0 ? SERAPH_PROOF_STATUS_ASSUMED : SERAPH_PROOF_STATUS_SKIPPED),
+                    "VOID status should round-trip");
+        st = seraph_proof_blob_query(&blob, loc, SERAPH_PROOF_NULL);
+        TEST_ASSERT(st == (i % 3 == 0 ? SERAPH_PROOF_STATUS_PROVEN : SERAPH_PROOF_STATUS_SKIPPED),
+                    "NULL status should round-trip");
+        expect_hits += 1 + (i % 2 == 0) + (i % 3 == 0);
+
+        const Seraph_Proof_Blob_Record* rec = seraph_proof_blob_get(&blob, loc, SERAPH_PROOF_BOUNDS);
+        TEST_ASSERT(rec != NULL && rec->kind == SERAPH_PROOF_BOUNDS, "Record should be found");
+    }
+
+    /* Locations with no proofs are mostly rejected by the Bloom filter */
+    for (uint32_t i = 0; i < 10000; i++) {
+        uint64_t loc = seraph_proof_location_hash(mod_hash, 1, i, 0);
+        TEST_ASSERT(seraph_proof_blob_query(&blob, loc, SERAPH_PROOF_BOUNDS)
+                    == SERAPH_PROOF_STATUS_SKIPPED, "Unknown location should be SKIPPED");
+    }
+
+    Seraph_Proof_Blob_Query_Stats qs;
+    seraph_proof_blob_query_stats(&qs);
+    TEST_ASSERT(qs.queries == 3 * INDEX_TEST_LOCATIONS + 10000, "Queries should be counted");
+    TEST_ASSERT(qs.hits == expect_hits, "Hits should be counted");
+    TEST_ASSERT(qs.misses == qs.queries - qs.hits, "Misses should be counted");
+    TEST_ASSERT(qs.bloom_rejects >= 9500, "Bloom filter should answer most misses");
+
+    seraph_proof_blob_unload(&blob);
+    free(buffer);
+
+    TEST_PASS("test_index_and_bloom");
+}
+
+typedef struct {
+    const Seraph_Proof_Blob* blob;
+    uint64_t mod_hash;
+    Seraph_Proof_Blob_Query_Stats stats;
+} Query_Thread_Arg;
+
+static int query_thread_main(void* p) {
+    Query_Thread_Arg* arg = (Query_Thread_Arg*)p;
+    for (uint32_t i = 0; i < 100; i++) {
+        uint64_t loc = seraph_proof_location_hash(arg->mod_hash, 0, i, 0);
+        seraph_proof_blob_query(arg->blob, loc, SERAPH_PROOF_BOUNDS);
+    }
+    seraph_proof_blob_query_stats(&arg->stats);
+    return 0;
+}
+
+static int test_thread_stats(void) {
+    uint64_t mod_hash = seraph_proof_string_hash("index_test");
+    size_t size = 0;
+    uint8_t* buffer = build_index_blob(mod_hash, &size);
+    TEST_ASSERT(buffer != NULL, "Blob build should succeed");
+
+    Seraph_Proof_Blob blob;
+    seraph_proof_blob_load(&blob, buffer, size, true);
+    seraph_proof_blob_query_stats_reset();
+
+    /* Two threads share one blob; each sees only its own counters */
+    Query_Thread_Arg args[2] = {
+        { &blob, mod_hash, {0} },
+        { &blob, mod_hash, {0} },
+    };
+    thrd_t threads[2];
+    for (int t = 0; t < 2; t++) {
+        TEST_ASSERT(thrd_create(&threads[t], query_thread_main, &args[t]) == thrd_success,
+                    "Thread should start");
+    }
+    for (int t = 0; t < 2; t++) {
+        thrd_join(threads[t], NULL);
+        TEST_ASSERT(args[t].stats.queries == 100, "Thread should count its own queries");
+        TEST_ASSERT(args[t].stats.hits == 100, "Thread should count its own hits");
+    }
+
+    Seraph_Proof_Blob_Query_Stats qs;
+    seraph_proof_blob_query_stats(&qs);
+    TEST_ASSERT(qs.queries == 0, "Main thread counters should be untouched");
+
+    /* A malformed index is rejected at load */
+    ((Seraph_Proof_Blob_Header*)buffer)->bucket_count += 1;
+    TEST_ASSERT(seraph_proof_blob_load(&blob, buffer, size, false) == SERAPH_VBIT_FALSE,
+                "Non power-of-two slot count should be rejected");
+
+    free(buffer);
+
+    TEST_PASS("test_thread_stats");
+}
+
 /*============================================================================
  * Main Test Runner
  *============================================================================*/
@@ -424,6 +582,8 @@ void run_proof_blob_tests(void) {
     total++; passed += test_has_proven();
     total++; passed += test_strand_proof_attachment();
     total++; passed += test_proof_blob_stats();
+    total++; passed += test_index_and_bloom();
+    total++; passed += test_thread_stats();
 
     fprintf(stderr, "\n=== Proof Blob Tests: %d/%d passed ===\n\n", passed, total);
 }
@@ -173,6 +173,207 @@ TEST(q128_div) {
     ASSERT(seraph_q128_is_void(quot));
 }
 
+static uint64_t q128_test_rng = 0x9E3779B97F4A7C15ull;
+
+static uint64_t q128_test_next(void) {
+    q128_test_rng ^= q128_test_rng << 13;
+    q128_test_rng ^= q128_test_rng >> 7;
+    q128_test_rng ^= q128_test_rng << 17;
+    return q128_test_rng;
+}
+
+/* Random non-VOID value with a random magnitude from 2^-64 to 2^62 */
+static Seraph_Q128 q128_test_random(void) {
+    uint64_t r = q128_test_next();
+    int shift = (int)(r % 127);
+    uint64_t hi = q128_test_next();
+    uint64_t lo = q128_test_next();
+    Seraph_Q128 x;
+    if (shift >= 64) {
+        x = (Seraph_Q128){ 0, lo >> (shift - 64) };
+    } else {
+        x = (Seraph_Q128){ (int64_t)((hi >> 2) >> shift), lo };
+    }
+    /* -2^-64 is the VOID pattern */
+    if ((r >> 8 & 1) && !(x.hi == 0 && x.lo == 1)) x = seraph_q128_neg(x);
+    return x;
+}
+
+/* floor(|a| * 2^64 / |b|) by shift-subtract; false if it needs 127+ bits */
+static bool q128_test_ref_div(Seraph_Q128 a, Seraph_Q128 b, Seraph_Q128* out) {
+    Seraph_Q128 abs_a = seraph_q128_abs(a);
+    Seraph_Q128 abs_b = seraph_q128_abs(b);
+    unsigned __int128 n = ((unsigned __int128)(uint64_t)abs_a.hi << 64) | abs_a.lo;
+    unsigned __int128 d = ((unsigned __int128)(uint64_t)abs_b.hi << 64) | abs_b.lo;
+    unsigned __int128 r = 0, q = 0;
+    for (int i = 191; i >= 0; i--) {
+        uint64_t bit = i >= 64 ? (uint64_t)(n >> (i - 64)) & 1 : 0;
+        if (q >> 126) return false;
+        r = (r << 1) | bit;
+        q <<= 1;
+        if (r >= d) {
+            r -= d;
+            q |= 1;
+        }
+    }
+    Seraph_Q128 mag = { (int64_t)(uint64_t)(q >> 64), (uint64_t)q };
+    *out = (seraph_q128_is_negative(a) != seraph_q128_is_negative(b))
+         ? seraph_q128_neg(mag) : mag;
+    return true;
+}
+
+TEST(q128_div_exact) {
+    /* Exact where the old reciprocal estimate was only close */
+    Seraph_Q128 q = seraph_q128_div(seraph_q128_from_i64(42), seraph_q128_from_i64(6));
+    ASSERT(q.hi == 7 && q.lo == 0);
+    q = seraph_q128_div(SERAPH_Q128_NEG_ONE, seraph_q128_from_i64(3));
+    ASSERT(q.hi == -1 && q.lo == 0xAAAAAAAAAAAAAAABULL);
+    q = seraph_q128_div(SERAPH_Q128_ONE, (Seraph_Q128){ 0, 1 });
+    ASSERT(seraph_q128_is_void(q));    /* 2^64 does not fit */
+
+    for (int i = 0; i < 20000; i++) {
+        Seraph_Q128 a = q128_test_random();
+        Seraph_Q128 b = q128_test_random();
+        if (seraph_q128_is_zero(b)) continue;
+        Seraph_Q128 expect;
+        bool fits = q128_test_ref_div(a, b, &expect);
+        q = seraph_q128_div(a, b);
+        if (fits) {
+            ASSERT(q.hi == expect.hi && q.lo == expect.lo);
+        } else {
+            ASSERT(seraph_q128_is_void(q));
+        }
+    }
+}
+
+TEST(q128_mul_impls) {
+    static const Seraph_Q128_Impl impls[] = {
+        SERAPH_Q128_IMPL_PORTABLE, SERAPH_Q128_IMPL_BMI2
+    };
+    Seraph_Q128 expect[512];
+    Seraph_Q128 args[512][2];
+    for (int i = 0; i < 512; i++) {
+        args[i][0] = q128_test_random();
+        args[i][1] = q128_test_random();
+    }
+
+    ASSERT(seraph_q128_set_impl(SERAPH_Q128_IMPL_PORTABLE));
+    for (int i = 0; i < 512; i++) {
+        expect[i] = seraph_q128_mul(args[i][0], args[i][1]);
+    }
+
+    for (size_t v = 0; v < sizeof(impls) / sizeof(impls[0]); v++) {
+        if (!seraph_q128_set_impl(impls[v])) continue;
+        ASSERT(seraph_q128_get_impl() == impls[v]);
+        for (int i = 0; i < 512; i++) {
+            Seraph_Q128 p = seraph_q128_mul(args[i][0], args[i][1]);
+            ASSERT(p.hi == expect[i].hi && p.lo == expect[i].lo);
+        }
+        ASSERT(seraph_q128_to_i64(seraph_q128_mul(seraph_q128_from_i64(-6),
+                                                  seraph_q128_from_i64(7))) == -42);
+    }
+
+    ASSERT(seraph_q128_set_impl(SERAPH_Q128_IMPL_AUTO));
+    ASSERT(seraph_q128_get_impl() != SERAPH_Q128_IMPL_AUTO);
+}
+
+/* Random operands plus VOIDs and near-overflow magnitudes */
+static Seraph_Q128 q128_test_batch_value(void) {
+    uint64_t r = q128_test_next();
+    switch (r % 16) {
+        case 0:  return SERAPH_Q128_VOID;
+        case 1:  return (Seraph_Q128){ INT64_MAX - (int64_t)(r >> 60), q128_test_next() };
+        case 2:  return (Seraph_Q128){ INT64_MIN + (int64_t)(r >> 60), q128_test_next() };
+        case 3:  return (Seraph_Q128){ (int64_t)(r >> 40), 0 };
+        default: return q128_test_random();
+    }
+}
+
+static bool q128_test_same(Seraph_Q128_Lanes x, size_t i, Seraph_Q128 v) {
+    return x.hi[i] == v.hi && x.lo[i] == v.lo;
+}
+
+TEST(q128_batch) {
+    enum { N = 1003 };
+    static Seraph_Q128 av[N], bv[N];
+    static int64_t ah[N], bh[N], dh[N];
+    static uint64_t al[N], bl[N], dl[N];
+    static Seraph_Vbit out[N];
+    Seraph_Q128_Lanes a = { ah, al }, b = { bh, bl }, dst = { dh, dl };
+
+    for (int i = 0; i < N; i++) {
+        av[i] = q128_test_batch_value();
+        bv[i] = q128_test_batch_value();
+    }
+    seraph_q128_lanes_scatter(a, av, N);
+    seraph_q128_lanes_scatter(b, bv, N);
+
+    static const Seraph_Vbit_Impl impls[] = { SERAPH_VBIT_IMPL_SCALAR, SERAPH_VBIT_IMPL_AVX2 };
+    for (size_t v = 0; v < sizeof(impls) / sizeof(impls[0]); v++) {
+        if (!seraph_vbit_set_impl(impls[v])) continue;
+
+        seraph_q128_add_n(dst, a, b, N);
+        for (int i = 0; i < N; i++) ASSERT(q128_test_same(dst, i, seraph_q128_add(av[i], bv[i])));
+        seraph_q128_sub_n(dst, a, b, N);
+        for (int i = 0; i < N; i++) ASSERT(q128_test_same(dst, i, seraph_q128_sub(av[i], bv[i])));
+        seraph_q128_mul_n(dst, a, b, N);
+        for (int i = 0; i < N; i++) ASSERT(q128_test_same(dst, i, seraph_q128_mul(av[i], bv[i])));
+        seraph_q128_neg_n(dst, a, N);
+        for (int i = 0; i < N; i++) ASSERT(q128_test_same(dst, i, seraph_q128_neg(av[i])));
+
+        seraph_q128_lt_n(a, b, out, N);
+        for (int i = 0; i < N; i++) ASSERT(out[i] == seraph_q128_lt(av[i], bv[i]));
+
+        size_t voids = seraph_q128_void_mask_n(a, out, N);
+        size_t expect = 0;
+        for (int i = 0; i < N; i++) {
+            ASSERT(out[i] == (seraph_q128_is_void(av[i]) ? SERAPH_VBIT_TRUE : SERAPH_VBIT_FALSE));
+            expect += seraph_q128_is_void(av[i]);
+        }
+        ASSERT(voids == expect && voids > 0);
+
+        /* In place: a = a + b */
+        Seraph_Q128 sums[N];
+        for (int i = 0; i < N; i++) sums[i] = seraph_q128_add(av[i], bv[i]);
+        seraph_q128_add_n(a, a, b, N);
+        for (int i = 0; i < N; i++) ASSERT(q128_test_same(a, i, sums[i]));
+        seraph_q128_lanes_scatter(a, av, N);
+    }
+    seraph_vbit_set_impl(SERAPH_VBIT_IMPL_AUTO);
+}
+
+TEST(q128_lanes_from_soa) {
+    Seraph_Arena arena;
+    ASSERT(seraph_arena_create(&arena, 65536, 0, 0) == SERAPH_VBIT_TRUE);
+
+    Seraph_FieldDesc fields[] = {
+        SERAPH_FIELD(Seraph_Q128, hi),
+        SERAPH_FIELD(Seraph_Q128, lo)
+    };
+    Seraph_SoA_Schema schema;
+    seraph_soa_schema_create(&schema, sizeof(Seraph_Q128), _Alignof(Seraph_Q128), fields, 2);
+    Seraph_SoA_Array array;
+    seraph_soa_array_create(&array, &arena, &schema, 64);
+
+    for (int i = 0; i < 10; i++) {
+        Seraph_Q128 v = seraph_q128_from_frac(i, 4);
+        seraph_soa_array_push(&array, &v);
+    }
+
+    Seraph_Q128_Lanes x;
+    ASSERT(seraph_q128_lanes_from_soa(&array, 0, &x) == SERAPH_VBIT_TRUE);
+    seraph_q128_add_n(x, x, x, seraph_soa_array_count(&array));
+
+    Seraph_Q128 got;
+    seraph_soa_array_get(&array, 7, &got);
+    ASSERT(got.hi == 3 && got.lo == 0x8000000000000000ULL);
+
+    ASSERT(seraph_q128_lanes_from_soa(&array, 1, &x) == SERAPH_VBIT_VOID);
+
+    seraph_soa_schema_destroy(&schema);
+    seraph_arena_destroy(&arena);
+}
+
 TEST(q128_neg) {
     Seraph_Q128 a = seraph_q128_from_i64(42);
     Seraph_Q128 neg = seraph_q128_neg(a);
@@ -379,6 +580,10 @@ void run_q128_tests(void) {
     RUN_TEST(q128_sub);
     RUN_TEST(q128_mul);
     RUN_TEST(q128_div);
+    RUN_TEST(q128_div_exact);
+    RUN_TEST(q128_mul_impls);
+    RUN_TEST(q128_batch);
+    RUN_TEST(q128_lanes_from_soa);
     RUN_TEST(q128_neg);
     RUN_TEST(q128_abs);
 
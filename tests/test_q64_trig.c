@@ -0,0 +1,237 @@
+/**
+ * @file test_q64_trig.c
+ * @brief Test suite for Q64.64 sin/cos, scalar and batched
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "seraph/q64_trig.h"
+
+static int tests_run = 0;
+static int tests_passed = 0;
+static int current_test_failed = 0;
+
+#define TEST(name) __attribute__((unused)) static void test_##name(void)
+#define RUN_TEST(name) do { \
+    printf("  Running %s... ", #name); fflush(stdout); \
+    tests_run++; \
+    current_test_failed = 0; \
+    test_##name(); \
+    if (!current_test_failed) { \
+        tests_passed++; \
+        printf("PASSED\n"); \
+    } \
+    fflush(stdout); \
+} while(0)
+
+#define ASSERT(cond) do { \
+    if (!(cond)) { \
+        printf("FAILED at line %d: %s\n", __LINE__, #cond); \
+        current_test_failed = 1; \
+        return; \
+    } \
+} while(0)
+
+#define ASSERT_EQ(a, b) ASSERT((a) == (b))
+
+#define N_ANGLES 4099
+
+/* π/4, rounded to 2^-64 */
+static const Q64 PI_4 = { .hi = 0, .lo = 0xC90FDAA22168C235ull };
+
+static uint64_t rng_state = 0x9E3779B97F4A7C15ull;
+
+static uint64_t next_rand(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+/*
+ * Random angle in [-64, 64) radians. The low 12 bits are cleared so the
+ * angle fits a long double mantissa exactly.
+ */
+static Q64 random_angle(void) {
+    uint64_t r = next_rand();
+    return (Q64){ .hi = (int64_t)(r >> 57) - 64, .lo = next_rand() & ~(uint64_t)0xFFF };
+}
+
+static int q64_same(Q64 a, Q64 b) {
+    return a.hi == b.hi && a.lo == b.lo;
+}
+
+static long double q64_to_ld(Q64 x) {
+    return (long double)x.hi + ldexpl((long double)x.lo, -64);
+}
+
+/* |x - ref| in units of 2^-64 */
+static long double q64_err(Q64 x, long double ref) {
+    return fabsl(q64_to_ld(x) - ref) * ldexpl(1.0L, 64);
+}
+
+/*============================================================================
+ * Scalar Tests
+ *============================================================================*/
+
+TEST(sincos_accuracy) {
+    long double worst = 0;
+    for (int i = 0; i < N_ANGLES; i++) {
+        Q64 a = random_angle();
+        Q64 s, c;
+        q64_sincos(a, &s, &c);
+        long double x = q64_to_ld(a);
+        long double es = q64_err(s, sinl(x));
+        long double ec = q64_err(c, cosl(x));
+        if (es > worst) worst = es;
+        if (ec > worst) worst = ec;
+    }
+    /* 5 ulp from the table walk plus ~1 from the long double reference */
+    ASSERT(worst < 16.0L);
+}
+
+TEST(sincos_octant_boundaries) {
+    Q64 s, c;
+    q64_sincos(Q64_ZERO, &s, &c);
+    ASSERT_EQ(s.hi, 0);
+    ASSERT_EQ(s.lo, 0u);
+    ASSERT_EQ(c.hi, Q64_ONE.hi);
+    ASSERT_EQ(c.lo, Q64_ONE.lo);
+
+    /* k·π/4 for every octant, both signs */
+    for (int k = -8; k <= 8; k++) {
+        Q64 a = q64_mul(q64_from_i64(k), PI_4);
+        long double x = q64_to_ld(a);
+        q64_sincos(a, &s, &c);
+        ASSERT(q64_err(s, sinl(x)) < 16.0L);
+        ASSERT(q64_err(c, cosl(x)) < 16.0L);
+    }
+}
+
+TEST(sincos_negative_symmetry) {
+    for (int i = 0; i < 512; i++) {
+        Q64 a = random_angle();
+        Q64 s1, c1, s2, c2;
+        q64_sincos(a, &s1, &c1);
+        q64_sincos(q64_neg(a), &s2, &c2);
+        Q64 ns = q64_neg(s2);
+        ASSERT_EQ(s1.hi, ns.hi);
+        ASSERT_EQ(s1.lo, ns.lo);
+        ASSERT_EQ(c1.hi, c2.hi);
+        ASSERT_EQ(c1.lo, c2.lo);
+    }
+}
+
+TEST(reduce_to_octant) {
+    /* 3π/8 is in octant 1, mirrored to π/8 */
+    Q64 pi_8 = { .hi = 0, .lo = PI_4.lo >> 1 };
+    Q64 a = q64_add(PI_4, pi_8);
+    int octant = -1;
+    Q64 r = q64_reduce_to_octant(a, &octant);
+    ASSERT_EQ(octant, 1);
+    ASSERT(fabsl(q64_to_ld(r) - 3.14159265358979323846L / 8) < 1e-17L);
+
+    /* -π/8 + 2π lands in octant 7 */
+    Q64 b = q64_sub(Q64_2PI, pi_8);
+    r = q64_reduce_to_octant(b, &octant);
+    ASSERT_EQ(octant, 7);
+    ASSERT(fabsl(q64_to_ld(r) - 3.14159265358979323846L / 8) < 1e-17L);
+}
+
+TEST(interpolate_hits_table) {
+    q64_trig_init();
+    Q64 s, c;
+    for (int i = 0; i <= Q64_TRIG_TABLE_SIZE; i += 37) {
+        q64_interpolate(q64_trig_table, i, Q64_ZERO, &s, &c);
+        ASSERT_EQ(s.lo, q64_trig_table[i].sin_val.lo);
+        ASSERT_EQ(c.hi, q64_trig_table[i].cos_val.hi);
+        ASSERT_EQ(c.lo, q64_trig_table[i].cos_val.lo);
+    }
+
+    /* Half a step past entry 100 */
+    Q64 half = { .hi = 0, .lo = (uint64_t)1 << 63 };
+    q64_interpolate(q64_trig_table, 100, half, &s, &c);
+    long double x = 100.5L * 3.14159265358979323846L / 4 / Q64_TRIG_TABLE_SIZE;
+    ASSERT(q64_err(s, sinl(x)) < 16.0L);
+    ASSERT(q64_err(c, cosl(x)) < 16.0L);
+}
+
+/*============================================================================
+ * Batch Tests
+ *============================================================================*/
+
+TEST(sincos_n_matches_scalar) {
+    Q64* angles = malloc(N_ANGLES * sizeof(Q64));
+    Q64* s = malloc(N_ANGLES * sizeof(Q64));
+    Q64* c = malloc(N_ANGLES * sizeof(Q64));
+    ASSERT(angles && s && c);
+
+    for (int i = 0; i < N_ANGLES; i++) angles[i] = random_angle();
+    angles[0] = Q64_ZERO;
+    angles[1] = Q64_PI;
+    angles[2] = q64_neg(Q64_PI_2);
+    angles[3] = Q64_2PI;
+    angles[4] = (Q64){ .hi = 0, .lo = 1 };
+    angles[5] = (Q64){ .hi = -1, .lo = UINT64_MAX };
+
+    q64_sincos_n(angles, s, c, N_ANGLES);
+
+    /* Bit-identical, including the short group at the end */
+    int ok = 1;
+    for (int i = 0; i < N_ANGLES && ok; i++) {
+        Q64 rs, rc;
+        q64_sincos(angles[i], &rs, &rc);
+        ok = q64_same(s[i], rs) && q64_same(c[i], rc);
+    }
+
+    /* Every partial group length, starting mid-array */
+    for (size_t n = 1; n <= 17 && ok; n++) {
+        q64_sincos_n(angles + 100, s, c, n);
+        for (size_t i = 0; i < n && ok; i++) {
+            Q64 rs, rc;
+            q64_sincos(angles[100 + i], &rs, &rc);
+            ok = q64_same(s[i], rs) && q64_same(c[i], rc);
+        }
+    }
+    free(angles); free(s); free(c);
+    ASSERT(ok);
+}
+
+TEST(sincos_n_in_place) {
+    Q64 angles[13], orig[13], c[13];
+    for (int i = 0; i < 13; i++) orig[i] = angles[i] = random_angle();
+
+    q64_sincos_n(angles, angles, c, 13);
+    for (int i = 0; i < 13; i++) {
+        Q64 rs, rc;
+        q64_sincos(orig[i], &rs, &rc);
+        ASSERT(q64_same(angles[i], rs));
+        ASSERT(q64_same(c[i], rc));
+    }
+
+    /* Zero count and NULL buffers are no-ops */
+    q64_sincos_n(orig, NULL, c, 13);
+    q64_sincos_n(orig, angles, c, 0);
+}
+
+/*============================================================================
+ * Main Test Runner
+ *============================================================================*/
+
+void run_q64_trig_tests(void) {
+    printf("\n=== Q64.64 Trig Tests ===\n\n");
+
+    printf("Scalar Tests:\n");
+    RUN_TEST(sincos_accuracy);
+    RUN_TEST(sincos_octant_boundaries);
+    RUN_TEST(sincos_negative_symmetry);
+    RUN_TEST(reduce_to_octant);
+    RUN_TEST(interpolate_hits_table);
+
+    printf("\nBatch Tests:\n");
+    RUN_TEST(sincos_n_matches_scalar);
+    RUN_TEST(sincos_n_in_place);
+
+    printf("\nQ64 Trig Tests: %d/%d passed\n", tests_passed, tests_run);
+}
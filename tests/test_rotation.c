@@ -0,0 +1,248 @@
+/**
+ * @file test_rotation.c
+ * @brief Test suite for the Zero-FPU rotation layer: batch rotation and the SoA oscillator bank
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "seraph/rotation.h"
+#include "seraph/vbit.h"
+
+static int tests_run = 0;
+static int tests_passed = 0;
+static int current_test_failed = 0;
+
+#define TEST(name) __attribute__((unused)) static void test_##name(void)
+#define RUN_TEST(name) do { \
+    printf("  Running %s... ", #name); fflush(stdout); \
+    tests_run++; \
+    current_test_failed = 0; \
+    test_##name(); \
+    if (!current_test_failed) { \
+        tests_passed++; \
+        printf("PASSED\n"); \
+    } \
+    fflush(stdout); \
+} while(0)
+
+#define ASSERT(cond) do { \
+    if (!(cond)) { \
+        printf("FAILED at line %d: %s\n", __LINE__, #cond); \
+        current_test_failed = 1; \
+        return; \
+    } \
+} while(0)
+
+#define ASSERT_EQ(a, b) ASSERT((a) == (b))
+#define ASSERT_TRUE(x) ASSERT((x) == true)
+#define ASSERT_FALSE(x) ASSERT((x) == false)
+
+/* Odd count so the AVX2 path also exercises its scalar tail */
+#define BANK_COUNT  21
+#define BANK_RATE   48000
+#define BANK_FRAMES 1000
+
+static void bank_frequencies(uint32_t* freqs, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        freqs[i] = 55 + (uint32_t)(i * 997) % 12000;
+    }
+}
+
+/* Reference: one Seraph_Oscillator16 per lane, renormalized on the bank's schedule */
+static void reference_render(Q16* out, size_t count, size_t frames, Q16 amplitude) {
+    uint32_t freqs[BANK_COUNT];
+    Seraph_Oscillator16 oscs[BANK_COUNT];
+    bank_frequencies(freqs, count);
+    for (size_t i = 0; i < count; i++) {
+        seraph_oscillator16_init(&oscs[i], freqs[i], BANK_RATE, amplitude);
+    }
+    for (size_t f = 0; f < frames; f++) {
+        for (size_t i = 0; i < count; i++) {
+            out[f * count + i] = seraph_oscillator16_sample(&oscs[i]);
+        }
+        if ((f + 1) % SERAPH_OSC_BANK_RENORM_INTERVAL == 0) {
+            for (size_t i = 0; i < count; i++) {
+                seraph_rotation16_normalize(&oscs[i].state);
+            }
+        }
+    }
+}
+
+static bool bank_matches_reference(Seraph_Vbit_Impl impl) {
+    static Q16 expect[BANK_FRAMES * BANK_COUNT];
+    static Q16 got[BANK_FRAMES * BANK_COUNT];
+    Q16 storage[SERAPH_OSC_BANK_STORAGE(BANK_COUNT)];
+    uint32_t freqs[BANK_COUNT];
+    Seraph_Oscillator_Bank16 bank;
+
+    Seraph_Vbit_Impl saved = seraph_vbit_get_impl();
+    seraph_vbit_set_impl(impl);
+
+    reference_render(expect, BANK_COUNT, BANK_FRAMES, Q16_ONE / 2);
+    bank_frequencies(freqs, BANK_COUNT);
+    seraph_oscillator_bank16_init(&bank, storage, BANK_COUNT, freqs, BANK_RATE, Q16_ONE / 2);
+    seraph_oscillator_bank16_render(&bank, got, BANK_FRAMES);
+
+    seraph_vbit_set_impl(saved);
+    return memcmp(expect, got, sizeof(got)) == 0;
+}
+
+/*============================================================================
+ * Batch Rotation Tests
+ *============================================================================*/
+
+TEST(apply_batch_matches_scalar) {
+    Seraph_Rotation16 rot;
+    seraph_rotation16_init(&rot, Q16_PI / 3, 0);
+
+    Q16 points[2 * 37], expect[2 * 37];
+    for (int i = 0; i < 2 * 37; i++) {
+        points[i] = (Q16)((i * 40503) % 0x40000) - 0x20000;
+    }
+    for (int i = 0; i < 37; i++) {
+        Q16 x = points[2 * i], y = points[2 * i + 1];
+        seraph_rotation16_apply(&rot, &x, &y);
+        expect[2 * i] = x;
+        expect[2 * i + 1] = y;
+    }
+
+    Seraph_Vbit_Impl saved = seraph_vbit_get_impl();
+    Seraph_Vbit_Impl impls[] = { SERAPH_VBIT_IMPL_SCALAR, SERAPH_VBIT_IMPL_AVX2 };
+    for (size_t k = 0; k < sizeof(impls) / sizeof(impls[0]); k++) {
+        Q16 work[2 * 37];
+        memcpy(work, points, sizeof(work));
+        seraph_vbit_set_impl(impls[k]);
+        seraph_rotation16_apply_batch(&rot, work, 37);
+        seraph_vbit_set_impl(saved);
+        ASSERT(memcmp(work, expect, sizeof(work)) == 0);
+    }
+}
+
+/*============================================================================
+ * Oscillator Bank Tests
+ *============================================================================*/
+
+TEST(bank_init_rejects_bad_args) {
+    Q16 storage[SERAPH_OSC_BANK_STORAGE(4)];
+    uint32_t freqs[4] = { 100, 200, 300, 400 };
+    Seraph_Oscillator_Bank16 bank;
+    ASSERT_FALSE(seraph_oscillator_bank16_init(NULL, storage, 4, freqs, BANK_RATE, Q16_ONE));
+    ASSERT_FALSE(seraph_oscillator_bank16_init(&bank, NULL, 4, freqs, BANK_RATE, Q16_ONE));
+    ASSERT_FALSE(seraph_oscillator_bank16_init(&bank, storage, 4, NULL, BANK_RATE, Q16_ONE));
+    ASSERT_FALSE(seraph_oscillator_bank16_init(&bank, storage, 4, freqs, 0, Q16_ONE));
+    ASSERT_TRUE(seraph_oscillator_bank16_init(&bank, storage, 4, freqs, BANK_RATE, Q16_ONE));
+}
+
+TEST(bank_scalar_matches_oscillators) {
+    ASSERT_TRUE(bank_matches_reference(SERAPH_VBIT_IMPL_SCALAR));
+}
+
+TEST(bank_avx2_matches_oscillators) {
+    ASSERT_TRUE(bank_matches_reference(SERAPH_VBIT_IMPL_AVX2));
+}
+
+TEST(bank_chunking_invariant) {
+    static Q16 whole[BANK_FRAMES], pieces[BANK_FRAMES];
+    Q16 storage[SERAPH_OSC_BANK_STORAGE(BANK_COUNT)];
+    uint32_t freqs[BANK_COUNT];
+    Seraph_Oscillator_Bank16 bank;
+    bank_frequencies(freqs, BANK_COUNT);
+
+    seraph_oscillator_bank16_init(&bank, storage, BANK_COUNT, freqs, BANK_RATE, Q16_ONE / 8);
+    seraph_oscillator_bank16_mix(&bank, whole, BANK_FRAMES);
+
+    /* Uneven chunks cross block and renormalization boundaries */
+    seraph_oscillator_bank16_init(&bank, storage, BANK_COUNT, freqs, BANK_RATE, Q16_ONE / 8);
+    size_t done = 0, step = 1;
+    while (done < BANK_FRAMES) {
+        size_t n = step < BANK_FRAMES - done ? step : BANK_FRAMES - done;
+        seraph_oscillator_bank16_mix(&bank, pieces + done, n);
+        done += n;
+        step = step * 3 + 1;
+    }
+    ASSERT(memcmp(whole, pieces, sizeof(whole)) == 0);
+}
+
+TEST(bank_mix_sums_render) {
+    static Q16 lanes[BANK_FRAMES * BANK_COUNT];
+    static Q16 mixed[BANK_FRAMES];
+    Q16 storage[SERAPH_OSC_BANK_STORAGE(BANK_COUNT)];
+    uint32_t freqs[BANK_COUNT];
+    Seraph_Oscillator_Bank16 bank;
+    bank_frequencies(freqs, BANK_COUNT);
+
+    seraph_oscillator_bank16_init(&bank, storage, BANK_COUNT, freqs, BANK_RATE, Q16_ONE / 8);
+    seraph_oscillator_bank16_render(&bank, lanes, BANK_FRAMES);
+    seraph_oscillator_bank16_init(&bank, storage, BANK_COUNT, freqs, BANK_RATE, Q16_ONE / 8);
+    seraph_oscillator_bank16_mix(&bank, mixed, BANK_FRAMES);
+
+    for (size_t f = 0; f < BANK_FRAMES; f++) {
+        int64_t sum = 0;
+        for (size_t i = 0; i < BANK_COUNT; i++) {
+            sum += lanes[f * BANK_COUNT + i];
+        }
+        ASSERT_EQ(mixed[f], (Q16)sum);
+    }
+}
+
+TEST(bank_mix_saturates) {
+    enum { N = 64 };
+    Q16 storage[SERAPH_OSC_BANK_STORAGE(N)];
+    uint32_t freqs[N];
+    Q16 out[64];
+    Seraph_Oscillator_Bank16 bank;
+    for (int i = 0; i < N; i++) freqs[i] = BANK_RATE / 4;
+
+    /* 64 in-phase oscillators at amplitude 2^30 overflow 32 bits at the peak */
+    seraph_oscillator_bank16_init(&bank, storage, N, freqs, BANK_RATE, 0x40000000);
+    seraph_oscillator_bank16_mix(&bank, out, 64);
+
+    bool hit_max = false;
+    for (int f = 0; f < 64; f++) {
+        ASSERT(out[f] >= -0x7FFFFFFF);
+        if (out[f] == 0x7FFFFFFF) hit_max = true;
+    }
+    ASSERT_TRUE(hit_max);
+}
+
+TEST(bank_set_frequency) {
+    Q16 storage[SERAPH_OSC_BANK_STORAGE(9)];
+    uint32_t freqs[9] = { 100, 100, 100, 100, 100, 100, 100, 100, 100 };
+    Seraph_Oscillator_Bank16 bank;
+    Q16 lanes[10 * 9];
+    Seraph_Oscillator16 ref;
+
+    seraph_oscillator_bank16_init(&bank, storage, 9, freqs, BANK_RATE, Q16_ONE);
+    seraph_oscillator_bank16_set_frequency(&bank, 3, 4400);
+    seraph_oscillator_bank16_set_frequency(&bank, 9, 4400);   /* Out of range: ignored */
+    seraph_oscillator_bank16_render(&bank, lanes, 10);
+
+    seraph_oscillator16_init(&ref, 4400, BANK_RATE, Q16_ONE);
+    for (int f = 0; f < 10; f++) {
+        ASSERT_EQ(lanes[f * 9 + 3], seraph_oscillator16_sample(&ref));
+    }
+    ASSERT_EQ(lanes[9 * 9 + 2], lanes[9 * 9 + 8]);
+}
+
+/*============================================================================
+ * Main Test Runner
+ *============================================================================*/
+
+void run_rotation_tests(void) {
+    printf("\n=== Zero-FPU Rotation Tests ===\n\n");
+
+    printf("Batch Rotation Tests:\n");
+    RUN_TEST(apply_batch_matches_scalar);
+
+    printf("\nOscillator Bank Tests:\n");
+    RUN_TEST(bank_init_rejects_bad_args);
+    RUN_TEST(bank_scalar_matches_oscillators);
+    RUN_TEST(bank_avx2_matches_oscillators);
+    RUN_TEST(bank_chunking_invariant);
+    RUN_TEST(bank_mix_sums_render);
+    RUN_TEST(bank_mix_saturates);
+    RUN_TEST(bank_set_frequency);
+
+    printf("\nRotation Tests: %d/%d passed\n", tests_passed, tests_run);
+}
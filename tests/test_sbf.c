@@ -9,6 +9,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <assert.h>
+#include <stddef.h>
 
 #include "seraph/sbf.h"
 #include "seraph/seraphim/sbf_writer.h"
@@ -106,6 +107,130 @@ static int test_sha256_merkle(void) {
     return 1;
 }
 
+static int test_sha256_impls(void) {
+    static uint8_t msg[70000];
+    for (size_t i = 0; i < sizeof(msg); i++) {
+        msg[i] = (uint8_t)(i * 131 + (i >> 8));
+    }
+    static const size_t lens[] = { 0, 1, 3, 55, 56, 63, 64, 65, 119, 120, 128, 1000, 70000 };
+    enum { NLENS = sizeof(lens) / sizeof(lens[0]) };
+
+    uint8_t expected[NLENS][SHA256_DIGEST_SIZE];
+    ASSERT(sha256_set_impl(SHA256_IMPL_SCALAR));
+    for (size_t i = 0; i < NLENS; i++) {
+        sha256(msg, lens[i], expected[i]);
+    }
+
+    static const SHA256_Impl impls[] = { SHA256_IMPL_SHA_NI, SHA256_IMPL_AVX2, SHA256_IMPL_AUTO };
+    for (size_t v = 0; v < sizeof(impls) / sizeof(impls[0]); v++) {
+        if (!sha256_impl_supported(impls[v])) continue;
+        ASSERT(sha256_set_impl(impls[v]));
+
+        /* One-shot and incremental with odd split points */
+        for (size_t i = 0; i < NLENS; i++) {
+            uint8_t digest[SHA256_DIGEST_SIZE];
+            sha256(msg, lens[i], digest);
+            ASSERT(memcmp(digest, expected[i], SHA256_DIGEST_SIZE) == 0);
+
+            SHA256_Context ctx;
+            sha256_init(&ctx);
+            size_t split = lens[i] / 3;
+            sha256_update(&ctx, msg, split);
+            sha256_update(&ctx, msg + split, lens[i] - split);
+            sha256_final(&ctx, digest);
+            ASSERT(memcmp(digest, expected[i], SHA256_DIGEST_SIZE) == 0);
+        }
+    }
+
+    sha256_set_impl(SHA256_IMPL_AUTO);
+    return 1;
+}
+
+static int test_sha256_multi(void) {
+    /* 19 messages: two full AVX2 groups plus a partial one, mixed lengths */
+    static uint8_t msg[19][300];
+    const void* data[19];
+    size_t lens[19];
+    uint8_t expected[19 * SHA256_DIGEST_SIZE];
+    uint8_t digests[19 * SHA256_DIGEST_SIZE];
+
+    ASSERT(sha256_set_impl(SHA256_IMPL_SCALAR));
+    for (size_t i = 0; i < 19; i++) {
+        for (size_t j = 0; j < sizeof(msg[i]); j++) {
+            msg[i][j] = (uint8_t)(i * 17 + j);
+        }
+        data[i] = msg[i];
+        lens[i] = (i * 37) % 300;
+        sha256(msg[i], lens[i], &expected[i * SHA256_DIGEST_SIZE]);
+    }
+
+    static const SHA256_Impl impls[] = {
+        SHA256_IMPL_SCALAR, SHA256_IMPL_SHA_NI, SHA256_IMPL_AVX2, SHA256_IMPL_AUTO
+    };
+    for (size_t v = 0; v < sizeof(impls) / sizeof(impls[0]); v++) {
+        if (!sha256_impl_supported(impls[v])) continue;
+        ASSERT(sha256_set_impl(impls[v]));
+
+        memset(digests, 0, sizeof(digests));
+        sha256_multi(data, lens, 19, digests);
+        ASSERT(memcmp(digests, expected, sizeof(expected)) == 0);
+
+        /* Merkle levels go through the same path */
+        uint8_t root[SHA256_DIGEST_SIZE];
+        uint8_t ref[SHA256_DIGEST_SIZE];
+        ASSERT(sha256_merkle_root_alloc(expected, 19, root) == 1);
+        uint8_t level[19 * SHA256_DIGEST_SIZE];
+        memcpy(level, expected, sizeof(level));
+        size_t n = 19;
+        while (n > 1) {
+            for (size_t i = 0; i < (n + 1) / 2; i++) {
+                const uint8_t* left = &level[2 * i * SHA256_DIGEST_SIZE];
+                const uint8_t* right = 2 * i + 1 < n ? left + SHA256_DIGEST_SIZE : left;
+                sha256_hash_pair(left, right, &level[i * SHA256_DIGEST_SIZE]);
+            }
+            n = (n + 1) / 2;
+        }
+        memcpy(ref, level, SHA256_DIGEST_SIZE);
+        ASSERT(sha256_equal(root, ref));
+    }
+
+    sha256_set_impl(SHA256_IMPL_AUTO);
+    return 1;
+}
+
+static int test_sha256_merkle_path(void) {
+    uint8_t leaves[5 * SHA256_DIGEST_SIZE];
+    uint8_t root[SHA256_DIGEST_SIZE];
+
+    for (int i = 0; i < 5; i++) {
+        char name[8] = { 'l', 'e', 'a', 'f', (char)('0' + i), 0 };
+        sha256(name, 5, &leaves[i * SHA256_DIGEST_SIZE]);
+    }
+    ASSERT(sha256_merkle_root_alloc(leaves, 5, root) == 1);
+
+    /* 5 + 3 + 2 + 1 nodes; stored root matches the flat computation */
+    size_t nodes = sha256_merkle_tree_nodes(5);
+    ASSERT(nodes == 11);
+    ASSERT(sha256_merkle_tree_nodes(1) == 1);
+    uint8_t tree[11 * SHA256_DIGEST_SIZE];
+    ASSERT(sha256_merkle_tree(leaves, 5, tree) == 1);
+    ASSERT(sha256_equal(&tree[(nodes - 1) * SHA256_DIGEST_SIZE], root));
+
+    /* Every leaf verifies at its own index and nowhere else */
+    for (size_t i = 0; i < 5; i++) {
+        ASSERT(sha256_merkle_verify_path(&leaves[i * SHA256_DIGEST_SIZE], i, 5, tree, root));
+        ASSERT(!sha256_merkle_verify_path(&leaves[i * SHA256_DIGEST_SIZE], (i + 1) % 5,
+                                          5, tree, root));
+    }
+
+    uint8_t forged[SHA256_DIGEST_SIZE];
+    sha256("forged", 6, forged);
+    ASSERT(!sha256_merkle_verify_path(forged, 4, 5, tree, root));
+    ASSERT(!sha256_merkle_verify_path(&leaves[0], 5, 5, tree, root));
+
+    return 1;
+}
+
 static int test_sha256_hex(void) {
     uint8_t hash[SHA256_DIGEST_SIZE];
     char hex[65];
@@ -473,6 +598,198 @@ static int test_sbf_dump(void) {
     return 1;
 }
 
+/* Multi-chunk binary: 4 KiB chunks, 5 pages of code, rodata and proofs */
+static SBF_Writer* build_chunked_binary(size_t proof_count) {
+    SBF_Writer_Config config = {0};
+    config.architecture = SBF_ARCH_X64;
+    config.chunk_shift = 12;
+    SBF_Writer* writer = sbf_writer_create_with_config(&config);
+    if (writer == NULL) return NULL;
+
+    static uint8_t code[5 * 4096];
+    for (size_t i = 0; i < sizeof(code); i++) {
+        code[i] = (uint8_t)(i * 7);
+    }
+    static const char rodata[] = "chunked rodata";
+    SBF_Manifest_Config manifest = {0};
+    manifest.stack_size = 0x4000;
+
+    bool ok = sbf_writer_set_code(writer, code, sizeof(code)) == SBF_WRITE_OK &&
+              sbf_writer_set_rodata(writer, rodata, sizeof(rodata)) == SBF_WRITE_OK &&
+              sbf_writer_configure_manifest(writer, &manifest) == SBF_WRITE_OK;
+    for (size_t i = 0; ok && i < proof_count; i++) {
+        char loc[48];
+        snprintf(loc, sizeof(loc), "chunk.srph:%zu:1", i + 1);
+        ok = sbf_writer_add_proof_ex(writer, SBF_PROOF_BOUNDS, SBF_PROOF_PROVEN,
+                                     i * 16, loc, "index in range") == SBF_WRITE_OK;
+    }
+    if (!ok || sbf_writer_finalize(writer) != SBF_WRITE_OK) {
+        sbf_writer_destroy(writer);
+        return NULL;
+    }
+    return writer;
+}
+
+static int test_sbf_chunk_table(void) {
+    SBF_Writer* writer = build_chunked_binary(5);
+    ASSERT(writer != NULL);
+
+    const SBF_Header* hdr = sbf_writer_get_header(writer);
+    ASSERT(hdr->flags & SBF_FLAG_CHUNKED);
+    ASSERT(hdr->chunks_offset + hdr->chunks_size == hdr->total_size);
+    ASSERT(hdr->chunks_offset >= hdr->strings_offset + hdr->strings_size);
+
+    size_t size;
+    const uint8_t* data = (const uint8_t*)sbf_writer_get_binary(writer, &size);
+    const SBF_Chunk_Table* table = (const SBF_Chunk_Table*)(data + hdr->chunks_offset);
+    ASSERT(table->magic == SBF_CHUNK_MAGIC);
+    ASSERT(table->chunk_shift == 12);
+    ASSERT(table->covered_size == hdr->chunks_offset - SBF_HEADER_SIZE);
+    ASSERT(table->chunk_count == (table->covered_size + 4095) / 4096);
+    ASSERT(table->chunk_count > 5);
+
+    /* Tree root is the content hash */
+    const uint8_t* tree = (const uint8_t*)table + sizeof(SBF_Chunk_Table);
+    ASSERT(sha256_equal(&tree[(table->node_count - 1) * SHA256_DIGEST_SIZE],
+                        hdr->content_hash));
+
+    sbf_writer_destroy(writer);
+    return 1;
+}
+
+static int test_sbf_mapped_file(void) {
+    SBF_Writer* writer = build_chunked_binary(3);
+    ASSERT(writer != NULL);
+
+    const char* path = "test_sbf_mapped.sbf";
+    ASSERT(sbf_writer_write_file(writer, path) == SBF_WRITE_OK);
+
+    SBF_Loader_Config config = {
+        .verify_content_hash = true,
+        .verify_proof_root = true,
+        .reject_failed_proofs = true,
+        .verify_threads = 4,
+    };
+    SBF_Loader* loader = sbf_loader_create_with_config(&config);
+    ASSERT(loader != NULL);
+    ASSERT(sbf_loader_load_file(loader, path) == SBF_LOAD_OK);
+#if defined(__unix__) || defined(__APPLE__)
+    ASSERT(loader->mapped);
+    ASSERT(!loader->owns_data);
+#endif
+
+    /* Parallel chunk hashing covers the whole content */
+    ASSERT(sbf_loader_validate(loader) == SBF_VALID);
+    const SBF_Header* hdr = sbf_loader_get_header(loader);
+    ASSERT(sbf_loader_get_verified_bytes(loader) == hdr->chunks_offset - SBF_HEADER_SIZE);
+
+    /* Sections point straight into the mapping */
+    size_t code_size;
+    const uint8_t* code = (const uint8_t*)sbf_loader_get_code(loader, &code_size);
+    ASSERT(code == loader->data + hdr->code_offset);
+    ASSERT(code_size == 5 * 4096);
+    ASSERT(code[4097] == (uint8_t)(4097 * 7));
+
+    sbf_loader_destroy(loader);
+    sbf_writer_destroy(writer);
+    remove(path);
+    return 1;
+}
+
+static int test_sbf_lazy_verify(void) {
+    SBF_Writer* writer = build_chunked_binary(3);
+    ASSERT(writer != NULL);
+
+    size_t size;
+    const uint8_t* data = (const uint8_t*)sbf_writer_get_binary(writer, &size);
+    const SBF_Header* hdr = sbf_writer_get_header(writer);
+
+    /* Corrupt one byte in the last code page */
+    uint8_t* bad = (uint8_t*)malloc(size);
+    ASSERT(bad != NULL);
+    memcpy(bad, data, size);
+    bad[hdr->code_offset + 4 * 4096 + 10] ^= 0xFF;
+
+    SBF_Loader_Config config = {
+        .verify_content_hash = true,
+        .verify_proof_root = true,
+        .reject_failed_proofs = true,
+        .lazy_verify = true,
+    };
+    SBF_Loader* loader = sbf_loader_create_with_config(&config);
+    ASSERT(loader != NULL);
+    ASSERT(sbf_loader_load_buffer(loader, bad, size, false) == SBF_LOAD_OK);
+
+    /* Validation only hashes the manifest and proof table header */
+    ASSERT(sbf_loader_validate(loader) == SBF_VALID);
+    uint64_t after_validate = sbf_loader_get_verified_bytes(loader);
+    ASSERT(after_validate > 0);
+    ASSERT(after_validate < hdr->code_size);
+
+    /* Untouched sections still verify, the damaged one does not */
+    size_t rodata_size;
+    ASSERT(sbf_loader_get_rodata(loader, &rodata_size) != NULL);
+    ASSERT(rodata_size == sizeof("chunked rodata"));
+    ASSERT(sbf_loader_verify_range(loader, hdr->code_offset, 4096));
+    size_t code_size;
+    ASSERT(sbf_loader_get_code(loader, &code_size) == NULL);
+    ASSERT(code_size == 0);
+    ASSERT(!sbf_loader_verify_range(loader, hdr->code_offset + 4 * 4096, 1));
+    sbf_loader_destroy(loader);
+
+    /* Eager validation rejects the same buffer */
+    config.lazy_verify = false;
+    loader = sbf_loader_create_with_config(&config);
+    ASSERT(sbf_loader_load_buffer(loader, bad, size, false) == SBF_LOAD_OK);
+    ASSERT(sbf_loader_validate(loader) == SBF_ERR_HASH_MISMATCH);
+    sbf_loader_destroy(loader);
+
+    free(bad);
+    sbf_writer_destroy(writer);
+    return 1;
+}
+
+static int test_sbf_verify_proof(void) {
+    SBF_Writer* writer = build_chunked_binary(7);
+    ASSERT(writer != NULL);
+
+    size_t size;
+    const uint8_t* data = (const uint8_t*)sbf_writer_get_binary(writer, &size);
+    const SBF_Header* hdr = sbf_writer_get_header(writer);
+
+    SBF_Loader_Config config = {
+        .verify_content_hash = true,
+        .verify_proof_root = true,
+        .lazy_verify = true,
+    };
+    SBF_Loader* loader = sbf_loader_create_with_config(&config);
+    ASSERT(sbf_loader_load_buffer(loader, data, size, false) == SBF_LOAD_OK);
+    ASSERT(loader->proof_tree != NULL);
+    ASSERT(sbf_loader_validate(loader) == SBF_VALID);
+    for (size_t i = 0; i < 7; i++) {
+        ASSERT(sbf_loader_verify_proof(loader, i));
+    }
+    ASSERT(!sbf_loader_verify_proof(loader, 7));
+    sbf_loader_destroy(loader);
+
+    /* A rewritten proof hash fails its own check */
+    uint8_t* bad = (uint8_t*)malloc(size);
+    ASSERT(bad != NULL);
+    memcpy(bad, data, size);
+    size_t entry = hdr->proofs_offset + sizeof(SBF_Proof_Table) + 3 * sizeof(SBF_Proof_Entry);
+    bad[entry + offsetof(SBF_Proof_Entry, hash)] ^= 0x01;
+
+    loader = sbf_loader_create_with_config(&config);
+    ASSERT(sbf_loader_load_buffer(loader, bad, size, false) == SBF_LOAD_OK);
+    ASSERT(!sbf_loader_verify_proof(loader, 3));
+    ASSERT(sbf_loader_get_proof(loader, 3) == NULL);
+    sbf_loader_destroy(loader);
+
+    free(bad);
+    sbf_writer_destroy(writer);
+    return 1;
+}
+
 /*============================================================================
  * Main
  *============================================================================*/
@@ -485,6 +802,9 @@ int main(void) {
     TEST(sha256_abc);
     TEST(sha256_incremental);
     TEST(sha256_merkle);
+    TEST(sha256_merkle_path);
+    TEST(sha256_impls);
+    TEST(sha256_multi);
     TEST(sha256_hex);
 
     printf("\nSBF Structure Tests:\n");
@@ -510,6 +830,10 @@ int main(void) {
     TEST(sbf_roundtrip);
     TEST(sbf_validation);
     TEST(sbf_dump);
+    TEST(sbf_chunk_table);
+    TEST(sbf_mapped_file);
+    TEST(sbf_lazy_verify);
+    TEST(sbf_verify_proof);
 
     printf("\n=== Results: %d/%d tests passed ===\n", tests_passed, tests_run);
 
@@ -6,6 +6,7 @@
 #include "seraph/semantic_byte.h"
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 static int tests_run = 0;
 static int tests_passed = 0;
@@ -344,6 +345,66 @@ TEST(sbyte_shifts) {
     ASSERT(seraph_sbyte_is_void(result));
 }
 
+/*============================================================================
+ * SIMD Kernel Tests
+ *============================================================================*/
+
+#define SBYTE_DIFF_MAX 200
+
+typedef struct {
+    Seraph_SemanticByte and_r[SBYTE_DIFF_MAX];
+    Seraph_SemanticByte or_r[SBYTE_DIFF_MAX];
+    Seraph_SemanticByte xor_r[SBYTE_DIFF_MAX];
+    Seraph_SemanticByte not_r[SBYTE_DIFF_MAX];
+    uint8_t extracted[SBYTE_DIFF_MAX];
+    uint8_t extracted_short[SBYTE_DIFF_MAX];
+    size_t counts[4];
+} Sbyte_Diff_Result;
+
+static void sbyte_diff_run(const Seraph_SemanticByte* a, const Seraph_SemanticByte* b,
+                           size_t n, Sbyte_Diff_Result* r) {
+    memset(r, 0, sizeof(*r));
+    seraph_sbyte_and_array(a, b, r->and_r, n);
+    seraph_sbyte_or_array(a, b, r->or_r, n);
+    seraph_sbyte_xor_array(a, b, r->xor_r, n);
+    seraph_sbyte_not_array(a, r->not_r, n);
+    r->counts[0] = seraph_sbyte_count_valid(a, n);
+    r->counts[1] = seraph_sbyte_count_void(a, n);
+    r->counts[2] = seraph_sbyte_extract_valid(a, n, r->extracted, SBYTE_DIFF_MAX);
+    r->counts[3] = seraph_sbyte_extract_valid(a, n, r->extracted_short, n / 3 + 1);
+}
+
+TEST(sbyte_simd_matches_scalar) {
+    static Seraph_SemanticByte a[SBYTE_DIFF_MAX];
+    static Seraph_SemanticByte b[SBYTE_DIFF_MAX];
+    static Sbyte_Diff_Result expect;
+    static Sbyte_Diff_Result got;
+    static const Seraph_Vbit_Impl impls[] = { SERAPH_VBIT_IMPL_SSE42, SERAPH_VBIT_IMPL_AVX2 };
+    static const uint8_t masks[4] = { 0xFF, 0x00, 0x0F, 0xFF };
+    uint64_t rng = 0x9E3779B97F4A7C15ull;
+
+    for (size_t n = 0; n <= SBYTE_DIFF_MAX; n += (n < 40 ? 1 : 17)) {
+        for (size_t i = 0; i < n; i++) {
+            rng ^= rng << 13;
+            rng ^= rng >> 7;
+            rng ^= rng << 17;
+            /* Value bits outside the mask are left in on purpose */
+            a[i] = (Seraph_SemanticByte){ masks[rng & 3], (uint8_t)(rng >> 8) };
+            b[i] = (Seraph_SemanticByte){ masks[(rng >> 2) & 3], (uint8_t)(rng >> 16) };
+        }
+
+        ASSERT(seraph_vbit_set_impl(SERAPH_VBIT_IMPL_SCALAR));
+        sbyte_diff_run(a, b, n, &expect);
+
+        for (size_t v = 0; v < sizeof(impls) / sizeof(impls[0]); v++) {
+            if (!seraph_vbit_set_impl(impls[v])) continue;
+            sbyte_diff_run(a, b, n, &got);
+            ASSERT(memcmp(&got, &expect, sizeof(got)) == 0);
+        }
+    }
+    seraph_vbit_set_impl(SERAPH_VBIT_IMPL_AUTO);
+}
+
 /*============================================================================
  * Main Test Runner
  *============================================================================*/
@@ -389,5 +450,8 @@ void run_semantic_byte_tests(void) {
     /* Shifts */
     RUN_TEST(sbyte_shifts);
 
+    /* Array kernels */
+    RUN_TEST(sbyte_simd_matches_scalar);
+
     printf("\nSemantic Byte Tests: %d/%d passed\n", tests_passed, tests_run);
 }
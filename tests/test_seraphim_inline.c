@@ -0,0 +1,398 @@
+/**
+ * @file test_seraphim_inline.c
+ * @brief Test suite for the Celestial IR inliner
+ *
+ * MC28: Celestial IR Optimization Passes - Inliner Tests
+ *
+ * Tests cover:
+ * - Default cost model per optimization level
+ * - Cost computation and candidate filtering
+ * - Single-block and multi-block inlining
+ * - Recursive callees left as calls
+ * - Call-site specialization and clone reuse
+ *
+ * Total: 10 tests
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "seraph/seraphim/celestial_ir.h"
+#include "seraph/seraphim/celestial_inline.h"
+
+static int tests_run = 0;
+static int tests_passed = 0;
+
+#define TEST(name) static int name(void)
+#define ASSERT(cond) do { \
+    if (!(cond)) { \
+        printf("  FAIL: %s (line %d): %s\n", __func__, __LINE__, #cond); \
+        return 0; \
+    } \
+} while(0)
+#define ASSERT_EQ(a, b) ASSERT((a) == (b))
+#define ASSERT_NE(a, b) ASSERT((a) != (b))
+#define ASSERT_TRUE(x) ASSERT((x) != 0)
+#define ASSERT_FALSE(x) ASSERT((x) == 0)
+#define ASSERT_NULL(x) ASSERT((x) == NULL)
+#define ASSERT_NOT_NULL(x) ASSERT((x) != NULL)
+
+#define RUN_TEST(name) do { \
+    tests_run++; \
+    if (name()) { \
+        tests_passed++; \
+        printf("  PASS: %s\n", #name); \
+    } \
+} while(0)
+
+/*============================================================================
+ * Helpers
+ *============================================================================*/
+
+static Seraph_Arena test_arena;
+
+static Celestial_Module* make_module(void) {
+    seraph_arena_create(&test_arena, 1024 * 1024, 0, 0);
+    return celestial_module_create("inline_test", &test_arena);
+}
+
+static void free_module(Celestial_Module* mod) {
+    celestial_module_free(mod);
+    seraph_arena_destroy(&test_arena);
+}
+
+static Celestial_Type* i64_fn_type(Celestial_Module* mod, size_t params) {
+    Celestial_Type* i64 = celestial_type_primitive(mod, CIR_TYPE_I64);
+    Celestial_Type* param_types[4] = { i64, i64, i64, i64 };
+    return celestial_type_function(mod, i64, param_types, params, 0);
+}
+
+static void builder_at(Celestial_Builder* b, Celestial_Module* mod,
+                       Celestial_Function* fn, Celestial_Block* block) {
+    celestial_builder_init(b, mod);
+    b->function = fn;
+    celestial_builder_position(b, block);
+}
+
+/** fn add1(x) { return x + 1; } */
+static Celestial_Function* make_add1(Celestial_Module* mod) {
+    Celestial_Function* fn = celestial_function_create(mod, "add1", i64_fn_type(mod, 1));
+    Celestial_Builder b;
+    builder_at(&b, mod, fn, celestial_block_create(fn, "entry"));
+    Celestial_Value* sum = celestial_build_add(&b, fn->params[0],
+                                               celestial_const_i64(mod, 1), "sum");
+    celestial_build_return(&b, sum);
+    return fn;
+}
+
+/** fn clamp(x, lo, hi) with two early returns */
+static Celestial_Function* make_clamp(Celestial_Module* mod) {
+    Celestial_Function* fn = celestial_function_create(mod, "clamp", i64_fn_type(mod, 3));
+    Celestial_Block* entry = celestial_block_create(fn, "entry");
+    Celestial_Block* below = celestial_block_create(fn, "below");
+    Celestial_Block* check_hi = celestial_block_create(fn, "check_hi");
+    Celestial_Block* above = celestial_block_create(fn, "above");
+    Celestial_Block* inside = celestial_block_create(fn, "inside");
+    Celestial_Builder b;
+
+    builder_at(&b, mod, fn, entry);
+    Celestial_Value* lt = celestial_build_lt(&b, fn->params[0], fn->params[1], "lt");
+    celestial_build_branch(&b, lt, below, check_hi);
+
+    celestial_builder_position(&b, below);
+    celestial_build_return(&b, fn->params[1]);
+
+    celestial_builder_position(&b, check_hi);
+    Celestial_Value* gt = celestial_build_gt(&b, fn->params[0], fn->params[2], "gt");
+    celestial_build_branch(&b, gt, above, inside);
+
+    celestial_builder_position(&b, above);
+    celestial_build_return(&b, fn->params[2]);
+
+    celestial_builder_position(&b, inside);
+    celestial_build_return(&b, fn->params[0]);
+    return fn;
+}
+
+/** A straight-line callee too large to inline at -O2 */
+static Celestial_Function* make_big(Celestial_Module* mod) {
+    Celestial_Function* fn = celestial_function_create(mod, "big", i64_fn_type(mod, 2));
+    Celestial_Builder b;
+    builder_at(&b, mod, fn, celestial_block_create(fn, "entry"));
+    Celestial_Value* acc = fn->params[0];
+    for (int i = 0; i < 20; i++) {
+        acc = celestial_build_mul(&b, acc, fn->params[1], "m");
+        acc = celestial_build_xor(&b, acc, celestial_const_i64(mod, i), "x");
+    }
+    celestial_build_return(&b, acc);
+    return fn;
+}
+
+/** fn name() { return callee(args...); } */
+static Celestial_Function* make_caller(Celestial_Module* mod, const char* name,
+                                       Celestial_Function* callee,
+                                       int64_t* args, size_t count) {
+    Celestial_Function* fn = celestial_function_create(mod, name, i64_fn_type(mod, 0));
+    Celestial_Builder b;
+    builder_at(&b, mod, fn, celestial_block_create(fn, "entry"));
+    Celestial_Value* values[4];
+    for (size_t i = 0; i < count; i++) {
+        values[i] = celestial_const_i64(mod, args[i]);
+    }
+    Celestial_Value* r = celestial_build_call(&b, callee, values, count, "r");
+    celestial_build_return(&b, r);
+    return fn;
+}
+
+static int count_calls(Celestial_Function* fn) {
+    int calls = 0;
+    for (Celestial_Block* block = fn->blocks; block; block = block->next) {
+        for (Celestial_Instr* instr = block->first; instr; instr = instr->next) {
+            if (instr->opcode == CIR_CALL) calls++;
+        }
+    }
+    return calls;
+}
+
+static Celestial_Instr* first_call(Celestial_Function* fn) {
+    for (Celestial_Block* block = fn->blocks; block; block = block->next) {
+        for (Celestial_Instr* instr = block->first; instr; instr = instr->next) {
+            if (instr->opcode == CIR_CALL) return instr;
+        }
+    }
+    return NULL;
+}
+
+/*============================================================================
+ * Options and Cost Tests
+ *============================================================================*/
+
+TEST(test_inline_default_options) {
+    Celestial_Inline_Options o0, o2, o3;
+    celestial_inline_default_options(&o0, 0);
+    celestial_inline_default_options(&o2, 2);
+    celestial_inline_default_options(&o3, 3);
+
+    ASSERT_EQ(o0.inline_threshold, 0);
+    ASSERT_FALSE(o0.specialize);
+    ASSERT_TRUE(o2.inline_threshold > 0);
+    ASSERT_TRUE(o2.specialize);
+    ASSERT_TRUE(o3.inline_threshold > o2.inline_threshold);
+    return 1;
+}
+
+TEST(test_inline_cost) {
+    Celestial_Module* mod = make_module();
+    Celestial_Function* add1 = make_add1(mod);
+    Celestial_Function* clamp = make_clamp(mod);
+
+    ASSERT_EQ(celestial_inline_cost(add1), 2);
+    ASSERT_EQ(celestial_inline_cost(clamp), 7);
+    ASSERT_EQ(celestial_inline_cost(NULL), UINT32_MAX);
+
+    free_module(mod);
+    return 1;
+}
+
+TEST(test_inline_noop_cases) {
+    Celestial_Module* mod = make_module();
+    Celestial_Function* add1 = make_add1(mod);
+    int64_t args[1] = { 41 };
+    Celestial_Function* caller = make_caller(mod, "main", add1, args, 1);
+
+    Celestial_Inline_Options o0;
+    celestial_inline_default_options(&o0, 0);
+    ASSERT_EQ(celestial_inline_module(mod, &o0, NULL), 0);
+    ASSERT_EQ(count_calls(caller), 1);
+    ASSERT_EQ(celestial_inline_module(NULL, NULL, NULL), 0);
+
+    free_module(mod);
+    return 1;
+}
+
+/*============================================================================
+ * Inlining Tests
+ *============================================================================*/
+
+TEST(test_inline_straight) {
+    Celestial_Module* mod = make_module();
+    Celestial_Function* add1 = make_add1(mod);
+    int64_t args[1] = { 41 };
+    Celestial_Function* caller = make_caller(mod, "main", add1, args, 1);
+
+    Celestial_Inline_Stats stats;
+    ASSERT_EQ(celestial_inline_module(mod, NULL, &stats), 1);
+    ASSERT_EQ(stats.calls_inlined, 1);
+    ASSERT_EQ(count_calls(caller), 0);
+    ASSERT_TRUE(seraph_vbit_is_true(celestial_verify_function(caller)));
+
+    /* The substituted constant folds through the copied body */
+    celestial_fold_constants(mod);
+    Celestial_Instr* ret = caller->blocks->last;
+    ASSERT_EQ(ret->opcode, CIR_RETURN);
+    ASSERT_EQ(ret->operands[0]->kind, CIR_VALUE_CONST);
+    ASSERT_EQ(ret->operands[0]->constant.i64, 42);
+
+    free_module(mod);
+    return 1;
+}
+
+TEST(test_inline_multi_block) {
+    Celestial_Module* mod = make_module();
+    Celestial_Function* clamp = make_clamp(mod);
+    int64_t args[3] = { 5, 10, 20 };
+    Celestial_Function* caller = make_caller(mod, "main", clamp, args, 3);
+
+    Celestial_Inline_Stats stats;
+    ASSERT_EQ(celestial_inline_module(mod, NULL, &stats), 1);
+    ASSERT_EQ(stats.calls_inlined, 1);
+    ASSERT_EQ(count_calls(caller), 0);
+
+    /* Split block + 5 callee blocks + continuation */
+    size_t blocks = 0;
+    for (Celestial_Block* block = caller->blocks; block; block = block->next) blocks++;
+    ASSERT_EQ(blocks, 7);
+    ASSERT_TRUE(seraph_vbit_is_true(celestial_verify_function(caller)));
+
+    free_module(mod);
+    return 1;
+}
+
+TEST(test_inline_nested_bottom_up) {
+    Celestial_Module* mod = make_module();
+    Celestial_Function* add1 = make_add1(mod);
+
+    /* add2(x) = add1(add1(x)) */
+    Celestial_Function* add2 = celestial_function_create(mod, "add2", i64_fn_type(mod, 1));
+    Celestial_Builder b;
+    builder_at(&b, mod, add2, celestial_block_create(add2, "entry"));
+    Celestial_Value* a = celestial_build_call(&b, add1, &add2->params[0], 1, "a");
+    Celestial_Value* r = celestial_build_call(&b, add1, &a, 1, "r");
+    celestial_build_return(&b, r);
+
+    int64_t args[1] = { 40 };
+    Celestial_Function* caller = make_caller(mod, "main", add2, args, 1);
+
+    ASSERT_EQ(celestial_inline_module(mod, NULL, NULL), 3);
+    ASSERT_EQ(count_calls(add2), 0);
+    ASSERT_EQ(count_calls(caller), 0);
+
+    celestial_fold_constants(mod);
+    Celestial_Instr* ret = caller->blocks->last;
+    ASSERT_EQ(ret->operands[0]->kind, CIR_VALUE_CONST);
+    ASSERT_EQ(ret->operands[0]->constant.i64, 42);
+
+    free_module(mod);
+    return 1;
+}
+
+TEST(test_inline_recursive_skipped) {
+    Celestial_Module* mod = make_module();
+
+    /* fn self(x) { return self(x); } */
+    Celestial_Function* self = celestial_function_create(mod, "self", i64_fn_type(mod, 1));
+    Celestial_Builder b;
+    builder_at(&b, mod, self, celestial_block_create(self, "entry"));
+    Celestial_Value* r = celestial_build_call(&b, self, &self->params[0], 1, "r");
+    celestial_build_return(&b, r);
+
+    int64_t args[1] = { 1 };
+    Celestial_Function* caller = make_caller(mod, "main", self, args, 1);
+
+    Celestial_Inline_Stats stats;
+    celestial_inline_module(mod, NULL, &stats);
+    ASSERT_EQ(stats.calls_inlined, 0);
+    ASSERT_EQ(first_call(caller)->callee, self);
+
+    free_module(mod);
+    return 1;
+}
+
+TEST(test_inline_value_budget) {
+    Celestial_Module* mod = make_module();
+    Celestial_Function* add1 = make_add1(mod);
+    int64_t args[1] = { 1 };
+    Celestial_Function* caller = make_caller(mod, "main", add1, args, 1);
+
+    Celestial_Inline_Options opts;
+    celestial_inline_default_options(&opts, 2);
+    opts.max_caller_values = 1;
+    opts.specialize = 0;
+
+    ASSERT_EQ(celestial_inline_module(mod, &opts, NULL), 0);
+    ASSERT_EQ(count_calls(caller), 1);
+
+    free_module(mod);
+    return 1;
+}
+
+/*============================================================================
+ * Specialization Tests
+ *============================================================================*/
+
+TEST(test_specialize_constant_args) {
+    Celestial_Module* mod = make_module();
+    Celestial_Function* big = make_big(mod);
+    int64_t args_a[2] = { 1, 3 };
+    int64_t args_b[2] = { 2, 3 };
+    Celestial_Function* f = make_caller(mod, "f", big, args_a, 2);
+    Celestial_Function* g = make_caller(mod, "g", big, args_b, 2);
+
+    Celestial_Inline_Stats stats;
+    ASSERT_EQ(celestial_inline_module(mod, NULL, &stats), 2);
+    ASSERT_EQ(stats.calls_inlined, 0);
+    ASSERT_EQ(stats.calls_specialized, 2);
+    ASSERT_EQ(stats.specializations, 2);
+
+    Celestial_Function* clone = first_call(f)->callee;
+    ASSERT_NE(clone, big);
+    ASSERT_NE(first_call(g)->callee, clone);
+    ASSERT_TRUE(clone->name_len > 4);
+    ASSERT_EQ(strncmp(clone->name, "big.spec", 8), 0);
+    ASSERT_TRUE(seraph_vbit_is_true(celestial_verify_function(clone)));
+
+    free_module(mod);
+    return 1;
+}
+
+TEST(test_specialize_reuses_clone) {
+    Celestial_Module* mod = make_module();
+    Celestial_Function* big = make_big(mod);
+    int64_t args[2] = { 7, 3 };
+    Celestial_Function* f = make_caller(mod, "f", big, args, 2);
+    Celestial_Function* g = make_caller(mod, "g", big, args, 2);
+
+    Celestial_Inline_Stats stats;
+    celestial_inline_module(mod, NULL, &stats);
+    ASSERT_EQ(stats.calls_specialized, 2);
+    ASSERT_EQ(stats.specializations, 1);
+    ASSERT_EQ(first_call(f)->callee, first_call(g)->callee);
+
+    free_module(mod);
+    return 1;
+}
+
+/*============================================================================
+ * Test Runner
+ *============================================================================*/
+
+void run_seraphim_inline_tests(void) {
+    printf("\n=== MC28: Seraphim Inliner Tests ===\n");
+
+    printf("\nCost Model:\n");
+    RUN_TEST(test_inline_default_options);
+    RUN_TEST(test_inline_cost);
+    RUN_TEST(test_inline_noop_cases);
+
+    printf("\nInlining:\n");
+    RUN_TEST(test_inline_straight);
+    RUN_TEST(test_inline_multi_block);
+    RUN_TEST(test_inline_nested_bottom_up);
+    RUN_TEST(test_inline_recursive_skipped);
+    RUN_TEST(test_inline_value_budget);
+
+    printf("\nSpecialization:\n");
+    RUN_TEST(test_specialize_constant_args);
+    RUN_TEST(test_specialize_reuses_clone);
+
+    printf("\nSeraphim Inliner: %d/%d tests passed\n", tests_passed, tests_run);
+}
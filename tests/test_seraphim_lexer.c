@@ -190,6 +190,54 @@ TEST(keywords_effects) {
     teardown();
 }
 
+TEST(keyword_lookup_all) {
+    static const struct { const char* name; Seraph_Token_Type type; } expected[] = {
+        {"fn", SERAPH_TOK_FN}, {"let", SERAPH_TOK_LET}, {"mut", SERAPH_TOK_MUT},
+        {"if", SERAPH_TOK_IF}, {"else", SERAPH_TOK_ELSE}, {"for", SERAPH_TOK_FOR},
+        {"while", SERAPH_TOK_WHILE}, {"return", SERAPH_TOK_RETURN},
+        {"match", SERAPH_TOK_MATCH}, {"in", SERAPH_TOK_IN},
+        {"break", SERAPH_TOK_BREAK}, {"continue", SERAPH_TOK_CONTINUE},
+        {"as", SERAPH_TOK_AS}, {"struct", SERAPH_TOK_STRUCT},
+        {"enum", SERAPH_TOK_ENUM}, {"const", SERAPH_TOK_CONST},
+        {"use", SERAPH_TOK_USE}, {"foreign", SERAPH_TOK_FOREIGN},
+        {"type", SERAPH_TOK_TYPE}, {"impl", SERAPH_TOK_IMPL},
+        {"persist", SERAPH_TOK_PERSIST}, {"aether", SERAPH_TOK_AETHER_BLOCK},
+        {"recover", SERAPH_TOK_RECOVER}, {"effects", SERAPH_TOK_EFFECTS},
+        {"pure", SERAPH_TOK_PURE}, {"VOID", SERAPH_TOK_EFFECT_VOID},
+        {"PERSIST", SERAPH_TOK_EFFECT_PERSIST}, {"NETWORK", SERAPH_TOK_EFFECT_NETWORK},
+        {"TIMER", SERAPH_TOK_EFFECT_TIMER}, {"IO", SERAPH_TOK_EFFECT_IO},
+        {"u8", SERAPH_TOK_U8}, {"u16", SERAPH_TOK_U16}, {"u32", SERAPH_TOK_U32},
+        {"u64", SERAPH_TOK_U64}, {"i8", SERAPH_TOK_I8}, {"i16", SERAPH_TOK_I16},
+        {"i32", SERAPH_TOK_I32}, {"i64", SERAPH_TOK_I64}, {"bool", SERAPH_TOK_BOOL},
+        {"char", SERAPH_TOK_CHAR}, {"f32", SERAPH_TOK_F32}, {"f64", SERAPH_TOK_F64},
+        {"scalar", SERAPH_TOK_SCALAR}, {"dual", SERAPH_TOK_DUAL},
+        {"galactic", SERAPH_TOK_GALACTIC}, {"volatile", SERAPH_TOK_VOLATILE},
+        {"atlas", SERAPH_TOK_ATLAS}, {"true", SERAPH_TOK_TRUE},
+        {"false", SERAPH_TOK_FALSE}, {"void", SERAPH_TOK_VOID_LIT},
+        {"null", SERAPH_TOK_VOID_LIT},
+    };
+    for (size_t i = 0; i < sizeof(expected) / sizeof(expected[0]); i++) {
+        const char* name = expected[i].name;
+        ASSERT_EQ(seraph_lexer_lookup_keyword(name, strlen(name)), expected[i].type);
+    }
+
+    /* Prefixes, extensions and case variants are identifiers */
+    static const char* idents[] = {
+        "f", "fnn", "le", "lets", "u128", "i", "Fn", "void_", "continues",
+        "nul", "galacti", "x", "foo", "IOx", "Void", "atlass", "tru",
+    };
+    for (size_t i = 0; i < sizeof(idents) / sizeof(idents[0]); i++) {
+        ASSERT_EQ(seraph_lexer_lookup_keyword(idents[i], strlen(idents[i])), SERAPH_TOK_IDENT);
+    }
+
+    /* Longer identifiers hashing to a shorter keyword's slot */
+    ASSERT_EQ(seraph_lexer_lookup_keyword("aaxj", 4), SERAPH_TOK_IDENT);
+    ASSERT_EQ(seraph_lexer_lookup_keyword("abxr", 4), SERAPH_TOK_IDENT);
+
+    /* Length is honoured: "fnord" truncated to 2 bytes is "fn" */
+    ASSERT_EQ(seraph_lexer_lookup_keyword("fnord", 2), SERAPH_TOK_FN);
+}
+
 /*============================================================================
  * Literal Tests
  *============================================================================*/
@@ -535,6 +583,7 @@ void run_seraphim_lexer_tests(void) {
     RUN_TEST(keywords_numeric_types);
     RUN_TEST(keywords_substrate);
     RUN_TEST(keywords_effects);
+    RUN_TEST(keyword_lookup_all);
 
     printf("\nLiterals:\n");
     RUN_TEST(integer_literals);
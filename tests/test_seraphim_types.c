@@ -927,6 +927,81 @@ TEST(test_symbol_not_found) {
     return 1;
 }
 
+TEST(test_symbol_intern) {
+    Seraph_Arena arena;
+    ASSERT_TRUE(seraph_arena_create(&arena, 64 * 1024, 0, 0) == SERAPH_VBIT_TRUE);
+
+    Seraph_Type_Context ctx;
+    ASSERT_TRUE(seraph_type_context_init(&ctx, &arena) == SERAPH_VBIT_TRUE);
+
+    /* Slices of a larger buffer intern to the same NUL-terminated copy */
+    const char* source = "count counter count";
+    const char* a = seraph_type_intern(&ctx, source, 5);
+    const char* b = seraph_type_intern(&ctx, source + 14, 5);
+    const char* c = seraph_type_intern(&ctx, source + 6, 7);
+    ASSERT_NOT_NULL(a);
+    ASSERT_EQ(a, b);
+    ASSERT_TRUE(a != c);
+    ASSERT_EQ(strcmp(a, "count"), 0);
+    ASSERT_EQ(strcmp(c, "counter"), 0);
+
+    /* Defined symbols carry the interned name */
+    Seraph_Type* i32 = seraph_type_prim(&arena, SERAPH_TYPE_I32);
+    seraph_type_define(&ctx, source + 6, 7, i32, NULL, 0);
+    Seraph_Symbol* sym = seraph_type_lookup(&ctx, "counter", 7);
+    ASSERT_NOT_NULL(sym);
+    ASSERT_EQ(sym->name, c);
+
+    seraph_arena_destroy(&arena);
+    return 1;
+}
+
+TEST(test_symbol_many) {
+    Seraph_Arena arena;
+    ASSERT_TRUE(seraph_arena_create(&arena, 1024 * 1024, 0, 0) == SERAPH_VBIT_TRUE);
+
+    Seraph_Type_Context ctx;
+    ASSERT_TRUE(seraph_type_context_init(&ctx, &arena) == SERAPH_VBIT_TRUE);
+
+    Seraph_Type* i32 = seraph_type_prim(&arena, SERAPH_TYPE_I32);
+    Seraph_Type* bool_t = seraph_type_prim(&arena, SERAPH_TYPE_BOOL);
+    char name[16];
+
+    /* Enough globals to grow both the intern table and the scope table */
+    for (int i = 0; i < 1000; i++) {
+        int len = snprintf(name, sizeof(name), "g%d", i);
+        ASSERT_TRUE(seraph_type_define(&ctx, name, (size_t)len, i32, NULL, 0) == SERAPH_VBIT_TRUE);
+    }
+
+    /* Inner scope shadows every tenth name, and redefines one twice */
+    seraph_type_push_scope(&ctx);
+    for (int i = 0; i < 1000; i += 10) {
+        int len = snprintf(name, sizeof(name), "g%d", i);
+        seraph_type_define(&ctx, name, (size_t)len, bool_t, NULL, 0);
+    }
+    seraph_type_define(&ctx, "g10", 3, i32, NULL, 1);
+
+    for (int i = 0; i < 1000; i++) {
+        int len = snprintf(name, sizeof(name), "g%d", i);
+        Seraph_Symbol* sym = seraph_type_lookup(&ctx, name, (size_t)len);
+        ASSERT_NOT_NULL(sym);
+        if (i == 10) {
+            ASSERT_EQ(sym->type, i32);
+            ASSERT_TRUE(sym->is_mut);
+        } else {
+            ASSERT_EQ(sym->type, (i % 10 == 0) ? bool_t : i32);
+        }
+    }
+    ASSERT_NULL(seraph_type_lookup(&ctx, "g1000", 5));
+
+    seraph_type_pop_scope(&ctx);
+    ASSERT_EQ(seraph_type_lookup(&ctx, "g10", 3)->type, i32);
+    ASSERT_FALSE(seraph_type_lookup(&ctx, "g10", 3)->is_mut);
+
+    seraph_arena_destroy(&arena);
+    return 1;
+}
+
 /*============================================================================
  * Type Printing Tests
  *============================================================================*/
@@ -1107,6 +1182,8 @@ void run_seraphim_types_tests(void) {
     RUN_TEST(test_symbol_define_lookup);
     RUN_TEST(test_symbol_shadowing);
     RUN_TEST(test_symbol_not_found);
+    RUN_TEST(test_symbol_intern);
+    RUN_TEST(test_symbol_many);
 
     /* Type Printing Tests */
     printf("\nType Printing Tests:\n");
@@ -0,0 +1,588 @@
+/**
+ * @file test_seraphim_x64.c
+ * @brief Test suite for x86-64 instruction selection
+ *
+ * MC29: Celestial IR to x86-64 Backend - Peephole Selection Tests
+ *
+ * Each test builds a small function by hand, compiles it with
+ * celestial_compile_function() and, on x86-64 POSIX hosts, runs the
+ * machine code to check the cheaper instruction forms keep the semantics
+ * of the generic ones:
+ * - Compare-and-branch fusion (no SETcc materialization)
+ * - Fall-through for jumps to the next block
+ * - Immediate forms for ADD/SUB/MUL/AND/OR/XOR/CMP
+ * - Direct frame addressing for ALLOCA loads and stores
+ *
+ * Parallel module compilation must produce exactly the serial output, and
+ * so must a rebuild that takes functions from the incremental cache.
+ *
+ * Total: 11 tests
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "seraph/seraphim/celestial_ir.h"
+#include "seraph/seraphim/celestial_to_x64.h"
+#include "seraph/seraphim/celestial_to_arm64.h"
+
+#if defined(__x86_64__) && !defined(_WIN32)
+#include <sys/mman.h>
+#include <dirent.h>
+#include <unistd.h>
+#define X64_TEST_CAN_EXECUTE 1
+#else
+#define X64_TEST_CAN_EXECUTE 0
+#endif
+
+static int tests_run = 0;
+static int tests_passed = 0;
+
+#define TEST(name) static int name(void)
+#define ASSERT(cond) do { \
+    if (!(cond)) { \
+        printf("  FAIL: %s (line %d): %s\n", __func__, __LINE__, #cond); \
+        return 0; \
+    } \
+} while(0)
+#define ASSERT_EQ(a, b) ASSERT((a) == (b))
+#define ASSERT_NE(a, b) ASSERT((a) != (b))
+#define ASSERT_TRUE(x) ASSERT((x) != 0)
+#define ASSERT_FALSE(x) ASSERT((x) == 0)
+#define ASSERT_NULL(x) ASSERT((x) == NULL)
+#define ASSERT_NOT_NULL(x) ASSERT((x) != NULL)
+
+#define RUN_TEST(name) do { \
+    tests_run++; \
+    if (name()) { \
+        tests_passed++; \
+        printf("  PASS: %s\n", #name); \
+    } \
+} while(0)
+
+/*============================================================================
+ * Helpers
+ *============================================================================*/
+
+typedef int64_t (*X64_Test_Fn)(int64_t, int64_t);
+
+static Seraph_Arena test_arena;
+static X64_Buffer   test_code;
+static void*        test_exec = NULL;
+static size_t       test_exec_size = 0;
+
+static Celestial_Module* make_module_sized(size_t arena_size) {
+    seraph_arena_create(&test_arena, arena_size, 0, 0);
+    return celestial_module_create("x64_test", &test_arena);
+}
+
+static Celestial_Module* make_module(void) {
+    return make_module_sized(4 * 1024 * 1024);
+}
+
+static void free_module(Celestial_Module* mod) {
+    celestial_module_free(mod);
+    x64_buf_free(&test_code);
+#if X64_TEST_CAN_EXECUTE
+    if (test_exec != NULL) munmap(test_exec, test_exec_size);
+#endif
+    test_exec = NULL;
+    seraph_arena_destroy(&test_arena);
+}
+
+static Celestial_Type* i64_type(Celestial_Module* mod) {
+    return celestial_type_primitive(mod, CIR_TYPE_I64);
+}
+
+static Celestial_Function* make_fn(Celestial_Module* mod, Celestial_Builder* b) {
+    Celestial_Type* params[2] = { i64_type(mod), i64_type(mod) };
+    Celestial_Type* type = celestial_type_function(mod, i64_type(mod), params, 2, 0);
+    Celestial_Function* fn = celestial_function_create(mod, "f", type);
+    celestial_builder_init(b, mod);
+    b->function = fn;
+    celestial_builder_position(b, celestial_block_create(fn, "entry"));
+    return fn;
+}
+
+static Celestial_Value* i64c(Celestial_Module* mod, int64_t v) {
+    return celestial_const_i64(mod, v);
+}
+
+/** Compile fn into test_code; returns NULL-safe callable or NULL */
+static X64_Test_Fn compile(Celestial_Module* mod, Celestial_Function* fn) {
+    X64_Labels labels;
+    if (!seraph_vbit_is_true(x64_buf_init(&test_code, 4096))) return NULL;
+    if (!seraph_vbit_is_true(x64_labels_init(&labels))) return NULL;
+
+    Seraph_Vbit ok = celestial_compile_function(fn, mod, &test_code, &labels,
+                                                &test_arena, NULL);
+    x64_labels_free(&labels);
+    if (!seraph_vbit_is_true(ok)) return NULL;
+
+#if X64_TEST_CAN_EXECUTE
+    test_exec_size = (test_code.size + 4095) & ~(size_t)4095;
+    test_exec = mmap(NULL, test_exec_size, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (test_exec == MAP_FAILED) {
+        test_exec = NULL;
+        return NULL;
+    }
+    memcpy(test_exec, test_code.code, test_code.size);
+    if (mprotect(test_exec, test_exec_size, PROT_READ | PROT_EXEC) != 0) return NULL;
+    return (X64_Test_Fn)test_exec;
+#else
+    return NULL;
+#endif
+}
+
+/** Count SETcc opcodes (0F 90..9F) in the generated code */
+static int count_setcc(void) {
+    int n = 0;
+    for (size_t i = 0; i + 1 < test_code.size; i++) {
+        if (test_code.code[i] == 0x0F && (test_code.code[i + 1] & 0xF0) == 0x90) n++;
+    }
+    return n;
+}
+
+#define VOID64 ((int64_t)SERAPH_X64_VOID_VALUE)
+
+/*============================================================================
+ * Branch Tests
+ *============================================================================*/
+
+/** f(x) = x < 10 ? 1 : 2 */
+TEST(test_x64_branch_fused) {
+    Celestial_Module* mod = make_module();
+    Celestial_Builder b;
+    Celestial_Function* fn = make_fn(mod, &b);
+    Celestial_Block* then_b = celestial_block_create(fn, "then");
+    Celestial_Block* else_b = celestial_block_create(fn, "else");
+
+    Celestial_Value* lt = celestial_build_lt(&b, fn->params[0], i64c(mod, 10), "lt");
+    celestial_build_branch(&b, lt, then_b, else_b);
+    celestial_builder_position(&b, then_b);
+    celestial_build_return(&b, i64c(mod, 1));
+    celestial_builder_position(&b, else_b);
+    celestial_build_return(&b, i64c(mod, 2));
+
+    X64_Test_Fn f = compile(mod, fn);
+    ASSERT_TRUE(test_code.size > 0);
+    ASSERT_EQ(count_setcc(), 0);
+    if (X64_TEST_CAN_EXECUTE) {
+        ASSERT_NOT_NULL(f);
+        ASSERT_EQ(f(3, 0), 1);
+        ASSERT_EQ(f(10, 0), 2);
+        ASSERT_EQ(f(VOID64, 0), 2);  /* VOID condition takes the else edge */
+    }
+
+    free_module(mod);
+    return 1;
+}
+
+/** The comparison result is also returned, so it must be materialized */
+TEST(test_x64_branch_unfused) {
+    Celestial_Module* mod = make_module();
+    Celestial_Builder b;
+    Celestial_Function* fn = make_fn(mod, &b);
+    Celestial_Block* then_b = celestial_block_create(fn, "then");
+    Celestial_Block* else_b = celestial_block_create(fn, "else");
+
+    Celestial_Value* eq = celestial_build_eq(&b, fn->params[0], fn->params[1], "eq");
+    celestial_build_branch(&b, eq, then_b, else_b);
+    celestial_builder_position(&b, then_b);
+    celestial_build_return(&b, eq);
+    celestial_builder_position(&b, else_b);
+    celestial_build_return(&b, i64c(mod, 7));
+
+    X64_Test_Fn f = compile(mod, fn);
+    ASSERT_EQ(count_setcc(), 1);
+    if (X64_TEST_CAN_EXECUTE) {
+        ASSERT_NOT_NULL(f);
+        ASSERT_EQ(f(5, 5), 1);
+        ASSERT_EQ(f(5, 6), 7);
+    }
+
+    free_module(mod);
+    return 1;
+}
+
+/** entry jumps to the block laid out right after it */
+TEST(test_x64_jump_fallthrough) {
+    Celestial_Module* mod = make_module();
+    Celestial_Builder b;
+    Celestial_Function* fn = make_fn(mod, &b);
+    Celestial_Block* next = celestial_block_create(fn, "next");
+
+    celestial_build_jump(&b, next);
+    celestial_builder_position(&b, next);
+    celestial_build_return(&b, fn->params[1]);
+
+    X64_Test_Fn f = compile(mod, fn);
+    for (size_t i = 0; i < test_code.size; i++) {
+        ASSERT_NE(test_code.code[i], 0xE9);  /* no JMP rel32 */
+    }
+    if (X64_TEST_CAN_EXECUTE) {
+        ASSERT_NOT_NULL(f);
+        ASSERT_EQ(f(1, 99), 99);
+    }
+
+    free_module(mod);
+    return 1;
+}
+
+/*============================================================================
+ * Immediate Form Tests
+ *============================================================================*/
+
+/** f(x) = 3 * (x + 5) - 2 */
+TEST(test_x64_arith_imm) {
+    Celestial_Module* mod = make_module();
+    Celestial_Builder b;
+    Celestial_Function* fn = make_fn(mod, &b);
+
+    Celestial_Value* sum = celestial_build_add(&b, fn->params[0], i64c(mod, 5), "sum");
+    Celestial_Value* prod = celestial_build_mul(&b, i64c(mod, 3), sum, "prod");
+    Celestial_Value* diff = celestial_build_sub(&b, prod, i64c(mod, 2), "diff");
+    celestial_build_return(&b, diff);
+
+    X64_Test_Fn f = compile(mod, fn);
+    ASSERT_TRUE(test_code.size > 0);
+    if (X64_TEST_CAN_EXECUTE) {
+        ASSERT_NOT_NULL(f);
+        ASSERT_EQ(f(9, 0), 40);
+        ASSERT_EQ(f(VOID64, 0), VOID64);
+        ASSERT_EQ(f(INT64_MAX - 2, 0), VOID64);  /* overflow still VOIDs */
+    }
+
+    free_module(mod);
+    return 1;
+}
+
+/** f(x) = ((x & -256) | 15) ^ 3 */
+TEST(test_x64_bitwise_imm) {
+    Celestial_Module* mod = make_module();
+    Celestial_Builder b;
+    Celestial_Function* fn = make_fn(mod, &b);
+
+    Celestial_Value* a = celestial_build_and(&b, fn->params[0], i64c(mod, -256), "a");
+    Celestial_Value* o = celestial_build_or(&b, a, i64c(mod, 15), "o");
+    Celestial_Value* x = celestial_build_xor(&b, o, i64c(mod, 3), "x");
+    celestial_build_return(&b, x);
+
+    X64_Test_Fn f = compile(mod, fn);
+    ASSERT_TRUE(test_code.size > 0);
+    if (X64_TEST_CAN_EXECUTE) {
+        ASSERT_NOT_NULL(f);
+        ASSERT_EQ(f(0x1234, 0), ((0x1234 & -256) | 15) ^ 3);
+        ASSERT_EQ(f(-1, 0), ((-1 & -256) | 15) ^ 3);
+    }
+
+    free_module(mod);
+    return 1;
+}
+
+/** Negative constants keep the register form (and its VOID check) */
+TEST(test_x64_negative_const) {
+    Celestial_Module* mod = make_module();
+    Celestial_Builder b;
+    Celestial_Function* fn = make_fn(mod, &b);
+
+    Celestial_Value* sum = celestial_build_add(&b, fn->params[0], i64c(mod, -1), "sum");
+    celestial_build_return(&b, sum);
+
+    X64_Test_Fn f = compile(mod, fn);
+    ASSERT_TRUE(test_code.size > 0);
+    if (X64_TEST_CAN_EXECUTE) {
+        ASSERT_NOT_NULL(f);
+        ASSERT_EQ(f(10, 0), VOID64);
+    }
+
+    free_module(mod);
+    return 1;
+}
+
+/*============================================================================
+ * Memory Tests
+ *============================================================================*/
+
+/** let a = x; let b = a + y; return b */
+TEST(test_x64_alloca_direct) {
+    Celestial_Module* mod = make_module();
+    Celestial_Builder b;
+    Celestial_Function* fn = make_fn(mod, &b);
+
+    Celestial_Value* slot_a = celestial_build_alloca(&b, i64_type(mod), "a");
+    celestial_build_store(&b, slot_a, fn->params[0]);
+    Celestial_Value* slot_b = celestial_build_alloca(&b, i64_type(mod), "b");
+    Celestial_Value* a = celestial_build_load(&b, slot_a, i64_type(mod), "a.val");
+    Celestial_Value* sum = celestial_build_add(&b, a, fn->params[1], "sum");
+    celestial_build_store(&b, slot_b, sum);
+    Celestial_Value* r = celestial_build_load(&b, slot_b, i64_type(mod), "b.val");
+    celestial_build_return(&b, r);
+
+    X64_Test_Fn f = compile(mod, fn);
+    ASSERT_TRUE(test_code.size > 0);
+    if (X64_TEST_CAN_EXECUTE) {
+        ASSERT_NOT_NULL(f);
+        ASSERT_EQ(f(40, 2), 42);
+    }
+
+    free_module(mod);
+    return 1;
+}
+
+/** Loop: sum of 0..n-1 through an alloca'd accumulator */
+TEST(test_x64_loop) {
+    Celestial_Module* mod = make_module();
+    Celestial_Builder b;
+    Celestial_Function* fn = make_fn(mod, &b);
+    Celestial_Block* head = celestial_block_create(fn, "head");
+    Celestial_Block* body = celestial_block_create(fn, "body");
+    Celestial_Block* exit = celestial_block_create(fn, "exit");
+
+    Celestial_Value* acc = celestial_build_alloca(&b, i64_type(mod), "acc");
+    Celestial_Value* i = celestial_build_alloca(&b, i64_type(mod), "i");
+    celestial_build_store(&b, acc, i64c(mod, 0));
+    celestial_build_store(&b, i, i64c(mod, 0));
+    celestial_build_jump(&b, head);
+
+    celestial_builder_position(&b, head);
+    Celestial_Value* iv = celestial_build_load(&b, i, i64_type(mod), "iv");
+    Celestial_Value* cond = celestial_build_lt(&b, iv, fn->params[0], "cond");
+    celestial_build_branch(&b, cond, body, exit);
+
+    celestial_builder_position(&b, body);
+    Celestial_Value* av = celestial_build_load(&b, acc, i64_type(mod), "av");
+    Celestial_Value* iv2 = celestial_build_load(&b, i, i64_type(mod), "iv2");
+    celestial_build_store(&b, acc, celestial_build_add(&b, av, iv2, "next_acc"));
+    celestial_build_store(&b, i, celestial_build_add(&b, iv2, i64c(mod, 1), "next_i"));
+    celestial_build_jump(&b, head);
+
+    celestial_builder_position(&b, exit);
+    celestial_build_return(&b, celestial_build_load(&b, acc, i64_type(mod), "result"));
+
+    X64_Test_Fn f = compile(mod, fn);
+    ASSERT_TRUE(test_code.size > 0);
+    ASSERT_EQ(count_setcc(), 0);
+    if (X64_TEST_CAN_EXECUTE) {
+        ASSERT_NOT_NULL(f);
+        ASSERT_EQ(f(0, 0), 0);
+        ASSERT_EQ(f(10, 0), 45);
+        ASSERT_EQ(f(1000, 0), 499500);
+    }
+
+    free_module(mod);
+    return 1;
+}
+
+/*============================================================================
+ * Parallel Compilation Tests
+ *============================================================================*/
+
+#define X64_TEST_CHAIN 200
+
+/** f0(x) = x; fi(x) = f(i-1)(x + i) * 3 for i in 1..N; main() = fN(1) */
+static Celestial_Module* make_chain_module(void) {
+    /* The serial path keeps every function's allocator state alive */
+    Celestial_Module* mod = make_module_sized(96 * 1024 * 1024);
+    Celestial_Type* params[1] = { i64_type(mod) };
+    Celestial_Type* unary = celestial_type_function(mod, i64_type(mod), params, 1, 0);
+    Celestial_Type* nullary = celestial_type_function(mod, i64_type(mod), NULL, 0, 0);
+    Celestial_Builder b;
+    char name[16];
+
+    Celestial_Function* prev = celestial_function_create(mod, "f0", unary);
+    celestial_builder_init(&b, mod);
+    b.function = prev;
+    celestial_builder_position(&b, celestial_block_create(prev, "entry"));
+    celestial_build_return(&b, prev->params[0]);
+
+    for (int i = 1; i <= X64_TEST_CHAIN; i++) {
+        snprintf(name, sizeof(name), "f%d", i);
+        Celestial_Function* fn = celestial_function_create(mod, name, unary);
+        b.function = fn;
+        celestial_builder_position(&b, celestial_block_create(fn, "entry"));
+        Celestial_Value* arg = celestial_build_add(&b, fn->params[0], i64c(mod, i), "arg");
+        Celestial_Value* call = celestial_build_call(&b, prev, &arg, 1, "call");
+        celestial_build_return(&b, celestial_build_mul(&b, call, i64c(mod, 3), "r"));
+        prev = fn;
+    }
+
+    Celestial_Function* main_fn = celestial_function_create(mod, "main", nullary);
+    b.function = main_fn;
+    celestial_builder_position(&b, celestial_block_create(main_fn, "entry"));
+    Celestial_Value* one = i64c(mod, 1);
+    celestial_build_return(&b, celestial_build_call(&b, prev, &one, 1, "r"));
+    return mod;
+}
+
+TEST(test_x64_parallel_matches_serial) {
+    Celestial_Module* mod = make_chain_module();
+    X64_Buffer serial, parallel;
+    ASSERT_TRUE(seraph_vbit_is_true(x64_buf_init(&serial, 4096)));
+    ASSERT_TRUE(seraph_vbit_is_true(x64_buf_init(&parallel, 4096)));
+
+    ASSERT_TRUE(seraph_vbit_is_true(celestial_compile_module(mod, &serial, &test_arena)));
+    ASSERT_TRUE(seraph_vbit_is_true(
+        celestial_compile_module_parallel(mod, &parallel, &test_arena, 4)));
+    ASSERT_EQ(serial.size, parallel.size);
+    ASSERT_EQ(memcmp(serial.code, parallel.code, serial.size), 0);
+
+    /* A fresh buffer for the auto-sized pool gives the same bytes too */
+    x64_buf_free(&parallel);
+    ASSERT_TRUE(seraph_vbit_is_true(x64_buf_init(&parallel, 4096)));
+    ASSERT_TRUE(seraph_vbit_is_true(
+        celestial_compile_module_parallel(mod, &parallel, &test_arena, 0)));
+    ASSERT_EQ(memcmp(serial.code, parallel.code, serial.size), 0);
+
+    x64_buf_free(&serial);
+    x64_buf_free(&parallel);
+    free_module(mod);
+    return 1;
+}
+
+TEST(test_arm64_parallel_matches_serial) {
+    Celestial_Module* mod = make_chain_module();
+    size_t bytes = 256 * 1024;
+    void* mem_serial = seraph_arena_alloc(&test_arena, bytes, 4);
+    void* mem_parallel = seraph_arena_alloc(&test_arena, bytes, 4);
+    ASSERT_NOT_NULL(mem_serial);
+    ASSERT_NOT_NULL(mem_parallel);
+
+    ARM64_Buffer serial, parallel;
+    ARM64_Context ctx;
+    arm64_buffer_init(&serial, mem_serial, bytes);
+    arm64_context_init(&ctx, &serial, mod, &test_arena);
+    arm64_compile_module(&ctx);
+
+    arm64_buffer_init(&parallel, mem_parallel, bytes);
+    arm64_context_init(&ctx, &parallel, mod, &test_arena);
+    arm64_compile_module_parallel(&ctx, 4);
+
+    ASSERT_TRUE(serial.count > X64_TEST_CHAIN);
+    ASSERT_EQ(serial.count, parallel.count);
+    ASSERT_EQ(memcmp(serial.data, parallel.data, serial.count * sizeof(uint32_t)), 0);
+
+    free_module(mod);
+    return 1;
+}
+
+#if X64_TEST_CAN_EXECUTE
+static void remove_cache_dir(const char* dir) {
+    DIR* d = opendir(dir);
+    if (d) {
+        char path[CELESTIAL_CACHE_PATH_MAX + 256];
+        struct dirent* e;
+        while ((e = readdir(d)) != NULL) {
+            if (e->d_name[0] == '.') continue;
+            snprintf(path, sizeof(path), "%s/%s", dir, e->d_name);
+            unlink(path);
+        }
+        closedir(d);
+    }
+    rmdir(dir);
+}
+#endif
+
+/** Compile through the cache and compare against the reference bytes */
+static int compile_cached_matches(Celestial_Module* mod, Celestial_Cache* cache,
+                                  const X64_Buffer* reference) {
+    X64_Buffer out;
+    if (!seraph_vbit_is_true(x64_buf_init(&out, 4096))) return 0;
+    int ok = seraph_vbit_is_true(celestial_compile_module_cached(mod, &out, &test_arena,
+                                                                 2, cache)) &&
+             out.size == reference->size &&
+             memcmp(out.code, reference->code, out.size) == 0;
+    x64_buf_free(&out);
+    return ok;
+}
+
+TEST(test_x64_cache_rebuild) {
+#if X64_TEST_CAN_EXECUTE
+    Celestial_Module* mod = make_chain_module();
+    uint32_t fn_count = X64_TEST_CHAIN + 2;
+    X64_Buffer reference;
+    ASSERT_TRUE(seraph_vbit_is_true(x64_buf_init(&reference, 4096)));
+    ASSERT_TRUE(seraph_vbit_is_true(
+        celestial_compile_module_parallel(mod, &reference, &test_arena, 2)));
+
+    char dir[] = "/tmp/seraph_x64_cache_XXXXXX";
+    ASSERT_NOT_NULL(mkdtemp(dir));
+
+    /* Cold: everything is lowered and stored */
+    Celestial_Cache cache;
+    ASSERT_TRUE(seraph_vbit_is_true(celestial_cache_open(&cache, dir, "x64-test", 1)));
+    ASSERT_TRUE(compile_cached_matches(mod, &cache, &reference));
+    ASSERT_EQ(cache.lookups, fn_count);
+    ASSERT_EQ(cache.hits, 0u);
+    ASSERT_EQ(cache.stores, fn_count);
+
+    /* Warm: everything comes back from disk with relocations intact */
+    ASSERT_TRUE(seraph_vbit_is_true(celestial_cache_open(&cache, dir, "x64-test", 1)));
+    ASSERT_TRUE(compile_cached_matches(mod, &cache, &reference));
+    ASSERT_EQ(cache.hits, fn_count);
+    ASSERT_EQ(cache.stores, 0u);
+
+    /* Another compiler identity never sees those entries */
+    ASSERT_TRUE(seraph_vbit_is_true(celestial_cache_open(&cache, dir, "x64-other", 1)));
+    uint8_t key_a[CELESTIAL_CACHE_KEY_SIZE], key_b[CELESTIAL_CACHE_KEY_SIZE];
+    celestial_cache_key(&cache, mod->functions, key_a);
+    ASSERT_TRUE(seraph_vbit_is_true(celestial_cache_open(&cache, dir, "x64-test", 1)));
+    celestial_cache_key(&cache, mod->functions, key_b);
+    ASSERT_NE(memcmp(key_a, key_b, sizeof(key_a)), 0);
+
+    /* Editing one function's IR invalidates only that function */
+    Celestial_Function* fn = mod->functions;
+    while (fn && strcmp(fn->name, "f7") != 0) fn = fn->next;
+    ASSERT_NOT_NULL(fn);
+    fn->entry->first->operands[1]->constant.i64 = 70;
+    x64_buf_free(&reference);
+    ASSERT_TRUE(seraph_vbit_is_true(x64_buf_init(&reference, 4096)));
+    ASSERT_TRUE(seraph_vbit_is_true(
+        celestial_compile_module_parallel(mod, &reference, &test_arena, 2)));
+
+    ASSERT_TRUE(compile_cached_matches(mod, &cache, &reference));
+    ASSERT_EQ(cache.hits, fn_count - 1);
+    ASSERT_EQ(cache.stores, 1u);
+
+    remove_cache_dir(dir);
+    x64_buf_free(&reference);
+    free_module(mod);
+#endif
+    return 1;
+}
+
+/*============================================================================
+ * Test Runner
+ *============================================================================*/
+
+void run_seraphim_x64_tests(void) {
+    printf("\n=== MC29: Seraphim x64 Instruction Selection Tests ===\n");
+    if (!X64_TEST_CAN_EXECUTE) {
+        printf("  (not an x86-64 POSIX host: generated code is not executed)\n");
+    }
+
+    printf("\nBranches:\n");
+    RUN_TEST(test_x64_branch_fused);
+    RUN_TEST(test_x64_branch_unfused);
+    RUN_TEST(test_x64_jump_fallthrough);
+
+    printf("\nImmediate Forms:\n");
+    RUN_TEST(test_x64_arith_imm);
+    RUN_TEST(test_x64_bitwise_imm);
+    RUN_TEST(test_x64_negative_const);
+
+    printf("\nMemory:\n");
+    RUN_TEST(test_x64_alloca_direct);
+    RUN_TEST(test_x64_loop);
+
+    printf("\nParallel Compilation:\n");
+    RUN_TEST(test_x64_parallel_matches_serial);
+    RUN_TEST(test_arm64_parallel_matches_serial);
+
+    printf("\nIncremental Cache:\n");
+    RUN_TEST(test_x64_cache_rebuild);
+
+    printf("\nSeraphim x64: %d/%d tests passed\n", tests_passed, tests_run);
+}
@@ -673,6 +673,194 @@ void test_render_null_safety(void) {
     seraph_surface_destroy(&surface);
 }
 
+void test_render_orb_coverage(void) {
+    Seraph_Surface surface;
+    seraph_surface_init(&surface, 200, 200);
+
+    char data[32];
+    Seraph_Capability cap = seraph_cap_create(data, sizeof(data), 1, SERAPH_CAP_RW);
+    int32_t idx = seraph_surface_create_orb(&surface, cap, 30.0f, 0.0f);
+    ASSERT(idx >= 0);
+
+    /* Radius 30 at (60, 60); a notification turns the glow band on */
+    Seraph_Orb* orb = &surface.orbs[idx];
+    orb->position_x.primal = seraph_q128_from_i64(60);
+    orb->position_y.primal = seraph_q128_from_i64(60);
+    orb->notifications = 1;
+
+    uint32_t* framebuffer = (uint32_t*)malloc(200 * 200 * sizeof(uint32_t));
+    ASSERT(framebuffer != NULL);
+    seraph_surface_render(&surface, framebuffer, 200, 200);
+
+    uint32_t bg = seraph_color_to_u32(SERAPH_THEME_BACKGROUND);
+    uint32_t fill = framebuffer[60 * 200 + 60];
+    ASSERT(fill != bg);
+    ASSERT_EQ(framebuffer[80 * 200 + 60], fill);        /* Still inside */
+    uint32_t glow = framebuffer[60 * 200 + 105];        /* Halfway through the glow band */
+    ASSERT(glow != bg && glow != fill);
+    ASSERT_EQ(framebuffer[60 * 200 + 125], bg);         /* Past 2r */
+    ASSERT_EQ(framebuffer[199 * 200 + 0], bg);
+
+    free(framebuffer);
+    seraph_surface_destroy(&surface);
+}
+
+void test_render_tiled_matches_direct(void) {
+    /* Not a multiple of the tile size, with orbs hanging off every edge */
+    const uint32_t w = 150, h = 97;
+    Seraph_Surface surface;
+    seraph_surface_init(&surface, w, h);
+
+    static const float pos[][2] = {
+        { 10.25f, 12.5f }, { 140.0f, 90.75f }, { 75.5f, 48.0f },
+        { -8.0f, 60.25f }, { 70.0f, 100.5f }, { 33.75f, 70.0f }
+    };
+    char data[6][32];
+    for (int i = 0; i < 6; i++) {
+        Seraph_Capability cap = seraph_cap_create(data[i], sizeof(data[i]), 1, SERAPH_CAP_RW);
+        int32_t idx = seraph_surface_create_orb(&surface, cap, 30.0f, (float)i);
+        ASSERT(idx >= 0);
+        Seraph_Orb* orb = &surface.orbs[idx];
+        orb->position_x.primal = seraph_q128_from_double((double)pos[i][0]);
+        orb->position_y.primal = seraph_q128_from_double((double)pos[i][1]);
+        orb->radius.primal = seraph_q128_from_double(12.5 + 3.0 * i);
+        orb->notifications = (uint32_t)(i & 1);
+    }
+    surface.orbs[1].state = SERAPH_ORB_PERIPHERAL;
+    surface.orbs[2].focused = SERAPH_VBIT_TRUE;
+
+    uint32_t* tiled = (uint32_t*)malloc(w * h * sizeof(uint32_t));
+    uint32_t* direct = (uint32_t*)malloc(w * h * sizeof(uint32_t));
+    ASSERT(tiled != NULL && direct != NULL);
+    seraph_surface_render(&surface, tiled, w, h);
+
+    /* Same paint order one disc at a time over the whole frame */
+    for (uint32_t i = 0; i < w * h; i++) {
+        direct[i] = seraph_color_to_u32(SERAPH_THEME_BACKGROUND);
+    }
+    seraph_surface_render_locus(&surface.locus, direct, w, h);
+    for (int pass = 0; pass < 2; pass++) {
+        for (int i = 0; i < SERAPH_SURFACE_MAX_ORBS; i++) {
+            Seraph_Orb* orb = &surface.orbs[i];
+            if ((orb->state == SERAPH_ORB_PERIPHERAL) != (pass == 0)) continue;
+            seraph_surface_render_orb(orb, direct, w, h,
+                                      (float)seraph_q128_to_double(orb->position_x.primal),
+                                      (float)seraph_q128_to_double(orb->position_y.primal));
+        }
+    }
+
+    ASSERT(memcmp(tiled, direct, w * h * sizeof(uint32_t)) == 0);
+
+    free(tiled);
+    free(direct);
+    seraph_surface_destroy(&surface);
+}
+
+static bool damage_covers(const Seraph_Surface_Damage* damage, uint32_t x, uint32_t y) {
+    for (uint32_t i = 0; i < damage->count; i++) {
+        const Seraph_Surface_Rect* r = &damage->rects[i];
+        if (x >= r->x && x < r->x + r->width && y >= r->y && y < r->y + r->height) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void test_render_damage_idle(void) {
+    const uint32_t w = 160, h = 120;
+    Seraph_Surface surface;
+    seraph_surface_init(&surface, w, h);
+    char data[32];
+    Seraph_Capability cap = seraph_cap_create(data, sizeof(data), 1, SERAPH_CAP_RW);
+    ASSERT(seraph_surface_create_orb(&surface, cap, 40.0f, 0.0f) >= 0);
+
+    uint32_t* framebuffer = (uint32_t*)malloc(w * h * sizeof(uint32_t));
+    ASSERT(framebuffer != NULL);
+
+    /* First frame is drawn in full */
+    seraph_surface_render(&surface, framebuffer, w, h);
+    const Seraph_Surface_Damage* damage = seraph_surface_get_damage(&surface);
+    ASSERT(damage != NULL);
+    ASSERT_EQ(damage->count, 1u);
+    ASSERT_EQ(damage->rects[0].width, w);
+    ASSERT_EQ(damage->rects[0].height, h);
+
+    /* Nothing changed: nothing drawn, even over a scribbled pixel */
+    framebuffer[0] = 0x12345678;
+    seraph_surface_render(&surface, framebuffer, w, h);
+    ASSERT_EQ(damage->count, 0u);
+    ASSERT_EQ(framebuffer[0], 0x12345678u);
+
+    /* Invalidation and a different buffer both force a full frame */
+    seraph_surface_invalidate(&surface);
+    seraph_surface_render(&surface, framebuffer, w, h);
+    ASSERT_EQ(damage->count, 1u);
+    ASSERT_EQ(framebuffer[0], seraph_color_to_u32(SERAPH_THEME_BACKGROUND));
+
+    uint32_t* other = (uint32_t*)malloc(w * h * sizeof(uint32_t));
+    ASSERT(other != NULL);
+    seraph_surface_render(&surface, other, w, h);
+    ASSERT_EQ(damage->count, 1u);
+    ASSERT(memcmp(framebuffer, other, w * h * sizeof(uint32_t)) == 0);
+
+    free(other);
+    free(framebuffer);
+    seraph_surface_destroy(&surface);
+}
+
+void test_render_damage_partial(void) {
+    const uint32_t w = 300, h = 200;
+    Seraph_Surface surface;
+    seraph_surface_init(&surface, w, h);
+    char data[3][32];
+    int32_t idx[3];
+    for (int i = 0; i < 3; i++) {
+        Seraph_Capability cap = seraph_cap_create(data[i], sizeof(data[i]), 1, SERAPH_CAP_RW);
+        idx[i] = seraph_surface_create_orb(&surface, cap, 90.0f, 2.1f * (float)i);
+        ASSERT(idx[i] >= 0);
+    }
+
+    uint32_t* framebuffer = (uint32_t*)malloc(w * h * sizeof(uint32_t));
+    uint32_t* fresh = (uint32_t*)malloc(w * h * sizeof(uint32_t));
+    ASSERT(framebuffer != NULL && fresh != NULL);
+    seraph_surface_render(&surface, framebuffer, w, h);
+
+    /* Move one orb and light another's glow */
+    Seraph_Orb* moved = &surface.orbs[idx[0]];
+    int64_t old_x = (int64_t)seraph_q128_to_double(moved->position_x.primal);
+    int64_t old_y = (int64_t)seraph_q128_to_double(moved->position_y.primal);
+    moved->position_x.primal = seraph_q128_add(moved->position_x.primal, seraph_q128_from_i64(7));
+    surface.orbs[idx[1]].notifications = 2;
+    seraph_surface_render(&surface, framebuffer, w, h);
+
+    const Seraph_Surface_Damage* damage = seraph_surface_get_damage(&surface);
+    ASSERT(damage->count >= 1);
+    uint64_t area = 0;
+    for (uint32_t i = 0; i < damage->count; i++) {
+        const Seraph_Surface_Rect* r = &damage->rects[i];
+        ASSERT_EQ(r->x % 32, 0u);
+        ASSERT_EQ(r->y % 32, 0u);
+        ASSERT(r->x + r->width <= w && r->y + r->height <= h);
+        for (uint32_t j = i + 1; j < damage->count; j++) {
+            const Seraph_Surface_Rect* o = &damage->rects[j];
+            ASSERT(r->x + r->width <= o->x || o->x + o->width <= r->x ||
+                   r->y + r->height <= o->y || o->y + o->height <= r->y);
+        }
+        area += (uint64_t)r->width * r->height;
+    }
+    ASSERT(area < (uint64_t)w * h);
+    ASSERT(damage_covers(damage, (uint32_t)old_x, (uint32_t)old_y));
+    ASSERT(damage_covers(damage, (uint32_t)old_x + 7, (uint32_t)old_y));
+
+    /* The partial frame is exactly what a full redraw produces */
+    seraph_surface_render(&surface, fresh, w, h);
+    ASSERT(memcmp(framebuffer, fresh, w * h * sizeof(uint32_t)) == 0);
+
+    free(fresh);
+    free(framebuffer);
+    seraph_surface_destroy(&surface);
+}
+
 /*============================================================================
  * Orb State Tests
  *============================================================================*/
@@ -1041,6 +1229,10 @@ void run_surface_tests(void) {
     RUN_TEST(render_no_crash);
     RUN_TEST(render_background_color);
     RUN_TEST(render_null_safety);
+    RUN_TEST(render_orb_coverage);
+    RUN_TEST(render_tiled_matches_direct);
+    RUN_TEST(render_damage_idle);
+    RUN_TEST(render_damage_partial);
 
     /* State tests */
     RUN_TEST(orb_state_is_visible);
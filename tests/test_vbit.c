@@ -7,6 +7,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <assert.h>
+#include <string.h>
 
 /* Test counters */
 static int tests_run = 0;
@@ -284,6 +285,131 @@ TEST(vbit_array_ops) {
     ASSERT(result[2] == SERAPH_VBIT_VOID);
 }
 
+/*============================================================================
+ * SIMD Kernel Tests
+ *============================================================================*/
+
+#define VBIT_DIFF_MAX 300
+
+static uint64_t vbit_test_rng = 0x243F6A8885A308D3ull;
+
+/* Mostly canonical VBITs, with the odd non-canonical byte mixed in */
+static Seraph_Vbit vbit_test_random(void) {
+    vbit_test_rng ^= vbit_test_rng << 13;
+    vbit_test_rng ^= vbit_test_rng >> 7;
+    vbit_test_rng ^= vbit_test_rng << 17;
+    static const Seraph_Vbit pick[8] = {
+        SERAPH_VBIT_FALSE, SERAPH_VBIT_TRUE, SERAPH_VBIT_VOID, SERAPH_VBIT_TRUE,
+        SERAPH_VBIT_FALSE, SERAPH_VBIT_TRUE, SERAPH_VBIT_FALSE, 0x5A
+    };
+    return pick[vbit_test_rng % 8];
+}
+
+typedef struct {
+    Seraph_Vbit not_r[VBIT_DIFF_MAX];
+    Seraph_Vbit and_r[VBIT_DIFF_MAX];
+    Seraph_Vbit or_r[VBIT_DIFF_MAX];
+    Seraph_Vbit xor_r[VBIT_DIFF_MAX];
+    Seraph_Vbit unpacked[VBIT_DIFF_MAX];
+    Seraph_Vbit round_trip[VBIT_DIFF_MAX];
+    uint8_t bitmap[VBIT_DIFF_MAX / 8 + 1];
+    size_t indices[VBIT_DIFF_MAX];
+    Seraph_Vbit_Packed packed[VBIT_DIFF_MAX / 64 + 1];
+    size_t found;
+    size_t counts[3];
+    Seraph_Vbit all;
+    Seraph_Vbit any;
+} Vbit_Diff_Result;
+
+static void vbit_diff_run(const Seraph_Vbit* a, const Seraph_Vbit* b, size_t n,
+                          Vbit_Diff_Result* r) {
+    memset(r, 0, sizeof(*r));
+    seraph_vbit_not_array(a, r->not_r, n);
+    seraph_vbit_and_array(a, b, r->and_r, n);
+    seraph_vbit_or_array(a, b, r->or_r, n);
+    seraph_vbit_xor_array(a, b, r->xor_r, n);
+    seraph_vbit_pack_bitmap(a, n, r->bitmap);
+    seraph_vbit_unpack_bitmap(r->bitmap, n, r->unpacked);
+    r->found = seraph_vbit_filter_true(a, n, r->indices);
+    seraph_vbit_pack(a, n, r->packed);
+    seraph_vbit_unpack(r->packed, n, r->round_trip);
+    r->counts[0] = seraph_vbit_count_true(a, n);
+    r->counts[1] = seraph_vbit_count_false(a, n);
+    r->counts[2] = seraph_vbit_count_void(a, n);
+    r->all = seraph_vbit_all_true(a, n);
+    r->any = seraph_vbit_any_true(a, n);
+}
+
+TEST(vbit_simd_matches_scalar) {
+    static Seraph_Vbit a[VBIT_DIFF_MAX];
+    static Seraph_Vbit b[VBIT_DIFF_MAX];
+    static Vbit_Diff_Result expect;
+    static Vbit_Diff_Result got;
+    static const Seraph_Vbit_Impl impls[] = { SERAPH_VBIT_IMPL_SSE42, SERAPH_VBIT_IMPL_AVX2 };
+
+    for (size_t n = 0; n <= VBIT_DIFF_MAX; n += (n < 70 ? 1 : 23)) {
+        for (size_t i = 0; i < n; i++) {
+            a[i] = vbit_test_random();
+            b[i] = vbit_test_random();
+        }
+        /* Long runs keep all_true/any_true from stopping in the first vector */
+        if (n % 3 == 0) memset(a, SERAPH_VBIT_TRUE, n / 2);
+        if (n % 3 == 1) memset(a, SERAPH_VBIT_FALSE, n / 2);
+
+        ASSERT(seraph_vbit_set_impl(SERAPH_VBIT_IMPL_SCALAR));
+        vbit_diff_run(a, b, n, &expect);
+
+        for (size_t v = 0; v < sizeof(impls) / sizeof(impls[0]); v++) {
+            if (!seraph_vbit_set_impl(impls[v])) continue;
+            vbit_diff_run(a, b, n, &got);
+            ASSERT(memcmp(&got, &expect, sizeof(got)) == 0);
+        }
+    }
+    seraph_vbit_set_impl(SERAPH_VBIT_IMPL_AUTO);
+    ASSERT(seraph_vbit_get_impl() != SERAPH_VBIT_IMPL_AUTO);
+}
+
+TEST(vbit_packed_logic) {
+    static const Seraph_Vbit vals[3] = { SERAPH_VBIT_FALSE, SERAPH_VBIT_TRUE, SERAPH_VBIT_VOID };
+    Seraph_Vbit a[130];
+    Seraph_Vbit b[130];
+    Seraph_Vbit r[130];
+    Seraph_Vbit_Packed pa[3], pb[3], pr[3];
+
+    /* Every (a, b) pair, repeated across word boundaries */
+    for (size_t i = 0; i < 130; i++) {
+        a[i] = vals[i % 3];
+        b[i] = vals[(i / 3) % 3];
+    }
+    seraph_vbit_pack(a, 130, pa);
+    seraph_vbit_pack(b, 130, pb);
+    ASSERT(seraph_vbit_packed_words(130) == 3);
+    ASSERT(seraph_vbit_packed_count_true(pa, 130) == seraph_vbit_count_true(a, 130));
+    ASSERT(seraph_vbit_packed_count_false(pa, 130) == seraph_vbit_count_false(a, 130));
+
+    seraph_vbit_packed_and(pa, pb, pr, 3);
+    seraph_vbit_unpack(pr, 130, r);
+    for (size_t i = 0; i < 130; i++) ASSERT(r[i] == seraph_vbit_and(a[i], b[i]));
+
+    seraph_vbit_packed_or(pa, pb, pr, 3);
+    seraph_vbit_unpack(pr, 130, r);
+    for (size_t i = 0; i < 130; i++) ASSERT(r[i] == seraph_vbit_or(a[i], b[i]));
+
+    seraph_vbit_packed_xor(pa, pb, pr, 3);
+    seraph_vbit_unpack(pr, 130, r);
+    for (size_t i = 0; i < 130; i++) ASSERT(r[i] == seraph_vbit_xor(a[i], b[i]));
+
+    seraph_vbit_packed_not(pa, pr, 3);
+    seraph_vbit_unpack(pr, 130, r);
+    for (size_t i = 0; i < 130; i++) ASSERT(r[i] == seraph_vbit_not(a[i]));
+
+    /* Non-canonical bytes pack as VOID */
+    Seraph_Vbit odd[2] = { 0x5A, SERAPH_VBIT_TRUE };
+    seraph_vbit_pack(odd, 2, pr);
+    seraph_vbit_unpack(pr, 2, r);
+    ASSERT(r[0] == SERAPH_VBIT_VOID && r[1] == SERAPH_VBIT_TRUE);
+}
+
 /*============================================================================
  * VBIT Select Tests
  *============================================================================*/
@@ -332,6 +458,8 @@ void run_vbit_tests(void) {
     RUN_TEST(vbit_any_true);
     RUN_TEST(vbit_counts);
     RUN_TEST(vbit_array_ops);
+    RUN_TEST(vbit_simd_matches_scalar);
+    RUN_TEST(vbit_packed_logic);
 
     /* Selection */
     RUN_TEST(vbit_select);